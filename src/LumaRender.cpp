@@ -0,0 +1,452 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <future>
+#include <cstdio>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include "src/backend/soft/SoftRenderer.h"
+#include "src/common/CameraPath.h"
+#include "src/common/ImageWriter.h"
+#include "src/common/ImageCompare.h"
+#include "src/common/Image.h"
+#include "src/common/Parallel.h"
+#include "src/common/Mesh.h"
+#include "src/common/VramBudget.h"
+
+// offline renderer: renders every frame of a camera path with the cpu backend and writes an image sequence. frames
+// are split into tiles that are shaded on all cores, and each frame is written while the next one renders.
+// --golden renders every keyframe of a path as one view and compares it with the stored golden image, which is the
+// regression test for shading changes
+namespace {
+    struct Options {
+        std::string cameraPath;
+        std::string output = "frames/frame";
+        uint32_t width = 1200;
+        uint32_t height = 900;
+        float fps = 30.0f;
+        // 0 renders duration * fps + 1 frames
+        uint32_t frames = 0;
+        bool png = true;
+        bool exr = false;
+        // golden image test, a view fails below any of the minimums or above the flip maximum
+        std::string goldenDirectory;
+        bool updateGolden = false;
+        float minPsnr = 35.0f;
+        float minSsim = 0.98f;
+        float maxFlip = 0.05f;
+        // compare two existing images instead of rendering
+        std::vector<std::string> compareFiles;
+        // plan the gpu memory of a scene at the image size instead of rendering
+        std::string budgetScene;
+        uint32_t samples = 4;
+        // time frames of the default view instead of rendering a path
+        uint32_t benchFrames = 0;
+    };
+
+    const char *DefaultGoldenPath = "assets/camera/golden.txt";
+
+    void printUsage() {
+        std::cout << "usage: LumaRender <camera path> [options]\n"
+                  << "  --output <prefix>   frames are written to <prefix>_0000.png and so on (frames/frame)\n"
+                  << "  --size <w> <h>      image size (1200 900)\n"
+                  << "  --fps <n>           frames per second of path time (30)\n"
+                  << "  --frames <n>        render n frames spread over the whole path instead\n"
+                  << "  --format <f>        png, exr or both (png)\n"
+                  << "  --golden <dir>      render each keyframe as a view and compare it with <dir>/golden_0000.png\n"
+                  << "                      and so on, the camera path defaults to " << DefaultGoldenPath << "\n"
+                  << "  --update-golden     with --golden, write the golden images instead of comparing\n"
+                  << "  --min-psnr <db>     golden test threshold (35)\n"
+                  << "  --min-ssim <s>      golden test threshold (0.98)\n"
+                  << "  --max-flip <e>      golden test threshold on the mean FLIP error (0.05)\n"
+                  << "  --compare <a> <b> [heatmap]  print the metrics of two images and write the FLIP heatmap\n"
+                  << "  --budget <scene>    print the gpu memory the dx12 backend needs for the scene at --size\n"
+                  << "  --samples <n>       msaa samples of the --budget render targets (4)\n"
+                  << "  --bench <n>         render n frames of the default view at --size and print the frame times\n"
+                  << "camera path lines are: time position.x position.y position.z pitch yaw fov\n"
+                  << "scene lines are: texture|computed <name> <w> <h> <format> [layers] [mips, 0 for all] | "
+                  << "buffer <name> <bytes> | mesh <name> <vertices> <indices> | mesh <name> <file>" << std::endl;
+    }
+
+    Options parseOptions(int argc, char *argv[]) {
+        Options options;
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            auto value = [&]() -> std::string {
+                if (i + 1 >= argc) {
+                    throw std::runtime_error("Missing value for " + arg);
+                }
+                return argv[++i];
+            };
+            if (arg == "--output") {
+                options.output = value();
+            } else if (arg == "--size") {
+                options.width = static_cast<uint32_t>(std::max(std::stoi(value()), 1));
+                options.height = static_cast<uint32_t>(std::max(std::stoi(value()), 1));
+            } else if (arg == "--fps") {
+                options.fps = std::max(std::stof(value()), 0.001f);
+            } else if (arg == "--frames") {
+                options.frames = static_cast<uint32_t>(std::max(std::stoi(value()), 1));
+            } else if (arg == "--format") {
+                std::string format = value();
+                options.png = format == "png" || format == "both";
+                options.exr = format == "exr" || format == "both";
+                if (!options.png && !options.exr) {
+                    throw std::runtime_error("Unknown image format: " + format);
+                }
+            } else if (arg == "--golden") {
+                options.goldenDirectory = value();
+            } else if (arg == "--update-golden") {
+                options.updateGolden = true;
+            } else if (arg == "--min-psnr") {
+                options.minPsnr = std::stof(value());
+            } else if (arg == "--min-ssim") {
+                options.minSsim = std::stof(value());
+            } else if (arg == "--max-flip") {
+                options.maxFlip = std::stof(value());
+            } else if (arg == "--compare") {
+                options.compareFiles.push_back(value());
+                options.compareFiles.push_back(value());
+                if (i + 1 < argc && std::string(argv[i + 1]).rfind("--", 0) != 0) {
+                    options.compareFiles.push_back(argv[++i]);
+                }
+            } else if (arg == "--budget") {
+                options.budgetScene = value();
+            } else if (arg == "--samples") {
+                options.samples = static_cast<uint32_t>(std::max(std::stoi(value()), 1));
+            } else if (arg == "--bench") {
+                options.benchFrames = static_cast<uint32_t>(std::max(std::stoi(value()), 1));
+            } else if (arg.rfind("--", 0) == 0 || !options.cameraPath.empty()) {
+                throw std::runtime_error("Unknown argument: " + arg);
+            } else {
+                options.cameraPath = arg;
+            }
+        }
+        if (options.updateGolden && options.goldenDirectory.empty()) {
+            throw std::runtime_error("--update-golden needs --golden <dir>");
+        }
+        if (options.cameraPath.empty() && !options.goldenDirectory.empty()) {
+            options.cameraPath = DefaultGoldenPath;
+        }
+        if (options.cameraPath.empty() && options.compareFiles.empty() && options.budgetScene.empty() &&
+            options.benchFrames == 0) {
+            throw std::runtime_error("No camera path given");
+        }
+        return options;
+    }
+
+    // peak resident memory of the process in bytes
+    size_t peakMemory() {
+#if defined(_WIN32)
+        PROCESS_MEMORY_COUNTERS counters = {};
+        GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+        return counters.PeakWorkingSetSize;
+#else
+        rusage usage = {};
+        getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+        return static_cast<size_t>(usage.ru_maxrss);
+#else
+        return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+    }
+
+    std::string frameName(const std::string &prefix, uint32_t frame, const char *extension) {
+        char number[16];
+        std::snprintf(number, sizeof(number), "_%04u", frame);
+        return prefix + number + extension;
+    }
+
+    std::vector<uint32_t> loadPixels(const std::string &filename, uint32_t &width, uint32_t &height) {
+        std::shared_ptr<Image> image = Image::fromFile(filename, 4);
+        if (image->isHDR()) {
+            throw std::runtime_error("Expected an 8 bit image: " + filename);
+        }
+        width = static_cast<uint32_t>(image->width());
+        height = static_cast<uint32_t>(image->height());
+        const uint32_t *pixels = image->pixels<uint32_t>();
+        return std::vector<uint32_t>(pixels, pixels + static_cast<size_t>(width) * height);
+    }
+
+    void printMetrics(const ImageMetrics &metrics) {
+        std::cout << "rmse " << metrics.rmse << ", psnr " << metrics.psnr << " dB, ssim " << metrics.ssim
+                  << ", flip mean " << metrics.flipMean << " max " << metrics.flipMax;
+    }
+
+    int compareImages(const Options &options) {
+        uint32_t width, height, testWidth, testHeight;
+        std::vector<uint32_t> reference = loadPixels(options.compareFiles[0], width, height);
+        std::vector<uint32_t> test = loadPixels(options.compareFiles[1], testWidth, testHeight);
+        if (width != testWidth || height != testHeight) {
+            throw std::runtime_error("Image sizes differ");
+        }
+        std::vector<float> errors;
+        printMetrics(ImageCompare::compare(reference.data(), test.data(), width, height, &errors));
+        std::cout << std::endl;
+        if (options.compareFiles.size() > 2) {
+            ImageWriter::writePNG(options.compareFiles[2], width, height, ImageCompare::heatmap(errors).data());
+        }
+        return 0;
+    }
+
+    // scene files list what the dx12 backend creates in setup(), one resource per line. computed textures are filled
+    // on the gpu and uploaded textures from files. meshes are either counts or a mesh file that is loaded to count its
+    // vertices and indices
+    void loadBudgetScene(const std::string &filename, VramBudget &budget) {
+        std::ifstream file(filename);
+        if (!file) {
+            throw std::runtime_error("Failed to open scene file: " + filename);
+        }
+
+        std::string line;
+        for (int lineNumber = 1; std::getline(file, line); ++lineNumber) {
+            size_t first = line.find_first_not_of(" \t\r");
+            if (first == std::string::npos || line[first] == '#') {
+                continue;
+            }
+            std::istringstream stream(line);
+            std::string kind, name;
+            bool good = static_cast<bool>(stream >> kind >> name);
+            if (good && (kind == "texture" || kind == "computed")) {
+                ResourceFootprint::TextureDesc desc;
+                std::string format;
+                good = static_cast<bool>(stream >> desc.width >> desc.height >> format);
+                if (good) {
+                    desc.format = ResourceFootprint::formatFromName(format);
+                    desc.mipLevels = 0;
+                    stream >> desc.arraySize >> desc.mipLevels;
+                    budget.addTexture(name, desc, kind == "texture");
+                }
+            } else if (good && kind == "buffer") {
+                uint64_t size;
+                good = static_cast<bool>(stream >> size);
+                if (good) {
+                    budget.addBuffer(name, size);
+                }
+            } else if (good && kind == "mesh") {
+                std::string counts;
+                good = static_cast<bool>(stream >> counts);
+                uint64_t numIndices;
+                if (good && counts.find_first_not_of("0123456789") == std::string::npos && stream >> numIndices) {
+                    budget.addMesh(name, std::stoull(counts), numIndices);
+                } else if (good) {
+                    std::shared_ptr<Mesh> mesh = Mesh::fromFile(counts);
+                    budget.addMesh(name, mesh->vertices().size(), mesh->faces().size() * 3);
+                }
+            } else {
+                good = false;
+            }
+            if (!good) {
+                throw std::runtime_error("Bad scene line at " + filename + ":" + std::to_string(lineNumber));
+            }
+        }
+    }
+
+    int printBudget(const Options &options) {
+        VramBudget budget;
+        loadBudgetScene(options.budgetScene, budget);
+        budget.addFrameResources(options.width, options.height, options.samples, 2);
+        const VramBudget::Report report = budget.report();
+
+        auto mib = [](uint64_t bytes) { return bytes / (1024.0 * 1024.0); };
+        std::cout << options.budgetScene << " at " << options.width << "x" << options.height << ", " << options.samples
+                  << "x msaa" << std::endl;
+        for (uint32_t i = 0; i < VramBudget::NumCategories; ++i) {
+            const VramBudget::CategoryReport &category = report.categories[i];
+            std::cout << "  " << VramBudget::categoryName(VramBudget::Category(i)) << ": " << category.resources
+                      << " resources, " << mib(category.resourceBytes) << " MiB";
+            if (category.heaps > 0) {
+                std::cout << " in " << category.heaps << " heaps";
+            }
+            std::cout << ", " << mib(category.committedBytes) << " MiB committed" << std::endl;
+        }
+        std::cout << "total " << mib(report.totalBytes) << " MiB, " << mib(report.uploadBytes)
+                  << " MiB uploaded in setup, largest upload " << mib(report.largestUpload) << " MiB";
+        if (report.largestUpload > VramBudget::UploadRingSize) {
+            std::cout << " (outgrows the upload ring)";
+        }
+        std::cout << std::endl;
+        return 0;
+    }
+
+    // every keyframe is one view, renders are compared with or written as the golden images and a heatmap of the
+    // FLIP error is written next to each golden image. returns the number of failed views
+    int goldenTest(const Options &options) {
+        CameraPath path = CameraPath::fromFile(options.cameraPath);
+        std::filesystem::create_directories(options.goldenDirectory);
+        const std::string prefix = (std::filesystem::path(options.goldenDirectory) / "golden").string();
+        const std::string heatmapPrefix = (std::filesystem::path(options.goldenDirectory) / "heatmap").string();
+
+        SoftRenderer renderer(options.width, options.height);
+        renderer.init(nullptr);
+        renderer.setup();
+
+        int failures = 0;
+        const std::vector<CameraPath::Keyframe> &views = path.keyframes();
+        for (uint32_t view = 0; view < views.size(); ++view) {
+            const CameraPath::Keyframe &key = views[view];
+            renderer.camera() = Camera(key.position, key.pitch, key.yaw, float(options.width) / options.height,
+                                       key.fov, 0.1f);
+            renderer.draw();
+            const std::string golden = frameName(prefix, view, ".png");
+            if (options.updateGolden) {
+                ImageWriter::writePNG(golden, options.width, options.height, renderer.pixels());
+                std::cout << "view " << view << ": wrote " << golden << std::endl;
+                continue;
+            }
+
+            uint32_t width, height;
+            std::vector<uint32_t> reference = loadPixels(golden, width, height);
+            if (width != options.width || height != options.height) {
+                throw std::runtime_error("Golden image size differs from the render size: " + golden);
+            }
+            std::vector<float> errors;
+            ImageMetrics metrics =
+                ImageCompare::compare(reference.data(), renderer.pixels(), width, height, &errors);
+            ImageWriter::writePNG(frameName(heatmapPrefix, view, ".png"), width, height,
+                                  ImageCompare::heatmap(errors).data());
+
+            bool pass = metrics.psnr >= options.minPsnr && metrics.ssim >= options.minSsim &&
+                        metrics.flipMean <= options.maxFlip;
+            failures += pass ? 0 : 1;
+            std::cout << "view " << view << ": ";
+            printMetrics(metrics);
+            std::cout << (pass ? "  PASS" : "  FAIL") << std::endl;
+        }
+        renderer.exit();
+
+        if (!options.updateGolden) {
+            std::cout << views.size() - failures << " of " << views.size() << " views passed" << std::endl;
+        }
+        return failures;
+    }
+
+    int benchRenderer(const Options &options) {
+        SoftRenderer renderer(options.width, options.height);
+        renderer.init(nullptr);
+        renderer.setup();
+
+        double total = 0.0, best = INFINITY;
+        for (uint32_t frame = 0; frame < options.benchFrames; ++frame) {
+            renderer.draw();
+            total += renderer.frameTime();
+            best = std::min(best, renderer.frameTime());
+        }
+        const Rasterizer::Stats &stats = renderer.stats();
+        std::cout << renderer.width() << "x" << renderer.height() << ", " << options.benchFrames << " frames: average "
+                  << total / options.benchFrames << " ms, best " << best << " ms, "
+                  << ThreadPool::instance().numThreads() << " threads" << std::endl;
+        std::cout << stats.triangles << " triangles, " << stats.culled << " culled, " << stats.clipped << " clipped, "
+                  << stats.tilesRejected << " tiles and " << stats.blocksRejected << " blocks rejected by depth"
+                  << std::endl;
+        renderer.exit();
+        return 0;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    Options options;
+    try {
+        options = parseOptions(argc, argv);
+    } catch (std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        printUsage();
+        return 1;
+    }
+
+    try {
+        if (!options.compareFiles.empty()) {
+            return compareImages(options);
+        }
+        if (!options.goldenDirectory.empty()) {
+            return goldenTest(options) > 0 ? 1 : 0;
+        }
+        if (!options.budgetScene.empty()) {
+            return printBudget(options);
+        }
+        if (options.benchFrames > 0) {
+            return benchRenderer(options);
+        }
+
+        CameraPath path = CameraPath::fromFile(options.cameraPath);
+        const uint32_t numFrames = options.frames > 0 ? options.frames
+                                                      : static_cast<uint32_t>(path.duration() * options.fps) + 1;
+        std::filesystem::path directory = std::filesystem::path(options.output).parent_path();
+        if (!directory.empty()) {
+            std::filesystem::create_directories(directory);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        SoftRenderer renderer(options.width, options.height);
+        renderer.init(nullptr);
+        renderer.setup();
+        std::chrono::duration<double> setupTime = std::chrono::steady_clock::now() - start;
+
+        const size_t numPixels = static_cast<size_t>(options.width) * options.height;
+        std::vector<uint32_t> pixels(numPixels);
+        std::vector<glm::vec3> hdr(options.exr ? numPixels : 0);
+        std::future<void> pendingWrite;
+        double renderTime = 0.0;
+
+        start = std::chrono::steady_clock::now();
+        for (uint32_t frame = 0; frame < numFrames; ++frame) {
+            float time = path.startTime() + frame / options.fps;
+            if (options.frames > 0) {
+                time = path.startTime() + (numFrames > 1 ? path.duration() * frame / (numFrames - 1) : 0.0f);
+            }
+            CameraPath::Keyframe key = path.sample(time);
+            renderer.camera() = Camera(key.position, key.pitch, key.yaw, float(options.width) / options.height,
+                                       key.fov, 0.1f);
+            renderer.draw();
+            renderTime += renderer.frameTime();
+
+            // the copies are reused once the previous frame is on disk, get() also rethrows its write errors
+            if (pendingWrite.valid()) {
+                pendingWrite.get();
+            }
+            std::copy(renderer.pixels(), renderer.pixels() + numPixels, pixels.begin());
+            if (options.exr) {
+                std::copy(renderer.hdr(), renderer.hdr() + numPixels, hdr.begin());
+            }
+            pendingWrite = std::async(std::launch::async, [&options, &pixels, &hdr, frame] {
+                if (options.png) {
+                    ImageWriter::writePNG(frameName(options.output, frame, ".png"), options.width, options.height,
+                                          pixels.data());
+                }
+                if (options.exr) {
+                    ImageWriter::writeEXR(frameName(options.output, frame, ".exr"), options.width, options.height,
+                                          hdr.data());
+                }
+            });
+        }
+        if (pendingWrite.valid()) {
+            pendingWrite.get();
+        }
+        std::chrono::duration<double> totalTime = std::chrono::steady_clock::now() - start;
+        renderer.exit();
+
+        std::cout << numFrames << " frames of " << options.width << "x" << options.height << " in "
+                  << totalTime.count() << " s: " << numFrames / totalTime.count() << " images/s, "
+                  << renderTime / numFrames << " ms average render, " << setupTime.count() << " s setup, "
+                  << ThreadPool::instance().numThreads() << " threads" << std::endl;
+        std::cout << "peak memory " << peakMemory() / (1024.0 * 1024.0) << " MiB" << std::endl;
+    } catch (std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,91 @@
+#include <iostream>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+#include "src/tests/Tests.h"
+
+// checks and benchmarks of the portable code, without a window or a gpu. run from the repository root, the tests that
+// read shaders or assets find them there. without arguments every test runs at its default size, the exit code is the
+// number of tests that failed
+namespace {
+    struct Test {
+        const char *name;
+        int (*run)(uint32_t size);
+        uint32_t defaultSize;
+        uint32_t minSize;
+    };
+
+    const Test Tests[] = {
+        {"parallel", benchParallel, 1 << 20, 1},
+        {"render-graph", benchRenderGraph, 256, 1},
+        {"descriptors", benchDescriptorAllocator, 1 << 20, 1},
+        {"upload", benchUploadRing, 1 << 16, 1},
+        {"heaps", benchHeapAllocator, 1 << 18, 1},
+        {"shader-cache", benchShaderCache, 1 << 20, 1},
+        {"timeline", benchFrameTimeline, 1000, 1},
+        {"pbr", benchPbrShading, 1 << 20, 1},
+        {"textures", benchTextureSampling, 1 << 22, 1},
+        {"octahedral", benchOctahedralMap, 128, 32},
+        {"sampling", benchSampling, 32, 4},
+        {"env-baker", benchEnvBaker, 32, 8},
+        {"brdf", benchBrdfLut, 256, 1},
+        {"probes", benchProbeVolume, 1024, 256},
+        {"occlusion", benchOcclusionCulling, 10000, 0},
+        {"lights", benchLightClusters, 10000, 0},
+        {"scene", benchSceneGraph, 131072, 1},
+        {"sort", benchDrawSort, 1 << 20, 1},
+        {"batcher", benchInstanceBatcher, 1 << 18, 1},
+        {"registry", benchRegistry, 1 << 22, 1},
+        {"constants", benchConstantAllocator, 1 << 16, 1},
+        {"footprint", benchResourceFootprint, 1024, 0},
+        {"image-compare", benchImageCompare, 256, 16},
+        {"render-thread", benchRenderThread, 500, 1},
+    };
+
+    int usage() {
+        std::cerr << "usage: LumaTests [test [size]]" << std::endl << "tests:";
+        for (const Test &test : Tests) {
+            std::cerr << " " << test.name;
+        }
+        std::cerr << std::endl;
+        return 1;
+    }
+
+    bool run(const Test &test, uint32_t size) {
+        std::cout << "== " << test.name << " (" << size << ")" << std::endl;
+        const auto start = std::chrono::steady_clock::now();
+        bool passed = false;
+        try {
+            passed = test.run(std::max(size, test.minSize)) == 0;
+        } catch (std::exception &e) {
+            std::cerr << e.what() << std::endl;
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        std::cout << (passed ? "passed " : "FAILED ") << test.name << " in " << elapsed.count() << " s" << std::endl;
+        return passed;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    if (argc > 3) {
+        return usage();
+    }
+    if (argc == 1) {
+        int failed = 0;
+        for (const Test &test : Tests) {
+            failed += run(test, test.defaultSize) ? 0 : 1;
+        }
+        std::cout << failed << " of " << std::size(Tests) << " tests failed" << std::endl;
+        return failed;
+    }
+    for (const Test &test : Tests) {
+        if (argv[1] == std::string(test.name)) {
+            return run(test, argc == 3 ? static_cast<uint32_t>(std::max(std::stoi(argv[2]), 0)) : test.defaultSize)
+                ? 0 : 1;
+        }
+    }
+    return usage();
+}
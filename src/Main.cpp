@@ -1,16 +1,109 @@
 #include <iostream>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+#include <exception>
 #include <glfw3.h>
 #include <glfw3native.h>
 
 #include "src/common/IRenderer.h"
 #include "src/backend/dx12/DxRenderer.h"
 #include "src/common/Utils.h"
+#include "src/common/BrdfLut.h"
+#include "src/common/ImageWriter.h"
+#include "src/common/EnvBaker.h"
+#include "src/common/FrameTimeline.h"
+#include "src/common/FrameMailbox.h"
 
 void mouse_callback(GLFWwindow *window, double posX, double posY);
 void scroll_callback(GLFWwindow *window, double offsetX, double offsetY);
-void processInput(GLFWwindow *window);
+void processInput(GLFWwindow *window, float deltaTime);
+
+// regenerates src/common/BrdfLutData.h and reports how far the analytic fit is from the table. the error of the fit
+// per texel goes to errorFilename, scale and bias in red and green with NdotV to the right and roughness down
+int bakeBrdfLut(const std::string &filename, const std::string &errorFilename) {
+    BrdfLut lut = BrdfLut::bake();
+    lut.writeEmbeddedHeader(filename);
+
+    std::vector<glm::vec2> errorMap;
+    BrdfLut::ErrorStats error = lut.approximationError(&errorMap);
+    std::vector<glm::vec3> errorPixels;
+    for (const glm::vec2 &texel : errorMap) {
+        errorPixels.push_back(glm::vec3{texel, 0.0f});
+    }
+    ImageWriter::writeEXR(errorFilename, lut.size(), lut.size(), errorPixels.data());
+    std::cout << "BRDF LUT written to " << filename << ", analytic fit rmse " << error.rmse << ", max error "
+              << error.maxError << ", error map written to " << errorFilename << std::endl;
+    return 0;
+}
+
+// rmse is relative to the fixed bake, negative when it does not apply
+void printBakeStats(const std::string &name, const EnvBaker::Stats &stats, float rmse = -1.0f) {
+    std::cout << name << ": " << stats.samples << " samples, fixed " << stats.fixedSamples << " ("
+              << stats.savings() * 100.0f << "% saved), " << stats.unconverged << " of " << stats.texels
+              << " texels unconverged, max error " << stats.maxError;
+    if (rmse >= 0.0f) {
+        std::cout << ", rmse against fixed " << rmse * 100.0f << "%";
+    }
+    std::cout << std::endl;
+}
+
+// runs the adaptive cpu prefilter and irradiance bakers and reports the samples they spent against the shaders,
+// and how far their maps are from the fixed sample count bake
+int bakeEnvironment(const std::string &filename, uint32_t size) {
+    CubeMap env = CubeMap::fromEquirect(*Image::fromFile(filename), size);
+    EnvBaker::Settings settings;
+
+    auto start = std::chrono::steady_clock::now();
+    EnvBaker::Stats prefilterStats, irradianceStats;
+    std::vector<EnvBaker::Stats> levelStats;
+    CubeMap prefilter = EnvBaker::prefilter(env, settings, &prefilterStats, &levelStats);
+    CubeMap irradiance = EnvBaker::irradiance(env, 32, settings, &irradianceStats);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    EnvBaker::Settings fixedSettings;
+    fixedSettings.adaptive = false;
+    CubeMap fixedPrefilter = EnvBaker::prefilter(env, fixedSettings);
+    CubeMap fixedIrradiance = EnvBaker::irradiance(env, 32, fixedSettings);
+
+    for (uint32_t level = 1; level < levelStats.size(); ++level) {
+        printBakeStats("prefilter level " + std::to_string(level), levelStats[level],
+                       EnvBaker::relativeRmse(prefilter, fixedPrefilter, level));
+    }
+    printBakeStats("prefilter", prefilterStats);
+    printBakeStats("irradiance", irradianceStats, EnvBaker::relativeRmse(irradiance, fixedIrradiance, 0));
+    std::cout << "baked in " << elapsed.count() << " s" << std::endl;
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    if ((argc == 3 || argc == 4) && std::string(argv[1]) == "--bake-brdf-lut") {
+        return bakeBrdfLut(argv[2], argc == 4 ? argv[3] : "brdf_approx_error.exr");
+    }
+    if ((argc == 3 || argc == 4) && std::string(argv[1]) == "--bake-env") {
+        return bakeEnvironment(argv[2], argc == 4 ? static_cast<uint32_t>(std::stoi(argv[3])) : 256);
+    }
+
+    UINT framesInFlight = 2, syncInterval = 0;
+    bool threaded = true, octahedralEnv = false, probeVolume = false, brdfApprox = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) == "--frames-in-flight" && i + 1 < argc) {
+            framesInFlight = static_cast<UINT>(std::max(std::stoi(argv[++i]), 1));
+        } else if (std::string(argv[i]) == "--vsync") {
+            syncInterval = 1;
+        } else if (std::string(argv[i]) == "--single-thread") {
+            threaded = false;
+        } else if (std::string(argv[i]) == "--octahedral-env") {
+            octahedralEnv = true;
+        } else if (std::string(argv[i]) == "--probe-volume") {
+            probeVolume = true;
+        } else if (std::string(argv[i]) == "--brdf-approx") {
+            brdfApprox = true;
+        }
+    }
 
-int main() {
     if (!glfwInit()) {
         throw std::runtime_error("Failed to initialize glfw");
     }
@@ -24,16 +117,100 @@ int main() {
     glfwSetScrollCallback(window, scroll_callback);
     glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
 
-    IRenderer *renderer = new DxRenderer();
+    DxRenderer *dxRenderer = new DxRenderer(framesInFlight, syncInterval, octahedralEnv, probeVolume, brdfApprox);
+    IRenderer *renderer = dxRenderer;
     try {
         renderer->init(window);
+        auto start = std::chrono::steady_clock::now();
         renderer->setup();
-        while (!glfwWindowShouldClose(window)) {
+        std::chrono::duration<double, std::milli> setupTime = std::chrono::steady_clock::now() - start;
+        std::cout << "setup took " << setupTime.count() << " ms, " << dxRenderer->fenceWaits() << " gpu waits"
+                  << std::endl;
+
+        // input moves this camera on the main thread, the renderer draws the newest snapshot of it. the instances
+        // keep the transforms of setup, every snapshot carries them
+        Camera camera = dxRenderer->camera();
+        const std::vector<glm::mat4> transforms = dxRenderer->instanceTransforms();
+        glfwSetWindowUserPointer(window, &camera);
+        FrameMailbox<FrameSnapshot> mailbox;
+        const auto runStart = std::chrono::steady_clock::now();
+        auto milliseconds = [&]() {
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - runStart).count();
+        };
+        uint64_t frames = 0;
+        auto drawFrame = [&]() {
+            if (mailbox.consume(milliseconds())) {
+                dxRenderer->applySnapshot(mailbox.front());
+            }
             renderer->draw();
-            processInput(window);
+            frames++;
+        };
+
+        // the render thread draws until the window closes or a frame throws, its error is rethrown here
+        std::atomic<bool> running{true};
+        std::exception_ptr renderError;
+        std::thread renderThread;
+        if (threaded) {
+            renderThread = std::thread([&]() {
+                try {
+                    while (running.load()) {
+                        drawFrame();
+                    }
+                } catch (...) {
+                    renderError = std::current_exception();
+                    running = false;
+                }
+            });
+        }
+
+        // processInput moves the camera by the time since the last tick, so it moves as fast with input ticking at a
+        // steady rate beside the render thread as once per frame without it
+        const std::chrono::microseconds inputPeriod(2000);
+        auto nextTick = std::chrono::steady_clock::now();
+        double lastInput = milliseconds(), maxInputGap = 0.0;
+        while (!glfwWindowShouldClose(window) && running.load()) {
             glfwPollEvents();
+            const double now = milliseconds();
+            processInput(window, static_cast<float>((now - lastInput) / 1000.0));
+            mailbox.back().camera = camera;
+            mailbox.back().transforms = transforms;
+            mailbox.publish(now);
+            maxInputGap = std::max(maxInputGap, now - lastInput);
+            lastInput = now;
+            if (threaded) {
+                nextTick = std::max(nextTick + inputPeriod, std::chrono::steady_clock::now());
+                std::this_thread::sleep_until(nextTick);
+            } else {
+                drawFrame();
+            }
+        }
+        running = false;
+        if (renderThread.joinable()) {
+            renderThread.join();
+        }
+        if (renderError) {
+            std::rethrow_exception(renderError);
         }
         renderer->exit();
+
+        const double elapsed = milliseconds();
+        const FrameMailbox<FrameSnapshot>::Stats mailboxStats = mailbox.stats();
+        std::cout << (threaded ? "render thread" : "one thread") << ": " << frames * 1000.0 / elapsed << " frames/s, "
+                  << mailboxStats.published * 1000.0 / elapsed << " inputs/s, max input gap " << maxInputGap
+                  << " ms, input to draw latency " << mailboxStats.latency << " ms (max " << mailboxStats.maxLatency
+                  << " ms), " << mailboxStats.dropped << " snapshots dropped" << std::endl;
+
+        const FrameTimeline::Stats stats = dxRenderer->timeline().stats();
+        std::cout << dxRenderer->timeline().framesInFlight() << " frames in flight, last " << stats.frames
+                  << " frames: cpu " << stats.cpuTime << " ms, wait " << stats.waitTime << " ms, gpu latency "
+                  << stats.gpuLatency << " ms, frame latency " << stats.frameLatency << " ms, interval "
+                  << stats.interval << " ms (p99 " << stats.intervalP99 << " ms), " << stats.stutters << " stutters"
+                  << std::endl;
+        std::cout << "most constants in a frame " << dxRenderer->constantsHighWater() / 1024 << " KB, "
+                  << dxRenderer->droppedInstances() << " instances dropped for lack of constants" << std::endl;
+        if (dxRenderer->droppedInstances() > 0) {
+            std::cerr << "frame constants ran out, raise FrameConstantsSize above the high water" << std::endl;
+        }
     } catch (Exception &e) {
         std::cerr << WStringToAnsi(e.ToString()) << std::endl;
     } catch (std::exception &e) {
@@ -52,22 +229,25 @@ void scroll_callback(GLFWwindow *window, double offsetX, double offsetY) {
     camera->processMouseScroll(offsetY);
 }
 
-void processInput(GLFWwindow *window) {
+// moves the camera at MoveSpeed units per second
+void processInput(GLFWwindow *window, float deltaTime) {
+    const float MoveSpeed = 50.0f;
     Camera *camera = reinterpret_cast<Camera *>(glfwGetWindowUserPointer(window));
+    const float step = MoveSpeed * deltaTime;
 
     if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS) {
         glfwSetWindowShouldClose(window, true);
     }
     if (glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS)
-        camera->position += camera->front * 0.1f;
+        camera->position += camera->front * step;
     if (glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS)
-        camera->position -= camera->front * 0.1f;
+        camera->position -= camera->front * step;
     if (glfwGetKey(window, GLFW_KEY_A) == GLFW_PRESS)
-        camera->position -= camera->right * 0.1f;
+        camera->position -= camera->right * step;
     if (glfwGetKey(window, GLFW_KEY_D) == GLFW_PRESS)
-        camera->position += camera->right * 0.1f;
+        camera->position += camera->right * step;
     if (glfwGetKey(window, GLFW_KEY_Q) == GLFW_PRESS)
-        camera->position -= camera->up * 0.1f;
+        camera->position -= camera->up * step;
     if (glfwGetKey(window, GLFW_KEY_E) == GLFW_PRESS)
-        camera->position += camera->up * 0.1f;
-}
\ No newline at end of file
+        camera->position += camera->up * step;
+}
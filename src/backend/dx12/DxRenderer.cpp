@@ -1,5 +1,8 @@
+#include <chrono>
 #include <stdexcept>
 #include <cassert>
+#include <algorithm>
+#include <string>
 #define GLFW_EXPOSE_NATIVE_WIN32
 #include <glfw3.h>
 #include <glfw3native.h>
@@ -8,12 +11,96 @@
 #include "DxRenderer.h"
 #include "CD3DX12.h"
 #include "src/common/Utils.h"
+#include "src/common/Sampling.h"
+#include "src/common/BrdfLut.h"
+#include "src/common/Parallel.h"
+
+namespace {
+    // per frame capacity of the clustered light buffers, larger scenes drop lights or list entries
+    const UINT MaxLights = 16384;
+    const UINT MaxLightIndices = 1 << 20;
+    // per frame constants, the transforms of the visible instances included. batches that don't fit are dropped
+    const UINT FrameConstantsSize = 4 << 20;
+
+    // compiled shaders and the pipeline library survive launches here
+    const char *ShaderCacheDirectory = "shader_cache";
+    const char *PipelineLibraryName = "pipelines.bin";
+
+    const float NearPlane = 1.0f;
+    const float FarPlane = 1000.0f;
+
+    // milliseconds of the frame timeline
+    double timelineNow() {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // pass and pipeline ids of the draw sort keys
+    enum DrawPass { SkyboxPass, OpaquePass };
+    enum DrawPipeline { SkyboxPipeline, PbrPipeline };
+
+    D3D12_RESOURCE_STATES graphState(uint32_t state) {
+        const D3D12_RESOURCE_STATES states[] = {
+            D3D12_RESOURCE_STATE_RENDER_TARGET, D3D12_RESOURCE_STATE_DEPTH_WRITE, D3D12_RESOURCE_STATE_DEPTH_READ,
+            D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, D3D12_RESOURCE_STATE_RESOLVE_SOURCE,
+            D3D12_RESOURCE_STATE_RESOLVE_DEST, D3D12_RESOURCE_STATE_COPY_SOURCE, D3D12_RESOURCE_STATE_COPY_DEST,
+            D3D12_RESOURCE_STATE_PRESENT
+        };
+        D3D12_RESOURCE_STATES result = D3D12_RESOURCE_STATE_COMMON;
+        for (UINT bit = 0; bit < _countof(states); bit++) {
+            if (state & (1u << bit)) {
+                result |= states[bit];
+            }
+        }
+        return result;
+    }
+
+    D3D12_RESOURCE_DESC graphTextureDesc(const RenderGraph::TextureDesc &texture) {
+        D3D12_RESOURCE_DESC desc = {};
+        desc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+        desc.Alignment = texture.samples > 1 ? D3D12_DEFAULT_MSAA_RESOURCE_PLACEMENT_ALIGNMENT : 0;
+        desc.Width = texture.width;
+        desc.Height = texture.height;
+        desc.DepthOrArraySize = 1;
+        desc.MipLevels = 1;
+        desc.SampleDesc.Count = texture.samples;
+        desc.Format = static_cast<DXGI_FORMAT>(texture.format);
+        desc.Flags = texture.depthStencil
+            ? D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL | D3D12_RESOURCE_FLAG_DENY_SHADER_RESOURCE
+            : D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET;
+        return desc;
+    }
+
+    // heap tier 1 keeps buffers, render targets and other textures in heaps of their own
+    HeapAllocator::Category heapCategory(const D3D12_RESOURCE_DESC &desc) {
+        if (desc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER) {
+            return HeapAllocator::Buffers;
+        }
+        if (desc.Flags & (D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL)) {
+            return HeapAllocator::RenderTargets;
+        }
+        return HeapAllocator::Textures;
+    }
+
+    // sizes the transients of the render graph
+    class GraphDevice : public RenderGraph::Device {
+    public:
+        explicit GraphDevice(ID3D12Device *device) : mDevice(device) {}
+
+        RenderGraph::Allocation allocation(const RenderGraph::TextureDesc &texture) const override {
+            const D3D12_RESOURCE_DESC desc = graphTextureDesc(texture);
+            const D3D12_RESOURCE_ALLOCATION_INFO info = mDevice->GetResourceAllocationInfo(0, 1, &desc);
+            return {info.SizeInBytes, info.Alignment};
+        }
+
+    private:
+        ID3D12Device *mDevice;
+    };
+}
 
 void DxRenderer::init(GLFWwindow* window) {
     int width, height;
     glfwGetWindowSize(window, &width, &height);
     mCamera = Camera(glm::vec3{-100.0, 20.0, 100.0}, -12.0, -50.0, (float)width / height, 45.0, 0.1);
-    glfwSetWindowUserPointer(window, &mCamera);
 
     // set viewport and scissor rect
     mScreenViewport = CD3DX12_VIEWPORT{0.0f, 0.0f, (FLOAT)width, (FLOAT)height};
@@ -50,6 +137,17 @@ void DxRenderer::init(GLFWwindow* window) {
     );
     ThrowIfFailed(mCommandList->Close());
 
+    // setup uploads record into their own list, it stays closed while no batch is open
+    mUploadAllocators.push_back({nullptr, 0});
+    ThrowIfFailed(mDevice->CreateCommandAllocator(
+        D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(mUploadAllocators[0].allocator.GetAddressOf()))
+    );
+    ThrowIfFailed(mDevice->CreateCommandList(
+        0, D3D12_COMMAND_LIST_TYPE_DIRECT, mUploadAllocators[0].allocator.Get(), nullptr,
+        IID_PPV_ARGS(&mUploadCommandList)
+    ));
+    ThrowIfFailed(mUploadCommandList->Close());
+
     // create commandQueue
     D3D12_COMMAND_QUEUE_DESC queueDesc = {};
     queueDesc.Type = D3D12_COMMAND_LIST_TYPE_DIRECT;
@@ -61,14 +159,18 @@ void DxRenderer::init(GLFWwindow* window) {
     swapChainDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
     swapChainDesc.SampleDesc.Count = 1;
     swapChainDesc.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT;
-    swapChainDesc.BufferCount = mNumFrames;
+    swapChainDesc.BufferCount = mNumBackBuffers;
     swapChainDesc.SwapEffect = DXGI_SWAP_EFFECT_FLIP_DISCARD;
+    swapChainDesc.Flags = DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
 
     ComPtr<IDXGISwapChain1> swapChain;
     ThrowIfFailed(mDxgiFactory->CreateSwapChainForHwnd(
         mCommandQueue.Get(), glfwGetWin32Window(window), &swapChainDesc, nullptr, nullptr, &swapChain
     ));
-    swapChain.As(&mSwapChain);
+    ThrowIfFailed(swapChain.As(&mSwapChain));
+    // draw() waits until fewer than mNumFrames presents are queued, the cpu never runs further ahead of the display
+    ThrowIfFailed(mSwapChain->SetMaximumFrameLatency(mNumFrames));
+    mFrameLatencyWaitable = mSwapChain->GetFrameLatencyWaitableObject();
 
     // check msaa level
     D3D12_FEATURE_DATA_MULTISAMPLE_QUALITY_LEVELS colorLevels = {DXGI_FORMAT_R16G16B16A16_FLOAT, mSamples};
@@ -96,30 +198,41 @@ void DxRenderer::init(GLFWwindow* window) {
     mRtvHeap = createDescriptorHeap({D3D12_DESCRIPTOR_HEAP_TYPE_RTV, 16, D3D12_DESCRIPTOR_HEAP_FLAG_NONE});
     mDsvHeap = createDescriptorHeap({D3D12_DESCRIPTOR_HEAP_TYPE_DSV, 16, D3D12_DESCRIPTOR_HEAP_FLAG_NONE});
     mCbvSrvUavHeap = createDescriptorHeap(
-        {D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 128, D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE}
+        {D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 1024, D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE}, 256
     );
+    mStagingHeap = createDescriptorHeap({D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 256, D3D12_DESCRIPTOR_HEAP_FLAG_NONE});
 
     // create RTV and DSV
-    for (int i = 0; i < mNumFrames; i++) {
+    for (UINT i = 0; i < mNumBackBuffers; i++) {
         mSwapChainBuffers[i] = createSwapChainBuffer(i);
+    }
+    for (UINT i = 0; i < mNumFrames; i++) {
         mDepthStencilBuffers[i] = createDepthStencilBuffer(width, height, 1, DXGI_FORMAT_D24_UNORM_S8_UINT);
 
-        mFrameBuffers[i] = createFrameBuffer(width, height, mSamples, DXGI_FORMAT_R16G16B16A16_FLOAT, DXGI_FORMAT_D24_UNORM_S8_UINT);
-
-        if(mSamples > 1) {
-			mResolveFrameBuffers[i] = createFrameBuffer(width, height, 1, DXGI_FORMAT_R16G16B16A16_FLOAT, (DXGI_FORMAT)0);
-		}
-        else {
-            mResolveFrameBuffers[i] = mFrameBuffers[i];
-		}
-
         mFrameResources[i] = FrameResource(mDevice.Get());
-        mFrameResources[i].transformCBs = createConstantBuffer<TransformCB>(1);
-        mFrameResources[i].shadingCBs = createConstantBuffer<ShadingCB>(1);
+        mFrameResources[i].constantBuffer = createUploadBuffer(FrameConstantsSize);
+        mFrameResources[i].constants = ConstantAllocator(FrameConstantsSize);
+        mFrameResources[i].lightBuffer = createUploadBuffer(sizeof(ClusterLight) * MaxLights);
+        mFrameResources[i].clusterRangeBuffer = createUploadBuffer(sizeof(glm::uvec2) * LightClusters::NumClusters);
+        mFrameResources[i].lightIndexBuffer = createUploadBuffer(sizeof(uint32_t) * MaxLightIndices);
     }
 
+    // frame buffers are transients of the render graph
+    createRenderGraph(width, height);
+
+    // staging memory of every texture and mesh upload
+    mUploadBuffer = createUploadBuffer(UploadRingSize);
+    mUploadRing.reset(UploadRingSize);
+
     // create Fence
     ThrowIfFailed(mDevice->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&mFence)));
+    mFenceEvent = CreateEventEx(nullptr, nullptr, 0, EVENT_ALL_ACCESS);
+    if (!mFenceEvent) {
+        throw std::runtime_error("Failed to create the fence event");
+    }
+
+    mShaderCache = ShaderCache(ShaderCacheDirectory);
+    createPipelineLibrary();
 }
 
 void DxRenderer::setup() {
@@ -131,25 +244,32 @@ void DxRenderer::setup() {
             {D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 1, 0, 0, D3D12_DESCRIPTOR_RANGE_FLAG_DATA_STATIC},
             {D3D12_DESCRIPTOR_RANGE_TYPE_UAV, 1, 0, 0, D3D12_DESCRIPTOR_RANGE_FLAG_DATA_STATIC_WHILE_SET_AT_EXECUTE},
         };
-        CD3DX12_ROOT_PARAMETER1 rootParameters[3];
+        CD3DX12_ROOT_PARAMETER1 rootParameters[4];
         rootParameters[0].InitAsDescriptorTable(1, &descriptorRanges[0]);
         rootParameters[1].InitAsDescriptorTable(1, &descriptorRanges[1]);
         rootParameters[2].InitAsConstants(1, 0);
+        rootParameters[3].InitAsShaderResourceView(1);
 
         CD3DX12_STATIC_SAMPLER_DESC samplerDesc{0, D3D12_FILTER_MIN_MAG_MIP_LINEAR};
 
         CD3DX12_VERSIONED_ROOT_SIGNATURE_DESC rootSignatureDesc;
-        rootSignatureDesc.Init_1_1(3, rootParameters, 1, &samplerDesc);
+        rootSignatureDesc.Init_1_1(4, rootParameters, 1, &samplerDesc);
         computeRootSignature = createRootSignature(rootSignatureDesc);
     }
 
     ID3D12DescriptorHeap *computeDescriptorHeaps[] = {mCbvSrvUavHeap.heap.Get()};
 
-    // convert equirectangular map to cube map
+    // the bakes record into the upload batch behind the texture copies and nothing waits for them in between, their
+    // pipelines are registered so they outlive the blocks that record them
+
+    // convert equirectangular map to cube map, the image stays for the probe volume bake
+    std::shared_ptr<Image> environment = Image::fromFile("assets/environment.hdr");
     Texture envTexture = createTexture(1024, 1024, 6, DXGI_FORMAT_R16G16B16A16_FLOAT);
     {
-        DescriptorHeapMark mark(mCbvSrvUavHeap);
-        Texture equirectTexture = createTexture(Image::fromFile("assets/environment.hdr"), DXGI_FORMAT_R32G32B32A32_FLOAT, 1);
+        Texture equirectTexture = createTexture(environment, DXGI_FORMAT_R32G32B32A32_FLOAT, 1);
+        // only read by the dispatch below, a transient view retires with the batch
+        freeTextureSRV(equirectTexture);
+        createTextureSRV(equirectTexture, D3D12_SRV_DIMENSION_TEXTURE2D, 0, 0, true);
         createTextureUAV(envTexture, 0);
 
         ComPtr<ID3DBlob> equirect2cubeShader = compileShader("src/backend/dx12/shaders/equirect2cube.hlsl", "main", "cs_5_0");
@@ -158,38 +278,35 @@ void DxRenderer::setup() {
         psoDesc.pRootSignature = computeRootSignature.Get();
         psoDesc.CS = CD3DX12_SHADER_BYTECODE(equirect2cubeShader.Get());
 
-        ComPtr<ID3D12PipelineState> pipelineState;
-        ThrowIfFailed(mDevice->CreateComputePipelineState(&psoDesc, IID_PPV_ARGS(&pipelineState)));
+        ComPtr<ID3D12PipelineState> pipelineState = createPipelineState("equirect2cube", psoDesc);
+        mPipelines.add("equirect2cube", {pipelineState, computeRootSignature});
 
-        mCommandList->Reset(mFrameResources[mFrameIndex].mCommandAllocator.Get(), nullptr);
+        ID3D12GraphicsCommandList *commandList = uploadCommandList();
 
         auto commom_to_unorderedAccess = CD3DX12_RESOURCE_BARRIER::Transition(
             envTexture.texture.Get(), D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_UNORDERED_ACCESS
         );
-        mCommandList->ResourceBarrier(1, &commom_to_unorderedAccess);
+        commandList->ResourceBarrier(1, &commom_to_unorderedAccess);
 
-        mCommandList->SetDescriptorHeaps(1, computeDescriptorHeaps);
-        mCommandList->SetPipelineState(pipelineState.Get());
-        mCommandList->SetComputeRootSignature(computeRootSignature.Get());
-        mCommandList->SetComputeRootDescriptorTable(0, equirectTexture.srv.gpuHandle);
-        mCommandList->SetComputeRootDescriptorTable(1, envTexture.uav.gpuHandle);
-        mCommandList->Dispatch(envTexture.width / 32, envTexture.height / 32, 6);
+        commandList->SetDescriptorHeaps(1, computeDescriptorHeaps);
+        commandList->SetPipelineState(pipelineState.Get());
+        commandList->SetComputeRootSignature(computeRootSignature.Get());
+        commandList->SetComputeRootDescriptorTable(0, equirectTexture.srv.gpuHandle);
+        commandList->SetComputeRootDescriptorTable(1, envTexture.uav.gpuHandle);
+        commandList->Dispatch(envTexture.width / 32, envTexture.height / 32, 6);
 
         auto unorderedAccess_to_common = CD3DX12_RESOURCE_BARRIER::Transition(
             envTexture.texture.Get(), D3D12_RESOURCE_STATE_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_COMMON
         );
-        mCommandList->ResourceBarrier(1, &unorderedAccess_to_common);
+        commandList->ResourceBarrier(1, &unorderedAccess_to_common);
 
-        executeCommandList();
-        waitForGPU();
+        keepUntilUploaded(equirectTexture.texture, equirectTexture.allocation);
     }
     generateMipmaps(envTexture);
-    mTextures["envTexture"] = envTexture;
 
     // compute diffuse irradiance map
     Texture irradianceTexture = createTexture(32, 32, 6, DXGI_FORMAT_R16G16B16A16_FLOAT, 1);
     {
-        DescriptorHeapMark mark(mCbvSrvUavHeap);
         createTextureUAV(irradianceTexture, 0);
 
         ComPtr<ID3DBlob> irradianceShader = compileShader("src/backend/dx12/shaders/irradiance.hlsl", "main", "cs_5_0");
@@ -198,44 +315,59 @@ void DxRenderer::setup() {
         psoDesc.pRootSignature = computeRootSignature.Get();
         psoDesc.CS = CD3DX12_SHADER_BYTECODE{irradianceShader.Get()};
 
-        ComPtr<ID3D12PipelineState> pipelineState;
-        ThrowIfFailed(mDevice->CreateComputePipelineState(&psoDesc, IID_PPV_ARGS(&pipelineState)));
+        ComPtr<ID3D12PipelineState> pipelineState = createPipelineState("irradiance", psoDesc);
+        mPipelines.add("irradiance", {pipelineState, computeRootSignature});
 
-        mCommandList->Reset(mFrameResources[mFrameIndex].mCommandAllocator.Get(), nullptr);
+        ID3D12GraphicsCommandList *commandList = uploadCommandList();
 
-        mCommandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
-            irradianceTexture.texture.Get(), D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_UNORDERED_ACCESS
-        ));
-        mCommandList->SetDescriptorHeaps(1, computeDescriptorHeaps);
-        mCommandList->SetPipelineState(pipelineState.Get());
-        mCommandList->SetComputeRootSignature(computeRootSignature.Get());
-        mCommandList->SetComputeRootDescriptorTable(0, envTexture.srv.gpuHandle);
-        mCommandList->SetComputeRootDescriptorTable(1, irradianceTexture.uav.gpuHandle);
-
-        mCommandList->Dispatch(irradianceTexture.width / 32, irradianceTexture.height / 32, 6);
+        // the bakes share one list, reads of the environment leave it in the common state for the next one
+        D3D12_RESOURCE_BARRIER preDispatchBarriers[] = {
+            CD3DX12_RESOURCE_BARRIER::Transition(
+                irradianceTexture.texture.Get(), D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_UNORDERED_ACCESS
+            ),
+            CD3DX12_RESOURCE_BARRIER::Transition(
+                envTexture.texture.Get(), D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE
+            ),
+        };
+        D3D12_RESOURCE_BARRIER postDispatchBarriers[] = {
+            CD3DX12_RESOURCE_BARRIER::Transition(
+                irradianceTexture.texture.Get(), D3D12_RESOURCE_STATE_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_COMMON
+            ),
+            CD3DX12_RESOURCE_BARRIER::Transition(
+                envTexture.texture.Get(), D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE, D3D12_RESOURCE_STATE_COMMON
+            ),
+        };
+        commandList->ResourceBarrier(2, preDispatchBarriers);
+        commandList->SetDescriptorHeaps(1, computeDescriptorHeaps);
+        commandList->SetPipelineState(pipelineState.Get());
+        commandList->SetComputeRootSignature(computeRootSignature.Get());
+        commandList->SetComputeRootDescriptorTable(0, envTexture.srv.gpuHandle);
+        commandList->SetComputeRootDescriptorTable(1, irradianceTexture.uav.gpuHandle);
 
-		mCommandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
-            irradianceTexture.texture.Get(), D3D12_RESOURCE_STATE_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_COMMON
-        ));
+        commandList->Dispatch(irradianceTexture.width / 32, irradianceTexture.height / 32, 6);
 
-		executeCommandList();
-		waitForGPU();
+        commandList->ResourceBarrier(2, postDispatchBarriers);
     }
-    mTextures["irradiance"] = irradianceTexture;
 
     // compute pre-filtered specular map
     Texture prefilterTexture = createTexture(1024, 1024, 6, DXGI_FORMAT_R16G16B16A16_FLOAT);
     {
-        DescriptorHeapMark mark(mCbvSrvUavHeap);
-
         ComPtr<ID3DBlob> prefilterShader = compileShader("src/backend/dx12/shaders/prefilter.hlsl", "main", "cs_5_0");
 
         D3D12_COMPUTE_PIPELINE_STATE_DESC psoDesc = {};
         psoDesc.pRootSignature = computeRootSignature.Get();
         psoDesc.CS = CD3DX12_SHADER_BYTECODE{prefilterShader.Get()};
 
-        ComPtr<ID3D12PipelineState> pipelineState;
-        ThrowIfFailed(mDevice->CreateComputePipelineState(&psoDesc, IID_PPV_ARGS(&pipelineState)));
+        ComPtr<ID3D12PipelineState> pipelineState = createPipelineState("prefilter", psoDesc);
+        mPipelines.add("prefilter", {pipelineState, computeRootSignature});
+
+        // GGX half vectors for every roughness level, computed once on the cpu instead of per texel. they sit in the
+        // upload ring until the batch completed
+        GGXSampleTable ggxSamples(prefilterTexture.levels);
+        const UINT64 ggxSampleOffset =
+            allocateUpload(ggxSamples.byteSize(), D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT);
+        ggxSamples.write(mUploadBuffer.cpuAddress + ggxSampleOffset);
+        const D3D12_GPU_VIRTUAL_ADDRESS ggxSampleAddress = mUploadBuffer.gpuAddress + ggxSampleOffset;
 
         D3D12_RESOURCE_BARRIER preCopyBarriers[] = {
 			CD3DX12_RESOURCE_BARRIER::Transition(prefilterTexture.texture.Get(), D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_COPY_DEST),
@@ -243,26 +375,30 @@ void DxRenderer::setup() {
 		};
 		D3D12_RESOURCE_BARRIER postCopyBarriers[] = {
 			CD3DX12_RESOURCE_BARRIER::Transition(prefilterTexture.texture.Get(), D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_UNORDERED_ACCESS),
-			CD3DX12_RESOURCE_BARRIER::Transition(envTexture.texture.Get(), D3D12_RESOURCE_STATE_COPY_SOURCE, D3D12_RESOURCE_STATE_COMMON)
+			CD3DX12_RESOURCE_BARRIER::Transition(envTexture.texture.Get(), D3D12_RESOURCE_STATE_COPY_SOURCE, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE)
+		};
+		D3D12_RESOURCE_BARRIER postDispatchBarriers[] = {
+			CD3DX12_RESOURCE_BARRIER::Transition(prefilterTexture.texture.Get(), D3D12_RESOURCE_STATE_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_COMMON),
+			CD3DX12_RESOURCE_BARRIER::Transition(envTexture.texture.Get(), D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE, D3D12_RESOURCE_STATE_COMMON)
 		};
 
-        mCommandList->Reset(mFrameResources[mFrameIndex].mCommandAllocator.Get(), nullptr);
+        ID3D12GraphicsCommandList *commandList = uploadCommandList();
 
-		mCommandList->ResourceBarrier(2, preCopyBarriers);
+		commandList->ResourceBarrier(2, preCopyBarriers);
 		for(UINT arraySlice = 0; arraySlice < 6; ++arraySlice) {
 			UINT subresourceIndex = D3D12CalcSubresource(0, arraySlice, 0, prefilterTexture.levels, 6);
 
             CD3DX12_TEXTURE_COPY_LOCATION srcCopyLocation = {prefilterTexture.texture.Get(), subresourceIndex};
             CD3DX12_TEXTURE_COPY_LOCATION destCopyLocation = {envTexture.texture.Get(), subresourceIndex};
 
-			mCommandList->CopyTextureRegion(&srcCopyLocation, 0, 0, 0, &destCopyLocation, nullptr);
+			commandList->CopyTextureRegion(&srcCopyLocation, 0, 0, 0, &destCopyLocation, nullptr);
 		}
-		mCommandList->ResourceBarrier(2, postCopyBarriers);
+		commandList->ResourceBarrier(2, postCopyBarriers);
 
-        mCommandList->SetDescriptorHeaps(1, computeDescriptorHeaps);
-		mCommandList->SetPipelineState(pipelineState.Get());
-        mCommandList->SetComputeRootSignature(computeRootSignature.Get());
-		mCommandList->SetComputeRootDescriptorTable(0, envTexture.srv.gpuHandle);
+        commandList->SetDescriptorHeaps(1, computeDescriptorHeaps);
+		commandList->SetPipelineState(pipelineState.Get());
+        commandList->SetComputeRootSignature(computeRootSignature.Get());
+		commandList->SetComputeRootDescriptorTable(0, envTexture.srv.gpuHandle);
 
 		float deltaRoughness = 1.0f / std::max(float(prefilterTexture.levels - 1), 1.0f);
 
@@ -271,50 +407,49 @@ void DxRenderer::setup() {
 			float roughness = level * deltaRoughness;
 			createTextureUAV(prefilterTexture, level);
 
-			mCommandList->SetComputeRootDescriptorTable(1, prefilterTexture.uav.gpuHandle);
-			mCommandList->SetComputeRoot32BitConstants(2, 1, &roughness, 0);
-			mCommandList->Dispatch(numGroups, numGroups, 6);
+			commandList->SetComputeRootDescriptorTable(1, prefilterTexture.uav.gpuHandle);
+			commandList->SetComputeRoot32BitConstants(2, 1, &roughness, 0);
+			commandList->SetComputeRootShaderResourceView(3, ggxSampleAddress + ggxSamples.levelOffset(level));
+			commandList->Dispatch(numGroups, numGroups, 6);
 		}
-		mCommandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
-            prefilterTexture.texture.Get(), D3D12_RESOURCE_STATE_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_COMMON
-        ));
-		executeCommandList();
-		waitForGPU();
+		commandList->ResourceBarrier(2, postDispatchBarriers);
     }
-    mTextures["prefilter"] = prefilterTexture;
 
-    // compute Cook-Torrance BRDF LUT
-    Texture brdfTexture = createTexture(256, 256, 1, DXGI_FORMAT_R16G16_FLOAT, 1);
-    {
-        DescriptorHeapMark mark(mCbvSrvUavHeap);
-        createTextureUAV(brdfTexture, 0);
-
-        ComPtr<ID3DBlob> spBRDFShader = compileShader("src/backend/dx12/shaders/brdf.hlsl", "main", "cs_5_0");
-
-        D3D12_COMPUTE_PIPELINE_STATE_DESC psoDesc = {};
-        psoDesc.pRootSignature = computeRootSignature.Get();
-        psoDesc.CS = CD3DX12_SHADER_BYTECODE{spBRDFShader.Get()};
-        
-        ComPtr<ID3D12PipelineState> pipelineState;
-        ThrowIfFailed(mDevice->CreateComputePipelineState(&psoDesc, IID_PPV_ARGS(&pipelineState)));
-
-        mCommandList->Reset(mFrameResources[mFrameIndex].mCommandAllocator.Get(), nullptr);
-
-        mCommandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
-            brdfTexture.texture.Get(), D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_UNORDERED_ACCESS)
-        );
-        mCommandList->SetDescriptorHeaps(1, computeDescriptorHeaps);
-        mCommandList->SetPipelineState(pipelineState.Get());
-        mCommandList->SetComputeRootSignature(computeRootSignature.Get());
-        mCommandList->SetComputeRootDescriptorTable(1, brdfTexture.uav.gpuHandle);
-        mCommandList->Dispatch(brdfTexture.width / 32, brdfTexture.height / 32, 1);
-        mCommandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
-            brdfTexture.texture.Get(), D3D12_RESOURCE_STATE_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_COMMON)
-        );
-        executeCommandList();
-        waitForGPU();
+    // the octahedral variant binds 2D copies of the maps, the cubes are released once the batch completed. the
+    // skybox only samples level 0 of the environment. the probe volume variant takes the diffuse light of the pbr
+    // pass from the probes instead of the irradiance map
+    const UINT prefilterLevels = prefilterTexture.levels;
+    std::vector<Texture> cubeTextures;
+    std::vector<std::pair<std::string, std::string>> envDefines;
+    if (mOctahedralEnv) {
+        envDefines.push_back({"OCTAHEDRAL_ENV", "1"});
+        cubeTextures = {envTexture, irradianceTexture, prefilterTexture};
+        envTexture = createOctahedralTexture(envTexture, 1);
+        irradianceTexture = createOctahedralTexture(irradianceTexture, 1);
+        prefilterTexture = createOctahedralTexture(prefilterTexture, prefilterTexture.levels);
+    }
+    // the pbr pass also switches its diffuse light and BRDF term. it picks prefilter levels by the cube's level
+    // count, the octahedral chain stops before the cube's 1x1 level
+    std::vector<std::pair<std::string, std::string>> pbrDefines = envDefines;
+    pbrDefines.push_back({"PREFILTER_LEVELS", std::to_string(prefilterLevels)});
+    if (mUseProbeVolume) {
+        pbrDefines.push_back({"PROBE_VOLUME", "1"});
+    }
+    if (mBrdfApprox) {
+        pbrDefines.push_back({"BRDF_APPROX", "1"});
+    }
+    mTextures.add("envTexture", envTexture);
+    mTextures.add("irradiance", irradianceTexture);
+    mTextures.add("prefilter", prefilterTexture);
+
+    // upload the Cook-Torrance BRDF LUT baked into the binary, see BrdfLutData.h. BRDF_APPROX never reads it
+    if (!mBrdfApprox) {
+        std::vector<uint16_t> brdfLut = BrdfLut::embeddedHalf();
+        UINT brdfPitch = BrdfLutDataSize * 2 * static_cast<UINT>(sizeof(uint16_t));
+        mTextures.add("brdf", createTexture(
+            brdfLut.data(), brdfPitch, BrdfLutDataSize, BrdfLutDataSize, DXGI_FORMAT_R16G16_FLOAT, 1
+        ));
     }
-    mTextures["brdf"] = brdfTexture;
 
     // ----------------------------------------- setup pipeline state -------------------------------------------
     // create skybox pipeline state
@@ -325,16 +460,20 @@ void DxRenderer::setup() {
             {"POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0,  D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0}
         };
 
-        ComPtr<ID3DBlob> skyboxVS = compileShader("src/backend/dx12/shaders/skybox.hlsl", "main_vs", "vs_5_0");
-        ComPtr<ID3DBlob> skyboxPS = compileShader("src/backend/dx12/shaders/skybox.hlsl", "main_ps", "ps_5_0");
+        ComPtr<ID3DBlob> skyboxVS =
+            compileShader("src/backend/dx12/shaders/skybox.hlsl", "main_vs", "vs_5_0", envDefines);
+        ComPtr<ID3DBlob> skyboxPS =
+            compileShader("src/backend/dx12/shaders/skybox.hlsl", "main_ps", "ps_5_0", envDefines);
 
         CD3DX12_DESCRIPTOR_RANGE1 descriptorRanges[] = {
-            {D3D12_DESCRIPTOR_RANGE_TYPE_CBV, 1, 0, 0, D3D12_DESCRIPTOR_RANGE_FLAG_DATA_STATIC},
             {D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 1, 0, 0, D3D12_DESCRIPTOR_RANGE_FLAG_DATA_STATIC}
         };
+        // transforms in b0, bound as a root cbv into the frame's constants
         CD3DX12_ROOT_PARAMETER1 rootParameters[2];
-        rootParameters[0].InitAsDescriptorTable(1, &descriptorRanges[0], D3D12_SHADER_VISIBILITY_VERTEX);
-        rootParameters[1].InitAsDescriptorTable(1, &descriptorRanges[1], D3D12_SHADER_VISIBILITY_PIXEL);
+        rootParameters[0].InitAsConstantBufferView(
+            0, 0, D3D12_ROOT_DESCRIPTOR_FLAG_NONE, D3D12_SHADER_VISIBILITY_VERTEX
+        );
+        rootParameters[1].InitAsDescriptorTable(1, &descriptorRanges[0], D3D12_SHADER_VISIBILITY_PIXEL);
 
         CD3DX12_STATIC_SAMPLER_DESC samplerDesc{0, D3D12_FILTER_ANISOTROPIC};
         samplerDesc.ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
@@ -358,10 +497,9 @@ void DxRenderer::setup() {
         psoDesc.RTVFormats[0] = DXGI_FORMAT_R16G16B16A16_FLOAT;
         psoDesc.SampleDesc.Count = mSamples;
         psoDesc.SampleMask = UINT_MAX;
-        ThrowIfFailed(mDevice->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&skyboxPipelineState)));
+        skyboxPipelineState = createPipelineState("skybox", psoDesc);
     }
-    mRootSignatures["skybox"] = skyboxRootSignature;
-    mPipelineStates["skybox"] = skyboxPipelineState;
+    mPipelines.add("skybox", {skyboxPipelineState, skyboxRootSignature});
 
     // create tonemap pipeline state
     ComPtr<ID3D12RootSignature> tonemapRootSignature;
@@ -399,10 +537,9 @@ void DxRenderer::setup() {
 		psoDesc.SampleDesc.Count = 1;
 		psoDesc.SampleMask = UINT_MAX;
 
-		ThrowIfFailed(mDevice->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&tonemapPipelineState)));
+		tonemapPipelineState = createPipelineState("tonemap", psoDesc);
 	}
-    mRootSignatures["tonemap"] = tonemapRootSignature;
-    mPipelineStates["tonemap"] = tonemapPipelineState;
+    mPipelines.add("tonemap", {tonemapPipelineState, tonemapRootSignature});
 
     // create pbr pipeline state
     ComPtr<ID3D12RootSignature> pbrRootSignature;
@@ -416,17 +553,31 @@ void DxRenderer::setup() {
 			{ "TEXCOORD",  0, DXGI_FORMAT_R32G32_FLOAT,    0, 48, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
 		};
 
-		ComPtr<ID3DBlob> pbrVS = compileShader("src/backend/dx12/shaders/pbr.hlsl", "main_vs", "vs_5_0");
-		ComPtr<ID3DBlob> pbrPS = compileShader("src/backend/dx12/shaders/pbr.hlsl", "main_ps", "ps_5_0");
+		ComPtr<ID3DBlob> pbrVS = compileShader("src/backend/dx12/shaders/pbr.hlsl", "main_vs", "vs_5_0", pbrDefines);
+		ComPtr<ID3DBlob> pbrPS = compileShader("src/backend/dx12/shaders/pbr.hlsl", "main_ps", "ps_5_0", pbrDefines);
 
 		const CD3DX12_DESCRIPTOR_RANGE1 descriptorRanges[] = {
-			{D3D12_DESCRIPTOR_RANGE_TYPE_CBV, 1, 0, 0, D3D12_DESCRIPTOR_RANGE_FLAG_DATA_STATIC},
 			{D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 7, 0, 0, D3D12_DESCRIPTOR_RANGE_FLAG_DATA_STATIC},
 		};
-		CD3DX12_ROOT_PARAMETER1 rootParameters[3];
-		rootParameters[0].InitAsDescriptorTable(1, &descriptorRanges[0], D3D12_SHADER_VISIBILITY_VERTEX);
-		rootParameters[1].InitAsDescriptorTable(1, &descriptorRanges[0], D3D12_SHADER_VISIBILITY_PIXEL);
-		rootParameters[2].InitAsDescriptorTable(1, &descriptorRanges[1], D3D12_SHADER_VISIBILITY_PIXEL);
+		// transform and shading constants in b0 of either stage, root cbvs into the frame's constants
+		CD3DX12_ROOT_PARAMETER1 rootParameters[8];
+		rootParameters[0].InitAsConstantBufferView(0, 0, D3D12_ROOT_DESCRIPTOR_FLAG_NONE, D3D12_SHADER_VISIBILITY_VERTEX);
+		rootParameters[1].InitAsConstantBufferView(0, 0, D3D12_ROOT_DESCRIPTOR_FLAG_NONE, D3D12_SHADER_VISIBILITY_PIXEL);
+		rootParameters[2].InitAsDescriptorTable(1, &descriptorRanges[0], D3D12_SHADER_VISIBILITY_PIXEL);
+        // lights, cluster ranges and light indices in t7-t9
+        for (UINT i = 0; i < 3; i++) {
+            rootParameters[3 + i].InitAsShaderResourceView(
+                7 + i, 0, D3D12_ROOT_DESCRIPTOR_FLAG_NONE, D3D12_SHADER_VISIBILITY_PIXEL
+            );
+        }
+        // instance transforms in t10, bound at the first instance of each draw
+        rootParameters[6].InitAsShaderResourceView(
+            10, 0, D3D12_ROOT_DESCRIPTOR_FLAG_NONE, D3D12_SHADER_VISIBILITY_VERTEX
+        );
+        // sh planes of the probe volume in t11, blended per instance in the vertex shader
+        rootParameters[7].InitAsShaderResourceView(
+            11, 0, D3D12_ROOT_DESCRIPTOR_FLAG_DATA_STATIC, D3D12_SHADER_VISIBILITY_VERTEX
+        );
         
         CD3DX12_STATIC_SAMPLER_DESC defaultSamplerDesc{0, D3D12_FILTER_ANISOTROPIC};
         defaultSamplerDesc.ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
@@ -440,7 +591,7 @@ void DxRenderer::setup() {
 
 		CD3DX12_VERSIONED_ROOT_SIGNATURE_DESC signatureDesc;
 		signatureDesc.Init_1_1(
-            3, rootParameters, 2, staticSamplers, D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT
+            8, rootParameters, 2, staticSamplers, D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT
         );
 		pbrRootSignature = createRootSignature(signatureDesc);
 
@@ -460,147 +611,543 @@ void DxRenderer::setup() {
 		psoDesc.SampleDesc.Count = mSamples;
 		psoDesc.SampleMask = UINT_MAX;
 
-		ThrowIfFailed(mDevice->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&pbrPipelineState)));
+		pbrPipelineState = createPipelineState("pbr", psoDesc);
 	}
-    mRootSignatures["pbr"] = pbrRootSignature;
-    mPipelineStates["pbr"] = pbrPipelineState;
+    mPipelines.add("pbr", {pbrPipelineState, pbrRootSignature});
 
     // create pbr texture
-    mTextures["albedo"] = createTexture(Image::fromFile("assets/textures/cerberus_A.png"), DXGI_FORMAT_R8G8B8A8_UNORM_SRGB);
-	mTextures["normal"] = createTexture(Image::fromFile("assets/textures/cerberus_N.png"), DXGI_FORMAT_R8G8B8A8_UNORM);
-	mTextures["metalness"] = createTexture(Image::fromFile("assets/textures/cerberus_M.png", 1), DXGI_FORMAT_R8_UNORM);
-	mTextures["roughness"] = createTexture(Image::fromFile("assets/textures/cerberus_R.png", 1), DXGI_FORMAT_R8_UNORM);
+    mTextures.add("albedo", createTexture(
+        Image::fromFile("assets/textures/cerberus_A.png"), DXGI_FORMAT_R8G8B8A8_UNORM_SRGB
+    ));
+    mTextures.add("normal", createTexture(
+        Image::fromFile("assets/textures/cerberus_N.png"), DXGI_FORMAT_R8G8B8A8_UNORM
+    ));
+    mTextures.add("metalness", createTexture(
+        Image::fromFile("assets/textures/cerberus_M.png", 1), DXGI_FORMAT_R8_UNORM
+    ));
+    mTextures.add("roughness", createTexture(
+        Image::fromFile("assets/textures/cerberus_R.png", 1), DXGI_FORMAT_R8_UNORM
+    ));
 
     // create mesh
-    mMeshBuffers["model"]  = createMeshBuffer(Mesh::fromFile("assets/meshes/cerberus.fbx"));
-    mMeshBuffers["skybox"] = createMeshBuffer(Mesh::fromFile("assets/meshes/skybox.obj"));
+    mSkyboxMesh = mMeshBuffers.add("skybox", createMeshBuffer(Mesh::fromFile("assets/meshes/skybox.obj")));
+    std::shared_ptr<Mesh> modelMesh = Mesh::fromFile("assets/meshes/cerberus.fbx");
+    const uint32_t model = addMesh("model", modelMesh);
+
+    // names resolve once here, draw() only uses the handles
+    mSkyboxPipeline = mPipelines.find("skybox");
+    mPbrPipeline = mPipelines.find("pbr");
+    mTonemapPipeline = mPipelines.find("tonemap");
+    mEnvTexture = mTextures.find("envTexture");
+
+    // the t0-t6 table of the pbr pass, copied together from the staged srvs. without the LUT a null view fills t2
+    Descriptor nullBrdfView;
+    if (mBrdfApprox) {
+        D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+        srvDesc.Format = DXGI_FORMAT_R16G16_FLOAT;
+        srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+        srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+        srvDesc.Texture2D.MipLevels = 1;
+        nullBrdfView = mStagingHeap.alloc();
+        mDevice->CreateShaderResourceView(nullptr, &srvDesc, nullBrdfView.cpuHandle);
+    }
+    std::vector<Descriptor> pbrViews;
+    for (const char *name : {"irradiance", "prefilter", "brdf", "albedo", "normal", "metalness", "roughness"}) {
+        const bool nullView = mBrdfApprox && std::string(name) == "brdf";
+        pbrViews.push_back(nullView ? nullBrdfView : mTextures[mTextures.find(name)].stagingSrv);
+    }
+    mMaterials.push_back(createDescriptorTable(pbrViews).gpuHandle);
+    if (mBrdfApprox) {
+        mStagingHeap.free(nullBrdfView);
+    }
+    addInstance(model, 0, glm::mat4(1.0f));
+    if (mUseProbeVolume) {
+        bakeProbeVolume(CubeMap::fromEquirect(*environment, 64), {modelMesh});
+    }
+
+    // the old directional looking light, far enough away that the falloff barely changes over the model
+    mLights.push_back(ClusterLight::point(glm::normalize(glm::vec3(5.0f)) * 500.0f, glm::vec3(250000.0f), 2000.0f));
+
+    // pipelines created for the first time are in the library from the next launch on
+    savePipelineLibrary();
+
+    // the one wait of setup, the bake sources and the staging memory are released before the first frame
+    flushUploads();
+    waitForFence(mUploadFence);
+    for (Texture &texture : cubeTextures) {
+        freeTextureSRV(texture);
+        freePlacedResource(texture.texture, texture.allocation);
+    }
 }
 
-void DxRenderer::updateFrameResources() {
-    FrameResource frameResource = mFrameResources[mFrameIndex];
+uint32_t DxRenderer::addMesh(const std::string &name, std::shared_ptr<Mesh> mesh) {
+    const MeshHandle handle = mMeshBuffers.add(name, createMeshBuffer(mesh));
+
+    // meshes are their own occluders
+    std::vector<glm::vec3> positions;
+    OcclusionCuller::Instance bounds;
+    bounds.boundsMin = glm::vec3(INFINITY);
+    bounds.boundsMax = glm::vec3(-INFINITY);
+    for (const Mesh::Vertex &vertex : mesh->vertices()) {
+        positions.push_back(vertex.position);
+        bounds.boundsMin = glm::min(bounds.boundsMin, vertex.position);
+        bounds.boundsMax = glm::max(bounds.boundsMax, vertex.position);
+    }
+    bounds.occluder = mOcclusionCuller.addOccluder(
+        positions.data(), positions.size(), &mesh->faces()[0].v1, mesh->faces().size() * 3
+    );
+
+    mMeshes.push_back(handle);
+    mMeshBounds.push_back(bounds);
+    return static_cast<uint32_t>(mMeshes.size() - 1);
+}
+
+void DxRenderer::addInstance(uint32_t mesh, uint32_t material, const glm::mat4 &world) {
+    OcclusionCuller::Instance instance = mMeshBounds[mesh];
+    instance.world = world;
+    mInstances.push_back(instance);
+    mInstanceMeshes.push_back(mesh);
+    mInstanceMaterials.push_back(material);
+}
+
+void DxRenderer::bakeProbeVolume(const CubeMap &env, const std::vector<std::shared_ptr<Mesh>> &meshes) {
+    // the world bounds of all instances with a margin, so the outer probes are not inside the outer surfaces
+    glm::vec3 boundsMin{INFINITY}, boundsMax{-INFINITY};
+    for (const OcclusionCuller::Instance &instance : mInstances) {
+        for (uint32_t corner = 0; corner < 8; corner++) {
+            const glm::vec3 local{
+                corner & 1 ? instance.boundsMax.x : instance.boundsMin.x,
+                corner & 2 ? instance.boundsMax.y : instance.boundsMin.y,
+                corner & 4 ? instance.boundsMax.z : instance.boundsMin.z
+            };
+            const glm::vec3 position = instance.world * glm::vec4(local, 1.0f);
+            boundsMin = glm::min(boundsMin, position);
+            boundsMax = glm::max(boundsMax, position);
+        }
+    }
+    const glm::vec3 margin = 0.1f * (boundsMax - boundsMin) + 1e-3f;
+    mProbeVolume = ProbeVolume(boundsMin - margin, boundsMax + margin, glm::uvec3(8));
+    for (size_t i = 0; i < mInstances.size(); i++) {
+        const std::shared_ptr<Mesh> &mesh = meshes[mInstanceMeshes[i]];
+        std::vector<glm::vec3> positions;
+        for (const Mesh::Vertex &vertex : mesh->vertices()) {
+            positions.push_back(vertex.position);
+        }
+        mProbeVolume.addOccluder(
+            positions.data(), &mesh->faces()[0].v1, mesh->faces().size() * 3, mInstances[i].world
+        );
+    }
+    mProbeVolume.bake(env);
+
+    // the planes go up as they are, probe i of plane k at k * numProbes() + i
+    const UINT64 byteSize = mProbeVolume.byteSize();
+    mProbePlanes = createPlacedResource(
+        CD3DX12_RESOURCE_DESC::Buffer(byteSize), D3D12_RESOURCE_STATE_COPY_DEST, nullptr, mProbePlanesAllocation
+    );
+    D3D12_SUBRESOURCE_DATA planeData = {mProbeVolume.data()};
+    StagingBuffer stagingBuffer = createStagingBuffer(mProbePlanes, 0, 1, &planeData);
+    uploadCommandList()->CopyBufferRegion(
+        mProbePlanes.Get(), 0, stagingBuffer.buffer.Get(), stagingBuffer.layouts[0].Offset, byteSize
+    );
+    auto copyDest_to_shaderResource = CD3DX12_RESOURCE_BARRIER::Transition(
+        mProbePlanes.Get(), D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE
+    );
+    uploadCommandList()->ResourceBarrier(1, &copyDest_to_shaderResource);
+}
+
+void DxRenderer::queueInstances(FrameResource &frameResource) {
+    // group the visible instances, one instanced draw per mesh and material
+    mInstanceBatcher.build(
+        mInstanceMeshes.data(), mInstanceMaterials.data(), mInstanceVisible.data(),
+        static_cast<uint32_t>(mInstances.size())
+    );
+    const std::vector<uint32_t> &order = mInstanceBatcher.instances();
+    const std::vector<InstanceBatcher::Batch> &batches = mInstanceBatcher.batches();
+
+    // every batch allocates its transforms from the frame's constants, the batches are filled in parallel
+    std::vector<D3D12_GPU_VIRTUAL_ADDRESS> instances(batches.size(), 0);
+    std::vector<float> depths(batches.size(), 1.0f);
+    parallelFor(0, static_cast<uint32_t>(batches.size()), [&](uint32_t index) {
+        const InstanceBatcher::Batch &batch = batches[index];
+        InstanceData *instanceData =
+            frameResource.allocateConstants<InstanceData>(batch.numInstances, instances[index]);
+        if (!instanceData) {
+            return;
+        }
+        // batches sort by their nearest instance
+        for (UINT i = 0; i < batch.numInstances; i++) {
+            const OcclusionCuller::Instance &instance = mInstances[order[batch.firstInstance + i]];
+            glm::vec3 center = instance.world * glm::vec4(0.5f * (instance.boundsMin + instance.boundsMax), 1.0f);
+            InstanceData &data = instanceData[i];
+            data = {instance.world, glm::transpose(glm::inverse(instance.world)), {}, {}};
+            // the 8 probes around the center, the vertex shader blends their planes
+            if (mProbePlanes) {
+                const ProbeVolume::Lookup probes = mProbeVolume.lookup(center);
+                for (uint32_t corner = 0; corner < 8; corner++) {
+                    data.probeIndices[corner / 4][corner % 4] = probes.indices[corner];
+                    data.probeWeights[corner / 4][corner % 4] = probes.weights[corner];
+                }
+            }
+            depths[index] = std::min(depths[index], glm::dot(center - mCamera.position, mCamera.front) / FarPlane);
+        }
+    });
+
+    DrawPacket packet;
+    const Pipeline &pbr = mPipelines[mPbrPipeline];
+    packet.pipeline = pbr.state.Get();
+    packet.rootSignature = pbr.rootSignature.Get();
+    packet.materialParameter = 2;
+    for (uint32_t index = 0; index < batches.size(); index++) {
+        const InstanceBatcher::Batch &batch = batches[index];
+        if (instances[index] == 0) {
+            // the frame's constants ran out, the constants allocator counts the failure as well
+            mDroppedInstances += batch.numInstances;
+            continue;
+        }
+        const float depth = depths[index];
+        packet.numInstances = batch.numInstances;
+        packet.material = mMaterials[batch.material];
+        packet.mesh = &mMeshBuffers[mMeshes[batch.mesh]];
+        packet.instances = instances[index];
+        mDrawQueue.push(
+            DrawQueue::opaqueKey(OpaquePass, PbrPipeline, batch.material, batch.mesh, depth),
+            static_cast<uint32_t>(mDrawPackets.size())
+        );
+        mDrawPackets.push_back(packet);
+    }
+}
 
-    if (frameResource.Fence != 0 && mFence->GetCompletedValue() < frameResource.Fence) {
-        HANDLE eventHandle = CreateEventEx(nullptr, nullptr, false, EVENT_ALL_ACCESS);
-        ThrowIfFailed(mFence->SetEventOnCompletion(frameResource.Fence, eventHandle));
-        WaitForSingleObject(eventHandle, INFINITE);
-        CloseHandle(eventHandle);
+uint64_t DxRenderer::constantsHighWater() const {
+    uint64_t highWater = 0;
+    for (const FrameResource &frameResource : mFrameResources) {
+        highWater = std::max(highWater, frameResource.constants.highWater());
     }
+    return highWater;
+}
 
-    glm::mat4 proj = glm::perspective(glm::radians(mCamera.fov), mCamera.aspect, 1.0f, 1000.0f);
+void DxRenderer::submitDraws(const FrameResource &frameResource) {
+    mDrawQueue.sort();
+
+    // state of the previous packet, only what changes gets recorded
+    ID3D12PipelineState *pipeline = nullptr;
+    ID3D12RootSignature *rootSignature = nullptr;
+    D3D12_GPU_DESCRIPTOR_HANDLE material{0};
+    const MeshBuffer *mesh = nullptr;
+    for (uint32_t index : mDrawQueue.packets()) {
+        const DrawPacket &packet = mDrawPackets[index];
+        if (packet.pipeline != pipeline) {
+            mCommandList->SetPipelineState(packet.pipeline);
+            pipeline = packet.pipeline;
+        }
+        if (packet.rootSignature != rootSignature) {
+            // a new root signature starts without bindings
+            mCommandList->SetGraphicsRootSignature(packet.rootSignature);
+            rootSignature = packet.rootSignature;
+            material.ptr = 0;
+
+            mCommandList->SetGraphicsRootConstantBufferView(0, frameResource.transformCB);
+            if (rootSignature == mPipelines[mPbrPipeline].rootSignature.Get()) {
+                mCommandList->SetGraphicsRootConstantBufferView(1, frameResource.shadingCB);
+                mCommandList->SetGraphicsRootShaderResourceView(3, frameResource.lightBuffer.gpuAddress);
+                mCommandList->SetGraphicsRootShaderResourceView(4, frameResource.clusterRangeBuffer.gpuAddress);
+                mCommandList->SetGraphicsRootShaderResourceView(5, frameResource.lightIndexBuffer.gpuAddress);
+                if (mProbePlanes) {
+                    mCommandList->SetGraphicsRootShaderResourceView(7, mProbePlanes->GetGPUVirtualAddress());
+                }
+            }
+        }
+        if (packet.material.ptr != material.ptr) {
+            mCommandList->SetGraphicsRootDescriptorTable(packet.materialParameter, packet.material);
+            material = packet.material;
+        }
+        if (packet.mesh != mesh) {
+            mCommandList->IASetVertexBuffers(0, 1, &packet.mesh->vbv);
+            mCommandList->IASetIndexBuffer(&packet.mesh->ibv);
+            mesh = packet.mesh;
+        }
+        if (packet.instances != 0) {
+            mCommandList->SetGraphicsRootShaderResourceView(6, packet.instances);
+        }
+        mCommandList->DrawIndexedInstanced(packet.mesh->numIndices, packet.numInstances, 0, 0, 0);
+    }
+}
+
+void DxRenderer::createRenderGraph(UINT width, UINT height) {
+    mRenderGraph.clear();
+    const bool multisampled = mSamples > 1;
+    const uint32_t color = mRenderGraph.createTexture(
+        "color", {width, height, mSamples, DXGI_FORMAT_R16G16B16A16_FLOAT, false}
+    );
+    const uint32_t depth = mRenderGraph.createTexture(
+        "depth", {width, height, mSamples, DXGI_FORMAT_D24_UNORM_S8_UINT, true}
+    );
+    const uint32_t resolve = multisampled
+        ? mRenderGraph.createTexture("resolve", {width, height, 1, DXGI_FORMAT_R16G16B16A16_FLOAT, false})
+        : color;
+    const uint32_t backBuffer = mRenderGraph.importTexture("backBuffer", RenderGraph::Present, RenderGraph::Present);
+    mGraphBackBuffer = backBuffer;
+
+    // skybox and pbr passes, recorded in sort key order
+    const uint32_t scene = mRenderGraph.addPass("scene", [this]() {
+        FrameBuffer &frameBuffer = mFrameBuffers[mFrameIndex];
+
+        // clear render target and depth/stencil buffer
+        mCommandList->ClearRenderTargetView(frameBuffer.rtv.cpuHandle, DirectX::Colors::LightBlue, 0, nullptr);
+        mCommandList->ClearDepthStencilView(
+            frameBuffer.dsv.cpuHandle, D3D12_CLEAR_FLAG_DEPTH | D3D12_CLEAR_FLAG_STENCIL, 1.0f, 0, 0, nullptr
+        );
+
+        mCommandList->OMSetRenderTargets(1, &frameBuffer.rtv.cpuHandle, true, &frameBuffer.dsv.cpuHandle);
+        mCommandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+
+        mDrawQueue.clear();
+        mDrawPackets.clear();
+
+        DrawPacket skybox;
+        skybox.pipeline = mPipelines[mSkyboxPipeline].state.Get();
+        skybox.rootSignature = mPipelines[mSkyboxPipeline].rootSignature.Get();
+        skybox.materialParameter = 1;
+        skybox.material = mTextures[mEnvTexture].srv.gpuHandle;
+        skybox.mesh = &mMeshBuffers[mSkyboxMesh];
+        mDrawQueue.push(DrawQueue::opaqueKey(SkyboxPass, SkyboxPipeline, 0, 0, 0.0f), 0);
+        mDrawPackets.push_back(skybox);
+
+        queueInstances(mFrameResources[mFrameIndex]);
+        submitDraws(mFrameResources[mFrameIndex]);
+    });
+    mRenderGraph.write(scene, color, RenderGraph::RenderTarget);
+    mRenderGraph.write(scene, depth, RenderGraph::DepthWrite);
+
+    if (multisampled) {
+        const uint32_t resolvePass = mRenderGraph.addPass("resolve", [this]() {
+            mCommandList->ResolveSubresource(
+                mResolveFrameBuffers[mFrameIndex].colorBuffer.Get(), 0, mFrameBuffers[mFrameIndex].colorBuffer.Get(),
+                0, DXGI_FORMAT_R16G16B16A16_FLOAT
+            );
+        });
+        mRenderGraph.read(resolvePass, color, RenderGraph::ResolveSource);
+        mRenderGraph.write(resolvePass, resolve, RenderGraph::ResolveDest);
+    }
+
+    const uint32_t tonemap = mRenderGraph.addPass("tonemap", [this]() {
+        SwapChainBuffer &swapChainBuffer = mSwapChainBuffers[mBackBufferIndex];
+        mCommandList->OMSetRenderTargets(
+            1, &swapChainBuffer.rtv.cpuHandle, true, &mDepthStencilBuffers[mFrameIndex].dsv.cpuHandle
+        );
+
+        mCommandList->SetPipelineState(mPipelines[mTonemapPipeline].state.Get());
+        mCommandList->SetGraphicsRootSignature(mPipelines[mTonemapPipeline].rootSignature.Get());
+        mCommandList->SetGraphicsRootDescriptorTable(0, mResolveFrameBuffers[mFrameIndex].srv.gpuHandle);
+
+        mCommandList->DrawInstanced(6, 1, 0, 0);
+    });
+    mRenderGraph.read(tonemap, resolve, RenderGraph::ShaderResource);
+    mRenderGraph.write(tonemap, backBuffer, RenderGraph::RenderTarget);
+
+    mRenderGraph.compile(GraphDevice(mDevice.Get()));
+
+    // one range of render target memory per frame in flight, transients with disjoint lifetimes share it
+    const std::vector<RenderGraph::Resource> &resources = mRenderGraph.resources();
+    float clearColor[] = {0.678431392f, 0.847058892f, 0.901960850f, 1.f};
+    for (UINT i = 0; i < mNumFrames; i++) {
+        mGraphAllocations[i] = allocateHeapMemory(
+            HeapAllocator::RenderTargets, mRenderGraph.heap().size, mRenderGraph.heap().alignment
+        );
+        const HeapAllocator::Allocation &graphMemory = mHeapAllocator.allocation(mGraphAllocations[i]);
+
+        mGraphResources[i].assign(resources.size(), nullptr);
+        for (uint32_t index = 0; index < resources.size(); index++) {
+            const RenderGraph::Resource &resource = resources[index];
+            if (resource.imported || resource.size == 0) {
+                continue;
+            }
+            const D3D12_RESOURCE_DESC desc = graphTextureDesc(resource.desc);
+            const CD3DX12_CLEAR_VALUE clearValue = resource.desc.depthStencil
+                ? CD3DX12_CLEAR_VALUE{desc.Format, 1.0f, 0}
+                : CD3DX12_CLEAR_VALUE{desc.Format, clearColor};
+            ThrowIfFailed(mDevice->CreatePlacedResource(
+                mHeaps[graphMemory.heap].Get(),
+                graphMemory.offset + resource.offset,
+                &desc,
+                graphState(resource.initialState),
+                &clearValue,
+                IID_PPV_ARGS(&mGraphResources[i][index])
+            ));
+        }
+
+        mFrameBuffers[i] = createFrameBuffer(mGraphResources[i][color], mGraphResources[i][depth]);
+        mResolveFrameBuffers[i] = multisampled ? createFrameBuffer(mGraphResources[i][resolve], nullptr)
+                                               : mFrameBuffers[i];
+    }
+}
+
+void DxRenderer::executeRenderGraph() {
+    // back buffers and frame slots only line up while there are as many of both
+    mBackBufferIndex = mSwapChain->GetCurrentBackBufferIndex();
+    mGraphResources[mFrameIndex][mGraphBackBuffer] = mSwapChainBuffers[mBackBufferIndex].buffer;
+    const std::vector<ComPtr<ID3D12Resource>> &resources = mGraphResources[mFrameIndex];
+    std::vector<D3D12_RESOURCE_BARRIER> barriers;
+    mRenderGraph.execute(
+        [&](const std::vector<RenderGraph::Barrier> &graphBarriers) {
+            barriers.clear();
+            for (const RenderGraph::Barrier &barrier : graphBarriers) {
+                if (barrier.type == RenderGraph::Barrier::Aliasing) {
+                    ID3D12Resource *previous =
+                        barrier.previous == RenderGraph::NoResource ? nullptr : resources[barrier.previous].Get();
+                    barriers.push_back(CD3DX12_RESOURCE_BARRIER::Aliasing(previous, resources[barrier.resource].Get()));
+                } else {
+                    barriers.push_back(CD3DX12_RESOURCE_BARRIER::Transition(
+                        resources[barrier.resource].Get(), graphState(barrier.before), graphState(barrier.after)
+                    ));
+                }
+            }
+            mCommandList->ResourceBarrier(static_cast<UINT>(barriers.size()), barriers.data());
+        },
+        [&](uint32_t resource) { mCommandList->DiscardResource(resources[resource].Get(), nullptr); }
+    );
+}
+
+void DxRenderer::updateFrameResources() {
+    FrameResource &frameResource = mFrameResources[mFrameIndex];
+
+    // draw() waited for the frame's fence, the gpu is done with its constants
+    frameResource.constants.beginFrame();
+
+    glm::mat4 proj = glm::perspective(glm::radians(mCamera.fov), mCamera.aspect, NearPlane, FarPlane);
     glm::mat4 view = mCamera.getViewMatrix();
     const glm::vec3 cameraPos = mCamera.position;
 
-    ShadingCB *shadingCB = frameResource.shadingCBs.as<ShadingCB>();
-    shadingCB->lights[0].position = glm::vec4(5.0, 5.0, 5.0, 0.0);
-    shadingCB->lights[0].radiance = glm::vec4(1.0, 1.0, 1.0, 0.0);
-    shadingCB->cameraPos = glm::vec4{cameraPos, 0.0f};
+    // light lists per cluster, counts are clamped to the buffer capacities
+    const UINT numLights = std::min(static_cast<UINT>(mLights.size()), MaxLights);
+    mLightClusters.build(
+        view, glm::radians(mCamera.fov), mCamera.aspect, NearPlane, FarPlane, mLights.data(), numLights
+    );
+    std::vector<glm::uvec2> clusterRanges = mLightClusters.clusterRanges();
+    const std::vector<uint32_t> &lightIndices = mLightClusters.lightIndices();
+    for (glm::uvec2 &range : clusterRanges) {
+        range.y = std::min(range.y, MaxLightIndices - std::min(range.x, MaxLightIndices));
+    }
+    std::memcpy(frameResource.lightBuffer.cpuAddress, mLights.data(), sizeof(ClusterLight) * numLights);
+    std::memcpy(
+        frameResource.clusterRangeBuffer.cpuAddress, clusterRanges.data(), sizeof(glm::uvec2) * clusterRanges.size()
+    );
+    std::memcpy(
+        frameResource.lightIndexBuffer.cpuAddress, lightIndices.data(),
+        sizeof(uint32_t) * std::min(static_cast<UINT>(lightIndices.size()), MaxLightIndices)
+    );
 
-    TransformCB *transformCB = frameResource.transformCBs.as<TransformCB>();
-    transformCB->viewProj = proj * view;
+    ShadingCB *shadingCB = frameResource.allocateConstants<ShadingCB>(1, frameResource.shadingCB);
+    shadingCB->cameraPos = glm::vec4{cameraPos, 0.0f};
+    shadingCB->cameraForward = glm::vec4{mCamera.front, 0.0f};
+    shadingCB->clusterScale = glm::vec4{
+        LightClusters::TilesX / mScreenViewport.Width, LightClusters::TilesY / mScreenViewport.Height,
+        mLightClusters.sliceScale(), mLightClusters.sliceBias()
+    };
+
+    TransformCB *transformCB = frameResource.allocateConstants<TransformCB>(1, frameResource.transformCB);
+    mViewProj = proj * view;
+    transformCB->viewProj = mViewProj;
     transformCB->skyboxProj = proj * glm::mat4(glm::mat3(view));
+    transformCB->probeVolume = glm::uvec4{mProbeVolume.numProbes(), 0u, 0u, 0u};
+}
+
+std::vector<glm::mat4> DxRenderer::instanceTransforms() const {
+    std::vector<glm::mat4> transforms;
+    for (const OcclusionCuller::Instance &instance : mInstances) {
+        transforms.push_back(instance.world);
+    }
+    return transforms;
+}
+
+void DxRenderer::applySnapshot(const FrameSnapshot &snapshot) {
+    mCamera = snapshot.camera;
+    if (snapshot.transforms.size() == mInstances.size()) {
+        for (size_t i = 0; i < mInstances.size(); i++) {
+            mInstances[i].world = snapshot.transforms[i];
+        }
+    }
 }
 
 void DxRenderer::draw() {
+    // paced by the swap chain's present queue, then by the fence of the frame that used this frame's resources
+    const double waitStart = timelineNow();
+    if (mFrameLatencyWaitable) {
+        WaitForSingleObjectEx(mFrameLatencyWaitable, 1000, true);
+    }
+    waitForFence(mTimeline.waitFence());
+    mTimeline.complete(mFence->GetCompletedValue(), timelineNow());
+    mTimeline.beginFrame(waitStart, timelineNow());
+
     // update transform/shading constant buffer
     updateFrameResources();
+    mOcclusionCuller.cull(mViewProj, mInstances, mInstanceVisible);
 
-    FrameBuffer& frameBuffer = mFrameBuffers[mFrameIndex];
-    FrameBuffer& resolveFrameBuffer = mResolveFrameBuffers[mFrameIndex];
-    SwapChainBuffer& swapChainBuffer = mSwapChainBuffers[mFrameIndex];
-    DepthStentilBuffer &depthStencilBuffer = mDepthStencilBuffers[mFrameIndex];
     FrameResource &frameResource = mFrameResources[mFrameIndex];
 
     ThrowIfFailed(frameResource.mCommandAllocator->Reset());
     ThrowIfFailed(mCommandList->Reset(
-        frameResource.mCommandAllocator.Get(), mPipelineStates["skybox"].Get()
+        frameResource.mCommandAllocator.Get(), mPipelines[mSkyboxPipeline].state.Get()
     ));
 
     mCommandList->RSSetViewports(1, &mScreenViewport);
     mCommandList->RSSetScissorRects(1, &mScissorRect);
 
-    // resource barrier
-    mCommandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
-        frameBuffer.colorBuffer.Get(), D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, D3D12_RESOURCE_STATE_RENDER_TARGET
-    ));
-
-    // clear render target and depth/stencil buffer
-    mCommandList->ClearRenderTargetView(frameBuffer.rtv.cpuHandle, DirectX::Colors::LightBlue, 0, nullptr);
-    mCommandList->ClearDepthStencilView(
-        frameBuffer.dsv.cpuHandle, D3D12_CLEAR_FLAG_DEPTH | D3D12_CLEAR_FLAG_STENCIL, 1.0f, 0, 0, nullptr
-    );
-
-    mCommandList->OMSetRenderTargets(
-        1, &frameBuffer.rtv.cpuHandle, true, &frameBuffer.dsv.cpuHandle
-    );
-    mCommandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-
     ID3D12DescriptorHeap *descriptorHeaps[] = {mCbvSrvUavHeap.heap.Get()};
     mCommandList->SetDescriptorHeaps(1, descriptorHeaps);
 
-    // skybox pass
-    mCommandList->SetPipelineState(mPipelineStates["skybox"].Get());
-    mCommandList->SetGraphicsRootSignature(mRootSignatures["skybox"].Get());
-    mCommandList->SetGraphicsRootDescriptorTable(0, frameResource.transformCBs.cbv.gpuHandle);
-    mCommandList->SetGraphicsRootDescriptorTable(1, mTextures["envTexture"].srv.gpuHandle);
-
-    mCommandList->IASetVertexBuffers(0, 1, &mMeshBuffers["skybox"].vbv);
-    mCommandList->IASetIndexBuffer(&mMeshBuffers["skybox"].ibv);
-    mCommandList->DrawIndexedInstanced(mMeshBuffers["skybox"].numIndices, 1, 0, 0, 0);
-
-    // pbr pass
-    mCommandList->SetPipelineState(mPipelineStates["pbr"].Get());
-    mCommandList->SetGraphicsRootSignature(mRootSignatures["pbr"].Get());
-    mCommandList->SetGraphicsRootDescriptorTable(0, frameResource.transformCBs.cbv.gpuHandle);
-    mCommandList->SetGraphicsRootDescriptorTable(1, frameResource.shadingCBs.cbv.gpuHandle);
-    mCommandList->SetGraphicsRootDescriptorTable(2, mTextures["irradiance"].srv.gpuHandle);
-
-    mCommandList->IASetVertexBuffers(0, 1, &mMeshBuffers["model"].vbv);
-    mCommandList->IASetIndexBuffer(&mMeshBuffers["model"].ibv);
-    mCommandList->DrawIndexedInstanced(mMeshBuffers["model"].numIndices, 1, 0, 0, 0);
-
-    // resolve frame buffer
-    if (frameBuffer.samples > 1) {
-        resolveSubresource(frameBuffer, resolveFrameBuffer, DXGI_FORMAT_R16G16B16A16_FLOAT);
-    } else {
-        mCommandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
-            frameBuffer.colorBuffer.Get(), D3D12_RESOURCE_STATE_RENDER_TARGET, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE
-        ));
-    }
-
-    // tonemap pass
-    mCommandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
-        swapChainBuffer.buffer.Get(), D3D12_RESOURCE_STATE_PRESENT, D3D12_RESOURCE_STATE_RENDER_TARGET
-    ));
-    mCommandList->OMSetRenderTargets(1, &swapChainBuffer.rtv.cpuHandle, true, &depthStencilBuffer.dsv.cpuHandle);
-
-    mCommandList->SetPipelineState(mPipelineStates["tonemap"].Get());
-    mCommandList->SetGraphicsRootSignature(mRootSignatures["tonemap"].Get());
-    mCommandList->SetGraphicsRootDescriptorTable(0, resolveFrameBuffer.srv.gpuHandle);
-
-    mCommandList->DrawInstanced(6, 1, 0, 0);
-
-    mCommandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
-        swapChainBuffer.buffer.Get(), D3D12_RESOURCE_STATE_RENDER_TARGET, D3D12_RESOURCE_STATE_PRESENT
-    ));
+    // scene, resolve and tonemap passes with the barriers the render graph placed between them
+    executeRenderGraph();
     executeCommandList();
 
-    ThrowIfFailed(mSwapChain->Present(0, 0));
-
-    mFrameIndex = (mFrameIndex + 1) % mNumFrames;
-    frameResource.Fence = ++mCurrentFence;
+    ++mCurrentFence;
+    ThrowIfFailed(mCommandQueue->Signal(mFence.Get(), mCurrentFence));
+    mCbvSrvUavHeap.allocator.finishFrame(mCurrentFence);
+    mTimeline.submit(mCurrentFence, timelineNow());
 
-    mCommandQueue->Signal(mFence.Get(), mCurrentFence);
+    ThrowIfFailed(mSwapChain->Present(mSyncInterval, 0));
+    mTimeline.present(mCurrentFence, timelineNow());
+    mFrameIndex = mTimeline.frameIndex();
 }
 
 void DxRenderer::exit() {
+    // nothing may be in flight when the resources go
+    flushUploads();
+    waitForGPU();
 
+    mTextures.forEach([this](Texture &texture) { freePlacedResource(texture.texture, texture.allocation); });
+    if (mProbePlanes) {
+        freePlacedResource(mProbePlanes, mProbePlanesAllocation);
+    }
+    mMeshBuffers.forEach([this](MeshBuffer &meshBuffer) {
+        freePlacedResource(meshBuffer.vertexBuffer, meshBuffer.vertexAllocation);
+        freePlacedResource(meshBuffer.indexBuffer, meshBuffer.indexAllocation);
+    });
+    for (UINT i = 0; i < mNumFrames; i++) {
+        mFrameBuffers[i] = {};
+        mResolveFrameBuffers[i] = {};
+        freePlacedResource(mDepthStencilBuffers[i].buffer, mDepthStencilBuffers[i].allocation);
+        mGraphResources[i].clear();
+        if (mGraphAllocations[i] != HeapAllocator::Invalid) {
+            mHeapAllocator.free(mGraphAllocations[i]);
+            mGraphAllocations[i] = HeapAllocator::Invalid;
+        }
+    }
+}
+
+DxRenderer::~DxRenderer() {
+    if (mFenceEvent) {
+        CloseHandle(mFenceEvent);
+    }
+    if (mFrameLatencyWaitable) {
+        CloseHandle(mFrameLatencyWaitable);
+    }
 }
 
-DescriptorHeap DxRenderer::createDescriptorHeap(D3D12_DESCRIPTOR_HEAP_DESC desc) {
+DescriptorHeap DxRenderer::createDescriptorHeap(D3D12_DESCRIPTOR_HEAP_DESC desc, UINT transientCount) {
     DescriptorHeap heap;
     heap.descriptorSize = mDevice->GetDescriptorHandleIncrementSize(desc.Type);
-    heap.numDescriptor = desc.NumDescriptors;
-    heap.numDescriptorAlloced = 0;
+    heap.shaderVisible = (desc.Flags & D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE) != 0;
+    heap.allocator.reset(desc.NumDescriptors - transientCount, transientCount);
 
     ThrowIfFailed(mDevice->CreateDescriptorHeap(&desc, IID_PPV_ARGS(&heap.heap)));
 
@@ -651,14 +1198,7 @@ Texture DxRenderer::createTexture(
     desc.SampleDesc.Count = 1;
     desc.Flags = D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
 
-    ThrowIfFailed(mDevice->CreateCommittedResource(
-        &CD3DX12_HEAP_PROPERTIES{D3D12_HEAP_TYPE_DEFAULT},
-        D3D12_HEAP_FLAG_NONE, 
-        &desc, 
-        D3D12_RESOURCE_STATE_COMMON, 
-        nullptr,
-        IID_PPV_ARGS(&texture.texture)
-    ));
+    texture.texture = createPlacedResource(desc, D3D12_RESOURCE_STATE_COMMON, nullptr, texture.allocation);
 
     D3D12_SRV_DIMENSION srvDim;
     switch (depth) {
@@ -680,26 +1220,30 @@ Texture DxRenderer::createTexture(
 Texture DxRenderer::createTexture(
     std::shared_ptr<Image> image, DXGI_FORMAT format, UINT levels
 ) {
-    Texture texture = createTexture(image->width(), image->height(), 1, format, levels);
+    return createTexture(image->pixels<void>(), image->pitch(), image->width(), image->height(), format, levels);
+}
 
-    D3D12_SUBRESOURCE_DATA data{image->pixels<void>(), image->pitch()};
+Texture DxRenderer::createTexture(
+    const void *pixels, UINT pitch, UINT width, UINT height, DXGI_FORMAT format, UINT levels
+) {
+    Texture texture = createTexture(width, height, 1, format, levels);
+
+    D3D12_SUBRESOURCE_DATA data{pixels, pitch};
     StagingBuffer stagingBuffer = createStagingBuffer(texture.texture, 0, 1, &data);
 
     CD3DX12_TEXTURE_COPY_LOCATION destCopyLocation{texture.texture.Get(), 0};
     CD3DX12_TEXTURE_COPY_LOCATION srcCopyLocation{stagingBuffer.buffer.Get(), stagingBuffer.layouts[0]};
 
-    mCommandList->Reset(mFrameResources[mFrameIndex].mCommandAllocator.Get(), nullptr);
+    ID3D12GraphicsCommandList *commandList = uploadCommandList();
 
-    mCommandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
+    commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
         texture.texture.Get(), D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_COPY_DEST, 0
     ));
-    mCommandList->CopyTextureRegion(&destCopyLocation, 0, 0, 0, &srcCopyLocation, nullptr);
+    commandList->CopyTextureRegion(&destCopyLocation, 0, 0, 0, &srcCopyLocation, nullptr);
 
-    mCommandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
+    commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
         texture.texture.Get(), D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_COMMON, 0
     ));
-    executeCommandList();
-    waitForGPU();
 
     if (texture.levels > 1 && texture.width == texture.height && IsPowerOfTwo(texture.width)) {
         generateMipmaps(texture);
@@ -708,13 +1252,18 @@ Texture DxRenderer::createTexture(
 }
 
 void DxRenderer::createTextureSRV(
-    Texture& texture, D3D12_SRV_DIMENSION dimension, UINT mostDetailedMip, UINT mipLevels
+    Texture& texture, D3D12_SRV_DIMENSION dimension, UINT mostDetailedMip, UINT mipLevels, bool transient
 ) {
     D3D12_RESOURCE_DESC desc = texture.texture->GetDesc();
     UINT effectiveMipLevels = (mipLevels > 0) ? mipLevels : (desc.MipLevels - mostDetailedMip);
     assert(!(desc.Flags & D3D12_RESOURCE_FLAG_DENY_SHADER_RESOURCE));
 
-    texture.srv = mCbvSrvUavHeap.alloc();
+    // persistent views are created in the staging heap and copied, so tables can be built from them later
+    texture.srv = transient ? mCbvSrvUavHeap.allocTransient() : mCbvSrvUavHeap.alloc();
+    const Descriptor view = transient ? texture.srv : mStagingHeap.alloc();
+    if (!transient) {
+        texture.stagingSrv = view;
+    }
 
     D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
     srvDesc.Format = desc.Format;
@@ -737,14 +1286,41 @@ void DxRenderer::createTextureSRV(
         srvDesc.TextureCube.MipLevels = effectiveMipLevels;
         break;
     }
-    mDevice->CreateShaderResourceView(texture.texture.Get(), &srvDesc, texture.srv.cpuHandle);
+    mDevice->CreateShaderResourceView(texture.texture.Get(), &srvDesc, view.cpuHandle);
+    if (!transient) {
+        mDevice->CopyDescriptorsSimple(
+            1, texture.srv.cpuHandle, view.cpuHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV
+        );
+    }
+}
+
+void DxRenderer::freeTextureSRV(Texture &texture) {
+    mCbvSrvUavHeap.free(texture.srv);
+    mStagingHeap.free(texture.stagingSrv);
+    texture.srv = {};
+    texture.stagingSrv = {};
+}
+
+Descriptor DxRenderer::createDescriptorTable(const std::vector<Descriptor> &stagedViews) {
+    const UINT count = static_cast<UINT>(stagedViews.size());
+    Descriptor table = mCbvSrvUavHeap.alloc(count);
+
+    std::vector<D3D12_CPU_DESCRIPTOR_HANDLE> sources;
+    for (const Descriptor &view : stagedViews) {
+        sources.push_back(view.cpuHandle);
+    }
+    const std::vector<UINT> sourceSizes(count, 1);
+    mDevice->CopyDescriptors(
+        1, &table.cpuHandle, &count, count, sources.data(), sourceSizes.data(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV
+    );
+    return table;
 }
 
 void DxRenderer::createTextureUAV(Texture &texture, UINT mipSlice) {
     D3D12_RESOURCE_DESC desc = texture.texture->GetDesc();
     assert(desc.Flags & D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS);
 
-    texture.uav = mCbvSrvUavHeap.alloc();
+    texture.uav = mCbvSrvUavHeap.allocTransient();
 
     D3D12_UNORDERED_ACCESS_VIEW_DESC uavDesc = {};
     uavDesc.Format = desc.Format;
@@ -788,14 +1364,10 @@ DepthStentilBuffer DxRenderer::createDepthStencilBuffer(
     desc.Format = depthstencilFormat;
     desc.Flags = D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL | D3D12_RESOURCE_FLAG_DENY_SHADER_RESOURCE;
 
-    ThrowIfFailed(mDevice->CreateCommittedResource(
-        &CD3DX12_HEAP_PROPERTIES{D3D12_HEAP_TYPE_DEFAULT},
-        D3D12_HEAP_FLAG_NONE, 
-        &desc, 
-        D3D12_RESOURCE_STATE_DEPTH_WRITE,
-        &CD3DX12_CLEAR_VALUE{depthstencilFormat, 1.0f, 0},
-        IID_PPV_ARGS(&depthStencilBuffer.buffer)
-    ));
+    const CD3DX12_CLEAR_VALUE clearValue{depthstencilFormat, 1.0f, 0};
+    depthStencilBuffer.buffer = createPlacedResource(
+        desc, D3D12_RESOURCE_STATE_DEPTH_WRITE, &clearValue, depthStencilBuffer.allocation
+    );
 
     depthStencilBuffer.dsv = mDsvHeap.alloc();
 
@@ -808,36 +1380,20 @@ DepthStentilBuffer DxRenderer::createDepthStencilBuffer(
 }
 
 FrameBuffer DxRenderer::createFrameBuffer(
-    UINT width, UINT height, UINT samples, DXGI_FORMAT colorFormat, DXGI_FORMAT depthstencilFormat
+    ComPtr<ID3D12Resource> colorBuffer, ComPtr<ID3D12Resource> depthStencilBuffer
 ) {
     FrameBuffer framebuffer;
-    framebuffer.width = width;
-    framebuffer.height = height;
-    framebuffer.samples = samples;
+    framebuffer.colorBuffer = colorBuffer;
+    framebuffer.depthStencilBuffer = depthStencilBuffer;
 
-    D3D12_RESOURCE_DESC desc = {};
-    desc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
-    desc.Width = width;
-    desc.Height = height;
-    desc.DepthOrArraySize = 1;
-    desc.MipLevels = 1;
-    desc.SampleDesc.Count = samples;
-
-    if (colorFormat != DXGI_FORMAT_UNKNOWN) {
-        desc.Format = colorFormat;
-        desc.Flags = D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET;
-
-        float clearColor[] = {0.678431392f, 0.847058892f, 0.901960850f, 1.f};
-
-        ThrowIfFailed(mDevice->CreateCommittedResource(
-            &CD3DX12_HEAP_PROPERTIES{D3D12_HEAP_TYPE_DEFAULT},
-            D3D12_HEAP_FLAG_NONE, 
-            &desc, 
-            D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
-            &CD3DX12_CLEAR_VALUE{colorFormat, clearColor},
-            IID_PPV_ARGS(&framebuffer.colorBuffer)
-        ));
+    D3D12_RESOURCE_DESC desc = (colorBuffer ? colorBuffer : depthStencilBuffer)->GetDesc();
+    framebuffer.width = static_cast<UINT>(desc.Width);
+    framebuffer.height = desc.Height;
+    framebuffer.samples = desc.SampleDesc.Count;
+    const UINT samples = framebuffer.samples;
 
+    if (colorBuffer) {
+        desc = colorBuffer->GetDesc();
         framebuffer.rtv = mRtvHeap.alloc();
 
         D3D12_RENDER_TARGET_VIEW_DESC rtvDesc = {};
@@ -858,19 +1414,8 @@ FrameBuffer DxRenderer::createFrameBuffer(
         }
     }
 
-    if (depthstencilFormat != DXGI_FORMAT_UNKNOWN) {
-        desc.Format = depthstencilFormat;
-        desc.Flags = D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL | D3D12_RESOURCE_FLAG_DENY_SHADER_RESOURCE;
-
-        ThrowIfFailed(mDevice->CreateCommittedResource(
-            &CD3DX12_HEAP_PROPERTIES{D3D12_HEAP_TYPE_DEFAULT},
-            D3D12_HEAP_FLAG_NONE, 
-            &desc, 
-            D3D12_RESOURCE_STATE_DEPTH_WRITE,
-            &CD3DX12_CLEAR_VALUE{depthstencilFormat, 1.0f, 0},
-            IID_PPV_ARGS(&framebuffer.depthStencilBuffer)
-        ));
-
+    if (depthStencilBuffer) {
+        desc = depthStencilBuffer->GetDesc();
         framebuffer.dsv = mDsvHeap.alloc();
 
         D3D12_DEPTH_STENCIL_VIEW_DESC dsvDesc = {};
@@ -894,7 +1439,7 @@ StagingBuffer DxRenderer::createStagingBuffer(
 
     std::vector<UINT> numRows(numSubresources);
     std::vector<UINT64> rowBytes(numSubresources);
-    UINT64 numBytesTotol;
+    UINT64 numBytesTotal;
     mDevice->GetCopyableFootprints(  // ȷԴ壩ڴеĲϢ
         &resourceDesc, 
         firstSubresource, 
@@ -903,28 +1448,33 @@ StagingBuffer DxRenderer::createStagingBuffer(
         stagingBuffer.layouts.data(), 
         numRows.data(), 
         rowBytes.data(), 
-        &numBytesTotol
+        &numBytesTotal
     );
 
-    ThrowIfFailed(mDevice->CreateCommittedResource(
-        &CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD),
-        D3D12_HEAP_FLAG_NONE, 
-        &CD3DX12_RESOURCE_DESC::Buffer(numBytesTotol),
-        D3D12_RESOURCE_STATE_GENERIC_READ,
-        nullptr, 
-        IID_PPV_ARGS(&stagingBuffer.buffer)
-    ));
+    uint8_t *bufferMemory;
+    if (numBytesTotal <= mUploadRing.capacity()) {
+        // suballocated from the ring, the layouts point behind the offset
+        const UINT64 offset = allocateUpload(numBytesTotal, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+        for (D3D12_PLACED_SUBRESOURCE_FOOTPRINT &layout : stagingBuffer.layouts) {
+            layout.Offset += offset;
+        }
+        stagingBuffer.buffer = mUploadBuffer.buffer;
+        bufferMemory = mUploadBuffer.cpuAddress;
+    } else {
+        // too large for the ring, a buffer of its own that lives as long as the batch
+        UploadBuffer uploadBuffer = createUploadBuffer(static_cast<UINT>(numBytesTotal));
+        keepUntilUploaded(uploadBuffer.buffer);
+        stagingBuffer.buffer = uploadBuffer.buffer;
+        bufferMemory = uploadBuffer.cpuAddress;
+    }
 
     if (data) {
-        void *bufferMemory;
-        ThrowIfFailed(stagingBuffer.buffer->Map(0, &CD3DX12_RANGE{0, 0}, &bufferMemory));
-
         for (UINT i = 0; i < numSubresources; i++) {
-            uint8_t *subresourceMemory = reinterpret_cast<uint8_t *>(bufferMemory) + stagingBuffer.layouts[i].Offset;
+            uint8_t *subresourceMemory = bufferMemory + stagingBuffer.layouts[i].Offset;
 
             if (resourceDesc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER) {
                 // copy buffer
-                std::memcpy(subresourceMemory, data->pData, numBytesTotol);
+                std::memcpy(subresourceMemory, data->pData, numBytesTotal);
             }
             else {
                 // copy texture
@@ -935,7 +1485,6 @@ StagingBuffer DxRenderer::createStagingBuffer(
                 }
             }
         }
-        stagingBuffer.buffer->Unmap(0, nullptr);
     }
     return stagingBuffer;
 }
@@ -961,19 +1510,64 @@ UploadBuffer DxRenderer::createUploadBuffer(UINT size) {
     return uploadBuffer;
 }
 
-template <typename T>
-ConstantBuffer DxRenderer::createConstantBuffer(UINT count) {
-    ConstantBuffer constantBuffer;
+uint32_t DxRenderer::allocateHeapMemory(HeapAllocator::Category category, UINT64 size, UINT64 alignment) {
+    uint32_t allocation = mHeapAllocator.allocate(category, size, alignment);
+    if (allocation != HeapAllocator::Invalid) {
+        return allocation;
+    }
+    // larger resources get a heap of their own
+    D3D12_HEAP_DESC heapDesc = {};
+    const UINT64 heapAlignment = D3D12_DEFAULT_MSAA_RESOURCE_PLACEMENT_ALIGNMENT;
+    heapDesc.SizeInBytes = std::max(UINT64(HeapSize), (size + heapAlignment - 1) & ~(heapAlignment - 1));
+    heapDesc.Properties = CD3DX12_HEAP_PROPERTIES{D3D12_HEAP_TYPE_DEFAULT};
+    switch (category) {
+    case HeapAllocator::Buffers:
+        heapDesc.Flags = D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS;
+        break;
+    case HeapAllocator::Textures:
+        heapDesc.Flags = D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES;
+        break;
+    default:
+        // msaa targets need the larger alignment
+        heapDesc.Alignment = heapAlignment;
+        heapDesc.Flags = D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES;
+        break;
+    }
+
+    const uint32_t heap = mHeapAllocator.addHeap(category, heapDesc.SizeInBytes);
+    if (heap >= mHeaps.size()) {
+        mHeaps.resize(heap + 1);
+    }
+    ThrowIfFailed(mDevice->CreateHeap(&heapDesc, IID_PPV_ARGS(&mHeaps[heap])));
+
+    allocation = mHeapAllocator.allocate(category, size, alignment);
+    if (allocation == HeapAllocator::Invalid) {
+        throw std::runtime_error("Heap memory allocation failed");
+    }
+    return allocation;
+}
 
-    constantBuffer.buffer = createUploadBuffer(AlignedByteSize(sizeof(T), 256) * count);
-    constantBuffer.cbv = mCbvSrvUavHeap.alloc();
+ComPtr<ID3D12Resource> DxRenderer::createPlacedResource(
+    const D3D12_RESOURCE_DESC &desc, D3D12_RESOURCE_STATES state, const D3D12_CLEAR_VALUE *clearValue,
+    uint32_t &allocation
+) {
+    const D3D12_RESOURCE_ALLOCATION_INFO info = mDevice->GetResourceAllocationInfo(0, 1, &desc);
+    allocation = allocateHeapMemory(heapCategory(desc), info.SizeInBytes, info.Alignment);
+    const HeapAllocator::Allocation &memory = mHeapAllocator.allocation(allocation);
 
-    D3D12_CONSTANT_BUFFER_VIEW_DESC desc = {};
-    desc.BufferLocation = constantBuffer.buffer.gpuAddress;
-    desc.SizeInBytes = constantBuffer.buffer.size;
-    mDevice->CreateConstantBufferView(&desc, constantBuffer.cbv.cpuHandle);
+    ComPtr<ID3D12Resource> resource;
+    ThrowIfFailed(mDevice->CreatePlacedResource(
+        mHeaps[memory.heap].Get(), memory.offset, &desc, state, clearValue, IID_PPV_ARGS(&resource)
+    ));
+    return resource;
+}
 
-    return constantBuffer;
+void DxRenderer::freePlacedResource(ComPtr<ID3D12Resource> &resource, uint32_t &allocation) {
+    resource.Reset();
+    if (allocation != HeapAllocator::Invalid) {
+        mHeapAllocator.free(allocation);
+        allocation = HeapAllocator::Invalid;
+    }
 }
 
 MeshBuffer DxRenderer::createMeshBuffer(std::shared_ptr<Mesh> mesh) {
@@ -984,55 +1578,49 @@ MeshBuffer DxRenderer::createMeshBuffer(std::shared_ptr<Mesh> mesh) {
     size_t vertexByteSize = mesh->vertices().size() * sizeof(Mesh::Vertex);
     size_t indexByteSize = mesh->faces().size() * sizeof(Mesh::Face);
 
-    ThrowIfFailed(mDevice->CreateCommittedResource(
-		&CD3DX12_HEAP_PROPERTIES{D3D12_HEAP_TYPE_DEFAULT},
-		D3D12_HEAP_FLAG_NONE,
-		&CD3DX12_RESOURCE_DESC::Buffer(vertexByteSize),
-		D3D12_RESOURCE_STATE_COPY_DEST,
-		nullptr,
-		IID_PPV_ARGS(&meshBuffer.vertexBuffer)
-    ));
+    meshBuffer.vertexBuffer = createPlacedResource(
+        CD3DX12_RESOURCE_DESC::Buffer(vertexByteSize), D3D12_RESOURCE_STATE_COPY_DEST, nullptr,
+        meshBuffer.vertexAllocation
+    );
     meshBuffer.vbv.BufferLocation = meshBuffer.vertexBuffer->GetGPUVirtualAddress();
     meshBuffer.vbv.SizeInBytes = static_cast<UINT>(vertexByteSize);
     meshBuffer.vbv.StrideInBytes = sizeof(Mesh::Vertex);
 
-    ThrowIfFailed(mDevice->CreateCommittedResource(
-		&CD3DX12_HEAP_PROPERTIES{D3D12_HEAP_TYPE_DEFAULT},
-		D3D12_HEAP_FLAG_NONE,
-		&CD3DX12_RESOURCE_DESC::Buffer(indexByteSize),
-		D3D12_RESOURCE_STATE_COPY_DEST,
-		nullptr,
-		IID_PPV_ARGS(&meshBuffer.indexBuffer)
-    ));
+    meshBuffer.indexBuffer = createPlacedResource(
+        CD3DX12_RESOURCE_DESC::Buffer(indexByteSize), D3D12_RESOURCE_STATE_COPY_DEST, nullptr,
+        meshBuffer.indexAllocation
+    );
     meshBuffer.ibv.BufferLocation = meshBuffer.indexBuffer->GetGPUVirtualAddress();
     meshBuffer.ibv.SizeInBytes = static_cast<UINT>(indexByteSize);
     meshBuffer.ibv.Format = DXGI_FORMAT_R32_UINT;
 
+    // each copy is recorded right after its staging bytes, a full ring may submit the batch in between
     D3D12_SUBRESOURCE_DATA vertexData = {mesh->vertices().data()};
     StagingBuffer vertexStagingBuffer = createStagingBuffer(meshBuffer.vertexBuffer, 0, 1, &vertexData);
+    uploadCommandList()->CopyBufferRegion(
+        meshBuffer.vertexBuffer.Get(), 0, vertexStagingBuffer.buffer.Get(), vertexStagingBuffer.layouts[0].Offset,
+        vertexByteSize
+    );
 
     D3D12_SUBRESOURCE_DATA indexData = {mesh->faces().data()};
     StagingBuffer indexStagingBuffer = createStagingBuffer(meshBuffer.indexBuffer, 0, 1, &indexData);
-
-    mCommandList->Reset(mFrameResources[mFrameIndex].mCommandAllocator.Get(), nullptr);
-
-    mCommandList->CopyResource(meshBuffer.vertexBuffer.Get(), vertexStagingBuffer.buffer.Get());
-    mCommandList->CopyResource(meshBuffer.indexBuffer.Get(), indexStagingBuffer.buffer.Get());
+    uploadCommandList()->CopyBufferRegion(
+        meshBuffer.indexBuffer.Get(), 0, indexStagingBuffer.buffer.Get(), indexStagingBuffer.layouts[0].Offset,
+        indexByteSize
+    );
 
     D3D12_RESOURCE_BARRIER barriers[] = {
 		CD3DX12_RESOURCE_BARRIER::Transition(meshBuffer.vertexBuffer.Get(), D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER),
 		CD3DX12_RESOURCE_BARRIER::Transition(meshBuffer.indexBuffer.Get(), D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_INDEX_BUFFER)
 	};
-	mCommandList->ResourceBarrier(2, barriers);
-
-    executeCommandList();
-	waitForGPU();
+	uploadCommandList()->ResourceBarrier(2, barriers);
 
 	return meshBuffer;
 }
 
 ComPtr<ID3DBlob> DxRenderer::compileShader(
-    std::string filename, std::string entryPoint, std::string profile
+    std::string filename, std::string entryPoint, std::string profile,
+    const std::vector<std::pair<std::string, std::string>> &defines
 ) {
     UINT flags = D3DCOMPILE_ENABLE_STRICTNESS;
 #if _DEBUG
@@ -1040,12 +1628,25 @@ ComPtr<ID3DBlob> DxRenderer::compileShader(
     flags |= D3DCOMPILE_SKIP_OPTIMIZATION;
 #endif
 
+    // compiled shaders of earlier launches are reused until the source, an include or a setting changes
+    const uint64_t key = ShaderCache::shaderKey(filename, entryPoint, profile, defines, flags);
     ComPtr<ID3DBlob> shader;
-    ComPtr<ID3DBlob> errorBlob;
+    if (const std::vector<uint8_t> *cached = mShaderCache.find(key)) {
+        ThrowIfFailed(D3DCreateBlob(cached->size(), &shader));
+        std::memcpy(shader->GetBufferPointer(), cached->data(), cached->size());
+        return shader;
+    }
+
+    std::vector<D3D_SHADER_MACRO> macros;
+    for (const auto &define : defines) {
+        macros.push_back({define.first.c_str(), define.second.c_str()});
+    }
+    macros.push_back({nullptr, nullptr});
 
+    ComPtr<ID3DBlob> errorBlob;
     HRESULT hr = D3DCompileFromFile(
         ConvertToUTF16(filename).c_str(), 
-        nullptr, 
+        macros.data(), 
         D3D_COMPILE_STANDARD_FILE_INCLUDE,
         entryPoint.c_str(), 
         profile.c_str(), 
@@ -1059,14 +1660,103 @@ ComPtr<ID3DBlob> DxRenderer::compileShader(
         }
         throw std::runtime_error(errorMsg);
     }
+    const uint8_t *bytecode = static_cast<const uint8_t *>(shader->GetBufferPointer());
+    mShaderCache.store(key, std::vector<uint8_t>(bytecode, bytecode + shader->GetBufferSize()));
     return shader;
 }
 
+void DxRenderer::createPipelineLibrary() {
+    // devices without ID3D12Device1 create every pipeline on every launch
+    ComPtr<ID3D12Device1> device;
+    if (FAILED(mDevice.As(&device))) {
+        return;
+    }
+    // a library of another driver or adapter is rejected and started over
+    mShaderCache.load(PipelineLibraryName, mPipelineLibraryData);
+    if (!mPipelineLibraryData.empty() && SUCCEEDED(device->CreatePipelineLibrary(
+        mPipelineLibraryData.data(), mPipelineLibraryData.size(), IID_PPV_ARGS(&mPipelineLibrary)
+    ))) {
+        return;
+    }
+    mPipelineLibrary.Reset();
+    mPipelineLibraryData.clear();
+    if (FAILED(device->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(&mPipelineLibrary)))) {
+        mPipelineLibrary.Reset();
+    }
+}
+
+void DxRenderer::savePipelineLibrary() {
+    if (!mPipelineLibrary || !mPipelineLibraryChanged) {
+        return;
+    }
+    std::vector<uint8_t> data(mPipelineLibrary->GetSerializedSize());
+    ThrowIfFailed(mPipelineLibrary->Serialize(data.data(), data.size()));
+    mShaderCache.save(PipelineLibraryName, data);
+    mPipelineLibraryChanged = false;
+}
+
+std::wstring DxRenderer::pipelineName(
+    const std::string &name, std::initializer_list<D3D12_SHADER_BYTECODE> shaders
+) const {
+    ShaderCache::Hasher hasher;
+    for (const D3D12_SHADER_BYTECODE &shader : shaders) {
+        hasher.add(shader.pShaderBytecode, shader.BytecodeLength);
+    }
+    return ConvertToUTF16(name + "_" + ShaderCache::keyName(hasher.value()));
+}
+
+void DxRenderer::storePipeline(const std::wstring &name, ID3D12PipelineState *pipelineState) {
+    if (!mPipelineLibrary) {
+        return;
+    }
+    // the name is taken by a pipeline of another root signature or state, the stale library starts over. pipelines
+    // loaded from it before are stored again on the next launch
+    if (FAILED(mPipelineLibrary->StorePipeline(name.c_str(), pipelineState))) {
+        ComPtr<ID3D12Device1> device;
+        ThrowIfFailed(mDevice.As(&device));
+        mPipelineLibrary.Reset();
+        mPipelineLibraryData.clear();
+        ThrowIfFailed(device->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(&mPipelineLibrary)));
+        ThrowIfFailed(mPipelineLibrary->StorePipeline(name.c_str(), pipelineState));
+    }
+    mPipelineLibraryChanged = true;
+}
+
+ComPtr<ID3D12PipelineState> DxRenderer::createPipelineState(
+    const std::string &name, const D3D12_GRAPHICS_PIPELINE_STATE_DESC &desc
+) {
+    const std::wstring libraryName = pipelineName(name, {desc.VS, desc.PS, desc.DS, desc.HS, desc.GS});
+    ComPtr<ID3D12PipelineState> pipelineState;
+    if (mPipelineLibrary && SUCCEEDED(
+        mPipelineLibrary->LoadGraphicsPipeline(libraryName.c_str(), &desc, IID_PPV_ARGS(&pipelineState))
+    )) {
+        return pipelineState;
+    }
+    ThrowIfFailed(mDevice->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(&pipelineState)));
+    storePipeline(libraryName, pipelineState.Get());
+    return pipelineState;
+}
+
+ComPtr<ID3D12PipelineState> DxRenderer::createPipelineState(
+    const std::string &name, const D3D12_COMPUTE_PIPELINE_STATE_DESC &desc
+) {
+    const std::wstring libraryName = pipelineName(name, {desc.CS});
+    ComPtr<ID3D12PipelineState> pipelineState;
+    if (mPipelineLibrary && SUCCEEDED(
+        mPipelineLibrary->LoadComputePipeline(libraryName.c_str(), &desc, IID_PPV_ARGS(&pipelineState))
+    )) {
+        return pipelineState;
+    }
+    ThrowIfFailed(mDevice->CreateComputePipelineState(&desc, IID_PPV_ARGS(&pipelineState)));
+    storePipeline(libraryName, pipelineState.Get());
+    return pipelineState;
+}
+
 void DxRenderer::generateMipmaps(Texture &texture) {
     assert(texture.width == texture.height);
     assert(IsPowerOfTwo(texture.width));
 
-    if (mRootSignatures.find("mipmap") == mRootSignatures.end()) {
+    if (!mMipmapRootSignature) {
         const CD3DX12_DESCRIPTOR_RANGE1 descriptorRanges[] = {
             {D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 1, 0, 0, D3D12_DESCRIPTOR_RANGE_FLAG_DATA_STATIC_WHILE_SET_AT_EXECUTE},
             {D3D12_DESCRIPTOR_RANGE_TYPE_UAV, 1, 0, 0, D3D12_DESCRIPTOR_RANGE_FLAG_DATA_STATIC_WHILE_SET_AT_EXECUTE},
@@ -1077,83 +1767,90 @@ void DxRenderer::generateMipmaps(Texture &texture) {
 
         CD3DX12_VERSIONED_ROOT_SIGNATURE_DESC rootSignatureDesc;
         rootSignatureDesc.Init_1_1(2, rootParameters);
-        mRootSignatures["mipmap"] = createRootSignature(rootSignatureDesc);
+        mMipmapRootSignature = createRootSignature(rootSignatureDesc);
     }
 
     ID3D12PipelineState* pipelineState = nullptr;
     const D3D12_RESOURCE_DESC desc = texture.texture->GetDesc();
 
     if (desc.DepthOrArraySize == 1 && desc.Format == DXGI_FORMAT_R8G8B8A8_UNORM_SRGB) {
-        if (mPipelineStates.find("gammaTexture") == mPipelineStates.end()) {
+        PipelineHandle handle = mPipelines.find("gammaTexture");
+        if (!handle) {
             ComPtr<ID3DBlob> computeShader =
                 compileShader("src/backend/dx12/shaders/downsample.hlsl", "downsample_gamma", "cs_5_0");
 
             D3D12_COMPUTE_PIPELINE_STATE_DESC psoDesc = {};
-            psoDesc.pRootSignature = mRootSignatures["mipmap"].Get();
+            psoDesc.pRootSignature = mMipmapRootSignature.Get();
             psoDesc.CS = CD3DX12_SHADER_BYTECODE(computeShader.Get());
 
-            ThrowIfFailed(mDevice->CreateComputePipelineState(
-                &psoDesc, IID_PPV_ARGS(&mPipelineStates["gammaTexture"])
-            ));
+            Pipeline pipeline;
+            pipeline.rootSignature = mMipmapRootSignature;
+            pipeline.state = createPipelineState("gammaTexture", psoDesc);
+            handle = mPipelines.add("gammaTexture", pipeline);
         }
-        pipelineState = mPipelineStates["gammaTexture"].Get();
+        pipelineState = mPipelines[handle].state.Get();
     } 
     else if (desc.DepthOrArraySize > 1 && desc.Format != DXGI_FORMAT_R8G8B8A8_UNORM_SRGB) {
-        if (mPipelineStates.find("arrayTexture") == mPipelineStates.end()) {
+        PipelineHandle handle = mPipelines.find("arrayTexture");
+        if (!handle) {
             ComPtr<ID3DBlob> computeShader =
                 compileShader("src/backend/dx12/shaders/downsample_array.hlsl", "downsample_linear", "cs_5_0");
 
             D3D12_COMPUTE_PIPELINE_STATE_DESC psoDesc = {};
-            psoDesc.pRootSignature = mRootSignatures["mipmap"].Get();
+            psoDesc.pRootSignature = mMipmapRootSignature.Get();
             psoDesc.CS = CD3DX12_SHADER_BYTECODE(computeShader.Get());
 
-            ThrowIfFailed(mDevice->CreateComputePipelineState(
-                &psoDesc, IID_PPV_ARGS(&mPipelineStates["arrayTexture"])
-            ));
+            Pipeline pipeline;
+            pipeline.rootSignature = mMipmapRootSignature;
+            pipeline.state = createPipelineState("arrayTexture", psoDesc);
+            handle = mPipelines.add("arrayTexture", pipeline);
         }
-        pipelineState = mPipelineStates["arrayTexture"].Get();
+        pipelineState = mPipelines[handle].state.Get();
     } 
     else {
         assert(desc.DepthOrArraySize == 1);
-        if (mPipelineStates.find("linearTexture") == mPipelineStates.end()) {
+        PipelineHandle handle = mPipelines.find("linearTexture");
+        if (!handle) {
             ComPtr<ID3DBlob> computeShader =
                 compileShader("src/backend/dx12/shaders/downsample.hlsl", "downsample_linear", "cs_5_0");
 
             D3D12_COMPUTE_PIPELINE_STATE_DESC psoDesc = {};
-            psoDesc.pRootSignature = mRootSignatures["mipmap"].Get();
+            psoDesc.pRootSignature = mMipmapRootSignature.Get();
             psoDesc.CS = CD3DX12_SHADER_BYTECODE(computeShader.Get());
 
-            ThrowIfFailed(mDevice->CreateComputePipelineState(
-                &psoDesc, IID_PPV_ARGS(&mPipelineStates["linearTexture"])
-            ));
+            Pipeline pipeline;
+            pipeline.rootSignature = mMipmapRootSignature;
+            pipeline.state = createPipelineState("linearTexture", psoDesc);
+            handle = mPipelines.add("linearTexture", pipeline);
         }
-        pipelineState = mPipelineStates["gammaTexture"].Get();
+        pipelineState = mPipelines[handle].state.Get();
     }
 
-    DescriptorHeapMark mark(mCbvSrvUavHeap);
     ID3D12DescriptorHeap *descriptorHeaps[] = {mCbvSrvUavHeap.heap.Get()};
 
-    mCommandList->Reset(mFrameResources[mFrameIndex].mCommandAllocator.Get(), nullptr);
-    
+    // recorded behind the copy that filled level 0
+    ID3D12GraphicsCommandList *commandList = uploadCommandList();
+
     // tempTexture is needed here because createTextureSRV and createTextureUAV will change the properties of srv and uav
     Texture tempTexture = texture;
     if(desc.Format == DXGI_FORMAT_R8G8B8A8_UNORM_SRGB) {
-        pipelineState = mPipelineStates["gammaTexture"].Get();
         tempTexture = createTexture(texture.width, texture.height, 1, DXGI_FORMAT_R8G8B8A8_UNORM, texture.levels);
+        // only the per level views below get bound
+        freeTextureSRV(tempTexture);
 
-		mCommandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
+		commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
             tempTexture.texture.Get(), D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_COPY_DEST
         ));
-        mCommandList->CopyResource(tempTexture.texture.Get(), texture.texture.Get());
+        commandList->CopyResource(tempTexture.texture.Get(), texture.texture.Get());
 
-		mCommandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
+		commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
             tempTexture.texture.Get(), D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_COMMON
         ));
 	}
 
-    mCommandList->SetDescriptorHeaps(1, descriptorHeaps);
-    mCommandList->SetPipelineState(pipelineState);
-    mCommandList->SetComputeRootSignature(mRootSignatures["mipmap"].Get());
+    commandList->SetDescriptorHeaps(1, descriptorHeaps);
+    commandList->SetPipelineState(pipelineState);
+    commandList->SetComputeRootSignature(mMipmapRootSignature.Get());
 
     std::vector<CD3DX12_RESOURCE_BARRIER> preDispatchBarriers(desc.DepthOrArraySize);
     std::vector<CD3DX12_RESOURCE_BARRIER> postDispatchBarriers(desc.DepthOrArraySize);
@@ -1161,9 +1858,9 @@ void DxRenderer::generateMipmaps(Texture &texture) {
     UINT levelHeight = texture.height / 2;
     
     for (UINT level = 1; level < texture.levels; ++level, levelWidth /= 2, levelHeight /= 2) {
-        createTextureSRV(
-            tempTexture, desc.DepthOrArraySize > 1 ? D3D12_SRV_DIMENSION_TEXTURE2DARRAY : D3D12_SRV_DIMENSION_TEXTURE2D, level - 1, 1
-        );
+        const D3D12_SRV_DIMENSION dimension =
+            desc.DepthOrArraySize > 1 ? D3D12_SRV_DIMENSION_TEXTURE2DARRAY : D3D12_SRV_DIMENSION_TEXTURE2D;
+        createTextureSRV(tempTexture, dimension, level - 1, 1, true);
         createTextureUAV(tempTexture, level);
 
         for (UINT arraySlice = 0; arraySlice < desc.DepthOrArraySize; ++arraySlice) {
@@ -1177,51 +1874,107 @@ void DxRenderer::generateMipmaps(Texture &texture) {
             );
         }
 
-        mCommandList->ResourceBarrier(desc.DepthOrArraySize, preDispatchBarriers.data());
-        mCommandList->SetComputeRootDescriptorTable(0, tempTexture.srv.gpuHandle);
-        mCommandList->SetComputeRootDescriptorTable(1, tempTexture.uav.gpuHandle);
-        mCommandList->Dispatch(
+        commandList->ResourceBarrier(desc.DepthOrArraySize, preDispatchBarriers.data());
+        commandList->SetComputeRootDescriptorTable(0, tempTexture.srv.gpuHandle);
+        commandList->SetComputeRootDescriptorTable(1, tempTexture.uav.gpuHandle);
+        commandList->Dispatch(
             glm::max(UINT(1), levelWidth / 8), glm::max(UINT(1), levelHeight / 8), desc.DepthOrArraySize
         );
-        mCommandList->ResourceBarrier(desc.DepthOrArraySize, postDispatchBarriers.data());
+        commandList->ResourceBarrier(desc.DepthOrArraySize, postDispatchBarriers.data());
     }
 
     if (texture.texture == tempTexture.texture) {
-        mCommandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
+        commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
             texture.texture.Get(), D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE, D3D12_RESOURCE_STATE_COMMON
         ));
     } else {
-        mCommandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
+        commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
             texture.texture.Get(), D3D12_RESOURCE_STATE_COPY_SOURCE, D3D12_RESOURCE_STATE_COPY_DEST
         ));
-        mCommandList->CopyResource(texture.texture.Get(), tempTexture.texture.Get());
+        commandList->CopyResource(texture.texture.Get(), tempTexture.texture.Get());
 
-        mCommandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
+        commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
             texture.texture.Get(), D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_COMMON
         ));
+        keepUntilUploaded(tempTexture.texture, tempTexture.allocation);
     }
-    executeCommandList();
-    waitForGPU();
 }
 
-void DxRenderer::resolveSubresource(const FrameBuffer &srcBuffer, const FrameBuffer &dstBuffer, DXGI_FORMAT format) {
-    CD3DX12_RESOURCE_BARRIER preResolveBarriers[] = {
-		CD3DX12_RESOURCE_BARRIER::Transition(srcBuffer.colorBuffer.Get(), D3D12_RESOURCE_STATE_RENDER_TARGET, D3D12_RESOURCE_STATE_RESOLVE_SOURCE),
-		CD3DX12_RESOURCE_BARRIER::Transition(dstBuffer.colorBuffer.Get(), D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, D3D12_RESOURCE_STATE_RESOLVE_DEST)
-	};
-	CD3DX12_RESOURCE_BARRIER postResolveBarriers[] = {
-		CD3DX12_RESOURCE_BARRIER::Transition(srcBuffer.colorBuffer.Get(), D3D12_RESOURCE_STATE_RESOLVE_SOURCE, D3D12_RESOURCE_STATE_RENDER_TARGET),
-		CD3DX12_RESOURCE_BARRIER::Transition(dstBuffer.colorBuffer.Get(), D3D12_RESOURCE_STATE_RESOLVE_DEST, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE)
-	};
+Texture DxRenderer::createOctahedralTexture(const Texture &cube, UINT levels) {
+    const UINT size = OctahedralMap::sizeForCubeFace(cube.width);
+    levels = std::min({levels, cube.levels, OctahedralMap::maxLevels(size)});
+    Texture texture = createTexture(size, size, 1, cube.texture->GetDesc().Format, levels);
 
-	if (srcBuffer.colorBuffer != dstBuffer.colorBuffer) {
-		mCommandList->ResourceBarrier(2, preResolveBarriers);
-		mCommandList->ResolveSubresource(dstBuffer.colorBuffer.Get(), 0, srcBuffer.colorBuffer.Get(), 0, format);
-		mCommandList->ResourceBarrier(2, postResolveBarriers);
-	}
+    PipelineHandle handle = mPipelines.find("cube2octahedral");
+    if (!handle) {
+        const CD3DX12_DESCRIPTOR_RANGE1 descriptorRanges[] = {
+            {D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 1, 0, 0, D3D12_DESCRIPTOR_RANGE_FLAG_DATA_STATIC_WHILE_SET_AT_EXECUTE},
+            {D3D12_DESCRIPTOR_RANGE_TYPE_UAV, 1, 0, 0, D3D12_DESCRIPTOR_RANGE_FLAG_DATA_STATIC_WHILE_SET_AT_EXECUTE},
+        };
+        CD3DX12_ROOT_PARAMETER1 rootParameters[2];
+        rootParameters[0].InitAsDescriptorTable(1, &descriptorRanges[0]);
+        rootParameters[1].InitAsDescriptorTable(1, &descriptorRanges[1]);
+        // bilinear lookups that filter across the cube faces
+        CD3DX12_STATIC_SAMPLER_DESC samplerDesc{0, D3D12_FILTER_MIN_MAG_MIP_LINEAR};
+
+        CD3DX12_VERSIONED_ROOT_SIGNATURE_DESC rootSignatureDesc;
+        rootSignatureDesc.Init_1_1(2, rootParameters, 1, &samplerDesc);
+
+        ComPtr<ID3DBlob> computeShader =
+            compileShader("src/backend/dx12/shaders/cube2octahedral.hlsl", "main", "cs_5_0");
+
+        Pipeline pipeline;
+        pipeline.rootSignature = createRootSignature(rootSignatureDesc);
+        D3D12_COMPUTE_PIPELINE_STATE_DESC psoDesc = {};
+        psoDesc.pRootSignature = pipeline.rootSignature.Get();
+        psoDesc.CS = CD3DX12_SHADER_BYTECODE(computeShader.Get());
+        pipeline.state = createPipelineState("cube2octahedral", psoDesc);
+        handle = mPipelines.add("cube2octahedral", pipeline);
+    }
+    const Pipeline &pipeline = mPipelines[handle];
+
+    ID3D12GraphicsCommandList *commandList = uploadCommandList();
+    ID3D12DescriptorHeap *descriptorHeaps[] = {mCbvSrvUavHeap.heap.Get()};
+    commandList->SetDescriptorHeaps(1, descriptorHeaps);
+    commandList->SetPipelineState(pipeline.state.Get());
+    commandList->SetComputeRootSignature(pipeline.rootSignature.Get());
+
+    D3D12_RESOURCE_BARRIER preDispatchBarriers[] = {
+        CD3DX12_RESOURCE_BARRIER::Transition(
+            texture.texture.Get(), D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_UNORDERED_ACCESS
+        ),
+        CD3DX12_RESOURCE_BARRIER::Transition(
+            cube.texture.Get(), D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE
+        ),
+    };
+    D3D12_RESOURCE_BARRIER postDispatchBarriers[] = {
+        CD3DX12_RESOURCE_BARRIER::Transition(
+            texture.texture.Get(), D3D12_RESOURCE_STATE_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_COMMON
+        ),
+        CD3DX12_RESOURCE_BARRIER::Transition(
+            cube.texture.Get(), D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE, D3D12_RESOURCE_STATE_COMMON
+        ),
+    };
+    commandList->ResourceBarrier(2, preDispatchBarriers);
+
+    // level l of the cube into level l, through transient views of one cube level each. the cube keeps its own view
+    Texture levelView = cube;
+    for (UINT level = 0, levelSize = size; level < levels; ++level, levelSize /= 2) {
+        createTextureSRV(levelView, D3D12_SRV_DIMENSION_TEXTURECUBE, level, 1, true);
+        createTextureUAV(texture, level);
+
+        commandList->SetComputeRootDescriptorTable(0, levelView.srv.gpuHandle);
+        commandList->SetComputeRootDescriptorTable(1, texture.uav.gpuHandle);
+        commandList->Dispatch((levelSize + 7) / 8, (levelSize + 7) / 8, 1);
+    }
+    commandList->ResourceBarrier(2, postDispatchBarriers);
+    return texture;
 }
 
 void DxRenderer::executeCommandList() {
+    // pending uploads go first, the list may read what they write. the transient views allocated so far include the
+    // list's own, the caller's finishFrame() hands them all the list's fence
+    flushUploads(false);
     ThrowIfFailed(mCommandList->Close());
 
     ID3D12CommandList *lists[] = {mCommandList.Get()};
@@ -1232,11 +1985,102 @@ void DxRenderer::waitForGPU() {
     mCurrentFence++;
 
     ThrowIfFailed(mCommandQueue->Signal(mFence.Get(), mCurrentFence));
+    mCbvSrvUavHeap.allocator.finishFrame(mCurrentFence);
+
+    waitForFence(mCurrentFence);
+}
+void DxRenderer::waitForFence(UINT64 fence) {
+    if (mFence->GetCompletedValue() < fence) {
+        ThrowIfFailed(mFence->SetEventOnCompletion(fence, mFenceEvent));
+        WaitForSingleObject(mFenceEvent, INFINITE);
+        mFenceWaits++;
+    }
+    const UINT64 completedFence = mFence->GetCompletedValue();
+    mCbvSrvUavHeap.allocator.retire(completedFence);
+    retireUploads(completedFence);
+}
+
+ID3D12GraphicsCommandList *DxRenderer::uploadCommandList() {
+    if (!mUploadOpen) {
+        // an allocator backs its batch until the batch's fence passes, one is added when all of them are in flight
+        const UINT64 completedFence = mFence->GetCompletedValue();
+        mUploadAllocator = 0;
+        while (mUploadAllocator < mUploadAllocators.size() &&
+               mUploadAllocators[mUploadAllocator].fence > completedFence) {
+            ++mUploadAllocator;
+        }
+        if (mUploadAllocator == mUploadAllocators.size()) {
+            mUploadAllocators.push_back({nullptr, 0});
+            ThrowIfFailed(mDevice->CreateCommandAllocator(
+                D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(mUploadAllocators.back().allocator.GetAddressOf())
+            ));
+        }
+        ID3D12CommandAllocator *allocator = mUploadAllocators[mUploadAllocator].allocator.Get();
+        ThrowIfFailed(allocator->Reset());
+        ThrowIfFailed(mUploadCommandList->Reset(allocator, nullptr));
+        mUploadOpen = true;
+    }
+    return mUploadCommandList.Get();
+}
 
-    if (mFence->GetCompletedValue() < mCurrentFence) {
-        HANDLE eventHandle = CreateEventEx(nullptr, nullptr, false, EVENT_ALL_ACCESS);
-        ThrowIfFailed(mFence->SetEventOnCompletion(mCurrentFence, eventHandle));
-        WaitForSingleObject(eventHandle, INFINITE);
-        CloseHandle(eventHandle);
+UINT64 DxRenderer::allocateUpload(UINT64 size, UINT64 alignment) {
+    UINT64 offset = mUploadRing.allocate(size, alignment);
+    while (offset == UploadRing::Invalid) {
+        // the ring is full of bytes the gpu has not copied yet, submit them and wait for the oldest batch
+        flushUploads();
+        const UINT64 fence = mUploadRing.oldestFence();
+        if (fence == 0) {
+            throw std::runtime_error("Upload ring is too small");
+        }
+        waitForFence(fence);
+        offset = mUploadRing.allocate(size, alignment);
     }
-}
\ No newline at end of file
+    return offset;
+}
+
+void DxRenderer::keepUntilUploaded(ComPtr<ID3D12Resource> resource, uint32_t allocation) {
+    mUploadResources.push_back({0, resource, allocation});
+}
+
+void DxRenderer::flushUploads(bool finishDescriptors) {
+    if (!mUploadOpen) {
+        return;
+    }
+    ThrowIfFailed(mUploadCommandList->Close());
+
+    ID3D12CommandList *lists[] = {mUploadCommandList.Get()};
+    mCommandQueue->ExecuteCommandLists(1, lists);
+
+    mUploadFence = ++mCurrentFence;
+    ThrowIfFailed(mCommandQueue->Signal(mFence.Get(), mUploadFence));
+    mUploadRing.finishBatch(mUploadFence);
+    mUploadAllocators[mUploadAllocator].fence = mUploadFence;
+    // mip and bake views of the batch
+    if (finishDescriptors) {
+        mCbvSrvUavHeap.allocator.finishFrame(mUploadFence);
+    }
+    for (UploadResource &resource : mUploadResources) {
+        if (resource.fence == 0) {
+            resource.fence = mUploadFence;
+        }
+    }
+    mUploadOpen = false;
+}
+
+void DxRenderer::retireUploads(UINT64 completedFence) {
+    mUploadRing.retire(completedFence);
+    for (size_t i = 0; i < mUploadResources.size();) {
+        UploadResource &resource = mUploadResources[i];
+        if (resource.fence == 0 || resource.fence > completedFence) {
+            ++i;
+            continue;
+        }
+        // the resource goes before its memory can be handed out again
+        resource.resource.Reset();
+        if (resource.allocation != HeapAllocator::Invalid) {
+            mHeapAllocator.free(resource.allocation);
+        }
+        mUploadResources[i] = std::move(mUploadResources.back());
+        mUploadResources.pop_back();
+    }
+}
@@ -1,5 +1,5 @@
 #include <vector>
-#include <unordered_map>
+#include <algorithm>
 #include <d3d12.h>
 #include <wrl.h>
 #include <dxgi1_4.h>
@@ -10,32 +10,83 @@
 #include "src/common/Mesh.h"
 #include "src/common/Utils.h"
 #include "src/common/Camera.h"
+#include "src/common/FrameSnapshot.h"
+#include "src/common/OcclusionCuller.h"
+#include "src/common/LightClusters.h"
+#include "src/common/InstanceBatcher.h"
+#include "src/common/DrawQueue.h"
+#include "src/common/RenderGraph.h"
+#include "src/common/Registry.h"
+#include "src/common/UploadRing.h"
+#include "src/common/HeapAllocator.h"
+#include "src/common/ShaderCache.h"
+#include "src/common/FrameTimeline.h"
+#include "src/common/OctahedralMap.h"
+#include "src/common/ProbeVolume.h"
 
 
 using Microsoft::WRL::ComPtr;
 
 class DxRenderer : public IRenderer {
 public:
-    DxRenderer() {}
-    ~DxRenderer() {}
+    // framesInFlight is clamped to 1-4, a sync interval of 0 presents without waiting for a vertical blank.
+    // octahedralEnv binds the environment maps as octahedral 2D textures instead of cubes. probeVolume lights every
+    // instance with the irradiance of a probe volume baked around the scene instead of the irradiance map. brdfApprox
+    // evaluates the analytic fit of the BRDF LUT in the pbr shader and leaves the LUT out
+    explicit DxRenderer(UINT framesInFlight = 2, UINT syncInterval = 0, bool octahedralEnv = false,
+                        bool probeVolume = false, bool brdfApprox = false)
+        : mNumFrames(std::min(std::max(framesInFlight, 1u), UINT(MaxFrames))),
+          mNumBackBuffers(std::max(mNumFrames, 2u)), mSyncInterval(syncInterval), mOctahedralEnv(octahedralEnv),
+          mUseProbeVolume(probeVolume), mBrdfApprox(brdfApprox), mTimeline(mNumFrames) {}
+    ~DxRenderer();
 
     void init(GLFWwindow* window) override;
     void setup() override;
     void draw() override;
     void exit() override;
 
+    // cpu, gpu and present times of the last frames
+    const FrameTimeline &timeline() const { return mTimeline; }
+
+    // times the cpu blocked on a fence so far
+    UINT fenceWaits() const { return mFenceWaits; }
+
+    // instances left undrawn so far because their frame ran out of constants, and the most constants a frame asked
+    // for, what FrameConstantsSize would have to hold
+    uint64_t droppedInstances() const { return mDroppedInstances; }
+    uint64_t constantsHighWater() const;
+
+    // the camera init() places for the window, input moves a copy of it and hands it back through applySnapshot()
+    const Camera &camera() const { return mCamera; }
+
+    // world matrices of the instances in the order they were added, what snapshots start from
+    std::vector<glm::mat4> instanceTransforms() const;
+
+    // camera and instance transforms of the next frame, called between draws on the thread that draws
+    void applySnapshot(const FrameSnapshot &snapshot);
+
 private:
-    DescriptorHeap createDescriptorHeap(D3D12_DESCRIPTOR_HEAP_DESC desc);
+    // the last transientCount descriptors form the per frame ring
+    DescriptorHeap createDescriptorHeap(D3D12_DESCRIPTOR_HEAP_DESC desc, UINT transientCount = 0);
     
     ComPtr<ID3D12RootSignature> createRootSignature(D3D12_VERSIONED_ROOT_SIGNATURE_DESC desc);
 
     Texture createTexture(UINT width, UINT height, UINT depth, DXGI_FORMAT format, UINT levels = 0);
     Texture createTexture(std::shared_ptr<Image> image, DXGI_FORMAT format, UINT levels = 0);
+    Texture createTexture(
+        const void *pixels, UINT pitch, UINT width, UINT height, DXGI_FORMAT format, UINT levels = 0
+    );
 
+    // transient srvs skip the staging heap and retire with the frame
     void createTextureSRV(
-        Texture &texture, D3D12_SRV_DIMENSION dimension, UINT mostDetailedMip = 0, UINT mipLevels = 0
+        Texture &texture, D3D12_SRV_DIMENSION dimension, UINT mostDetailedMip = 0, UINT mipLevels = 0,
+        bool transient = false
     );
     void createTextureUAV(Texture &texture, UINT mipSlice);
+    void freeTextureSRV(Texture &texture);
+
+    // persistent table of staged views, copied in one call
+    Descriptor createDescriptorTable(const std::vector<Descriptor> &stagedViews);
 
     SwapChainBuffer createSwapChainBuffer(UINT index);
 
@@ -43,36 +94,120 @@ private:
         UINT width, UINT height, UINT samples, DXGI_FORMAT depthstencilFormat
     );
 
+    // views over existing color and depth/stencil resources, either may be null
     FrameBuffer createFrameBuffer(
-        UINT width, UINT height, UINT samples, DXGI_FORMAT colorFormat, DXGI_FORMAT depthstencilFormat
+        ComPtr<ID3D12Resource> colorBuffer, ComPtr<ID3D12Resource> depthStencilBuffer
     );
 
+    // staging memory from the upload ring, the copy has to be recorded into the upload batch right after
     StagingBuffer createStagingBuffer(
         ComPtr<ID3D12Resource> resource, UINT firstSubresource, UINT numSubresources, D3D12_SUBRESOURCE_DATA *data
     );
 
     UploadBuffer createUploadBuffer(UINT capacity);
 
-    template <typename T> 
-    ConstantBuffer createConstantBuffer(UINT count);
+    // default heap memory from mHeapAllocator, a new heap is created when none of the category has room
+    uint32_t allocateHeapMemory(HeapAllocator::Category category, UINT64 size, UINT64 alignment);
+    // placed into memory of the category the resource belongs to instead of a heap of its own
+    ComPtr<ID3D12Resource> createPlacedResource(
+        const D3D12_RESOURCE_DESC &desc, D3D12_RESOURCE_STATES state, const D3D12_CLEAR_VALUE *clearValue,
+        uint32_t &allocation
+    );
+    // releases the resource, then hands its memory back. the gpu must be done with it
+    void freePlacedResource(ComPtr<ID3D12Resource> &resource, uint32_t &allocation);
    
     MeshBuffer createMeshBuffer(std::shared_ptr<Mesh> mesh);
 
-    ComPtr<ID3DBlob> compileShader(std::string filename, std::string entryPoint, std::string profile);
+    // cached in mShaderCache, a variant per set of defines
+    ComPtr<ID3DBlob> compileShader(
+        std::string filename, std::string entryPoint, std::string profile,
+        const std::vector<std::pair<std::string, std::string>> &defines = {}
+    );
+
+    void createPipelineLibrary();
+    void savePipelineLibrary();
+    // library names are the pipeline's name and the hash of its shaders
+    std::wstring pipelineName(const std::string &name, std::initializer_list<D3D12_SHADER_BYTECODE> shaders) const;
+    void storePipeline(const std::wstring &name, ID3D12PipelineState *pipelineState);
+    // loaded from the pipeline library, created and stored in it on a miss
+    ComPtr<ID3D12PipelineState> createPipelineState(
+        const std::string &name, const D3D12_GRAPHICS_PIPELINE_STATE_DESC &desc
+    );
+    ComPtr<ID3D12PipelineState> createPipelineState(
+        const std::string &name, const D3D12_COMPUTE_PIPELINE_STATE_DESC &desc
+    );
 
-    void resolveSubresource(const FrameBuffer &srcBuffer, const FrameBuffer &dstBuffer, DXGI_FORMAT format);
+    // recorded into the upload batch
     void generateMipmaps(Texture &texture);
+    // 2D octahedral copy of a cube map of at most levels levels, see OctahedralMap.h. level l is sampled from level l
+    // of the cube, so prefiltered chains stay prefiltered. recorded into the upload batch
+    Texture createOctahedralTexture(const Texture &cube, UINT levels);
+    // submits pending uploads ahead of the list
     void executeCommandList();
     void waitForGPU();
+    // also retires whatever the completed fence released
+    void waitForFence(UINT64 fence);
+
+    // the open upload batch, texture and mesh copies of setup are recorded into it instead of one round trip each
+    ID3D12GraphicsCommandList *uploadCommandList();
+    // ring offset of size bytes, submits the batch and waits for older ones when the ring is full
+    UINT64 allocateUpload(UINT64 size, UINT64 alignment);
+    // resources read by the open batch, released with their placed memory once it completed
+    void keepUntilUploaded(ComPtr<ID3D12Resource> resource, uint32_t allocation = HeapAllocator::Invalid);
+    // submits the open batch without waiting, lists executed later run after it on the queue. without
+    // finishDescriptors the transient views allocated since the last finishFrame() are left to the next one
+    void flushUploads(bool finishDescriptors = true);
+    void retireUploads(UINT64 completedFence);
     void updateFrameResources();
 
+    // uploads a mesh for instanced drawing, returns its id for addInstance
+    uint32_t addMesh(const std::string &name, std::shared_ptr<Mesh> mesh);
+    void addInstance(uint32_t mesh, uint32_t material, const glm::mat4 &world);
+    // bakes mProbeVolume around the instances, occluded by their meshes (indexed like mMeshes), and records the
+    // upload of its planes into the upload batch
+    void bakeProbeVolume(const CubeMap &env, const std::vector<std::shared_ptr<Mesh>> &meshes);
+    void queueInstances(FrameResource &frameResource);
+    void submitDraws(const FrameResource &frameResource);
+
+    // declares the passes of a frame, compiles them and places the transients of every frame in flight
+    void createRenderGraph(UINT width, UINT height);
+    void executeRenderGraph();
+
 private:
     Camera mCamera;
+    glm::mat4 mViewProj;
+
+    // instances are culled on the cpu before their draws are recorded
+    OcclusionCuller mOcclusionCuller;
+    std::vector<OcclusionCuller::Instance> mInstances;
+    std::vector<uint8_t> mInstanceVisible;
+
+    // mesh and material of every instance, the visible ones are grouped into one instanced draw per pair. meshes
+    // are handles into mMeshBuffers with their bounds and occluder, materials the first srv of their t0-t6 table
+    std::vector<MeshHandle> mMeshes;
+    std::vector<OcclusionCuller::Instance> mMeshBounds;
+    std::vector<D3D12_GPU_DESCRIPTOR_HANDLE> mMaterials;
+    std::vector<uint32_t> mInstanceMeshes;
+    std::vector<uint32_t> mInstanceMaterials;
+    InstanceBatcher mInstanceBatcher;
+    uint64_t mDroppedInstances = 0;
+
+    // draws of the frame, sorted by pass, pipeline, material, mesh and depth before they are recorded
+    DrawQueue mDrawQueue;
+    std::vector<DrawPacket> mDrawPackets;
+
+    std::vector<ClusterLight> mLights;
+    LightClusters mLightClusters;
+
+    // sh planes of the probes in a buffer of their own, every instance looks up its 8 probes in queueInstances
+    ProbeVolume mProbeVolume;
+    ComPtr<ID3D12Resource> mProbePlanes;
+    uint32_t mProbePlanesAllocation = HeapAllocator::Invalid;
 
 private:
     ComPtr<ID3D12Device> mDevice;
     ComPtr<IDXGIFactory4> mDxgiFactory;
-    ComPtr<IDXGISwapChain1> mSwapChain;
+    ComPtr<IDXGISwapChain3> mSwapChain;
 
     D3D12_VIEWPORT mScreenViewport;
     D3D12_RECT mScissorRect;
@@ -84,24 +219,90 @@ private:
     DescriptorHeap mRtvHeap;
     DescriptorHeap mDsvHeap;
     DescriptorHeap mCbvSrvUavHeap;
+    // cpu only, master copies of the persistent srvs
+    DescriptorHeap mStagingHeap;
 
     ComPtr<ID3D12Fence> mFence;
     UINT64 mCurrentFence = 0;
+    // reused by every fence wait
+    HANDLE mFenceEvent = nullptr;
+    UINT mFenceWaits = 0;
+    // signaled when the swap chain queues less than mNumFrames presents
+    HANDLE mFrameLatencyWaitable = nullptr;
+
+    // persistently mapped staging memory of the upload batches, suballocated by mUploadRing
+    static const UINT UploadRingSize = 64 << 20;
+    UploadBuffer mUploadBuffer;
+    UploadRing mUploadRing;
+    // with the fence of the batch each one recorded last
+    struct UploadAllocator {
+        ComPtr<ID3D12CommandAllocator> allocator;
+        UINT64 fence;
+    };
+    std::vector<UploadAllocator> mUploadAllocators;
+    // the one the open batch records into
+    size_t mUploadAllocator = 0;
+    ComPtr<ID3D12GraphicsCommandList> mUploadCommandList;
+    bool mUploadOpen = false;
+    // fence of the last submitted batch
+    UINT64 mUploadFence = 0;
+    // with the fence of their batch, 0 while it is still open
+    struct UploadResource {
+        UINT64 fence;
+        ComPtr<ID3D12Resource> resource;
+        uint32_t allocation;
+    };
+    std::vector<UploadResource> mUploadResources;
+
+    // default heap memory of textures, buffers and render targets, heap indices match mHeaps
+    static const UINT64 HeapSize = 64 << 20;
+    HeapAllocator mHeapAllocator{D3D12_SMALL_RESOURCE_PLACEMENT_ALIGNMENT};
+    std::vector<ComPtr<ID3D12Heap>> mHeaps;
 
     D3D_ROOT_SIGNATURE_VERSION mRootSignatureVersion;
 
-    static const UINT mNumFrames = 2;
+    // frames the cpu records ahead of the gpu, the flip model swap chain needs two buffers even for one
+    static const UINT MaxFrames = FrameTimeline::MaxFramesInFlight;
+    UINT mNumFrames;
+    UINT mNumBackBuffers;
+    UINT mSyncInterval;
+    bool mOctahedralEnv;
+    bool mUseProbeVolume;
+    bool mBrdfApprox;
+    FrameTimeline mTimeline;
     UINT mFrameIndex = 0;
-    SwapChainBuffer mSwapChainBuffers[mNumFrames];
-    DepthStentilBuffer mDepthStencilBuffers[mNumFrames];
-    FrameBuffer mFrameBuffers[mNumFrames];
-    FrameBuffer mResolveFrameBuffers[mNumFrames];
-    FrameResource mFrameResources[mNumFrames];
+    UINT mBackBufferIndex = 0;
+    SwapChainBuffer mSwapChainBuffers[MaxFrames];
+    DepthStentilBuffer mDepthStencilBuffers[MaxFrames];
+    FrameBuffer mFrameBuffers[MaxFrames];
+    FrameBuffer mResolveFrameBuffers[MaxFrames];
+    FrameResource mFrameResources[MaxFrames];
+
+    // passes of a frame with their barriers, the frame buffers are placed into one aliased range of render target
+    // memory per frame
+    RenderGraph mRenderGraph;
+    uint32_t mGraphAllocations[MaxFrames];
+    // per graph resource, imported ones included. the back buffer is bound every frame
+    std::vector<ComPtr<ID3D12Resource>> mGraphResources[MaxFrames];
+    uint32_t mGraphBackBuffer = RenderGraph::NoResource;
 
     UINT mSamples = 4;
 
-    std::unordered_map<std::string, ComPtr<ID3D12PipelineState>> mPipelineStates;
-    std::unordered_map<std::string, ComPtr<ID3D12RootSignature>> mRootSignatures;
-    std::unordered_map<std::string, Texture> mTextures;
-    std::unordered_map<std::string, MeshBuffer> mMeshBuffers;
+    // looked up by name during setup only, draws go through the handles below
+    Registry<Pipeline, PipelineHandle> mPipelines;
+    Registry<Texture, TextureHandle> mTextures;
+    Registry<MeshBuffer, MeshHandle> mMeshBuffers;
+    ComPtr<ID3D12RootSignature> mMipmapRootSignature;
+
+    ShaderCache mShaderCache;
+    ComPtr<ID3D12PipelineLibrary> mPipelineLibrary;
+    // the library reads its pipelines from this memory for as long as it lives
+    std::vector<uint8_t> mPipelineLibraryData;
+    bool mPipelineLibraryChanged = false;
+
+    PipelineHandle mSkyboxPipeline;
+    PipelineHandle mPbrPipeline;
+    PipelineHandle mTonemapPipeline;
+    TextureHandle mEnvTexture;
+    MeshHandle mSkyboxMesh;
 };
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <d3d12.h>
 #include "Structs.h"
 #include "src/common/Utils.h"
+#include "src/common/ConstantAllocator.h"
 
 using Microsoft::WRL::ComPtr;
 
@@ -16,8 +17,26 @@ public:
         ));
     }
 
-    ConstantBuffer transformCBs;
-    ConstantBuffer shadingCBs;
+    // count Ts of the frame's constants and their gpu address for a root cbv or srv, nullptr when the frame ran out.
+    // recording threads may call it at the same time
+    template <typename T>
+    T *allocateConstants(UINT count, D3D12_GPU_VIRTUAL_ADDRESS &gpuAddress) {
+        const uint64_t offset = constants.allocate(sizeof(T) * count);
+        if (offset == ConstantAllocator::Invalid) {
+            return nullptr;
+        }
+        gpuAddress = constantBuffer.gpuAddress + offset;
+        return reinterpret_cast<T *>(constantBuffer.cpuAddress + offset);
+    }
+
+    // per frame constants, reused once the gpu passed the frame's fence
+    UploadBuffer constantBuffer;
+    ConstantAllocator constants;
+    D3D12_GPU_VIRTUAL_ADDRESS transformCB = 0;
+    D3D12_GPU_VIRTUAL_ADDRESS shadingCB = 0;
+    // clustered lighting inputs of the pbr pass
+    UploadBuffer lightBuffer;
+    UploadBuffer clusterRangeBuffer;
+    UploadBuffer lightIndexBuffer;
     ComPtr<ID3D12CommandAllocator> mCommandAllocator;
-    UINT64 Fence = 0;
 };
\ No newline at end of file
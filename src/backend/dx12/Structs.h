@@ -1,9 +1,13 @@
 #pragma once
 
 #include <vector>
+#include <stdexcept>
 #include <d3d12.h>
 #include <glm.hpp>
 
+#include "src/common/DescriptorAllocator.h"
+#include "src/common/HeapAllocator.h"
+
 using Microsoft::WRL::ComPtr;
 
 struct Descriptor {
@@ -11,42 +15,63 @@ struct Descriptor {
     D3D12_GPU_DESCRIPTOR_HANDLE gpuHandle;
 };
 
+// persistent descriptors are freed one range at a time, transient ones come from the ring at the end of the heap and
+// retire with the fence of the frame that allocated them. heaps that are not shader visible have no gpu handles, they
+// stage views that get copied into visible tables
 struct DescriptorHeap {
     ComPtr<ID3D12DescriptorHeap> heap;
     UINT descriptorSize;
-    UINT numDescriptor;
-    UINT numDescriptorAlloced;
+    bool shaderVisible;
+    DescriptorAllocator allocator;
+
+    // count contiguous descriptors
+    Descriptor alloc(UINT count = 1) {
+        const UINT index = allocator.allocate(count);
+        if (index == DescriptorAllocator::Invalid) {
+            throw std::runtime_error("Descriptor heap is full");
+        }
+        return (*this)[index];
+    }
+
+    Descriptor allocTransient(UINT count = 1) {
+        const UINT index = allocator.allocateTransient(count);
+        if (index == DescriptorAllocator::Invalid) {
+            throw std::runtime_error("Descriptor ring is full");
+        }
+        return (*this)[index];
+    }
+
+    void free(const Descriptor &descriptor, UINT count = 1) {
+        allocator.free(index(descriptor), count);
+    }
 
-    Descriptor alloc() { 
-        return (*this)[numDescriptorAlloced++];
+    UINT index(const Descriptor &descriptor) const {
+        return static_cast<UINT>(
+            (descriptor.cpuHandle.ptr - heap->GetCPUDescriptorHandleForHeapStart().ptr) / descriptorSize
+        );
     }
 
     Descriptor operator[](UINT index) const {
-        assert(index < numDescriptor);
+        assert(index < allocator.persistentCapacity() + allocator.transientCapacity());
         return {
             D3D12_CPU_DESCRIPTOR_HANDLE{heap->GetCPUDescriptorHandleForHeapStart().ptr + index * descriptorSize},
-            D3D12_GPU_DESCRIPTOR_HANDLE{heap->GetGPUDescriptorHandleForHeapStart().ptr + index * descriptorSize}
+            D3D12_GPU_DESCRIPTOR_HANDLE{
+                shaderVisible ? heap->GetGPUDescriptorHandleForHeapStart().ptr + index * descriptorSize : 0
+            }
         };
     }
 };
 
-struct DescriptorHeapMark {
-    DescriptorHeapMark(DescriptorHeap &heap) 
-        : heap(heap), mark(heap.numDescriptorAlloced) { }
-
-    ~DescriptorHeapMark() { 
-        heap.numDescriptorAlloced = mark;
-    }
-
-    DescriptorHeap &heap;
-    UINT mark;
-};
-
 struct Texture {
     ComPtr<ID3D12Resource> texture;
     Descriptor srv;
+    // cpu only copy of a persistent srv, the source when srvs get copied into tables
+    Descriptor stagingSrv;
+    // transient, only valid for the dispatch it was created for
     Descriptor uav;
     UINT width, height, levels;
+    // placed memory of the texture
+    uint32_t allocation = HeapAllocator::Invalid;
 };
 
 struct SwapChainBuffer {
@@ -57,6 +82,7 @@ struct SwapChainBuffer {
 struct DepthStentilBuffer {
     ComPtr<ID3D12Resource> buffer;
     Descriptor dsv;
+    uint32_t allocation = HeapAllocator::Invalid;
 };
 
 struct FrameBuffer {
@@ -82,30 +108,33 @@ struct UploadBuffer {
     UINT size;
 };
 
-struct ConstantBuffer {
-    UploadBuffer buffer;
-    Descriptor cbv;
-
-    template <typename T> 
-    T* as() const { 
-        return reinterpret_cast<T*>(buffer.cpuAddress); 
-    }
-};
-
 struct TransformCB {
     glm::mat4 viewProj;
     glm::mat4 skyboxProj;
+    // x is the number of probes, the stride between the planes of the probe volume
+    glm::uvec4 probeVolume;
 };
 
-const int NumLights = 1;
-
+// the lights themselves go to structured buffers with their cluster lists, see LightClusters
 struct ShadingCB {
-    struct {
-        glm::vec4 position;
-        glm::vec4 radiance;
-    } lights[NumLights];
-
     glm::vec4 cameraPos;
+    glm::vec4 cameraForward;
+    // TilesX / width, TilesY / height, slice scale and bias
+    glm::vec4 clusterScale;
+};
+
+// per instance transforms of the pbr pass, the normal matrix is the inverse transpose of world. the probes are the
+// ProbeVolume::Lookup of the instance's center, all weights 0 without a probe volume
+struct InstanceData {
+    glm::mat4 world;
+    glm::mat4 normalMatrix;
+    glm::uvec4 probeIndices[2];
+    glm::vec4 probeWeights[2];
+};
+
+struct Pipeline {
+    ComPtr<ID3D12PipelineState> state;
+    ComPtr<ID3D12RootSignature> rootSignature;
 };
 
 struct MeshBuffer {
@@ -115,4 +144,19 @@ struct MeshBuffer {
     D3D12_INDEX_BUFFER_VIEW ibv;
     UINT numVertices;
     UINT numIndices;
+    uint32_t vertexAllocation = HeapAllocator::Invalid;
+    uint32_t indexAllocation = HeapAllocator::Invalid;
+};
+
+// everything one draw binds beyond the per frame resources of its root signature
+struct DrawPacket {
+    ID3D12PipelineState *pipeline = nullptr;
+    ID3D12RootSignature *rootSignature = nullptr;
+    // descriptor table of the material and the root parameter it goes to
+    UINT materialParameter = 0;
+    D3D12_GPU_DESCRIPTOR_HANDLE material{0};
+    const MeshBuffer *mesh = nullptr;
+    // instance transforms for root parameter 6 of the pbr signature, 0 without
+    D3D12_GPU_VIRTUAL_ADDRESS instances = 0;
+    UINT numInstances = 1;
 };
\ No newline at end of file
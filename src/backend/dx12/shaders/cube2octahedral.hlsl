@@ -0,0 +1,28 @@
+#include "octahedral.hlsli"
+
+// one level of a cube map into the same level of an octahedral map, the view of the cube holds only that level
+TextureCube inputTexture : register(t0);
+RWTexture2D<float4> outputTexture : register(u0);
+
+SamplerState defaultSampler : register(s0);
+
+[numthreads(8, 8, 1)]
+void main(uint2 ThreadID : SV_DispatchThreadID)
+{
+    uint width, height;
+    outputTexture.GetDimensions(width, height);
+    if (ThreadID.x >= width || ThreadID.y >= height)
+        return;
+
+    // border texels take the direction of the interior texel mirrored across the edge, like OctahedralMap::fillBorders
+    int n = int(width - 2.0 * OctahedralBorder);
+    int2 p = int2(ThreadID) - int(OctahedralBorder);
+    if (p.x < 0) { p.x = -1 - p.x; p.y = n - 1 - p.y; }
+    if (p.x >= n) { p.x = 2 * n - 1 - p.x; p.y = n - 1 - p.y; }
+    if (p.y < 0) { p.y = -1 - p.y; p.x = n - 1 - p.x; }
+    if (p.y >= n) { p.y = 2 * n - 1 - p.y; p.x = n - 1 - p.x; }
+    p = clamp(p, 0, n - 1);
+
+    float2 uv = (p + 0.5) / n;
+    outputTexture[ThreadID] = inputTexture.SampleLevel(defaultSampler, OctDecode(uv), 0);
+}
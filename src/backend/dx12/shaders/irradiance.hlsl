@@ -1,5 +1,5 @@
-static const float PI = 3.1415926;
-static const float TwoPI = 2 * PI;
+#include "sampling.hlsli"
+
 static const uint NumSamples = 64 * 1024;
 
 TextureCube envTexture : register(t0);
@@ -7,22 +7,6 @@ RWTexture2DArray<float4> irradianceTexture : register(u0);
 
 SamplerState defaultSampler : register(s0);
 
-
-float RadicalInverse_VdC(uint bits)
-{
-    bits = (bits << 16u) | (bits >> 16u);
-    bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
-    bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
-    bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
-    bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
-    return float(bits) * 2.3283064365386963e-10; // / 0x100000000
-}
-
-float2 Hammersley(uint i, uint N)
-{
-    return float2(float(i) / float(N), RadicalInverse_VdC(i));
-}
-
 float3 SampleHemisphere(float2 uv)
 {
     float p = sqrt(max(0.0, 1.0 - uv.x * uv.x));
@@ -50,16 +34,6 @@ float3 GetSamplingVector(uint3 threadID)
     return normalize(dir);
 }
 
-float3x3 GetTBN(float3 N)
-{    
-    float3 up = abs(N.z) < 0.999 ? float3(0.0, 0.0, 1.0) : float3(1.0, 0.0, 0.0);
-    
-    float3 T = normalize(cross(up, N));
-    float3 B = normalize(cross(N, T));
-    
-    return float3x3(T, B, N);
-}
-
 [numthreads(32, 32, 1)]
 void main(uint3 threadID : SV_DispatchThreadID)
 {
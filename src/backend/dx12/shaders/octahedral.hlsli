@@ -0,0 +1,48 @@
+// octahedral environment lookup, matches src/common/OctahedralMap.h (y up, one texel border per mip level)
+static const float OctahedralBorder = 1.0;
+
+float2 OctSignNotZero(float2 v)
+{
+    return float2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);
+}
+
+float2 OctEncode(float3 dir)
+{
+    float3 n = dir / (abs(dir.x) + abs(dir.y) + abs(dir.z));
+    float2 p = n.xz;
+    if (n.y < 0.0)
+        p = (1.0 - abs(p.yx)) * OctSignNotZero(p);
+    return p * 0.5 + 0.5;
+}
+
+float3 OctDecode(float2 uv)
+{
+    float2 p = uv * 2.0 - 1.0;
+    float3 n = float3(p.x, 1.0 - abs(p.x) - abs(p.y), p.y);
+    if (n.y < 0.0)
+        n.xz = (1.0 - abs(n.zx)) * OctSignNotZero(n.xz);
+    return normalize(n);
+}
+
+// the border makes the uv scale differ per level, so the two levels are blended by hand
+float4 SampleOctahedralLevel(Texture2D tex, SamplerState s, float2 uv, uint level)
+{
+    uint width, height, levels;
+    tex.GetDimensions(level, width, height, levels);
+    float2 texCoord = (OctahedralBorder + uv * (width - 2.0 * OctahedralBorder)) / width;
+    return tex.SampleLevel(s, texCoord, level);
+}
+
+float4 SampleOctahedral(Texture2D tex, SamplerState s, float3 dir, float lod)
+{
+    uint width, height, levels;
+    tex.GetDimensions(0, width, height, levels);
+    lod = clamp(lod, 0.0, levels - 1.0);
+
+    float2 uv = OctEncode(dir);
+    uint level = (uint)lod;
+    float4 color = SampleOctahedralLevel(tex, s, uv, level);
+    if (level + 1 < levels)
+        color = lerp(color, SampleOctahedralLevel(tex, s, uv, level + 1), lod - level);
+    return color;
+}
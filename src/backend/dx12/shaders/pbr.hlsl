@@ -1,25 +1,50 @@
 static const float PI = 3.1415926;
 static const float3 Fdielectric = 0.04;
 
-static const uint NumLights = 1;
+// cluster grid of LightClusters
+static const uint ClusterTilesX = 16;
+static const uint ClusterTilesY = 9;
+static const uint ClusterSlices = 24;
 
 cbuffer TransformCB : register(b0)
 {
     float4x4 viewProj;
     float4x4 skyboxProj;
+    // stride between the planes of probePlanes
+    uint probeCount;
 };
 
 cbuffer ShadingCB : register(b0)
 {
-    struct
-    {
-        float3 position;
-        float3 radiance;
-    } lights[NumLights];
-    
     float3 cameraPos;
+    float3 cameraForward;
+    // TilesX / width, TilesY / height, slice scale and bias
+    float4 clusterScale;
+};
+
+// ClusterLight, point lights have cosOuter below -1
+struct Light
+{
+    float3 position;
+    float  range;
+    float3 radiance;
+    float  cosInner;
+    float3 direction;
+    float  cosOuter;
 };
 
+// InstanceData, the root view starts at the first instance of the draw
+struct Instance
+{
+    float4x4 world;
+    float4x4 normalMatrix;
+    // ProbeVolume::Lookup of the instance's center
+    uint4    probeIndices[2];
+    float4   probeWeights[2];
+};
+
+StructuredBuffer<Instance> instances : register(t10);
+
 struct VertexInput
 {
     float3 position  : POSITION;
@@ -35,19 +60,39 @@ struct VertexOutput
     float4 posClip  : SV_POSITION;
     float2 texcoord : TEXCOORD;
     float3x3 tangentBasis : TBASIS;
+#ifdef PROBE_VOLUME
+    nointerpolation float4 probeSH[7] : PROBESH;
+#endif
 };
 
+#ifdef OCTAHEDRAL_ENV
+#include "octahedral.hlsli"
+Texture2D   irradianceTexture : register(t0);
+Texture2D   prefilterTexture  : register(t1);
+#else
 TextureCube irradianceTexture : register(t0);
 TextureCube prefilterTexture  : register(t1);
+#endif
 Texture2D   brdfTexture       : register(t2);
 Texture2D   albedoTexture     : register(t3);
 Texture2D   normalTexture     : register(t4);
 Texture2D   metalnessTexture  : register(t5);
 Texture2D   roughnessTexture  : register(t6);
 
+StructuredBuffer<Light> lights        : register(t7);
+// offset into lightIndices and light count per cluster
+StructuredBuffer<uint2> clusterRanges : register(t8);
+StructuredBuffer<uint>  lightIndices  : register(t9);
+
 SamplerState defaultSampler : register(s0);
 SamplerState brdfSampler    : register(s1);
 
+#ifdef PROBE_VOLUME
+#include "sh.hlsli"
+// the packed SHL2 planes of ProbeVolume, plane k of probe i at k * probeCount + i
+StructuredBuffer<float4> probePlanes : register(t11);
+#endif
+
 float DistributionGGX(float3 N, float3 H, float roughness)
 {
     float a = roughness * roughness;
@@ -88,20 +133,60 @@ float3 FresnelSchlick(float cosTheta, float3 F0)
     return F0 + (1.0 - F0) * pow(clamp(1.0 - cosTheta, 0.0, 1.0), 5.0);
 }
 
-uint MaxTextureLevels()
+// analytic fit of the split-sum BRDF, Karis "Physically Based Shading on Mobile", see BrdfLut::approximate
+float2 EnvBRDFApprox(float NdotV, float roughness)
 {
-    uint width, height, levels;
-    prefilterTexture.GetDimensions(0, width, height, levels);
-    return levels;
+    const float4 c0 = float4(-1.0, -0.0275, -0.572, 0.022);
+    const float4 c1 = float4(1.0, 0.0425, 1.04, -0.04);
+    float4 r = roughness * c0 + c1;
+    float a004 = min(r.x * r.x, exp2(-9.28 * NdotV)) * r.x + r.y;
+    return float2(-1.04, 1.04) * a004 + r.zw;
 }
 
-VertexOutput main_vs(VertexInput vin)
+uint ClusterIndex(float2 pixel, float3 posWorld)
 {
+    uint2 tile = min(uint2(pixel * clusterScale.xy), uint2(ClusterTilesX - 1, ClusterTilesY - 1));
+    float depth = max(dot(posWorld - cameraPos, cameraForward), 1e-4);
+    uint slice = uint(clamp(log(depth) * clusterScale.z + clusterScale.w, 0.0, ClusterSlices - 1));
+    return (slice * ClusterTilesY + tile.y) * ClusterTilesX + tile.x;
+}
+
+// level l of the prefiltered cube was baked for roughness l / (PREFILTER_LEVELS - 1). the octahedral copy lacks the
+// smallest levels, its lookups clamp to the last one it has
+float PrefilterLod(float roughness)
+{
+    return roughness * (PREFILTER_LEVELS - 1.0);
+}
+
+VertexOutput main_vs(VertexInput vin, uint instanceID : SV_InstanceID)
+{
+    Instance instance = instances[instanceID];
+    float4 posWorld = mul(instance.world, float4(vin.position, 1.0));
+
     VertexOutput output;
-    output.posWorld = vin.position;
-    output.posClip = mul(viewProj, float4(vin.position, 1.0));
+    output.posWorld = posWorld.xyz;
+    output.posClip = mul(viewProj, posWorld);
     output.texcoord = float2(vin.texcoord.x, 1.0 - vin.texcoord.y);
-    output.tangentBasis = float3x3(vin.tangent, vin.bitangent, vin.normal);
+    output.tangentBasis = float3x3(
+        normalize(mul((float3x3)instance.world, vin.tangent)),
+        normalize(mul((float3x3)instance.world, vin.bitangent)),
+        normalize(mul((float3x3)instance.normalMatrix, vin.normal))
+    );
+#ifdef PROBE_VOLUME
+    // the blend ProbeVolume::sample does, once per instance
+    [unroll]
+    for (uint k = 0; k < 7; k++)
+    {
+        float4 sh = 0.0;
+        [unroll]
+        for (uint c = 0; c < 8; c++)
+        {
+            uint probe = instance.probeIndices[c / 4][c % 4];
+            sh += probePlanes[k * probeCount + probe] * instance.probeWeights[c / 4][c % 4];
+        }
+        output.probeSH[k] = sh;
+    }
+#endif
     return output;
 }
 
@@ -118,14 +203,20 @@ float4 main_ps(VertexOutput pin) : SV_Target
     float3 F0 = lerp(Fdielectric, albedo, metalness);
     
     float3 Lo = 0.0;
-    for (uint i = 0; i < NumLights; i++)
+    uint2 range = clusterRanges[ClusterIndex(pin.posClip.xy, pin.posWorld)];
+    for (uint i = 0; i < range.y; i++)
     {
-        float3 L = normalize(lights[i].position - pin.posWorld);
+        Light light = lights[lightIndices[range.x + i]];
+        float3 toLight = light.position - pin.posWorld;
+        float distanceSq = dot(toLight, toLight);
+        float3 L = toLight * rsqrt(max(distanceSq, 1e-8));
         float3 H = normalize(V + L);
-        
-        float distance = length(L);
-        float attenuation = 1.0 / (distance * distance);
-        float3 radiance = lights[i].radiance * attenuation;
+
+        // inverse square falloff windowed to zero at the range, Karis "Real Shading in Unreal Engine 4"
+        float window = saturate(1.0 - pow(distanceSq / (light.range * light.range), 2.0));
+        float attenuation = window * window / max(distanceSq, 1e-4);
+        float spot = saturate((dot(-L, light.direction) - light.cosOuter) / max(light.cosInner - light.cosOuter, 1e-4));
+        float3 radiance = light.radiance * attenuation * spot * spot;
 
         float  D = DistributionGGX(N, H, roughness);
         float  G = GeometrySmith(N, V, L, roughness);
@@ -144,11 +235,23 @@ float4 main_ps(VertexOutput pin) : SV_Target
     float3 F = FresnelSchlick(max(dot(N, V), 0.0), F0);
     float3 kD = lerp(float3(1.0, 1.0, 1.0) - F, float3(0.0, 0.0, 0.0), metalness);
 
+#ifdef OCTAHEDRAL_ENV
+    float3 irradiance = SampleOctahedral(irradianceTexture, defaultSampler, N, 0).rgb;
+    float3 prefilteredColor = SampleOctahedral(prefilterTexture, defaultSampler, R, PrefilterLod(roughness)).rgb;
+#else
     float3 irradiance = irradianceTexture.Sample(defaultSampler, N).rgb;
+    float3 prefilteredColor = prefilterTexture.SampleLevel(defaultSampler, R, PrefilterLod(roughness)).rgb;
+#endif
+#ifdef PROBE_VOLUME
+    irradiance = EvalSHIrradiance(pin.probeSH, N);
+#endif
     float3 diffuse = irradiance * albedo;
 
-    float3 prefilteredColor = prefilterTexture.SampleLevel(defaultSampler, R, roughness * MaxTextureLevels()).rgb;
+#ifdef BRDF_APPROX
+    float2 brdf = EnvBRDFApprox(max(dot(N, V), 0.0), roughness);
+#else
     float2 brdf = brdfTexture.Sample(brdfSampler, float2(max(dot(N, V), 0.0), roughness)).rg;
+#endif
     float3 specular = prefilteredColor * (F * brdf.x + brdf.y);
 
     float3 ambient = kD * diffuse + specular;
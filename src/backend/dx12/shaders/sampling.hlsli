@@ -0,0 +1,39 @@
+// low discrepancy and GGX sampling shared by the bakers, mirrored on the cpu by src/common/Sampling.h
+static const float PI = 3.1415926;
+static const float TwoPI = 2 * PI;
+
+float RadicalInverse_VdC(uint bits)
+{
+    bits = (bits << 16u) | (bits >> 16u);
+    bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+    bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+    bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+    bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+    return float(bits) * 2.3283064365386963e-10; // / 0x100000000
+}
+
+float2 Hammersley(uint i, uint N)
+{
+    return float2(float(i) / float(N), RadicalInverse_VdC(i));
+}
+
+float3 ImportanceSampleGGX(float2 uv, float roughness)
+{
+    float alpha = roughness * roughness;
+
+    float cosTheta = sqrt((1.0 - uv.y) / (1.0 + (alpha * alpha - 1.0) * uv.y));
+    float sinTheta = sqrt(1.0 - cosTheta * cosTheta);
+    float phi = TwoPI * uv.x;
+
+    return float3(sinTheta * cos(phi), sinTheta * sin(phi), cosTheta);
+}
+
+float3x3 GetTBN(float3 N)
+{
+    float3 up = abs(N.z) < 0.999 ? float3(0.0, 0.0, 1.0) : float3(1.0, 0.0, 0.0);
+
+    float3 T = normalize(cross(up, N));
+    float3 B = normalize(cross(N, T));
+
+    return float3x3(T, B, N);
+}
@@ -0,0 +1,28 @@
+// band 2 spherical harmonics irradiance, matches SHL2 in src/common/SphericalHarmonics.h.
+// 9 rgb coefficients packed into 7 float4s, coefficient i channel c is component 3 * i + c
+float3 SHCoefficient(float4 sh[7], uint i)
+{
+    float3 c;
+    [unroll]
+    for (uint k = 0; k < 3; k++)
+    {
+        uint index = 3 * i + k;
+        c[k] = sh[index / 4][index % 4];
+    }
+    return c;
+}
+
+// cosine convolved radiance over PI, the same quantity as the irradiance cube map
+float3 EvalSHIrradiance(float4 sh[7], float3 n)
+{
+    float3 result = SHCoefficient(sh, 0) * 0.282095;
+    result += (2.0 / 3.0) * 0.488603 * (SHCoefficient(sh, 1) * n.y +
+                                        SHCoefficient(sh, 2) * n.z +
+                                        SHCoefficient(sh, 3) * n.x);
+    result += 0.25 * (SHCoefficient(sh, 4) * 1.092548 * n.x * n.y +
+                      SHCoefficient(sh, 5) * 1.092548 * n.y * n.z +
+                      SHCoefficient(sh, 6) * 0.315392 * (3.0 * n.z * n.z - 1.0) +
+                      SHCoefficient(sh, 7) * 1.092548 * n.x * n.z +
+                      SHCoefficient(sh, 8) * 0.546274 * (n.x * n.x - n.y * n.y));
+    return max(result, 0.0);
+}
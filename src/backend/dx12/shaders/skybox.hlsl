@@ -1,4 +1,9 @@
+#ifdef OCTAHEDRAL_ENV
+#include "octahedral.hlsli"
+Texture2D envTexture : register(t0);
+#else
 TextureCube envTexture : register(t0);
+#endif
 SamplerState defaultSampler : register(s0);
 
 cbuffer TransformCB : register(b0)
@@ -24,5 +29,9 @@ VertexOutput main_vs(float3 position : POSITION)
 float4 main_ps(VertexOutput pin) : SV_Target
 {
     float3 sampleVector = normalize(pin.posWorld);
+#ifdef OCTAHEDRAL_ENV
+    return SampleOctahedral(envTexture, defaultSampler, sampleVector, 0);
+#else
     return envTexture.SampleLevel(defaultSampler, sampleVector, 0);
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,407 @@
+#include <algorithm>
+#include <cmath>
+#include <emmintrin.h>
+
+#include "Rasterizer.h"
+#include "src/common/Parallel.h"
+
+namespace {
+    // 28.4 fixed point screen coordinates
+    const int32_t SubPixelBits = 4;
+    const int32_t SubPixel = 1 << SubPixelBits;
+    const int32_t HalfPixel = SubPixel / 2;
+
+    // screen coordinates stay below this many pixels, so edge functions of partly covered blocks fit in 32 bits
+    const float MaxScreenExtent = 16000.0f;
+
+    const uint32_t MaxClipVertices = 8;
+    const uint32_t MinChunkSize = 4096;
+    const uint32_t MaxChunks = 255;
+
+    struct ClipVertex {
+        glm::vec4 position;
+        glm::vec3 source;
+    };
+
+    // sutherland-hodgman against dot(plane, position) >= 0
+    uint32_t clipPolygon(const ClipVertex *in, uint32_t count, const glm::vec4 &plane, ClipVertex *out) {
+        uint32_t numOut = 0;
+        for (uint32_t i = 0; i < count; ++i) {
+            const ClipVertex &a = in[i];
+            const ClipVertex &b = in[(i + 1) % count];
+            float da = glm::dot(plane, a.position);
+            float db = glm::dot(plane, b.position);
+            if (da >= 0.0f) {
+                out[numOut++] = a;
+            }
+            if ((da >= 0.0f) != (db >= 0.0f)) {
+                float t = da / (da - db);
+                out[numOut++] = {glm::mix(a.position, b.position, t), glm::mix(a.source, b.source, t)};
+            }
+        }
+        return numOut;
+    }
+
+    __m128 laneMask(int bits) {
+        return _mm_castsi128_ps(_mm_set_epi32(bits & 8 ? -1 : 0, bits & 4 ? -1 : 0, bits & 2 ? -1 : 0, bits & 1 ? -1 : 0));
+    }
+
+    float maxOf(const float *values, uint32_t count) {
+        __m128 m = _mm_loadu_ps(values);
+        for (uint32_t i = 4; i < count; i += 4) {
+            m = _mm_max_ps(m, _mm_loadu_ps(values + i));
+        }
+        m = _mm_max_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 0, 3, 2)));
+        m = _mm_max_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_cvtss_f32(m);
+    }
+
+    void accumulate(Rasterizer::Stats &total, const Rasterizer::Stats &stats) {
+        total.triangles += stats.triangles;
+        total.culled += stats.culled;
+        total.clipped += stats.clipped;
+        total.binned += stats.binned;
+        total.tilesRejected += stats.tilesRejected;
+        total.blocksRejected += stats.blocksRejected;
+        total.blocksRasterized += stats.blocksRasterized;
+    }
+}
+
+void Rasterizer::resize(uint32_t width, uint32_t height) {
+    mWidth = width;
+    mHeight = height;
+    mTilesX = (width + TileSize - 1) / TileSize;
+    mTilesY = (height + TileSize - 1) / TileSize;
+    mGuardBand = 2.0f * MaxScreenExtent / std::max(width, height) - 1.0f;
+
+    mDepth.assign(static_cast<size_t>(numTiles()) * TileSize * TileSize, 1.0f);
+    mIds.assign(mDepth.size(), uint32_t{NoTriangle});
+    mBlockMaxZ.assign(static_cast<size_t>(numTiles()) * (TileSize / BlockSize) * (TileSize / BlockSize), 1.0f);
+    mTileMaxZ.assign(numTiles(), 1.0f);
+    mTileStats.resize(numTiles());
+}
+
+void Rasterizer::draw(const glm::vec4 *positions, const uint32_t *indices, size_t numIndices) {
+    const uint32_t numPrimitives = static_cast<uint32_t>(numIndices / 3);
+    const uint32_t chunkSize = std::max(MinChunkSize, (numPrimitives + MaxChunks - 1) / MaxChunks);
+    const uint32_t numChunks = (numPrimitives + chunkSize - 1) / chunkSize;
+
+    // bins keep their capacity between frames
+    mChunks.resize(numChunks);
+    mChunkStats.assign(numChunks, Stats{});
+    parallelFor(0, numChunks, [&](uint32_t chunk) {
+        uint32_t first = chunk * chunkSize;
+        uint32_t last = std::min(first + chunkSize, numPrimitives);
+        setupChunk(chunk, positions, indices, first, last, mChunkStats[chunk]);
+    });
+
+    // chunks are walked in order inside every tile, so equal depths resolve in submission order
+    std::fill(mTileStats.begin(), mTileStats.end(), Stats{});
+    parallelFor(0, numTiles(), [&](uint32_t tile) { rasterizeTile(tile, mTileStats[tile]); });
+
+    mStats = Stats{};
+    for (const Stats &stats : mChunkStats) {
+        accumulate(mStats, stats);
+    }
+    for (const Stats &stats : mTileStats) {
+        accumulate(mStats, stats);
+    }
+}
+
+glm::vec3 Rasterizer::barycentrics(uint32_t triangle, float px, float py) const {
+    const Triangle &tri = setup(triangle);
+    glm::vec3 weights;
+    for (int k = 0; k < 3; ++k) {
+        // edge k runs from vertex k to k + 1 and weights the vertex opposite to it
+        weights[(k + 2) % 3] = tri.fa[k] * px + tri.fb[k] * py + tri.fc[k];
+    }
+    weights *= tri.invW;
+    weights /= weights.x + weights.y + weights.z;
+    return tri.source[0] * weights.x + tri.source[1] * weights.y + tri.source[2] * weights.z;
+}
+
+void Rasterizer::setupChunk(uint32_t chunkIndex, const glm::vec4 *positions, const uint32_t *indices, uint32_t first,
+                            uint32_t last, Stats &stats) {
+    Chunk &chunk = mChunks[chunkIndex];
+    chunk.triangles.clear();
+    chunk.bins.resize(numTiles());
+    for (std::vector<uint32_t> &bin : chunk.bins) {
+        bin.clear();
+    }
+
+    const float g = mGuardBand;
+    const glm::vec4 planes[5] = {{0, 0, 1, 1}, {-1, 0, 0, g}, {1, 0, 0, g}, {0, -1, 0, g}, {0, 1, 0, g}};
+
+    for (uint32_t primitive = first; primitive < last; ++primitive) {
+        ++stats.triangles;
+        const glm::vec4 clip[3] = {
+            positions[indices[3 * primitive + 0]], positions[indices[3 * primitive + 1]],
+            positions[indices[3 * primitive + 2]]
+        };
+        const glm::vec3 source[3] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+
+        uint32_t outsideAll = 0x1f, outsideAny = 0;
+        for (const glm::vec4 &p : clip) {
+            uint32_t outcode = 0;
+            for (uint32_t i = 0; i < 5; ++i) {
+                outcode |= glm::dot(planes[i], p) < 0.0f ? 1u << i : 0u;
+            }
+            outsideAll &= outcode;
+            outsideAny |= outcode;
+        }
+        if (outsideAll) {
+            ++stats.culled;
+            continue;
+        }
+        if (!outsideAny) {
+            addTriangle(chunk, primitive, clip, source, stats);
+            continue;
+        }
+
+        ++stats.clipped;
+        ClipVertex polygon[2][MaxClipVertices];
+        uint32_t count = 3;
+        for (uint32_t i = 0; i < 3; ++i) {
+            polygon[0][i] = {clip[i], source[i]};
+        }
+        uint32_t current = 0;
+        for (uint32_t i = 0; i < 5 && count >= 3; ++i) {
+            if (outsideAny & (1u << i)) {
+                count = clipPolygon(polygon[current], count, planes[i], polygon[current ^ 1]);
+                current ^= 1;
+            }
+        }
+        for (uint32_t i = 1; i + 1 < count; ++i) {
+            const ClipVertex &v0 = polygon[current][0];
+            const ClipVertex &v1 = polygon[current][i];
+            const ClipVertex &v2 = polygon[current][i + 1];
+            addTriangle(chunk, primitive, {v0.position, v1.position, v2.position}, {v0.source, v1.source, v2.source},
+                        stats);
+        }
+    }
+}
+
+void Rasterizer::addTriangle(Chunk &chunk, uint32_t primitive, const glm::vec4 (&clip)[3], const glm::vec3 (&source)[3],
+                             Stats &stats) {
+    Triangle tri;
+    tri.primitive = primitive;
+
+    int64_t x[3], y[3];
+    float z[3];
+    for (int i = 0; i < 3; ++i) {
+        float invW = 1.0f / clip[i].w;
+        float sx = (clip[i].x * invW * 0.5f + 0.5f) * mWidth;
+        float sy = (0.5f - clip[i].y * invW * 0.5f) * mHeight;
+        x[i] = static_cast<int64_t>(std::lround(sx * SubPixel));
+        y[i] = static_cast<int64_t>(std::lround(sy * SubPixel));
+        z[i] = clip[i].z * invW;
+        tri.invW[i] = invW;
+        tri.source[i] = source[i];
+    }
+
+    // counter clockwise on screen has a negative area with y down, swap to make front faces positive
+    int64_t area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+    if (area >= 0) {
+        ++stats.culled;
+        return;
+    }
+    std::swap(x[1], x[2]);
+    std::swap(y[1], y[2]);
+    std::swap(z[1], z[2]);
+    std::swap(tri.invW[1], tri.invW[2]);
+    std::swap(tri.source[1], tri.source[2]);
+    area = -area;
+
+    // pixels whose centers lie inside the bounding box
+    int64_t minX = std::min({x[0], x[1], x[2]}), maxX = std::max({x[0], x[1], x[2]});
+    int64_t minY = std::min({y[0], y[1], y[2]}), maxY = std::max({y[0], y[1], y[2]});
+    tri.minX = static_cast<int32_t>(std::max<int64_t>((minX - HalfPixel + SubPixel - 1) >> SubPixelBits, 0));
+    tri.minY = static_cast<int32_t>(std::max<int64_t>((minY - HalfPixel + SubPixel - 1) >> SubPixelBits, 0));
+    tri.maxX = static_cast<int32_t>(std::min<int64_t>((maxX - HalfPixel) >> SubPixelBits, mWidth - 1));
+    tri.maxY = static_cast<int32_t>(std::min<int64_t>((maxY - HalfPixel) >> SubPixelBits, mHeight - 1));
+    if (tri.minX > tri.maxX || tri.minY > tri.maxY) {
+        ++stats.culled;
+        return;
+    }
+
+    const float fixedArea = static_cast<float>(area) / (SubPixel * SubPixel);
+    for (int k = 0; k < 3; ++k) {
+        int k1 = (k + 1) % 3;
+        int64_t a = -(y[k1] - y[k]);
+        int64_t b = x[k1] - x[k];
+        int64_t c = (y[k1] - y[k]) * x[k] - (x[k1] - x[k]) * y[k];
+
+        tri.fa[k] = static_cast<float>(a) / SubPixel;
+        tri.fb[k] = static_cast<float>(b) / SubPixel;
+        tri.fc[k] = static_cast<float>(c) / (SubPixel * SubPixel);
+
+        // top-left fill rule: pixels exactly on other edges belong to the neighbouring triangle
+        bool topLeft = a > 0 || (a == 0 && b > 0);
+        tri.a[k] = static_cast<int32_t>(a);
+        tri.b[k] = static_cast<int32_t>(b);
+        tri.c[k] = topLeft ? c : c - 1;
+    }
+
+    // z = z0 + l1 * (z1 - z0) + l2 * (z2 - z0), l1 comes from edge 2 and l2 from edge 0
+    float dz1 = (z[1] - z[0]) / fixedArea, dz2 = (z[2] - z[0]) / fixedArea;
+    tri.za = dz1 * tri.fa[2] + dz2 * tri.fa[0];
+    tri.zb = dz1 * tri.fb[2] + dz2 * tri.fb[0];
+    tri.zc = z[0] + dz1 * tri.fc[2] + dz2 * tri.fc[0];
+    tri.minZ = std::min({z[0], z[1], z[2]});
+
+    uint32_t local = static_cast<uint32_t>(chunk.triangles.size());
+    chunk.triangles.push_back(tri);
+    for (uint32_t ty = tri.minY / TileSize; ty <= tri.maxY / TileSize; ++ty) {
+        for (uint32_t tx = tri.minX / TileSize; tx <= tri.maxX / TileSize; ++tx) {
+            chunk.bins[ty * mTilesX + tx].push_back(local);
+            ++stats.binned;
+        }
+    }
+}
+
+void Rasterizer::rasterizeTile(uint32_t tile, Stats &stats) {
+    const uint32_t tileX0 = (tile % mTilesX) * TileSize;
+    const uint32_t tileY0 = (tile / mTilesX) * TileSize;
+    float *depth = mDepth.data() + static_cast<size_t>(tile) * TileSize * TileSize;
+    uint32_t *ids = mIds.data() + static_cast<size_t>(tile) * TileSize * TileSize;
+
+    // pixels past the screen edge get the nearest depth so they never hold up a block's max depth
+    for (uint32_t y = 0; y < TileSize; ++y) {
+        for (uint32_t x = 0; x < TileSize; ++x) {
+            bool onScreen = tileX0 + x < mWidth && tileY0 + y < mHeight;
+            depth[y * TileSize + x] = onScreen ? 1.0f : -1.0f;
+            ids[y * TileSize + x] = NoTriangle;
+        }
+    }
+    const uint32_t blocksPerTile = (TileSize / BlockSize) * (TileSize / BlockSize);
+    float *blockMaxZ = mBlockMaxZ.data() + static_cast<size_t>(tile) * blocksPerTile;
+    for (uint32_t block = 0; block < blocksPerTile; ++block) {
+        uint32_t bx = tileX0 + (block % (TileSize / BlockSize)) * BlockSize;
+        uint32_t by = tileY0 + (block / (TileSize / BlockSize)) * BlockSize;
+        blockMaxZ[block] = bx < mWidth && by < mHeight ? 1.0f : -1.0f;
+    }
+    mTileMaxZ[tile] = 1.0f;
+
+    for (uint32_t chunk = 0; chunk < mChunks.size(); ++chunk) {
+        for (uint32_t local : mChunks[chunk].bins[tile]) {
+            rasterizeTriangle(tile, mChunks[chunk].triangles[local], (chunk << ChunkShift) | local, stats);
+        }
+    }
+}
+
+void Rasterizer::rasterizeTriangle(uint32_t tile, const Triangle &tri, uint32_t id, Stats &stats) {
+    const int32_t tileX0 = static_cast<int32_t>((tile % mTilesX) * TileSize);
+    const int32_t tileY0 = static_cast<int32_t>((tile / mTilesX) * TileSize);
+    const int32_t x0 = std::max(tri.minX, tileX0), x1 = std::min(tri.maxX, tileX0 + int32_t(TileSize) - 1);
+    const int32_t y0 = std::max(tri.minY, tileY0), y1 = std::min(tri.maxY, tileY0 + int32_t(TileSize) - 1);
+
+    // depth test is less, a triangle entirely behind everything in the tile cannot pass anywhere
+    if (tri.minZ >= mTileMaxZ[tile]) {
+        ++stats.tilesRejected;
+        return;
+    }
+
+    const uint32_t blocksPerRow = TileSize / BlockSize;
+    float *depth = mDepth.data() + static_cast<size_t>(tile) * TileSize * TileSize;
+    uint32_t *ids = mIds.data() + static_cast<size_t>(tile) * TileSize * TileSize;
+    float *blockMaxZ = mBlockMaxZ.data() + static_cast<size_t>(tile) * blocksPerRow * blocksPerRow;
+
+    const __m128 zStep = _mm_set_ps(3.0f * tri.za, 2.0f * tri.za, tri.za, 0.0f);
+    const __m128i idVector = _mm_set1_epi32(static_cast<int>(id));
+    bool tileWritten = false;
+
+    for (int32_t by = (y0 - tileY0) / int32_t(BlockSize); by <= (y1 - tileY0) / int32_t(BlockSize); ++by) {
+        for (int32_t bx = (x0 - tileX0) / int32_t(BlockSize); bx <= (x1 - tileX0) / int32_t(BlockSize); ++bx) {
+            const uint32_t block = by * blocksPerRow + bx;
+            if (tri.minZ >= blockMaxZ[block]) {
+                ++stats.blocksRejected;
+                continue;
+            }
+
+            // classify the block against every edge from the pixel centers at its corners
+            const int32_t blockX = tileX0 + bx * int32_t(BlockSize), blockY = tileY0 + by * int32_t(BlockSize);
+            const int64_t cornerX = int64_t(blockX) * SubPixel + HalfPixel;
+            const int64_t cornerY = int64_t(blockY) * SubPixel + HalfPixel;
+            const int64_t span = int64_t(BlockSize - 1) * SubPixel;
+            int partial[3];
+            int numPartial = 0;
+            bool outside = false;
+            for (int k = 0; k < 3; ++k) {
+                int64_t e00 = tri.a[k] * cornerX + tri.b[k] * cornerY + tri.c[k];
+                int64_t e10 = e00 + tri.a[k] * span;
+                int64_t e01 = e00 + tri.b[k] * span;
+                int64_t e11 = e10 + tri.b[k] * span;
+                if (std::max({e00, e10, e01, e11}) < 0) {
+                    outside = true;
+                    break;
+                }
+                if (std::min({e00, e10, e01, e11}) < 0) {
+                    partial[numPartial++] = k;
+                }
+            }
+            if (outside) {
+                continue;
+            }
+            ++stats.blocksRasterized;
+
+            const int32_t px0 = std::max(x0, blockX), px1 = std::min(x1, blockX + int32_t(BlockSize) - 1);
+            const int32_t py0 = std::max(y0, blockY), py1 = std::min(y1, blockY + int32_t(BlockSize) - 1);
+            bool blockWritten = false;
+
+            for (int32_t py = py0; py <= py1; ++py) {
+                const int64_t sampleY = int64_t(py) * SubPixel + HalfPixel;
+                for (int32_t gx = blockX; gx < blockX + int32_t(BlockSize); gx += 4) {
+                    int lo = std::max(px0, gx) - gx, hi = std::min(px1, gx + 3) - gx;
+                    if (lo > hi) {
+                        continue;
+                    }
+                    int mask = ((1 << (hi + 1)) - 1) & ~((1 << lo) - 1);
+
+                    // a lane is inside when no partial edge function is negative
+                    __m128i signs = _mm_setzero_si128();
+                    const int64_t sampleX = int64_t(gx) * SubPixel + HalfPixel;
+                    for (int i = 0; i < numPartial; ++i) {
+                        int k = partial[i];
+                        int32_t e = static_cast<int32_t>(tri.a[k] * sampleX + tri.b[k] * sampleY + tri.c[k]);
+                        int32_t step = tri.a[k] * SubPixel;
+                        __m128i edge = _mm_add_epi32(_mm_set1_epi32(e), _mm_set_epi32(3 * step, 2 * step, step, 0));
+                        signs = _mm_or_si128(signs, edge);
+                    }
+                    mask &= ~_mm_movemask_ps(_mm_castsi128_ps(signs));
+                    if (!mask) {
+                        continue;
+                    }
+
+                    float *d = depth + (py - tileY0) * TileSize + (gx - tileX0);
+                    uint32_t *id32 = ids + (py - tileY0) * TileSize + (gx - tileX0);
+                    __m128 z = _mm_add_ps(_mm_set1_ps(tri.za * (gx + 0.5f) + tri.zb * (py + 0.5f) + tri.zc), zStep);
+                    __m128 oldZ = _mm_loadu_ps(d);
+                    mask &= _mm_movemask_ps(_mm_cmplt_ps(z, oldZ));
+                    if (!mask) {
+                        continue;
+                    }
+
+                    __m128 write = laneMask(mask);
+                    _mm_storeu_ps(d, _mm_or_ps(_mm_and_ps(write, z), _mm_andnot_ps(write, oldZ)));
+                    __m128 oldIds = _mm_loadu_ps(reinterpret_cast<const float *>(id32));
+                    __m128 newIds = _mm_or_ps(_mm_and_ps(write, _mm_castsi128_ps(idVector)), _mm_andnot_ps(write, oldIds));
+                    _mm_storeu_ps(reinterpret_cast<float *>(id32), newIds);
+                    blockWritten = true;
+                }
+            }
+
+            if (blockWritten) {
+                float rowMax[BlockSize];
+                for (uint32_t row = 0; row < BlockSize; ++row) {
+                    rowMax[row] = maxOf(depth + (by * BlockSize + row) * TileSize + bx * BlockSize, BlockSize);
+                }
+                blockMaxZ[block] = maxOf(rowMax, BlockSize);
+                tileWritten = true;
+            }
+        }
+    }
+
+    if (tileWritten) {
+        mTileMaxZ[tile] = maxOf(blockMaxZ, blocksPerRow * blocksPerRow);
+    }
+}
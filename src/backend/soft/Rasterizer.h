@@ -0,0 +1,113 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <glm.hpp>
+
+// tile binned triangle rasterizer writing a visibility buffer (depth + triangle id per pixel).
+// triangles are clipped, set up and binned into screen tiles in parallel chunks, then every tile is rasterized by one
+// thread with SSE edge functions in 28.4 fixed point. per tile and per 8x8 block max depths reject occluded triangles
+// and blocks before any pixel is touched. shading is left to the caller, which resolves pixels to primitives and
+// perspective correct barycentrics
+class Rasterizer {
+public:
+    static const uint32_t TileSize = 64;
+    static const uint32_t BlockSize = 8;
+    static const uint32_t NoTriangle = 0xffffffffu;
+
+    struct Stats {
+        uint64_t triangles = 0;
+        uint64_t culled = 0;
+        uint64_t clipped = 0;
+        uint64_t binned = 0;
+        uint64_t tilesRejected = 0;
+        uint64_t blocksRejected = 0;
+        uint64_t blocksRasterized = 0;
+    };
+
+    void resize(uint32_t width, uint32_t height);
+
+    // front faces are counter clockwise on screen like the dx12 pipelines, back faces are culled.
+    // positions are in clip space with the gl depth range of glm::perspective
+    void draw(const glm::vec4 *positions, const uint32_t *indices, size_t numIndices);
+
+    uint32_t width() const { return mWidth; }
+
+    uint32_t height() const { return mHeight; }
+
+    uint32_t numTilesX() const { return mTilesX; }
+
+    uint32_t numTilesY() const { return mTilesY; }
+
+    uint32_t numTiles() const { return mTilesX * mTilesY; }
+
+    const Stats &stats() const { return mStats; }
+
+    // visible triangle at a pixel after draw(), NoTriangle where nothing was drawn
+    uint32_t triangleAt(uint32_t x, uint32_t y) const { return mIds[pixelOffset(x, y)]; }
+
+    float depthAt(uint32_t x, uint32_t y) const { return mDepth[pixelOffset(x, y)]; }
+
+    // index of the input triangle (indices / 3) a visible triangle was clipped from
+    uint32_t primitive(uint32_t triangle) const { return setup(triangle).primitive; }
+
+    // perspective correct barycentrics in the input triangle at a point in pixel units, pixel centers are at + 0.5
+    glm::vec3 barycentrics(uint32_t triangle, float px, float py) const;
+
+private:
+    struct Triangle {
+        uint32_t primitive;
+        // edge functions in fixed point, e(x, y) = a * x + b * y + c with the fill rule folded into c
+        int32_t a[3], b[3];
+        int64_t c[3];
+        // the same edges in pixel units for barycentrics
+        float fa[3], fb[3], fc[3];
+        // depth plane in pixel units
+        float za, zb, zc;
+        float minZ;
+        int32_t minX, minY, maxX, maxY;
+        glm::vec3 invW;
+        // barycentrics of the clipped vertices in the input triangle
+        glm::vec3 source[3];
+    };
+
+    struct Chunk {
+        std::vector<Triangle> triangles;
+        std::vector<std::vector<uint32_t>> bins;
+    };
+
+    static const uint32_t ChunkShift = 24;
+
+    size_t pixelOffset(uint32_t x, uint32_t y) const {
+        uint32_t tile = (y / TileSize) * mTilesX + x / TileSize;
+        return static_cast<size_t>(tile) * TileSize * TileSize + (y % TileSize) * TileSize + x % TileSize;
+    }
+
+    const Triangle &setup(uint32_t triangle) const {
+        return mChunks[triangle >> ChunkShift].triangles[triangle & ((1u << ChunkShift) - 1)];
+    }
+
+    void setupChunk(uint32_t chunk, const glm::vec4 *positions, const uint32_t *indices, uint32_t first,
+                    uint32_t last, Stats &stats);
+
+    void addTriangle(Chunk &chunk, uint32_t primitive, const glm::vec4 (&clip)[3], const glm::vec3 (&source)[3],
+                     Stats &stats);
+
+    void rasterizeTile(uint32_t tile, Stats &stats);
+
+    void rasterizeTriangle(uint32_t tile, const Triangle &tri, uint32_t id, Stats &stats);
+
+    uint32_t mWidth = 0, mHeight = 0;
+    uint32_t mTilesX = 0, mTilesY = 0;
+    float mGuardBand = 1.0f;
+
+    // tiled layout, TileSize * TileSize contiguous pixels per tile so no two threads share a cache line
+    std::vector<float> mDepth;
+    std::vector<uint32_t> mIds;
+    std::vector<float> mBlockMaxZ;
+    std::vector<float> mTileMaxZ;
+
+    std::vector<Chunk> mChunks;
+    std::vector<Stats> mChunkStats, mTileStats;
+    Stats mStats;
+};
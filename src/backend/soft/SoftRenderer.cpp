@@ -0,0 +1,189 @@
+#include <cmath>
+#include <chrono>
+#include <algorithm>
+#include <glm.hpp>
+#include <gtc/matrix_transform.hpp>
+
+#include "SoftRenderer.h"
+#include "src/common/Image.h"
+#include "src/common/BrdfLut.h"
+#include "src/common/Sampling.h"
+#include "src/common/Parallel.h"
+#include "src/common/EnvBaker.h"
+
+namespace {
+    // DxRenderer bakes 1024^2 cube maps on the gpu, the cpu bake uses smaller ones to keep setup short
+    const uint32_t EnvironmentSize = 256;
+    const uint32_t IrradianceSize = 32;
+
+    // same constants as tonemap.hlsl
+    const float Gamma = 2.2f;
+    const float Exposure = 1.0f;
+    const float PureWhite = 1.0f;
+}
+
+void SoftRenderer::init(GLFWwindow* /*window*/) {
+    mCamera = Camera(glm::vec3{-100.0, 20.0, 100.0}, -12.0, -50.0, (float)mWidth / mHeight, 45.0, 0.1);
+
+    // the light of DxRenderer::setup()
+    mLights = {ClusterLight::point(glm::normalize(glm::vec3(5.0f)) * 500.0f, glm::vec3(250000.0f), 2000.0f)};
+
+    mRasterizer.resize(mWidth, mHeight);
+    mHdr.assign(static_cast<size_t>(mWidth) * mHeight, glm::vec3{0.0f});
+    mPixels.assign(static_cast<size_t>(mWidth) * mHeight, 0);
+}
+
+void SoftRenderer::setup() {
+    // environment maps, the adaptive cpu bakers stand in for the prefilter and irradiance compute passes. all of them
+    // are kept as half floats like the DXGI_FORMAT_R16G16B16A16_FLOAT cube maps of DxRenderer
+    CubeMap environment = CubeMap::fromEquirect(*Image::fromFile("assets/environment.hdr"), EnvironmentSize);
+    EnvBaker::Settings settings;
+    mEnvironment = CpuTexture::fromCubeMap(environment, TexelFormat::RGBA16F);
+    mPrefilter = CpuTexture::fromCubeMap(EnvBaker::prefilter(environment, settings), TexelFormat::RGBA16F);
+    mIrradiance = CpuTexture::fromCubeMap(EnvBaker::irradiance(environment, IrradianceSize, settings),
+                                          TexelFormat::RGBA16F);
+    mBrdfLut = BrdfLut::embedded().toTexture();
+
+    mAlbedo = CpuTexture::fromImage(*Image::fromFile("assets/textures/cerberus_A.png"), TexelFormat::RGBA8_SRGB);
+    mNormal = CpuTexture::fromImage(*Image::fromFile("assets/textures/cerberus_N.png"), TexelFormat::RGBA8);
+    mMetalness = CpuTexture::fromImage(*Image::fromFile("assets/textures/cerberus_M.png", 1), TexelFormat::R8);
+    mRoughness = CpuTexture::fromImage(*Image::fromFile("assets/textures/cerberus_R.png", 1), TexelFormat::R8);
+
+    // the skybox is drawn per pixel from the view direction, skybox.obj is not needed
+    mMesh = Mesh::fromFile("assets/meshes/cerberus.fbx");
+    mClipPositions.resize(mMesh->vertices().size());
+}
+
+void SoftRenderer::draw() {
+    auto start = std::chrono::steady_clock::now();
+
+    glm::mat4 proj = glm::perspective(glm::radians(mCamera.fov), mCamera.aspect, 1.0f, 1000.0f);
+    glm::mat4 view = mCamera.getViewMatrix();
+    glm::mat4 viewProj = proj * view;
+    glm::mat4 invSkyboxProj = glm::inverse(proj * glm::mat4(glm::mat3(view)));
+
+    const std::vector<Mesh::Vertex> &vertices = mMesh->vertices();
+    parallelForRange(0, static_cast<uint32_t>(vertices.size()), [&](uint32_t first, uint32_t last) {
+        for (uint32_t i = first; i < last; ++i) {
+            mClipPositions[i] = viewProj * glm::vec4{vertices[i].position, 1.0f};
+        }
+    }, 4096);
+
+    const std::vector<Mesh::Face> &faces = mMesh->faces();
+    mRasterizer.draw(mClipPositions.data(), &faces.data()->v1, 3 * faces.size());
+
+    PbrScene scene;
+    scene.lights = mLights.data();
+    scene.numLights = static_cast<uint32_t>(mLights.size());
+    scene.cameraPos = mCamera.position;
+    scene.irradiance = &mIrradiance;
+    scene.prefilter = &mPrefilter;
+    scene.brdfLut = &mBrdfLut;
+    parallelFor(0, mRasterizer.numTiles(), [&](uint32_t tile) { shadeTile(tile, scene, invSkyboxProj); });
+
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    mFrameTime = elapsed.count();
+}
+
+void SoftRenderer::exit() {
+    mMesh.reset();
+    mClipPositions.clear();
+}
+
+void SoftRenderer::shadeTile(uint32_t tile, const PbrScene &scene, const glm::mat4 &invSkyboxProj) {
+    const uint32_t x0 = (tile % mRasterizer.numTilesX()) * Rasterizer::TileSize;
+    const uint32_t y0 = (tile / mRasterizer.numTilesX()) * Rasterizer::TileSize;
+    const uint32_t x1 = std::min(x0 + Rasterizer::TileSize, mWidth);
+    const uint32_t y1 = std::min(y0 + Rasterizer::TileSize, mHeight);
+
+    auto writePixel = [&](size_t index, const glm::vec3 &color) {
+        mHdr[index] = color;
+        mPixels[index] = tonemap(color);
+    };
+
+    // surface pixels are shaded eight at a time
+    PbrBatch batch;
+    PbrBatchResult result;
+    size_t batchPixels[PbrBatch::Width];
+    uint32_t batchSize = 0;
+    auto flush = [&] {
+        PbrShading::shade(batch, batchSize, scene, result);
+        for (uint32_t lane = 0; lane < batchSize; ++lane) {
+            writePixel(batchPixels[lane], result.get(lane));
+        }
+        batchSize = 0;
+    };
+
+    for (uint32_t y = y0; y < y1; ++y) {
+        for (uint32_t x = x0; x < x1; ++x) {
+            float px = x + 0.5f, py = y + 0.5f;
+            size_t index = static_cast<size_t>(y) * mWidth + x;
+            uint32_t triangle = mRasterizer.triangleAt(x, y);
+
+            if (triangle == Rasterizer::NoTriangle) {
+                // skybox.hlsl samples the environment with the cube position, here the far plane point
+                glm::vec4 ndc{2.0f * px / mWidth - 1.0f, 1.0f - 2.0f * py / mHeight, 1.0f, 1.0f};
+                glm::vec4 dir = invSkyboxProj * ndc;
+                writePixel(index, glm::vec3{mEnvironment.sampleCube(glm::vec3{dir} / dir.w, 0.0f)});
+                continue;
+            }
+
+            batch.set(batchSize, surfaceAt(triangle, px, py));
+            batchPixels[batchSize++] = index;
+            if (batchSize == PbrBatch::Width) {
+                flush();
+            }
+        }
+    }
+    if (batchSize > 0) {
+        flush();
+    }
+}
+
+PbrSurface SoftRenderer::surfaceAt(uint32_t triangle, float px, float py) const {
+    const Mesh::Face &face = mMesh->faces()[mRasterizer.primitive(triangle)];
+    const Mesh::Vertex &v0 = mMesh->vertices()[face.v1];
+    const Mesh::Vertex &v1 = mMesh->vertices()[face.v2];
+    const Mesh::Vertex &v2 = mMesh->vertices()[face.v3];
+
+    auto texcoordAt = [&](float x, float y) {
+        glm::vec3 b = mRasterizer.barycentrics(triangle, x, y);
+        glm::vec2 uv = v0.texcoord * b.x + v1.texcoord * b.y + v2.texcoord * b.z;
+        return glm::vec2{uv.x, 1.0f - uv.y};
+    };
+    glm::vec3 b = mRasterizer.barycentrics(triangle, px, py);
+    glm::vec3 position = v0.position * b.x + v1.position * b.y + v2.position * b.z;
+    glm::vec2 texcoord = texcoordAt(px, py);
+
+    // texture lod from the uv of the neighbouring pixels, quad derivatives without the quads
+    glm::vec2 dx = texcoordAt(px + 1.0f, py) - texcoord;
+    glm::vec2 dy = texcoordAt(px, py + 1.0f) - texcoord;
+
+    glm::vec3 albedo = glm::vec3{mAlbedo.sample(texcoord, mAlbedo.computeLod(dx, dy))};
+    float metalness = mMetalness.sample(texcoord, mMetalness.computeLod(dx, dy)).r;
+    float roughness = mRoughness.sample(texcoord, mRoughness.computeLod(dx, dy)).r;
+    glm::vec3 normalSample = glm::vec3{mNormal.sample(texcoord, mNormal.computeLod(dx, dy))};
+
+    // mul(v, float3x3(T, B, N)) in pbr.hlsl
+    glm::mat3 tangentBasis{v0.tangent * b.x + v1.tangent * b.y + v2.tangent * b.z,
+                           v0.bitangent * b.x + v1.bitangent * b.y + v2.bitangent * b.z,
+                           v0.normal * b.x + v1.normal * b.y + v2.normal * b.z};
+    glm::vec3 N = glm::normalize(tangentBasis * (2.0f * normalSample - 1.0f));
+    return {position, N, albedo, metalness, roughness};
+}
+
+uint32_t SoftRenderer::tonemap(const glm::vec3 &hdr) {
+    glm::vec3 color = hdr * Exposure;
+
+    // Reinhard tonemapping on luminance, then gamma correction
+    float luminance = glm::dot(color, glm::vec3{0.2126f, 0.7152f, 0.0722f});
+    float mappedLuminance = (luminance * (1.0f + luminance / (PureWhite * PureWhite))) / (1.0f + luminance);
+    glm::vec3 mappedColor = luminance > 0.0f ? (mappedLuminance / luminance) * color : glm::vec3{0.0f};
+
+    uint32_t packed = 0xff000000u;
+    for (int c = 0; c < 3; ++c) {
+        float value = std::pow(glm::clamp(mappedColor[c], 0.0f, 1.0f), 1.0f / Gamma);
+        packed |= static_cast<uint32_t>(value * 255.0f + 0.5f) << (8 * c);
+    }
+    return packed;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <glm.hpp>
+
+#include "Rasterizer.h"
+#include "src/common/Mesh.h"
+#include "src/common/Camera.h"
+#include "src/common/CpuTexture.h"
+#include "src/common/PbrShading.h"
+#include "src/common/IRenderer.h"
+
+// cpu implementation of the skybox, pbr and tonemap passes of DxRenderer. it needs no window or device: frames are
+// rendered into an offscreen rgba8 buffer (plus the hdr color before tonemapping) that callers read back
+class SoftRenderer : public IRenderer {
+public:
+    SoftRenderer(uint32_t width = 1200, uint32_t height = 900) : mWidth(width), mHeight(height) {}
+    ~SoftRenderer() {}
+
+    // window may be null, frames are never presented
+    void init(GLFWwindow* window) override;
+    void setup() override;
+    void draw() override;
+    void exit() override;
+
+    uint32_t width() const { return mWidth; }
+
+    uint32_t height() const { return mHeight; }
+
+    // tonemapped rgba8, one uint32 per pixel in DXGI_FORMAT_R8G8B8A8_UNORM byte order
+    const uint32_t *pixels() const { return mPixels.data(); }
+
+    const glm::vec3 *hdr() const { return mHdr.data(); }
+
+    // wall time of the last draw() in milliseconds
+    double frameTime() const { return mFrameTime; }
+
+    const Rasterizer::Stats &stats() const { return mRasterizer.stats(); }
+
+    Camera &camera() { return mCamera; }
+
+private:
+    void shadeTile(uint32_t tile, const PbrScene &scene, const glm::mat4 &invSkyboxProj);
+
+    // material inputs of pbr.hlsl at a pixel, the texture reads and normal mapping of main_ps
+    PbrSurface surfaceAt(uint32_t triangle, float px, float py) const;
+
+    static uint32_t tonemap(const glm::vec3 &color);
+
+private:
+    uint32_t mWidth, mHeight;
+    Camera mCamera;
+    std::vector<ClusterLight> mLights;
+
+    CpuTexture mEnvironment;
+    CpuTexture mIrradiance;
+    CpuTexture mPrefilter;
+    CpuTexture mBrdfLut;
+
+    CpuTexture mAlbedo;
+    CpuTexture mNormal;
+    CpuTexture mMetalness;
+    CpuTexture mRoughness;
+
+    std::shared_ptr<Mesh> mMesh;
+    std::vector<glm::vec4> mClipPositions;
+    Rasterizer mRasterizer;
+
+    std::vector<glm::vec3> mHdr;
+    std::vector<uint32_t> mPixels;
+    double mFrameTime = 0.0;
+};
@@ -0,0 +1,251 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <stdexcept>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <glm.hpp>
+
+#include "src/common/Half.h"
+#include "src/common/Sampling.h"
+#include "src/common/Parallel.h"
+#include "src/common/CpuTexture.h"
+#include "src/common/BrdfLutData.h"
+
+// split-sum environment BRDF (scale, bias) indexed by (NdotV, roughness)
+class BrdfLut {
+public:
+    struct ErrorStats {
+        float rmse;
+        float maxError;
+    };
+
+    static const uint32_t DefaultSize = 256;
+    static const uint32_t DefaultNumSamples = 1024;
+
+    BrdfLut() : mSize(0) {}
+
+    explicit BrdfLut(uint32_t size) : mSize(size), mTexels(static_cast<size_t>(size) * size) {}
+
+    uint32_t size() const { return mSize; }
+
+    glm::vec2 *data() { return mTexels.data(); }
+
+    const glm::vec2 *data() const { return mTexels.data(); }
+
+    glm::vec2 texel(uint32_t x, uint32_t y) const { return mTexels[static_cast<size_t>(y) * mSize + x]; }
+
+    // bilinear lookup with clamp addressing, like brdfSampler in pbr.hlsl
+    glm::vec2 sample(float NdotV, float roughness) const {
+        const int size = static_cast<int>(mSize);
+        float x = glm::clamp(NdotV, 0.0f, 1.0f) * size - 0.5f;
+        float y = glm::clamp(roughness, 0.0f, 1.0f) * size - 0.5f;
+        int x0 = static_cast<int>(std::floor(x));
+        int y0 = static_cast<int>(std::floor(y));
+        float fx = x - x0;
+        float fy = y - y0;
+
+        auto fetch = [&](int px, int py) {
+            return texel(glm::clamp(px, 0, size - 1), glm::clamp(py, 0, size - 1));
+        };
+        glm::vec2 top = glm::mix(fetch(x0, y0), fetch(x0 + 1, y0), fx);
+        glm::vec2 bottom = glm::mix(fetch(x0, y0 + 1), fetch(x0 + 1, y0 + 1), fx);
+        return glm::mix(top, bottom, fy);
+    }
+
+    // one texel of the table, bake() passes its texel-corner coordinates
+    static glm::vec2 integrate(float NdotV, float roughness, uint32_t numSamples = DefaultNumSamples) {
+        NdotV = std::max(NdotV, 0.00001f);
+        const glm::vec3 V{std::sqrt(1.0f - NdotV * NdotV), 0.0f, NdotV};
+
+        float A = 0.0f;
+        float B = 0.0f;
+        for (uint32_t i = 0; i < numSamples; ++i) {
+            glm::vec3 H = importanceSampleGGX(hammersley(i, numSamples), roughness);
+            glm::vec3 L = glm::normalize(2.0f * glm::dot(V, H) * H - V);
+
+            float NdotL = std::max(L.z, 0.0f);
+            float NdotH = std::max(H.z, 0.0f);
+            float VdotH = std::max(glm::dot(V, H), 0.0f);
+
+            if (NdotL > 0.0f) {
+                float G = geometrySchlickGGX(NdotV, roughness) * geometrySchlickGGX(NdotL, roughness);
+                float G_Vis = (G * VdotH) / (NdotH * NdotV);
+                float Fc = std::pow(1.0f - VdotH, 5.0f);
+
+                A += (1.0f - Fc) * G_Vis;
+                B += Fc * G_Vis;
+            }
+        }
+        return glm::vec2{A, B} / float(numSamples);
+    }
+
+    // the whole table, one row of texels per task. BrdfLutData.h embeds it at DefaultSize and DefaultNumSamples
+    static BrdfLut bake(uint32_t size = DefaultSize, uint32_t numSamples = DefaultNumSamples) {
+        BrdfLut lut(size);
+        parallelFor(0, size, [&](uint32_t y) {
+            float roughness = float(y) / size;
+            for (uint32_t x = 0; x < size; ++x) {
+                lut.mTexels[static_cast<size_t>(y) * size + x] = integrate(float(x) / size, roughness, numSamples);
+            }
+        });
+        return lut;
+    }
+
+    // analytic fit of the split-sum BRDF (Karis, "Physically Based Shading on Mobile"), same as EnvBRDFApprox in
+    // pbr.hlsl
+    static glm::vec2 approximate(float NdotV, float roughness) {
+        const glm::vec4 c0{-1.0f, -0.0275f, -0.572f, 0.022f};
+        const glm::vec4 c1{1.0f, 0.0425f, 1.04f, -0.04f};
+        glm::vec4 r = roughness * c0 + c1;
+        float a004 = std::min(r.x * r.x, std::exp2(-9.28f * NdotV)) * r.x + r.y;
+        return glm::vec2{a004 * -1.04f, a004 * 1.04f} + glm::vec2{r.z, r.w};
+    }
+
+    // error of the analytic fit against this table, errorMap (optional) receives |fit - table| per texel
+    ErrorStats approximationError(std::vector<glm::vec2> *errorMap = nullptr) const {
+        if (errorMap) {
+            errorMap->resize(mTexels.size());
+        }
+        double sumSq = 0.0;
+        float maxError = 0.0f;
+        for (uint32_t y = 0; y < mSize; ++y) {
+            for (uint32_t x = 0; x < mSize; ++x) {
+                glm::vec2 diff = glm::abs(approximate(float(x) / mSize, float(y) / mSize) - texel(x, y));
+                if (errorMap) {
+                    (*errorMap)[static_cast<size_t>(y) * mSize + x] = diff;
+                }
+                sumSq += 0.5 * (diff.x * diff.x + diff.y * diff.y);
+                maxError = std::max(maxError, std::max(diff.x, diff.y));
+            }
+        }
+        return {static_cast<float>(std::sqrt(sumSq / mTexels.size())), maxError};
+    }
+
+    // (scale, bias) as half floats, the memory layout of a DXGI_FORMAT_R16G16_FLOAT texture
+    std::vector<uint16_t> toHalf() const {
+        std::vector<uint16_t> halfs(mTexels.size() * 2);
+        for (size_t i = 0; i < mTexels.size(); ++i) {
+            halfs[2 * i + 0] = floatToHalf(mTexels[i].x);
+            halfs[2 * i + 1] = floatToHalf(mTexels[i].y);
+        }
+        return halfs;
+    }
+
+    // (scale, bias) in red and green of a half float texture, for CpuTexture lookups with clamp addressing
+    CpuTexture toTexture() const {
+        std::vector<glm::vec4> texels(mTexels.size());
+        for (size_t i = 0; i < mTexels.size(); ++i) {
+            texels[i] = glm::vec4{mTexels[i], 0.0f, 1.0f};
+        }
+        return CpuTexture::fromTexels(mSize, mSize, texels.data(), TexelFormat::RGBA16F, 1);
+    }
+
+    static BrdfLut fromHalf(const std::vector<uint16_t> &halfs, uint32_t size) {
+        BrdfLut lut(size);
+        for (size_t i = 0; i < lut.mTexels.size(); ++i) {
+            lut.mTexels[i] = {halfToFloat(halfs[2 * i + 0]), halfToFloat(halfs[2 * i + 1])};
+        }
+        return lut;
+    }
+
+    // the table baked into the binary, ready to upload as DXGI_FORMAT_R16G16_FLOAT
+    static std::vector<uint16_t> embeddedHalf() { return decode(BrdfLutData, sizeof(BrdfLutData), BrdfLutDataSize); }
+
+    static BrdfLut embedded() { return fromHalf(embeddedHalf(), BrdfLutDataSize); }
+
+    // lossless packing of the half table: every channel is predicted from its left, upper and upper-left
+    // neighbours (a + b - c) and the residual is stored as a zigzag varint, about half the raw size
+    static std::vector<uint8_t> encode(const std::vector<uint16_t> &halfs, uint32_t size) {
+        std::vector<uint8_t> bytes;
+        bytes.reserve(halfs.size());
+        for (uint32_t y = 0; y < size; ++y) {
+            for (uint32_t x = 0; x < size; ++x) {
+                for (uint32_t c = 0; c < 2; ++c) {
+                    int32_t residual = int32_t(halfs[(static_cast<size_t>(y) * size + x) * 2 + c]) -
+                                       predict(halfs.data(), size, x, y, c);
+                    uint32_t zigzag = (static_cast<uint32_t>(residual) << 1) ^ static_cast<uint32_t>(residual >> 31);
+                    while (zigzag >= 0x80u) {
+                        bytes.push_back(static_cast<uint8_t>((zigzag & 0x7fu) | 0x80u));
+                        zigzag >>= 7;
+                    }
+                    bytes.push_back(static_cast<uint8_t>(zigzag));
+                }
+            }
+        }
+        return bytes;
+    }
+
+    static std::vector<uint16_t> decode(const uint8_t *bytes, size_t numBytes, uint32_t size) {
+        std::vector<uint16_t> halfs(static_cast<size_t>(size) * size * 2);
+        size_t offset = 0;
+        for (uint32_t y = 0; y < size; ++y) {
+            for (uint32_t x = 0; x < size; ++x) {
+                for (uint32_t c = 0; c < 2; ++c) {
+                    uint32_t zigzag = 0;
+                    for (uint32_t shift = 0;; shift += 7) {
+                        if (offset >= numBytes) {
+                            throw std::runtime_error("Truncated BRDF LUT data");
+                        }
+                        uint8_t byte = bytes[offset++];
+                        zigzag |= static_cast<uint32_t>(byte & 0x7fu) << shift;
+                        if (!(byte & 0x80u)) {
+                            break;
+                        }
+                    }
+                    int32_t residual = static_cast<int32_t>(zigzag >> 1) ^ -static_cast<int32_t>(zigzag & 1u);
+                    halfs[(static_cast<size_t>(y) * size + x) * 2 + c] =
+                        static_cast<uint16_t>(predict(halfs.data(), size, x, y, c) + residual);
+                }
+            }
+        }
+        return halfs;
+    }
+
+    // writes the table as the constant array in BrdfLutData.h
+    void writeEmbeddedHeader(const std::string &filename) const {
+        std::vector<uint8_t> bytes = encode(toHalf(), mSize);
+
+        std::ofstream file(filename);
+        if (!file) {
+            throw std::runtime_error("Failed to open file: " + filename);
+        }
+        file << "#pragma once\n\n";
+        file << "#include <cstdint>\n\n";
+        file << "// generated by `Luma --bake-brdf-lut`, do not edit. BrdfLut::encode packed R16G16_FLOAT texels\n";
+        file << "inline constexpr uint32_t BrdfLutDataSize = " << mSize << ";\n";
+        file << "inline constexpr uint8_t BrdfLutData[" << bytes.size() << "] = {";
+        for (size_t i = 0; i < bytes.size(); ++i) {
+            file << (i % 32 == 0 ? "\n    " : "") << unsigned(bytes[i]) << ",";
+        }
+        file << "\n};\n";
+    }
+
+private:
+    static int32_t predict(const uint16_t *halfs, uint32_t size, uint32_t x, uint32_t y, uint32_t c) {
+        auto at = [&](uint32_t px, uint32_t py) {
+            return int32_t(halfs[(static_cast<size_t>(py) * size + px) * 2 + c]);
+        };
+        if (x > 0 && y > 0) {
+            return at(x - 1, y) + at(x, y - 1) - at(x - 1, y - 1);
+        }
+        if (x > 0) {
+            return at(x - 1, y);
+        }
+        if (y > 0) {
+            return at(x, y - 1);
+        }
+        return 0;
+    }
+
+    static float geometrySchlickGGX(float NdotV, float roughness) {
+        float k = (roughness * roughness) / 2.0f;
+        return NdotV / (NdotV * (1.0f - k) + k);
+    }
+
+    uint32_t mSize;
+    std::vector<glm::vec2> mTexels;
+};
@@ -0,0 +1,4110 @@
+#pragma once
+
+#include <cstdint>
+
+// generated by `Luma --bake-brdf-lut`, do not edit. BrdfLut::encode packed R16G16_FLOAT texels
+inline constexpr uint32_t BrdfLutDataSize = 256;
+inline constexpr uint8_t BrdfLutData[131257] = {
+    144,13,128,240,1,220,134,1,79,236,15,77,208,9,75,138,6,75,212,4,73,202,4,73,248,3,71,156,2,71,152,2,
+    69,148,2,67,142,2,67,138,2,65,134,2,65,130,2,63,166,1,63,126,61,122,59,120,61,120,57,116,57,114,57,112,
+    55,112,55,108,53,108,53,104,51,104,51,102,49,100,49,98,49,96,47,94,47,94,45,52,83,44,89,44,87,44,85,42,
+    85,42,83,40,79,40,81,40,77,38,77,38,75,38,73,36,73,36,69,36,71,34,67,34,67,34,65,32,65,32,63,32,
+    61,30,61,30,59,30,57,28,57,28,57,28,53,28,55,26,53,26,103,26,101,26,99,24,97,24,95,24,93,22,91,22,
+    89,22,87,22,87,22,83,20,81,20,81,20,77,20,77,18,75,18,73,18,71,18,69,18,69,16,65,18,65,16,65,16,
+    61,14,61,16,113,14,115,14,115,14,111,14,107,14,105,12,103,14,101,12,99,12,95,12,93,10,91,12,87,10,87,12,
+    83,10,83,10,79,10,77,10,75,8,75,10,71,8,71,8,137,1,10,133,1,8,129,1,8,125,6,121,8,119,8,115,
+    6,113,8,107,6,107,6,101,6,101,8,95,4,95,6,91,6,87,6,85,4,83,6,81,4,157,1,6,151,1,4,147,
+    1,4,143,1,6,137,1,4,133,1,4,129,1,4,125,4,121,2,115,4,113,4,109,4,105,2,101,4,99,2,95,4,
+    129,1,2,177,1,2,171,1,4,163,1,2,159,1,2,153,1,2,147,1,2,141,1,2,135,1,2,131,1,2,125,2,
+    121,2,115,2,111,2,109,2,205,1,2,197,1,0,189,1,2,181,1,2,175,1,0,165,1,2,159,1,2,153,1,0,
+    145,1,2,139,1,0,131,1,2,127,0,175,1,2,231,1,0,219,1,2,209,1,0,201,1,0,189,1,2,179,1,0,
+    171,1,0,163,1,2,153,1,0,147,1,0,209,1,0,135,2,2,247,1,0,235,1,0,221,1,0,209,1,0,197,1,
+    2,187,1,0,173,1,0,165,1,0,181,2,0,163,2,0,143,2,2,255,1,0,237,1,0,223,1,0,207,1,0,195,
+    1,0,179,2,0,207,2,0,185,2,0,161,2,0,139,2,0,247,1,0,227,1,2,187,2,0,131,3,0,229,2,0,
+    197,2,0,171,2,0,143,2,0,175,2,0,195,3,0,155,3,0,241,2,0,207,2,0,173,2,0,141,2,0,243,1,
+    0,215,1,0,191,1,0,169,1,0,149,1,0,131,1,0,115,0,99,0,87,0,75,0,63,0,53,0,47,0,37,0,
+    33,0,25,0,21,0,17,0,13,0,11,0,7,0,7,0,3,0,3,0,3,0,0,0,1,0,1,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,243,8,179,27,234,8,166,27,6,6,1,2,2,2,2,0,0,2,2,0,0,2,0,
+    0,1,1,2,2,0,1,0,2,0,0,0,0,1,0,2,1,0,2,1,1,2,0,0,2,0,0,0,0,0,0,1,
+    0,2,0,0,0,0,1,1,2,0,0,2,0,0,0,1,0,2,0,0,0,0,0,0,1,0,2,0,0,0,1,0,
+    2,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,1,0,2,0,0,0,0,1,0,2,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,0,
+    1,0,2,0,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+    2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,181,3,179,37,154,3,132,37,12,26,2,8,8,4,1,2,0,0,4,
+    2,0,0,0,2,2,2,1,1,0,2,0,1,0,0,2,2,2,0,1,0,0,0,2,2,1,0,0,1,0,0,0,
+    0,0,0,2,0,1,0,0,0,0,2,2,1,0,2,1,0,0,0,2,0,1,1,2,0,0,0,1,2,2,0,1,
+    0,2,0,0,0,0,1,0,2,0,0,0,0,0,0,0,0,1,0,2,1,0,2,1,1,2,2,0,0,0,0,0,
+    0,0,0,1,1,2,0,0,2,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+    2,0,0,1,0,2,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,1,1,0,0,2,2,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,1,1,2,0,0,2,1,0,2,0,1,0,2,0,0,0,0,0,1,0,2,
+    0,0,0,0,0,1,1,2,2,0,0,0,0,0,0,1,0,2,0,1,0,2,0,0,0,0,0,0,0,0,1,0,
+    2,0,1,0,2,0,1,0,2,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,
+    0,0,0,1,0,2,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,209,30,26,136,30,24,36,0,14,12,6,0,4,2,
+    4,4,0,0,2,0,0,0,0,0,2,0,0,0,2,0,0,4,0,1,0,2,2,0,0,1,1,2,0,0,2,0,
+    0,0,0,0,0,0,2,0,1,0,2,0,1,0,0,0,0,0,0,0,0,0,0,2,0,1,0,0,0,2,0,1,
+    0,2,0,1,0,0,0,0,2,2,1,0,0,1,0,0,0,0,2,2,0,1,0,0,1,2,2,1,1,0,2,2,
+    1,1,2,0,0,2,0,1,0,2,0,0,0,1,0,0,0,2,1,1,0,2,0,1,0,0,2,2,0,1,0,2,
+    0,0,0,0,0,0,0,1,1,2,2,1,1,2,2,0,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,
+    0,0,0,1,0,2,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,1,0,2,0,0,0,0,1,0,2,0,
+    1,1,2,0,0,0,0,2,0,0,0,1,0,2,1,0,2,0,0,1,0,2,0,0,1,0,2,1,0,2,0,1,
+    0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,1,
+    0,0,0,0,0,2,0,0,1,0,2,0,0,0,0,0,0,1,0,2,0,1,0,2,0,0,0,1,0,2,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,1,0,2,0,0,0,0,0,0,0,0,
+    0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,1,1,2,
+    2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,1,0,2,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,234,115,254,87,131,116,231,88,4,54,3,18,12,
+    8,0,6,0,4,8,4,0,0,0,2,1,2,2,0,0,2,0,0,0,2,2,1,2,2,1,0,0,0,2,2,1,
+    0,0,1,2,0,1,2,2,0,1,1,2,2,1,0,0,0,0,2,0,1,0,0,2,2,1,0,2,1,0,0,0,
+    0,0,0,0,0,0,0,2,0,0,0,0,0,1,0,0,0,2,0,0,2,0,1,1,0,2,0,0,2,1,1,2,
+    2,0,1,1,2,2,1,0,0,1,2,2,0,1,1,0,2,2,0,0,1,1,2,2,0,1,0,2,0,0,0,0,
+    0,0,0,1,0,0,1,0,0,2,0,0,2,1,0,2,0,0,1,1,2,0,0,2,0,1,1,2,2,1,0,2,
+    0,0,0,0,1,1,2,2,1,1,2,0,1,0,2,0,0,2,0,1,0,2,1,0,2,0,0,0,0,0,0,1,
+    0,2,0,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,1,0,
+    0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,2,2,0,0,1,0,2,1,1,2,2,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,1,0,2,0,0,0,1,0,0,0,2,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,1,0,0,1,
+    2,2,0,0,0,0,0,0,0,1,0,2,1,1,2,2,0,1,0,2,0,0,1,0,2,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,1,1,2,2,0,1,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,1,0,2,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,1,0,2,1,0,2,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,128,5,231,2,175,5,232,1,16,
+    64,3,20,18,10,0,10,1,2,10,4,0,4,0,2,2,0,1,2,0,2,0,0,0,0,6,2,1,0,2,0,0,
+    0,1,0,2,0,0,2,0,2,0,1,1,0,2,2,0,0,0,1,0,2,0,1,0,2,2,0,1,0,0,0,2,
+    1,2,0,0,0,1,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,2,0,
+    1,2,2,1,1,0,0,2,0,1,0,0,0,2,0,1,0,0,2,0,1,0,0,0,0,0,0,0,0,2,0,1,
+    0,0,0,0,0,0,0,2,0,0,2,0,0,1,0,2,1,0,0,0,2,1,0,2,1,0,0,1,0,2,2,0,
+    1,0,2,1,0,0,0,0,0,2,1,1,2,2,1,0,2,0,1,0,2,1,1,2,2,1,0,2,1,0,0,1,
+    0,0,2,2,0,1,1,2,2,0,0,0,1,0,2,0,0,1,0,2,0,1,0,0,0,2,1,0,0,0,0,0,
+    2,1,0,2,0,1,0,2,0,1,0,2,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,1,0,2,1,0,
+    2,1,1,2,2,0,1,0,0,0,0,0,2,0,0,0,0,0,1,0,0,0,0,0,2,0,0,0,0,0,0,1,
+    0,2,0,0,0,1,1,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,1,0,
+    2,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,
+    1,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,
+    0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+    0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,224,12,210,4,225,
+    12,235,5,23,70,5,32,14,14,1,6,0,6,10,4,0,4,0,2,1,4,2,0,0,0,0,2,0,0,4,2,2,
+    0,1,0,2,2,0,0,1,2,2,0,1,1,2,2,0,0,0,0,1,0,2,2,0,1,0,2,0,0,1,0,2,
+    1,0,0,2,0,1,0,2,0,0,2,0,1,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,1,0,2,2,1,0,2,1,1,2,0,0,0,1,
+    0,0,0,0,0,0,0,0,0,2,0,1,0,0,0,0,0,0,0,0,2,0,1,0,0,2,0,1,2,0,0,0,
+    0,0,1,0,2,0,1,2,0,0,0,0,2,1,0,2,1,1,2,0,1,0,2,0,1,2,2,1,1,2,0,1,
+    2,0,0,2,0,0,1,1,2,2,0,1,0,0,1,0,2,0,0,0,0,2,1,1,0,2,0,0,2,1,0,0,
+    0,0,0,0,1,2,2,0,0,0,1,0,2,0,1,1,2,0,0,0,0,0,1,0,2,2,0,0,0,1,0,2,
+    0,1,0,2,0,0,0,1,1,2,2,0,0,0,0,0,1,0,2,1,0,0,0,2,0,0,0,1,0,2,0,1,
+    0,2,0,0,0,0,1,0,2,0,0,1,0,0,0,2,0,0,1,0,2,0,1,0,2,0,0,1,0,0,0,2,
+    1,0,2,0,0,1,0,2,0,0,0,1,1,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+    0,2,0,0,0,1,0,2,0,0,0,1,0,2,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,1,0,2,
+    0,0,0,0,0,0,0,0,0,0,0,1,0,2,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,226,
+    6,101,217,6,61,31,74,13,24,16,22,0,8,1,8,12,2,1,2,0,4,2,2,1,4,2,2,0,0,0,2,6,
+    0,0,2,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,2,0,0,2,0,1,0,0,2,0,1,0,0,2,
+    0,1,2,2,3,2,0,0,2,1,0,2,1,0,2,0,0,0,0,0,2,0,0,0,1,0,0,0,2,0,1,0,
+    2,0,0,0,1,0,2,0,0,0,0,0,2,0,1,0,0,0,0,0,2,0,1,0,2,0,1,0,2,0,1,0,
+    0,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,0,2,0,1,0,2,0,1,2,
+    0,0,0,0,2,1,1,2,2,1,0,0,0,0,1,2,2,1,1,2,0,0,2,0,1,0,0,1,0,2,0,1,
+    2,0,0,0,1,0,0,0,2,2,1,1,2,2,1,0,2,0,0,0,0,0,1,1,2,2,0,1,0,2,1,0,
+    0,0,0,0,0,0,2,1,1,0,0,2,2,1,1,0,2,2,1,0,0,0,2,0,0,0,1,0,2,1,0,2,
+    0,0,1,0,2,1,0,2,0,0,0,1,0,0,0,0,0,0,0,0,1,2,2,0,0,0,0,1,0,2,0,0,
+    0,0,0,1,0,2,0,1,0,2,0,0,0,0,1,0,2,1,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
+    1,0,2,0,0,1,0,2,0,0,0,0,0,0,0,0,0,1,0,2,0,1,0,2,0,1,0,2,0,1,0,2,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,2,0,0,2,0,1,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,218,6,24,147,6,191,1,81,64,15,36,8,12,1,14,1,8,10,6,2,4,0,2,1,2,0,2,0,2,0,2,
+    0,2,8,2,1,1,2,4,1,0,2,0,0,0,1,0,2,2,1,0,2,0,0,0,1,0,2,0,0,0,0,2,
+    0,0,0,0,0,0,0,1,2,0,2,0,0,0,1,2,2,0,0,0,1,0,0,0,0,0,2,0,0,2,1,1,
+    2,2,0,1,1,0,2,2,0,1,1,0,2,2,0,1,1,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,
+    0,0,0,0,0,0,0,0,0,2,0,1,0,0,0,0,0,2,0,1,0,0,0,0,0,0,0,0,0,2,2,0,
+    1,0,2,1,0,0,0,2,0,0,1,1,0,2,2,1,1,2,0,1,0,0,0,0,0,2,2,0,1,0,2,1,
+    1,0,0,2,0,0,0,0,0,0,2,0,0,0,1,0,2,0,0,0,1,0,0,0,0,1,0,2,0,0,0,0,
+    2,1,0,2,1,0,2,1,0,0,1,0,2,2,0,0,0,0,0,0,0,0,0,0,0,1,0,2,1,0,2,0,
+    0,0,1,1,2,2,0,1,0,2,0,0,1,1,0,2,2,0,0,1,0,0,0,2,0,1,0,2,0,1,0,2,
+    0,0,0,0,0,0,1,0,2,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,1,0,0,0,2,
+    0,0,0,0,0,0,1,0,2,0,0,0,1,0,2,0,0,0,1,1,2,2,0,0,0,0,1,0,2,0,0,0,
+    0,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,2,1,1,2,0,0,0,0,0,0,0,0,0,
+    0,0,0,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,2,0,0,0,0,0,0,2,
+    0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,164,5,6,167,4,165,1,123,44,23,38,8,20,7,8,0,10,10,8,0,6,0,2,0,4,0,0,1,
+    2,0,2,0,0,8,2,2,4,1,1,0,2,0,0,0,2,2,0,1,0,2,2,1,0,0,0,2,2,0,0,0,
+    0,0,0,0,0,1,0,2,0,1,3,6,0,1,0,0,2,2,0,1,0,0,0,2,2,0,1,0,0,1,2,0,
+    0,2,0,1,0,0,0,2,0,1,0,0,2,2,0,1,0,0,0,2,0,0,0,0,0,0,1,0,2,1,0,0,
+    0,2,0,1,1,0,0,0,2,2,0,0,1,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,2,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,1,0,2,2,1,1,0,0,0,0,0,0,
+    0,0,0,0,0,0,2,0,1,0,0,0,0,2,2,1,1,0,2,0,1,0,2,2,0,1,0,0,0,0,1,2,
+    0,1,0,0,2,2,1,0,0,0,0,0,0,1,0,0,0,2,0,1,0,0,0,2,2,0,0,0,0,0,0,0,
+    0,0,1,1,2,0,1,2,2,1,0,2,0,0,0,1,1,0,0,0,0,2,0,0,2,1,0,0,0,0,0,2,
+    0,0,0,1,0,2,0,1,1,2,2,1,1,2,2,0,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,1,1,2,2,0,0,1,0,2,0,1,0,2,0,0,0,0,
+    0,1,1,2,2,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,1,
+    0,2,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,2,0,1,0,0,0,0,1,0,0,2,2,1,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,0,0,0,0,2,0,1,0,0,0,0,1,0,0,2,0,
+    1,2,0,0,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,128,5,51,217,3,95,153,1,34,29,26,0,22,1,16,5,6,1,6,14,6,0,6,0,2,
+    0,4,0,2,1,2,0,0,8,0,1,0,2,2,0,2,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,1,
+    0,2,0,0,0,0,0,0,0,2,0,0,2,3,2,0,0,2,0,0,0,1,0,2,0,0,0,0,0,0,0,2,
+    0,0,2,1,1,2,2,0,0,0,1,2,2,0,0,1,1,0,2,0,0,2,0,0,1,1,0,0,0,2,2,0,
+    0,0,0,0,0,0,0,1,0,2,0,1,0,0,0,2,0,0,0,1,0,2,0,0,0,0,0,0,1,0,2,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,2,0,1,2,0,1,0,0,2,2,1,1,0,2,0,0,0,
+    1,2,0,0,0,1,2,0,1,0,0,2,0,0,0,1,2,2,1,0,0,0,0,0,2,0,1,1,0,0,0,0,
+    0,0,0,0,0,2,2,0,1,0,0,1,2,0,1,0,0,0,2,2,0,0,0,0,1,0,0,1,2,2,0,0,
+    0,1,1,0,0,0,2,0,1,2,2,0,1,0,2,0,1,1,0,2,2,1,0,2,1,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,1,0,2,0,0,0,1,0,2,0,0,1,0,2,0,0,
+    1,0,2,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,1,0,2,0,0,0,0,0,1,0,2,0,
+    0,0,0,0,1,0,2,0,0,0,0,0,0,0,1,0,0,0,2,0,0,0,0,0,0,0,0,2,0,1,0,0,
+    1,2,2,0,0,1,0,0,0,0,0,2,0,1,0,0,0,0,0,2,0,1,0,0,0,2,0,1,0,2,0,0,
+    0,1,0,0,1,0,0,0,0,2,2,1,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,142,4,27,157,2,99,205,1,10,39,24,5,24,7,12,1,12,5,4,14,6,1,
+    6,0,4,0,4,1,0,2,2,0,4,8,2,0,0,1,2,2,0,1,0,2,0,1,0,2,4,1,0,2,0,0,
+    0,0,2,0,1,0,2,0,0,0,2,0,1,0,2,0,5,4,2,0,0,0,0,0,2,2,1,1,2,0,0,0,
+    0,0,0,2,0,1,2,0,1,0,0,0,2,2,0,1,0,0,0,2,2,1,1,0,0,0,0,2,2,0,0,0,
+    0,1,1,0,0,0,2,0,0,2,1,0,0,0,0,1,0,2,0,0,0,0,2,1,1,2,0,0,2,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,1,0,2,2,0,1,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,0,0,2,0,1,0,0,0,2,0,0,0,
+    0,0,0,0,0,0,1,0,2,0,1,0,2,0,1,0,0,0,2,0,1,2,0,1,0,2,0,1,0,0,2,2,
+    0,0,0,0,0,0,0,1,0,0,0,2,0,1,1,0,2,0,0,2,0,1,0,0,1,0,0,0,2,0,0,0,
+    1,0,2,0,0,2,0,0,0,1,0,2,0,1,0,2,1,1,2,2,0,0,0,1,0,0,0,2,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,2,0,0,2,1,0,2,0,0,0,1,0,2,
+    0,1,0,2,0,1,0,2,0,1,0,2,0,1,0,2,0,0,0,1,0,2,0,0,0,1,0,2,2,0,1,0,
+    0,1,2,2,1,0,0,0,2,1,1,2,2,0,1,0,0,0,2,0,1,1,0,2,0,0,0,0,0,0,0,0,
+    2,0,1,0,0,1,0,0,2,2,0,0,1,0,0,0,2,0,1,0,2,0,1,0,2,0,0,0,1,0,2,0,
+    1,0,0,0,0,0,2,0,1,0,0,0,0,1,2,0,0,0,1,0,2,2,1,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,152,3,17,89,85,129,2,15,45,26,21,16,5,18,7,6,0,14,8,
+    0,1,4,1,4,0,4,2,6,0,2,1,2,8,0,2,2,0,2,1,0,2,0,1,2,2,2,1,1,2,0,1,
+    2,0,0,0,2,0,2,0,0,0,0,0,0,2,2,0,1,1,3,6,0,0,0,0,0,0,2,1,2,2,1,0,
+    0,0,2,0,0,0,0,0,0,2,2,1,0,0,0,0,1,0,0,0,2,0,0,0,2,2,1,1,0,0,0,0,
+    2,0,1,0,2,2,0,0,0,1,0,0,1,0,1,0,2,2,0,1,0,0,0,0,0,2,0,1,2,0,1,0,
+    0,2,2,1,0,0,0,0,1,0,2,2,0,0,0,1,0,2,0,0,0,1,0,2,0,0,0,0,0,0,1,1,
+    2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,1,1,0,0,
+    0,0,0,0,0,0,0,0,2,2,1,1,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,2,
+    1,1,0,0,2,0,0,0,0,2,1,1,0,0,0,2,2,1,1,2,0,1,2,0,1,2,2,0,0,0,1,0,
+    2,0,0,0,1,0,2,1,0,0,0,2,0,1,0,2,0,1,0,2,1,1,2,0,1,2,2,0,1,1,2,0,
+    0,0,1,2,2,0,0,0,0,0,0,1,0,0,0,0,0,2,0,0,0,0,0,1,0,2,0,0,0,1,0,2,
+    0,1,0,2,0,0,0,0,0,0,0,0,0,1,0,2,0,1,0,2,0,0,0,1,0,2,0,0,0,1,0,2,
+    0,0,2,0,1,1,2,2,0,0,1,0,2,1,1,2,0,0,0,0,0,0,2,0,0,1,1,0,2,2,1,0,
+    0,0,0,0,2,0,1,0,0,0,0,1,0,0,2,2,0,0,0,0,0,0,1,0,2,0,1,0,2,0,0,0,
+    0,0,0,0,0,0,0,0,1,0,2,0,0,0,1,0,0,0,0,0,2,0,1,1,0,0,2,0,1,2,0,0,
+    0,0,2,0,1,0,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,3,17,41,63,179,2,31,53,18,31,14,11,12,3,18,7,
+    2,12,12,1,2,1,4,0,2,1,2,0,4,0,2,10,4,1,2,0,0,2,2,1,2,0,0,0,0,0,2,0,
+    0,0,0,0,2,0,1,0,0,0,0,0,2,0,0,0,0,0,2,2,3,2,0,2,0,0,2,0,1,0,0,0,
+    2,0,0,0,2,0,1,1,2,2,0,1,0,2,0,0,0,0,2,0,0,0,0,0,1,0,0,0,2,0,0,0,
+    0,0,0,0,2,2,1,1,2,0,1,2,0,1,1,0,2,0,0,0,0,0,0,2,0,1,0,0,2,0,1,2,
+    0,0,2,1,1,2,0,0,0,0,2,0,0,1,1,2,2,0,0,0,0,0,0,0,0,1,2,2,0,0,1,1,
+    0,2,1,1,0,2,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,1,2,0,1,2,2,
+    0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,1,0,0,0,2,0,1,0,0,0,0,0,0,0,0,0,
+    0,0,2,0,0,0,1,0,0,0,0,0,2,2,0,1,0,0,1,0,2,0,0,0,1,2,2,1,0,0,0,0,
+    0,0,1,0,2,0,0,0,0,2,0,1,0,0,0,2,1,1,2,2,0,1,0,2,0,0,0,1,0,0,0,2,
+    0,0,0,0,0,1,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,1,0,0,0,2,0,0,0,1,0,2,
+    0,1,2,2,1,0,0,1,0,2,0,1,2,2,1,0,0,0,0,0,0,1,2,2,0,0,1,1,2,2,1,0,
+    0,1,2,2,1,0,0,0,0,1,0,2,0,0,0,0,0,1,2,0,0,2,0,0,1,0,0,0,2,0,1,1,
+    2,2,1,0,2,0,0,0,0,0,0,0,0,0,0,0,1,1,2,0,0,0,0,2,0,0,0,0,0,0,0,0,
+    2,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,1,0,0,0,0,0,2,0,1,0,0,1,
+    2,0,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,178,3,35,11,31,181,2,37,61,8,43,16,11,12,7,
+    8,3,14,4,2,0,8,0,4,3,2,0,4,1,0,0,4,10,2,0,2,2,2,1,2,0,0,0,2,0,2,0,
+    0,0,2,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,1,0,0,7,8,2,1,2,2,0,1,2,2,
+    2,0,0,1,0,2,0,0,2,0,1,1,2,2,1,0,2,0,0,0,0,0,0,0,0,0,2,0,0,1,0,2,
+    0,0,0,0,0,0,0,0,2,0,1,0,2,0,0,0,1,0,1,0,0,0,2,2,0,1,0,2,0,1,0,2,
+    0,1,2,0,1,2,0,1,2,0,0,0,0,0,1,2,2,1,0,0,0,0,0,0,0,2,0,0,0,1,0,0,
+    2,2,3,0,2,0,0,1,0,2,0,1,1,0,2,2,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,2,0,1,0,2,2,1,1,
+    2,0,0,0,1,0,0,0,2,0,0,0,0,0,0,0,0,2,0,1,0,2,1,1,0,2,2,1,1,0,0,0,
+    0,0,2,0,0,0,1,0,2,0,1,0,2,2,0,1,0,0,0,2,0,1,0,2,0,1,1,0,2,2,0,0,
+    0,1,1,0,2,0,0,0,0,2,0,0,0,0,0,1,0,0,0,0,0,0,0,2,0,0,2,1,1,0,0,2,
+    0,1,0,2,0,0,0,1,0,2,2,1,0,2,1,1,2,2,0,1,1,2,0,0,0,1,0,2,0,0,0,1,
+    0,2,2,0,1,1,2,2,0,0,0,0,0,1,0,2,1,0,2,0,1,0,2,1,1,2,2,0,0,0,1,0,
+    2,0,1,1,2,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,2,0,0,
+    2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,1,0,0,0,
+    0,0,0,0,0,0,0,1,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,214,3,23,205,1,25,119,47,69,2,57,12,13,
+    12,11,8,7,8,8,12,3,2,0,6,0,4,1,2,1,2,0,2,2,0,6,4,1,2,2,2,0,2,0,2,0,
+    0,0,0,0,2,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,2,0,1,0,3,0,0,6,0,1,0,2,
+    0,1,1,0,2,2,2,1,0,0,0,2,2,0,0,0,2,1,0,0,0,0,0,2,2,0,0,0,1,0,2,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,1,0,0,0,0,0,2,0,0,0,
+    1,0,2,0,0,0,0,0,2,0,1,2,0,0,0,1,2,0,0,0,1,2,2,0,0,1,0,0,0,0,0,2,
+    0,0,0,0,0,1,1,2,0,0,0,1,0,2,2,0,1,1,2,2,0,1,0,0,0,0,0,0,0,2,2,0,
+    1,0,0,1,0,2,0,0,0,1,0,2,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,2,0,1,0,
+    2,0,1,0,0,0,2,0,0,0,1,0,0,0,2,0,1,0,0,0,2,0,1,0,2,0,0,0,1,0,2,0,
+    0,2,0,0,1,0,2,0,0,0,0,1,0,0,1,0,2,2,1,1,2,0,0,0,1,0,2,0,0,2,0,1,
+    0,0,0,0,0,2,0,0,0,0,0,1,0,0,0,0,0,2,0,0,0,0,2,0,0,1,0,0,1,2,2,0,
+    1,1,0,2,0,0,0,1,0,2,0,1,0,2,0,1,0,2,0,1,0,2,2,1,0,2,1,0,0,1,2,2,
+    1,0,2,1,0,2,0,0,1,1,0,2,0,0,0,0,0,1,2,2,1,0,2,0,0,0,0,1,0,0,0,2,
+    0,0,1,0,2,0,0,0,0,1,0,0,0,2,0,0,0,0,0,0,0,0,2,0,1,0,2,0,0,0,1,1,
+    0,0,2,0,0,2,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,2,0,
+    0,0,0,0,1,0,2,0,1,0,0,0,0,1,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
+    2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,154,2,29,12,7,121,47,73,7,71,10,
+    17,10,9,10,9,6,4,6,1,10,3,2,1,4,0,4,0,6,1,0,1,2,10,2,0,0,1,0,2,4,0,2,
+    1,2,2,2,1,0,2,0,0,0,1,2,0,0,0,0,2,2,0,0,1,0,2,5,0,0,0,0,4,0,0,2,
+    0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,0,0,2,1,1,0,2,0,2,2,1,
+    0,0,0,2,1,0,2,0,0,0,1,0,2,0,0,0,0,2,0,5,0,0,0,2,0,0,0,0,0,0,0,0,
+    0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,1,1,2,2,1,1,0,0,2,0,1,2,2,0,
+    1,0,0,0,0,1,2,0,1,0,0,2,2,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1,2,2,1,0,0,1,2,0,0,2,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1,0,2,2,0,0,0,1,0,0,0,2,0,0,0,1,0,2,0,0,0,1,0,2,0,1,0,0,0,2,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,1,2,2,1,0,0,1,0,2,2,0,1,0,2,0,1,0,2,0,1,0,
+    0,0,2,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,1,0,
+    0,0,2,2,1,1,0,0,2,0,1,2,2,1,1,2,2,0,1,0,2,0,1,1,2,0,1,2,2,0,0,1,
+    1,2,2,1,0,0,1,2,2,0,0,0,1,0,0,0,2,0,0,0,1,0,0,1,2,2,0,0,0,0,0,0,
+    1,0,0,0,2,0,0,0,0,2,0,1,0,2,1,0,0,1,2,0,0,0,0,2,0,0,0,0,0,0,0,1,
+    0,0,0,4,0,0,1,0,0,1,2,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+    0,0,0,0,0,2,0,1,0,0,0,2,0,1,0,2,0,1,0,0,1,0,0,0,2,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,244,1,31,78,0,121,43,79,13,85,
+    4,15,12,15,6,7,8,1,6,1,6,1,6,1,6,1,2,1,4,0,2,0,4,8,1,0,4,0,2,1,0,0,
+    0,0,2,0,2,2,2,1,0,0,2,2,0,0,2,0,0,1,0,0,2,2,0,1,7,0,0,0,2,6,2,0,
+    0,0,0,2,2,0,1,1,2,2,0,0,0,1,2,0,0,0,0,0,1,0,2,0,1,0,2,0,0,0,0,0,
+    2,0,0,0,0,2,2,1,1,0,2,2,0,1,0,0,0,0,0,2,1,0,0,0,0,0,0,1,2,2,0,0,
+    0,0,0,0,0,0,1,0,2,0,0,0,0,0,2,0,1,0,0,0,2,0,1,0,2,0,0,0,0,2,0,1,
+    1,0,2,0,0,0,1,0,2,0,0,2,1,1,0,0,0,2,2,1,1,0,0,0,0,2,2,0,0,1,0,0,
+    0,2,0,1,2,2,0,0,1,0,0,0,0,0,0,1,0,2,0,1,0,2,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,2,0,0,0,1,0,0,0,2,0,0,0,0,0,0,0,1,0,2,0,0,0,1,0,
+    0,2,0,1,0,0,2,0,1,0,2,0,0,0,0,2,0,1,0,0,0,0,0,0,1,0,2,0,0,0,0,0,
+    0,2,0,1,0,0,2,0,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,2,
+    0,0,2,1,1,2,2,0,0,1,0,2,1,1,2,2,0,1,0,2,1,1,0,2,2,1,0,2,0,1,0,2,
+    0,0,1,1,2,2,2,0,1,1,0,2,0,0,0,0,0,1,0,2,0,0,0,0,0,1,2,0,0,2,1,0,
+    0,0,2,0,0,1,1,2,0,0,2,0,0,0,0,0,1,0,2,1,1,0,0,2,4,0,0,0,1,0,0,0,
+    0,0,0,0,2,0,0,0,1,0,2,1,1,0,0,0,0,2,0,0,0,0,1,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,1,0,0,0,2,0,1,0,0,0,0,0,2,0,1,0,0,0,0,1,0,2,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,2,29,100,10,121,45,83,15,
+    103,0,19,6,13,8,11,8,5,4,1,6,3,6,0,4,1,4,1,2,1,4,0,4,8,2,0,0,1,2,0,2,
+    0,0,2,0,1,2,1,0,2,4,0,0,0,2,0,0,0,2,0,0,0,0,0,0,2,5,1,0,2,2,4,0,
+    2,0,1,2,0,1,0,4,2,1,1,2,0,2,2,1,0,0,0,2,1,0,0,0,0,2,2,0,0,1,0,0,
+    1,0,0,2,0,1,0,0,0,2,0,0,0,0,2,2,0,0,0,0,1,3,2,2,0,0,0,0,0,0,1,0,
+    0,0,2,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,2,0,0,0,0,
+    0,0,0,0,0,0,0,1,0,0,2,0,1,0,0,0,0,2,0,1,2,2,1,0,2,0,1,0,0,0,2,0,
+    0,0,1,0,2,0,1,0,0,0,0,0,0,0,0,2,2,0,0,1,0,0,1,0,2,0,0,0,0,2,0,1,
+    1,2,2,0,0,1,0,2,1,1,2,0,0,2,0,0,0,1,0,0,0,0,0,2,0,0,0,1,0,2,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,0,0,2,2,1,1,2,0,1,0,
+    0,0,0,0,0,0,0,0,2,0,0,2,1,1,0,0,0,0,0,0,0,0,0,2,0,0,2,0,0,0,1,0,
+    0,0,0,1,2,2,1,1,0,0,2,0,1,2,2,1,1,2,2,0,1,0,2,0,1,0,2,0,1,1,2,0,
+    1,2,0,0,2,0,1,0,2,0,0,2,1,0,0,1,2,0,0,0,1,0,0,0,2,0,0,2,0,0,1,0,
+    2,0,0,1,0,0,0,2,1,1,0,4,2,0,0,1,0,0,0,0,0,0,0,0,1,2,0,0,0,0,2,1,
+    0,2,0,1,0,4,0,1,0,2,0,1,0,0,0,0,0,1,1,0,0,0,0,0,2,0,0,1,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,2,0,1,0,0,0,2,0,1,0,2,0,1,1,2,0,1,
+    2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,130,2,29,122,12,121,41,139,
+    1,15,59,1,23,0,13,10,13,4,5,8,7,2,0,6,5,4,0,6,0,4,1,2,3,0,12,6,1,4,2,0,
+    1,0,0,2,1,2,0,0,0,2,0,1,1,2,0,0,2,4,0,0,0,0,0,2,0,0,0,7,0,2,0,0,
+    6,0,0,2,0,0,0,2,0,1,0,4,0,1,0,0,0,2,0,2,0,1,0,2,2,0,1,0,0,0,0,2,
+    0,0,2,0,0,0,0,2,1,1,2,0,0,0,1,0,0,0,0,0,0,0,0,5,0,0,0,4,0,2,2,1,
+    0,2,0,0,0,0,1,0,2,2,0,0,1,1,2,2,1,0,2,0,1,0,2,0,0,0,0,2,0,1,0,0,
+    0,0,0,2,0,1,2,0,1,0,0,0,0,0,0,2,0,0,0,1,0,2,0,1,2,2,1,0,0,1,0,2,
+    0,0,0,0,2,0,1,0,2,0,0,0,0,0,0,2,0,1,1,0,0,1,2,0,0,2,1,0,0,2,0,1,
+    0,2,2,1,0,0,1,2,2,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,1,1,2,0,0,2,0,1,
+    0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,2,2,1,1,0,0,2,2,1,1,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,1,0,2,0,0,
+    2,0,0,0,1,0,0,1,2,2,1,0,0,0,2,1,1,2,2,0,1,0,2,2,1,1,2,0,1,0,2,2,
+    1,1,2,0,0,0,1,0,2,2,1,0,0,1,2,0,0,2,1,0,2,0,0,1,0,0,1,0,2,2,0,0,
+    0,0,1,0,0,0,2,0,0,1,0,2,0,2,1,0,0,0,0,0,2,1,0,0,0,0,0,4,0,0,0,1,
+    1,0,0,0,2,0,0,4,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,2,0,
+    0,1,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,2,0,1,0,0,0,0,
+    0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,132,2,31,142,1,20,
+    115,37,185,1,21,31,5,21,4,19,4,11,8,13,4,1,8,5,0,0,8,5,0,1,4,0,6,0,4,6,1,0,
+    2,1,4,2,4,0,0,1,0,0,0,0,2,0,2,0,0,0,2,1,1,0,2,0,2,2,0,0,0,1,7,2,
+    2,1,0,8,2,0,0,0,2,0,0,0,2,0,1,0,2,0,2,0,0,0,1,0,4,0,1,0,2,2,0,1,
+    0,0,0,0,2,0,0,0,1,0,2,2,0,1,2,0,1,2,2,1,0,0,0,0,0,2,3,1,0,0,1,0,
+    1,0,2,0,0,0,0,0,2,2,2,1,1,0,2,2,2,0,0,0,1,1,2,2,0,0,0,1,0,2,0,0,
+    2,0,0,0,0,0,0,0,0,1,0,2,3,0,0,0,2,0,0,0,0,2,0,1,0,0,2,0,1,0,0,0,
+    2,2,0,1,0,0,0,0,0,2,0,1,0,0,0,0,2,0,1,0,0,2,0,0,0,1,0,0,0,2,0,0,
+    0,0,0,0,0,0,0,1,2,2,1,1,2,2,1,1,2,0,1,2,0,0,2,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,1,0,2,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2,0,1,0,0,0,2,0,1,0,0,0,2,0,0,0,0,0,0,0,0,2,1,0,0,0,0,0,0,1,2,0,
+    1,0,2,0,0,0,0,2,0,1,0,0,0,2,0,1,0,0,0,2,0,1,2,2,0,1,1,2,2,1,0,2,
+    1,1,0,2,2,1,1,2,0,0,0,1,2,2,0,0,0,1,0,2,0,0,0,1,1,0,2,2,0,0,0,1,
+    2,0,0,2,0,0,0,0,0,1,1,0,2,2,1,0,4,0,1,0,0,0,0,1,0,0,0,2,0,0,4,0,
+    1,0,0,0,0,0,1,1,0,0,6,0,1,2,0,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,
+    0,1,1,0,2,0,1,2,0,0,0,0,1,0,0,0,0,0,0,0,2,0,0,0,1,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,2,29,
+    49,20,8,33,109,19,33,7,23,0,19,4,13,4,15,6,5,2,3,10,5,1,0,8,3,0,1,4,0,2,8,6,
+    1,0,0,2,0,0,1,4,2,4,0,0,0,0,1,0,0,2,0,0,0,2,1,0,0,0,0,0,1,11,2,2,
+    0,2,2,4,6,0,1,2,2,0,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,2,0,1,0,0,
+    0,2,0,0,0,0,0,0,0,2,0,1,0,2,0,0,0,2,0,1,0,0,2,2,0,0,1,3,2,0,0,0,
+    0,2,1,0,0,1,0,2,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,2,2,1,2,2,0,1,0,
+    2,0,0,0,1,0,2,0,0,2,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
+    2,0,1,1,2,0,1,2,0,0,0,0,0,0,0,2,2,1,0,0,0,2,1,0,0,1,0,0,2,0,1,0,
+    0,0,0,0,0,0,0,2,2,1,0,2,0,1,0,2,0,1,0,2,1,0,0,0,0,1,0,2,2,0,0,0,
+    1,1,2,2,1,1,2,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,1,0,0,
+    0,0,0,2,0,0,0,1,0,2,2,0,1,1,0,0,0,0,0,2,2,1,1,2,0,0,0,0,0,0,2,2,
+    0,0,1,1,0,0,0,0,0,0,2,0,1,0,0,0,2,0,1,0,0,1,2,2,1,0,2,2,1,0,2,1,
+    1,2,2,1,1,0,2,0,1,2,0,1,2,4,1,0,0,0,2,0,1,1,0,0,2,0,0,0,1,0,2,0,
+    0,4,0,1,1,0,0,0,2,1,0,2,0,1,1,0,0,4,2,0,0,0,0,0,0,0,0,1,1,0,0,4,
+    2,0,0,0,0,0,0,1,0,0,0,6,0,0,1,1,0,1,2,0,0,1,0,2,0,3,0,0,0,0,0,0,
+    0,1,0,2,0,1,0,0,1,1,0,2,2,0,0,1,0,0,0,0,0,1,0,0,0,2,0,0,0,1,0,0,
+    0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,136,2,
+    33,41,26,53,29,43,17,31,11,27,1,17,2,17,4,19,6,5,4,3,2,1,8,5,1,0,8,3,0,1,4,6,
+    2,2,4,0,2,3,2,2,0,1,0,0,4,0,2,0,2,0,0,0,0,1,0,2,2,0,0,1,2,2,11,1,
+    0,0,0,1,0,8,2,2,2,0,2,1,2,0,0,0,2,2,0,0,2,1,0,2,2,0,1,0,2,1,0,0,
+    2,2,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,2,0,1,0,0,1,0,1,0,2,0,
+    0,0,0,0,0,2,2,0,0,0,1,1,2,2,0,0,0,0,0,1,0,2,2,0,0,1,1,2,0,1,0,2,
+    0,1,0,0,0,0,0,0,2,2,0,0,0,0,1,0,0,1,0,2,0,0,2,1,0,2,0,0,2,0,1,0,
+    0,0,0,0,2,0,0,2,1,1,2,0,0,0,0,2,0,1,0,0,0,0,0,2,0,1,0,2,0,1,0,0,
+    0,2,0,0,0,0,0,0,0,1,0,0,0,2,2,1,1,0,2,2,0,0,0,0,1,0,2,0,1,0,2,1,
+    1,2,2,0,0,0,0,0,0,0,0,1,0,2,2,0,1,0,0,0,2,0,1,0,2,0,1,0,0,0,2,0,
+    1,0,2,0,1,0,0,0,2,0,0,0,1,0,2,0,0,0,0,2,1,1,2,0,0,0,1,0,0,0,2,0,
+    0,0,0,2,0,0,0,1,0,0,0,0,2,2,1,1,0,0,0,2,0,1,2,0,2,2,0,1,1,2,0,1,
+    0,2,0,1,0,2,0,1,0,0,0,2,0,1,2,2,0,0,0,1,0,2,0,0,1,1,2,2,1,0,0,1,
+    0,0,4,2,0,0,0,0,1,1,2,0,1,2,0,0,0,0,4,1,0,0,0,2,1,0,0,0,0,0,1,0,
+    8,1,1,0,0,2,1,0,0,0,0,0,6,0,0,0,1,0,0,1,1,0,1,0,1,2,2,0,1,0,0,0,
+    1,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,2,0,0,0,0,0,0,0,0,1,0,0,0,0,0,
+    0,0,2,0,1,0,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,140,
+    2,31,35,24,53,23,41,21,31,7,25,3,23,0,15,2,27,4,3,6,3,2,5,4,1,6,3,0,1,4,3,2,
+    8,2,1,4,0,2,2,2,1,2,0,2,1,0,0,0,0,4,0,2,0,0,0,2,0,1,1,2,0,0,0,11,
+    2,2,1,2,0,0,0,0,6,0,0,2,0,0,2,4,0,0,1,2,0,0,2,2,1,1,0,4,2,1,0,2,
+    0,0,0,0,0,2,0,0,0,2,0,0,0,1,0,2,0,1,0,2,0,0,0,2,0,1,0,3,2,2,1,1,
+    0,0,0,2,2,0,1,0,0,0,0,2,2,0,1,0,0,0,0,0,2,2,1,0,0,1,0,2,0,0,2,0,
+    1,0,0,0,0,0,2,2,0,1,1,1,0,2,0,5,0,0,2,0,1,0,2,2,0,4,0,0,0,1,0,2,
+    0,2,1,0,2,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,2,0,1,0,0,0,0,0,0,0,0,
+    2,0,1,0,0,2,0,0,0,1,2,2,1,0,0,1,2,2,0,1,1,0,0,0,2,2,0,0,1,0,0,0,
+    2,0,0,0,1,0,2,0,1,0,2,0,0,0,1,0,0,0,2,0,0,0,0,0,0,0,1,0,2,0,0,0,
+    0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,1,
+    0,4,0,0,0,0,0,0,2,0,1,0,0,1,0,2,2,1,1,2,0,0,2,1,1,2,0,0,0,2,0,1,
+    2,2,1,1,2,2,1,1,0,0,2,0,1,0,2,4,1,1,0,0,2,0,1,0,0,0,2,0,1,0,0,1,
+    2,0,0,4,1,2,0,1,2,0,0,1,0,2,1,1,0,0,2,6,0,0,0,1,1,0,0,1,2,2,0,1,
+    0,8,0,0,0,3,1,0,0,0,0,1,2,10,0,1,0,1,0,1,0,0,0,0,0,1,1,1,0,0,2,1,
+    0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,2,1,0,0,0,0,0,0,0,1,0,2,
+    0,0,0,1,0,0,0,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    154,1,31,84,26,49,21,39,17,33,11,27,5,21,1,17,4,29,2,5,4,5,6,3,0,3,4,3,4,1,2,1,
+    4,4,2,0,0,1,4,1,2,0,4,2,0,0,2,1,2,0,1,0,2,1,4,2,0,1,2,2,0,0,11,1,
+    0,0,0,0,0,0,2,0,4,8,0,1,0,2,0,1,0,0,0,0,2,0,2,0,2,2,2,0,1,1,2,2,
+    2,0,0,1,0,2,0,0,0,1,0,2,2,0,2,1,1,2,2,0,1,0,2,1,0,2,2,0,5,1,0,2,
+    0,0,2,0,1,0,2,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,2,0,0,2,0,0,0,1,1,
+    2,2,0,0,0,0,0,0,0,1,0,2,2,0,1,0,1,0,2,1,0,2,0,1,1,0,1,0,0,0,0,0,
+    0,0,0,2,0,1,0,0,2,0,2,2,2,0,1,0,2,0,0,0,0,0,0,0,0,0,2,2,3,1,2,2,
+    0,1,0,0,0,0,0,0,0,0,2,0,1,2,0,1,2,0,0,0,0,2,0,0,0,1,0,0,0,2,0,0,
+    0,0,0,1,0,2,0,0,0,0,2,1,1,2,0,0,0,0,2,1,1,0,0,0,2,0,1,2,2,0,0,0,
+    0,1,1,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,0,0,0,2,0,1,0,0,0,
+    0,0,2,0,0,0,0,0,0,0,1,2,2,1,0,0,1,0,2,2,1,1,0,0,2,2,2,1,0,2,0,1,
+    0,0,0,0,0,0,1,0,2,2,0,1,1,2,0,1,4,0,2,2,1,1,0,2,0,0,0,1,1,2,0,0,
+    0,1,0,0,6,2,1,0,0,1,0,0,0,2,1,0,0,0,0,1,6,0,0,2,1,0,0,0,0,1,1,0,
+    0,0,8,2,1,0,0,0,1,0,0,0,1,1,0,0,8,2,0,0,1,0,1,0,1,0,0,0,1,0,0,1,
+    1,0,1,2,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,1,0,0,0,2,0,0,0,0,0,0,
+    1,0,0,0,0,0,2,0,1,0,2,0,1,0,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,134,1,31,110,24,45,17,39,15,31,11,27,5,21,1,45,2,9,2,7,2,3,4,3,4,5,2,1,4,3,4,
+    3,1,6,4,1,4,1,0,2,2,1,2,1,2,0,4,2,0,1,2,0,0,0,0,1,2,2,2,0,2,0,13,
+    0,2,1,2,2,2,1,0,1,1,8,2,2,0,1,4,0,0,0,0,2,0,0,0,1,0,0,0,0,2,2,2,
+    1,0,0,2,2,2,1,0,0,2,2,0,1,1,0,2,2,0,0,0,0,2,0,0,0,0,0,0,0,5,0,0,
+    0,2,0,0,0,2,0,1,0,2,0,0,0,2,0,0,0,0,2,0,1,0,0,0,0,0,0,0,0,0,0,2,
+    2,0,1,0,0,0,0,2,0,1,2,0,1,0,0,2,0,3,0,0,2,0,0,2,0,1,0,2,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,2,0,1,1,0,2,2,0,0,4,0,1,0,0,0,0,
+    0,2,0,0,0,0,2,0,0,0,1,0,0,2,0,0,2,1,1,0,2,2,1,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,2,0,0,0,1,2,2,1,0,0,1,2,2,1,0,0,0,2,0,0,0,1,0,2,0,1,0,0,
+    0,0,0,2,0,0,0,2,0,1,0,0,0,0,0,2,0,1,0,0,1,0,2,0,0,0,0,0,0,0,0,0,
+    0,2,0,0,0,0,0,0,0,0,0,2,0,1,2,0,1,0,0,0,0,0,2,0,1,1,0,6,0,0,0,1,
+    2,0,1,0,2,0,1,0,2,0,1,1,2,2,1,0,0,4,2,1,1,2,2,1,1,0,0,0,2,0,1,0,
+    0,0,2,1,0,6,1,0,0,0,2,1,0,0,1,0,0,0,2,1,0,10,0,1,1,0,0,1,2,1,0,0,
+    0,0,0,8,1,0,0,1,2,0,0,1,0,0,0,1,0,12,1,3,0,0,2,1,0,1,0,1,0,0,0,3,
+    0,0,0,0,1,1,0,1,2,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,2,0,
+    0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,
+    0,0,134,1,31,116,26,45,15,37,15,31,9,25,7,25,1,49,3,7,2,7,4,5,2,5,6,1,2,5,2,1,
+    2,1,6,2,0,1,0,2,4,3,2,0,0,0,4,0,0,1,4,0,2,0,0,0,2,0,0,1,0,0,5,0,
+    5,0,2,0,2,0,0,2,2,0,2,4,0,0,2,2,1,0,2,1,2,0,2,0,0,2,0,1,0,0,2,0,
+    1,0,2,0,1,0,2,0,2,2,0,1,2,2,2,0,1,0,2,1,0,0,0,0,2,2,1,1,2,0,5,2,
+    2,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,2,2,1,0,0,0,0,2,0,0,0,
+    0,0,1,0,2,2,0,0,0,1,0,0,0,2,0,0,0,0,1,0,0,0,0,1,0,2,2,0,1,0,2,0,
+    0,1,0,2,0,1,0,2,2,0,1,0,2,1,1,2,2,0,0,0,0,0,0,1,0,0,3,0,2,0,5,2,
+    0,1,0,2,0,0,0,1,4,0,2,2,2,0,1,0,2,0,0,0,2,0,1,0,0,2,2,0,1,0,2,0,
+    0,0,0,0,0,1,0,0,0,2,0,1,0,2,2,0,1,1,2,0,0,2,1,0,0,0,2,0,1,0,2,0,
+    0,1,0,2,1,0,2,1,0,2,2,1,0,2,1,1,0,2,0,0,2,0,0,0,0,0,0,0,1,0,2,0,
+    0,0,1,0,4,0,0,0,0,0,1,0,0,0,0,0,0,0,2,0,1,0,0,0,0,0,2,0,2,2,0,1,
+    0,0,0,0,1,0,2,2,1,1,0,0,2,0,1,0,0,2,6,1,0,2,1,1,0,0,0,2,1,1,0,0,
+    0,2,0,1,0,0,6,2,0,0,1,1,2,0,1,2,1,0,0,1,0,0,8,2,0,0,1,0,0,1,0,0,
+    1,2,0,0,12,0,3,0,0,1,1,0,1,2,1,0,0,0,12,0,0,0,3,1,1,0,0,2,1,0,3,0,
+    0,0,0,0,3,0,0,0,0,1,3,0,0,2,0,0,1,0,0,0,1,0,0,0,0,0,0,0,1,0,0,1,
+    0,2,0,0,0,0,1,0,0,0,0,0,0,0,2,0,1,0,0,0,0,0,2,0,1,0,0,0,0,0,0,0,
+    0,0,0,134,1,31,122,24,41,9,35,17,31,11,27,3,23,3,57,0,7,0,5,0,7,2,5,2,3,6,3,2,
+    3,2,3,2,2,4,0,2,1,0,0,4,0,2,1,0,1,2,0,0,0,2,0,4,0,0,0,2,0,0,1,15,
+    0,0,0,2,0,2,0,4,0,2,0,2,8,2,0,0,1,0,0,0,2,0,1,0,0,0,0,2,0,4,0,1,
+    0,2,0,0,0,2,0,1,0,0,1,0,2,0,0,2,0,2,0,2,2,0,0,0,0,0,1,2,2,1,0,3,
+    0,0,1,0,0,2,2,0,1,0,2,0,0,2,0,0,0,0,0,2,1,0,0,0,2,0,0,0,0,0,0,0,
+    0,0,0,2,0,1,0,2,0,0,2,0,1,2,0,0,0,0,0,3,0,0,0,2,2,0,1,0,0,0,0,0,
+    0,0,2,0,0,0,0,2,1,1,0,2,0,1,2,2,0,0,1,0,2,0,0,0,0,0,0,2,0,1,0,0,
+    0,0,0,1,0,2,0,0,0,3,0,0,0,1,0,0,0,0,1,0,2,0,1,0,2,4,0,0,0,4,0,1,
+    0,2,0,1,0,2,2,0,1,0,0,0,2,0,1,0,0,0,2,0,0,0,1,2,0,0,0,1,0,2,0,1,
+    0,2,2,0,0,0,1,2,2,0,0,1,0,0,0,2,0,0,0,0,0,1,0,0,0,2,0,1,0,2,0,1,
+    0,0,0,2,0,2,0,0,0,0,0,0,0,0,0,0,0,0,2,1,1,2,0,0,0,0,2,1,1,6,0,1,
+    0,0,0,0,2,2,1,1,0,0,0,0,2,1,1,0,2,0,1,6,2,0,1,0,0,0,2,1,1,2,2,1,
+    0,0,1,0,2,0,0,8,1,1,0,0,2,1,0,0,1,0,0,1,2,0,0,10,1,1,0,0,2,1,0,1,
+    0,0,1,1,0,14,2,0,0,3,0,1,0,0,1,1,0,1,2,16,0,1,0,1,0,1,0,3,1,1,0,1,
+    2,0,0,3,0,0,0,1,0,1,0,0,0,1,1,1,0,0,2,1,0,0,0,0,0,1,0,0,0,0,0,0,
+    0,1,1,0,2,1,0,2,0,0,0,0,0,0,0,1,0,2,0,0,0,1,0,0,1,0,2,0,0,0,0,0,
+    0,0,0,0,134,1,31,124,24,37,9,35,11,31,9,25,7,21,5,61,1,11,0,5,2,7,4,3,0,5,2,1,
+    4,5,2,1,2,0,2,0,4,1,2,1,1,1,2,0,4,0,0,1,2,0,2,0,0,1,2,0,2,0,0,2,
+    11,1,0,0,0,0,2,1,0,0,2,2,2,6,2,0,2,2,2,0,2,1,0,2,2,1,0,0,0,0,1,0,
+    2,0,2,0,0,0,0,0,2,2,0,0,0,1,0,0,0,0,0,0,1,1,2,2,2,0,0,2,2,1,0,0,
+    5,0,0,2,2,0,0,1,0,2,2,1,0,2,0,0,0,1,2,2,0,0,0,0,0,0,0,0,2,0,0,0,
+    0,0,0,0,0,0,2,0,1,0,0,0,2,2,0,1,0,0,0,2,1,0,0,1,0,0,0,0,0,2,2,0,
+    1,0,2,1,0,0,2,2,1,0,2,0,1,0,2,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,2,0,
+    3,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,2,0,1,2,2,1,1,2,2,1,3,1,0,2,1,0,
+    0,0,1,0,2,1,7,0,2,2,6,0,2,0,2,0,0,2,2,1,0,0,0,2,0,0,0,0,2,0,0,0,
+    0,0,1,0,0,1,2,2,2,0,1,1,2,2,0,1,0,2,1,1,2,2,0,0,0,1,1,2,2,0,0,0,
+    0,0,0,0,1,0,4,0,0,0,0,0,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,
+    0,2,0,1,0,0,1,0,0,0,2,2,1,1,0,2,0,1,0,0,6,0,0,0,0,2,1,1,0,2,0,1,
+    0,0,1,2,0,1,0,0,8,2,0,0,0,1,1,0,0,2,1,0,0,1,0,0,12,2,1,0,1,1,0,0,
+    1,2,1,0,0,0,14,1,1,0,0,2,1,0,3,0,0,0,1,1,18,0,3,2,1,0,3,0,1,0,1,0,
+    1,1,1,0,1,2,1,0,1,0,1,0,0,0,1,0,1,0,0,1,0,2,1,0,1,0,0,0,0,0,1,0,
+    1,0,2,0,1,1,2,2,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,132,1,31,68,22,26,7,33,9,29,11,25,5,43,3,45,1,7,1,9,2,5,1,5,4,5,2,
+    5,2,1,4,3,2,0,2,3,0,0,4,0,4,1,0,1,0,0,4,0,2,0,1,3,2,2,2,0,0,0,17,
+    1,4,2,2,1,4,0,0,0,0,0,0,1,2,2,0,6,4,0,2,0,0,2,4,1,1,2,2,1,2,2,0,
+    0,2,1,1,0,0,0,2,0,0,0,0,0,2,2,2,1,0,0,0,0,0,0,0,0,0,0,0,1,1,2,2,
+    0,7,0,2,0,2,0,0,0,2,0,0,2,2,1,0,0,2,2,0,0,1,0,2,0,2,0,0,0,0,0,0,
+    0,0,0,2,0,0,0,1,0,2,0,0,0,0,0,0,0,0,2,0,1,3,0,2,2,0,1,0,2,2,1,1,
+    0,2,0,0,2,0,0,0,1,0,0,0,2,2,0,0,1,1,0,0,2,2,1,0,2,0,0,0,0,0,0,0,
+    0,0,1,0,2,0,1,0,2,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,2,0,1,0,
+    0,0,0,0,0,0,2,2,0,1,1,5,0,1,0,0,0,0,0,1,0,0,0,0,1,0,2,6,0,2,0,0,
+    0,2,0,2,0,0,2,0,0,0,1,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,1,
+    0,2,0,0,0,0,0,4,0,0,0,1,0,0,0,2,0,0,0,0,0,0,2,1,1,0,0,0,0,0,0,6,
+    0,0,0,0,0,0,0,1,2,0,1,0,0,0,0,0,0,1,0,0,2,10,1,1,2,1,1,0,2,0,1,1,
+    0,0,2,0,1,0,0,1,2,12,1,1,0,1,2,0,0,0,1,0,0,1,2,1,0,14,1,1,0,0,2,1,
+    0,0,1,1,0,1,2,1,0,18,0,3,1,1,0,1,2,1,0,1,0,22,0,1,1,3,0,1,2,3,0,3,
+    0,0,0,3,0,1,1,1,0,1,2,1,0,1,0,1,0,0,0,1,0,1,1,0,0,1,2,0,0,1,0,0,
+    0,0,0,1,0,0,0,1,1,0,2,0,0,1,0,2,0,0,0,1,0,0,0,2,0,1,0,2,1,1,2,0,
+    0,0,0,0,0,0,132,1,31,0,24,100,7,31,11,29,7,27,7,79,3,11,3,9,0,7,0,5,2,7,0,5,
+    2,3,2,5,2,1,4,1,2,0,2,3,0,0,2,0,4,0,2,3,1,0,2,1,4,2,0,1,0,1,9,0,
+    7,0,2,1,2,2,4,0,2,2,4,1,2,0,1,1,2,8,1,0,2,0,2,0,2,0,4,0,0,2,0,1,
+    2,0,0,2,2,0,0,0,0,1,0,0,2,0,0,1,1,2,0,0,2,0,2,2,0,1,0,0,0,0,2,0,
+    5,0,3,0,0,0,0,0,0,0,2,0,2,0,2,0,2,2,1,1,2,0,2,0,0,2,0,0,0,1,0,2,
+    0,0,2,0,0,0,0,0,2,0,1,0,2,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,
+    2,0,0,0,0,0,0,0,0,0,0,2,0,1,0,0,0,2,2,0,0,1,0,2,0,1,0,2,0,0,0,0,
+    0,1,0,2,0,0,0,0,0,0,0,0,2,0,1,0,2,0,0,0,1,0,0,0,2,0,1,0,2,0,1,0,
+    0,0,2,0,0,0,0,0,0,0,0,2,0,1,2,0,1,0,0,0,2,0,0,2,0,0,0,1,5,0,1,0,
+    0,0,1,0,0,0,0,0,0,0,7,2,10,1,4,0,2,2,0,1,2,2,0,1,2,2,0,0,0,0,0,1,
+    0,2,0,0,0,0,0,0,4,0,0,0,0,0,0,0,1,0,2,0,1,0,0,0,2,0,1,0,0,0,0,2,
+    6,1,0,0,0,2,1,1,2,0,0,0,1,0,0,2,0,1,0,2,0,1,8,0,0,0,0,0,0,0,1,0,
+    0,2,0,1,1,0,1,2,2,1,10,0,0,2,1,1,0,0,1,2,1,0,2,1,1,0,14,2,0,0,3,1,
+    0,0,1,2,1,0,1,1,0,0,18,2,1,0,1,0,1,1,3,0,1,2,26,0,5,0,1,0,3,1,1,0,
+    1,2,5,0,1,0,1,0,3,0,0,1,1,0,3,2,0,0,1,0,1,0,1,0,1,0,0,1,1,2,1,0,
+    0,0,0,0,1,0,0,0,0,0,0,1,1,2,2,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,2,0,
+    1,0,0,0,0,0,0,134,1,31,0,20,52,1,20,9,25,7,59,7,55,3,9,3,9,0,7,3,7,2,5,2,
+    3,2,7,0,3,2,3,2,1,4,1,2,0,2,3,0,0,2,1,2,2,4,1,1,1,0,0,4,1,0,0,19,
+    1,0,0,2,2,4,1,0,0,4,1,2,2,2,1,4,2,0,8,2,1,0,0,0,0,0,0,0,0,4,0,2,
+    0,0,0,2,0,0,0,2,0,0,2,0,1,0,0,2,2,0,1,0,0,0,0,0,0,2,0,0,0,2,2,0,
+    1,7,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,1,2,4,2,1,2,2,0,1,0,0,2,2,0,
+    1,2,0,0,0,1,0,2,2,0,1,2,2,1,0,2,1,1,2,2,0,0,0,3,0,0,0,2,0,0,0,0,
+    0,0,2,0,0,2,1,0,0,0,2,2,1,0,0,0,0,0,0,0,0,0,2,0,1,0,2,0,1,0,0,0,
+    0,0,2,1,0,2,0,0,0,0,1,2,2,1,0,2,0,1,0,0,0,2,0,0,0,1,0,2,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,2,0,0,2,1,1,2,2,0,1,0,2,0,1,0,0,0,0,0,2,0,
+    0,0,0,0,0,0,1,0,0,0,0,2,0,9,0,3,0,1,0,0,0,0,0,0,0,1,0,2,0,8,2,4,
+    0,2,1,0,0,0,2,2,0,2,0,0,0,2,0,0,0,0,0,1,0,2,0,0,1,1,2,2,0,0,0,1,
+    0,8,0,0,0,1,0,2,0,1,0,0,2,0,1,0,0,0,0,0,0,1,0,6,2,4,1,1,2,0,1,0,
+    2,1,1,0,0,0,2,0,1,1,0,14,2,1,1,0,0,1,2,1,1,0,0,1,2,0,0,14,1,0,0,0,
+    2,3,0,1,1,0,0,0,2,3,0,22,1,1,0,3,2,1,0,1,0,1,1,28,0,3,2,3,0,3,0,3,
+    0,3,1,1,0,3,2,3,0,1,0,3,0,1,0,0,1,3,2,1,0,1,0,1,0,0,0,1,0,1,1,0,
+    2,1,0,1,0,0,0,0,0,1,0,0,0,0,1,1,2,0,0,1,0,2,0,1,0,0,0,2,0,1,0,0,
+    0,0,0,0,0,0,0,0,132,1,31,2,22,13,5,26,25,19,2,45,2,11,3,9,3,7,1,9,0,7,0,5,
+    0,7,0,3,4,3,2,5,0,3,2,1,4,1,0,0,2,1,2,0,0,1,2,0,4,0,2,3,1,0,23,0,
+    4,2,4,1,0,1,0,0,4,0,2,0,2,1,0,2,2,0,4,6,2,0,2,0,2,0,1,0,2,0,1,1,
+    0,2,4,0,0,0,4,0,0,0,2,0,0,0,2,0,1,0,2,0,2,0,0,0,0,0,0,0,0,0,1,0,
+    0,0,7,0,2,0,2,0,0,0,4,0,1,0,0,0,2,0,1,0,0,1,0,2,1,1,2,2,0,0,2,0,
+    4,0,1,2,2,0,2,0,1,0,2,0,0,1,2,0,1,2,2,0,0,1,0,2,3,0,2,0,1,0,2,0,
+    0,0,0,0,2,0,1,2,2,1,0,0,0,0,0,2,0,0,0,0,0,0,0,1,2,2,0,1,0,2,0,0,
+    0,0,0,0,0,0,1,1,2,2,0,0,0,0,0,0,0,0,2,0,0,0,1,0,2,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,2,0,0,0,0,0,1,0,2,0,0,0,0,0,1,2,0,1,2,0,0,2,0,0,0,1,
+    0,0,0,0,0,0,0,2,0,0,0,0,2,1,0,2,0,0,0,1,0,2,0,1,0,2,0,1,1,2,5,1,
+    3,0,1,0,0,2,0,1,1,0,9,0,4,0,12,2,6,0,2,0,2,0,2,1,0,2,2,0,1,0,0,0,
+    2,0,2,0,4,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,10,0,0,0,0,0,
+    1,0,2,0,1,2,0,1,1,0,0,2,14,1,1,2,0,0,1,1,0,2,1,0,1,1,0,0,0,2,18,0,
+    1,1,1,2,1,0,1,0,3,1,0,0,26,2,3,0,1,1,3,0,1,2,3,0,34,0,5,1,5,0,3,2,
+    3,0,3,0,3,0,1,1,3,0,1,2,1,0,3,0,3,0,1,1,1,0,1,2,1,0,1,0,1,0,0,0,
+    1,1,1,0,0,2,1,0,1,0,0,0,1,0,0,0,0,1,1,2,2,0,1,0,0,0,0,0,1,0,0,0,
+    0,1,2,2,1,0,0,0,0,132,1,31,4,20,13,1,11,27,13,13,11,8,11,6,9,0,9,3,7,0,7,1,
+    5,0,5,4,5,1,3,2,5,2,5,0,1,2,0,4,1,4,1,1,1,2,1,2,0,0,1,4,2,19,1,1,
+    0,0,3,2,2,4,1,4,0,0,1,1,0,2,2,6,1,0,0,2,8,2,2,2,1,0,0,4,0,0,0,2,
+    2,0,1,0,0,0,1,0,2,2,0,0,0,4,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,2,
+    0,0,0,9,0,1,0,2,0,2,0,1,0,4,0,0,0,0,0,2,2,0,1,0,0,0,0,0,0,2,0,1,
+    0,1,0,2,1,0,2,0,0,4,0,0,0,0,2,0,0,2,0,0,1,0,2,1,1,0,0,0,0,2,2,0,
+    0,0,0,0,0,0,0,2,0,1,0,0,0,2,0,0,0,0,0,0,0,2,0,0,2,1,1,2,2,0,1,0,
+    0,2,0,0,0,3,0,2,2,0,1,0,2,0,1,0,0,0,2,0,0,0,0,2,1,1,2,2,0,0,0,0,
+    0,0,0,2,0,1,0,0,2,0,1,0,0,2,0,1,0,2,2,0,1,0,0,0,0,0,2,0,1,0,0,0,
+    0,0,0,0,2,2,0,1,1,0,0,0,0,2,2,0,0,2,1,0,2,0,1,1,2,0,1,0,2,0,1,0,
+    2,0,0,0,0,0,1,0,0,0,2,4,0,3,0,11,1,5,0,0,0,1,0,1,2,0,1,1,2,10,0,8,
+    0,2,1,2,2,6,0,2,0,0,0,2,0,0,0,0,0,0,0,0,0,1,0,0,2,2,1,10,2,0,1,1,
+    2,2,1,3,0,0,0,0,0,0,2,1,1,18,0,1,0,1,0,0,2,3,1,0,0,0,2,1,0,1,1,22,
+    0,3,2,0,1,1,0,1,2,1,0,1,0,28,1,3,0,3,2,1,0,3,1,1,0,36,2,1,0,5,0,3,
+    1,5,0,3,2,3,0,5,0,1,0,3,1,3,2,3,0,1,0,1,0,3,0,1,1,1,2,1,0,1,0,3,
+    0,0,0,1,0,1,1,0,2,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,
+    0,1,0,0,0,2,0,1,0,0,130,1,29,6,16,9,13,13,11,13,13,11,11,9,12,9,12,7,1,7,1,7,
+    0,9,2,5,1,3,4,7,1,1,4,7,0,1,2,3,2,0,0,1,4,1,2,0,0,1,2,0,23,1,1,2,
+    6,1,2,0,0,3,2,2,2,0,2,0,4,1,0,1,1,0,4,0,2,8,2,1,0,2,4,0,2,0,0,0,
+    2,0,2,0,0,0,2,0,1,1,0,0,2,0,0,2,0,0,2,0,2,0,2,0,0,0,0,0,0,0,2,0,
+    0,0,0,0,7,0,2,0,1,0,0,0,2,0,1,0,2,0,2,0,0,0,2,2,0,1,2,2,0,1,0,0,
+    0,0,0,0,0,2,0,1,2,0,1,0,0,0,0,1,0,2,2,0,2,2,0,1,5,2,2,0,0,0,0,0,
+    2,0,0,0,2,1,0,2,0,0,2,0,0,0,1,0,2,0,0,0,2,0,1,0,2,0,0,0,0,0,0,0,
+    0,2,0,0,0,0,0,0,0,1,0,2,0,1,0,2,2,0,0,1,0,0,0,0,0,2,0,0,0,0,0,0,
+    0,0,2,0,1,0,0,0,0,1,0,4,2,1,0,0,0,0,0,0,0,0,2,0,0,0,1,0,0,0,0,0,
+    0,2,0,0,0,1,0,0,0,2,0,0,0,0,4,1,0,0,1,2,0,1,0,2,2,0,0,0,0,1,0,2,
+    0,1,1,2,2,0,0,0,0,0,0,1,4,2,0,0,0,0,1,0,0,0,0,0,0,1,0,2,0,1,7,0,
+    7,0,3,2,7,1,9,0,1,0,0,2,0,0,20,1,10,2,4,0,4,0,2,0,2,0,0,0,10,0,0,0,
+    0,0,0,0,0,2,0,1,1,2,0,1,0,0,16,2,0,1,1,2,1,1,2,0,1,2,1,1,1,0,0,2,
+    22,0,0,1,3,0,1,2,1,1,1,0,1,2,30,0,1,0,3,1,3,2,1,0,3,0,3,1,40,0,3,2,
+    5,0,5,0,3,1,5,0,3,2,3,0,3,0,3,1,1,0,3,2,3,0,1,0,3,0,1,1,3,0,1,2,
+    0,0,3,0,0,0,1,0,1,1,0,2,3,0,0,0,1,0,0,0,0,1,1,2,0,0,0,0,1,0,0,0,
+    0,0,0,0,1,0,0,0,2,0,1,132,1,31,4,18,9,13,11,9,11,13,11,9,9,9,9,8,9,22,9,1,
+    5,0,5,1,7,2,5,1,3,4,5,0,9,4,1,1,0,2,3,2,0,2,0,2,1,3,1,19,0,0,1,2,
+    1,2,0,4,0,4,0,0,1,0,1,2,0,4,2,2,1,4,0,1,1,0,1,0,12,4,1,2,0,0,0,2,
+    0,2,0,2,0,2,0,0,0,2,0,2,0,1,0,0,1,2,0,0,0,0,2,0,0,2,0,2,0,0,0,0,
+    0,2,0,1,0,5,0,2,0,0,0,2,0,0,0,2,0,1,0,0,0,0,1,0,0,0,2,0,0,2,0,0,
+    0,2,0,2,2,0,1,0,0,1,0,2,0,1,0,2,0,0,0,0,0,1,0,2,0,9,0,2,0,2,0,2,
+    0,2,0,2,2,0,0,0,1,2,0,0,2,0,0,2,0,0,0,0,0,0,0,0,0,0,0,2,2,1,1,2,
+    2,0,1,0,0,0,0,0,0,0,2,1,1,2,2,0,1,0,2,0,0,0,0,2,0,0,0,0,0,0,1,0,
+    2,0,1,0,2,0,0,2,0,1,0,2,1,0,2,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,0,2,
+    2,0,1,0,0,0,0,1,0,2,0,0,0,0,0,2,2,0,0,0,1,0,2,0,0,0,1,0,2,0,0,0,
+    1,1,2,2,1,0,0,1,2,0,0,0,0,6,1,0,0,0,0,0,0,1,0,2,0,1,2,0,0,0,0,0,
+    0,0,0,0,0,6,0,0,0,2,0,1,0,1,1,17,2,9,0,5,1,3,2,0,1,1,0,0,2,5,1,26,
+    2,10,0,6,0,4,0,2,0,2,0,0,0,2,2,6,1,10,0,0,0,1,0,1,2,0,1,1,0,0,2,0,
+    1,24,0,1,2,1,0,1,1,3,0,0,2,1,1,34,0,3,2,1,0,3,1,5,0,1,2,1,0,46,0,7,
+    1,5,0,3,2,5,0,3,0,5,1,5,2,3,0,3,0,5,0,3,1,1,2,3,0,1,0,3,0,1,0,1,
+    1,3,2,1,0,1,0,1,0,1,0,1,1,0,2,1,0,1,0,1,0,0,0,0,1,1,2,1,0,0,0,0,
+    0,0,0,0,0,0,0,1,0,0,0,2,130,1,31,8,18,9,13,11,9,9,9,11,7,9,9,11,9,7,0,7,
+    20,7,14,7,0,5,1,7,2,3,0,5,0,9,2,1,4,1,1,1,2,1,2,1,13,0,11,1,0,1,4,0,
+    2,0,0,1,4,0,2,0,4,1,4,0,0,0,1,1,2,0,2,0,6,0,0,0,2,4,1,2,0,0,4,0,
+    2,0,0,1,2,2,2,0,2,0,0,0,0,0,4,0,0,0,0,0,0,0,0,1,0,0,2,0,1,0,4,2,
+    0,0,0,0,9,0,2,0,2,0,2,0,1,0,2,0,0,0,2,0,0,0,0,2,2,1,0,0,0,0,0,0,
+    0,0,0,0,0,0,2,0,0,0,2,0,0,0,2,2,0,0,0,1,1,0,2,0,1,0,5,0,0,0,0,0,
+    0,0,1,0,0,1,2,2,2,0,2,2,2,0,2,1,0,2,0,0,2,0,0,0,0,0,0,0,0,0,2,0,
+    0,0,0,0,0,0,0,0,1,0,0,0,2,2,0,1,0,2,0,1,2,0,0,0,1,0,0,0,2,0,0,2,
+    0,1,0,2,0,1,0,2,0,0,2,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
+    1,0,0,0,0,0,0,0,2,0,1,0,2,0,1,0,6,0,0,0,0,2,0,1,0,0,1,2,0,1,0,2,
+    0,0,2,1,1,2,0,0,0,1,0,2,0,0,6,0,1,0,0,0,0,0,2,0,1,0,0,0,0,0,0,0,
+    1,0,0,0,2,0,1,0,8,0,1,0,0,0,2,0,1,0,1,0,2,0,1,0,0,0,0,0,0,0,11,0,
+    25,0,9,1,5,2,3,1,1,2,0,1,12,2,24,0,12,0,10,2,6,1,6,0,2,0,2,0,2,2,1,1,
+    0,0,26,2,1,1,1,0,1,2,0,0,1,1,1,0,10,2,26,1,5,0,3,2,1,0,3,1,3,0,52,2,
+    5,0,5,0,5,1,7,2,3,0,5,0,3,1,5,0,5,2,1,0,3,0,5,1,1,0,3,2,3,0,3,0,
+    1,0,1,1,3,2,1,0,3,0,0,0,1,0,1,1,1,2,1,0,0,0,1,0,1,0,0,0,0,0,1,0,
+    1,0,0,0,0,0,0,1,0,2,1,0,0,132,1,29,6,16,9,15,9,5,11,7,7,11,11,9,7,3,9,5,
+    7,1,9,0,5,16,5,12,5,8,7,0,3,2,11,0,1,0,3,5,0,9,1,13,1,2,1,4,0,6,0,2,
+    1,2,1,2,1,2,0,0,0,4,0,2,0,4,1,2,1,0,0,0,0,0,0,4,0,2,8,2,1,2,0,1,
+    0,2,0,2,0,0,1,2,0,0,2,2,0,2,0,0,0,2,0,2,0,0,0,2,0,0,0,1,0,2,0,0,
+    1,0,0,0,0,9,2,2,0,0,0,2,0,4,0,0,0,0,0,2,0,0,0,2,0,0,2,0,1,2,0,1,
+    0,2,0,0,0,0,1,1,2,2,0,0,0,0,0,0,0,2,0,2,0,0,0,0,0,0,2,3,1,0,0,1,
+    0,0,0,0,0,2,2,0,1,0,0,1,0,0,1,1,2,2,0,2,0,2,0,0,2,4,0,0,0,0,1,0,
+    2,0,0,2,0,1,0,2,0,1,0,2,0,0,0,0,0,0,0,0,0,0,2,0,0,2,0,0,0,0,0,0,
+    1,0,2,0,0,0,0,2,1,1,2,0,0,2,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,1,0,2,
+    2,0,1,0,0,0,0,0,2,0,0,0,0,1,0,2,0,2,1,0,0,0,0,0,2,0,1,2,0,0,2,0,
+    1,0,2,1,0,2,1,1,2,2,0,1,1,0,0,6,2,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,1,1,2,2,8,0,0,0,0,0,1,0,1,0,2,0,1,0,0,0,0,2,1,1,0,0,12,
+    0,1,0,0,0,1,0,0,0,0,0,1,0,11,0,25,1,33,2,19,1,5,0,3,2,0,1,22,2,40,0,22,
+    0,8,0,20,0,6,0,4,2,4,1,0,0,0,2,1,0,2,1,36,0,1,2,1,1,3,0,3,2,1,0,56,
+    1,5,0,5,2,5,0,5,1,5,0,5,2,5,0,3,0,3,1,5,2,5,0,1,0,5,0,3,1,3,2,1,
+    0,5,0,1,0,1,1,3,2,1,0,1,0,3,0,1,0,0,0,1,0,1,0,1,0,0,0,3,1,0,2,0,
+    0,0,0,1,0,1,0,0,0,0,0,0,0,1,130,1,31,8,16,5,11,11,5,9,9,11,9,7,5,9,7,9,
+    7,5,0,7,3,7,1,5,0,7,0,5,6,5,2,13,2,1,3,0,4,1,2,1,2,1,2,1,2,1,2,0,
+    4,1,4,1,2,2,0,3,4,1,0,0,2,0,2,0,4,0,4,0,0,1,0,0,0,1,2,8,4,2,0,1,
+    2,0,0,1,0,2,2,0,0,0,2,1,2,2,0,0,2,1,2,2,0,0,2,1,0,2,2,0,2,0,0,1,
+    1,2,2,0,0,1,13,0,0,0,2,0,2,0,0,2,2,0,4,0,0,0,2,0,0,0,0,0,2,0,0,0,
+    2,0,0,0,0,0,0,2,2,1,1,0,2,0,1,0,2,0,1,0,0,0,2,0,0,0,2,0,5,2,0,0,
+    2,0,2,0,0,0,0,1,1,2,0,0,0,1,0,2,2,0,0,1,1,0,0,0,0,1,1,2,2,0,2,2,
+    2,0,0,1,2,2,2,0,0,0,3,0,0,0,2,0,0,2,2,1,0,2,0,1,0,0,0,0,2,0,1,0,
+    2,2,0,0,0,1,0,2,0,0,2,1,0,2,1,0,2,0,2,0,1,0,0,0,0,0,0,0,2,0,0,0,
+    1,0,2,0,0,0,0,2,0,1,0,0,0,0,0,0,0,0,4,2,0,0,0,1,0,0,0,2,0,1,1,0,
+    2,2,1,1,2,0,1,2,2,1,1,2,2,0,0,0,6,1,0,0,1,2,2,0,1,0,0,0,0,0,0,0,
+    0,0,0,0,1,0,0,0,1,0,12,0,1,0,0,0,1,0,2,0,1,0,0,0,0,0,1,0,0,0,0,0,
+    12,0,0,0,1,0,1,0,0,2,1,1,0,0,1,0,0,0,16,0,1,0,0,2,1,1,1,2,25,1,39,1,
+    19,2,9,0,75,1,3,2,1,1,74,2,52,0,24,0,16,0,6,2,34,0,6,1,2,0,0,2,0,1,1,0,
+    16,2,40,0,5,1,3,0,3,2,7,0,3,1,3,0,5,2,5,0,3,1,3,0,5,2,5,0,3,0,1,1,
+    5,2,1,0,3,0,3,0,1,1,1,2,5,0,0,0,3,0,1,1,1,2,1,0,1,0,1,0,0,0,1,1,
+    1,2,1,0,0,0,0,0,1,0,0,0,0,0,0,106,29,32,12,7,11,7,3,9,7,9,7,9,7,7,5,7,
+    5,9,3,7,1,5,3,7,0,5,2,5,1,3,2,15,1,3,6,1,0,1,2,1,4,1,2,1,0,0,4,3,
+    2,2,4,0,4,3,2,0,0,0,2,1,2,1,2,0,0,0,4,0,2,0,4,1,0,0,0,6,0,0,2,0,
+    2,0,2,0,2,0,0,0,0,1,0,2,2,1,2,0,0,2,0,1,2,0,2,2,2,0,0,0,0,0,2,0,
+    2,1,0,0,3,2,5,0,0,0,0,0,0,0,0,1,0,0,0,2,4,1,0,2,2,1,2,0,0,2,2,0,
+    0,0,0,0,2,0,0,0,0,0,2,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,5,1,0,2,
+    2,0,0,0,2,0,0,2,2,1,0,0,2,0,0,0,0,0,1,2,2,1,1,2,0,0,2,1,1,0,0,0,
+    0,0,0,0,1,0,2,0,0,2,1,0,2,0,2,0,0,1,2,2,0,0,2,0,0,0,0,0,0,0,2,0,
+    1,0,2,0,0,2,0,1,0,2,0,0,0,1,2,0,0,0,0,2,2,1,0,0,0,2,0,0,1,1,2,2,
+    0,1,0,2,0,0,0,0,0,0,0,0,0,0,2,0,1,0,6,0,0,0,0,2,0,1,1,0,0,2,2,1,
+    1,0,0,0,0,2,0,1,0,2,0,1,0,0,0,2,6,0,0,0,0,1,1,0,2,0,0,2,0,0,1,0,
+    0,1,0,0,0,0,0,2,0,0,8,0,0,0,0,1,0,2,1,0,0,0,1,0,0,0,0,0,0,0,1,0,
+    14,0,1,0,0,2,0,1,1,0,1,0,0,2,1,1,0,2,4,1,12,2,1,1,1,0,1,0,0,0,1,2,
+    1,1,0,0,20,2,1,1,1,0,77,0,49,0,23,1,13,2,41,1,97,2,82,0,116,2,56,1,28,0,14,2,
+    8,1,52,0,6,2,0,0,0,1,0,2,3,0,3,0,3,1,3,2,5,0,3,0,3,1,1,2,5,0,3,0,
+    3,1,3,0,5,2,1,0,3,0,3,1,1,2,3,0,1,0,1,0,1,1,3,2,1,0,1,0,0,0,1,0,
+    1,0,0,0,1,0,1,0,0,0,1,1,0,2,0,64,31,74,14,3,11,9,3,9,5,9,7,7,5,9,7,7,
+    3,9,7,5,2,7,1,7,3,3,0,5,2,7,1,15,2,1,0,3,4,1,2,1,2,0,2,1,2,1,2,0,
+    2,3,2,0,2,0,4,0,4,1,0,0,2,1,0,1,4,0,0,0,4,0,0,0,4,1,0,2,2,4,0,0,
+    0,0,2,0,2,0,2,0,2,0,0,0,0,0,0,1,2,0,2,2,0,0,0,1,0,0,2,0,2,0,0,2,
+    2,0,0,0,9,0,0,1,2,2,0,1,0,0,2,2,0,0,0,1,1,2,2,1,0,2,2,0,2,0,2,1,
+    2,2,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,2,0,0,2,0,0,0,1,0,0,7,2,2,1,
+    1,0,0,0,2,0,0,0,0,0,2,2,0,0,2,0,2,0,0,1,0,2,2,1,0,2,0,0,0,0,0,1,
+    1,0,0,2,0,1,0,2,0,1,7,0,0,0,1,0,4,2,0,1,2,0,2,2,4,0,0,0,0,0,2,0,
+    2,0,1,0,2,0,0,0,0,0,0,0,2,2,1,0,2,0,0,1,0,2,0,0,0,0,2,0,0,0,0,0,
+    0,0,0,0,0,0,0,1,0,2,0,0,2,0,1,0,2,0,2,0,0,0,0,0,0,2,2,1,0,0,1,2,
+    0,1,2,2,1,1,2,2,1,1,0,2,0,0,0,1,8,0,0,2,0,0,0,0,1,0,0,1,0,0,0,0,
+    1,2,0,0,0,0,0,0,0,0,12,0,1,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,
+    14,2,0,1,1,0,1,0,0,0,0,0,1,0,0,0,3,0,0,0,20,0,3,0,0,2,1,1,1,2,1,1,
+    1,0,1,2,26,1,3,0,1,2,1,1,3,2,1,0,1,1,30,2,3,1,85,0,115,1,51,2,23,0,9,1,
+    143,1,2,68,0,192,1,0,88,0,46,2,24,1,16,0,8,2,4,0,0,1,0,0,1,2,1,0,3,1,1,0,
+    5,2,1,0,3,0,3,1,3,2,3,0,1,0,3,1,3,2,1,0,3,0,1,0,1,1,1,2,1,0,3,0,
+    1,0,1,1,1,2,1,0,0,0,1,0,0,0,1,0,0,66,29,72,12,5,13,7,1,7,5,7,5,11,5,7,
+    5,7,5,5,3,7,3,7,0,5,1,7,1,5,0,3,2,21,0,0,0,1,0,1,4,1,0,3,4,0,4,1,
+    0,1,2,0,0,3,4,0,2,1,4,0,4,0,1,0,4,1,0,0,2,1,0,1,2,0,2,2,4,0,2,4,
+    0,0,2,0,0,0,0,1,2,0,0,2,4,1,2,0,0,2,0,0,0,1,0,0,2,2,2,1,0,0,0,0,
+    2,0,1,0,4,2,13,1,2,2,2,1,2,2,2,0,0,1,2,0,0,0,0,0,0,2,2,1,1,0,0,0,
+    0,2,0,1,4,2,2,0,0,1,2,2,0,0,0,0,2,0,0,0,0,0,0,0,0,0,2,2,0,1,3,0,
+    1,0,2,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,2,2,0,1,0,2,2,1,0,0,2,0,
+    0,2,0,0,2,0,0,0,1,1,0,0,3,2,0,1,0,0,1,0,0,2,2,1,1,0,1,0,2,2,2,0,
+    0,0,0,0,4,0,0,0,2,2,0,1,2,2,1,1,2,0,2,0,0,2,0,0,0,0,2,1,1,0,2,2,
+    0,1,0,2,0,0,0,0,2,0,0,0,1,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,2,0,1,
+    0,0,0,2,0,1,0,2,1,1,0,2,2,1,1,0,0,2,8,0,0,1,0,0,0,2,0,0,1,0,0,0,
+    0,0,0,0,0,0,0,0,1,0,0,0,12,0,0,1,0,2,1,0,0,0,0,0,0,0,1,0,1,0,0,0,
+    0,0,16,0,1,0,1,0,0,0,1,0,1,0,0,0,1,2,0,1,0,2,18,1,0,0,3,0,1,0,0,0,
+    1,0,1,2,1,1,26,0,1,2,3,1,1,2,3,1,3,0,1,2,2,1,30,0,3,2,5,0,3,1,3,2,
+    3,0,40,1,157,1,0,189,1,0,81,0,37,1,11,2,1,0,222,1,0,114,0,58,2,28,0,18,1,6,2,4,
+    0,2,0,2,1,1,2,3,0,0,0,3,1,1,2,5,0,1,0,1,1,3,2,3,0,3,0,1,0,1,1,3,
+    2,1,0,1,0,0,0,3,0,0,0,1,0,1,0,1,0,0,0,0,64,31,74,8,3,7,7,3,9,1,7,5,
+    7,7,7,3,9,3,7,3,5,5,7,0,5,1,5,1,5,2,19,1,5,0,3,2,1,2,1,0,1,4,1,1,
+    1,4,1,2,1,2,1,2,0,0,1,4,0,2,0,2,1,6,1,0,2,0,1,2,1,2,0,2,0,0,1,2,
+    0,0,8,4,0,2,1,2,2,0,0,0,1,0,0,0,0,2,0,2,0,2,1,0,0,2,0,1,0,0,0,2,
+    2,2,0,0,1,2,2,1,1,11,2,2,1,2,2,2,0,0,1,2,2,2,0,2,0,0,0,2,1,1,2,2,
+    0,0,1,0,0,0,2,0,1,0,0,0,2,2,1,2,2,2,0,0,0,2,0,0,0,0,0,2,0,1,0,3,
+    0,0,0,2,0,0,2,0,0,2,1,0,0,0,2,0,1,0,0,0,0,1,0,0,0,2,2,0,1,0,0,0,
+    2,2,0,0,0,2,0,0,1,0,2,2,0,0,0,1,1,0,2,0,0,0,0,0,0,1,0,0,0,0,0,1,
+    1,0,0,0,2,0,1,0,0,0,0,2,0,0,2,0,1,2,2,2,0,1,2,2,1,2,0,2,0,0,2,2,
+    0,1,1,0,2,2,0,0,1,0,2,0,0,0,1,2,2,1,0,2,0,0,0,2,0,2,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,2,1,1,10,0,0,2,0,0,1,1,2,0,1,
+    0,0,0,0,2,0,0,1,0,0,0,0,1,0,0,12,0,0,2,1,0,0,0,1,0,0,1,1,2,0,0,0,
+    0,0,0,1,0,18,0,0,0,1,0,1,0,0,0,1,2,1,1,0,0,1,0,1,0,24,0,3,2,0,1,1,
+    2,3,1,1,2,1,1,0,0,28,2,3,1,1,2,3,1,3,0,1,2,1,1,1,0,34,2,5,1,3,0,3,
+    2,3,1,3,0,46,2,7,0,7,1,5,2,5,0,5,1,5,0,221,1,0,107,0,47,1,15,2,5,0,166,1,
+    0,116,0,52,2,26,0,14,1,8,0,2,2,4,0,1,1,0,2,1,0,3,0,1,1,3,2,1,0,1,0,3,
+    0,1,0,3,0,1,0,1,0,1,1,3,2,1,0,0,0,0,0,1,1,0,64,29,74,7,3,6,5,1,7,3,
+    9,5,7,5,7,3,7,5,5,3,9,1,5,3,5,2,7,1,5,3,23,2,3,2,1,1,1,2,3,0,1,2,
+    0,4,1,1,1,4,0,2,1,2,1,2,1,0,0,2,1,4,1,0,2,4,3,4,0,0,0,2,0,0,1,2,
+    0,0,1,2,8,2,1,2,2,2,1,2,0,0,0,2,0,0,0,0,0,2,0,0,0,2,0,0,0,4,0,0,
+    0,0,1,1,0,2,0,0,0,13,0,0,0,2,0,0,0,2,0,2,2,2,1,2,2,2,0,2,1,0,2,2,
+    1,0,0,0,2,2,0,0,1,0,0,0,0,2,0,1,2,0,1,0,0,2,0,0,0,2,2,2,1,0,2,2,
+    0,7,0,0,0,2,0,2,0,0,0,0,2,0,1,2,0,0,0,0,2,0,0,2,1,0,0,0,0,0,0,0,
+    2,0,1,1,0,0,0,2,0,1,0,2,0,0,2,1,0,2,0,0,0,2,0,2,0,1,0,2,0,0,0,0,
+    0,2,0,1,0,1,1,0,2,0,0,1,0,1,0,2,1,0,2,0,1,1,2,1,1,0,0,0,2,0,0,4,
+    0,2,0,4,2,0,1,2,0,0,2,2,1,1,2,2,0,0,1,2,2,1,0,0,0,0,0,6,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,2,0,1,0,0,10,2,1,1,0,0,0,2,1,
+    0,2,0,1,0,0,1,0,0,0,0,0,0,0,2,1,0,14,0,0,0,1,0,0,0,0,1,1,2,0,0,1,
+    0,0,1,0,2,1,0,20,0,3,0,0,0,1,0,1,0,0,0,1,0,1,0,0,0,1,0,24,0,0,0,3,
+    0,1,0,1,0,1,0,1,0,3,2,6,1,24,0,3,0,3,0,1,2,1,1,3,0,3,2,40,1,5,2,3,
+    0,5,1,3,2,3,0,42,1,0,2,7,0,5,1,5,0,7,2,5,0,5,1,5,2,3,0,5,1,3,0,161,
+    1,0,109,0,41,1,15,2,0,0,176,1,2,80,1,34,2,18,0,10,1,4,2,4,0,1,0,0,1,1,2,1,
+    0,3,0,1,1,0,2,3,0,3,0,1,0,0,0,3,0,1,0,1,0,0,0,1,66,31,40,7,30,6,7,0,
+    7,3,7,3,7,3,7,5,5,3,9,3,5,3,5,1,7,1,5,1,5,0,25,0,1,0,3,2,3,1,0,4,
+    1,0,3,0,1,4,0,0,3,2,0,4,1,2,0,0,3,0,0,2,0,4,1,0,0,4,0,2,1,0,1,2,
+    0,2,0,2,0,0,4,2,2,0,1,2,0,2,0,2,2,2,1,2,0,0,0,1,1,2,0,0,2,2,1,0,
+    0,2,0,0,0,4,0,1,2,2,1,19,0,2,0,2,0,2,0,2,0,2,0,0,0,0,0,2,0,2,2,2,
+    1,2,2,0,0,2,0,0,1,2,2,0,0,0,0,0,0,2,1,0,0,0,2,1,0,2,0,0,1,0,2,0,
+    1,2,0,5,2,2,0,0,0,0,0,4,0,0,0,0,2,2,1,0,2,0,1,2,0,0,2,0,0,0,1,0,
+    2,0,1,2,0,0,0,0,0,1,0,2,2,1,1,2,0,5,0,0,0,0,2,2,0,0,0,4,1,0,2,0,
+    0,2,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,9,0,2,0,2,1,0,
+    0,1,2,2,0,0,1,2,2,0,0,0,0,2,0,4,0,0,0,2,2,0,1,0,0,2,2,0,0,4,0,2,
+    0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,0,0,0,0,0,0,0,0,2,10,1,0,0,0,2,0,
+    1,0,0,1,0,0,0,0,2,0,0,0,0,1,0,0,0,0,0,14,0,1,0,2,1,1,0,1,2,0,0,0,
+    0,0,0,1,0,1,0,0,0,6,1,14,2,1,0,1,0,1,0,1,0,0,0,1,0,1,0,0,0,26,0,3,
+    0,1,2,1,1,1,2,1,1,1,0,1,0,3,0,34,2,3,1,1,2,3,1,3,0,3,2,1,1,42,2,3,
+    1,5,0,5,2,5,1,3,0,3,2,52,1,7,0,9,2,5,0,7,1,5,2,5,0,5,1,5,2,3,0,3,
+    0,5,1,3,2,3,0,1,1,3,2,171,1,1,71,0,23,1,3,2,112,2,90,1,38,0,18,2,10,0,4,1,
+    0,2,0,0,0,0,3,1,1,2,1,0,1,0,3,1,0,2,1,0,3,0,1,0,0,64,29,4,9,66,6,5,
+    0,5,3,7,3,7,3,7,5,7,1,5,3,7,1,7,5,5,0,3,0,11,1,23,1,3,2,0,0,1,2,3,
+    1,1,2,1,2,1,2,1,2,1,0,1,0,0,4,1,4,0,0,3,0,0,0,1,4,0,0,1,4,2,4,1,
+    2,0,0,1,0,1,4,8,0,1,0,0,0,0,2,0,2,0,2,0,2,0,0,0,4,0,1,0,2,1,0,2,
+    0,1,2,2,0,0,0,0,2,1,5,0,5,0,1,0,0,0,0,0,0,0,2,0,4,0,0,0,0,0,2,0,
+    0,0,2,0,4,0,2,0,0,2,2,1,0,0,2,0,0,0,0,2,0,0,0,1,2,0,1,0,0,2,2,1,
+    0,0,0,0,11,0,2,0,4,2,2,1,0,2,2,0,2,1,1,2,2,0,2,0,0,0,2,0,0,0,0,2,
+    0,1,2,2,1,0,2,0,0,0,0,0,0,1,2,2,1,1,3,2,0,0,0,1,0,0,0,0,0,2,0,1,
+    0,0,2,2,2,0,2,0,0,0,0,0,0,0,2,0,0,0,0,2,0,1,0,2,0,1,4,0,3,0,1,0,
+    0,0,1,1,3,0,0,2,0,0,0,0,2,0,0,0,0,0,2,0,1,0,2,0,0,2,2,1,4,0,2,0,
+    0,0,2,0,2,0,0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,2,1,1,
+    2,0,1,0,2,2,0,0,1,1,0,0,1,0,0,0,0,0,0,0,14,0,2,0,1,2,0,0,0,0,1,0,
+    1,0,0,1,1,2,0,0,0,0,1,0,20,0,0,0,1,0,0,0,1,0,3,0,0,0,0,0,3,0,22,2,
+    6,1,1,0,3,0,1,0,3,0,1,2,1,1,1,2,36,1,3,0,3,0,3,0,3,2,1,1,3,2,38,1,
+    2,0,5,2,3,1,5,0,5,2,3,1,58,2,7,0,7,1,9,2,5,0,7,1,5,2,7,0,5,1,5,0,
+    5,2,3,0,3,1,3,2,5,0,3,1,1,0,1,2,3,0,3,1,109,0,81,0,27,0,3,0,112,0,68,2,
+    28,1,14,2,4,0,2,0,0,1,0,2,1,0,1,0,1,1,3,2,0,0,1,0,0,64,29,4,11,68,6,5,
+    2,7,1,5,3,7,3,7,3,5,3,7,3,5,3,7,1,5,3,7,2,31,0,1,0,1,3,3,2,1,0,1,
+    0,3,0,0,2,1,0,1,2,1,4,1,0,1,0,0,2,1,4,0,2,3,2,0,0,0,2,1,0,1,2,2,
+    4,1,2,1,2,2,1,0,2,4,4,0,0,0,0,1,0,0,2,0,0,0,4,0,0,0,2,0,2,0,0,0,
+    0,0,0,1,2,0,0,0,2,0,17,2,2,0,4,1,0,2,2,1,0,0,0,0,1,0,4,0,2,0,0,0,
+    2,0,0,0,0,0,0,0,2,0,2,0,2,2,0,0,2,0,2,1,0,2,2,0,0,0,0,0,0,1,0,2,
+    0,0,0,0,7,0,0,0,1,1,0,2,2,1,2,0,2,2,2,0,2,1,0,2,0,0,0,0,4,0,1,0,
+    2,0,0,0,2,0,1,0,2,0,0,0,2,2,0,1,0,2,3,1,2,2,0,0,0,0,1,1,0,0,0,2,
+    0,0,0,1,0,0,0,2,0,0,2,0,2,0,0,0,2,0,1,0,2,0,0,0,2,0,0,0,2,2,0,0,
+    0,0,0,0,2,0,1,0,1,1,1,0,1,0,1,0,1,0,1,0,2,0,0,0,4,0,1,0,0,0,1,0,
+    0,0,0,0,0,2,4,0,2,0,4,1,0,0,2,2,2,0,0,0,2,0,1,0,2,0,0,0,10,0,0,0,
+    1,0,2,2,1,1,0,0,0,0,0,2,0,0,0,0,0,0,0,0,1,0,16,0,0,0,1,0,0,0,0,1,
+    1,0,1,2,2,0,1,0,1,1,0,2,24,0,3,0,0,0,3,0,0,0,0,0,1,0,3,0,0,0,1,0,
+    30,0,3,0,1,0,1,0,1,0,1,0,1,0,3,0,40,0,3,2,5,1,1,2,3,1,5,2,3,1,1,0,
+    50,2,5,1,7,2,5,0,5,1,3,2,64,1,9,0,9,2,7,1,7,0,7,2,7,1,5,0,5,2,7,0,
+    3,1,7,2,3,0,5,1,1,2,5,0,3,0,3,1,1,2,1,0,3,1,1,2,1,0,1,1,109,0,57,0,
+    15,0,38,0,98,0,34,2,14,0,4,1,2,2,0,0,1,0,1,0,1,0,1,0,3,64,29,4,11,22,8,40,
+    0,5,1,7,1,5,5,7,3,7,3,5,3,7,1,3,0,7,3,5,1,33,0,3,1,1,0,1,0,3,0,1,
+    2,0,0,3,2,1,0,1,2,0,0,1,4,1,0,3,2,0,2,1,0,0,2,1,2,1,0,0,2,0,2,1,
+    0,0,4,0,2,1,4,0,0,6,0,0,2,1,2,2,0,1,0,0,2,0,0,0,2,0,2,0,0,0,2,0,
+    2,0,0,0,0,0,0,1,1,2,15,1,2,0,2,2,2,1,2,0,2,0,0,0,2,0,1,1,0,2,2,1,
+    0,2,4,0,0,0,2,0,0,0,0,0,2,0,2,0,0,0,0,2,4,1,0,0,0,0,2,0,0,2,0,1,
+    2,0,0,2,9,1,0,0,2,2,0,1,0,0,0,0,1,0,2,0,0,2,2,1,4,2,0,0,0,0,4,0,
+    0,0,0,0,0,0,2,2,0,0,0,0,0,1,0,2,0,1,0,2,1,1,2,0,0,0,2,2,0,0,0,0,
+    0,1,1,2,0,0,0,1,0,2,0,0,1,0,2,0,1,1,2,0,2,2,2,0,1,0,2,2,0,1,2,0,
+    0,0,2,0,1,0,2,0,0,2,2,0,0,1,0,2,0,1,1,2,0,1,1,0,3,0,0,0,3,0,5,0,
+    4,0,2,2,4,1,0,0,0,0,0,2,0,1,0,0,0,0,2,2,2,0,4,0,0,0,0,0,10,0,0,0,
+    2,2,0,1,0,0,0,0,0,2,0,1,0,0,0,0,0,0,1,0,0,0,18,0,1,0,0,0,1,0,0,2,
+    0,0,0,0,1,0,1,1,0,2,0,0,22,0,0,1,1,2,1,0,1,0,1,0,1,0,0,0,1,0,0,0,
+    30,0,1,0,1,0,3,0,3,0,1,0,1,2,1,1,28,2,10,1,3,0,5,0,3,0,1,0,3,0,3,2,
+    52,1,5,2,5,1,5,0,5,2,7,1,24,0,38,2,7,1,9,2,9,0,7,1,9,2,5,0,7,1,5,2,
+    7,0,3,1,7,2,3,0,5,1,1,2,5,0,3,0,3,1,3,2,1,0,3,1,1,2,1,0,1,0,1,1,
+    1,2,37,1,89,0,21,0,32,2,86,0,26,1,10,2,2,0,2,1,1,0,1,0,11,62,29,6,11,1,6,66,
+    0,7,1,5,1,7,1,5,3,5,3,7,0,5,3,7,3,5,1,37,3,1,2,1,0,3,0,3,3,0,2,3,
+    2,1,0,1,0,1,2,1,0,1,0,1,2,0,4,1,0,1,0,1,4,0,2,1,0,0,2,1,2,1,0,0,
+    2,1,0,0,2,0,2,1,2,6,2,0,0,0,2,0,2,0,0,1,0,0,2,0,0,0,2,0,0,0,2,1,
+    2,2,2,0,0,1,2,2,17,1,0,0,0,0,0,0,2,0,2,0,2,0,2,0,2,2,2,0,0,1,0,0,
+    0,0,1,1,2,2,2,0,2,0,0,0,0,1,0,2,2,0,2,1,0,2,2,2,2,0,0,0,2,1,0,2,
+    0,0,1,1,3,2,2,0,0,1,0,2,0,0,1,0,2,0,0,0,0,1,0,2,0,1,0,0,2,2,0,1,
+    2,2,2,0,0,0,2,0,0,0,2,0,0,2,0,1,0,2,1,1,2,2,0,0,0,0,0,0,0,0,2,1,
+    0,2,2,0,1,0,0,0,2,1,1,0,0,0,0,0,0,2,0,0,0,0,1,1,2,2,3,1,2,2,2,0,
+    2,0,0,0,2,0,0,0,2,0,0,0,0,2,0,1,0,2,2,1,1,2,2,0,0,1,0,2,0,0,4,0,
+    3,0,3,1,3,0,3,0,3,0,0,0,2,2,6,0,2,0,2,1,1,0,1,2,2,1,0,2,3,1,4,2,
+    4,1,4,2,4,0,2,0,2,0,0,0,0,0,0,0,0,2,0,0,2,0,14,0,0,0,0,0,0,0,1,0,
+    0,0,1,1,0,0,2,2,1,0,1,0,26,1,1,2,1,0,0,0,1,1,1,2,1,0,1,0,0,0,3,0,
+    36,0,3,0,3,0,1,0,1,2,3,1,1,0,1,0,1,0,42,0,3,2,3,1,3,2,5,1,3,2,3,1,
+    60,0,7,0,5,0,7,2,5,1,5,2,5,0,74,1,11,2,9,1,9,0,7,2,7,1,9,2,7,0,7,1,
+    5,2,7,0,3,1,5,2,5,0,5,1,3,2,3,0,3,0,3,1,3,2,1,0,3,1,1,2,1,0,3,0,
+    1,1,1,2,1,0,0,1,33,1,75,2,13,2,76,1,42,2,10,0,2,1,11,0,11,64,29,4,11,0,4,8,
+    4,50,1,7,1,5,3,5,1,7,3,5,3,5,1,5,1,21,0,23,3,3,1,1,2,1,1,1,2,3,1,1,
+    0,1,2,1,1,1,2,3,0,1,4,0,1,3,2,0,2,1,2,0,0,1,2,0,2,1,2,1,0,1,2,0,
+    0,1,2,0,2,0,2,0,2,4,2,0,2,0,0,1,0,0,2,2,2,1,0,0,2,0,0,0,2,0,0,0,
+    0,1,0,0,4,2,0,0,17,0,2,0,0,1,2,0,0,0,0,0,2,0,2,0,0,0,2,0,2,0,2,2,
+    2,1,0,2,0,1,0,0,0,1,2,2,0,0,2,0,0,1,0,2,0,0,0,1,2,2,2,0,0,0,2,0,
+    2,0,9,2,2,0,2,1,0,2,2,1,0,2,2,0,0,0,0,1,0,2,0,1,0,2,2,0,1,1,0,2,
+    0,0,0,1,2,2,0,1,2,2,2,0,0,0,2,0,0,0,3,2,2,1,0,0,2,0,0,0,2,0,1,2,
+    2,0,0,1,2,2,0,0,1,0,2,0,0,0,0,0,0,0,0,0,1,1,2,2,1,1,1,2,0,1,0,2,
+    0,0,0,0,0,0,2,0,2,0,0,0,2,0,2,2,0,1,0,2,2,1,1,2,2,0,1,1,2,0,6,2,
+    0,0,0,0,0,0,0,0,2,0,3,1,1,0,7,0,1,0,3,0,1,0,0,0,4,2,4,1,6,2,2,1,
+    3,2,1,1,1,2,0,0,1,1,0,2,8,0,2,0,2,0,4,0,1,0,16,0,2,0,0,0,0,0,0,0,
+    0,0,0,2,1,0,0,0,0,0,0,1,22,2,0,0,0,0,1,1,1,2,1,0,0,0,0,0,3,0,0,0,
+    34,0,1,0,1,0,3,0,1,0,1,0,3,0,1,0,3,0,50,0,5,0,3,0,5,0,3,0,3,0,3,0,
+    10,2,46,1,7,2,5,1,7,0,5,0,7,0,84,2,11,1,11,2,9,0,11,1,7,2,9,1,7,0,7,2,
+    7,1,5,0,7,2,7,1,5,0,3,2,5,1,3,0,5,2,3,0,1,1,3,2,3,0,3,1,1,2,1,0,
+    1,0,1,1,1,2,1,0,0,0,1,1,0,0,73,0,27,1,58,0,22,2,14,2,10,62,43,6,0,0,8,1,
+    0,24,0,30,1,5,1,7,3,5,1,5,3,7,1,19,1,29,3,1,2,1,3,3,0,1,0,1,1,3,2,0,
+    1,3,2,1,2,1,1,1,2,1,0,1,4,0,1,1,2,1,2,1,2,1,1,0,4,1,2,0,2,0,0,3,
+    2,0,2,0,0,1,0,1,2,6,0,0,4,0,2,0,2,0,0,1,0,2,2,1,0,0,0,0,2,1,0,2,
+    2,0,2,0,0,0,17,1,0,0,4,0,2,2,0,1,2,2,0,0,0,0,0,1,2,0,2,0,2,0,0,0,
+    2,0,2,0,0,0,0,0,2,0,0,0,0,0,0,1,2,2,2,0,0,0,2,0,1,1,0,0,2,2,0,0,
+    0,0,9,0,4,0,0,2,2,1,2,2,2,1,2,0,0,0,2,2,0,0,0,0,0,1,0,0,0,0,0,0,
+    0,0,0,2,0,1,0,2,0,1,0,0,0,0,2,2,2,0,3,0,0,0,4,0,0,2,2,0,0,0,2,1,
+    0,0,0,2,0,1,0,2,2,0,0,0,0,0,0,0,2,0,0,0,0,0,1,0,2,2,2,1,0,0,3,0,
+    0,0,0,0,1,0,2,0,1,0,0,0,0,0,0,0,2,0,2,0,0,0,2,0,0,0,2,2,0,0,6,1,
+    0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,1,1,5,0,5,2,5,1,5,0,
+    1,0,6,2,8,1,6,2,4,0,2,1,3,2,1,0,1,1,1,0,0,0,0,2,8,0,6,0,4,0,4,0,
+    2,0,0,0,2,0,1,0,2,0,0,2,0,0,24,0,0,1,1,2,0,0,1,0,0,1,3,2,0,0,1,1,
+    6,2,30,0,3,0,1,0,1,0,3,0,1,0,3,0,1,0,50,0,3,0,5,0,3,0,3,2,5,1,3,0,
+    3,0,66,0,7,0,7,0,5,2,7,1,5,2,1,1,80,2,11,1,11,0,9,2,11,1,7,2,9,0,7,1,
+    9,2,7,0,7,1,5,2,5,0,5,1,5,2,5,0,3,1,3,2,5,0,3,1,3,2,1,0,3,1,1,2,
+    1,0,3,0,0,1,1,2,1,0,1,0,1,1,1,1,13,0,57,0,11,4,70,1,16,62,57,4,14,0,6,1,
+    2,0,0,16,1,26,1,2,1,5,3,11,1,25,1,21,3,1,0,3,1,1,1,3,1,1,2,3,0,0,1,3,
+    0,1,0,1,2,1,2,1,1,1,0,1,2,1,2,1,0,1,2,0,2,1,2,1,0,1,0,0,2,1,4,0,
+    0,0,0,1,2,1,0,0,2,6,2,1,0,0,2,0,2,0,2,0,2,1,0,0,0,0,2,0,0,0,2,0,
+    0,0,0,1,1,0,15,2,2,0,0,0,2,0,4,0,2,1,2,0,0,0,2,0,0,0,1,0,2,0,2,0,
+    0,0,2,0,2,0,0,0,0,0,2,0,2,0,0,0,0,0,1,0,2,1,0,2,2,0,2,0,0,0,0,0,
+    0,0,13,1,2,2,2,0,2,0,2,0,2,0,2,2,2,0,0,0,2,1,2,2,0,0,0,0,2,0,0,0,
+    0,0,0,1,0,2,0,1,0,2,0,0,0,0,0,0,0,1,7,0,2,2,2,0,2,0,2,0,0,0,2,2,
+    2,0,0,1,2,2,0,1,0,0,2,2,0,0,0,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,
+    0,0,0,0,2,0,3,0,0,0,0,0,1,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,2,0,4,2,
+    2,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,0,12,0,0,2,
+    0,1,9,1,9,2,7,1,3,0,3,2,1,1,10,2,6,0,4,0,4,0,10,0,5,0,5,0,1,0,3,0,
+    1,0,0,0,6,0,8,0,2,0,2,0,2,0,24,0,1,2,2,0,0,0,0,1,1,2,2,0,1,0,1,0,
+    0,0,36,0,0,0,3,0,3,0,1,0,1,0,1,0,1,0,4,0,44,0,3,2,5,1,3,0,3,0,5,2,
+    3,1,68,2,3,1,7,2,7,1,7,2,5,1,7,0,94,0,11,0,11,2,11,1,11,2,9,1,9,0,9,2,
+    7,1,9,2,5,0,7,1,7,2,7,0,5,1,5,2,5,0,3,1,5,2,3,0,1,1,5,2,1,0,3,1,
+    3,0,0,2,3,0,3,1,1,0,3,1,9,0,0,4,8,0,1,0,0,1,63,2,52,62,59,4,14,2,8,1,
+    2,3,0,1,1,1,1,4,1,3,1,9,1,1,3,3,0,3,3,0,0,3,1,1,1,3,0,1,0,1,0,3,
+    2,1,1,1,0,1,0,0,4,1,0,3,1,1,2,0,2,1,0,1,0,0,4,1,0,1,2,1,0,0,0,1,
+    4,0,2,1,0,0,2,1,0,4,0,0,2,0,0,0,2,1,4,2,0,0,2,0,2,0,0,1,0,0,2,0,
+    0,1,0,2,19,0,1,1,2,0,2,0,4,0,0,0,2,2,2,0,4,1,0,2,2,1,2,0,1,0,0,0,
+    2,0,0,0,2,0,2,0,2,0,0,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,2,0,
+    2,0,9,0,1,1,0,0,0,2,0,0,2,0,2,0,2,0,2,0,2,2,2,1,0,2,2,0,0,0,2,0,
+    0,0,2,0,0,0,0,0,0,1,1,0,2,0,1,0,2,2,7,0,2,1,1,2,0,1,0,0,2,2,2,0,
+    2,0,2,0,0,0,4,0,0,2,0,1,2,0,0,0,0,0,0,0,0,2,2,0,1,1,4,2,0,0,2,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,1,1,0,0,0,1,0,2,2,0,1,0,0,0,0,
+    1,0,0,0,4,0,4,2,2,0,0,0,0,0,2,1,0,2,0,0,0,0,0,0,0,0,0,0,12,0,0,0,
+    0,0,0,0,0,0,1,0,0,2,0,1,1,0,11,1,5,0,5,2,5,0,9,1,4,0,14,2,8,0,8,0,
+    4,0,2,0,5,0,5,0,1,0,3,0,0,0,1,0,10,0,10,0,6,0,6,2,2,0,0,1,2,0,2,2,
+    1,0,38,1,1,2,1,0,0,1,1,2,3,0,0,0,3,0,1,0,56,0,5,0,3,0,5,0,3,0,3,0,
+    3,0,5,0,74,0,7,0,7,0,7,0,7,0,5,2,22,1,66,2,13,1,11,0,9,0,11,0,11,2,7,1,
+    9,2,9,1,9,0,7,2,5,1,7,0,5,2,7,1,3,2,7,0,3,1,3,2,5,0,3,1,3,0,3,2,
+    1,0,5,1,1,1,5,0,5,0,1,4,6,0,3,1,0,2,0,0,3,1,0,0,49,62,57,4,14,0,4,0,
+    4,1,0,3,0,1,1,3,1,1,1,1,3,3,1,1,1,1,0,3,3,3,2,1,3,1,1,1,2,3,0,0,
+    1,3,2,1,1,1,2,1,0,1,2,1,0,1,0,1,2,1,0,1,2,1,0,0,2,0,2,1,2,1,0,0,
+    0,1,2,0,2,1,2,0,0,1,2,4,0,0,2,0,2,0,1,1,2,2,2,1,2,0,2,0,0,2,0,1,
+    2,0,7,0,11,1,0,2,2,0,2,1,1,0,4,2,2,1,2,0,0,2,2,1,2,0,2,2,2,1,0,0,
+    0,0,2,0,0,0,0,0,0,0,2,0,2,0,2,0,0,0,0,0,2,0,0,0,2,0,1,0,2,0,0,1,
+    13,2,0,0,2,0,4,0,2,0,0,0,0,0,1,1,0,0,2,2,2,0,0,0,4,0,2,0,0,0,0,0,
+    4,0,1,2,2,0,0,0,2,0,2,0,1,0,2,0,1,0,3,0,1,0,0,1,2,2,0,0,0,1,0,0,
+    1,0,2,2,2,0,0,0,2,0,2,0,0,2,2,0,0,0,2,0,0,0,0,1,2,2,0,0,0,0,0,0,
+    2,0,0,0,0,0,2,0,0,0,0,0,2,0,1,0,2,2,0,1,1,2,2,1,3,0,0,0,1,0,2,0,
+    0,0,4,0,3,2,1,1,0,0,0,0,0,0,4,2,0,0,2,0,2,1,2,2,1,0,2,1,12,2,0,0,
+    1,0,2,2,1,1,2,0,1,0,0,0,0,0,0,2,1,0,0,1,2,0,16,0,11,0,15,1,11,0,9,0,
+    5,2,8,0,2,0,8,0,6,0,8,0,2,0,20,0,7,0,9,0,5,0,5,0,3,1,1,2,6,0,10,0,
+    6,0,28,2,4,0,6,1,0,2,0,0,2,1,3,2,2,0,1,0,54,0,3,0,3,0,1,0,3,0,3,0,
+    3,0,3,0,76,0,7,0,7,0,5,0,7,0,7,0,7,0,104,0,11,0,11,2,13,1,11,2,9,1,11,2,
+    9,1,7,0,9,2,7,1,9,2,7,0,5,1,5,2,9,1,3,0,5,2,5,1,5,0,3,0,3,0,5,1,
+    5,0,5,0,3,2,0,2,0,0,1,1,1,2,1,0,1,0,1,0,0,0,1,0,1,62,57,4,14,0,6,1,
+    2,0,0,3,1,1,0,1,1,1,3,3,0,3,1,1,1,3,1,1,1,1,1,1,2,3,1,1,1,1,2,1,
+    0,1,1,1,0,3,0,1,2,1,0,0,2,1,0,3,1,0,4,0,0,1,0,3,2,0,2,1,2,0,0,1,
+    2,1,0,0,2,0,0,1,2,0,2,4,0,1,0,0,2,0,2,0,2,1,1,2,2,0,2,0,4,1,0,0,
+    0,0,21,0,1,0,6,1,0,0,0,2,4,0,1,1,2,0,0,0,4,0,2,0,0,2,2,1,2,2,4,1,
+    0,2,0,1,0,0,2,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,2,0,0,1,0,2,
+    11,0,1,0,2,0,1,0,2,0,4,0,0,0,4,0,0,0,0,1,1,0,2,2,0,0,0,0,2,0,4,2,
+    0,0,2,1,0,0,2,2,0,0,0,0,2,0,0,0,2,0,3,1,0,2,2,0,1,0,0,0,0,0,1,0,
+    2,0,0,0,0,1,0,2,0,0,1,0,2,0,2,0,2,0,2,0,0,0,0,2,2,0,0,1,2,2,2,1,
+    1,2,2,0,2,0,1,0,0,0,2,0,0,0,0,0,0,0,0,0,2,0,1,2,2,1,0,2,0,0,6,1,
+    0,0,3,2,1,1,1,0,1,0,2,0,2,0,3,0,0,0,0,0,1,2,2,0,4,1,0,2,10,0,0,1,
+    4,2,1,1,2,2,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,20,0,0,2,1,0,0,0,1,0,
+    0,1,11,0,5,0,11,0,9,0,7,0,4,0,3,0,2,0,16,0,10,0,8,0,6,2,2,0,5,1,9,0,
+    7,0,2,0,5,0,7,0,14,0,16,0,8,2,8,0,2,1,4,2,8,0,42,1,0,2,1,0,1,0,1,0,
+    3,0,1,0,22,2,50,1,5,2,7,1,5,2,5,1,7,2,18,1,80,2,13,1,9,2,11,1,11,0,11,0,
+    9,0,9,2,9,1,9,0,7,0,7,0,9,2,7,1,3,0,7,0,5,0,7,0,3,0,7,1,7,0,3,2,
+    1,0,1,2,3,0,1,1,3,2,1,0,3,0,1,0,1,1,1,2,1,0,0,1,1,60,55,6,10,0,6,0,
+    4,3,0,0,0,3,1,1,1,3,0,1,3,1,1,1,0,1,3,3,0,1,1,3,0,1,1,1,0,1,0,3,
+    0,1,0,1,2,0,1,3,1,1,2,1,2,1,2,0,0,1,1,3,2,0,2,1,2,1,1,0,2,1,4,0,
+    0,1,0,1,0,1,2,2,2,1,0,4,2,0,2,1,0,0,0,0,2,0,2,1,0,0,0,0,2,0,2,0,
+    17,2,1,1,2,0,1,0,2,0,2,0,2,1,2,0,0,0,2,0,1,0,2,0,4,0,0,0,2,0,0,0,
+    4,0,2,0,2,0,0,0,0,0,0,0,2,0,0,0,1,0,2,0,0,0,4,0,0,0,2,0,0,0,0,0,
+    11,1,0,2,0,0,2,0,0,0,0,1,2,2,1,0,4,0,2,0,2,0,0,0,0,1,0,2,0,0,0,1,
+    0,0,2,2,2,0,2,0,0,0,2,2,2,0,0,0,0,0,3,0,2,0,0,0,0,0,2,0,0,0,0,0,
+    0,0,1,0,0,0,0,0,0,1,2,2,0,1,1,2,2,0,1,0,2,0,2,0,0,0,0,2,2,1,2,2,
+    2,1,0,2,0,0,2,0,2,0,1,0,0,0,2,0,0,0,0,2,0,1,2,0,0,0,1,0,0,0,10,2,
+    0,0,1,1,2,0,0,0,0,0,3,0,1,0,1,0,1,0,1,0,4,0,1,0,1,2,0,1,2,0,0,2,
+    4,1,4,2,4,0,0,0,2,0,0,0,0,0,0,0,0,0,2,0,1,0,10,2,10,1,0,0,1,0,0,0,
+    1,0,1,0,0,0,1,0,0,0,1,0,9,0,8,0,7,0,21,0,11,0,4,0,2,0,2,1,2,4,12,1,
+    8,0,16,0,18,0,6,2,15,0,15,1,9,0,7,0,5,0,5,0,14,0,34,2,16,0,8,1,6,2,4,0,
+    2,0,1,0,0,1,76,2,5,0,1,0,5,0,5,0,3,0,5,0,108,0,9,0,13,0,9,0,11,2,9,1,
+    11,0,9,0,7,0,9,2,9,1,7,0,7,0,7,0,9,0,7,0,7,3,5,2,7,0,1,4,3,0,3,1,
+    5,2,3,1,3,2,3,0,3,0,1,0,3,1,1,2,3,0,0,0,1,0,1,0,1,60,57,4,12,2,8,1,
+    0,0,2,3,0,1,1,1,1,1,0,1,1,3,1,3,1,1,0,1,1,3,1,0,1,1,2,3,3,1,0,1,
+    0,1,2,1,1,3,2,0,0,1,0,1,0,1,0,1,2,1,2,1,0,1,0,0,0,1,2,1,0,1,0,0,
+    4,0,2,1,0,0,2,3,0,0,2,4,2,0,0,0,0,1,2,0,0,0,0,0,2,1,2,0,1,0,7,0,
+    13,0,2,0,4,0,2,0,2,0,0,1,0,2,2,0,2,0,2,1,2,0,0,0,0,0,2,0,2,0,2,0,
+    0,0,0,0,2,0,2,0,2,0,2,0,0,0,0,0,2,0,1,1,2,2,1,1,2,2,2,0,0,0,2,0,
+    11,0,2,0,0,0,0,0,2,1,1,2,0,1,2,2,2,0,1,0,2,0,0,0,2,0,2,0,2,0,0,0,
+    0,0,0,0,0,0,0,0,2,0,0,1,0,2,2,0,1,0,1,2,2,1,0,2,4,1,0,2,2,0,2,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,2,2,0,0,0,0,0,1,0,3,1,0,2,2,0,
+    4,0,2,0,2,0,2,2,0,0,2,0,0,0,2,0,1,0,2,1,0,2,0,0,0,0,2,0,0,0,6,0,
+    0,0,2,0,1,2,0,0,0,0,0,0,0,0,0,0,2,0,0,0,3,1,1,0,1,0,1,2,8,1,4,0,
+    3,2,1,1,3,0,1,0,0,0,6,2,2,0,2,1,2,2,0,0,0,0,0,0,20,0,0,0,1,0,0,0,
+    0,0,0,2,1,0,0,0,0,0,1,0,0,1,30,0,3,0,1,0,3,0,17,0,11,0,7,2,7,3,11,2,
+    4,0,0,0,5,0,1,0,10,0,18,2,10,1,8,0,6,2,4,0,15,1,2,0,19,0,11,0,9,0,3,0,
+    30,2,20,1,12,2,58,0,10,1,2,2,2,1,0,2,1,0,1,0,0,0,100,0,5,0,11,0,7,0,9,0,
+    7,0,9,0,11,0,7,1,9,2,9,0,7,3,7,0,7,2,7,0,5,4,5,1,5,2,7,1,5,2,3,0,
+    5,1,3,2,3,1,3,2,1,1,5,2,1,0,1,1,3,2,3,1,1,2,1,0,0,58,55,6,12,0,4,0,
+    4,1,0,0,0,1,0,3,1,1,1,3,0,0,1,3,3,1,0,3,1,0,0,3,1,1,1,3,2,1,3,1,
+    2,1,0,1,2,1,1,1,0,1,0,1,0,1,2,1,2,1,0,0,0,1,0,1,2,1,2,0,0,1,0,1,
+    0,0,2,1,2,1,0,0,2,1,0,4,0,0,2,1,2,2,0,1,2,0,2,0,0,0,0,0,1,0,21,1,
+    0,0,2,0,4,0,4,0,0,0,4,0,0,1,2,0,0,0,0,2,2,1,2,2,0,1,2,0,0,1,0,2,
+    2,0,2,0,0,0,2,0,2,0,2,0,0,0,2,0,0,0,2,0,0,0,2,0,0,1,1,0,2,2,15,0,
+    2,0,4,0,2,0,2,0,0,0,2,0,0,0,0,0,1,0,2,0,0,0,2,1,0,2,0,1,2,2,0,0,
+    2,0,2,0,0,0,0,1,0,2,0,0,2,0,0,0,9,0,2,0,0,0,4,0,0,2,2,1,2,0,0,2,
+    2,0,2,1,0,2,2,0,0,0,0,0,2,0,0,0,1,0,0,0,1,0,0,0,2,1,3,2,2,0,1,0,
+    1,0,2,0,0,0,2,0,2,0,2,0,4,0,1,0,4,0,0,2,0,0,0,0,2,0,0,0,0,0,6,0,
+    2,0,0,2,0,1,2,0,1,0,2,0,0,0,0,0,1,0,0,0,0,2,0,0,0,0,0,1,10,2,5,0,
+    3,1,1,2,1,1,6,2,0,0,3,1,1,0,1,2,1,1,2,2,4,0,2,1,16,2,0,0,4,0,0,0,
+    0,2,0,1,0,0,0,0,1,0,0,0,1,2,24,0,6,0,1,0,1,1,1,0,1,0,1,0,1,2,5,0,
+    15,1,9,0,2,0,9,0,2,0,3,0,3,0,5,0,1,0,3,0,16,2,30,1,16,0,10,2,8,0,0,1,
+    33,0,21,0,13,0,19,0,13,0,32,0,40,2,24,0,14,1,8,2,6,1,94,2,0,1,0,2,3,1,5,2,
+    7,0,7,1,5,0,9,0,7,1,7,2,7,2,7,2,5,1,5,2,7,1,7,2,5,1,3,2,5,1,7,0,
+    3,2,3,1,5,2,3,1,5,2,1,1,3,2,3,0,0,1,3,2,1,1,1,2,3,60,53,2,8,2,6,0,
+    2,1,2,1,0,1,1,1,0,1,1,1,1,3,0,0,1,3,0,1,1,3,1,1,0,1,0,1,1,1,0,1,
+    1,1,0,1,0,1,2,3,0,1,0,1,0,0,0,1,0,1,2,1,0,1,2,0,1,1,2,1,2,0,2,1,
+    1,3,2,2,2,1,2,0,0,1,0,2,2,0,2,0,0,1,2,2,0,1,0,0,2,0,0,1,27,0,0,2,
+    4,1,2,0,0,0,2,0,4,0,2,0,4,0,0,0,2,0,0,1,2,2,0,1,2,0,0,0,2,2,2,1,
+    0,1,0,2,2,0,2,1,0,2,0,0,4,0,0,0,2,0,2,0,0,0,0,0,0,0,2,0,0,0,15,1,
+    0,2,0,1,4,0,2,0,2,2,2,0,2,0,2,0,0,0,0,0,0,1,0,2,1,0,2,0,0,1,2,2,
+    0,0,0,0,2,1,0,2,2,0,2,0,1,1,0,2,9,0,2,0,2,0,0,0,2,0,2,0,0,2,2,1,
+    2,0,0,2,2,0,0,1,2,2,2,0,0,0,2,0,0,0,0,0,2,0,1,0,0,0,3,0,1,0,0,1,
+    2,2,0,0,0,0,0,1,0,2,0,0,0,0,2,0,2,0,2,0,2,0,0,0,0,2,0,0,2,0,6,0,
+    0,0,0,1,2,2,0,0,2,0,1,0,0,0,0,2,2,0,0,1,0,0,0,0,0,0,0,2,8,1,4,0,
+    0,2,0,1,1,2,5,1,1,0,3,0,1,2,2,1,2,2,1,1,1,2,1,0,2,1,0,0,6,2,6,0,
+    2,1,2,2,2,0,0,0,0,0,2,0,0,0,1,0,28,0,1,0,1,2,0,0,0,0,1,1,1,0,1,0,
+    1,2,1,0,40,1,3,0,21,0,23,0,15,0,9,0,5,0,18,0,7,0,3,0,9,0,7,0,7,1,10,2,
+    26,0,16,2,10,1,16,0,46,2,35,1,45,0,29,1,17,2,13,0,12,0,40,0,60,0,28,0,16,0,10,1,
+    4,0,2,0,1,2,1,2,1,0,5,0,5,0,5,0,5,0,7,0,3,0,5,0,5,0,7,0,5,0,3,2,
+    5,1,3,2,3,1,5,2,1,1,5,2,1,1,3,2,3,0,1,1,3,2,1,1,0,58,55,4,10,2,6,0,
+    4,0,0,1,0,3,0,0,0,3,1,1,1,1,1,3,0,1,1,0,0,3,1,1,0,3,1,0,0,3,0,1,
+    1,1,0,1,2,1,0,0,0,1,0,1,0,3,0,1,0,0,0,1,2,1,2,1,0,0,0,1,0,1,2,1,
+    2,0,1,3,2,2,0,1,2,0,2,0,0,0,0,0,2,0,0,1,2,0,2,0,0,0,27,0,2,0,0,1,
+    2,0,2,0,2,0,0,0,2,1,2,2,2,0,4,0,0,1,4,2,0,1,0,0,2,0,2,0,0,0,0,0,
+    2,0,2,1,0,0,0,2,2,0,2,1,1,0,4,0,0,0,0,2,2,1,2,2,0,0,0,0,2,1,15,2,
+    2,1,2,2,1,0,0,0,0,0,4,1,2,2,0,1,4,0,2,0,0,2,0,0,2,1,0,2,0,0,1,1,
+    0,0,2,0,0,2,2,0,0,1,0,2,2,0,2,1,11,0,0,0,0,2,2,0,0,1,2,2,0,1,4,2,
+    0,0,2,0,2,0,0,0,2,0,1,0,2,0,0,2,2,1,0,0,2,0,2,0,0,2,1,0,0,0,0,0,
+    0,0,3,1,0,2,1,0,2,1,0,2,2,0,0,0,1,0,0,0,2,0,2,0,2,0,2,0,0,0,2,0,
+    2,0,2,2,2,1,0,2,0,0,2,0,0,0,0,1,0,0,0,2,0,0,0,0,0,0,0,0,2,2,10,1,
+    0,0,1,2,2,1,0,2,1,1,0,2,0,1,3,2,3,1,3,0,1,0,0,0,14,0,2,2,7,1,3,0,
+    3,0,1,0,0,0,8,0,4,0,0,0,2,2,2,0,20,0,2,0,0,0,0,1,1,0,0,2,0,0,1,0,
+    0,0,1,0,34,0,1,0,3,0,1,0,1,2,1,1,7,0,23,0,17,1,15,2,17,0,20,0,24,0,0,0,
+    19,0,13,1,11,2,5,0,31,1,48,2,32,0,20,0,12,0,10,1,19,0,41,1,61,0,33,0,21,0,28,2,
+    68,2,42,2,26,1,16,0,8,2,6,1,2,2,0,1,1,2,1,0,5,0,1,0,3,0,3,0,3,0,3,0,
+    3,0,5,0,3,0,3,0,3,0,1,0,3,0,1,0,3,0,1,2,1,1,1,2,1,58,53,4,10,2,4,0,
+    2,1,2,1,0,0,0,3,1,1,0,1,0,1,1,1,1,1,1,3,0,0,0,3,1,1,0,1,0,1,1,1,
+    0,1,0,3,1,0,2,3,0,1,0,1,0,0,0,1,0,1,2,1,0,0,0,1,2,1,0,1,0,1,0,0,
+    2,1,2,0,0,3,0,0,2,0,2,2,2,1,0,0,0,0,2,0,0,0,0,1,23,0,1,0,2,1,2,2,
+    0,0,2,1,0,0,4,0,0,0,2,1,0,0,2,0,4,2,2,1,2,2,4,0,1,0,0,1,2,0,2,0,
+    0,0,2,0,0,0,0,0,2,1,0,2,2,0,0,0,2,0,0,0,2,0,0,0,4,0,0,0,13,0,2,0,
+    0,0,0,0,2,0,0,1,2,0,1,2,0,1,2,2,2,0,0,0,4,0,2,0,2,0,0,0,0,0,2,0,
+    0,0,1,0,0,0,0,1,0,2,0,1,0,2,2,0,9,0,0,0,2,0,2,0,2,0,1,0,2,0,0,1,
+    0,2,2,0,0,0,4,2,0,0,4,1,0,2,0,1,0,0,2,2,1,0,0,0,2,0,1,0,2,1,2,2,
+    0,0,2,0,0,0,0,0,1,0,0,1,3,2,0,0,2,0,0,0,0,0,0,0,1,0,2,1,0,2,1,0,
+    2,2,4,1,2,2,2,1,2,0,0,2,2,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,1,0,14,0,
+    1,0,2,0,1,0,0,0,0,2,0,1,1,0,0,0,0,0,0,2,0,1,1,0,6,2,5,1,3,0,3,0,
+    6,2,4,1,1,0,5,0,5,0,0,2,3,1,6,0,16,0,4,0,4,0,2,2,0,0,0,0,0,0,0,0,
+    1,0,2,0,30,0,1,0,1,0,1,0,3,0,1,0,0,0,3,0,1,0,40,0,3,0,35,1,37,2,23,1,
+    17,0,6,2,26,1,14,0,18,2,45,1,29,1,19,0,13,1,5,2,46,2,20,0,28,2,22,0,14,2,33,1,
+    71,0,43,1,27,2,17,0,52,0,50,0,30,0,20,2,10,1,8,0,4,2,0,1,0,2,0,1,1,2,3,1,
+    1,2,1,1,3,2,1,0,1,0,3,0,1,0,3,0,1,0,1,1,0,2,3,1,1,58,53,4,8,0,6,0,
+    2,0,2,1,0,1,0,1,0,0,1,3,0,1,0,1,1,1,1,1,0,3,0,0,3,1,0,3,1,1,2,1,
+    0,1,1,1,0,1,0,1,2,0,0,1,0,3,0,0,0,3,0,0,2,1,0,1,2,1,0,1,0,0,2,1,
+    1,0,2,1,2,0,0,1,0,1,0,2,2,0,2,0,0,1,0,0,2,1,23,2,3,1,2,0,2,0,2,1,
+    2,0,0,2,2,1,0,0,2,0,2,0,2,0,2,0,0,0,2,0,2,1,2,0,4,0,2,2,0,1,0,2,
+    0,0,0,0,4,1,0,0,0,0,0,0,2,0,0,0,0,0,2,1,2,2,0,1,0,0,2,0,13,2,0,0,
+    4,0,0,0,2,0,2,0,0,0,2,0,0,0,0,0,1,0,2,0,0,0,2,0,2,0,2,0,2,0,0,0,
+    2,0,2,0,0,0,0,0,1,0,2,0,0,0,1,0,9,0,2,0,2,0,1,0,0,0,4,0,0,0,0,2,
+    2,1,0,0,2,0,1,0,2,0,0,2,2,1,4,2,2,0,0,1,0,2,2,0,0,0,1,0,0,0,0,0,
+    0,0,2,0,2,0,0,0,2,2,0,0,2,1,0,0,1,0,1,0,1,0,0,0,0,0,0,2,2,1,0,0,
+    1,0,0,0,0,0,0,0,4,2,2,1,2,2,2,0,2,0,0,0,2,0,0,0,0,0,2,0,0,0,12,2,
+    2,0,1,1,2,2,1,0,0,1,0,2,2,0,1,0,0,0,0,0,1,0,0,0,24,0,1,0,0,0,1,0,
+    9,0,7,0,3,0,5,0,6,0,2,0,2,0,5,0,10,0,5,0,5,0,2,0,10,0,6,0,4,0,0,0,
+    2,0,1,0,18,2,24,0,0,1,3,0,1,0,1,2,3,1,1,0,1,2,22,1,34,0,5,2,3,1,7,2,
+    3,1,21,0,39,0,23,1,19,1,1,2,44,0,26,2,16,2,2,0,45,1,27,2,39,0,29,1,14,0,64,2,
+    40,0,24,0,14,0,8,0,57,1,53,2,33,0,21,1,16,2,52,0,30,0,16,0,10,0,4,2,0,1,2,2,
+    3,1,1,2,3,1,3,0,3,0,3,0,3,2,3,1,1,2,3,0,5,0,1,0,1,56,53,4,10,4,4,1,
+    4,0,0,1,0,0,0,1,0,3,0,0,1,1,1,3,0,1,0,1,3,1,0,3,2,0,1,1,0,1,1,3,
+    2,1,1,0,1,3,0,0,0,3,2,1,2,0,1,3,2,0,1,1,0,1,2,1,0,0,2,0,2,1,1,1,
+    2,1,0,1,0,0,4,1,0,1,0,2,0,0,0,1,4,2,0,1,27,0,3,0,2,0,4,0,2,0,2,1,
+    0,0,2,1,2,2,0,1,2,0,0,0,4,0,0,0,4,1,0,2,0,0,2,0,2,0,2,1,2,2,2,1,
+    2,0,0,0,0,2,2,1,0,2,2,1,0,0,0,0,2,1,0,2,0,0,2,0,0,0,2,0,17,0,2,0,
+    0,0,4,1,2,2,2,0,2,0,0,0,2,0,0,0,2,0,0,0,0,0,0,1,0,2,2,0,0,0,2,0,
+    2,0,0,0,2,0,0,2,4,1,1,2,2,1,7,0,3,0,2,0,1,0,4,0,0,0,0,0,2,0,1,1,
+    2,2,0,0,0,0,2,0,0,0,0,0,2,0,1,0,2,0,0,2,4,1,2,0,0,0,1,0,2,2,2,0,
+    0,0,2,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,2,0,0,0,0,0,0,0,1,0,1,0,3,0,
+    4,0,0,2,2,1,0,2,1,1,2,2,0,1,0,0,0,2,4,0,2,0,2,0,2,0,0,0,0,0,12,0,
+    2,0,0,2,0,1,2,0,0,2,0,1,1,2,2,1,1,2,0,1,0,2,0,0,18,1,4,2,1,0,0,0,
+    0,1,1,2,1,0,0,0,7,0,7,1,3,0,3,0,18,2,6,0,4,0,3,0,9,0,7,0,5,0,1,0,
+    10,0,6,0,2,0,36,0,2,0,0,0,2,0,1,0,1,2,1,1,1,0,1,0,58,0,3,1,5,2,3,1,
+    3,0,5,1,3,2,5,2,76,0,29,0,71,2,45,1,31,0,2,0,40,2,26,0,70,1,14,2,25,0,75,1,
+    49,0,33,2,21,0,50,1,44,2,26,0,18,1,8,2,23,0,57,1,33,0,17,2,10,0,46,1,26,2,14,0,
+    8,0,2,0,2,2,0,1,3,2,1,1,3,0,1,0,5,0,3,2,1,1,1,2,3,56,51,6,6,1,6,2,
+    2,1,2,0,2,1,1,1,0,1,0,1,1,1,0,0,0,3,1,1,0,1,1,1,0,1,1,1,0,1,0,1,
+    1,1,2,1,0,1,1,1,0,1,0,1,0,1,2,0,0,1,0,3,0,0,0,1,2,1,0,1,0,1,2,0,
+    2,1,0,0,0,1,1,0,2,1,2,1,0,0,2,2,5,1,23,0,0,0,4,1,0,0,0,0,2,0,2,2,
+    4,1,2,0,0,1,2,0,0,0,2,0,0,0,2,1,0,2,2,1,4,0,0,0,0,0,2,2,2,1,2,0,
+    2,0,2,0,0,0,2,0,0,0,2,0,0,0,2,0,0,0,0,0,0,1,2,0,0,2,19,0,2,1,4,0,
+    2,2,0,0,2,1,2,2,0,0,4,0,0,0,4,1,1,2,2,0,2,1,0,2,0,0,1,1,2,2,0,0,
+    2,0,2,0,0,0,2,0,0,0,2,0,0,0,5,0,2,0,1,0,0,0,1,0,0,0,0,0,2,0,2,2,
+    0,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,2,2,5,0,4,0,2,0,
+    4,0,0,0,0,0,4,0,0,0,0,0,2,0,0,2,0,0,0,0,0,0,0,1,0,0,0,0,0,2,4,1,
+    3,0,1,0,3,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,4,0,8,0,
+    2,0,2,1,2,2,0,0,2,0,0,0,0,0,0,2,0,1,0,2,0,1,0,2,0,0,22,1,1,2,0,0,
+    1,0,0,1,0,2,1,0,1,0,0,0,0,0,1,0,24,1,13,0,9,0,7,0,0,0,6,0,4,0,2,0,
+    13,0,7,0,3,0,4,0,14,2,12,0,6,0,4,1,4,0,2,2,0,1,1,0,54,0,3,0,1,0,3,0,
+    5,2,3,2,1,0,3,1,68,2,1,0,7,0,7,0,9,0,29,0,63,1,39,0,61,2,36,0,62,1,38,2,
+    20,0,10,1,6,0,63,2,53,1,35,0,23,2,28,0,44,1,26,2,14,0,8,0,17,1,49,2,25,1,17,0,
+    36,2,30,0,18,0,8,0,6,0,0,2,0,1,1,2,1,1,1,0,3,0,3,0,1,54,51,4,8,4,4,0,
+    2,0,2,1,0,1,2,1,1,0,0,1,0,3,1,1,0,0,1,3,0,0,0,1,1,3,0,1,0,1,1,1,
+    0,1,0,1,0,1,0,1,0,1,0,0,0,1,2,1,0,1,0,0,0,3,0,0,1,1,2,1,2,0,0,1,
+    0,1,2,1,0,1,2,0,0,0,0,1,2,2,11,1,21,0,2,0,2,0,2,1,2,0,2,0,0,1,2,0,
+    2,0,2,0,2,0,2,0,2,0,0,1,0,0,2,0,0,0,2,0,0,0,2,0,4,1,0,0,0,0,2,2,
+    2,0,2,1,2,0,0,0,4,0,1,0,2,0,0,0,2,0,0,0,2,0,1,0,2,1,17,0,0,2,0,1,
+    0,0,4,0,0,2,2,0,2,1,2,0,2,2,2,0,2,1,2,0,0,2,0,0,2,0,2,0,0,1,0,2,
+    1,0,0,0,2,0,2,1,0,2,2,0,0,0,9,0,2,0,4,0,2,0,0,0,2,0,1,0,1,0,0,1,
+    0,2,2,0,0,0,2,0,2,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,7,2,0,0,2,0,
+    2,0,4,2,4,1,0,2,2,1,4,2,0,0,2,1,0,2,2,0,0,0,0,2,2,1,0,0,0,0,2,2,
+    0,1,1,0,0,0,0,0,3,0,1,1,3,2,1,0,4,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,4,2,4,0,2,0,2,1,2,2,4,0,0,1,2,2,0,0,0,0,1,0,0,0,20,0,0,0,1,0,
+    0,0,0,2,0,1,0,0,1,0,0,0,1,2,0,0,0,0,26,0,1,0,1,0,7,0,13,0,9,1,7,0,
+    2,0,6,0,2,0,28,0,17,0,13,1,11,0,7,0,12,0,10,1,6,2,6,2,12,0,26,2,0,0,0,0,
+    0,0,1,0,3,0,1,2,1,1,52,0,5,0,5,0,5,0,7,0,3,2,7,1,62,0,81,0,97,0,63,0,
+    39,0,76,2,48,1,28,0,14,2,10,1,2,0,39,0,51,0,33,0,17,0,30,0,38,0,22,0,12,2,10,1,
+    39,0,29,0,17,1,20,2,32,0,18,0,10,2,4,1,2,2,0,1,1,2,1,0,1,56,51,2,8,2,4,0,
+    4,0,0,0,0,1,0,0,2,3,1,1,0,0,0,1,1,3,0,0,1,3,1,1,2,1,0,1,1,1,0,0,
+    0,1,1,3,0,0,0,3,0,0,1,1,2,1,0,1,0,1,2,1,0,0,0,3,2,0,1,1,0,1,2,1,
+    2,2,0,1,0,1,2,1,1,0,2,1,21,0,9,0,2,1,0,0,2,0,2,0,2,0,2,1,2,2,0,1,
+    0,0,2,0,2,0,4,0,2,1,0,2,2,1,0,0,2,1,0,0,2,0,2,0,1,2,4,1,2,0,0,0,
+    0,0,2,0,2,0,2,2,0,1,2,0,2,0,0,1,0,2,2,0,0,0,2,0,11,0,7,0,2,1,0,2,
+    4,1,0,2,0,1,2,0,2,2,0,0,2,1,0,2,4,0,0,0,2,0,4,0,0,1,0,2,0,0,2,1,
+    2,2,0,1,0,0,1,2,0,0,2,1,2,2,11,0,2,0,0,0,4,0,2,0,2,2,2,1,2,2,0,0,
+    0,1,1,0,0,0,1,0,0,0,2,0,2,0,2,0,0,2,0,1,2,0,0,0,0,2,9,1,0,0,1,0,
+    0,0,0,1,2,2,2,0,4,2,2,1,4,2,0,0,2,1,0,2,4,0,0,0,0,2,0,0,2,1,4,0,
+    2,2,0,1,2,2,1,1,2,2,1,0,0,1,0,2,5,1,3,0,3,0,1,0,4,0,0,0,2,0,1,0,
+    2,0,2,0,0,0,0,0,2,2,0,0,4,1,2,2,2,0,2,0,2,0,2,0,0,0,18,2,0,1,2,0,
+    0,2,0,1,1,0,0,2,0,0,1,0,0,1,0,0,1,0,32,0,1,0,1,0,1,0,0,0,1,2,1,0,
+    7,0,11,1,9,0,10,1,0,0,10,0,8,0,4,2,15,0,15,2,9,0,7,0,10,0,36,0,12,0,8,2,
+    2,0,2,1,0,0,0,0,1,2,68,0,3,1,5,2,5,0,5,0,7,1,3,2,92,0,13,1,11,2,11,0,
+    9,1,113,0,73,2,45,0,30,1,50,2,32,0,16,0,6,0,6,0,0,0,43,1,45,2,27,1,13,0,44,2,
+    28,0,12,0,8,0,21,0,33,0,13,0,24,1,24,2,12,0,6,2,2,1,0,0,3,54,49,4,6,2,4,2,
+    2,1,2,0,2,1,0,1,1,1,2,0,1,3,0,1,1,0,0,3,0,0,0,1,3,1,2,1,0,1,0,1,
+    1,1,0,1,0,1,0,1,1,1,2,1,0,1,0,1,0,0,0,1,2,1,0,0,0,3,0,0,0,1,2,0,
+    0,3,0,0,2,0,0,1,5,1,23,0,1,1,0,0,2,2,2,1,2,1,0,2,2,1,2,0,2,1,2,2,
+    2,1,0,0,2,0,0,0,2,0,4,0,2,0,0,0,2,0,0,0,0,1,0,0,2,1,0,2,2,0,2,1,
+    2,0,0,2,2,1,0,0,2,0,4,0,0,0,2,2,0,1,2,0,0,0,0,0,17,0,2,0,0,0,2,0,
+    0,0,0,0,4,0,0,0,0,1,0,0,4,2,2,1,0,2,2,0,0,0,0,0,2,0,2,0,2,0,2,0,
+    1,0,2,2,0,1,2,0,2,0,1,0,0,0,11,0,2,0,2,0,0,0,4,0,0,0,2,2,2,1,2,0,
+    2,2,0,0,2,0,0,0,0,1,1,0,1,2,0,1,2,0,0,0,2,2,0,0,2,1,3,0,0,0,2,0,
+    0,0,1,2,1,0,1,1,1,0,0,0,2,0,2,2,4,0,2,1,0,2,4,0,0,0,2,0,0,2,6,0,
+    0,1,4,2,0,0,2,0,1,0,2,0,0,0,0,0,0,0,2,0,1,0,0,0,5,1,1,0,5,0,1,0,
+    0,0,0,0,2,0,2,0,1,0,6,0,1,2,2,0,0,0,0,1,4,2,2,0,4,0,16,0,4,0,0,2,
+    2,1,1,2,2,0,0,1,0,0,0,2,0,0,1,0,0,0,36,0,1,0,1,0,1,0,1,1,1,0,1,0,
+    1,1,1,0,1,0,32,2,4,0,21,2,17,0,13,0,2,0,10,0,6,0,2,0,13,0,14,0,19,0,15,0,
+    22,0,16,2,10,0,4,0,2,0,50,1,26,2,1,0,3,0,3,0,5,0,7,0,1,0,106,2,13,1,11,0,
+    13,2,11,1,13,0,11,0,69,0,77,0,51,0,4,0,54,0,28,0,14,0,8,2,4,1,0,2,3,1,55,0,
+    33,0,17,0,30,0,24,0,12,0,6,0,29,0,23,0,4,0,28,0,14,2,2,1,2,52,49,6,6,2,4,1,
+    2,0,2,0,2,0,0,1,0,0,1,3,2,0,1,1,0,1,0,1,1,1,0,1,0,1,1,1,0,1,1,1,
+    0,1,2,1,0,1,1,0,2,1,1,3,1,0,2,1,2,1,0,1,0,1,0,0,0,1,2,1,0,0,1,1,
+    2,0,0,1,2,1,19,1,13,0,2,1,2,0,0,0,2,1,2,0,0,0,2,1,2,0,0,0,2,0,2,1,
+    2,2,2,0,0,1,2,0,0,0,2,1,2,0,2,0,2,0,2,0,0,0,2,0,0,0,0,1,0,0,2,0,
+    2,0,2,0,0,2,2,1,0,0,0,0,2,0,2,0,2,2,0,1,0,0,1,0,15,0,2,0,2,0,2,0,
+    2,0,0,1,0,0,0,0,2,2,2,0,0,1,0,2,2,1,2,0,2,0,0,0,2,2,2,0,0,0,0,0,
+    4,0,0,0,2,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,1,0,4,0,2,0,0,0,2,2,
+    2,1,2,0,0,0,2,0,0,2,4,0,0,1,0,2,1,1,0,2,1,1,0,2,3,0,2,0,2,0,2,0,
+    0,0,0,0,0,1,4,2,1,0,1,0,1,0,0,1,1,0,1,2,2,1,2,0,4,2,2,0,2,0,2,0,
+    2,0,0,0,2,0,2,2,2,1,2,2,0,0,2,1,0,2,0,0,2,0,1,0,2,0,1,0,2,0,14,0,
+    5,0,7,0,7,0,5,0,2,0,1,0,0,1,1,0,0,0,4,2,0,0,0,1,0,2,4,0,6,0,6,0,
+    4,0,6,0,2,0,0,0,2,0,0,0,0,0,0,0,0,0,32,0,0,0,0,1,1,0,1,0,0,0,1,0,
+    1,2,1,4,0,0,1,0,48,0,3,0,3,0,1,0,15,0,19,1,15,0,11,0,8,0,50,0,8,0,4,0,
+    29,0,25,0,15,0,9,0,22,0,12,2,66,0,8,0,4,0,0,1,1,2,1,0,3,0,84,0,16,0,11,0,
+    11,0,9,0,11,0,9,0,11,0,11,0,9,0,43,1,81,2,49,0,6,0,48,0,24,0,12,0,6,2,2,1,
+    1,0,1,0,41,0,31,0,15,0,32,0,20,0,8,0,9,0,29,0,6,0,26,2,6,54,49,2,6,2,4,2,
+    4,0,2,1,1,1,2,0,0,1,0,1,1,0,2,1,1,3,0,0,0,1,1,1,0,1,1,1,0,0,2,3,
+    0,1,1,0,1,1,2,1,0,3,0,0,0,1,1,1,2,0,0,1,0,1,2,1,0,0,0,1,0,1,2,1,
+    1,1,11,0,19,1,0,0,2,1,2,0,0,1,2,1,0,0,0,0,4,0,0,0,2,0,2,0,0,1,2,0,
+    2,0,0,1,2,2,2,1,2,0,0,0,0,0,2,0,2,0,2,1,2,2,0,1,2,0,2,0,0,0,0,0,
+    0,0,0,1,2,0,2,0,2,0,0,0,0,0,2,0,0,0,2,0,4,0,19,0,2,0,0,0,2,0,2,0,
+    0,0,4,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,4,0,0,0,0,1,2,2,2,0,
+    0,1,2,2,2,2,0,1,2,0,0,0,9,0,2,0,0,0,2,0,0,0,2,0,1,0,0,0,2,0,2,0,
+    0,0,2,0,2,2,0,0,2,0,0,1,2,2,0,0,2,0,0,0,0,0,2,1,7,0,1,0,0,0,0,2,
+    2,0,4,1,2,2,1,0,2,1,2,2,0,0,0,0,0,0,0,1,1,2,1,0,1,1,0,0,0,0,3,0,
+    4,2,4,0,4,0,2,0,2,0,2,0,2,0,0,2,2,1,2,2,0,0,2,0,0,0,0,0,0,0,14,0,
+    0,0,2,0,1,0,0,0,3,0,7,1,5,2,1,0,0,0,0,1,3,0,0,2,1,1,10,0,3,0,3,0,
+    0,0,0,0,6,0,6,2,4,0,4,1,2,0,2,0,2,0,1,0,32,1,0,4,0,0,0,2,1,0,0,0,
+    1,2,0,1,1,0,1,0,50,0,3,0,1,0,3,0,3,0,3,2,1,0,1,0,21,0,20,0,19,0,11,0,
+    18,0,12,0,4,0,0,1,29,0,21,0,2,0,8,0,32,0,20,2,10,0,6,0,2,0,0,1,102,2,5,0,
+    5,0,9,0,7,0,11,0,9,2,9,1,9,0,11,2,7,1,7,0,41,0,73,1,41,2,24,0,38,0,16,2,
+    12,1,2,0,0,2,1,1,1,0,43,1,25,2,12,0,22,0,10,0,13,1,23,2,30,52,49,4,6,2,4,0,
+    2,0,2,0,2,0,0,1,0,1,0,0,0,3,1,1,2,0,1,1,0,1,0,1,1,1,0,0,0,3,0,0,
+    1,1,0,1,2,1,0,1,1,0,0,1,0,3,0,0,1,3,2,0,2,0,0,1,0,1,0,1,2,1,11,0,
+    19,1,3,1,0,0,2,1,2,0,2,1,0,0,2,1,2,0,0,0,0,1,4,0,0,0,0,1,2,2,0,1,
+    2,0,2,0,4,1,0,0,0,0,2,0,2,0,2,0,0,1,2,2,2,1,2,0,0,0,0,0,2,0,0,0,
+    2,1,2,2,1,1,2,0,0,2,2,0,2,1,1,0,4,0,0,0,1,0,17,0,4,0,4,0,0,2,0,1,
+    2,0,0,0,2,0,2,0,2,0,2,0,0,0,0,1,0,0,2,2,2,0,1,1,0,0,4,2,0,1,2,2,
+    0,0,0,1,0,0,4,2,0,0,2,0,9,0,0,0,2,0,0,0,2,0,2,0,0,0,2,0,1,0,0,0,
+    0,0,0,2,2,1,4,0,0,0,0,2,2,0,2,1,0,2,2,1,2,2,1,0,0,0,0,0,1,0,1,1,
+    1,0,0,2,0,0,2,0,2,0,2,0,2,1,0,2,0,0,2,0,0,0,0,0,0,0,1,0,0,0,3,0,
+    3,0,0,0,0,0,4,1,4,2,0,0,2,0,2,0,2,2,2,1,0,0,2,2,2,0,2,0,0,0,12,0,
+    2,0,0,0,2,0,0,0,1,0,2,0,0,0,1,0,3,1,7,2,3,1,1,0,0,2,8,1,0,2,0,1,
+    2,2,2,1,3,0,3,1,3,0,3,0,2,0,4,0,4,2,4,0,22,4,4,1,4,0,0,2,2,0,0,0,
+    2,0,1,0,0,0,0,0,22,0,24,0,3,0,1,0,1,0,1,0,3,0,3,0,1,0,3,0,68,0,11,0,
+    39,0,27,0,19,0,6,2,14,0,8,0,72,0,27,0,45,1,33,0,21,0,36,0,22,0,12,2,72,0,30,0,
+    0,0,1,0,5,0,5,0,7,0,7,0,7,0,9,0,7,2,9,1,9,0,5,2,9,1,53,0,57,1,29,0,
+    48,2,26,0,10,0,6,0,0,0,1,2,0,1,25,0,29,0,6,0,22,0,6,1,35,50,47,6,6,0,4,2,
+    2,0,2,0,0,1,0,1,0,0,0,1,0,0,0,1,0,1,1,1,0,1,0,1,0,0,0,3,1,0,0,1,
+    0,1,0,1,0,1,1,1,2,1,0,1,0,0,0,1,0,1,0,0,0,3,0,1,0,0,7,0,19,1,5,1,
+    2,0,1,1,2,1,0,0,2,3,0,0,4,1,0,0,2,0,2,1,0,2,0,1,2,1,4,2,0,1,2,0,
+    0,1,2,2,0,0,0,0,4,1,0,0,2,0,0,1,0,2,2,1,2,2,2,0,2,0,2,0,0,1,2,0,
+    0,0,0,0,2,0,0,0,0,1,2,0,0,2,2,1,0,0,2,0,23,0,2,0,2,0,2,0,4,0,2,0,
+    2,0,2,0,0,0,0,0,2,0,2,1,2,2,0,0,2,0,0,1,0,0,2,2,2,0,1,1,2,2,1,1,
+    4,2,2,0,0,0,0,0,0,0,2,0,13,0,6,0,2,0,2,2,0,0,0,1,2,0,0,0,2,2,2,1,
+    0,0,0,0,1,0,0,0,0,0,4,0,0,0,2,2,0,1,0,2,2,1,2,2,1,0,0,0,4,0,0,0,
+    2,0,1,0,0,1,1,0,1,2,0,1,1,2,2,1,2,2,2,0,2,0,0,0,0,0,0,0,2,0,0,0,
+    0,0,1,0,0,1,3,2,3,0,2,0,2,0,4,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,4,2,
+    8,0,2,0,2,0,0,0,2,1,0,2,0,0,0,0,0,0,2,0,0,0,1,0,3,1,6,0,7,0,0,0,
+    3,1,1,0,0,0,0,0,6,2,6,2,1,0,3,0,3,0,3,0,10,0,4,0,2,2,2,1,0,0,4,2,
+    4,1,2,0,2,2,2,0,0,0,42,0,0,0,0,0,1,2,1,0,1,0,1,0,1,0,1,0,66,0,5,0,
+    3,0,5,1,5,0,25,0,29,0,21,0,5,0,58,0,16,2,10,0,4,0,51,0,35,0,23,1,18,0,72,0,
+    28,0,16,2,8,0,2,0,0,0,5,0,3,0,5,0,7,0,7,0,7,0,9,0,5,0,7,0,7,2,5,1,
+    73,0,37,0,26,0,26,2,12,1,6,0,0,2,0,1,1,0,23,1,29,2,18,1,0,52,47,2,4,2,4,2,
+    4,0,0,1,2,0,0,0,2,1,1,1,0,1,0,0,0,1,0,1,0,1,1,0,0,3,0,0,0,1,0,1,
+    0,1,1,1,0,1,0,0,0,1,0,1,2,1,1,1,0,0,1,3,0,0,11,0,13,1,7,1,4,1,1,1,
+    2,1,2,0,0,0,0,3,0,2,2,3,2,0,2,0,0,1,2,0,2,1,0,0,0,0,0,0,4,0,0,0,
+    2,0,0,3,0,0,4,0,0,2,4,1,0,0,2,0,2,0,0,0,0,1,0,0,2,0,2,0,2,0,2,0,
+    0,0,2,1,0,0,0,0,2,0,0,0,0,0,2,0,0,0,3,0,15,0,0,0,0,0,2,0,2,1,4,2,
+    2,0,2,0,4,0,0,0,2,0,1,0,2,0,2,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,
+    0,1,0,0,2,0,0,0,2,0,2,2,13,1,0,2,2,0,2,1,4,2,2,0,2,0,0,0,2,0,0,0,
+    0,2,2,1,2,0,0,0,2,0,3,0,0,0,0,0,2,0,4,0,1,2,2,1,3,0,2,2,0,0,4,0,
+    0,0,2,0,0,0,2,0,0,0,1,0,0,0,1,0,0,0,0,0,0,1,0,2,2,0,4,0,1,0,0,0,
+    2,0,2,0,1,0,2,0,0,0,1,0,0,0,3,0,1,1,0,2,4,0,2,0,2,0,2,0,0,2,2,1,
+    8,0,1,0,0,0,2,0,0,2,2,1,2,0,2,0,0,0,0,0,0,0,0,0,2,0,0,0,22,1,5,0,
+    7,0,7,2,5,2,0,0,5,0,0,0,0,0,0,2,6,1,4,2,20,1,5,2,3,1,1,0,0,2,4,1,
+    1,2,2,0,1,1,1,0,0,2,26,0,2,0,2,0,4,1,2,2,0,0,0,0,0,0,1,0,16,0,44,0,
+    1,0,3,2,3,0,3,0,5,0,3,0,11,1,26,0,43,0,31,0,28,0,20,0,10,0,6,2,31,0,3,0,
+    49,0,10,0,48,0,30,0,14,1,10,2,0,0,0,0,3,0,3,0,5,0,5,0,7,2,7,1,5,0,7,2,
+    5,1,7,0,49,1,41,0,14,2,28,0,10,0,4,0,1,0,1,0,5,1,41,2,22,50,45,4,4,2,4,0,
+    0,0,4,0,0,0,0,1,0,0,2,1,0,1,0,1,1,0,0,1,0,0,0,3,0,0,1,1,0,3,1,0,
+    2,1,0,0,1,1,2,3,1,0,2,1,1,0,2,1,7,1,13,1,15,1,0,1,2,1,2,0,0,0,2,1,
+    0,0,0,3,0,1,2,2,0,3,2,1,0,1,2,0,2,0,2,0,0,0,2,0,2,0,0,3,1,0,4,0,
+    0,0,2,2,2,1,0,0,2,1,0,2,2,1,0,0,2,0,2,0,0,0,2,1,2,0,0,0,2,2,0,1,
+    2,0,0,0,2,0,2,0,0,0,0,0,2,1,0,0,0,0,23,0,2,0,2,0,4,0,0,0,0,0,2,0,
+    0,0,4,0,0,0,4,0,2,0,2,0,0,0,2,0,0,0,2,0,0,0,2,0,2,1,2,2,1,1,2,2,
+    0,0,0,0,0,0,2,0,0,0,9,1,1,2,0,1,2,2,0,0,2,1,2,2,2,0,4,0,0,0,2,0,
+    2,0,0,0,0,0,0,0,2,0,2,0,0,0,0,0,0,0,3,0,2,0,2,0,5,2,4,1,2,0,0,0,
+    2,0,0,0,2,2,2,0,2,0,0,0,2,0,0,0,0,1,1,2,1,0,2,1,1,0,0,2,0,0,2,0,
+    2,0,0,0,2,0,1,0,2,0,0,1,1,2,2,0,0,0,0,0,1,0,1,1,1,2,2,0,2,1,0,2,
+    6,0,6,0,2,0,2,0,2,1,1,2,0,0,0,1,0,2,0,1,0,0,0,1,0,2,2,2,20,2,0,0,
+    2,2,0,1,1,0,7,2,3,1,9,0,1,0,1,0,5,0,2,0,8,0,8,0,8,0,4,2,2,1,7,2,
+    1,1,3,0,2,2,4,0,4,1,42,2,1,0,3,0,5,0,5,1,3,0,3,0,3,2,1,0,2,0,50,0,
+    0,0,2,0,0,0,3,0,0,0,3,0,1,2,66,0,10,0,5,0,57,0,43,1,29,0,18,0,20,0,88,0,
+    12,0,37,0,71,0,49,0,6,2,46,0,26,0,16,0,6,1,2,2,0,0,3,0,3,0,3,0,7,0,5,0,
+    5,0,5,0,7,2,5,1,39,0,41,0,18,1,20,2,6,1,3,2,1,0,10,0,25,48,47,4,8,2,0,2,
+    4,0,0,0,2,1,2,0,0,1,0,0,0,0,1,1,0,1,2,1,1,1,0,0,0,1,0,1,0,0,0,3,
+    1,0,0,3,2,0,1,1,0,1,1,0,11,3,13,0,7,1,0,1,0,0,1,1,2,1,0,1,2,0,2,1,
+    0,1,2,0,0,0,0,3,2,0,0,1,0,1,2,0,0,1,2,0,2,0,2,1,0,0,2,2,2,1,0,0,
+    2,1,2,0,0,0,2,0,0,0,0,1,0,2,4,0,0,1,0,0,4,1,0,2,0,0,0,1,2,0,2,0,
+    2,0,0,0,2,0,0,0,2,0,0,1,2,2,0,0,11,1,11,0,0,0,4,0,2,0,2,0,2,0,0,1,
+    2,2,0,0,2,0,2,0,0,1,4,2,2,1,0,2,2,0,0,0,2,0,2,0,0,0,0,0,2,0,2,1,
+    0,2,2,0,0,0,1,1,2,0,17,2,0,1,4,2,2,1,4,2,0,0,0,0,2,0,0,0,4,1,0,2,
+    2,0,2,0,2,0,2,0,1,0,2,0,0,0,2,0,0,2,4,1,1,0,1,0,9,0,0,0,4,0,4,2,
+    2,0,2,0,2,0,0,1,0,0,2,2,0,1,2,2,0,0,2,0,2,0,1,0,0,0,3,1,2,0,0,0,
+    0,0,2,0,0,2,2,0,0,0,0,0,2,0,1,1,0,2,0,1,0,2,0,0,2,1,1,2,1,0,0,1,
+    0,0,4,0,2,0,2,0,0,2,2,1,4,0,0,0,4,0,0,0,2,2,0,2,1,0,0,0,18,0,1,0,
+    1,0,1,2,0,1,2,0,0,0,2,0,3,0,3,0,5,0,7,0,16,0,9,0,7,0,2,0,0,2,10,1,
+    6,0,6,2,1,1,3,2,5,0,2,1,24,0,8,2,6,0,4,0,2,0,2,2,0,1,1,0,7,0,52,0,
+    11,0,11,0,7,0,7,0,7,0,4,0,0,0,0,0,72,0,1,0,1,0,3,2,5,0,43,0,41,0,27,0,
+    52,0,36,0,22,1,12,0,29,0,67,0,41,0,14,0,40,2,22,0,12,0,8,0,0,1,1,2,1,0,5,0,
+    5,0,3,0,5,0,7,0,5,0,7,1,43,0,37,0,32,2,22,0,8,2,0,1,1,36,45,16,4,4,4,1,
+    2,2,2,0,0,0,2,1,0,0,1,1,0,1,2,0,0,1,1,0,0,3,0,1,0,0,0,1,1,1,0,1,
+    0,0,2,1,1,1,9,0,11,1,11,1,1,1,0,1,2,1,0,0,0,1,0,1,1,0,2,1,0,1,2,0,
+    2,1,0,1,2,1,0,0,2,1,1,3,2,0,0,0,2,0,2,1,0,0,2,0,2,0,0,1,2,0,0,0,
+    0,0,2,1,2,2,0,1,2,0,2,0,0,1,0,0,2,0,2,0,0,0,2,0,2,1,0,2,0,1,0,0,
+    2,0,2,0,2,0,0,0,2,1,2,2,0,1,0,0,23,2,2,0,2,1,0,0,0,0,2,0,2,0,2,0,
+    2,0,2,0,0,0,2,1,2,2,0,0,2,0,2,0,2,0,2,0,0,1,0,0,0,2,2,1,2,2,0,0,
+    2,1,0,0,2,0,2,2,1,0,13,1,2,2,1,1,0,2,0,1,4,0,2,0,2,0,2,0,1,2,2,0,
+    2,1,2,2,2,0,0,0,4,0,0,0,2,0,1,0,2,0,0,2,2,1,2,2,3,1,0,0,3,0,1,0,
+    1,0,4,0,4,0,2,2,2,0,2,1,2,2,0,1,0,2,0,1,0,2,2,0,0,0,2,0,0,0,0,0,
+    1,0,3,0,2,0,2,0,0,1,4,2,1,0,2,0,0,0,0,0,0,1,0,2,1,0,2,1,0,0,1,0,
+    8,0,5,0,1,0,1,1,6,0,2,2,0,0,2,2,0,0,0,2,2,0,2,0,2,0,0,0,22,0,2,0,
+    0,0,2,0,1,0,1,0,1,2,3,1,1,2,1,1,0,2,1,1,12,2,0,1,7,2,5,1,3,0,9,0,
+    5,0,0,0,8,0,8,0,6,0,4,2,26,0,9,1,5,0,5,2,8,0,6,1,6,2,2,0,2,0,6,0,
+    56,0,0,0,3,0,1,0,3,0,13,0,9,0,11,0,58,0,17,0,15,0,11,0,4,0,2,0,2,0,1,0,
+    18,0,69,0,45,2,46,0,34,0,22,0,10,1,37,0,53,0,35,0,36,0,30,0,18,2,8,0,4,0,2,1,
+    3,2,3,0,5,1,5,2,7,1,7,0,5,2,0,0,45,0,4,0,22,0,6,2,0,24,43,28,2,0,4,4,
+    2,1,2,0,2,0,1,0,2,1,0,0,0,1,0,1,0,1,0,0,0,0,0,1,0,3,1,0,2,1,1,0,
+    3,3,13,0,11,1,3,1,1,1,0,1,0,0,0,1,0,0,2,1,0,1,0,1,1,1,0,0,4,1,0,1,
+    0,0,2,0,0,1,2,1,0,0,2,5,0,0,0,1,2,2,1,0,4,1,0,0,2,1,2,0,0,2,2,1,
+    2,0,1,0,2,1,2,0,0,0,2,0,2,0,0,1,0,0,2,0,0,0,2,0,0,0,4,1,0,0,0,0,
+    0,0,2,0,0,0,2,0,2,0,0,0,0,0,19,0,0,1,0,0,2,2,0,0,2,1,0,0,2,0,2,0,
+    2,1,0,2,4,1,0,2,0,0,2,1,2,2,2,1,0,0,2,0,2,2,2,0,2,0,0,0,0,0,0,0,
+    0,0,2,0,0,0,2,0,2,0,13,0,0,0,2,0,0,1,0,2,1,0,2,0,0,0,2,0,4,0,2,1,
+    0,2,0,1,0,2,2,0,2,0,2,0,0,0,4,0,0,0,0,0,0,0,0,0,3,0,2,2,2,0,2,1,
+    2,0,3,0,3,0,1,0,4,0,2,2,2,1,2,2,4,1,0,2,0,1,0,2,2,0,0,0,0,0,4,0,
+    2,0,2,0,3,1,1,0,1,2,1,1,4,0,0,2,2,1,2,0,0,2,0,1,0,0,1,0,0,0,0,0,
+    2,1,2,0,0,0,2,4,3,0,1,0,1,0,2,0,4,2,4,0,0,0,0,0,0,0,0,0,14,1,2,2,
+    4,0,0,0,4,2,0,1,0,0,2,2,0,1,0,2,0,1,1,2,1,1,30,2,5,1,9,0,11,0,9,0,
+    7,2,0,1,7,0,9,0,1,0,4,0,22,0,14,2,8,0,6,1,5,2,7,0,7,1,1,0,8,2,6,0,
+    52,0,6,0,2,0,2,0,1,2,0,0,3,0,1,0,14,0,72,0,7,0,9,1,21,0,21,0,17,0,15,0,
+    58,0,23,0,11,0,69,0,51,0,21,0,56,2,32,0,18,0,12,1,53,0,41,0,5,0,40,0,22,0,10,2,
+    6,1,1,0,1,0,5,0,0,2,0,2,1,1,5,0,3,0,29,0,17,0,26,0,8,24,45,26,6,4,4,1,
+    2,2,0,0,0,1,2,0,0,0,2,1,0,0,1,1,0,0,0,1,0,1,0,0,1,1,2,1,9,1,13,0,
+    9,1,1,1,0,1,0,0,0,1,0,0,0,1,0,1,0,1,0,1,2,1,1,0,2,1,1,1,0,0,2,1,
+    2,1,0,0,2,1,2,0,1,1,2,3,0,0,0,0,0,3,2,0,0,0,2,0,0,0,4,0,0,1,2,0,
+    0,0,2,0,0,1,0,0,2,0,2,0,2,1,0,2,2,1,0,0,2,0,0,0,2,0,0,0,2,0,2,0,
+    0,0,0,1,0,0,2,0,0,0,2,1,7,2,15,0,0,0,4,0,2,1,2,0,0,0,2,0,0,0,0,0,
+    0,0,4,1,0,2,2,0,4,0,0,0,0,0,0,0,2,0,2,0,2,0,2,0,0,0,2,0,2,1,2,2,
+    0,0,0,0,0,0,0,0,15,1,4,2,2,1,2,2,2,0,0,1,2,0,0,0,1,0,0,0,0,0,0,2,
+    4,1,2,2,2,1,0,2,0,0,0,0,2,0,0,0,2,0,2,0,4,0,0,0,5,0,1,0,2,0,0,0,
+    4,0,2,0,2,0,2,0,3,0,1,1,1,2,2,0,2,2,2,1,4,2,0,1,2,0,0,0,0,0,4,0,
+    0,0,0,0,2,2,0,0,2,1,0,2,3,1,1,0,0,0,1,0,0,1,4,2,2,1,2,0,0,0,0,2,
+    8,2,3,0,1,2,1,1,1,0,2,0,2,2,1,0,3,1,1,0,0,0,4,0,4,0,2,0,14,2,4,0,
+    1,0,0,0,1,0,0,0,2,0,2,0,2,0,0,0,0,2,2,1,1,2,36,1,0,2,1,0,0,1,0,2,
+    3,1,15,0,11,2,7,1,3,0,7,0,11,0,19,0,2,0,20,2,14,1,12,0,8,2,4,0,7,1,7,0,
+    20,2,4,0,14,0,8,0,8,0,4,0,2,0,0,0,0,0,82,0,1,0,5,2,5,0,5,0,7,0,5,0,
+    6,1,104,0,23,0,39,0,33,0,39,0,99,1,63,0,2,0,50,2,30,0,18,0,7,0,49,0,27,1,36,0,
+    24,2,16,0,12,2,8,0,1,0,1,0,1,0,1,0,5,0,3,0,15,1,27,2,26,24,43,26,4,2,2,2,
+    2,0,2,0,2,0,0,0,0,1,0,0,0,1,2,0,0,1,0,1,0,1,1,1,5,0,17,1,7,0,0,3,
+    1,0,0,1,0,0,0,1,0,1,1,1,2,1,0,0,0,1,0,0,0,1,2,1,0,0,0,1,3,1,2,0,
+    2,1,0,1,2,0,0,1,4,1,1,3,2,1,2,0,0,0,0,0,0,0,2,1,2,0,1,0,4,0,0,1,
+    2,0,0,0,2,0,2,0,0,1,0,0,0,0,4,0,0,0,0,1,2,2,0,1,0,0,2,0,2,0,0,1,
+    2,0,0,2,2,1,0,0,0,0,0,0,25,1,2,0,4,0,0,0,2,2,2,1,4,2,0,1,2,0,0,0,
+    2,0,0,0,0,0,2,0,0,1,4,2,2,1,2,2,0,0,0,0,0,0,2,0,2,1,2,2,0,0,2,1,
+    2,2,0,0,2,1,0,0,15,2,2,0,2,0,0,0,2,0,2,0,0,0,2,0,2,0,0,0,0,1,0,0,
+    1,2,0,1,2,2,4,1,0,0,2,0,0,2,2,0,0,1,0,0,0,2,2,0,5,0,4,0,0,0,2,0,
+    1,0,2,0,2,0,2,0,2,0,2,2,0,1,1,0,3,1,0,2,0,0,4,0,0,0,4,2,2,0,2,0,
+    2,0,2,1,0,0,0,0,0,0,0,0,0,0,2,1,0,0,1,0,1,0,1,0,0,2,0,2,0,0,4,0,
+    10,0,2,2,2,1,0,0,1,2,3,0,5,1,1,0,0,0,0,0,2,2,1,0,1,0,1,0,2,0,12,0,
+    6,0,4,0,2,0,4,0,1,0,1,0,1,0,0,0,1,0,2,0,2,0,30,2,2,1,2,2,0,0,1,1,
+    0,2,1,0,0,0,0,0,9,0,7,1,30,2,1,1,11,0,27,0,23,0,17,0,10,0,10,0,6,0,10,2,
+    32,1,4,0,13,2,7,0,9,1,16,0,12,2,8,0,4,0,16,0,60,0,2,0,1,0,1,0,3,0,5,0,
+    5,2,78,0,26,0,11,1,11,0,13,0,11,2,11,0,59,1,89,0,49,0,22,0,8,1,2,0,10,2,35,0,
+    21,0,30,0,30,2,16,0,10,1,6,0,0,2,1,0,1,0,1,0,3,0,13,1,17,22,41,10,2,18,2,2,
+    4,0,0,0,2,0,0,0,0,0,2,1,0,0,1,1,0,1,0,0,1,1,17,0,11,1,0,1,2,1,1,0,
+    0,1,0,0,1,1,2,3,0,0,0,1,1,0,0,1,0,1,0,1,0,0,2,0,0,3,0,0,2,1,3,1,
+    2,0,2,1,0,0,2,1,0,0,4,5,1,0,2,1,0,2,2,1,0,1,0,2,0,1,2,0,0,1,2,2,
+    2,1,2,0,0,0,0,1,2,2,0,1,2,0,0,0,2,0,2,0,0,1,0,0,2,0,0,0,0,1,2,2,
+    2,0,2,1,0,2,0,1,0,0,23,0,1,0,2,0,2,0,2,0,2,1,2,2,0,1,4,0,2,2,2,0,
+    0,1,0,0,2,0,0,0,0,0,2,0,0,0,2,1,4,0,0,0,2,0,1,0,2,2,2,1,2,2,0,0,
+    2,1,2,0,0,2,2,0,13,0,0,1,0,2,2,1,2,2,2,0,2,0,0,0,2,0,0,1,0,2,2,0,
+    0,1,2,2,1,1,1,0,0,2,2,0,4,1,0,0,2,2,0,0,0,1,3,0,5,2,2,1,4,2,4,0,
+    2,0,2,0,1,0,0,0,2,0,0,0,4,0,2,0,2,2,0,1,1,1,1,0,1,2,0,1,2,0,0,0,
+    4,0,2,2,4,0,2,1,2,2,1,1,2,0,0,0,1,2,2,2,2,0,1,0,1,0,1,0,0,2,1,1,
+    6,2,2,1,4,2,2,0,2,1,2,0,2,2,0,0,3,0,1,0,5,1,5,0,0,0,4,0,0,0,2,0,
+    3,0,1,0,8,0,6,2,4,0,4,0,2,2,2,1,2,0,1,2,1,1,14,0,8,0,3,0,2,0,4,2,
+    0,1,2,2,0,1,1,2,0,0,0,0,32,0,8,0,17,0,11,1,3,2,4,0,19,1,19,0,13,2,3,1,
+    8,0,26,2,8,1,2,0,2,0,21,2,7,1,7,0,10,0,12,2,56,0,12,0,8,0,2,0,2,0,2,0,
+    1,0,3,0,106,0,7,2,9,0,9,1,9,0,13,0,9,0,11,0,21,0,73,1,43,4,28,0,10,0,5,0,
+    5,1,49,0,41,1,28,2,34,2,16,0,12,0,4,0,4,0,1,1,1,2,3,1,29,22,43,2,4,26,4,2,
+    0,0,4,0,1,0,2,0,2,1,1,0,0,1,2,0,0,0,11,3,19,2,0,3,0,0,0,0,1,1,2,1,
+    0,1,1,1,0,1,0,0,0,0,0,1,0,1,0,1,2,0,1,1,0,1,0,1,2,0,2,1,1,1,2,0,
+    3,1,2,0,2,1,0,0,0,7,2,0,4,0,1,0,2,1,0,0,0,0,0,1,2,0,0,0,2,0,0,1,
+    2,2,2,1,0,0,2,0,0,1,2,2,0,0,0,1,2,0,0,0,2,1,2,0,0,0,2,0,0,0,2,0,
+    1,1,2,2,2,1,0,0,13,0,11,0,2,0,0,0,0,0,4,1,0,2,4,1,2,2,0,0,2,1,2,0,
+    2,2,2,1,2,0,0,0,2,0,1,1,2,2,0,0,0,0,4,0,0,0,4,0,0,1,0,2,0,1,2,2,
+    0,0,2,0,2,0,9,0,3,0,2,0,2,0,0,0,0,1,2,0,2,2,0,0,2,1,2,2,4,0,1,1,
+    2,2,0,1,0,2,0,0,2,1,1,0,1,0,0,0,2,0,2,0,2,2,11,1,4,0,0,2,2,1,0,0,
+    2,2,2,0,4,0,2,0,0,0,2,1,1,2,2,0,0,1,2,2,2,0,0,0,4,1,1,0,3,0,5,0,
+    0,0,4,0,4,0,2,0,2,1,4,2,2,2,0,2,4,0,1,0,0,0,0,0,0,2,0,1,0,0,0,0,
+    4,0,3,0,1,0,0,0,2,0,4,2,4,1,2,0,2,0,0,2,0,0,2,0,3,0,5,0,5,1,4,0,
+    2,2,4,0,3,1,5,0,1,0,4,0,6,0,4,2,4,0,2,0,2,0,2,0,32,2,2,1,3,2,5,1,
+    3,2,3,1,1,2,2,1,2,0,1,2,2,1,46,0,0,2,1,0,7,1,13,2,13,0,5,0,6,1,9,2,
+    19,0,7,1,11,0,28,2,20,0,10,1,0,0,0,2,15,0,19,1,5,0,11,0,20,0,24,2,16,0,10,0,
+    6,0,4,0,46,0,46,1,3,0,5,2,7,0,7,0,5,0,7,0,3,0,7,2,7,1,63,0,45,0,12,0,
+    22,2,12,0,2,0,49,1,45,0,16,0,10,0,16,0,10,0,6,2,2,1,3,0,7,24,41,0,4,26,2,0,
+    2,2,0,0,2,0,2,1,0,0,0,0,0,1,0,0,19,1,9,0,0,1,0,0,0,1,0,1,0,1,1,0,
+    0,0,0,1,0,1,1,0,2,3,0,0,0,1,0,1,1,1,2,0,0,0,0,1,0,1,0,1,2,0,0,1,
+    0,1,0,1,0,0,0,1,4,3,1,0,2,1,2,0,0,1,0,0,2,0,0,0,0,0,2,1,0,0,2,0,
+    0,1,0,0,4,0,0,0,2,0,1,1,2,0,2,0,0,0,2,1,1,2,2,0,2,1,0,0,2,0,0,0,
+    2,0,0,1,2,2,3,0,21,0,2,1,2,0,2,0,0,1,1,2,2,1,0,2,2,1,4,0,2,0,0,0,
+    2,0,2,2,2,1,2,0,0,0,2,0,0,0,2,0,0,0,0,0,2,1,0,0,2,2,2,1,0,2,0,1,
+    2,0,0,0,2,0,17,0,4,0,2,2,2,1,4,2,0,0,0,0,0,1,2,0,0,2,4,0,0,0,2,0,
+    2,0,0,0,2,1,2,2,1,0,2,0,0,0,0,0,1,1,0,0,0,0,11,2,2,1,4,0,0,0,0,0,
+    2,0,0,0,2,0,2,0,2,0,2,2,4,1,0,0,0,2,0,1,2,0,2,0,0,2,2,0,2,1,2,0,
+    1,1,3,0,5,0,0,2,4,4,4,0,2,0,4,0,0,0,2,0,2,2,2,1,0,0,0,2,0,1,1,2,
+    12,1,0,0,3,0,1,0,3,2,3,1,0,0,0,2,4,0,4,1,2,0,2,0,2,0,0,0,2,2,22,0,
+    7,1,9,0,9,2,5,0,4,0,3,0,3,0,1,1,1,0,8,0,4,2,4,0,26,0,4,0,2,0,2,0,
+    4,0,0,0,0,0,5,0,3,2,3,1,3,0,36,2,4,1,0,2,2,0,1,1,0,0,3,2,15,0,11,1,
+    5,0,56,2,5,0,41,1,31,0,11,2,18,0,18,1,12,0,8,2,54,0,12,0,35,0,37,1,23,0,10,0,
+    6,0,0,0,0,0,60,2,12,0,10,0,6,0,4,0,1,2,1,0,5,0,3,0,7,0,5,0,7,1,47,0,
+    47,0,12,0,22,0,10,0,2,0,39,0,17,0,16,0,1,0,5,1,0,2,4,2,14,22,41,2,4,8,2,18,
+    2,2,2,0,2,0,1,1,0,0,2,1,0,2,25,3,3,0,0,0,2,1,1,1,0,0,0,1,0,0,0,1,
+    0,1,0,1,1,0,0,1,0,0,0,1,0,1,0,0,0,1,2,1,0,1,0,0,0,0,0,1,2,1,1,1,
+    2,0,1,1,0,1,2,0,0,5,2,1,0,0,0,0,4,0,0,0,2,1,0,0,0,1,0,0,0,0,2,0,
+    0,0,2,0,0,1,2,0,0,0,4,0,0,1,0,0,0,0,2,0,2,0,0,1,0,2,2,1,0,0,2,0,
+    0,0,0,0,0,1,27,0,4,0,0,2,2,1,2,0,2,0,4,0,0,0,0,1,0,0,0,0,2,2,4,1,
+    2,0,0,0,0,0,2,0,2,0,2,0,0,1,0,0,2,0,0,0,2,2,0,0,0,1,2,2,2,1,2,2,
+    0,0,2,0,1,0,19,0,4,1,2,0,4,2,2,1,4,2,2,0,2,0,0,0,0,0,1,1,2,0,2,2,
+    2,1,2,2,0,0,2,1,2,0,0,0,0,0,2,0,0,2,0,0,0,1,11,0,1,0,2,0,2,0,2,2,
+    2,1,0,0,0,0,0,0,2,0,0,0,0,0,2,0,4,1,2,2,0,0,0,0,0,1,2,0,0,0,2,2,
+    2,2,2,2,2,0,0,0,3,1,3,0,1,0,2,0,2,0,6,0,0,0,2,2,2,0,2,0,0,0,2,0,
+    12,0,0,2,0,1,1,0,0,0,1,0,3,0,1,0,3,0,1,0,2,2,2,0,2,0,4,0,0,0,20,0,
+    4,0,0,0,0,0,0,0,9,1,7,0,7,0,0,2,0,0,9,0,1,1,1,0,14,0,10,2,8,0,6,0,
+    2,0,4,2,2,1,2,2,2,1,0,2,0,0,32,1,8,2,7,1,7,0,5,2,3,0,2,1,0,2,0,0,
+    3,0,38,1,19,0,9,2,12,0,3,1,33,0,29,0,11,2,12,1,18,0,56,0,14,0,10,0,0,0,31,0,
+    23,0,13,0,18,0,66,0,3,2,9,0,9,0,9,0,9,0,8,0,6,0,0,0,2,0,3,0,1,2,3,0,
+    3,0,45,1,41,2,22,0,16,0,6,1,5,0,41,0,14,0,10,0,3,0,5,0,5,20,39,4,2,0,2,26,
+    2,0,0,0,2,0,2,0,0,0,0,0,27,1,0,0,0,1,0,1,1,0,2,1,0,1,1,0,0,0,0,1,
+    0,1,0,0,0,1,0,1,1,1,2,0,0,0,0,1,0,1,0,0,0,1,0,1,0,1,2,0,1,1,4,0,
+    1,1,2,0,0,1,1,1,2,7,0,0,0,0,2,0,0,0,4,1,1,0,2,0,2,0,0,0,0,1,0,0,
+    0,1,2,0,0,2,2,1,2,0,0,1,2,2,0,1,2,0,0,0,0,0,2,0,2,1,1,2,2,0,0,1,
+    2,0,2,0,29,0,0,0,0,1,6,0,0,2,2,1,2,2,2,1,2,0,2,0,0,0,0,0,0,1,2,2,
+    0,1,2,0,4,2,0,1,2,0,0,0,4,0,2,0,0,0,0,0,0,0,0,1,2,2,1,1,2,2,2,1,
+    2,0,0,0,15,0,0,0,1,2,2,1,2,0,2,2,2,1,4,0,2,0,2,0,4,0,2,2,1,0,0,1,
+    0,2,0,1,4,2,0,0,2,0,0,0,4,0,1,0,2,0,0,1,0,2,5,1,0,2,1,1,1,0,0,0,
+    0,0,4,0,2,0,2,0,0,0,2,1,0,2,0,1,0,0,0,0,2,0,2,0,2,0,1,2,2,2,3,0,
+    2,0,2,0,4,0,2,0,2,2,0,0,0,0,3,0,1,0,3,0,4,0,2,0,4,0,0,1,4,2,0,0,
+    12,0,2,0,2,0,0,2,2,1,0,2,1,0,1,1,1,0,3,0,3,0,1,0,1,0,0,0,2,0,18,2,
+    2,0,4,0,4,0,0,1,2,2,0,0,0,0,5,0,7,1,3,0,3,2,0,0,4,1,13,0,7,0,8,2,
+    10,0,8,1,6,2,6,0,2,0,4,0,0,0,0,2,48,1,0,0,1,2,0,1,3,0,9,2,5,1,7,0,
+    5,0,2,2,54,0,5,1,25,0,15,0,3,0,10,2,5,1,23,0,29,0,0,0,10,0,32,0,20,2,16,0,
+    10,0,4,0,29,0,1,0,12,0,32,0,20,0,8,0,4,0,19,0,17,0,13,0,15,0,11,0,1,0,2,0,
+    0,0,2,2,1,1,49,1,23,0,28,2,10,0,4,0,35,0,4,2,20,0,4,1,17,22,39,0,2,2,4,20,
+    0,4,2,2,0,1,2,2,0,1,27,0,0,1,0,0,0,0,0,1,0,1,0,2,0,1,0,1,0,1,0,1,
+    0,0,0,1,0,0,0,1,0,0,1,1,2,1,0,1,0,0,1,1,0,0,2,1,0,0,0,1,0,0,0,1,
+    2,1,0,1,0,0,2,7,1,0,2,0,2,0,0,1,0,0,0,0,2,0,0,1,0,0,2,1,2,2,0,1,
+    0,0,0,0,2,1,0,2,0,1,2,0,0,0,4,0,0,1,0,0,2,0,0,0,0,0,2,1,0,0,2,0,
+    0,0,23,0,3,0,2,1,2,2,1,1,4,0,2,0,2,0,0,0,4,0,0,0,4,0,2,0,0,1,1,0,
+    2,2,2,1,0,0,2,0,0,0,2,0,0,0,2,0,2,0,2,0,0,1,2,2,0,1,2,2,0,1,0,0,
+    0,0,0,2,19,1,4,0,4,0,2,2,1,1,0,0,2,0,2,0,2,2,4,0,2,0,2,1,2,0,2,2,
+    0,1,0,0,0,0,0,0,0,0,4,0,0,0,2,0,2,0,2,2,0,1,9,2,2,1,2,0,0,2,2,1,
+    1,0,1,0,0,1,2,0,2,0,0,0,2,0,0,0,2,0,0,0,0,2,0,2,0,0,4,0,0,2,1,1,
+    2,2,0,1,1,0,2,2,0,1,4,0,2,0,2,0,2,0,0,0,3,0,3,0,1,0,4,2,1,0,4,0,
+    2,0,8,0,4,0,2,0,2,0,0,0,2,0,2,0,0,2,0,0,0,1,3,0,3,0,3,0,1,0,4,0,
+    0,0,4,0,4,0,6,2,2,0,4,0,2,0,0,0,2,0,0,0,3,0,7,1,16,2,5,0,4,0,11,1,
+    11,0,11,2,1,1,10,0,8,2,6,0,4,0,4,0,38,0,4,2,4,1,0,0,2,2,0,1,1,0,0,2,
+    1,0,5,1,52,0,13,0,9,0,13,0,5,0,19,1,13,0,2,2,10,0,38,0,33,0,51,2,4,1,6,0,
+    28,2,18,0,12,0,8,0,84,1,51,2,39,0,0,0,24,0,16,0,6,0,2,0,1,0,1,0,17,0,17,0,
+    17,0,15,0,13,1,4,2,7,0,45,0,4,0,22,0,16,0,17,0,11,1,14,2,12,20,39,2,4,2,0,0,
+    4,26,0,1,2,2,0,1,25,0,1,0,0,0,0,1,0,0,0,0,2,1,0,1,1,0,2,1,1,1,0,0,
+    0,0,0,1,0,1,0,0,0,1,0,1,0,0,0,1,2,0,1,1,2,1,1,1,0,0,0,1,2,1,0,0,
+    2,0,0,1,0,1,0,7,0,0,0,0,0,1,2,0,0,0,2,1,2,0,0,0,2,0,0,0,0,1,0,0,
+    2,0,0,1,0,2,0,1,2,0,0,0,2,1,0,2,2,0,0,0,2,1,0,0,2,0,0,0,2,0,0,1,
+    19,0,9,0,2,1,2,2,2,1,2,2,0,1,0,2,4,1,2,0,0,0,2,0,2,0,2,0,2,0,2,0,
+    0,1,0,2,0,1,2,0,2,0,0,0,2,0,0,0,0,0,2,0,2,0,2,0,2,0,0,1,0,2,0,0,
+    0,0,11,1,7,2,2,0,0,1,2,0,6,0,2,0,0,0,1,0,2,0,2,0,2,0,2,2,4,1,2,0,
+    2,2,2,0,0,1,2,0,0,0,1,0,0,0,2,0,0,0,2,0,1,0,3,0,2,0,0,0,2,1,0,0,
+    2,0,0,0,0,2,0,1,1,0,0,0,2,0,2,2,2,2,2,0,0,0,0,0,0,0,0,0,0,0,5,0,
+    2,0,4,0,4,2,0,1,2,0,1,2,2,0,2,0,0,0,2,0,2,0,2,0,1,1,3,0,1,0,1,0,
+    0,2,2,1,4,2,4,0,2,0,6,0,2,0,0,2,2,1,2,0,0,0,2,2,0,0,0,0,3,0,12,1,
+    5,0,9,0,1,0,1,0,4,0,4,0,4,0,4,0,2,2,0,0,4,0,0,0,14,0,18,0,13,1,9,2,
+    7,0,0,1,0,2,13,1,11,0,3,0,6,0,4,0,26,2,10,1,6,2,6,0,4,0,2,0,2,0,0,0,
+    0,0,0,0,34,0,30,0,3,0,3,0,15,0,13,2,11,0,23,1,19,0,20,2,20,0,18,1,29,0,27,2,
+    29,1,2,0,6,2,24,0,74,0,20,1,14,2,19,0,43,0,29,0,20,0,18,0,10,0,2,0,2,0,3,0,
+    3,0,7,0,5,0,23,0,19,0,11,1,35,0,15,2,28,0,12,1,13,2,7,2,24,20,39,2,2,0,4,0,
+    0,22,4,4,0,0,23,0,5,0,2,1,2,0,0,0,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,1,
+    0,1,0,0,0,1,0,1,0,0,0,1,1,1,2,0,1,1,4,0,1,1,0,0,0,3,0,2,0,1,2,1,
+    1,0,2,1,0,3,0,5,0,0,0,0,2,0,0,1,2,0,0,0,0,0,2,0,0,1,2,0,0,0,2,0,
+    0,1,0,0,0,1,2,0,0,0,2,0,0,0,0,1,0,0,4,0,0,0,0,0,0,0,4,1,0,0,19,2,
+    11,1,4,0,0,0,2,0,2,0,0,0,2,0,4,1,1,0,2,0,2,0,4,0,0,0,0,1,2,2,2,1,
+    2,2,2,1,0,0,0,0,2,2,2,1,0,0,2,0,2,0,0,0,0,0,0,1,2,2,0,0,2,1,2,0,
+    0,0,21,0,2,0,0,0,0,0,2,0,0,2,4,1,2,0,4,2,0,1,0,0,0,0,0,1,2,2,4,0,
+    2,0,2,0,2,0,2,2,2,0,0,0,2,1,0,0,0,0,1,0,9,0,4,1,0,2,4,0,2,0,0,0,
+    2,0,2,1,0,1,0,2,0,0,2,4,1,0,0,0,1,0,2,0,2,0,2,0,0,0,0,0,2,0,3,0,
+    0,0,1,0,0,0,2,0,4,2,4,1,0,0,0,0,0,0,2,0,0,0,2,0,2,2,2,0,2,0,0,0,
+    3,1,0,2,5,1,2,0,2,2,0,1,4,2,4,1,0,2,2,0,2,0,2,0,2,0,0,0,2,0,0,0,
+    22,0,0,0,9,0,7,0,7,0,7,0,0,0,2,0,6,0,4,0,2,0,4,2,0,0,30,1,4,2,0,0,
+    1,1,5,2,13,1,7,2,1,0,1,1,7,2,7,1,4,0,4,2,6,1,4,2,6,1,8,2,6,0,4,1,
+    4,0,0,2,2,0,62,0,1,2,0,0,1,0,3,1,1,2,3,0,9,0,1,1,12,0,49,2,17,0,24,1,
+    0,0,23,2,21,1,7,0,0,2,28,0,40,1,26,0,16,2,8,0,35,0,35,0,5,0,24,0,10,0,6,0,
+    0,1,3,0,5,2,1,0,1,0,5,2,7,1,27,1,55,0,8,2,18,0,3,1,0,22,37,0,2,2,2,0,
+    2,0,0,24,13,0,11,0,0,0,0,0,2,1,0,0,0,1,0,0,0,1,0,0,2,0,1,1,2,1,1,0,
+    0,1,0,1,2,0,1,0,0,3,0,0,0,0,0,1,2,0,1,1,0,1,0,0,2,0,0,3,0,0,0,1,
+    2,1,0,2,0,9,2,0,0,0,0,3,1,0,0,2,2,1,0,0,2,0,2,1,0,0,0,0,2,0,0,1,
+    2,2,0,0,2,1,1,0,2,0,1,1,2,0,2,0,0,0,0,0,2,1,2,0,0,0,0,0,17,0,11,1,
+    2,2,0,1,4,0,0,0,2,0,2,1,2,0,0,0,2,0,0,0,2,0,0,0,2,0,4,0,0,0,2,0,
+    2,1,0,2,4,0,0,0,0,1,0,2,2,0,0,1,2,0,0,0,4,0,0,0,0,0,2,0,0,0,0,0,
+    5,0,11,0,0,1,0,0,4,2,0,1,0,1,0,2,2,0,2,1,2,2,4,0,0,0,2,0,0,0,1,0,
+    2,1,4,2,2,0,0,1,2,2,4,1,0,2,2,0,0,0,0,1,11,0,0,2,4,1,1,0,4,0,2,0,
+    2,1,2,4,2,2,1,0,4,0,1,0,2,0,0,0,0,0,0,0,1,0,0,1,2,2,2,0,2,0,1,0,
+    0,0,2,0,0,0,0,0,3,1,0,2,2,0,4,0,2,2,0,0,0,0,2,0,0,0,2,0,2,0,0,1,
+    4,2,10,0,0,0,3,0,5,1,3,2,0,0,2,0,2,0,2,0,4,0,0,0,0,0,2,0,0,0,2,2,
+    20,0,1,0,2,0,0,0,1,0,3,1,7,0,7,0,7,0,3,0,2,0,6,0,4,0,24,2,4,0,2,1,
+    4,2,0,0,2,0,1,0,3,1,9,2,7,1,0,2,1,1,6,0,11,0,1,0,4,0,4,1,2,2,2,0,
+    2,2,6,0,6,0,50,2,4,1,4,0,0,2,0,0,1,1,0,2,3,0,3,0,90,0,5,1,25,0,59,2,
+    43,0,1,1,2,0,15,0,15,0,4,0,7,0,5,2,36,1,32,0,18,0,12,0,11,0,39,0,23,0,22,0,
+    14,2,10,0,4,0,0,0,3,0,5,0,5,0,9,0,9,1,41,0,2,0,5,0,25,18,37,2,4,2,0,0,
+    2,0,3,16,23,10,2,0,2,1,0,0,0,0,0,1,2,2,0,3,0,0,0,0,1,1,2,0,1,1,2,0,
+    0,1,0,0,1,1,2,1,0,0,0,1,0,0,0,0,0,3,0,0,0,0,2,3,1,0,0,0,2,1,1,0,
+    0,1,2,3,2,5,1,0,2,1,0,2,0,1,0,1,0,0,2,0,0,1,0,2,2,0,2,1,0,1,0,2,
+    0,1,2,0,0,0,2,0,0,1,0,2,0,1,0,0,4,0,0,1,0,2,2,1,2,0,17,0,13,0,2,0,
+    2,1,0,0,0,2,2,1,2,0,2,0,2,0,0,0,2,0,2,0,0,1,0,0,2,1,2,2,2,0,2,0,
+    0,0,2,1,0,0,4,0,0,0,2,0,0,0,2,0,0,0,2,1,0,2,2,0,0,1,0,2,2,0,0,1,
+    19,0,2,0,2,2,2,1,0,0,0,0,0,2,2,1,0,0,0,0,2,1,0,0,4,0,2,2,2,0,2,1,
+    0,2,1,1,2,2,2,0,2,1,2,2,2,0,2,1,2,0,2,0,9,2,0,1,1,1,4,0,1,2,2,0,
+    2,4,0,1,2,2,4,0,0,0,2,0,0,0,0,0,2,0,1,0,2,0,0,0,0,0,1,0,0,0,5,0,
+    4,0,4,2,2,1,0,0,4,2,0,1,1,0,3,0,0,0,2,0,4,0,0,0,2,0,1,0,2,0,0,2,
+    2,0,8,1,2,2,2,0,2,0,2,0,3,1,5,2,3,1,2,2,0,0,2,0,2,0,2,0,4,2,0,1,
+    20,0,4,0,0,0,2,0,0,0,0,2,1,0,1,0,5,1,3,0,9,0,7,0,7,0,6,0,8,1,10,2,
+    4,0,6,0,4,0,2,0,2,2,2,1,1,0,5,0,5,0,20,0,3,0,11,0,11,0,11,2,2,1,6,2,
+    8,0,2,1,0,2,8,1,24,2,6,0,8,0,6,0,2,2,0,1,2,0,0,0,8,2,70,0,3,0,5,1,
+    5,0,37,0,33,2,23,0,1,1,8,0,53,0,1,0,4,0,9,0,10,0,34,0,22,0,14,0,8,0,35,0,
+    23,2,18,0,14,0,6,0,0,0,3,1,3,2,9,0,1,0,7,0,45,0,18,0,0,20,37,2,2,0,2,2,
+    2,0,29,0,2,22,2,0,0,0,2,0,0,0,2,0,1,3,2,2,0,1,0,1,2,0,1,1,2,2,0,3,
+    1,0,0,0,2,1,1,0,0,1,0,0,0,3,0,0,0,0,2,1,0,1,1,0,2,1,0,1,0,0,0,0,
+    2,1,1,9,0,0,2,1,0,2,2,1,0,0,2,0,1,1,0,0,2,0,0,1,0,0,0,0,2,2,2,1,
+    0,0,0,1,2,0,0,0,0,0,2,1,0,2,2,1,1,1,0,2,2,1,0,2,17,1,11,0,2,1,0,2,
+    2,0,4,0,0,1,2,0,0,0,2,0,0,0,4,1,0,0,2,0,2,0,2,0,0,0,1,0,2,1,2,2,
+    4,0,0,0,2,0,0,0,2,0,2,1,2,0,0,2,0,1,0,0,2,0,0,0,2,0,2,1,0,0,1,2,
+    17,0,2,0,0,1,2,2,2,1,2,2,2,1,0,0,0,0,2,0,0,0,0,0,0,0,2,0,2,1,2,2,
+    2,1,2,0,0,0,0,0,0,0,0,0,2,0,2,0,2,0,2,0,9,1,4,0,2,4,0,2,0,1,2,2,
+    1,0,2,0,2,0,0,0,2,0,2,0,2,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,1,0,3,0,
+    0,0,1,1,2,2,4,0,0,0,2,0,4,2,2,0,2,1,1,0,3,0,1,0,0,0,4,0,0,0,2,0,
+    1,0,4,2,2,0,2,1,4,2,2,0,2,0,2,0,2,0,3,1,5,2,3,1,4,2,0,0,0,1,2,2,
+    16,0,4,0,4,0,0,0,2,0,2,0,2,0,0,0,0,2,0,0,0,0,5,1,1,0,20,0,15,0,15,0,
+    0,0,2,0,4,0,6,0,2,1,0,2,2,0,0,0,2,0,36,0,9,2,7,1,11,2,1,1,13,2,11,0,
+    9,1,2,2,6,0,10,0,38,0,0,0,1,0,3,0,1,1,4,2,4,0,4,2,4,1,72,0,1,0,0,2,
+    3,0,3,0,3,1,21,0,33,0,36,0,14,0,29,1,71,0,45,0,16,2,3,0,3,0,38,0,26,2,14,0,
+    8,1,29,0,25,0,16,0,12,0,2,0,3,0,2,0,5,2,1,0,0,0,39,0,22,20,35,0,2,0,2,2,
+    23,0,3,0,2,4,0,20,2,0,0,1,2,0,0,0,2,0,1,1,0,0,0,0,0,1,2,0,1,1,0,0,
+    2,1,0,1,1,0,2,1,0,0,0,1,0,0,1,1,0,0,0,1,2,0,2,1,1,0,0,1,0,0,2,3,
+    1,3,2,5,0,0,2,0,0,1,0,0,0,0,0,0,2,0,1,1,0,0,2,0,2,0,0,0,0,1,2,0,
+    2,0,0,0,0,0,0,1,2,0,2,0,0,1,1,0,2,0,0,0,0,0,19,1,11,0,2,0,2,0,4,1,
+    0,0,0,0,2,0,2,0,2,0,0,0,2,1,0,2,4,0,0,1,2,2,0,1,2,2,4,1,0,0,1,1,
+    0,0,4,0,2,0,0,0,2,0,0,2,2,1,2,0,0,0,2,0,0,0,2,0,0,0,2,0,2,0,23,0,
+    2,0,2,1,2,2,2,1,0,2,2,1,2,0,0,0,2,0,0,0,2,0,0,0,0,1,0,0,0,0,2,0,
+    0,0,2,2,2,1,2,0,2,1,0,0,0,0,0,0,0,0,3,2,5,2,4,2,4,0,2,1,4,2,0,0,
+    2,1,0,2,1,1,2,2,0,0,2,1,0,0,4,2,0,0,2,0,0,1,2,2,1,0,2,0,0,0,3,0,
+    0,0,0,0,0,0,0,0,0,0,2,0,0,0,2,0,2,0,2,0,2,0,2,0,2,0,3,0,1,0,1,0,
+    2,0,0,0,4,0,0,2,2,1,0,0,4,2,2,1,4,2,0,0,4,0,0,0,5,1,3,2,1,0,0,1,
+    12,2,2,0,0,0,6,0,2,0,2,0,2,0,2,0,2,0,0,0,0,0,2,2,0,1,10,0,18,2,5,1,
+    11,0,9,1,13,2,0,0,0,0,4,0,6,2,2,0,2,0,42,0,2,0,0,0,3,0,13,0,11,0,5,1,
+    5,2,15,1,15,0,7,0,4,0,12,2,18,1,14,2,8,0,0,0,3,0,3,1,3,2,24,0,34,0,4,0,
+    4,0,2,0,1,0,1,0,3,0,40,0,19,0,49,0,22,0,12,0,59,1,55,2,12,0,29,0,5,1,28,2,
+    26,0,14,0,8,1,31,0,23,0,24,4,18,0,6,0,2,0,5,0,1,0,0,0,13,18,37,2,4,2,7,0,
+    19,0,2,0,2,2,2,10,0,12,2,0,0,1,0,1,0,2,2,1,0,0,0,1,0,0,0,1,0,0,0,1,
+    0,0,0,1,0,0,0,1,0,0,0,0,0,1,2,1,1,1,2,0,0,1,1,2,2,3,2,0,1,1,0,0,
+    2,11,1,0,2,0,1,0,2,0,0,0,2,1,0,1,0,2,2,0,1,1,0,0,2,1,0,0,2,0,0,1,
+    0,0,2,0,0,0,2,0,0,0,0,0,2,0,0,0,0,1,2,1,27,0,7,0,2,0,2,0,2,0,0,0,
+    4,0,2,0,2,0,0,1,0,0,4,0,0,0,2,0,0,1,2,2,0,1,4,0,2,0,1,0,2,0,4,0,
+    0,0,1,0,2,0,2,0,2,1,2,0,0,0,0,0,2,0,2,2,0,1,0,0,2,0,0,0,1,0,17,1,
+    2,0,2,2,2,1,0,2,4,1,0,0,2,0,2,0,2,0,0,0,0,0,2,1,0,2,0,1,2,2,1,1,
+    2,0,0,1,2,0,2,0,0,2,2,1,2,0,0,2,0,0,17,2,0,0,2,0,4,0,4,2,4,0,2,1,
+    2,2,2,1,2,2,0,1,2,2,1,0,2,0,0,1,2,0,2,0,2,2,0,0,2,0,0,0,0,1,3,2,
+    0,0,2,0,0,0,1,0,2,0,0,0,0,1,0,2,2,0,0,0,2,0,2,2,0,0,4,0,0,0,2,1,
+    1,0,2,0,3,0,0,0,1,0,2,0,0,0,2,0,2,0,4,2,0,1,4,2,2,0,2,1,0,2,3,0,
+    6,1,5,0,4,2,2,0,2,0,2,0,0,0,4,0,2,0,2,0,2,0,0,0,0,0,2,0,36,0,0,0,
+    3,0,7,2,3,1,9,0,7,2,9,0,1,1,4,0,1,2,2,0,38,1,4,2,2,0,4,0,2,0,5,0,
+    11,0,5,0,1,0,7,0,18,1,33,0,9,2,0,1,10,2,12,1,8,2,4,0,2,1,3,0,38,2,13,1,
+    9,0,2,0,6,0,4,0,4,2,1,0,84,0,1,0,61,0,43,0,14,0,14,0,43,0,31,0,4,0,31,1,
+    33,0,24,0,30,2,20,0,16,2,29,1,1,0,16,2,10,0,10,0,2,0,3,0,21,18,33,2,0,0,29,0,
+    4,2,0,2,2,1,2,0,2,16,0,6,0,0,2,0,0,1,0,0,0,0,0,1,0,0,0,0,2,3,0,2,
+    0,1,1,0,2,1,0,0,0,1,0,1,0,0,0,1,0,0,1,1,2,0,2,1,1,0,0,1,2,0,1,11,
+    0,0,2,0,0,1,2,0,1,1,2,0,0,2,0,1,0,1,0,0,2,0,0,0,1,0,4,1,0,0,0,2,
+    2,1,0,0,2,1,0,0,0,0,0,0,2,1,2,0,0,2,29,1,1,0,0,0,0,0,0,0,2,1,2,0,
+    0,0,4,0,2,1,0,2,2,1,0,0,4,0,0,0,2,0,0,1,2,2,0,0,0,1,4,0,2,0,1,0,
+    4,0,2,0,1,1,2,0,0,2,2,1,2,2,0,1,2,0,2,0,0,0,2,0,0,0,2,1,25,0,2,2,
+    2,0,2,1,2,2,4,1,0,0,2,0,2,0,0,0,2,0,2,0,2,1,0,2,2,1,2,2,1,1,2,0,
+    0,0,0,0,0,1,0,0,2,0,0,4,2,0,0,0,4,2,15,1,0,0,1,0,2,0,2,0,0,0,4,2,
+    4,1,4,2,2,1,2,2,0,1,2,0,0,2,2,0,0,0,0,0,0,0,2,0,2,0,0,0,2,0,1,0,
+    0,0,0,0,0,0,2,0,0,0,1,0,2,0,0,0,1,0,2,0,2,0,0,0,0,0,0,0,4,0,0,2,
+    4,0,4,1,2,0,0,0,1,2,1,1,3,0,0,2,1,1,0,0,2,0,0,0,4,0,4,2,0,1,4,0,
+    6,2,12,0,7,1,7,0,3,0,4,0,4,2,0,0,0,0,2,1,2,0,2,0,2,2,2,0,32,0,2,2,
+    0,0,2,1,1,2,5,0,5,1,3,0,7,2,9,0,3,1,2,0,28,2,0,0,0,1,0,2,4,1,4,2,
+    4,0,1,0,5,1,9,2,40,0,8,0,23,1,25,0,29,0,0,0,2,0,14,0,12,2,8,0,64,1,6,0,
+    0,0,15,2,17,0,15,0,15,1,2,0,60,2,1,0,5,0,9,0,47,0,41,1,16,0,14,0,35,0,11,0,
+    30,0,31,0,33,2,6,0,30,0,24,0,3,2,15,1,22,2,10,0,6,0,0,0,1,18,35,2,21,0,3,2,
+    0,0,4,1,0,2,2,0,2,0,0,16,2,4,0,0,0,0,0,0,2,1,0,0,0,1,0,0,0,0,0,1,
+    0,0,2,1,1,0,0,1,0,0,0,1,2,0,1,0,2,1,0,1,1,0,0,1,2,1,0,2,0,11,2,1,
+    0,0,0,1,1,0,0,0,2,0,0,1,2,0,0,0,0,0,2,0,0,0,0,1,0,0,1,0,2,1,0,0,
+    0,0,2,1,0,2,2,1,2,0,0,1,0,2,3,0,27,1,0,2,2,1,2,0,2,1,0,0,0,2,0,1,
+    2,0,0,1,2,2,4,1,0,2,2,1,0,0,2,0,0,0,4,0,0,1,2,0,2,0,0,0,0,0,4,0,
+    1,0,2,1,2,2,0,1,2,0,1,0,2,0,4,0,0,0,0,1,2,0,0,0,2,0,3,2,15,0,0,1,
+    0,0,2,0,2,0,0,0,2,0,4,0,0,0,4,0,0,0,2,0,0,0,2,1,2,2,0,1,2,0,0,0,
+    0,1,2,0,1,2,2,2,0,0,2,0,1,0,2,2,1,1,13,0,4,0,4,0,0,0,1,0,2,0,2,0,
+    0,2,2,1,4,2,2,1,4,2,2,0,0,1,0,0,2,2,1,0,2,0,0,0,0,0,4,1,0,2,1,0,
+    2,0,2,0,0,0,0,0,1,1,2,2,0,0,0,1,0,2,0,0,0,0,0,1,2,0,0,2,0,0,2,0,
+    1,0,4,2,4,1,2,0,4,0,0,2,2,1,3,0,0,0,3,0,0,0,0,0,1,0,1,0,4,0,2,2,
+    2,1,16,0,4,0,2,0,1,0,7,0,5,1,3,0,6,0,2,4,0,0,2,0,0,0,2,0,26,0,6,0,
+    2,0,0,2,4,0,0,1,0,2,0,0,7,1,5,0,3,2,7,0,20,1,7,0,8,2,4,1,1,2,3,1,
+    1,0,4,2,2,0,2,0,4,0,38,1,13,2,3,0,4,1,27,2,21,1,23,0,0,0,4,0,38,0,26,2,
+    14,0,8,1,4,2,2,0,0,0,15,0,15,1,48,0,7,2,6,0,3,0,5,0,51,0,43,0,14,1,5,2,
+    35,0,6,2,24,1,9,0,35,0,8,2,22,1,16,2,19,1,12,2,14,0,6,0,1,18,39,0,25,2,2,0,
+    4,0,2,2,2,1,0,2,2,0,2,0,0,16,0,4,2,0,0,1,1,0,2,0,0,0,0,1,0,0,0,1,
+    0,0,0,1,0,1,0,0,2,1,0,0,1,1,2,0,0,1,1,2,0,3,2,0,0,0,2,11,0,1,1,0,
+    0,0,0,0,2,0,0,1,0,0,0,0,0,1,2,0,2,0,1,1,2,0,0,0,0,0,2,0,1,0,2,1,
+    2,0,0,0,0,0,0,0,2,1,2,2,11,1,23,1,2,2,2,1,2,0,0,0,0,0,2,1,2,0,0,0,
+    2,0,0,0,0,1,2,2,4,1,0,0,2,0,0,1,2,2,0,0,2,0,0,0,2,1,2,0,0,0,0,0,
+    4,1,0,2,2,0,2,0,0,1,2,2,1,1,0,0,4,0,0,0,2,0,2,0,0,0,25,0,2,1,4,2,
+    4,1,1,2,0,1,2,0,2,0,2,0,2,0,2,0,2,0,0,1,2,0,2,2,0,1,4,0,0,0,2,1,
+    2,4,0,0,0,2,1,1,2,2,0,1,0,0,2,0,19,0,0,0,2,0,2,0,2,0,4,0,2,0,0,0,
+    0,0,2,0,0,0,4,2,0,1,2,0,4,2,2,0,2,1,2,0,0,0,0,0,0,0,1,2,3,0,0,1,
+    2,0,2,2,4,1,2,2,4,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,2,0,
+    0,0,2,0,1,2,2,0,0,0,6,0,2,0,4,0,0,0,0,0,1,0,1,0,1,0,0,0,1,0,1,1,
+    0,2,6,0,4,0,4,0,6,0,2,2,2,0,0,0,7,0,5,1,0,0,2,2,4,0,0,0,0,0,20,0,
+    4,0,4,0,2,0,2,2,2,1,0,0,2,2,0,0,1,1,5,0,28,2,2,1,17,0,13,0,1,0,8,2,
+    4,1,0,0,1,0,3,0,3,0,54,2,2,1,5,0,15,0,11,0,4,0,3,0,23,0,23,0,11,0,10,0,
+    18,0,22,2,14,1,10,2,6,0,4,0,4,0,96,0,15,1,31,0,27,0,19,0,6,0,4,2,43,2,15,0,
+    20,0,15,1,31,2,14,0,10,1,29,0,21,0,0,0,8,0,5,0,8,0,18,2,6,18,67,0,4,2,4,0,
+    2,0,0,2,2,0,2,0,0,1,2,2,0,1,2,14,0,6,0,2,2,1,1,0,2,1,0,0,0,1,0,0,
+    0,1,0,0,0,0,0,0,1,1,2,0,2,1,1,1,0,0,2,1,0,0,1,1,2,9,1,1,2,1,2,0,
+    1,0,2,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,2,0,0,1,0,0,2,0,0,1,0,0,0,0,
+    0,0,2,0,0,1,2,0,1,0,15,0,15,0,4,0,1,1,2,0,2,2,2,1,2,0,0,0,0,1,2,2,
+    0,1,2,0,2,0,0,1,0,0,2,2,2,0,2,1,0,1,0,0,2,0,2,0,0,2,2,1,2,0,2,0,
+    1,0,2,0,2,1,0,2,2,0,2,1,2,0,0,0,1,0,2,0,2,0,0,0,9,0,13,1,2,2,2,1,
+    2,2,4,1,2,0,0,0,0,0,2,0,2,0,0,1,2,0,2,0,2,0,2,0,2,1,1,2,2,0,2,4,
+    2,0,0,0,4,0,0,0,0,1,0,2,0,0,1,1,15,0,2,0,0,0,0,0,0,0,2,0,2,0,4,0,
+    2,0,0,0,0,0,0,0,2,0,2,2,2,1,2,0,2,2,2,0,2,0,2,0,2,0,0,1,7,0,0,2,
+    2,0,0,1,2,2,2,0,2,0,2,1,2,2,2,0,0,1,0,0,1,2,0,0,0,0,0,0,0,0,1,0,
+    2,0,0,0,2,0,0,0,2,0,0,1,0,2,2,0,2,0,4,0,2,0,2,0,0,0,1,1,1,2,0,0,
+    1,1,2,0,0,2,2,0,0,2,4,1,2,0,2,2,4,0,2,0,3,0,5,1,5,0,2,0,2,2,22,0,
+    2,0,0,0,0,0,2,0,2,0,4,0,2,0,2,0,0,2,0,1,0,0,42,0,9,0,9,2,5,1,15,0,
+    9,0,0,0,6,0,6,0,2,0,34,1,4,2,9,0,0,0,4,0,15,0,9,0,3,0,4,0,11,2,8,1,
+    33,0,13,0,10,2,24,1,18,0,10,2,6,0,28,0,66,0,2,0,0,0,5,2,27,0,25,1,21,2,7,1,
+    39,0,0,2,16,1,29,2,1,0,18,1,3,2,21,1,2,0,11,0,13,0,2,1,6,16,65,2,2,2,2,0,
+    2,2,4,1,2,0,0,0,2,2,0,1,0,2,2,1,0,6,2,12,1,2,2,1,1,0,2,1,0,0,0,0,
+    0,0,0,1,2,0,0,1,0,0,1,1,0,0,2,1,0,0,0,1,0,3,0,9,0,0,0,0,0,0,0,1,
+    2,0,1,1,2,0,0,0,0,0,2,1,0,0,0,0,0,0,2,0,0,0,0,1,0,0,0,0,2,0,1,1,
+    0,0,2,0,2,0,1,0,23,0,9,1,2,0,2,0,4,0,0,0,0,1,2,0,2,0,2,0,0,0,2,1,
+    0,0,0,0,0,0,2,0,2,0,0,1,2,0,2,2,2,1,2,0,0,0,0,0,2,1,0,2,2,1,0,0,
+    2,0,2,0,1,0,2,1,2,0,0,0,2,0,2,0,2,0,0,0,1,0,2,0,25,1,4,2,2,1,0,0,
+    0,0,2,0,2,0,4,0,4,0,1,1,0,0,2,0,2,0,2,0,2,0,0,1,2,4,2,0,2,2,0,0,
+    0,1,2,2,0,1,4,2,0,0,0,1,2,2,2,0,15,0,1,0,0,0,2,0,2,0,0,1,1,0,1,0,
+    4,0,2,2,4,1,0,0,0,0,2,0,0,0,2,0,0,0,4,0,2,0,2,0,0,0,2,2,1,0,0,0,
+    1,1,2,2,0,0,0,1,2,2,2,0,2,0,2,0,2,0,2,0,0,0,0,0,1,0,0,0,0,0,0,1,
+    1,0,3,0,2,0,2,0,2,0,0,2,2,1,0,0,0,2,0,1,2,2,2,1,4,2,2,0,2,1,1,2,
+    0,0,12,2,3,1,5,0,1,0,1,0,2,0,4,0,2,0,2,0,2,0,0,2,2,0,5,0,3,1,4,0,
+    2,0,8,0,4,0,4,0,0,2,1,0,0,0,4,0,2,1,2,2,2,0,44,0,2,0,0,1,11,2,9,1,
+    5,2,9,1,13,2,5,1,4,0,4,2,48,1,6,2,1,0,9,0,5,0,5,2,3,1,9,2,9,1,58,0,
+    9,2,25,1,29,0,23,0,5,2,24,1,20,2,12,0,78,0,10,2,4,0,2,1,3,2,5,0,5,1,27,2,
+    25,0,39,1,29,2,22,1,5,0,21,2,22,1,12,2,23,0,4,1,3,0,25,0,8,18,65,0,4,0,2,2,
+    2,0,2,0,2,2,2,1,0,0,0,0,2,0,0,0,0,0,0,0,2,8,0,10,0,0,0,0,0,1,2,0,
+    1,1,2,0,0,1,1,0,2,1,0,0,0,1,0,2,0,5,0,5,0,5,2,0,1,0,2,1,0,0,0,0,
+    2,0,0,0,1,0,2,0,0,1,1,0,2,1,0,0,2,0,1,0,0,0,4,0,0,1,0,0,0,1,2,2,
+    1,1,0,0,11,0,21,1,0,0,2,0,2,0,0,0,2,1,4,0,0,0,0,0,2,0,0,0,4,0,0,1,
+    0,0,2,0,2,0,1,0,2,1,2,0,0,0,0,0,2,0,2,0,2,0,2,1,0,2,0,1,0,0,2,0,
+    2,0,0,1,2,2,2,0,1,0,2,0,2,0,0,1,0,0,2,0,2,0,21,1,5,2,2,1,4,0,4,2,
+    2,1,0,0,0,0,2,1,0,0,4,2,2,1,0,0,0,1,2,2,2,2,2,2,0,0,2,0,2,0,2,1,
+    0,2,2,0,0,0,2,0,0,0,4,0,0,1,9,0,3,0,2,0,0,0,0,0,1,0,0,2,4,0,2,1,
+    1,0,0,1,0,2,2,0,4,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,4,0,2,0,7,0,4,0,
+    4,2,0,1,0,0,2,2,0,1,0,2,0,1,2,0,2,2,2,0,2,1,2,0,2,0,2,0,1,0,0,2,
+    0,0,0,0,3,0,1,1,1,0,0,0,2,2,2,1,2,0,2,0,0,0,0,0,1,0,2,2,2,0,4,0,
+    2,0,12,0,1,0,0,2,0,1,1,0,5,2,3,1,1,0,2,0,4,2,4,1,2,0,2,0,1,0,20,0,
+    9,0,11,0,3,0,2,0,8,0,6,0,4,0,1,0,1,2,0,1,2,0,30,2,12,1,0,2,2,1,2,2,
+    5,1,9,0,7,0,3,2,9,0,9,0,28,2,10,1,10,2,6,1,4,2,1,1,5,2,7,1,7,2,32,0,
+    9,0,8,0,1,1,17,2,23,1,23,0,21,0,16,2,60,0,26,0,16,0,10,2,4,1,2,2,1,0,5,1,
+    5,0,11,2,25,1,59,0,5,2,18,1,27,0,14,0,14,0,15,0,3,0,0,1,33,16,65,2,4,0,4,0,
+    2,0,2,2,0,0,2,2,0,1,2,0,0,0,0,0,2,0,0,1,0,2,0,1,2,6,0,6,0,6,1,1,
+    2,0,0,0,0,1,2,0,1,0,2,3,0,3,0,7,0,1,0,1,0,2,1,1,2,0,0,0,0,0,2,1,
+    1,1,2,2,0,1,1,0,2,0,2,0,1,0,2,1,1,0,2,1,2,0,1,0,2,0,0,0,0,0,0,1,
+    2,2,23,1,11,1,0,2,2,0,2,1,0,0,2,1,0,2,2,0,2,0,2,1,0,0,2,0,0,1,2,2,
+    2,0,0,1,0,0,4,1,1,2,2,0,0,1,2,0,2,0,0,0,2,1,2,2,0,1,2,0,2,2,0,1,
+    0,0,2,0,2,1,1,0,4,0,0,0,1,0,2,2,2,1,2,0,7,1,17,2,2,1,0,0,0,0,2,0,
+    2,0,4,1,4,0,0,2,0,1,0,0,2,0,4,2,2,2,0,0,1,0,2,0,2,0,2,0,0,1,2,2,
+    2,0,2,1,2,2,1,1,2,0,0,2,2,0,15,0,4,0,4,0,2,0,0,0,2,0,0,1,1,0,0,2,
+    2,1,0,2,0,1,0,0,1,0,0,0,4,0,2,0,0,0,0,0,0,0,2,0,0,0,2,0,11,0,4,0,
+    4,0,4,2,4,1,0,0,0,0,2,0,2,0,0,2,0,1,0,0,2,2,2,0,2,0,2,0,2,0,0,0,
+    2,0,6,0,1,1,1,2,0,0,1,1,3,0,1,0,0,0,2,2,0,0,2,0,0,0,0,0,0,0,0,0,
+    0,0,8,0,6,0,2,0,0,0,0,0,0,0,0,0,3,0,3,0,1,0,1,0,0,0,4,0,6,0,20,0,
+    4,0,0,0,5,0,11,0,13,0,0,0,4,0,6,0,6,0,2,0,0,0,1,0,22,0,8,0,4,0,2,0,
+    4,2,2,2,0,1,7,0,7,0,3,0,36,0,21,0,7,0,2,2,12,1,8,2,4,1,2,2,2,1,7,2,
+    58,1,35,0,25,2,0,1,8,0,17,2,13,0,17,1,15,2,6,0,40,0,26,0,18,0,10,0,4,0,0,2,
+    1,0,3,1,5,0,7,0,41,0,41,0,8,0,17,0,8,0,14,0,13,1,3,2,2,16,63,2,2,0,2,2,
+    4,0,0,0,2,0,2,0,2,0,0,0,2,0,0,0,0,0,2,0,0,1,0,0,0,0,0,0,0,0,2,2,
+    0,0,1,2,0,0,0,3,2,1,1,1,0,0,0,0,2,0,0,0,0,1,2,2,1,3,0,2,0,1,0,2,
+    2,1,0,0,2,0,0,1,0,0,1,0,2,0,0,0,0,1,0,0,0,0,2,0,0,1,0,0,0,0,5,0,
+    23,1,3,0,0,0,0,0,2,1,2,0,2,0,0,0,2,0,0,1,2,0,2,0,2,0,0,1,2,2,2,0,
+    2,1,0,2,2,1,0,0,2,0,0,1,0,2,2,1,0,2,2,1,0,0,0,0,4,0,0,0,0,1,2,0,
+    0,0,2,0,0,0,2,0,0,0,2,1,2,0,0,0,0,0,0,0,25,0,0,1,4,0,2,0,2,0,1,1,
+    2,0,0,2,2,0,4,1,4,0,0,0,0,2,0,0,2,0,2,2,4,1,0,0,0,0,0,0,2,2,0,0,
+    2,1,2,2,0,1,4,2,0,0,0,1,2,0,17,2,4,0,0,0,2,0,4,1,2,0,0,2,2,0,0,1,
+    0,2,0,1,2,2,0,1,2,0,0,0,1,0,1,0,2,0,2,0,2,0,0,0,0,0,2,0,13,0,2,0,
+    2,0,4,0,2,0,4,0,2,2,2,1,2,2,0,1,2,0,0,2,2,1,1,0,2,0,0,0,2,0,4,0,
+    0,0,6,0,4,2,2,1,1,0,1,2,0,1,0,2,3,0,1,0,0,1,1,2,2,0,2,1,0,2,0,0,
+    0,0,8,0,0,0,2,0,0,0,4,0,2,0,1,0,0,0,0,0,3,1,1,0,3,2,1,0,1,0,10,0,
+    6,0,6,0,6,0,4,0,2,0,9,1,13,0,9,0,0,0,6,2,4,0,4,1,32,2,3,0,1,2,0,0,
+    4,0,4,1,4,2,2,0,0,2,1,1,6,0,26,2,7,1,13,0,15,0,1,0,6,2,8,1,4,2,4,1,
+    74,0,1,2,9,1,29,2,37,0,9,0,12,1,17,2,7,1,22,0,47,2,9,1,38,2,24,0,18,0,10,0,
+    4,0,0,0,3,2,3,0,5,1,17,0,45,0,5,1,23,0,8,0,14,2,7,2,18,16,61,0,2,2,2,0,
+    2,0,2,0,2,0,0,0,2,2,2,0,0,0,0,0,2,0,1,0,2,0,0,0,0,1,0,0,0,1,0,0,
+    0,2,2,1,0,0,0,0,0,0,0,0,0,1,2,0,1,0,0,1,2,0,1,0,2,0,0,1,0,0,0,0,
+    0,0,0,1,0,0,2,2,0,1,0,1,0,0,0,0,2,0,0,0,0,0,0,1,0,2,2,1,17,0,17,0,
+    0,1,4,0,0,0,0,1,0,2,0,0,2,1,2,0,0,0,2,0,2,1,0,2,2,1,2,0,0,0,0,1,
+    2,2,2,1,2,0,0,0,0,0,2,0,2,1,0,0,0,0,0,0,2,0,2,1,0,0,2,0,2,0,0,0,
+    2,0,1,0,2,0,2,1,0,0,2,2,0,1,2,0,2,0,21,1,5,2,4,0,0,0,2,0,2,1,2,0,
+    0,0,2,1,0,1,0,2,2,4,4,0,2,0,2,0,1,0,2,1,0,2,2,0,2,0,2,0,0,1,0,0,
+    2,2,0,1,4,2,1,1,4,0,2,2,9,0,5,1,0,0,2,0,2,0,0,2,2,0,6,1,0,0,2,2,
+    0,1,2,2,1,1,2,0,1,2,4,1,0,0,2,0,1,0,0,0,1,0,2,0,2,0,3,0,9,0,2,0,
+    2,0,0,1,2,2,4,0,4,0,0,0,2,0,2,0,2,0,2,0,1,0,4,0,0,0,0,0,0,0,0,0,
+    2,0,4,0,2,0,4,2,2,0,2,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,2,0,1,1,
+    2,2,6,1,1,2,2,1,2,2,0,0,2,1,2,2,4,0,0,0,0,0,1,0,2,1,3,0,3,0,8,0,
+    5,0,1,0,2,0,2,0,4,0,6,2,4,0,0,0,7,1,11,0,3,0,0,2,14,2,8,0,10,0,4,0,
+    0,1,1,2,0,0,4,0,4,0,0,0,2,0,52,0,15,0,11,0,3,0,9,0,15,0,3,0,2,0,6,0,
+    18,2,52,1,4,2,0,1,0,2,19,1,37,2,17,1,2,2,22,0,15,1,2,2,47,1,15,0,36,2,24,1,
+    14,2,8,0,4,1,1,2,1,0,1,0,3,0,37,0,0,1,31,2,10,0,16,1,13,14,61,2,4,2,2,0,
+    2,2,2,0,0,0,2,0,0,0,0,0,2,1,0,0,0,0,2,0,0,0,0,0,0,0,0,0,2,0,0,0,
+    0,1,0,0,0,0,2,0,1,1,2,0,0,2,1,1,2,1,0,2,0,0,2,1,1,0,0,0,0,0,0,1,
+    2,0,0,0,0,0,0,1,0,0,2,0,0,0,0,0,0,1,0,0,0,1,0,2,5,1,23,0,3,0,2,1,
+    2,2,1,0,2,1,2,0,0,1,0,0,0,0,2,0,2,0,0,0,2,0,2,1,0,0,2,0,2,0,2,0,
+    1,1,2,0,0,0,2,0,4,0,0,0,0,0,0,0,2,1,0,0,0,0,2,0,0,0,2,0,0,0,2,1,
+    2,0,2,0,0,1,0,2,2,1,1,0,2,0,2,0,9,0,17,0,4,1,1,0,4,0,2,0,0,0,4,0,
+    2,1,0,2,2,2,0,0,0,0,2,0,2,0,2,0,4,0,0,0,0,0,0,0,2,0,0,1,2,2,2,1,
+    0,0,0,2,0,1,4,0,0,2,0,1,15,0,0,0,2,0,2,0,2,0,2,0,2,0,0,2,4,1,2,0,
+    2,2,0,1,2,0,0,2,2,1,1,0,2,2,0,0,2,1,0,0,2,0,1,0,1,0,13,0,2,0,0,1,
+    2,0,0,2,2,0,2,0,2,1,4,2,2,1,2,2,2,0,0,1,4,2,0,0,0,0,0,0,2,0,0,0,
+    0,0,3,0,4,0,2,0,4,0,4,0,4,2,2,0,2,0,0,1,3,2,0,0,1,1,0,2,3,1,2,2,
+    0,1,6,2,2,1,0,2,0,1,3,0,0,2,2,1,2,0,2,2,0,0,4,0,1,0,0,0,0,0,0,0,
+    14,0,5,0,3,0,1,0,4,0,0,0,2,0,2,0,4,2,2,0,3,0,7,0,6,1,3,0,1,0,6,0,
+    2,2,4,0,2,0,1,1,1,0,2,2,4,0,44,0,4,0,2,0,11,0,11,0,3,1,7,2,11,1,3,2,
+    1,0,46,2,12,1,8,2,4,1,0,2,0,1,11,2,27,1,22,0,11,0,35,0,3,2,10,1,43,0,9,2,
+    38,1,26,2,14,0,10,1,4,2,0,0,5,1,5,0,37,2,6,1,33,2,8,0,8,16,61,0,4,0,2,2,
+    2,0,2,0,2,0,0,0,2,0,0,0,0,2,2,0,0,1,2,0,1,0,2,0,0,0,0,0,0,0,0,1,
+    2,2,0,1,0,0,1,0,2,0,0,0,0,1,0,0,0,0,2,1,1,0,0,0,2,0,0,1,0,0,0,0,
+    0,0,0,0,2,1,0,0,0,0,0,0,0,0,0,1,2,2,0,1,0,0,19,1,15,0,2,0,0,0,2,0,
+    0,1,2,0,0,2,0,1,0,0,2,0,0,0,0,0,2,3,2,0,0,0,0,0,2,0,2,2,2,1,0,0,
+    2,0,2,0,0,0,2,0,0,1,0,1,2,0,2,0,0,0,2,0,0,0,0,0,2,1,0,0,2,0,0,2,
+    2,1,2,0,0,0,2,1,1,2,2,1,2,0,1,1,27,2,2,1,2,0,2,0,2,0,0,1,2,2,2,1,
+    2,4,2,0,2,0,2,2,2,1,1,0,2,0,0,0,2,0,2,0,4,0,2,0,0,1,0,2,0,0,2,0,
+    0,0,2,1,0,0,1,2,2,1,2,0,19,2,2,0,4,0,2,0,2,0,2,0,2,1,0,0,2,2,0,1,
+    2,0,4,0,2,2,2,1,0,0,0,2,2,1,0,0,0,0,0,0,0,0,4,0,0,0,11,0,1,1,0,2,
+    0,0,2,0,0,1,1,0,2,2,0,1,4,2,2,1,2,2,4,0,0,1,2,0,2,0,2,2,0,0,0,0,
+    0,0,3,0,0,0,0,0,2,2,2,0,4,1,4,0,2,0,2,2,4,0,0,1,0,2,1,1,1,2,0,1,
+    3,2,4,1,2,2,0,1,2,0,4,2,0,1,1,0,3,0,1,0,4,0,2,0,2,0,2,0,0,0,0,0,
+    18,0,1,0,0,2,3,0,5,0,3,0,0,0,6,2,0,0,2,0,0,0,4,0,30,0,9,0,13,1,7,0,
+    0,0,4,0,4,0,0,2,2,0,3,1,5,0,10,0,16,0,4,0,4,2,4,1,7,2,9,0,3,0,5,0,
+    9,0,26,1,7,2,8,0,14,2,10,1,6,2,4,0,0,0,36,1,1,2,21,0,19,1,45,2,8,1,4,0,
+    41,0,1,0,32,2,18,0,10,1,4,0,0,2,3,0,1,0,35,0,8,1,25,2,12,14,59,2,2,0,2,0,
+    2,2,2,0,2,0,0,2,2,1,2,2,0,1,0,0,2,2,1,1,2,0,0,0,0,0,2,1,1,0,2,2,
+    0,1,1,0,2,1,0,0,0,0,0,0,0,0,2,0,1,0,0,0,2,1,0,0,0,0,0,0,0,0,0,1,
+    0,0,0,0,0,0,2,0,0,1,0,0,2,1,0,0,1,0,5,0,23,0,1,0,1,0,0,0,4,1,1,0,
+    2,0,2,1,0,0,2,0,2,0,1,1,2,0,0,0,0,0,2,0,0,0,2,0,2,0,0,1,0,1,2,0,
+    4,0,0,0,0,0,0,0,2,1,2,2,2,0,0,0,2,1,0,0,2,0,0,1,0,2,0,0,2,1,2,0,
+    1,0,2,0,2,0,0,0,4,1,0,0,1,0,25,0,0,1,2,2,0,0,4,1,0,0,2,0,2,0,0,4,
+    2,1,2,0,2,2,2,1,0,0,4,0,0,0,0,0,0,0,2,0,0,0,2,0,2,0,2,0,2,1,0,2,
+    2,1,0,2,2,0,2,1,1,0,17,2,3,1,4,0,2,0,2,0,2,0,2,0,2,2,2,1,2,0,0,2,
+    2,1,0,2,2,1,2,0,2,2,2,1,0,0,2,0,0,0,0,0,2,0,1,0,2,0,7,0,2,0,0,0,
+    1,0,0,1,1,2,2,1,1,0,2,0,0,0,2,0,0,0,2,0,2,2,2,0,2,0,2,0,2,0,2,0,
+    0,0,1,0,0,0,2,2,0,1,1,1,0,2,0,0,4,0,4,0,2,0,2,0,2,0,2,2,2,1,1,0,
+    0,0,4,0,3,0,1,0,1,0,2,0,2,0,2,2,4,0,2,1,3,0,3,0,2,2,0,0,2,0,2,0,
+    16,2,2,0,1,1,0,0,1,0,0,0,3,2,5,1,3,0,4,0,4,0,0,0,8,0,18,0,4,2,5,0,
+    11,0,9,0,1,1,4,0,6,0,6,2,2,0,0,1,32,2,11,1,9,0,4,2,6,0,2,0,3,0,13,0,
+    1,0,28,2,13,1,3,0,9,0,6,2,14,1,8,0,6,2,2,0,82,0,23,1,37,2,0,1,31,0,45,0,
+    14,0,7,0,33,1,16,2,22,0,12,0,10,0,2,0,3,2,1,0,25,0,10,0,11,14,57,2,2,2,2,0,
+    2,1,0,2,2,2,2,1,0,2,0,1,2,0,2,0,1,0,2,0,0,0,0,1,2,2,1,0,2,1,0,0,
+    1,0,4,0,1,0,2,0,0,0,0,1,0,0,1,0,2,1,0,0,0,0,0,0,0,0,0,0,2,1,0,2,
+    0,1,0,1,0,0,0,0,2,0,0,0,0,0,0,0,19,1,15,0,2,0,0,1,2,0,0,0,0,0,2,0,
+    0,0,2,0,2,1,1,0,0,0,4,0,0,1,0,0,0,0,0,0,2,0,2,1,0,0,0,0,2,0,2,0,
+    0,0,2,1,2,0,2,0,1,0,2,0,0,0,2,1,0,2,2,1,2,0,0,0,0,0,2,1,0,0,0,0,
+    2,0,0,1,0,0,4,2,0,0,2,1,15,0,11,0,0,0,2,1,2,0,0,0,2,0,2,2,0,2,2,1,
+    2,0,2,2,0,1,2,0,2,0,0,0,2,0,4,0,0,0,0,0,2,0,0,1,2,2,2,0,2,0,0,0,
+    0,0,2,1,0,2,2,0,2,0,19,1,2,0,1,0,0,0,4,0,2,0,2,0,2,0,2,2,0,1,4,0,
+    2,0,0,0,0,0,2,2,2,1,2,0,0,0,0,0,2,0,2,0,0,0,0,0,0,0,11,1,2,2,2,0,
+    2,1,2,2,2,1,1,2,0,1,1,0,0,0,1,2,2,1,0,2,4,1,0,2,2,0,2,0,2,0,0,0,
+    4,0,3,0,0,0,0,1,0,0,4,2,0,0,0,0,0,0,0,0,0,0,4,0,4,0,0,1,2,2,2,2,
+    2,1,2,0,6,0,3,0,1,2,3,1,1,0,0,0,2,0,2,0,4,2,4,0,1,1,1,2,1,0,2,0,
+    16,0,2,0,1,0,2,0,3,0,1,2,0,1,1,0,0,0,5,0,1,0,0,0,2,0,26,0,0,0,2,0,
+    1,0,1,0,7,0,11,0,3,0,2,0,8,0,6,2,44,0,8,2,4,1,11,0,11,0,11,0,2,2,6,1,
+    1,0,3,0,36,2,11,1,11,0,1,0,11,0,1,0,10,0,4,0,72,0,0,0,1,0,33,0,31,2,16,1,
+    39,0,27,0,6,0,23,1,11,2,24,0,16,0,10,2,6,1,6,2,3,0,17,1,15,14,57,2,2,0,2,0,
+    2,2,2,0,0,1,2,2,2,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,0,1,0,0,0,2,0,1,
+    2,0,1,0,2,0,1,1,2,0,0,0,0,0,2,0,1,0,0,0,2,0,0,1,0,1,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,1,0,2,2,1,11,0,19,1,1,0,0,2,2,1,0,0,2,0,0,1,1,0,2,0,
+    2,1,1,0,2,0,4,0,0,1,1,2,2,0,0,1,2,0,0,0,0,1,2,2,0,1,2,0,2,0,0,0,
+    0,1,2,2,2,1,0,0,2,0,0,0,2,1,2,2,0,1,2,0,1,0,2,0,2,1,0,2,2,0,0,1,
+    2,0,1,0,4,0,1,1,0,0,7,2,17,1,2,0,4,1,1,0,2,0,2,2,0,2,2,0,2,1,2,2,
+    0,0,0,1,2,0,2,0,0,0,4,0,2,0,0,0,2,0,2,0,0,1,0,2,0,0,2,1,0,2,4,1,
+    2,2,0,0,0,1,0,0,3,2,11,0,2,0,2,0,0,1,1,0,0,0,4,0,0,0,4,0,2,0,2,0,
+    0,0,4,0,2,0,1,0,2,0,2,0,2,0,2,0,2,0,0,0,0,0,2,0,0,0,9,0,0,0,0,1,
+    2,2,2,0,0,0,2,1,2,2,2,0,3,0,0,1,0,2,1,1,1,2,2,1,0,2,2,1,0,0,4,2,
+    2,0,5,0,6,0,2,0,2,0,1,0,1,0,2,0,0,1,0,0,2,0,0,2,0,0,4,0,2,0,2,0,
+    2,0,2,2,12,1,0,2,0,1,3,0,3,0,1,0,3,0,1,2,2,1,0,2,4,0,4,0,2,0,3,0,
+    10,0,0,0,6,0,2,0,2,0,1,0,1,0,3,0,1,0,1,0,1,0,1,0,0,0,10,0,4,0,6,0,
+    10,0,2,0,1,2,1,1,9,0,9,0,5,0,2,0,26,0,12,0,10,2,6,0,4,0,4,0,9,0,11,0,
+    5,0,1,0,46,0,17,0,5,0,9,0,11,2,8,1,9,0,2,2,12,1,72,2,6,1,2,0,7,0,43,0,
+    15,0,7,1,39,0,9,2,15,1,23,0,8,2,30,0,20,2,6,1,0,0,15,2,5,14,57,0,2,0,4,2,
+    0,0,2,0,2,2,2,1,1,0,4,2,0,0,0,0,0,1,2,2,0,1,0,2,0,0,0,1,2,0,1,0,
+    0,0,2,0,0,1,0,2,0,1,0,0,2,0,1,1,2,0,0,0,1,0,2,0,0,0,2,0,1,0,2,1,
+    1,0,2,0,0,1,0,0,1,0,21,0,9,1,0,2,0,0,2,1,0,0,2,0,0,1,0,0,2,0,0,1,
+    0,2,2,0,0,0,0,1,2,0,2,1,1,0,4,0,0,0,0,0,0,0,1,1,4,2,2,1,0,0,0,0,
+    2,0,0,1,2,2,2,1,2,0,0,0,0,0,0,1,2,0,0,2,4,1,0,0,0,0,2,1,1,0,2,0,
+    0,0,2,0,0,1,0,0,1,0,27,1,2,2,4,1,2,0,4,4,0,0,0,0,2,0,2,0,0,0,0,1,
+    2,0,2,2,2,0,0,0,2,0,0,1,0,0,2,0,2,0,2,0,2,0,2,0,0,1,0,2,2,1,0,2,
+    2,1,2,0,2,2,0,0,21,1,2,0,0,0,4,0,2,2,2,0,2,1,3,0,2,0,2,0,2,0,0,0,
+    4,0,0,0,2,0,4,1,0,2,0,0,2,0,0,0,2,0,2,0,2,0,0,0,3,1,3,2,2,0,2,0,
+    0,1,1,0,2,2,2,2,0,1,2,2,2,1,2,2,1,1,2,0,1,0,0,0,1,1,1,2,2,0,0,1,
+    0,0,5,0,2,2,2,0,4,0,4,0,4,0,0,1,0,2,1,0,0,0,0,1,0,0,0,2,2,0,0,0,
+    4,0,2,0,8,0,4,0,2,0,2,2,2,0,3,1,3,2,3,1,3,2,1,1,1,2,2,1,2,2,4,0,
+    14,1,2,2,3,0,3,0,6,2,6,1,2,0,2,0,0,0,3,0,5,0,3,0,5,0,18,0,0,0,5,0,
+    0,0,2,0,6,0,8,2,2,0,1,0,7,0,13,0,8,0,0,0,2,0,14,0,12,0,6,0,6,0,2,0,
+    1,0,7,0,46,0,3,0,11,0,27,0,1,1,11,2,3,0,6,1,7,2,44,0,20,0,10,0,6,0,0,0,
+    17,0,35,0,10,0,25,1,11,2,11,0,25,0,7,0,16,0,12,0,6,2,1,3,19,14,55,0,2,2,2,0,
+    2,0,2,2,0,1,0,2,4,0,1,1,2,2,0,1,2,2,1,1,2,2,0,1,0,0,2,2,1,1,2,0,
+    0,1,0,0,0,2,2,1,1,0,2,0,1,1,2,2,0,0,0,1,2,0,1,0,2,0,1,1,2,0,1,0,
+    2,0,0,1,0,2,15,0,17,1,0,0,2,0,0,0,2,1,0,0,1,0,2,0,0,0,2,0,2,1,0,0,
+    0,0,0,1,2,0,0,2,2,1,0,0,2,0,1,0,2,0,0,1,2,0,0,0,1,1,2,0,2,0,2,1,
+    0,2,0,0,2,1,0,0,2,0,2,1,2,2,0,0,0,0,2,1,0,0,2,0,0,0,0,1,2,0,2,0,
+    0,0,2,1,1,2,2,1,29,0,0,0,0,1,2,2,2,4,2,1,4,0,2,2,0,1,0,0,4,0,2,0,
+    0,0,2,1,0,0,0,0,2,0,2,2,0,1,2,0,0,0,2,0,0,0,2,0,4,0,0,0,0,0,0,1,
+    0,2,2,0,2,1,2,0,19,0,0,0,2,0,2,0,2,0,2,0,2,2,2,1,0,0,1,1,0,2,4,0,
+    0,0,2,0,2,0,0,0,2,1,2,2,0,0,4,0,1,0,2,0,2,1,2,0,9,2,2,1,2,0,0,2,
+    0,2,2,1,2,0,1,0,2,0,0,0,4,0,0,0,2,0,0,0,2,0,1,0,0,0,0,1,1,0,0,0,
+    11,2,0,0,0,1,6,0,2,0,4,0,2,0,4,2,2,0,4,0,0,0,0,2,1,1,0,0,0,0,0,1,
+    1,2,2,0,0,0,6,0,4,2,4,1,4,2,2,0,2,0,0,0,3,0,3,0,3,1,3,2,0,1,1,2,
+    8,0,2,1,6,2,4,0,1,1,3,2,0,0,4,0,4,0,4,0,4,0,1,0,1,0,14,0,17,0,3,0,
+    1,0,2,0,1,0,2,0,2,0,8,0,4,0,4,0,2,0,0,0,17,0,5,0,2,0,12,0,10,0,10,2,
+    4,0,4,0,12,1,36,2,11,0,0,1,11,2,25,0,9,1,17,2,4,1,42,0,15,0,10,2,18,1,8,0,
+    4,0,2,2,33,0,5,0,5,0,13,2,4,1,31,0,11,0,14,0,10,1,5,2,13,12,53,2,2,0,0,2,
+    2,0,0,0,4,2,0,1,0,0,2,2,0,1,2,2,0,1,2,2,1,1,2,0,0,0,0,0,0,0,0,0,
+    2,0,1,0,0,1,2,0,0,0,0,0,0,0,0,0,0,1,2,0,1,0,2,0,1,0,2,0,0,1,0,0,
+    0,0,5,0,21,1,5,0,0,0,0,0,0,0,2,1,2,0,0,0,2,1,1,0,2,0,2,0,0,0,0,0,
+    2,0,0,0,0,1,2,0,0,0,2,0,0,1,2,0,1,0,2,0,0,1,2,0,0,0,0,0,1,0,4,0,
+    2,1,0,0,0,0,2,0,0,0,2,0,0,1,2,0,2,0,0,0,0,0,0,1,4,0,0,2,2,1,1,0,
+    2,1,0,2,2,1,27,0,3,0,4,0,2,2,0,2,0,1,2,0,2,0,2,0,4,0,2,0,1,0,2,0,
+    2,0,0,0,2,1,2,0,0,0,0,0,4,2,1,1,4,0,1,1,2,2,2,0,0,0,2,1,2,2,2,0,
+    0,1,0,0,0,2,19,0,0,0,4,0,2,0,0,1,2,0,2,0,0,0,4,0,2,0,2,0,0,0,1,1,
+    2,2,0,1,2,2,2,0,2,0,0,1,4,0,1,0,4,0,0,0,0,2,0,1,11,0,4,2,2,0,4,0,
+    2,0,2,0,1,0,2,1,0,2,0,1,0,2,2,1,0,2,2,0,0,1,2,0,2,2,0,0,0,0,1,0,
+    5,1,1,0,2,2,1,0,0,0,0,0,2,0,4,0,4,0,2,0,4,0,2,0,2,0,0,0,1,0,0,0,
+    0,0,0,0,2,2,2,0,2,1,4,2,2,0,4,0,2,0,2,0,2,0,2,0,1,2,3,1,3,0,3,0,
+    8,0,1,0,0,0,0,0,2,0,4,1,0,2,3,0,3,0,0,0,4,0,4,0,2,0,30,0,2,0,7,0,
+    15,0,15,0,1,0,1,0,2,0,0,2,2,0,2,0,6,0,36,0,0,0,21,1,19,0,11,0,4,0,8,0,
+    12,0,8,0,6,2,54,0,4,1,7,2,13,1,3,0,9,2,15,1,9,0,4,0,4,0,1,1,13,2,18,2,
+    18,0,10,1,6,2,13,2,19,1,2,0,23,0,12,0,27,1,21,2,8,0,12,0,14,14,55,0,4,2,2,1,
+    2,2,2,0,1,0,2,2,2,0,0,1,2,2,0,1,0,2,0,1,0,0,2,0,0,0,0,0,2,0,0,1,
+    1,2,2,1,0,2,0,1,0,0,0,0,2,0,0,1,0,2,1,0,2,1,0,1,0,0,0,0,0,0,2,0,
+    19,0,15,0,0,0,2,1,1,0,2,0,2,0,0,0,0,0,2,1,0,0,2,0,0,0,0,1,0,0,2,0,
+    0,1,2,0,0,2,0,1,0,0,0,0,4,0,0,0,2,1,0,0,0,0,0,0,2,0,1,1,2,0,1,0,
+    2,0,2,0,2,1,0,0,0,0,2,0,0,0,2,1,2,0,0,0,2,1,0,2,0,0,2,1,0,2,2,1,
+    0,0,2,1,23,2,5,0,2,1,0,4,0,0,2,1,2,0,0,0,0,2,4,1,2,0,2,0,2,0,2,0,
+    0,1,2,0,0,2,2,0,2,1,2,0,1,0,4,0,1,0,2,0,2,0,0,1,0,2,2,0,0,1,2,2,
+    2,0,0,0,2,1,25,0,4,0,2,0,4,0,2,2,2,1,0,0,2,0,0,0,2,0,2,0,2,0,2,0,
+    0,1,0,2,1,1,2,0,2,0,2,0,0,0,4,0,0,0,0,0,2,0,0,2,13,0,2,0,2,0,2,0,
+    4,0,2,0,4,0,2,0,0,0,0,0,1,0,2,0,0,1,0,2,2,0,2,0,0,0,2,0,2,0,0,0,
+    3,0,1,0,1,1,1,2,2,0,0,0,2,0,1,0,0,0,2,0,2,0,2,0,4,0,4,0,2,0,0,2,
+    0,0,0,0,6,0,3,1,1,2,0,0,2,0,4,0,4,0,4,0,2,0,2,0,2,0,0,0,1,0,1,1,
+    3,2,10,0,5,1,1,2,0,0,2,0,2,1,4,0,4,2,1,1,5,0,0,2,0,0,2,0,30,0,2,0,
+    2,0,0,0,13,0,15,0,9,0,1,0,1,0,2,0,0,0,16,0,8,0,8,2,2,0,11,1,21,0,11,0,
+    3,0,10,0,10,0,38,0,12,2,8,1,6,2,3,1,11,0,7,0,13,0,4,1,12,2,23,2,12,1,19,0,
+    5,0,22,2,14,0,6,1,3,2,29,1,10,2,25,1,14,0,17,0,21,2,22,2,18,12,51,2,0,0,2,2,
+    0,0,2,0,2,0,2,0,0,0,2,0,1,0,2,0,0,0,0,0,2,0,0,0,2,0,0,1,1,0,0,2,
+    2,1,0,2,0,1,0,0,0,0,0,0,0,1,2,0,0,0,2,0,1,0,0,0,2,0,0,0,11,0,19,1,
+    1,0,0,1,0,0,0,2,2,1,0,1,0,0,0,0,2,0,0,0,2,0,0,0,0,1,0,2,2,1,0,0,
+    2,0,0,0,0,1,2,0,0,0,2,1,0,2,0,1,2,0,0,0,0,0,2,0,0,1,2,2,0,1,0,0,
+    1,1,2,0,2,2,0,1,2,0,0,0,2,1,0,2,0,1,4,0,0,0,2,0,1,1,2,0,0,0,2,0,
+    2,0,19,0,11,1,2,2,2,2,2,1,0,2,2,0,0,0,4,0,0,1,0,0,0,0,2,0,4,0,0,1,
+    2,2,2,0,0,0,2,1,2,2,0,1,2,0,0,0,2,0,2,0,0,0,0,0,2,1,0,2,0,0,2,1,
+    0,0,2,0,19,0,0,0,1,0,2,0,2,0,2,0,2,2,4,1,2,0,0,0,2,0,0,0,2,0,2,0,
+    2,0,2,1,2,0,1,0,1,0,2,2,2,0,0,0,2,0,2,0,0,0,4,0,13,0,0,0,2,1,0,0,
+    2,0,2,2,2,1,2,2,2,1,4,2,2,1,1,2,2,0,0,1,0,2,1,0,4,0,0,0,2,0,2,0,
+    3,2,4,0,0,0,0,1,3,0,0,0,1,0,2,0,2,0,0,0,1,0,4,0,0,2,0,0,2,0,4,0,
+    2,0,0,1,2,0,2,2,2,0,0,1,1,0,3,2,2,1,2,2,4,0,4,0,2,0,4,0,2,0,2,2,
+    1,1,22,0,9,0,5,1,7,0,5,2,0,0,0,0,2,1,4,2,4,2,0,1,1,0,1,0,22,0,6,2,
+    4,0,0,0,4,0,1,0,5,0,17,1,9,0,3,0,1,0,22,0,1,0,1,0,0,0,10,0,4,0,9,0,
+    15,0,11,0,3,0,8,0,20,1,16,2,10,1,6,2,4,1,1,0,13,2,13,0,16,0,0,0,21,0,8,0,
+    0,2,27,1,2,0,18,2,12,0,10,0,25,1,8,2,23,0,12,1,11,0,15,2,24,12,51,0,2,2,2,0,
+    2,0,0,0,2,2,0,0,0,0,0,0,2,0,0,0,2,0,0,0,2,0,1,0,0,0,2,0,0,0,2,1,
+    1,0,0,0,2,0,1,0,2,0,0,1,0,2,0,0,0,1,0,0,0,0,0,0,0,1,21,0,9,0,0,0,
+    0,1,2,2,0,0,0,1,0,0,2,0,1,0,2,1,0,0,2,0,0,0,2,1,0,2,0,1,0,2,2,1,
+    0,0,0,0,2,1,0,0,2,0,0,0,0,1,2,2,0,0,2,1,2,0,1,1,0,2,2,1,0,0,0,0,
+    2,0,0,1,1,0,4,0,0,0,0,1,2,2,0,1,2,2,1,1,2,0,2,1,4,0,1,0,2,0,0,1,
+    15,0,13,2,2,2,0,0,2,0,0,0,4,1,0,0,2,0,0,0,2,0,0,0,2,0,0,0,2,1,2,2,
+    2,0,2,0,2,1,0,2,0,1,2,2,2,1,2,2,0,1,0,0,2,0,2,0,0,0,0,1,2,0,1,0,
+    2,2,2,0,25,0,4,0,4,1,0,0,0,0,0,0,4,1,2,2,2,0,4,0,0,1,2,2,0,1,0,0,
+    2,2,2,0,2,0,2,0,2,0,1,1,1,0,2,0,0,0,2,2,2,0,13,0,0,1,4,0,2,2,0,0,
+    0,1,2,0,2,2,2,1,2,2,2,0,2,0,4,0,0,0,0,2,2,1,2,0,1,0,0,0,0,0,2,2,
+    1,1,0,0,2,0,2,0,2,0,0,0,1,0,1,0,1,0,0,0,4,0,1,0,2,0,0,0,2,0,0,0,
+    0,0,2,2,4,0,2,1,0,0,0,2,2,0,2,1,1,2,3,1,0,0,0,2,6,1,2,2,4,0,2,1,
+    4,2,22,0,4,0,1,0,5,0,5,1,7,0,5,2,1,0,1,0,0,0,2,0,4,0,2,0,20,2,5,1,
+    2,0,2,0,4,0,6,0,2,0,2,0,3,0,13,0,13,0,12,0,7,0,8,1,4,0,5,2,5,0,2,0,
+    6,0,7,1,13,0,4,0,11,0,0,0,16,2,16,1,12,2,10,2,6,1,2,2,48,1,39,0,13,2,3,0,
+    7,1,22,2,13,0,19,1,0,0,4,0,4,2,25,1,2,0,17,2,22,0,7,1,13,12,51,2,2,1,2,2,
+    0,0,2,2,2,1,0,0,2,2,0,0,2,0,0,0,0,0,2,0,1,0,2,0,0,0,0,0,2,1,1,2,
+    2,0,0,1,1,0,2,0,0,0,0,0,2,1,1,0,2,0,0,0,0,1,13,0,19,2,0,1,2,0,0,0,
+    0,0,0,0,2,1,0,0,0,0,0,0,0,1,0,2,2,0,0,1,2,0,0,0,2,1,0,0,0,0,0,0,
+    0,0,2,1,2,2,0,1,0,0,0,0,2,0,0,1,2,0,0,0,2,0,2,0,0,1,1,0,2,0,0,0,
+    0,0,0,0,2,1,1,2,2,1,2,0,0,1,2,0,0,0,2,0,0,0,0,0,2,0,2,0,0,3,13,2,
+    17,2,0,0,4,0,2,0,0,0,2,0,2,0,0,0,2,0,2,1,0,0,2,0,2,0,0,0,0,0,2,0,
+    2,0,0,1,4,2,0,1,2,2,0,1,2,0,0,0,2,0,2,0,0,0,0,0,2,0,2,0,0,0,2,0,
+    0,1,25,0,0,0,0,0,2,0,4,0,2,0,4,0,1,0,0,0,2,1,4,2,2,0,2,1,2,2,2,0,
+    0,1,0,0,0,0,4,0,0,2,2,0,2,0,1,0,0,0,0,1,2,0,17,0,4,2,2,0,2,0,4,1,
+    4,2,0,0,0,0,2,0,2,0,0,0,4,0,0,0,4,0,2,0,2,0,0,2,0,1,0,0,0,0,1,1,
+    7,2,6,0,2,0,2,0,0,0,2,0,2,0,0,0,0,0,1,0,1,0,0,0,0,0,2,0,0,0,0,0,
+    4,0,0,0,4,0,0,2,0,1,0,0,0,0,0,0,2,0,4,2,0,1,1,0,3,0,0,0,2,0,4,2,
+    2,1,20,0,4,0,4,0,4,2,1,0,1,0,5,0,7,0,3,0,3,1,0,2,1,0,0,0,26,1,2,2,
+    3,0,3,0,1,0,0,0,4,0,6,0,2,0,2,0,2,0,14,1,9,0,13,2,11,0,4,0,8,0,0,1,
+    9,0,5,2,0,1,4,0,15,2,0,1,5,0,4,2,10,0,18,0,12,0,8,0,62,2,6,0,25,1,43,0,
+    2,2,17,0,18,1,4,2,15,1,0,2,5,1,0,0,15,2,10,0,9,0,6,1,17,12,51,0,2,2,2,0,
+    2,2,2,1,0,2,2,0,0,1,2,2,0,0,0,0,0,0,0,0,2,0,0,0,0,1,0,0,0,2,2,1,
+    0,0,0,0,0,0,0,0,2,1,0,0,1,2,2,1,0,0,3,1,19,2,7,0,1,1,2,0,0,0,0,0,
+    2,0,0,1,0,0,0,0,2,0,0,0,0,0,0,1,0,0,0,0,2,0,0,0,0,0,4,0,0,1,0,0,
+    0,1,2,2,1,1,2,2,2,1,0,0,0,0,2,1,0,0,0,0,0,0,2,0,2,0,0,0,0,0,2,3,
+    0,0,2,0,1,0,2,0,0,0,0,0,2,0,0,0,0,1,2,0,0,1,0,0,0,0,2,0,9,2,19,2,
+    0,0,2,0,0,0,2,1,4,0,2,0,0,0,2,0,0,1,2,2,2,0,0,1,0,0,4,0,0,0,0,0,
+    0,1,2,2,2,1,2,2,2,1,2,0,0,2,0,1,2,0,0,0,2,0,2,0,0,0,2,0,2,0,0,0,
+    0,1,23,0,2,0,1,0,0,0,2,0,2,0,2,1,4,2,2,1,0,2,1,1,4,0,2,2,4,1,2,0,
+    0,0,2,2,2,0,1,0,2,1,2,0,0,0,2,0,2,0,0,0,1,0,21,0,4,0,4,0,2,0,4,2,
+    0,0,4,0,4,0,0,0,2,0,2,0,0,0,2,0,0,0,4,0,0,0,2,0,2,0,0,0,0,0,2,0,
+    3,1,3,2,0,0,2,0,4,0,2,0,0,2,2,0,0,0,2,0,0,0,1,0,1,0,1,0,0,0,4,0,
+    1,1,2,0,0,0,2,0,6,2,2,1,0,0,0,2,1,1,1,0,0,0,2,0,2,0,0,0,3,0,0,1,
+    0,2,10,0,6,2,6,0,4,0,6,0,2,0,2,0,3,0,3,0,5,0,5,1,3,2,2,0,12,0,2,1,
+    6,2,6,0,1,0,3,0,0,0,3,0,0,0,2,0,2,0,2,0,46,0,17,0,15,0,11,1,9,0,2,2,
+    10,0,4,1,1,2,5,0,28,1,29,2,23,0,3,0,1,0,2,1,6,2,14,0,10,0,56,0,8,2,1,1,
+    43,0,17,0,9,0,8,0,14,0,15,0,4,0,8,2,0,0,23,0,2,0,0,0,9,10,47,2,0,0,2,2,
+    0,0,2,0,0,0,2,0,0,2,0,1,2,0,0,2,2,1,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+    0,0,0,0,2,1,0,0,1,2,2,0,0,1,0,0,15,0,17,0,2,0,0,1,0,0,0,0,0,0,2,0,
+    0,1,2,0,0,2,2,1,1,0,0,0,2,0,0,0,0,1,0,0,0,0,2,1,2,0,1,0,2,0,0,0,
+    2,0,0,1,0,2,2,1,0,0,2,0,1,1,2,2,0,1,2,0,0,0,2,0,0,1,2,0,0,0,0,0,
+    2,0,1,0,2,0,0,1,0,1,0,0,0,0,2,0,2,0,1,1,2,2,2,0,0,1,11,2,21,2,4,1,
+    2,0,2,0,0,0,2,2,0,1,2,0,2,0,2,1,2,2,0,1,0,0,4,2,0,1,0,0,2,0,2,0,
+    2,0,0,1,0,2,2,1,0,0,2,2,0,1,2,0,2,0,0,0,0,1,2,0,2,0,0,0,0,0,2,0,
+    23,2,4,0,0,1,4,0,0,0,1,0,0,1,2,2,2,1,2,2,2,1,2,0,1,2,2,1,0,0,2,2,
+    4,0,2,1,2,2,2,0,0,0,0,0,2,0,2,0,0,0,2,0,7,0,3,0,3,0,3,0,4,0,2,0,
+    4,0,2,0,2,0,4,0,0,0,2,0,0,0,2,0,2,0,0,0,2,0,2,1,2,2,2,0,2,0,0,0,
+    5,2,2,1,0,0,0,0,1,0,0,2,4,1,2,0,2,0,0,0,0,0,2,0,0,0,0,0,1,0,1,1,
+    0,2,0,0,1,0,2,0,0,0,6,0,2,0,4,0,0,0,2,0,0,0,3,0,1,0,2,1,2,2,1,0,
+    0,0,0,0,0,0,4,2,6,1,4,2,6,0,2,1,6,2,0,0,0,0,3,0,3,1,7,0,6,2,4,0,
+    1,1,0,0,6,0,8,0,1,2,0,0,2,0,0,1,1,0,2,2,40,0,2,0,0,1,17,2,17,0,9,0,
+    7,1,4,2,2,0,8,0,38,0,3,0,7,0,27,1,15,0,11,2,5,0,4,0,2,0,22,0,22,0,14,0,
+    8,0,19,1,45,2,1,1,0,2,22,0,0,2,4,0,8,0,0,1,25,0,5,0,10,12,49,0,4,0,0,0,
+    2,0,0,2,2,0,0,2,2,1,0,2,0,0,2,1,0,2,0,0,0,0,0,1,0,2,0,0,2,1,0,0,
+    0,0,2,0,1,0,2,0,0,1,0,0,1,0,23,0,5,0,2,0,1,1,2,2,0,1,0,2,2,1,1,1,
+    2,2,0,0,2,1,1,0,2,0,0,1,0,0,2,0,1,0,2,0,0,0,0,0,2,0,2,1,1,0,2,0,
+    0,0,0,0,2,1,1,0,2,0,0,0,4,0,1,1,2,2,0,1,2,0,0,1,0,2,2,1,2,0,0,0,
+    0,0,2,0,1,1,0,0,2,0,0,0,0,0,0,1,0,0,4,0,0,0,0,1,13,4,19,0,2,1,2,2,
+    2,0,2,1,2,0,0,0,2,0,0,0,2,1,2,2,2,0,0,0,4,1,1,0,2,0,2,0,0,0,2,1,
+    0,2,2,0,0,1,0,2,2,0,2,1,2,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,2,0,5,1,
+    19,0,2,0,4,2,2,1,2,0,2,0,2,0,1,0,1,0,2,1,2,0,2,2,4,1,0,2,0,0,0,1,
+    2,2,2,0,2,1,2,2,2,0,2,0,2,0,0,0,0,0,2,0,17,0,4,0,2,0,4,0,3,0,1,0,
+    0,0,2,0,2,1,2,2,4,0,2,1,2,2,2,1,0,2,0,1,2,2,0,0,2,1,4,2,0,0,2,2,
+    0,1,0,0,0,0,0,2,2,0,1,1,1,0,0,0,2,0,2,0,2,0,0,0,2,0,0,0,2,0,1,2,
+    0,1,1,0,7,0,4,0,2,1,1,2,4,0,2,1,4,2,2,0,0,0,4,1,0,2,1,0,1,0,0,2,
+    2,1,8,2,3,1,5,0,1,0,4,0,2,0,6,2,4,1,6,0,4,2,2,0,0,0,1,0,5,1,16,0,
+    7,2,1,0,3,0,1,0,4,1,6,0,0,0,0,2,2,0,0,0,32,0,2,0,6,0,4,0,2,0,15,1,
+    17,2,13,0,3,1,1,0,30,2,10,0,0,1,3,2,15,0,17,0,5,0,7,0,1,0,18,1,1,0,2,2,
+    12,1,6,2,6,1,39,2,5,0,4,0,24,0,2,0,0,0,10,2,1,1,19,0,11,10,47,0,0,4,2,1,
+    2,2,0,0,2,0,0,0,0,0,4,0,1,0,2,0,0,0,0,0,0,0,2,2,0,1,2,0,1,0,0,0,
+    2,1,1,0,2,2,0,1,0,2,13,1,19,0,2,0,0,0,0,0,2,0,0,1,2,2,0,1,1,0,2,0,
+    0,0,0,1,0,0,4,0,0,0,0,0,0,0,0,1,2,0,0,0,0,1,0,2,0,1,0,2,4,1,0,0,
+    0,1,0,0,0,0,2,0,0,0,2,1,1,0,2,2,0,1,2,0,0,0,0,0,2,1,0,2,2,1,2,0,
+    1,0,0,1,2,2,2,1,1,0,2,0,1,1,2,0,0,0,0,0,2,0,15,2,17,0,2,0,2,0,0,0,
+    2,1,2,2,2,1,2,0,0,0,2,0,0,0,2,0,2,1,2,2,0,0,2,1,2,2,0,1,2,0,0,0,
+    0,1,2,2,2,0,2,1,0,0,1,0,2,0,2,0,2,0,2,0,0,0,2,0,0,0,0,1,2,0,27,2,
+    2,1,2,0,0,0,2,0,4,0,4,0,0,0,2,1,2,0,1,2,0,0,2,0,0,0,2,0,4,0,2,0,
+    1,1,2,2,0,0,2,1,4,2,0,0,2,0,2,0,2,0,0,0,15,0,0,0,4,0,0,0,2,0,2,0,
+    0,1,3,0,0,2,2,0,2,1,2,2,4,1,0,2,4,1,2,2,0,1,2,2,1,0,0,0,4,0,2,0,
+    7,0,6,0,4,2,2,1,0,0,0,0,2,0,1,0,0,0,1,0,0,0,4,0,0,0,0,0,0,0,2,1,
+    0,2,0,0,2,0,5,1,3,2,0,0,2,1,2,2,0,1,4,0,4,2,2,0,2,0,0,2,2,1,1,0,
+    1,0,6,0,4,0,2,0,1,0,7,0,0,0,2,0,2,0,2,2,2,1,4,0,4,0,2,2,4,0,24,0,
+    9,1,7,0,5,0,1,0,3,0,3,0,4,0,4,0,2,0,1,0,14,0,26,0,3,2,0,0,4,1,4,2,
+    0,0,9,1,15,2,9,0,36,0,1,0,3,0,1,0,0,0,7,0,17,0,13,0,2,1,20,2,2,0,4,1,
+    7,2,6,0,12,2,4,0,27,1,25,2,3,0,22,0,4,1,0,0,8,0,15,0,13,10,47,2,2,1,2,4,
+    0,1,2,0,0,2,2,0,2,0,1,0,2,0,0,0,0,0,2,0,0,0,0,0,2,0,1,0,2,0,0,0,
+    0,0,0,0,0,1,1,2,21,1,7,0,2,0,0,0,0,1,0,0,0,0,0,0,2,0,0,1,2,0,0,2,
+    0,1,0,2,2,1,1,0,2,1,0,2,2,1,0,2,0,1,0,0,0,0,2,1,0,0,0,0,0,0,2,0,
+    0,0,2,0,0,1,0,0,0,0,0,0,2,0,0,1,0,0,2,0,0,1,0,2,2,0,0,1,0,0,2,0,
+    2,0,2,0,0,1,1,0,2,0,0,1,2,0,1,0,2,1,1,4,21,0,11,2,2,1,2,0,2,0,0,1,
+    2,2,0,1,4,2,2,1,2,2,2,1,0,0,0,0,2,0,2,1,2,0,2,2,0,1,0,0,2,0,0,0,
+    4,0,1,1,0,0,2,0,2,0,2,0,0,0,0,0,0,0,2,0,2,0,0,0,2,1,0,2,17,1,9,0,
+    4,2,0,1,4,1,2,2,0,0,2,0,4,0,2,0,2,2,2,1,2,0,1,0,0,0,0,1,2,2,2,0,
+    2,2,0,1,2,0,0,2,0,1,4,0,0,0,2,0,2,0,3,0,13,0,2,0,2,0,4,0,2,0,2,1,
+    0,2,4,0,1,1,1,0,1,2,2,1,0,2,4,1,0,2,2,0,4,0,0,0,4,0,0,0,1,0,2,0,
+    7,0,2,0,4,0,2,0,4,0,4,0,0,0,0,0,0,0,2,0,0,0,1,0,0,0,2,0,2,1,1,2,
+    0,0,2,0,0,1,0,2,0,1,1,0,3,2,0,1,2,2,0,0,0,0,2,0,6,0,2,0,2,0,2,0,
+    0,2,0,1,4,2,0,1,2,2,4,1,3,0,5,0,1,0,0,0,4,0,2,0,2,2,2,1,2,0,26,0,
+    4,0,3,0,7,0,7,0,3,0,0,0,3,2,3,0,2,0,8,0,2,0,26,0,6,1,4,0,1,2,1,0,
+    6,0,2,0,0,0,11,0,5,0,16,0,8,2,6,1,1,0,7,0,1,0,17,1,27,2,8,0,6,1,0,2,
+    20,0,4,0,11,0,2,0,10,2,11,1,25,0,15,0,16,0,0,0,2,0,4,0,3,10,45,0,2,2,0,0,
+    2,2,0,0,2,0,0,1,0,2,2,0,0,0,0,0,2,0,0,0,0,0,0,1,0,2,2,1,0,2,0,1,
+    0,2,2,1,11,0,21,0,0,0,0,0,2,0,0,0,2,0,0,0,0,1,2,0,1,0,2,0,0,0,0,1,
+    0,0,2,0,0,0,2,0,1,0,2,1,0,0,0,0,0,0,0,0,2,0,0,0,0,0,2,1,0,0,0,1,
+    2,2,0,1,2,2,1,1,0,0,2,0,0,0,2,1,0,0,0,0,0,0,2,1,0,0,2,0,0,0,0,0,
+    2,1,0,0,2,0,2,0,0,0,0,0,0,0,0,0,0,2,23,1,9,0,0,0,2,0,0,1,2,2,2,0,
+    2,1,0,2,2,1,0,0,4,0,0,0,4,0,0,1,0,2,0,0,2,0,2,1,2,0,2,0,2,0,0,0,
+    0,0,2,0,2,0,1,0,2,0,0,0,2,1,0,0,0,0,0,0,4,0,0,1,2,2,2,1,27,2,2,1,
+    1,0,4,0,0,0,2,0,2,0,0,0,2,0,4,2,2,1,2,0,2,2,2,1,2,0,0,2,0,1,0,0,
+    2,0,0,0,2,0,0,0,2,0,0,0,2,0,0,0,2,0,17,0,6,0,2,0,1,0,0,0,4,1,0,2,
+    4,0,2,1,2,2,0,1,0,0,3,0,2,0,1,2,4,0,2,1,0,2,4,0,0,0,2,0,2,0,9,1,
+    0,2,0,0,2,1,4,2,2,0,2,0,4,0,4,0,0,0,2,0,0,0,0,0,0,0,0,1,0,2,2,0,
+    2,0,0,1,0,2,2,1,0,2,1,0,0,1,3,2,1,0,0,0,0,0,2,0,1,0,2,0,4,0,4,0,
+    2,0,4,0,10,0,3,0,5,0,0,0,4,2,4,1,1,0,1,0,5,0,0,0,4,0,2,0,2,0,16,0,
+    4,0,6,2,4,0,1,0,7,0,7,0,1,1,0,0,5,0,3,0,0,0,32,0,2,2,0,0,6,0,6,0,
+    3,1,3,2,4,0,4,0,3,0,40,0,25,1,15,2,12,0,10,0,5,1,5,2,1,0,26,1,43,2,2,0,
+    9,0,8,0,18,0,1,0,15,0,1,0,7,1,15,0,9,2,14,1,13,2,8,0,0,10,45,2,2,0,0,0,
+    2,0,2,0,0,0,0,2,2,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,1,0,2,0,1,2,2,
+    1,1,19,2,11,0,0,1,2,0,0,0,0,0,2,1,0,0,0,0,0,2,0,0,2,1,0,0,0,0,2,0,
+    0,0,0,1,0,0,0,0,2,0,0,0,2,0,0,1,0,0,2,0,1,1,0,0,0,0,2,0,0,0,2,0,
+    0,1,0,2,2,1,2,2,0,1,1,0,2,1,0,2,2,0,0,1,2,0,1,0,2,0,0,1,0,0,2,0,
+    0,0,0,0,2,0,0,1,0,0,2,0,0,0,2,2,27,0,5,0,0,0,0,1,0,0,2,0,0,0,2,0,
+    0,0,4,1,0,0,0,2,2,1,2,0,2,0,2,0,2,1,0,0,0,0,2,0,2,0,2,0,0,0,2,0,
+    2,0,0,0,0,0,4,0,1,1,2,0,0,2,2,1,2,0,0,0,1,1,2,2,2,1,27,2,2,1,2,2,
+    4,1,1,0,0,0,2,0,4,0,0,0,2,0,0,0,2,0,2,2,4,1,2,2,2,0,2,1,0,2,0,0,
+    0,1,2,0,1,0,4,0,0,0,0,0,0,0,2,0,0,0,19,0,2,0,4,0,6,0,2,1,0,2,0,0,
+    2,1,2,2,2,0,2,0,2,0,2,0,1,0,1,0,1,1,0,2,2,1,0,0,4,2,2,1,0,0,11,2,
+    4,1,0,0,2,2,0,1,2,0,4,0,2,2,4,0,4,0,2,0,2,0,0,1,0,0,2,2,0,0,0,0,
+    0,1,0,2,6,0,2,0,0,0,2,0,1,2,1,1,1,0,3,0,0,1,1,2,0,0,2,0,1,0,0,0,
+    4,0,2,0,12,0,6,0,4,0,3,0,5,0,3,0,4,0,2,0,4,0,3,0,7,1,0,2,4,0,22,0,
+    4,2,0,1,0,0,1,0,4,0,0,0,9,0,5,0,0,0,0,0,3,0,8,0,4,0,10,0,0,0,1,0,
+    8,2,8,0,3,0,1,0,2,0,58,1,9,2,19,0,25,0,1,1,12,2,10,0,3,0,8,0,30,0,53,0,
+    9,0,8,0,3,0,14,0,6,0,11,1,19,2,13,0,13,1,7,2,18,0,0,0,4,10,43,0,0,0,2,0,
+    0,2,2,0,0,0,2,0,0,0,0,0,0,0,2,2,0,1,0,0,0,0,2,2,0,0,0,1,0,2,5,1,
+    21,0,3,0,2,0,2,0,1,0,2,0,0,1,0,2,0,0,2,1,0,0,0,0,2,0,0,0,2,1,1,0,
+    0,0,0,0,2,0,0,0,2,1,0,0,0,0,0,0,2,0,1,0,2,0,0,0,2,1,1,0,2,0,0,0,
+    2,0,0,1,0,0,0,0,2,0,0,1,0,2,0,1,0,0,2,0,0,0,2,1,0,0,0,2,2,1,1,0,
+    2,0,2,1,0,0,2,0,0,0,0,0,2,2,27,0,5,0,2,0,2,1,1,0,2,0,0,0,0,0,2,0,
+    2,0,0,0,0,0,4,1,1,0,2,0,2,0,2,0,0,0,4,0,0,0,0,0,0,0,2,1,2,0,2,0,
+    0,0,2,0,2,1,0,0,2,2,0,1,2,0,0,0,0,0,2,1,2,2,0,1,15,2,13,1,4,2,2,1,
+    2,0,4,2,2,0,0,1,1,2,4,1,0,2,2,1,0,2,2,1,0,2,2,1,2,0,4,2,0,1,2,0,
+    2,0,0,0,2,2,1,1,2,0,2,0,0,0,0,0,13,0,9,0,4,0,2,1,2,0,4,2,4,0,4,1,
+    0,2,1,0,4,1,2,2,4,0,0,0,2,0,2,1,1,2,1,1,1,2,0,1,0,0,2,0,4,2,15,1,
+    2,2,6,0,2,1,2,2,2,0,0,0,2,1,2,0,2,0,2,0,4,0,4,2,2,0,0,0,1,0,2,1,
+    0,2,2,0,1,0,2,2,4,1,4,0,2,0,0,2,2,1,1,0,3,2,3,1,1,0,3,1,0,2,2,0,
+    0,1,0,2,0,0,6,0,6,0,8,0,4,0,0,0,7,0,5,1,0,2,6,0,4,2,1,1,5,0,1,0,
+    16,0,4,0,6,0,6,0,0,0,3,0,0,0,3,0,5,0,7,0,0,0,26,0,9,0,11,0,2,0,12,0,
+    0,0,1,0,10,0,4,0,0,0,8,2,36,0,6,1,11,0,21,2,19,0,6,0,10,0,8,2,62,1,9,0,
+    41,0,41,0,10,0,5,0,18,0,12,0,0,0,21,1,37,0,17,0,12,0,16,2,5,10,43,0,0,2,2,0,
+    2,1,0,2,0,0,2,2,0,0,2,0,0,0,0,1,0,2,2,0,0,0,0,1,0,0,0,2,11,1,17,0,
+    0,0,2,0,0,0,1,0,2,1,0,0,0,2,2,1,0,0,0,0,2,0,0,1,0,0,0,0,0,2,2,1,
+    0,0,2,0,1,0,2,0,0,0,0,0,0,1,2,0,0,0,0,1,2,2,0,1,1,2,2,1,0,0,0,0,
+    0,0,2,0,0,0,2,1,0,0,2,0,0,1,0,0,2,0,1,0,2,0,2,0,1,1,2,0,0,0,2,0,
+    0,1,0,2,0,1,0,0,4,0,0,2,31,0,1,0,2,1,0,0,0,2,4,0,0,0,0,0,0,1,0,1,
+    0,0,2,0,2,0,0,0,4,0,0,0,1,0,2,0,4,0,0,1,2,0,2,0,0,0,0,2,2,1,0,0,
+    2,0,2,1,0,2,2,0,0,1,2,2,0,1,2,2,2,1,0,0,0,0,2,0,27,1,0,2,0,1,4,0,
+    0,2,2,1,4,2,2,0,2,0,0,0,0,0,2,0,2,1,2,2,0,1,2,2,2,0,0,1,4,0,0,2,
+    2,0,0,0,2,1,0,0,0,0,0,0,2,0,0,0,19,1,2,0,1,0,0,2,2,0,2,1,4,0,2,2,
+    4,0,4,0,0,0,0,0,0,0,4,0,2,0,4,0,2,0,2,0,1,0,0,0,1,1,1,2,1,1,15,2,
+    4,1,2,0,4,2,4,1,2,0,2,0,2,2,0,0,0,0,4,0,0,0,2,0,6,0,2,1,4,0,1,2,
+    0,0,0,0,4,0,0,0,1,2,0,1,2,0,6,0,0,2,2,1,2,0,0,0,3,0,1,0,3,0,1,0,
+    1,0,0,0,0,1,1,2,2,1,2,2,6,1,6,2,6,0,4,0,3,0,7,0,1,1,4,2,2,0,0,0,
+    4,1,0,2,4,0,6,0,2,0,6,0,2,0,2,0,3,0,5,0,7,0,6,0,2,0,6,0,5,0,13,0,
+    4,0,10,0,1,0,2,0,8,0,6,0,44,0,5,2,2,0,1,1,13,0,17,0,9,2,10,0,70,0,8,0,
+    9,0,31,0,45,0,3,1,1,0,12,2,12,1,2,0,7,0,33,0,27,0,8,0,4,8,43,2,2,0,2,0,
+    0,2,0,0,2,0,0,0,0,0,2,0,0,0,0,2,2,1,0,0,0,0,0,2,2,0,21,1,9,0,0,2,
+    2,1,1,0,2,0,2,0,0,0,0,0,0,1,0,2,2,1,0,0,0,0,0,0,0,0,2,0,0,1,0,2,
+    2,1,1,0,2,0,0,1,0,2,2,1,0,2,0,1,0,0,2,0,0,1,0,0,2,0,0,0,0,0,0,1,
+    0,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,1,1,2,0,0,1,0,2,2,0,0,1,0,0,0,1,
+    2,2,0,1,2,0,0,2,1,2,29,0,2,1,0,0,2,0,0,0,2,0,0,1,0,0,0,0,2,0,0,0,
+    2,0,0,0,0,0,2,1,0,0,2,0,2,0,0,0,0,1,2,2,2,0,0,1,4,0,0,0,1,0,4,0,
+    0,1,2,2,2,0,0,1,2,2,2,1,0,0,0,0,2,0,0,0,2,0,29,0,2,0,2,1,2,2,1,0,
+    4,0,2,0,0,0,2,0,4,0,0,0,4,1,1,2,2,0,0,1,2,2,0,1,0,0,2,2,2,0,4,1,
+    0,0,4,0,0,0,2,0,0,0,0,0,0,1,1,0,17,2,2,0,2,0,0,1,0,0,0,2,0,0,4,0,
+    2,0,4,0,2,0,4,0,0,0,0,0,2,0,2,0,2,0,2,0,4,0,0,0,0,0,0,0,5,0,7,1,
+    3,2,0,0,2,1,0,0,2,2,4,0,2,1,2,0,2,0,0,0,2,0,2,0,0,0,2,2,4,0,4,0,
+    2,0,0,0,0,0,0,0,2,1,0,2,0,0,0,0,2,1,2,2,2,0,2,0,2,0,2,0,0,0,5,1,
+    3,2,1,1,2,2,2,1,1,2,1,1,0,2,0,1,4,2,6,0,4,0,4,0,1,0,5,1,1,0,2,2,
+    16,0,1,1,7,0,3,0,10,0,4,2,4,0,2,0,2,0,2,0,0,1,5,0,10,2,13,0,0,0,4,0,
+    9,0,9,0,4,0,10,0,1,0,6,0,44,0,8,0,1,0,7,2,8,0,11,0,9,1,21,0,16,2,50,0,
+    12,0,4,1,25,0,45,2,19,1,0,0,8,0,12,2,10,0,1,0,29,1,27,0,18,8,41,0,2,2,1,0,
+    2,2,2,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,0,2,2,1,3,0,25,0,1,0,0,0,2,0,
+    0,0,2,0,1,1,0,0,2,2,0,1,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,1,0,2,2,1,
+    0,0,2,0,1,0,0,0,0,1,2,0,0,0,2,0,0,0,2,0,1,0,2,0,1,1,2,0,0,0,0,0,
+    2,0,0,1,0,0,0,0,2,1,2,0,0,0,0,0,0,0,0,0,0,0,2,1,0,0,0,0,2,0,0,0,
+    0,1,0,0,0,2,5,2,27,1,2,0,4,0,0,0,2,0,2,0,0,1,2,2,0,0,2,1,0,0,2,0,
+    0,0,0,0,0,1,0,2,2,1,0,0,2,0,2,1,0,2,2,0,0,1,2,2,0,1,2,0,2,0,1,0,
+    2,0,2,0,0,1,2,2,2,1,0,0,2,2,2,1,1,0,2,0,15,1,11,2,0,0,2,0,2,0,4,0,
+    0,0,0,0,4,0,2,0,0,0,4,0,0,0,2,0,0,0,2,0,0,1,2,2,2,0,0,1,0,0,0,0,
+    2,0,2,0,2,0,2,0,2,0,2,0,0,0,19,0,0,0,0,0,2,0,4,2,2,1,0,0,0,0,0,0,
+    0,0,2,0,4,0,2,0,4,0,2,0,0,0,1,0,2,0,2,0,2,0,4,0,0,0,2,0,7,0,5,0,
+    0,1,0,0,1,2,2,0,2,1,0,0,0,0,2,0,2,0,2,0,2,0,0,0,0,0,2,2,0,0,4,0,
+    2,0,2,0,2,0,2,1,0,2,0,0,2,0,0,1,0,2,2,0,2,1,0,2,4,0,0,0,0,0,4,0,
+    0,1,3,2,4,1,9,2,1,1,4,2,0,1,0,2,0,1,1,2,2,1,4,0,4,2,2,0,0,0,3,1,
+    8,0,2,0,2,0,1,2,9,0,1,1,8,0,6,0,6,0,2,0,0,2,2,0,36,1,11,0,21,0,9,2,
+    4,0,2,0,11,0,13,0,8,0,4,0,18,0,18,0,12,0,10,2,5,0,5,0,1,1,7,0,15,0,24,0,
+    20,0,12,2,8,1,9,1,45,2,29,1,1,2,12,0,16,2,6,1,11,2,17,0,2,8,41,2,0,1,4,4,
+    0,1,0,0,2,2,1,1,2,2,0,0,0,0,2,0,0,0,2,0,11,0,21,0,2,0,0,0,2,0,0,1,
+    0,2,2,1,0,2,2,0,0,1,0,2,0,0,0,1,0,0,0,0,2,1,0,2,0,1,0,2,2,1,0,0,
+    2,0,1,0,2,1,0,0,2,0,1,2,2,1,0,0,2,0,1,1,2,0,0,0,2,0,1,0,0,1,2,2,
+    0,1,0,0,2,0,0,0,0,0,0,0,2,0,0,1,2,0,0,0,0,0,0,1,0,0,2,0,0,0,0,0,
+    0,0,2,2,11,0,21,1,2,2,0,1,0,2,4,1,2,0,0,0,2,0,0,0,2,1,0,0,2,0,0,0,
+    0,0,2,1,2,2,0,1,1,2,2,1,0,0,2,0,2,0,0,1,2,2,0,1,2,2,2,1,2,0,0,0,
+    0,0,0,1,2,2,0,1,0,0,2,2,2,1,0,0,2,0,3,0,25,0,2,0,4,0,0,2,2,1,0,2,
+    2,1,2,2,0,1,2,0,2,0,2,0,2,0,4,1,0,2,0,0,2,0,0,1,0,0,2,0,0,0,2,0,
+    0,0,0,0,2,0,2,0,2,0,2,0,2,0,19,0,2,0,2,0,0,0,2,0,0,2,4,0,0,1,2,0,
+    0,0,1,1,0,2,2,0,4,0,2,0,2,0,4,0,0,0,0,0,0,1,0,2,4,0,2,0,7,0,6,0,
+    0,0,1,0,5,1,0,0,0,0,0,0,2,0,2,0,0,0,0,0,2,2,0,0,2,0,0,1,2,0,0,0,
+    0,0,4,0,5,0,6,2,6,0,2,0,0,1,0,2,2,0,0,1,1,2,2,0,2,1,0,2,4,1,0,2,
+    2,0,2,0,12,0,1,0,5,0,7,1,3,2,0,1,0,2,0,1,2,0,0,2,2,1,4,0,2,0,2,0,
+    14,0,7,2,1,0,0,1,2,0,1,0,9,0,1,2,6,0,8,0,4,0,4,0,32,0,2,0,0,0,11,1,
+    21,0,9,0,8,0,4,0,15,0,9,2,18,0,0,0,8,0,14,0,12,0,8,0,7,2,1,1,9,0,30,0,
+    27,0,12,1,14,2,8,0,0,1,35,2,27,0,1,0,12,0,10,2,12,1,13,0,15,8,41,0,2,2,0,1,
+    2,2,0,2,0,1,2,2,2,1,0,2,0,0,0,0,2,0,17,0,13,0,2,0,1,0,2,0,0,0,0,0,
+    2,0,0,0,2,1,1,0,2,0,0,0,2,0,0,0,0,0,2,0,0,0,0,1,0,2,0,1,0,0,0,0,
+    0,0,4,0,0,0,0,0,1,0,2,1,0,0,0,0,0,0,4,0,0,0,0,1,0,0,0,0,0,0,0,1,
+    0,0,0,2,2,1,0,1,2,2,0,1,0,0,2,0,0,0,0,0,0,1,0,2,2,1,0,0,0,0,2,1,
+    0,2,17,2,17,0,2,0,0,1,4,2,0,1,2,0,0,0,4,0,0,0,0,1,2,2,2,0,0,1,0,0,
+    2,0,0,0,0,1,2,2,2,1,0,0,0,0,0,0,2,0,0,0,2,1,2,2,0,1,0,0,2,2,4,1,
+    0,0,0,0,0,1,0,2,2,0,0,1,0,0,2,0,2,0,31,2,4,0,2,1,0,2,4,1,0,2,2,1,
+    2,0,2,0,0,0,0,0,2,0,2,0,2,0,0,0,4,0,2,0,2,0,0,0,2,0,0,0,0,0,2,0,
+    2,1,0,0,0,0,0,0,2,0,0,0,11,2,5,0,2,0,4,0,0,1,0,0,4,0,0,0,2,0,0,0,
+    2,0,2,0,0,0,0,0,1,1,4,2,2,0,2,0,2,0,2,0,2,0,0,0,0,0,0,1,9,0,2,2,
+    6,0,2,0,6,0,3,1,3,0,0,0,0,0,1,2,4,0,2,0,0,1,2,0,0,0,0,0,0,0,0,0,
+    4,0,0,0,7,0,0,0,4,0,6,0,2,2,4,1,1,0,0,2,2,1,2,0,1,2,2,1,2,2,2,1,
+    0,2,2,1,8,2,6,1,2,2,3,0,5,1,3,0,3,0,1,0,0,0,1,1,2,2,0,0,2,0,2,2,
+    16,0,6,1,1,0,3,0,3,0,0,0,0,0,3,0,11,0,1,0,10,2,6,0,28,0,6,0,6,0,2,0,
+    3,0,13,0,19,0,5,0,8,0,2,1,3,2,11,0,6,0,1,1,12,0,14,0,10,0,2,2,5,0,30,1,
+    13,0,27,2,8,0,18,0,14,2,6,1,27,0,29,0,13,0,20,0,14,2,2,1,27,8,39,0,0,2,2,0,
+    0,0,2,0,0,2,2,1,1,2,2,1,2,2,0,0,23,0,7,1,0,2,0,1,2,0,2,2,0,1,0,2,
+    0,1,2,0,0,2,2,0,1,0,2,1,0,0,0,0,0,0,0,0,0,0,2,0,0,1,2,0,0,0,0,0,
+    2,0,1,1,2,2,0,1,2,0,1,0,2,0,0,0,0,1,0,2,0,1,2,2,0,1,2,0,0,0,0,0,
+    0,0,0,1,0,0,2,0,1,0,2,0,2,1,1,2,2,1,2,1,0,2,0,1,0,2,0,1,0,0,2,4,
+    25,1,9,1,2,2,2,0,0,0,0,1,2,0,0,0,4,0,0,0,4,0,2,0,0,1,0,0,2,0,2,0,
+    0,0,0,0,2,0,0,1,0,0,2,2,0,1,2,0,1,1,2,2,0,0,2,1,0,0,2,2,0,1,2,0,
+    2,0,0,0,2,0,2,1,1,0,2,0,2,0,1,2,25,0,1,1,2,2,0,0,4,0,2,0,2,1,0,2,
+    0,0,2,1,4,0,2,2,0,1,0,0,0,0,2,0,2,1,4,0,0,0,4,0,0,0,0,0,2,0,0,0,
+    0,2,2,0,0,1,2,0,1,0,2,0,23,0,4,0,4,0,0,0,4,2,2,0,0,1,2,0,2,2,2,1,
+    0,0,2,2,2,1,0,0,0,0,1,0,2,1,2,2,2,1,2,2,2,0,2,1,2,0,0,2,15,0,4,1,
+    2,0,4,0,2,0,4,2,4,0,1,0,3,0,2,1,1,0,1,2,2,0,2,0,2,0,2,0,0,0,0,0,
+    0,0,5,0,1,0,4,1,0,0,0,0,6,0,4,2,4,1,2,0,0,2,1,1,2,0,2,2,1,1,0,2,
+    4,1,0,2,10,1,0,2,0,1,4,0,4,0,3,2,3,1,1,0,5,0,1,0,0,0,1,0,1,0,2,1,
+    6,2,4,0,4,0,4,0,0,0,3,2,2,0,2,1,0,0,3,2,13,1,1,0,12,0,14,0,8,0,6,0,
+    8,0,4,0,3,0,15,2,17,0,1,0,4,1,18,0,25,0,2,0,0,2,0,0,10,0,10,1,10,0,30,2,
+    7,0,5,1,19,0,3,2,16,0,12,0,6,0,21,0,17,0,19,0,20,0,10,0,13,8,39,0,2,0,0,2,
+    2,0,0,0,2,0,1,2,2,1,0,2,1,1,25,0,1,2,0,0,2,0,0,0,2,0,1,1,2,2,2,1,
+    0,2,0,0,2,1,0,0,0,0,0,0,0,0,2,0,0,0,0,1,2,0,1,0,2,0,0,0,0,0,2,0,
+    1,0,2,0,0,1,0,2,0,1,2,0,0,0,0,0,2,0,0,1,0,0,0,0,2,0,0,0,0,1,0,0,
+    0,0,2,0,1,0,0,0,2,1,2,0,0,0,2,0,0,0,0,0,2,1,0,2,1,1,2,0,1,2,29,0,
+    1,0,2,0,0,1,0,0,2,0,0,0,2,0,2,0,1,0,2,1,2,0,2,0,2,0,2,0,0,2,0,0,
+    2,1,0,0,0,0,2,0,0,0,2,1,2,0,0,0,0,0,0,1,2,2,0,0,2,0,0,1,0,0,0,0,
+    2,0,2,0,2,0,0,0,2,0,0,0,0,0,13,0,11,0,0,0,2,0,4,0,0,1,0,2,2,0,4,1,
+    0,0,2,0,1,2,2,1,2,0,2,0,2,0,0,0,0,0,0,0,4,0,2,0,2,0,2,0,0,0,0,1,
+    2,0,0,0,2,2,0,0,2,0,11,0,11,0,1,0,2,1,6,0,2,0,2,0,2,0,2,0,0,0,0,0,
+    4,0,0,1,0,2,4,1,2,2,0,1,1,2,0,1,2,2,2,1,2,0,2,2,0,0,2,1,11,0,0,0,
+    0,0,4,0,2,0,4,2,2,0,2,0,4,0,1,0,1,0,2,1,1,0,1,0,0,0,2,0,2,0,2,0,
+    0,0,9,0,0,0,0,0,4,0,2,0,0,0,0,0,6,2,4,0,6,1,2,2,0,1,1,0,0,2,2,1,
+    1,2,0,1,8,0,2,0,2,0,2,0,0,2,4,1,2,0,3,0,3,0,0,2,3,1,1,0,2,0,1,0,
+    4,1,3,2,4,0,4,2,4,0,4,1,3,0,1,2,4,0,0,1,0,0,5,0,1,0,5,0,8,0,8,2,
+    6,0,6,0,4,0,4,1,3,0,15,0,11,0,14,0,4,0,13,0,17,0,8,0,2,0,12,0,4,0,6,0,
+    42,0,15,0,17,0,7,0,5,0,16,2,12,0,6,0,21,0,9,0,21,0,20,0,1,8,39,0,2,0,0,0,
+    0,2,2,0,0,0,2,0,2,2,7,1,25,2,2,0,0,1,2,0,0,0,2,2,0,1,2,2,0,1,0,0,
+    0,0,0,0,0,0,2,0,0,0,2,0,0,0,0,1,0,0,0,2,0,1,2,0,0,0,0,0,2,0,1,0,
+    2,1,0,0,0,0,2,0,0,0,2,0,1,1,2,0,0,0,0,0,2,2,0,1,0,0,0,0,2,0,0,0,
+    0,1,0,0,2,0,0,0,0,0,1,0,2,0,0,1,0,0,2,0,0,0,0,1,4,0,11,2,25,0,2,0,
+    0,0,0,0,4,0,0,0,0,0,2,1,0,0,0,0,4,0,0,0,0,0,2,0,2,0,2,0,0,1,2,0,
+    0,0,2,0,2,0,1,1,2,0,0,0,2,0,0,0,2,0,2,0,1,1,0,0,0,0,2,0,2,0,0,0,
+    2,0,0,0,0,0,2,0,2,0,2,0,5,2,23,1,0,0,4,2,0,1,2,0,2,0,2,1,2,2,0,0,
+    4,0,0,0,2,1,0,0,2,0,0,0,2,0,2,0,0,0,2,0,1,0,2,0,2,0,2,1,4,0,0,2,
+    0,0,2,0,0,0,0,0,2,0,21,1,0,0,2,0,2,2,1,1,2,0,4,0,2,2,0,1,4,0,2,0,
+    0,0,0,0,2,0,0,0,0,0,4,0,2,1,0,2,1,1,0,0,0,2,2,1,4,0,17,0,6,0,2,0,
+    2,2,1,0,4,0,2,1,2,0,4,2,2,0,2,0,2,0,1,1,1,0,2,0,0,0,1,0,0,0,2,0,
+    0,0,5,0,2,0,0,2,1,1,2,0,2,0,2,0,0,0,0,0,2,0,4,0,4,2,4,1,2,0,1,0,
+    0,0,2,0,2,0,0,0,6,0,0,0,2,1,0,2,0,0,2,0,4,0,3,1,3,2,0,0,1,0,3,0,
+    6,2,4,1,1,0,1,0,1,0,4,0,4,0,0,0,1,0,1,0,4,0,4,0,1,0,10,0,13,2,2,1,
+    6,0,6,2,6,0,2,0,2,0,0,0,5,0,6,0,5,0,0,0,7,3,23,0,5,0,2,2,12,0,10,0,
+    28,0,6,0,9,0,21,0,1,0,5,2,14,1,12,0,2,0,13,0,7,0,9,2,20,6,37,2,0,0,2,2,
+    0,1,2,0,0,2,0,0,11,0,19,0,2,0,0,0,2,2,0,0,2,0,0,1,0,2,2,1,0,2,0,0,
+    2,1,0,0,2,0,1,0,2,0,0,0,0,1,0,2,2,0,0,1,0,2,2,1,0,0,0,0,0,0,2,1,
+    0,2,0,0,0,0,2,1,0,0,1,0,2,0,0,0,0,0,0,0,0,1,2,0,0,0,2,1,0,2,0,1,
+    2,2,1,1,0,0,0,1,2,0,0,0,0,0,2,0,0,0,0,1,0,0,2,0,15,4,17,0,0,1,0,0,
+    2,0,2,0,1,0,2,1,2,0,0,2,2,1,0,0,0,0,2,0,0,0,2,0,2,1,0,0,4,0,0,0,
+    2,0,0,0,2,1,2,2,0,0,0,0,0,0,0,1,2,0,0,0,2,0,2,0,0,0,0,1,0,0,2,0,
+    0,0,2,0,0,0,2,0,2,2,0,0,31,1,2,0,2,0,0,0,2,0,2,0,0,0,4,0,0,1,4,0,
+    0,0,2,2,4,0,0,1,0,0,2,0,0,0,2,0,2,0,0,0,2,0,1,1,2,0,2,2,0,0,4,0,
+    2,0,0,0,0,0,2,1,7,0,15,2,2,0,4,1,0,0,0,2,2,1,0,0,2,0,4,0,2,0,0,0,
+    2,0,4,0,1,0,0,0,4,1,0,2,0,0,2,1,2,0,0,2,0,1,1,0,0,0,15,0,2,2,4,0,
+    4,1,4,0,0,2,0,0,0,0,4,1,2,0,4,0,2,0,2,2,2,0,0,0,3,1,2,0,0,0,1,0,
+    0,0,9,0,2,0,2,0,2,2,0,1,1,0,0,0,2,0,4,1,0,2,0,0,2,1,4,2,2,0,4,0,
+    2,1,0,2,0,0,4,1,1,2,2,0,4,0,4,0,0,0,2,0,1,0,2,0,2,1,3,2,3,0,0,0,
+    10,0,5,0,1,0,0,0,4,0,3,0,1,0,2,1,2,0,0,2,3,0,0,0,6,0,20,2,3,1,13,0,
+    5,2,6,1,6,0,4,0,8,0,4,0,0,0,34,0,25,0,19,0,10,2,0,1,17,0,23,0,1,0,8,0,
+    30,0,20,2,10,0,7,1,41,2,0,1,0,2,12,0,14,0,5,0,15,1,19,0,22,8,37,0,2,0,0,0,
+    2,0,1,2,2,1,15,2,15,0,2,0,2,0,0,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,
+    0,0,2,0,0,0,2,0,0,1,1,0,2,2,0,1,0,0,2,0,0,0,1,0,2,0,2,0,1,1,2,2,
+    0,1,0,0,2,0,1,0,2,0,2,1,1,2,0,1,2,0,0,0,2,0,1,0,2,0,0,0,0,1,2,0,
+    0,0,2,0,1,0,0,0,0,0,0,1,0,0,0,0,2,1,0,2,2,0,23,2,11,1,2,0,2,2,0,1,
+    2,0,0,0,2,1,0,2,2,0,0,1,0,2,2,1,0,0,2,0,2,1,1,0,0,2,4,0,0,1,4,0,
+    0,0,2,1,0,2,0,0,2,0,0,1,2,0,2,2,0,1,0,0,2,0,0,1,2,0,0,2,0,1,0,0,
+    0,0,2,0,0,2,2,0,0,1,29,0,2,0,2,0,0,2,2,1,2,0,0,0,4,0,0,0,4,0,1,0,
+    4,0,0,1,2,0,2,2,2,0,0,0,2,1,0,0,2,0,0,0,2,1,2,2,1,0,2,0,2,0,0,0,
+    2,0,2,0,2,1,0,2,21,0,0,1,2,0,1,2,2,1,4,0,2,2,0,1,2,0,0,0,0,0,4,0,
+    2,0,0,0,4,1,2,2,1,0,0,1,2,0,0,2,2,0,2,1,0,0,2,0,0,0,19,2,0,1,2,0,
+    4,2,2,0,4,1,4,0,2,0,1,0,2,0,0,0,4,0,4,0,2,0,0,0,6,2,1,0,1,0,0,0,
+    2,1,11,0,1,0,2,0,4,0,0,0,2,0,2,0,1,1,1,2,2,0,4,1,0,2,1,1,2,0,2,0,
+    2,2,4,1,2,0,1,2,0,1,2,2,0,0,0,1,6,2,4,0,2,0,0,0,0,2,2,1,2,0,1,2,
+    2,1,2,0,1,0,3,1,5,2,1,0,6,0,1,0,1,0,4,0,2,0,3,0,3,2,12,1,12,0,4,0,
+    7,0,15,0,1,0,10,0,4,0,4,0,4,0,36,0,4,0,11,0,23,1,3,2,8,0,7,1,25,0,19,2,
+    3,0,30,0,24,0,18,2,12,1,39,0,13,0,4,0,10,0,10,0,9,2,0,0,19,6,35,0,0,2,0,0,
+    2,2,0,1,19,2,9,1,0,0,2,2,0,0,2,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,
+    2,0,0,0,0,0,0,1,2,2,0,0,0,1,2,2,1,0,0,0,2,1,0,0,0,0,0,0,2,0,0,1,
+    0,2,2,1,1,0,2,0,0,0,0,0,2,1,0,2,0,1,0,0,0,0,2,0,0,0,0,1,2,2,0,0,
+    0,1,0,0,2,1,0,2,0,1,0,2,0,1,0,0,2,0,3,0,25,0,3,0,2,2,0,0,2,1,2,0,
+    1,0,0,0,2,0,2,0,1,1,4,0,0,0,0,0,2,0,0,1,0,2,2,0,2,1,0,0,2,2,0,1,
+    2,0,2,0,0,0,2,0,2,1,2,2,1,1,0,0,2,0,0,0,0,1,2,2,0,0,2,1,2,2,0,0,
+    0,0,0,0,2,1,1,0,23,2,5,0,4,0,2,0,4,1,0,0,0,0,2,0,0,0,2,0,2,0,2,0,
+    0,0,4,0,0,1,2,0,2,0,2,0,0,2,2,1,0,0,2,0,0,2,2,0,2,1,1,0,0,0,2,0,
+    0,0,2,1,2,2,2,0,21,0,4,0,0,0,2,1,1,2,0,1,0,0,4,0,0,0,2,0,2,0,0,0,
+    2,0,2,0,2,0,2,1,2,2,2,0,0,0,0,1,0,0,2,0,0,0,0,2,11,0,3,1,0,0,0,2,
+    0,1,4,0,2,0,2,0,4,2,4,0,0,0,2,0,0,0,0,0,4,0,2,0,2,1,2,0,2,0,0,0,
+    1,2,5,1,2,0,1,0,3,0,2,0,4,0,0,0,0,0,2,0,1,1,1,2,2,1,4,2,2,1,1,2,
+    2,1,2,2,2,0,4,1,2,2,1,1,0,2,2,0,0,1,0,2,4,0,4,2,2,1,0,0,1,0,2,0,
+    4,0,10,0,5,0,0,0,0,1,0,2,7,0,0,0,2,2,1,1,1,0,2,0,0,0,2,0,9,0,8,0,
+    10,0,4,0,11,0,13,0,4,0,8,0,6,0,20,0,8,0,8,1,5,2,15,0,11,0,12,2,4,1,11,1,
+    31,0,29,2,32,0,24,0,16,0,14,0,25,0,17,0,0,2,16,1,10,0,7,0,11,6,35,2,0,0,2,0,
+    0,0,23,2,5,1,0,2,2,0,0,0,0,0,2,0,0,0,2,0,0,0,0,0,2,0,2,0,0,0,0,0,
+    0,0,0,0,0,0,2,0,0,0,2,1,0,2,0,1,2,0,0,0,1,0,2,0,0,0,0,0,2,0,1,0,
+    2,1,0,2,2,1,0,0,0,0,0,0,0,0,2,1,1,2,2,1,0,0,0,1,0,0,0,2,2,1,0,0,
+    0,0,2,0,0,0,0,1,0,0,2,0,0,0,0,1,13,2,21,0,0,2,2,0,0,1,4,0,0,0,0,0,
+    2,0,0,0,0,0,2,1,2,0,1,2,2,1,2,0,0,0,0,0,2,0,2,1,0,2,0,1,2,0,2,0,
+    2,0,0,0,2,0,2,1,0,2,0,1,2,2,2,1,1,0,2,0,0,0,0,0,2,1,0,2,2,0,0,0,
+    2,0,0,0,0,0,17,0,13,1,2,0,0,0,4,0,2,0,4,0,0,0,0,0,2,0,0,0,0,0,4,1,
+    2,0,0,0,2,2,2,0,0,1,2,0,2,0,0,0,2,0,0,0,2,0,0,0,2,2,2,1,2,0,1,0,
+    2,1,0,2,2,0,25,0,6,1,2,2,2,1,2,2,4,1,0,2,0,1,1,0,0,0,2,0,0,0,4,0,
+    0,1,2,2,2,0,0,0,2,1,0,0,4,0,2,0,0,2,0,0,0,0,2,1,15,2,0,0,2,0,0,1,
+    1,0,0,0,0,0,2,2,4,1,2,0,4,0,2,0,0,0,2,0,0,0,4,0,0,2,4,0,2,1,0,0,
+    2,0,5,0,1,0,2,0,2,1,1,2,1,0,0,1,4,2,0,1,0,2,2,1,3,2,1,1,2,0,4,0,
+    0,0,0,0,5,0,6,2,6,1,4,2,0,1,1,0,0,2,2,1,0,2,0,1,4,2,6,0,2,0,0,1,
+    1,2,16,0,2,0,5,0,3,0,0,0,2,0,1,0,3,0,0,0,2,0,0,2,3,1,22,0,1,0,15,0,
+    11,1,8,0,8,0,2,0,15,0,7,2,8,0,10,0,26,0,4,0,2,0,2,0,11,0,15,0,8,2,8,0,
+    34,0,27,1,55,0,2,0,24,2,16,0,12,0,19,0,7,3,5,2,12,0,1,0,1,6,35,0,0,0,2,2,
+    27,0,1,0,1,2,2,1,2,2,0,0,2,1,0,2,2,1,0,2,0,1,2,2,0,0,0,0,0,1,2,0,
+    0,0,2,0,0,0,0,0,0,0,2,2,0,1,0,0,0,0,0,0,2,0,0,0,0,0,2,1,1,0,2,0,
+    0,0,0,0,0,0,0,0,2,0,0,1,2,0,1,2,2,1,0,0,0,0,0,0,2,0,0,1,0,0,0,0,
+    2,0,0,0,0,0,2,0,0,0,1,1,2,0,21,0,13,0,0,2,2,0,2,0,2,0,1,0,2,1,2,0,
+    2,0,2,1,1,2,0,0,2,0,2,1,0,0,0,0,2,0,2,0,0,1,0,2,2,1,0,2,0,1,0,0,
+    2,0,2,0,2,0,2,0,0,1,0,2,2,1,0,0,2,0,0,0,2,0,0,0,0,2,2,0,1,0,4,1,
+    0,0,0,0,11,0,17,0,2,0,0,0,0,0,0,0,2,1,2,0,4,0,4,0,0,0,0,1,2,0,0,2,
+    0,0,2,1,0,0,2,0,2,0,2,0,2,0,2,2,0,0,2,1,2,0,0,0,0,0,2,0,0,0,2,0,
+    0,0,0,0,3,0,19,1,2,2,2,1,4,2,4,1,0,2,4,1,2,0,2,2,0,1,0,0,0,0,0,0,
+    0,0,2,1,0,0,2,2,2,0,2,0,0,0,0,0,4,1,0,2,2,0,0,0,17,1,2,0,2,0,2,0,
+    2,0,1,0,0,0,0,0,1,0,2,0,4,0,2,0,4,0,2,0,0,0,0,0,2,0,0,0,4,0,4,0,
+    0,0,3,0,0,0,0,0,3,0,4,0,2,1,0,2,3,1,0,2,4,1,0,0,4,0,0,0,3,2,3,1,
+    2,2,2,1,5,2,1,1,2,2,6,1,8,2,4,0,0,0,1,0,0,1,2,2,1,1,0,2,6,0,4,0,
+    2,1,12,2,1,0,4,0,0,2,5,1,3,0,2,0,0,0,1,0,1,0,0,1,2,2,14,0,1,0,6,0,
+    0,0,13,0,3,0,2,0,8,0,5,1,15,0,0,0,24,0,14,2,12,0,0,0,0,0,7,0,15,0,0,0,
+    46,0,0,0,13,0,43,0,5,0,10,0,14,0,8,0,21,0,1,2,0,1,2,0,3,6,35,0,2,2,31,1,
+    0,2,0,0,4,0,0,2,0,1,2,0,0,2,2,1,0,2,2,1,0,2,2,1,0,0,0,0,2,2,0,0,
+    0,0,0,0,2,0,0,0,0,1,0,0,2,0,0,0,0,0,2,0,0,0,0,0,0,1,0,2,2,1,1,0,
+    0,0,2,0,0,0,2,0,1,1,2,2,0,0,2,1,1,0,0,0,2,1,0,2,0,1,0,2,0,1,2,0,
+    0,0,0,0,2,1,0,0,0,0,1,0,27,0,3,2,0,0,0,0,2,0,0,1,0,0,4,0,0,2,0,0,
+    2,1,0,0,2,1,0,0,0,0,2,0,0,0,2,2,0,1,2,0,0,0,2,1,0,2,2,1,0,0,2,0,
+    1,0,2,0,2,1,0,2,2,0,2,1,0,0,2,0,0,2,2,1,0,2,0,1,2,0,0,0,2,0,1,2,
+    2,0,5,1,23,0,2,0,2,0,0,1,2,0,0,0,0,2,0,0,4,1,0,0,4,0,2,0,0,0,0,0,
+    2,1,0,2,2,1,2,0,0,2,2,0,0,1,2,0,2,0,2,2,0,1,2,0,2,0,1,0,2,0,2,0,
+    0,0,2,0,25,1,0,2,0,1,2,2,4,1,2,2,4,1,2,0,2,2,2,1,2,0,0,0,2,1,0,2,
+    0,0,0,0,0,0,2,1,2,0,0,2,2,0,4,0,1,0,0,1,2,0,1,2,11,0,2,0,0,0,2,0,
+    2,0,2,0,0,0,1,1,0,0,0,0,0,0,2,0,2,0,2,0,4,0,0,0,0,1,2,0,0,2,2,0,
+    2,0,5,0,6,0,0,1,4,2,3,1,3,2,2,1,4,2,2,1,3,0,0,2,2,1,2,2,2,1,2,2,
+    1,1,3,0,11,0,6,0,2,0,1,2,0,1,6,2,6,1,4,2,2,0,0,1,1,2,2,1,1,0,0,2,
+    4,0,14,0,6,0,1,0,1,0,4,0,0,0,5,0,1,0,2,0,0,0,1,0,1,1,14,0,4,2,3,0,
+    0,0,4,0,3,0,3,0,1,0,4,0,2,0,9,0,5,0,8,0,12,0,10,0,6,0,2,0,11,0,11,0,
+    14,0,18,2,6,0,1,0,35,1,1,0,2,0,4,1,0,2,19,1,6,2,6,2,0,4,37,2,29,0,2,2,
+    0,1,4,2,0,0,0,0,2,0,0,0,2,0,0,2,2,1,0,2,2,0,1,0,2,0,2,0,1,1,2,0,
+    0,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,1,1,0,0,2,0,0,2,0,1,0,2,2,0,
+    0,1,0,0,0,0,0,1,2,2,0,1,0,0,0,0,2,0,0,0,0,0,0,1,0,2,2,1,0,2,0,1,
+    0,0,0,1,0,2,2,0,9,1,23,0,0,0,0,2,2,0,0,0,1,1,2,2,2,1,0,0,2,0,2,0,
+    0,0,2,0,2,0,0,0,0,0,0,0,2,0,2,1,0,0,0,0,2,0,0,0,2,1,0,0,2,0,1,2,
+    4,1,0,0,1,0,2,1,2,0,2,0,2,2,0,0,2,1,0,2,2,0,0,0,0,0,0,0,2,1,0,0,
+    1,0,29,0,2,0,2,0,2,1,0,2,2,0,2,1,0,0,2,0,1,0,2,0,2,0,4,0,2,0,2,1,
+    1,2,2,1,0,2,0,0,4,1,0,0,2,2,0,0,2,1,0,0,2,2,2,1,0,0,4,0,1,0,0,1,
+    2,2,5,1,17,2,2,1,2,2,0,1,1,0,4,0,2,0,2,0,4,0,2,0,2,0,2,0,2,0,2,1,
+    2,0,1,0,2,2,1,0,0,0,2,1,2,2,0,0,2,0,4,0,0,0,17,1,2,0,0,0,2,0,2,0,
+    0,0,2,0,2,0,4,0,0,0,0,0,1,0,1,0,0,0,2,0,2,0,2,1,4,2,0,0,0,0,1,1,
+    11,0,2,2,4,1,6,2,4,1,4,2,2,1,3,0,1,1,0,2,4,2,0,1,1,2,0,1,2,2,2,1,
+    2,0,2,2,3,1,5,2,1,0,4,1,2,2,3,1,0,2,6,1,4,0,4,2,2,1,1,0,0,2,2,1,
+    0,2,0,1,6,2,8,0,6,1,1,2,3,0,2,0,0,1,5,2,1,0,2,0,4,0,12,0,3,1,8,2,
+    0,0,3,0,2,0,1,0,5,0,0,0,4,0,0,0,18,0,27,0,3,0,14,0,14,2,6,0,6,1,9,0,
+    8,2,9,1,16,0,10,0,5,0,29,0,0,0,4,2,4,1,5,0,23,2,14,1,10,6,67,0,2,0,2,0,
+    2,2,1,1,2,2,2,0,0,0,2,2,2,1,0,0,0,2,0,1,2,0,2,0,0,0,0,0,0,2,0,1,
+    2,2,0,1,0,0,2,0,0,0,0,0,0,0,0,0,0,1,2,2,0,0,0,0,2,1,0,0,0,0,0,0,
+    2,0,1,1,2,2,0,0,0,1,0,2,0,1,2,0,0,0,2,0,1,0,2,0,0,1,0,0,0,0,0,0,
+    2,0,0,0,0,0,17,1,15,2,2,1,0,4,2,1,1,0,2,1,0,2,0,1,2,2,0,1,2,0,0,0,
+    0,0,2,0,2,0,2,0,2,1,1,0,2,0,0,0,2,0,0,0,0,0,2,0,1,0,2,0,0,0,4,1,
+    1,0,2,0,2,0,0,0,0,0,2,0,0,1,2,2,0,0,2,0,0,1,4,2,0,1,0,0,0,2,2,1,
+    33,0,2,0,2,0,0,0,2,0,2,0,0,1,2,2,2,1,0,0,2,0,0,0,0,1,2,2,2,1,2,2,
+    4,1,0,2,0,0,0,1,0,2,0,0,2,1,2,0,2,2,0,1,2,0,0,0,2,0,0,0,4,0,2,0,
+    1,0,25,0,2,1,2,2,2,1,2,0,2,2,1,1,0,0,4,0,2,0,2,0,4,0,2,0,0,0,2,0,
+    0,0,4,0,0,0,2,0,1,0,2,0,1,1,0,0,4,0,0,2,2,0,15,0,2,0,2,0,2,0,0,0,
+    2,0,2,0,2,0,0,0,2,1,0,0,0,0,2,0,0,0,1,0,0,1,0,2,2,0,2,0,2,1,4,2,
+    13,1,1,0,2,2,2,1,4,0,4,0,4,0,4,2,2,0,3,0,1,1,2,2,2,1,0,2,1,1,2,0,
+    0,2,2,0,3,0,4,0,1,1,1,2,1,1,4,0,0,0,3,0,2,2,0,1,6,0,2,2,2,0,0,0,
+    0,0,4,0,1,1,2,2,6,0,6,1,4,2,1,0,1,0,2,1,1,0,1,2,1,0,10,0,12,0,5,0,
+    2,0,6,0,3,0,1,0,0,0,3,0,3,0,2,0,30,0,0,0,21,0,15,0,4,1,14,2,10,2,10,0,
+    1,1,24,0,29,0,6,0,8,0,7,1,27,0,6,2,6,0,1,0,5,0,3,1,3,6,67,0,2,0,2,0,
+    0,0,4,2,0,1,2,0,0,2,0,0,0,0,2,0,2,0,0,0,0,0,0,2,2,1,0,0,2,0,0,2,
+    0,1,2,0,1,0,0,0,2,0,0,0,2,0,0,0,0,0,2,0,0,1,0,0,0,0,0,2,0,1,2,0,
+    1,0,2,0,0,1,0,0,0,2,2,1,0,2,0,1,2,0,1,0,2,0,0,1,0,2,0,0,0,1,2,0,
+    1,1,2,2,25,1,7,0,2,0,0,4,2,1,0,0,0,0,2,0,0,1,0,2,1,1,2,2,2,1,2,0,
+    2,0,0,0,2,0,0,1,0,2,4,0,1,1,0,0,2,0,0,0,2,1,0,0,2,0,0,0,0,0,0,0,
+    2,1,0,0,0,0,2,0,0,0,2,2,2,0,0,0,4,0,0,0,0,0,0,0,2,0,2,0,0,1,29,0,
+    0,0,0,0,0,0,0,1,2,2,2,1,2,2,0,1,2,2,2,1,0,0,2,0,0,0,0,0,0,0,2,0,
+    2,0,4,0,2,0,0,0,0,0,0,1,0,2,2,1,0,0,4,0,1,0,4,0,0,0,2,0,0,0,0,0,
+    7,1,13,2,0,0,2,1,0,0,2,2,2,1,2,0,2,0,1,0,0,1,4,2,0,0,4,0,4,0,0,0,
+    4,0,0,0,2,0,0,0,2,0,0,0,0,0,2,0,1,0,0,1,0,0,17,0,4,0,4,0,2,0,2,0,
+    2,0,0,0,2,0,2,0,0,2,2,0,4,1,0,0,0,0,0,1,0,2,2,0,1,0,0,1,2,2,2,1,
+    11,2,4,1,0,0,0,0,2,2,2,1,4,2,4,0,4,0,4,0,0,0,1,1,5,2,2,1,4,2,1,0,
+    0,0,1,1,5,2,0,1,6,2,2,1,1,0,0,2,2,1,2,2,1,1,0,2,0,0,2,0,2,1,2,2,
+    1,1,1,0,4,2,2,1,1,2,6,0,8,1,6,2,2,0,3,0,1,0,0,0,1,0,1,0,12,0,2,1,
+    4,0,5,0,6,0,2,0,1,0,3,0,3,0,3,0,22,2,10,0,2,0,11,0,17,0,5,0,10,0,12,0,
+    8,0,48,0,17,0,25,0,0,0,6,0,5,0,31,1,6,2,10,0,0,1,21,2,0,4,65,2,2,0,0,0,
+    4,0,1,0,2,2,0,0,4,0,0,1,0,2,0,0,2,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,
+    2,0,1,0,2,0,2,0,1,0,2,0,0,1,2,0,0,2,1,1,2,2,0,1,0,0,0,0,2,0,1,1,
+    2,2,0,0,2,0,0,0,0,1,0,0,0,0,0,0,0,0,2,1,0,0,0,2,0,1,2,0,0,0,0,0,
+    7,0,27,1,2,0,0,2,2,0,2,0,0,0,0,0,2,0,0,0,2,0,0,1,0,2,0,1,0,0,2,0,
+    2,0,2,0,1,1,2,2,2,1,0,0,2,0,0,0,0,0,2,1,0,2,0,0,0,1,2,0,2,0,0,0,
+    0,0,0,0,2,0,0,0,2,0,0,0,2,0,2,0,0,0,2,1,0,2,0,1,0,2,2,1,23,0,5,2,
+    0,1,2,0,2,0,2,0,1,0,2,0,2,1,2,2,0,1,2,0,2,2,0,1,2,0,0,0,0,0,2,0,
+    0,0,2,0,2,1,4,2,0,1,2,2,0,1,0,2,0,1,0,0,2,0,0,0,2,0,0,0,2,1,2,2,
+    27,0,2,1,4,0,0,0,2,2,0,1,2,0,2,0,2,0,0,0,2,0,1,1,2,0,2,2,2,0,2,0,
+    2,0,2,0,2,1,2,0,2,0,2,0,2,2,1,0,0,0,0,0,19,0,0,0,2,0,2,0,4,0,4,0,
+    2,0,2,0,0,1,2,0,2,0,2,0,0,0,0,0,2,0,2,0,0,0,0,0,0,1,2,2,0,1,1,2,
+    9,1,4,2,4,1,2,2,1,0,0,0,4,0,2,1,2,2,4,1,4,2,2,0,2,0,3,0,3,0,2,0,
+    2,1,0,2,3,1,1,2,1,1,1,0,6,2,0,1,1,0,0,0,2,2,2,1,1,2,0,1,0,2,2,1,
+    2,2,2,0,0,1,1,2,2,1,0,0,0,2,6,1,8,2,6,0,4,0,5,1,3,0,1,2,8,0,0,0,
+    1,0,6,0,1,0,0,0,4,0,4,0,3,0,3,0,10,1,1,2,14,0,6,0,5,0,17,0,5,0,1,0,
+    12,0,46,0,6,0,15,1,17,0,5,2,8,0,1,0,25,0,14,0,0,0,15,1,7,4,63,0,0,2,2,0,
+    0,2,4,0,0,1,2,2,1,0,2,0,2,0,0,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,
+    1,0,4,0,0,0,1,0,2,0,0,1,0,2,0,0,2,1,0,0,0,0,0,2,2,0,0,1,0,0,2,0,
+    0,0,0,1,1,0,2,0,0,0,0,0,2,0,0,0,0,1,0,2,0,0,2,1,0,0,1,0,2,0,17,0,
+    15,0,2,0,0,0,0,0,0,0,2,0,0,0,2,0,2,0,0,0,0,0,2,0,0,1,0,0,0,0,2,0,
+    0,0,0,0,4,0,0,1,2,2,0,1,2,2,0,1,0,0,0,0,0,0,2,1,2,2,1,1,2,0,0,0,
+    2,2,2,1,0,0,0,0,2,2,0,1,0,0,0,0,2,0,0,0,4,0,0,0,2,1,23,0,9,2,2,1,
+    4,0,0,0,0,0,2,0,2,1,2,2,1,0,2,1,2,0,0,0,0,0,2,0,2,0,0,0,2,0,0,0,
+    2,0,0,0,2,0,0,0,4,0,0,1,2,2,0,1,0,0,0,0,2,0,0,0,2,1,0,2,0,0,19,1,
+    5,0,4,2,2,0,2,0,2,1,2,0,0,0,0,0,2,0,4,0,0,0,2,0,0,0,0,0,0,0,4,0,
+    2,0,2,0,2,0,2,0,2,0,0,2,2,1,2,0,2,0,0,0,17,1,0,0,1,0,2,0,0,0,2,0,
+    4,0,4,0,2,2,0,1,2,0,0,0,2,2,2,1,2,0,0,0,0,0,2,1,0,2,0,1,1,2,4,1,
+    11,2,0,0,0,0,4,0,4,0,4,0,3,0,2,0,0,0,2,0,4,0,2,0,6,0,2,0,2,1,3,2,
+    3,0,2,0,0,0,2,1,0,0,1,2,3,1,1,2,2,0,0,0,1,1,2,2,4,1,0,2,0,1,1,0,
+    2,0,1,0,0,2,2,1,2,2,1,0,2,1,1,2,2,1,6,0,4,2,8,0,2,0,3,1,8,0,5,0,
+    3,0,1,0,2,0,4,0,1,0,2,2,8,0,2,0,14,0,7,1,11,2,10,0,12,0,2,1,21,0,1,0,
+    1,0,24,0,16,0,6,2,13,0,5,1,7,0,4,2,2,0,21,0,12,1,9,0,19,4,61,0,2,0,0,2,
+    2,0,0,0,0,2,2,1,2,0,0,2,0,0,2,0,0,0,0,0,0,0,2,1,0,2,0,0,2,0,0,1,
+    2,0,1,2,2,1,0,0,0,0,2,2,0,0,2,1,1,0,2,2,0,1,0,0,0,0,0,0,0,0,0,0,
+    2,1,0,2,0,0,0,1,2,0,0,0,0,0,0,0,0,0,2,0,0,1,0,2,0,1,0,0,25,0,7,1,
+    0,0,0,0,2,2,2,0,0,2,0,1,2,0,0,0,2,0,0,1,2,0,0,0,2,0,2,0,1,2,0,1,
+    2,0,0,1,0,2,2,0,0,1,2,2,0,1,2,0,2,0,0,0,0,1,0,2,0,1,2,2,0,1,2,0,
+    0,0,0,2,2,0,2,0,0,1,0,0,0,0,2,0,1,0,2,0,2,1,2,0,17,2,11,0,0,1,2,0,
+    0,0,4,2,0,1,0,0,2,0,0,1,2,0,0,0,0,0,2,2,2,1,2,0,0,2,2,1,2,0,0,0,
+    0,0,0,1,0,2,2,1,2,0,2,2,2,1,0,0,2,0,0,2,0,1,2,0,1,0,4,1,3,2,23,0,
+    2,0,2,1,0,0,4,0,2,0,4,0,2,0,2,0,0,0,0,0,2,0,2,0,2,0,0,0,0,0,1,0,
+    2,0,2,0,2,0,2,0,2,0,2,1,0,0,2,0,2,0,2,0,17,2,2,0,0,0,0,0,2,0,0,1,
+    0,0,0,0,4,0,4,2,2,1,0,0,2,1,2,2,0,0,2,0,2,0,0,0,0,0,0,0,2,0,11,0,
+    3,0,2,0,4,0,0,0,2,1,2,2,4,1,0,2,2,1,0,2,2,1,2,2,2,1,2,2,2,0,4,0,
+    0,0,1,1,3,0,2,2,2,0,4,0,0,0,0,0,1,0,0,0,0,0,3,1,1,2,2,1,2,2,0,0,
+    0,1,3,2,4,1,2,2,1,1,0,0,0,2,2,1,0,0,1,2,4,1,2,0,6,0,4,0,16,0,7,0,
+    5,0,3,0,1,0,1,2,4,0,2,1,0,0,2,2,8,0,18,0,9,1,15,0,2,2,14,0,8,0,15,0,
+    11,1,24,0,1,0,10,0,8,0,13,2,0,0,0,1,5,0,5,0,11,0,12,2,11,4,61,2,0,0,2,0,
+    0,1,2,2,2,0,0,0,0,2,2,1,2,0,0,0,0,0,2,2,0,0,0,0,2,0,0,0,0,1,0,2,
+    0,0,2,1,0,2,2,0,0,0,1,1,2,0,0,2,2,0,0,1,0,0,2,0,1,1,2,0,0,0,0,2,
+    0,0,0,1,2,0,0,2,0,1,0,0,0,1,0,2,2,0,0,1,0,0,0,0,7,0,23,0,1,1,2,2,
+    0,0,2,0,0,0,0,0,0,0,2,0,2,0,0,0,0,1,2,2,0,0,2,0,0,0,0,0,2,1,0,0,
+    1,0,4,0,0,1,2,0,0,2,2,1,0,0,2,0,1,0,2,0,2,0,0,1,0,2,2,1,0,2,0,1,
+    2,0,0,0,0,0,0,0,2,0,0,0,2,0,0,1,2,2,0,0,0,0,17,0,13,1,2,0,4,0,0,0,
+    2,0,0,0,4,0,0,0,0,0,2,0,2,0,0,0,2,0,0,1,2,0,0,2,0,1,2,0,0,0,2,0,
+    2,0,0,0,0,1,2,2,0,0,2,1,2,0,2,2,2,0,2,1,0,0,1,0,2,0,0,0,29,1,2,2,
+    4,0,0,0,4,0,0,0,2,0,2,1,2,0,2,0,2,0,2,2,0,0,2,0,2,0,0,1,2,0,2,0,
+    1,0,0,0,0,0,2,0,2,0,2,0,2,0,2,0,0,0,19,0,4,0,4,0,2,1,0,0,0,0,1,2,
+    2,1,2,0,0,0,0,0,4,0,4,0,0,0,2,0,0,1,2,2,2,1,0,2,4,1,0,2,0,0,9,0,
+    0,0,1,1,0,2,2,1,2,2,0,1,0,2,4,1,2,2,2,0,1,0,2,0,2,0,4,0,2,0,2,1,
+    4,2,0,0,4,0,5,0,1,0,2,0,2,0,2,0,0,0,0,1,0,2,0,0,0,1,3,2,1,1,4,2,
+    2,0,4,0,1,0,1,1,2,2,0,0,3,1,3,0,0,2,2,1,0,0,0,0,6,0,4,0,20,0,6,0,
+    1,0,11,0,5,2,1,1,0,0,3,0,0,2,0,1,2,0,24,0,6,2,7,0,17,1,5,0,12,0,10,1,
+    7,2,5,0,10,0,8,0,4,0,2,0,9,0,0,0,4,0,15,1,11,2,12,0,8,4,61,0,2,0,2,0,
+    0,2,2,0,0,0,2,2,0,1,2,2,0,0,0,0,2,0,0,1,2,0,1,2,2,1,0,0,2,2,0,0,
+    0,0,0,0,0,1,2,0,0,0,2,2,0,1,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,2,1,
+    1,0,2,2,0,1,0,0,0,0,0,0,2,0,0,1,0,0,0,0,0,2,15,1,15,0,1,0,4,0,1,0,
+    2,1,0,2,0,0,2,2,0,1,0,0,2,0,2,0,0,0,2,0,0,0,0,1,2,0,0,0,2,0,1,0,
+    2,0,0,0,2,0,1,0,2,1,0,0,2,0,0,0,4,1,0,2,0,0,0,0,2,1,0,2,2,1,0,2,
+    0,0,2,0,0,0,0,1,0,0,2,0,0,0,0,0,0,1,2,0,19,2,13,0,2,0,2,0,2,0,2,0,
+    2,0,2,1,0,0,4,1,0,0,0,0,2,0,2,0,0,2,2,0,0,0,0,1,2,0,2,2,0,0,0,1,
+    2,0,2,0,2,0,1,1,0,2,2,0,0,0,4,1,0,0,2,0,0,0,2,0,2,0,17,0,9,0,0,1,
+    0,0,2,0,2,0,2,0,2,0,2,2,2,0,0,0,4,0,2,1,2,0,1,0,2,0,2,0,2,0,0,0,
+    2,0,2,0,0,0,0,0,0,0,0,0,2,0,2,0,0,0,17,1,0,0,2,0,4,2,4,0,0,1,4,0,
+    0,2,1,1,2,0,2,1,0,2,2,0,0,0,2,0,4,0,0,0,0,0,2,0,2,0,0,0,2,0,9,0,
+    0,1,2,2,1,1,1,2,0,1,2,2,4,1,0,2,0,0,2,1,4,2,0,1,0,2,2,1,2,0,4,2,
+    2,1,4,2,4,0,2,0,1,0,7,1,0,2,2,1,2,2,0,0,2,1,0,2,1,0,2,0,2,0,5,0,
+    0,0,6,1,2,2,0,0,0,1,0,0,4,0,0,0,5,0,3,0,1,0,2,0,3,0,4,0,12,0,10,2,
+    6,0,6,0,5,1,9,0,5,0,0,2,1,1,2,0,0,0,12,2,0,1,10,0,0,0,15,1,13,0,4,2,
+    12,0,1,0,5,0,2,0,14,0,8,0,3,0,13,0,1,0,8,0,9,0,1,2,18,4,59,0,2,2,0,0,
+    2,0,0,1,2,2,0,0,2,0,0,0,0,0,2,0,0,0,0,2,0,0,2,1,0,2,2,0,0,1,0,0,
+    2,0,0,0,0,2,0,0,0,0,0,1,0,0,2,0,0,0,2,0,0,0,0,1,0,2,0,0,2,1,1,0,
+    2,2,0,1,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,23,1,9,0,2,0,2,0,1,0,2,1,
+    0,4,0,0,2,0,0,1,2,0,0,2,0,1,2,1,2,2,0,1,2,0,0,2,0,1,2,0,0,0,2,0,
+    0,0,1,1,0,0,2,0,2,0,0,0,2,0,0,0,0,0,2,1,0,2,2,0,0,0,2,0,0,0,2,0,
+    0,1,0,0,0,0,2,2,0,0,0,0,0,1,2,0,0,0,19,0,13,1,2,0,0,0,2,0,2,0,4,0,
+    0,0,2,0,2,1,0,2,4,0,2,0,0,0,0,0,2,1,0,0,2,2,2,0,0,0,0,1,2,0,2,0,
+    0,0,0,0,0,0,4,0,0,1,1,0,0,0,0,0,4,0,0,0,4,0,2,0,1,0,25,0,0,0,2,0,
+    2,0,0,1,0,0,2,0,2,0,0,0,2,0,4,0,0,0,0,0,2,0,4,0,0,0,2,0,0,0,2,0,
+    2,0,0,0,2,0,0,0,0,0,2,0,0,1,0,0,5,0,13,2,4,0,2,1,2,0,2,0,4,0,2,0,
+    0,0,4,0,1,0,0,0,2,0,0,1,4,2,0,1,0,2,2,1,2,2,2,0,1,0,4,0,2,1,13,2,
+    6,0,0,1,2,2,0,1,0,2,1,1,1,2,2,0,4,1,2,2,1,1,4,0,0,0,0,0,0,2,2,0,
+    2,0,2,0,2,0,6,0,4,0,4,0,3,0,5,0,0,1,2,2,1,0,2,0,2,0,0,1,1,2,2,1,
+    0,0,3,2,2,1,6,0,2,0,1,0,0,0,0,2,4,1,0,0,3,1,3,2,0,0,1,0,1,2,8,1,
+    12,0,8,0,6,2,2,0,9,0,7,1,0,0,3,0,3,2,14,1,4,0,1,0,2,1,2,2,9,0,11,0,
+    2,0,8,0,22,0,23,0,5,0,14,0,2,0,5,0,11,1,8,2,8,0,11,0,8,4,57,0,0,0,2,0,
+    0,0,2,2,0,0,0,1,2,2,0,0,2,0,0,0,0,0,2,0,0,0,2,0,0,0,0,0,0,2,2,1,
+    0,0,0,2,0,1,0,0,2,0,0,0,2,0,1,0,2,0,1,0,2,0,0,0,2,0,0,1,0,2,0,0,
+    0,1,0,0,0,0,2,0,0,0,0,0,0,1,2,0,9,0,25,0,2,0,0,0,0,0,2,1,2,2,0,0,
+    0,0,2,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,2,0,2,0,0,1,2,2,0,1,0,0,0,0,
+    2,1,0,2,0,0,2,0,0,0,2,1,1,0,2,0,2,0,0,0,2,1,2,2,0,0,0,1,0,2,0,0,
+    2,0,0,0,2,0,0,1,0,0,0,0,2,2,0,1,19,0,13,0,2,0,0,0,0,1,2,0,2,0,2,0,
+    2,0,2,0,2,0,2,0,0,0,2,0,2,0,2,0,0,0,2,0,0,1,0,0,4,0,0,0,2,0,0,0,
+    0,0,2,0,2,0,1,0,2,0,2,0,0,0,0,0,1,0,2,0,2,1,0,0,23,0,0,0,4,0,0,1,
+    0,0,2,2,0,0,2,0,0,0,2,0,2,0,0,0,2,1,2,2,2,0,0,1,2,0,2,0,0,0,2,0,
+    0,0,2,0,2,0,2,0,0,1,0,0,0,2,2,0,19,0,2,1,2,0,2,2,0,1,2,0,0,2,2,1,
+    4,0,2,0,2,0,0,0,0,0,0,0,2,0,2,0,2,0,0,0,2,0,0,1,2,2,0,1,0,2,9,1,
+    0,2,4,0,2,0,2,0,0,0,2,0,0,0,1,1,0,0,0,0,4,0,0,2,2,1,0,2,2,0,1,1,
+    0,2,4,1,5,2,6,1,6,2,6,0,4,0,4,0,3,0,3,0,0,0,0,1,0,2,0,0,0,1,0,0,
+    1,2,6,1,3,0,5,0,4,0,8,0,0,0,1,0,2,1,0,2,2,2,1,1,1,0,1,0,2,0,5,0,
+    0,0,10,2,10,1,6,0,6,0,3,0,11,0,3,0,4,1,8,0,2,0,1,0,2,2,0,0,2,1,11,0,
+    11,0,0,2,16,0,8,0,13,0,5,0,12,0,4,1,3,2,7,0,8,0,1,0,11,2,57,2,2,0,0,0,
+    2,2,0,0,2,1,0,2,0,0,2,0,0,0,0,0,2,0,0,0,2,0,0,2,0,1,0,0,2,0,0,2,
+    0,1,0,0,2,0,0,0,0,0,2,0,1,0,2,0,0,1,2,0,0,0,0,2,1,1,2,2,0,1,2,0,
+    0,0,0,0,0,0,0,0,0,0,0,1,0,2,17,0,13,1,0,0,0,0,2,0,0,0,2,0,0,1,0,4,
+    2,0,0,1,0,0,2,0,0,0,0,0,2,0,0,0,2,1,0,2,0,1,2,0,0,0,0,0,2,0,0,1,
+    0,2,2,0,0,1,0,0,0,0,0,2,4,1,0,0,0,0,2,0,2,0,0,0,0,0,2,0,0,0,0,1,
+    0,2,2,0,0,1,0,2,2,1,0,0,0,0,21,0,9,0,0,0,2,1,0,0,2,2,0,0,0,1,2,0,
+    2,0,2,1,2,2,2,0,2,0,0,0,0,0,4,0,2,0,0,0,2,0,2,0,1,0,2,1,0,0,2,0,
+    0,0,2,0,0,0,2,0,0,1,0,0,2,0,0,0,2,0,0,0,1,0,11,0,13,0,4,0,2,1,2,2,
+    0,0,2,0,2,1,0,0,0,0,2,0,0,0,2,0,0,2,2,1,2,0,2,2,2,0,0,1,4,0,0,0,
+    2,0,0,0,0,0,2,1,2,2,2,0,2,0,1,1,23,0,2,2,4,1,0,0,4,0,2,0,2,0,2,0,
+    0,0,2,0,2,0,4,0,1,1,2,2,1,1,0,2,2,0,4,0,0,0,2,0,2,0,0,0,5,1,9,2,
+    4,1,2,2,4,1,4,2,0,1,0,2,2,1,2,0,1,2,0,1,1,2,2,1,2,2,2,1,0,0,2,2,
+    0,1,11,2,0,1,6,2,4,1,6,2,6,1,4,2,4,0,0,1,1,2,1,0,0,1,0,0,0,2,0,0,
+    0,1,0,0,0,0,2,0,3,0,3,0,4,0,8,1,1,4,0,1,2,0,4,0,1,0,3,2,4,1,1,0,
+    5,0,5,0,6,0,10,0,8,0,6,0,2,0,5,0,9,0,18,0,7,0,0,0,0,1,6,0,1,2,4,0,
+    9,0,13,1,8,0,2,0,6,0,13,0,0,0,12,2,4,0,3,0,3,0,4,1,15,4,57,1,2,2,2,0,
+    0,0,0,0,2,2,2,0,0,1,0,2,0,0,2,0,0,0,2,0,0,0,0,0,0,0,2,2,0,1,0,0,
+    0,0,2,0,0,0,0,0,2,0,1,0,2,0,0,1,0,2,0,0,0,0,2,1,0,0,0,0,0,2,0,1,
+    2,0,0,0,0,0,0,1,2,2,0,0,25,1,7,0,0,2,2,1,0,0,0,0,2,0,1,0,2,2,2,1,
+    0,0,2,2,0,0,0,1,0,0,4,1,1,2,2,0,0,0,0,1,2,0,0,2,2,1,0,0,0,0,2,0,
+    0,0,0,1,2,2,0,1,0,0,0,0,0,0,2,0,0,0,2,0,0,0,2,0,2,0,0,0,0,0,2,0,
+    0,0,0,1,2,2,0,1,0,2,2,1,23,0,11,0,0,0,4,1,0,2,2,0,2,1,2,0,0,0,1,0,
+    4,0,0,2,2,1,2,0,2,0,2,0,2,0,1,0,2,0,2,1,0,0,2,0,2,0,0,2,0,1,2,0,
+    2,0,0,0,2,0,0,1,2,2,0,0,2,0,0,1,0,0,0,0,1,0,29,0,0,0,4,1,4,2,4,0,
+    4,0,0,1,0,2,0,0,4,0,1,0,2,0,0,1,2,0,2,0,0,0,2,0,0,0,2,0,2,0,2,0,
+    0,0,2,0,2,1,0,2,0,0,2,1,0,0,19,2,0,1,0,0,0,0,6,0,2,0,0,0,4,0,0,0,
+    2,0,2,0,2,1,0,2,4,0,2,0,0,0,0,0,1,1,0,2,4,1,0,2,2,1,2,2,11,0,2,0,
+    1,0,0,0,0,0,4,1,4,2,4,1,0,0,0,2,0,1,0,2,2,1,1,2,0,1,2,2,2,0,0,1,
+    2,2,7,1,1,2,3,1,2,2,4,1,6,2,4,1,6,2,6,0,4,1,0,0,3,0,0,2,2,1,0,0,
+    0,0,6,0,1,0,3,0,1,0,0,0,3,0,0,0,4,0,6,0,1,0,0,0,2,2,4,1,12,0,9,0,
+    5,0,0,1,7,2,5,0,8,0,10,0,8,0,4,0,3,0,6,1,3,0,2,0,5,2,2,0,6,0,2,0,
+    0,0,3,0,5,0,1,0,1,0,6,0,3,0,2,0,6,0,3,0,1,0,5,0,2,2,55,2,0,1,2,2,
+    2,0,0,0,0,0,2,0,0,2,2,1,0,2,2,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,2,0,
+    0,0,0,0,0,0,2,0,1,1,2,0,0,2,0,0,2,0,0,0,2,1,1,2,2,0,0,1,0,0,0,0,
+    0,0,0,0,2,0,0,0,7,1,25,2,0,0,2,1,0,0,0,0,0,0,2,0,0,0,2,0,0,0,2,2,
+    0,1,0,0,2,0,0,2,2,1,1,0,2,1,0,0,2,0,0,2,0,0,2,1,0,0,2,0,0,0,0,0,
+    2,1,0,2,0,1,0,2,0,1,2,0,0,2,2,0,0,1,0,0,2,0,0,0,2,0,0,0,2,0,0,0,
+    0,1,0,2,0,1,2,2,0,1,21,0,7,0,0,0,2,0,1,0,2,0,2,1,0,2,0,1,2,2,2,1,
+    1,0,2,0,2,2,2,1,2,0,0,0,2,0,2,1,0,0,2,2,2,0,0,1,2,0,0,0,2,2,0,1,
+    2,0,0,0,0,1,2,2,0,0,4,1,1,0,2,2,2,1,0,0,27,0,0,0,0,1,1,2,2,0,2,0,
+    2,1,4,2,4,0,0,0,0,0,2,1,2,0,0,2,0,0,2,1,2,0,0,0,2,0,2,2,0,1,0,0,
+    2,0,2,1,0,2,2,0,2,1,0,2,2,1,23,0,2,2,2,1,2,0,1,0,2,2,4,1,0,0,4,0,
+    2,1,0,2,2,0,2,0,2,0,0,0,4,0,2,0,0,0,0,1,1,2,2,1,0,2,4,1,15,2,4,1,
+    2,2,2,1,0,0,1,2,2,1,2,2,4,0,2,1,2,2,0,1,0,2,0,1,0,2,0,1,0,0,2,2,
+    0,1,7,2,2,1,2,2,1,1,3,0,0,0,6,0,6,0,4,0,4,0,4,0,6,2,1,1,3,0,2,0,
+    0,0,10,0,0,0,0,0,5,0,1,0,0,0,3,0,3,0,2,0,4,0,2,0,0,1,0,2,12,0,6,0,
+    1,0,7,0,5,1,0,0,7,0,0,0,4,0,8,0,6,0,20,2,13,1,7,2,8,0,9,0,8,0,4,0,
+    6,0,0,0,28,0,25,0,1,1,13,0,9,0,2,2,10,0,4,0,5,0,6,1,5,2,53,0,0,2,0,0,
+    2,0,2,0,0,0,0,2,2,0,0,0,2,1,1,2,2,0,0,0,2,0,0,1,0,2,0,1,2,2,0,1,
+    0,2,0,1,2,2,1,1,2,2,0,0,2,1,0,2,1,1,2,0,0,2,2,1,0,0,0,0,0,0,2,0,
+    1,0,2,0,0,0,17,0,15,0,0,1,2,0,0,2,2,1,0,0,2,0,0,0,0,1,2,2,0,2,0,1,
+    2,2,0,1,0,0,2,0,1,0,4,0,0,0,0,0,0,0,2,1,0,0,0,0,0,0,2,0,0,0,2,0,
+    0,0,2,1,0,2,0,1,2,2,0,1,0,0,0,0,2,2,0,0,0,0,0,1,2,0,0,0,2,0,0,0,
+    2,0,2,1,1,2,2,1,23,0,9,2,2,1,2,0,0,0,2,0,1,1,0,2,2,1,2,0,2,0,0,2,
+    2,1,0,0,0,0,2,0,0,0,4,0,2,0,0,0,2,0,0,0,2,1,2,2,0,1,2,0,2,0,1,0,
+    2,0,0,0,2,0,0,0,2,1,0,2,2,1,0,0,0,0,15,0,9,0,2,0,2,0,0,0,1,0,0,1,
+    4,2,0,0,2,0,6,0,0,1,2,2,1,0,2,1,2,0,0,2,0,0,2,1,2,0,0,0,2,0,2,0,
+    2,0,0,0,0,0,2,1,0,2,0,1,15,2,5,1,4,0,4,0,0,2,2,1,0,0,0,0,4,1,0,2,
+    2,0,2,0,2,0,0,0,2,0,2,0,2,0,2,1,4,2,0,0,0,0,1,0,0,1,0,2,15,1,4,2,
+    4,1,2,0,4,2,0,1,0,0,1,0,2,2,2,0,2,0,4,0,0,0,0,0,0,1,0,2,0,1,0,0,
+    2,0,9,0,2,0,0,0,2,0,2,0,1,0,3,0,2,0,4,0,6,0,6,0,2,0,6,0,2,0,1,0,
+    0,0,2,0,4,0,2,0,6,0,3,0,7,0,1,0,2,0,5,0,0,0,2,0,2,0,0,1,6,2,2,0,
+    6,0,2,0,1,0,7,0,1,0,5,1,0,0,2,0,2,0,18,0,10,2,11,1,7,0,8,0,7,0,4,2,
+    6,0,8,0,32,0,1,1,23,2,8,0,15,0,23,1,4,0,12,0,1,0,1,2,2,4,53,0,2,0,0,0,
+    0,0,2,0,0,2,2,1,0,0,0,0,2,2,0,1,0,2,2,1,1,2,2,0,2,0,0,0,0,1,0,2,
+    2,0,0,0,0,1,0,2,2,0,0,0,1,0,2,1,2,2,0,1,0,0,0,0,0,0,0,0,2,0,1,0,
+    2,0,0,0,23,1,7,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,1,0,4,0,0,2,1,2,2,
+    0,1,0,0,2,0,0,0,2,0,1,0,2,0,0,0,0,1,0,0,2,0,0,0,2,0,0,0,2,0,0,0,
+    0,0,2,0,0,1,2,2,0,1,0,2,2,1,1,0,2,0,0,0,2,0,0,0,0,0,2,0,0,1,2,2,
+    0,0,0,0,2,1,25,0,7,2,2,1,0,0,2,0,2,1,0,2,2,0,0,1,0,0,2,2,0,1,2,0,
+    0,2,2,1,0,0,1,0,4,0,0,0,2,1,4,2,0,1,2,0,0,2,0,1,2,2,2,1,0,0,2,0,
+    0,0,2,1,0,2,2,1,0,2,0,1,2,2,2,1,5,0,23,0,0,0,2,0,2,0,2,0,2,0,0,0,
+    1,0,4,0,2,0,0,1,4,2,2,0,2,1,0,2,2,0,0,1,0,0,0,0,0,0,2,0,2,0,0,0,
+    2,1,0,2,4,1,1,2,2,1,2,2,25,1,2,0,2,0,0,0,4,0,2,0,2,0,2,0,1,0,4,0,
+    2,0,2,0,0,0,4,0,0,0,2,1,0,2,0,0,2,0,4,0,0,1,4,2,0,0,7,1,11,2,0,1,
+    2,0,4,2,4,1,4,2,0,0,2,0,0,1,0,2,2,1,0,2,2,1,4,2,0,0,1,1,0,2,0,1,
+    0,2,11,1,2,0,4,0,2,0,0,0,4,0,0,0,5,1,0,2,2,0,2,0,8,1,2,0,6,0,2,0,
+    0,0,2,0,1,2,4,0,0,0,6,0,6,0,3,0,9,1,1,0,1,2,1,0,4,0,4,0,2,1,1,0,
+    0,0,2,0,6,0,0,0,3,0,1,0,5,0,1,0,8,0,4,0,6,2,12,0,7,0,7,0,4,0,1,1,
+    0,0,4,0,42,0,0,2,3,0,21,0,18,0,9,1,29,2,1,0,6,1,11,0,12,2,51,0,0,0,2,2,
+    0,0,0,0,2,0,0,0,2,0,0,2,0,1,2,2,0,1,0,2,2,1,0,2,0,0,0,0,0,0,0,0,
+    2,1,0,2,0,0,2,1,1,0,2,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,2,0,1,0,2,0,
+    5,0,25,1,1,2,2,0,0,0,2,0,0,0,0,1,0,0,4,0,1,0,2,0,2,0,0,0,0,2,0,1,
+    0,0,2,2,0,1,0,0,2,0,0,0,0,1,2,0,0,2,2,0,1,0,2,1,0,0,0,0,2,1,2,0,
+    0,0,0,2,2,0,0,1,0,2,2,1,0,2,2,1,1,0,2,0,0,0,2,0,0,0,0,0,0,0,2,1,
+    0,0,2,2,23,0,7,0,0,1,0,0,2,0,2,0,0,0,2,1,2,2,0,0,0,0,0,0,0,0,2,1,
+    2,0,0,0,2,0,0,0,0,0,0,1,2,2,0,0,4,0,2,0,0,1,2,0,0,0,0,0,2,0,2,0,
+    0,0,0,0,2,1,0,2,0,1,2,0,0,0,2,0,29,0,2,0,2,0,2,0,0,2,2,1,2,0,2,0,
+    0,0,1,0,2,1,2,2,2,0,2,1,4,2,2,1,0,0,0,0,2,0,2,0,0,0,0,1,0,2,2,1,
+    0,2,2,1,0,2,2,1,2,0,15,0,9,0,2,2,0,1,2,0,2,0,2,0,4,1,2,2,2,0,0,0,
+    0,0,2,0,4,0,0,1,2,2,0,0,2,1,2,2,0,1,0,2,4,0,0,1,2,2,15,0,2,1,3,0,
+    2,2,2,1,0,2,4,0,6,0,2,1,0,2,2,1,0,2,0,1,4,2,0,1,2,0,2,2,0,1,1,0,
+    0,0,15,0,0,0,2,0,4,0,4,0,0,0,2,0,4,0,1,1,3,0,0,0,0,2,4,0,4,0,6,0,
+    4,0,4,0,0,1,3,0,2,2,2,0,2,0,6,0,4,0,3,0,5,1,3,0,5,0,0,0,6,0,8,0,
+    1,0,0,0,3,0,6,0,2,0,0,2,2,0,5,0,7,0,8,0,18,1,2,0,1,0,1,0,9,2,2,0,
+    1,0,0,0,20,0,18,1,0,0,3,0,17,0,18,2,9,1,15,0,1,2,7,0,8,2,51,0,2,0,0,0,
+    2,0,0,2,0,1,0,2,2,0,0,0,0,2,2,1,0,0,0,0,0,2,2,1,0,0,2,0,0,0,0,0,
+    0,2,2,1,0,0,0,2,0,1,0,0,2,0,0,2,0,1,0,2,2,1,1,0,2,0,1,0,2,1,13,2,
+    17,1,0,2,2,1,0,0,0,0,0,0,0,0,2,0,2,0,1,0,2,1,0,4,0,0,2,0,0,1,0,0,
+    2,0,2,0,0,0,2,1,1,2,2,1,0,2,2,0,0,1,0,0,2,0,0,2,0,1,2,0,1,0,0,0,
+    2,0,2,1,0,0,0,2,2,1,0,0,0,0,0,2,2,0,0,1,0,0,0,0,2,0,2,0,0,0,0,0,
+    2,0,27,1,5,0,2,0,2,0,0,0,0,0,2,0,2,0,2,0,0,1,2,2,2,0,0,1,0,2,1,0,
+    2,1,2,2,0,1,2,0,0,0,2,0,1,0,2,1,0,2,2,1,2,0,2,2,0,1,2,0,0,0,2,0,
+    0,1,2,2,0,0,2,1,2,0,0,2,0,1,25,0,3,2,2,1,2,2,2,1,2,0,2,0,0,0,2,2,
+    2,1,2,0,1,0,2,0,0,1,2,2,2,1,2,2,2,1,2,2,0,1,0,2,2,1,2,0,1,0,0,0,
+    2,1,2,2,0,1,2,2,0,0,25,1,4,2,2,1,2,0,2,2,1,1,2,0,0,2,2,1,4,0,2,0,
+    2,0,0,1,0,2,4,0,2,1,2,2,0,0,0,1,2,2,0,1,0,0,2,2,2,1,15,0,2,2,4,0,
+    1,0,1,0,2,0,2,1,2,2,4,0,4,1,0,2,2,1,0,2,0,1,2,0,2,2,2,1,2,0,2,2,
+    0,1,9,0,3,0,1,1,1,2,2,0,2,1,4,0,0,0,2,2,2,0,0,0,3,1,2,0,2,0,2,0,
+    4,0,0,2,6,0,4,0,3,1,0,0,0,0,2,2,6,0,4,0,2,0,3,0,5,0,3,0,7,0,6,0,
+    12,0,4,0,2,1,1,0,0,0,2,0,1,0,0,0,0,0,9,2,6,0,14,0,12,0,3,0,9,1,11,0,
+    4,0,3,0,0,0,16,2,20,0,4,0,9,0,3,0,14,1,25,0,1,0,10,0,21,0,51,2,0,2,2,0,
+    0,0,2,0,2,0,0,0,0,0,2,0,0,0,0,0,2,2,0,0,0,1,0,2,0,1,0,0,2,2,2,1,
+    1,0,0,0,2,2,0,1,2,2,0,0,0,0,0,1,0,0,2,0,1,0,2,0,0,0,0,0,19,0,11,1,
+    0,2,2,1,0,2,0,1,2,0,0,0,0,0,2,0,1,0,2,0,2,2,0,1,0,0,0,0,2,0,0,0,
+    2,0,0,0,0,0,0,0,2,0,0,0,2,0,0,1,2,2,0,1,0,0,0,0,2,0,0,0,2,0,0,0,
+    0,0,0,0,2,0,0,1,0,0,2,2,0,0,2,1,1,0,0,2,2,0,0,1,0,0,0,0,2,0,0,0,
+    27,0,3,0,2,1,2,0,2,0,0,0,2,0,1,0,2,0,2,0,0,0,2,1,0,2,2,0,0,1,2,0,
+    0,2,0,1,0,0,2,0,2,0,0,0,0,1,0,2,2,1,0,0,2,2,2,1,2,0,0,0,2,0,0,0,
+    2,0,0,1,2,0,0,2,0,0,0,1,11,0,15,2,2,1,0,2,2,1,0,2,4,1,0,2,2,1,2,0,
+    2,0,2,0,2,0,1,1,2,2,0,1,0,2,2,1,2,2,4,1,2,0,0,0,0,0,0,0,4,0,0,0,
+    1,0,0,1,2,2,0,1,13,0,7,2,0,1,4,0,2,0,2,0,2,0,0,0,0,0,0,0,2,0,2,0,
+    2,0,0,0,2,1,1,2,2,0,4,0,4,0,2,0,0,1,2,2,0,0,0,1,2,2,19,0,4,1,4,2,
+    2,1,0,2,0,1,1,2,0,1,2,2,4,0,4,1,2,2,4,1,1,0,0,2,0,1,2,0,2,0,2,0,
+    1,0,0,0,0,0,3,0,1,1,1,2,1,0,2,0,4,0,2,1,0,0,0,0,2,0,1,0,3,0,4,2,
+    2,0,7,1,6,0,6,0,8,2,1,0,2,0,0,1,0,0,4,0,6,0,4,0,4,0,5,0,0,0,13,0,
+    1,0,8,0,6,2,2,1,2,2,1,0,2,0,2,0,1,0,2,1,5,0,7,0,12,0,14,0,8,0,7,0,
+    19,0,2,0,0,0,0,0,18,0,18,0,4,0,17,0,2,2,12,1,25,2,10,1,19,2,49,0,2,0,0,0,
+    2,0,0,0,0,2,0,0,0,0,2,0,0,0,0,0,2,0,0,0,2,0,0,0,0,2,2,0,1,1,0,2,
+    2,0,0,0,0,1,0,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,1,0,23,0,5,0,2,0,
+    0,1,0,2,0,1,2,2,0,1,2,0,0,0,0,0,2,0,0,0,1,0,2,2,2,0,0,1,0,0,2,0,
+    0,2,0,1,2,0,2,0,0,1,0,2,0,1,0,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,
+    0,0,2,0,0,0,2,0,0,0,0,0,0,1,0,2,2,1,2,0,1,0,2,0,1,0,2,0,0,0,31,1,
+    1,0,2,0,2,2,2,0,0,1,4,0,0,0,0,0,0,0,0,0,4,0,2,0,0,1,2,0,2,2,0,0,
+    0,1,1,0,2,0,2,0,1,0,2,0,2,0,2,1,1,0,0,2,2,1,0,0,2,0,2,0,2,0,0,0,
+    2,0,0,0,2,0,0,1,2,0,1,0,27,2,2,1,0,2,2,1,2,2,2,1,0,0,2,0,2,0,2,0,
+    0,0,2,1,0,2,4,0,1,1,0,2,2,1,2,2,0,1,0,0,2,0,4,0,2,0,0,0,1,1,4,2,
+    2,0,0,0,0,1,0,2,27,0,2,1,6,0,1,0,2,2,2,1,2,0,4,2,0,1,2,0,0,0,1,1,
+    2,2,4,0,0,0,2,1,0,2,0,1,0,0,4,2,2,0,2,1,2,0,2,2,19,1,0,2,0,0,2,0,
+    6,0,4,1,0,2,0,1,1,0,0,0,0,0,2,2,4,1,2,0,4,2,2,1,0,0,0,0,2,2,0,1,
+    9,0,2,0,4,0,6,0,1,0,3,1,0,0,1,0,1,0,2,0,2,0,4,0,0,0,0,0,2,2,3,1,
+    0,0,13,0,8,2,6,0,4,1,6,0,2,0,0,0,2,2,0,0,2,0,4,0,4,1,4,0,1,0,2,0,
+    9,0,9,0,6,0,8,2,2,1,2,0,1,0,1,0,4,0,0,0,20,2,9,0,13,0,4,0,10,1,10,0,
+    0,0,19,0,0,0,4,0,9,0,16,0,18,0,1,0,19,0,14,2,0,1,13,0,8,2,49,0,2,0,0,0,
+    0,2,0,0,2,0,2,1,0,2,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,
+    0,0,2,0,1,0,2,0,0,0,0,0,0,0,0,0,2,0,0,1,0,2,9,0,23,1,2,0,2,0,0,0,
+    0,2,0,1,2,0,0,0,0,0,2,0,0,0,0,1,2,0,0,2,2,2,0,1,0,0,2,2,0,0,2,0,
+    0,1,0,0,2,0,1,0,2,0,2,1,0,0,0,2,0,1,0,2,2,1,0,0,0,0,2,0,0,0,0,1,
+    2,0,0,0,0,0,2,0,2,2,1,1,2,2,0,1,0,2,0,1,2,0,0,0,2,0,7,0,29,1,4,2,
+    2,0,2,1,1,0,2,0,2,2,2,1,0,0,4,0,0,0,0,0,0,0,0,0,4,0,1,0,2,1,2,0,
+    0,0,4,0,1,0,1,0,2,1,2,2,2,0,1,0,2,0,2,1,0,0,0,0,0,0,2,0,0,1,2,0,
+    0,0,4,0,1,0,2,0,0,2,29,0,2,1,2,2,2,1,2,2,0,1,2,0,0,2,4,1,0,0,0,0,
+    4,0,0,0,2,0,0,0,4,0,0,1,1,2,0,1,2,0,2,0,2,0,2,0,0,0,2,0,2,0,0,0,
+    0,0,2,0,2,0,19,1,5,0,0,0,0,2,4,0,2,1,0,0,2,0,0,0,4,0,2,0,0,0,2,0,
+    2,1,1,2,4,0,2,0,0,1,0,0,0,2,1,1,4,0,2,2,2,0,2,0,17,0,0,1,0,2,2,1,
+    0,0,4,2,2,1,4,2,2,0,1,1,1,0,2,0,0,0,2,0,4,0,2,0,4,0,2,0,1,1,2,2,
+    13,0,4,0,4,0,2,0,4,0,4,0,1,1,3,0,0,0,1,0,0,0,1,0,4,2,2,0,0,1,0,0,
+    0,0,15,2,2,1,4,0,10,0,4,2,4,0,4,0,1,1,0,0,0,0,0,0,2,2,6,1,4,0,14,0,
+    7,0,5,0,11,0,1,0,10,0,4,0,2,2,4,0,5,0,1,0,10,1,8,0,1,0,15,0,6,0,4,0,
+    8,0,6,0,17,0,10,0,11,0,11,0,16,0,14,0,5,0,7,0,18,1,19,2,12,0,47,2,0,0,2,0,
+    0,0,2,0,0,0,0,2,2,0,0,1,0,2,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,0,0,
+    2,0,1,0,2,0,0,0,0,0,2,0,1,1,2,2,0,0,0,0,15,0,15,1,2,2,0,0,0,0,0,0,
+    2,1,0,0,0,0,2,0,0,0,0,0,2,1,2,2,1,0,2,0,0,0,0,2,2,1,0,0,2,0,1,0,
+    2,1,2,0,1,0,2,0,0,2,0,0,2,0,0,1,2,0,0,0,0,0,2,0,0,0,0,0,2,1,0,2,
+    2,0,1,0,2,0,0,0,0,0,2,0,0,1,2,2,0,1,0,0,0,0,0,0,9,0,23,1,0,2,2,0,
+    0,1,2,2,4,1,1,0,2,0,2,0,2,0,0,0,2,0,0,0,0,0,2,0,0,0,2,0,2,0,2,0,
+    0,0,0,1,2,0,2,0,1,0,0,1,0,0,2,0,2,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,
+    2,0,0,0,2,0,0,0,25,0,3,0,2,0,2,0,2,0,0,1,4,0,0,2,2,1,0,0,2,0,2,0,
+    0,0,2,0,2,1,2,2,0,0,4,0,0,1,0,0,0,0,0,0,2,2,0,1,4,0,0,0,2,0,0,1,
+    2,0,0,0,0,2,21,0,0,0,2,0,0,1,0,0,2,0,2,0,2,2,2,1,0,0,2,0,2,0,2,0,
+    1,0,2,0,0,0,0,0,4,0,2,0,0,1,2,2,1,0,0,0,4,0,0,1,17,2,2,0,4,1,0,2,
+    0,0,0,1,2,2,2,1,4,0,4,0,0,2,1,1,1,0,2,0,0,0,4,0,2,0,2,0,4,0,0,1,
+    15,0,0,0,4,0,4,0,4,0,2,0,4,2,2,0,3,0,1,0,2,0,0,0,1,1,0,0,2,0,2,2,
+    0,0,11,1,3,0,0,0,0,2,8,1,8,0,4,0,4,0,2,0,1,0,0,0,0,0,0,0,4,0,10,0,
+    10,0,1,0,9,0,5,0,9,0,6,2,6,1,2,0,4,0,1,0,1,0,2,0,8,0,4,1,17,2,8,0,
+    8,0,4,0,2,0,1,0,0,0,19,0,11,1,16,0,18,0,9,2,4,0,4,0,9,2,47,1,0,2,2,0,
+    2,0,0,0,0,0,2,0,0,0,0,2,0,1,2,2,0,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,
+    0,0,0,0,0,0,2,0,0,0,1,1,2,2,0,1,0,0,23,2,7,1,2,2,0,1,0,0,0,0,2,0,
+    0,0,2,0,0,0,0,0,2,0,0,0,2,0,1,0,2,2,0,0,0,1,2,0,0,0,2,0,0,0,2,1,
+    1,2,0,0,4,0,0,0,0,1,2,0,1,0,2,0,0,2,0,1,2,0,0,1,2,2,0,0,0,0,2,0,
+    1,0,2,0,0,0,2,0,0,1,0,0,2,2,1,1,2,0,0,2,0,1,11,0,19,0,0,0,2,0,1,1,
+    2,2,0,1,2,2,2,1,2,0,0,2,2,1,2,0,0,0,2,0,2,0,1,1,2,0,2,0,0,0,0,0,
+    4,0,0,2,2,1,0,0,2,0,1,0,0,0,2,0,0,0,0,1,0,0,2,0,0,0,2,0,0,0,2,0,
+    0,0,0,0,2,0,17,0,11,1,0,2,4,0,0,1,2,0,2,2,0,0,4,1,2,0,0,0,2,0,0,0,
+    2,0,0,0,2,0,0,1,2,0,0,0,4,0,2,0,2,0,1,2,0,1,0,0,2,0,2,0,2,0,2,0,
+    0,0,2,0,21,1,5,0,4,0,2,0,0,0,2,2,1,0,2,0,2,1,2,0,2,0,0,0,2,0,2,0,
+    2,0,2,1,1,0,2,2,0,0,2,0,2,0,2,0,0,0,0,1,1,2,19,0,2,1,6,2,2,0,2,1,
+    2,2,0,0,2,1,2,0,0,2,2,0,4,1,2,0,0,0,1,0,0,0,0,0,2,0,2,0,2,0,2,0,
+    7,0,0,0,1,0,0,0,4,0,4,0,4,0,4,0,2,1,0,2,3,0,0,0,0,0,0,0,0,0,0,1,
+    1,0,9,0,2,0,3,2,0,1,0,0,2,0,8,0,8,0,4,0,4,0,1,0,0,1,0,2,0,0,0,2,
+    8,0,6,0,6,1,9,0,5,2,7,1,0,0,6,0,4,0,4,0,10,1,15,0,3,0,10,2,10,0,15,0,
+    4,0,8,0,4,0,20,0,25,1,6,0,21,2,1,0,18,0,4,1,9,2,10,0,7,0,45,2,2,1,1,2,
+    0,0,2,2,0,0,0,0,2,1,0,0,2,2,0,1,0,0,2,0,0,2,0,0,0,1,0,2,2,0,0,0,
+    0,1,2,0,0,2,1,0,2,1,0,2,0,0,5,0,23,0,1,1,0,2,2,1,0,2,2,1,2,0,0,0,
+    0,0,0,0,2,0,0,0,0,0,2,1,0,2,0,0,2,0,0,0,0,2,2,1,0,0,0,0,0,0,0,0,
+    2,0,2,0,1,0,2,0,0,1,0,0,2,2,0,0,2,1,0,0,0,0,0,0,0,0,2,1,2,2,1,0,
+    2,1,2,0,0,0,1,2,2,0,2,0,0,1,2,0,0,0,0,0,15,0,17,0,0,0,2,0,0,1,2,2,
+    1,1,2,0,0,0,2,0,2,0,0,0,2,0,2,0,2,0,2,0,0,1,2,2,1,0,0,0,2,1,2,0,
+    0,0,2,0,0,0,2,0,0,0,2,0,0,1,0,0,0,0,0,2,2,1,0,0,2,0,1,0,2,1,0,0,
+    2,2,2,0,11,0,17,0,0,0,2,1,0,2,2,0,2,0,2,1,2,0,0,0,0,0,4,0,0,0,2,0,
+    2,0,0,0,2,0,2,0,2,0,2,0,0,0,2,0,0,0,4,1,1,0,0,0,0,0,2,0,0,0,2,0,
+    2,0,2,0,23,0,0,0,0,0,2,0,4,0,0,1,2,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,
+    2,0,2,0,2,0,0,1,0,2,1,0,2,0,2,0,2,0,2,0,0,1,25,2,1,0,4,1,6,2,6,0,
+    2,1,4,0,0,2,1,0,4,1,0,0,2,0,2,0,4,0,0,0,0,1,3,0,0,2,0,0,2,0,2,0,
+    13,1,8,0,4,0,1,0,1,0,2,0,4,0,4,0,6,2,4,1,2,0,3,0,0,0,0,2,0,0,0,0,
+    9,0,0,0,1,0,0,1,3,0,1,0,0,0,2,0,4,0,8,0,6,0,6,0,0,2,1,0,2,0,1,1,
+    1,0,8,0,8,2,6,0,1,1,11,0,3,0,3,0,2,0,4,1,10,2,10,0,11,0,13,0,4,0,12,0,
+    13,0,2,0,12,0,22,1,1,2,17,0,10,1,29,2,2,0,18,1,15,0,10,0,6,0,45,0,0,2,2,0,
+    0,0,0,0,2,0,0,0,0,2,2,0,0,1,0,2,2,0,0,0,0,1,0,0,0,2,2,1,0,2,0,1,
+    0,2,0,0,2,1,0,2,0,0,2,0,13,1,19,0,0,0,2,2,2,1,1,0,2,0,0,2,0,1,2,0,
+    0,0,2,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,2,0,1,2,0,0,0,
+    2,0,1,1,2,0,0,0,2,2,0,0,2,1,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,2,1,
+    0,2,1,0,2,0,2,1,1,0,2,0,0,0,0,2,0,0,17,1,13,0,0,0,2,1,0,2,2,0,0,1,
+    2,0,0,2,0,1,2,2,0,1,2,0,0,2,2,1,0,0,2,1,2,2,0,0,2,1,2,0,1,2,2,1,
+    0,0,2,0,2,0,0,0,2,0,2,1,0,2,0,0,0,1,2,0,0,2,0,1,0,0,2,0,1,0,2,2,
+    0,1,5,0,23,0,0,0,4,0,2,0,0,1,2,0,0,0,2,0,2,0,0,0,4,0,1,0,4,0,2,1,
+    0,0,2,0,0,0,2,0,0,0,2,0,0,0,2,0,2,0,0,0,4,0,2,0,1,0,0,0,0,0,2,0,
+    2,0,21,0,1,0,4,0,0,1,0,0,0,0,4,0,2,0,0,0,2,0,0,0,0,0,2,0,2,0,2,0,
+    2,0,0,0,2,2,2,0,0,1,2,0,0,0,1,0,2,0,2,0,7,0,9,0,0,0,3,0,0,1,2,2,
+    8,0,2,0,4,1,4,0,1,0,2,0,0,0,0,0,2,0,4,0,0,0,2,0,0,1,1,0,0,0,17,0,
+    2,2,2,0,6,0,8,0,4,0,1,0,1,0,2,0,2,0,4,0,4,0,4,0,0,0,3,1,1,0,0,0,
+    3,0,2,0,1,0,2,0,1,0,3,0,5,0,1,0,0,0,2,0,6,0,8,0,6,0,2,0,1,0,1,0,
+    2,0,1,0,4,0,8,0,6,0,4,0,9,1,7,0,0,0,0,2,2,0,8,0,10,0,3,1,15,0,0,0,
+    12,0,9,0,0,0,20,2,14,1,9,0,7,2,10,1,31,0,4,2,14,0,11,0,16,2,43,0,0,1,0,0,
+    2,2,0,0,0,0,2,0,0,0,0,0,0,2,2,1,0,0,0,0,0,2,0,0,2,0,0,0,0,1,0,2,
+    0,0,2,0,0,0,0,1,0,2,21,1,9,2,2,0,0,0,2,1,0,0,0,2,2,1,0,0,0,2,0,1,
+    2,0,0,0,0,0,2,1,0,2,0,0,2,0,0,0,0,2,2,0,0,1,0,0,2,1,0,2,0,1,2,2,
+    0,1,0,2,0,0,2,1,0,0,2,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,2,0,0,1,0,2,
+    2,0,0,0,0,0,0,0,2,0,1,0,2,0,2,1,21,0,9,0,0,0,2,0,0,0,0,1,2,0,0,0,
+    0,2,0,1,2,0,1,0,2,0,2,0,2,0,0,0,2,0,0,0,2,0,2,1,2,2,1,1,2,0,0,2,
+    2,1,0,0,0,0,2,0,2,1,0,2,2,0,0,1,2,2,1,1,2,0,0,0,0,0,2,0,0,2,0,1,
+    1,0,29,0,0,0,2,0,2,0,2,0,2,0,2,0,2,0,0,0,0,0,4,1,0,0,2,0,0,0,2,0,
+    2,0,2,0,2,0,0,0,0,0,0,0,4,0,0,0,2,1,2,0,0,0,2,0,2,0,0,1,0,0,1,0,
+    1,0,23,0,4,0,4,0,2,2,4,0,0,0,0,1,0,0,4,0,2,0,0,0,0,0,0,0,2,0,2,0,
+    2,2,2,0,2,1,0,0,2,0,0,0,2,2,0,1,0,0,1,0,21,0,2,1,2,2,4,0,0,0,3,1,
+    0,0,6,0,4,2,2,0,4,0,2,0,0,0,2,0,2,0,0,1,2,0,2,0,2,0,0,0,1,0,17,0,
+    2,0,0,0,4,0,2,0,6,0,6,0,0,0,1,0,0,0,4,0,2,0,4,0,2,0,4,0,0,0,1,0,
+    9,0,1,1,6,0,2,0,0,0,0,0,1,0,5,1,3,0,3,0,0,0,4,2,6,0,6,0,6,0,1,0,
+    3,0,4,0,1,0,4,0,6,0,6,0,4,0,3,0,11,0,2,0,2,0,0,0,8,0,12,0,2,0,15,0,
+    9,0,10,0,7,1,2,0,18,2,16,0,17,0,2,0,4,1,23,0,12,0,0,0,0,0,43,0,0,2,2,0,
+    0,1,0,0,2,2,0,0,0,0,0,0,2,0,0,2,0,0,0,0,0,1,2,0,0,0,0,0,0,2,2,1,
+    0,0,0,0,0,0,0,0,25,0,3,2,0,1,0,0,2,0,0,0,0,2,2,1,0,0,0,0,2,0,0,0,
+    0,0,2,0,2,0,0,0,0,1,0,0,0,2,2,2,0,1,2,0,0,0,0,0,0,0,0,0,2,0,0,1,
+    0,2,2,0,0,1,0,2,2,0,0,1,0,0,2,0,0,0,2,0,1,0,2,0,0,0,0,0,2,0,0,0,
+    0,0,2,0,0,1,0,0,2,0,0,0,0,0,25,0,5,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,
+    2,1,2,0,1,2,2,1,0,2,0,1,0,0,2,0,2,1,2,2,0,1,2,2,0,1,4,2,0,1,0,0,
+    0,0,0,0,2,0,0,0,2,0,0,0,2,1,0,0,0,0,4,0,1,0,2,0,0,0,0,0,2,0,0,0,
+    33,0,0,0,0,0,4,0,2,0,2,1,2,0,0,0,2,0,2,0,0,0,0,2,2,0,4,1,0,0,0,0,
+    0,0,2,0,2,0,2,1,2,0,2,0,1,0,2,0,0,2,2,1,2,0,0,0,2,0,2,2,2,1,0,0,
+    29,0,0,0,0,0,4,0,4,1,2,0,4,0,2,2,2,0,0,0,0,0,4,0,2,0,1,0,0,0,0,0,
+    2,1,2,0,0,0,2,0,2,2,2,0,0,1,4,0,1,0,2,0,21,0,1,0,4,1,2,0,0,2,4,0,
+    1,0,1,0,2,1,4,0,4,0,2,0,4,0,2,0,1,0,2,0,2,0,2,0,0,0,4,0,0,0,17,1,
+    3,0,2,0,0,0,2,2,2,0,4,0,6,0,4,0,0,0,1,0,0,0,6,0,2,0,4,0,4,0,0,1,
+    1,0,0,2,5,0,0,0,4,1,2,0,2,0,1,0,5,0,3,0,3,0,3,1,0,2,6,0,4,0,2,0,
+    8,0,3,0,2,0,1,0,2,0,8,0,8,0,4,0,0,0,15,0,0,0,6,1,0,0,2,2,10,0,4,0,
+    5,0,7,1,2,2,9,0,4,0,16,0,14,1,19,0,10,2,5,0,1,0,4,0,9,0,43,0,2,0,0,0,
+    0,2,2,0,0,1,0,2,0,0,2,0,0,0,0,0,0,0,2,0,0,2,0,1,0,0,2,2,0,1,0,2,
+    0,1,0,0,7,2,23,0,2,1,0,0,0,2,2,1,0,0,0,0,2,0,0,0,0,0,2,0,0,1,2,2,
+    0,0,0,0,0,0,0,0,2,0,2,0,0,0,0,0,2,0,1,0,2,0,0,0,2,0,0,1,0,2,0,0,
+    0,0,2,1,2,2,0,1,0,0,0,0,0,0,2,0,2,0,1,0,2,0,0,0,2,1,1,2,0,0,2,0,
+    0,0,2,1,0,2,0,0,0,0,2,1,29,0,3,0,2,0,0,0,2,0,2,1,2,0,0,0,1,0,2,0,
+    2,2,0,0,2,1,0,0,0,0,0,0,0,1,0,2,2,0,0,0,2,0,2,1,2,2,0,1,2,0,0,0,
+    0,0,2,0,0,0,2,1,1,2,2,1,2,0,2,2,2,1,1,2,2,1,0,2,2,0,0,0,0,1,29,0,
+    1,0,0,0,2,0,1,1,2,0,2,2,2,0,2,0,2,1,2,0,2,0,2,0,0,1,0,2,2,0,2,0,
+    0,0,2,1,0,0,2,2,0,0,2,1,2,0,0,0,0,0,0,0,2,0,2,0,0,0,2,1,2,2,7,0,
+    15,0,1,1,2,0,1,0,4,2,2,0,4,0,2,0,2,0,2,1,0,0,2,0,0,0,4,0,2,0,0,0,
+    3,0,2,0,2,2,2,0,2,1,2,0,2,0,0,0,2,0,13,0,5,0,2,0,0,0,1,0,6,1,2,0,
+    2,0,1,0,1,0,0,0,2,0,6,0,2,0,2,0,2,0,2,0,0,0,2,0,2,0,0,0,2,0,9,0,
+    0,0,3,0,3,0,2,1,1,0,2,0,4,0,4,0,6,0,2,0,0,0,1,0,2,0,4,0,2,0,6,2,
+    2,0,0,0,1,1,1,0,3,2,4,1,2,0,2,2,2,0,1,0,7,1,5,0,1,1,1,2,13,0,4,0,
+    12,0,8,0,2,0,2,0,1,1,0,0,4,2,10,0,6,0,4,1,9,0,11,2,6,0,4,0,0,0,10,1,
+    4,0,7,2,3,1,14,0,19,0,12,0,14,2,6,0,19,0,14,0,13,0,10,1,13,0,43,0,2,0,0,2,
+    2,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,2,0,0,2,0,0,0,1,0,0,0,0,
+    2,2,15,0,15,1,0,0,0,0,2,0,2,0,1,2,2,1,0,0,0,0,2,0,0,0,0,0,2,0,0,0,
+    2,0,0,1,0,0,2,0,0,0,0,2,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,1,2,2,
+    0,1,0,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,2,0,0,0,0,0,0,0,0,0,2,0,
+    0,1,0,2,0,1,2,0,1,0,31,2,2,1,0,0,0,0,2,0,0,1,2,2,0,0,2,0,2,0,0,0,
+    0,1,0,0,2,0,0,2,0,1,2,0,0,0,2,0,1,0,2,1,0,0,2,2,0,1,2,0,2,2,0,1,
+    2,0,0,1,0,2,0,0,4,1,0,2,0,0,2,1,0,0,2,0,0,2,2,0,0,1,0,0,25,2,5,1,
+    2,0,0,0,0,1,2,2,1,0,2,0,2,1,4,0,0,2,2,1,2,0,0,0,2,0,0,0,2,0,0,0,
+    4,1,0,2,0,0,0,1,4,0,0,2,2,1,2,0,0,0,2,0,1,0,2,0,2,0,0,0,2,0,27,0,
+    2,1,4,2,0,0,0,0,0,0,2,1,0,0,4,0,2,0,4,2,2,0,0,0,0,0,2,0,2,0,2,0,
+    2,0,1,0,2,1,0,0,0,0,2,0,2,0,2,0,2,0,19,0,4,0,2,0,0,0,2,0,1,0,1,0,
+    4,0,4,0,2,0,0,1,3,0,0,0,4,0,2,0,4,0,2,2,2,1,0,0,0,0,2,0,3,0,3,2,
+    4,1,2,0,1,0,5,0,0,0,1,0,0,0,2,0,2,0,4,0,6,0,0,0,0,0,0,0,2,0,2,1,
+    1,0,8,0,4,2,1,1,2,0,3,2,0,0,2,1,2,0,2,0,2,2,1,0,5,0,3,1,15,0,2,0,
+    4,0,6,0,6,0,2,1,0,2,0,0,1,0,2,0,8,1,6,2,22,0,15,0,17,0,4,1,4,0,0,2,
+    6,1,4,0,3,2,8,0,6,0,19,0,12,0,14,1,0,0,5,0,0,0,11,2,0,0,41,0,0,2,2,1,
+    0,0,0,0,2,2,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,2,0,1,
+    21,0,7,0,0,0,2,0,0,2,2,1,1,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,
+    2,1,0,2,2,0,0,0,0,0,0,2,2,1,2,0,0,0,1,0,2,0,0,0,0,0,2,0,0,0,0,1,
+    2,0,0,2,2,1,1,2,2,1,0,0,2,0,0,0,0,0,2,0,1,0,2,0,0,0,2,1,0,2,1,1,
+    2,2,0,1,2,2,7,0,25,1,2,0,0,0,2,0,0,0,0,1,2,2,0,0,4,0,0,1,0,0,2,0,
+    0,2,0,0,0,0,2,1,2,0,0,0,0,0,0,1,2,2,0,0,0,0,0,1,2,0,0,2,0,1,4,0,
+    0,0,2,0,0,1,0,2,0,0,2,1,0,0,0,2,2,0,2,0,2,1,0,0,0,2,19,1,9,0,1,0,
+    2,0,2,0,2,0,0,0,2,1,1,0,2,2,0,1,2,0,2,2,2,1,2,0,0,0,2,0,0,0,2,1,
+    0,2,2,0,2,1,0,2,0,1,2,0,2,2,0,1,4,0,0,0,2,0,1,0,0,1,2,2,21,0,5,1,
+    4,2,2,0,4,0,2,1,1,0,0,2,2,0,0,0,4,1,2,0,2,0,2,0,4,0,0,0,0,0,2,0,
+    2,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,4,0,21,0,4,0,2,0,2,0,2,0,2,0,4,0,
+    3,1,0,0,2,0,2,2,4,0,3,1,1,0,4,0,2,0,2,0,2,0,2,0,0,0,2,0,15,0,2,0,
+    4,2,4,1,4,0,2,0,1,0,1,0,1,0,1,0,2,0,2,0,0,0,4,1,4,0,0,0,0,0,0,2,
+    7,1,4,0,8,0,6,0,0,0,1,0,0,0,0,2,4,0,2,0,0,1,4,0,1,0,3,0,7,0,3,0,
+    7,0,6,0,6,1,4,2,4,0,1,0,2,1,3,0,1,2,8,0,12,0,10,1,7,0,19,2,4,1,2,0,
+    0,2,8,0,4,0,8,0,2,0,0,1,13,0,6,2,16,0,7,0,0,1,13,0,10,1,39,2,0,0,0,0,
+    0,0,2,2,1,1,2,0,2,0,0,2,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,1,0,23,0,
+    3,0,0,0,0,0,2,0,0,0,0,0,2,0,2,1,1,2,2,0,0,1,0,2,2,0,0,1,0,2,2,1,
+    0,2,2,0,0,1,0,0,0,2,2,0,0,0,0,0,0,0,2,1,0,0,2,0,0,0,0,0,2,0,0,0,
+    0,2,0,1,0,0,2,0,0,0,0,0,0,0,2,0,2,0,1,0,2,1,0,2,0,0,0,0,2,0,0,0,
+    0,1,0,2,9,1,19,0,1,0,2,0,0,0,2,0,0,0,2,0,0,0,2,1,0,0,2,2,2,0,0,0,
+    0,1,2,0,0,0,2,0,0,0,0,0,2,0,0,0,0,1,0,0,2,0,0,0,0,2,2,1,2,0,0,0,
+    2,0,0,0,2,0,0,1,0,0,0,0,0,2,2,1,0,2,0,1,2,2,0,1,11,0,17,0,0,0,4,0,
+    0,0,0,1,2,2,0,0,2,0,2,0,1,1,0,2,4,1,0,0,2,0,2,0,2,2,2,1,2,0,0,0,
+    2,0,0,1,0,2,2,1,2,2,1,1,0,0,2,0,2,0,0,2,2,1,2,0,2,0,5,0,25,0,2,0,
+    2,0,2,0,2,1,4,2,4,0,0,0,0,1,2,0,0,2,0,0,4,0,4,0,0,0,2,0,2,0,0,0,
+    2,0,2,0,2,0,0,0,0,0,0,0,0,0,2,0,21,1,2,0,2,0,2,0,4,0,2,0,0,0,2,1,
+    4,2,0,0,0,1,0,0,0,0,2,2,2,1,3,0,2,0,2,0,4,0,2,0,2,0,0,0,13,0,2,0,
+    0,1,2,2,4,0,4,0,2,0,0,0,1,0,1,1,0,0,1,0,2,0,2,2,2,0,2,1,2,0,0,0,
+    11,2,4,1,4,0,8,2,6,0,4,0,1,1,0,0,1,0,0,0,6,2,1,0,2,1,0,0,0,0,9,0,
+    0,0,5,1,3,2,8,0,4,1,6,0,3,2,2,0,1,0,3,1,6,0,10,2,10,1,3,0,19,2,2,1,
+    8,0,1,0,6,0,12,0,5,0,6,2,9,1,2,0,2,0,6,0,3,0,1,0,2,0,39,0,0,0,0,0,
+    2,2,0,1,2,2,0,0,1,0,2,0,0,1,2,0,0,2,1,0,2,0,2,0,0,0,11,0,19,0,0,0,
+    2,0,0,0,2,0,1,0,2,0,2,0,0,0,1,0,4,0,1,0,2,0,2,1,1,2,2,0,2,1,1,2,
+    2,1,0,0,0,2,2,0,0,0,0,0,2,0,0,0,2,1,0,2,0,0,0,0,0,0,2,0,0,0,0,0,
+    0,1,2,0,0,0,0,0,0,0,0,2,2,1,0,0,0,0,2,1,2,2,0,1,0,2,2,0,1,1,2,0,
+    0,2,15,1,17,2,0,1,2,0,2,0,0,0,0,0,2,1,2,2,0,1,0,2,2,0,0,0,2,0,0,1,
+    2,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,2,1,0,0,0,0,2,0,
+    0,0,2,0,2,0,2,0,0,0,0,0,0,0,0,0,2,0,0,0,0,1,7,2,23,1,4,2,2,1,0,2,
+    2,1,2,0,0,0,2,1,0,2,0,1,2,2,2,1,1,2,2,1,2,2,2,1,2,0,0,0,2,0,0,0,
+    0,1,2,2,2,1,2,2,0,1,2,2,0,1,0,2,0,1,2,0,2,0,0,0,0,0,27,0,2,1,0,2,
+    2,0,2,0,2,0,2,0,2,0,4,1,0,2,0,0,0,0,2,0,2,0,0,0,4,0,2,0,2,0,2,0,
+    0,0,0,0,2,1,2,0,2,0,0,0,0,0,0,0,23,2,4,1,2,0,2,0,2,0,2,1,4,0,0,2,
+    0,0,4,1,2,2,0,1,0,0,2,0,0,0,0,0,0,0,1,0,0,0,2,0,4,0,4,0,13,0,0,0,
+    2,2,2,1,2,0,2,0,2,0,4,0,2,1,0,2,3,0,0,0,1,1,0,0,2,0,2,2,2,1,2,0,
+    9,0,0,2,2,1,0,0,6,0,8,0,6,2,0,0,1,0,2,1,3,0,6,0,2,2,2,1,8,0,3,0,
+    11,1,5,2,2,0,5,1,4,2,2,0,6,0,1,1,4,0,0,2,7,0,8,1,8,2,6,1,1,0,13,2,
+    0,0,8,0,0,0,18,0,7,1,9,0,10,2,13,0,12,1,1,0,5,2,10,1,13,0,39,0,0,1,2,2,
+    0,0,0,0,0,0,2,0,0,2,0,1,0,2,2,0,0,1,2,2,1,0,0,0,15,0,13,0,0,1,0,2,
+    2,0,0,0,0,0,2,0,2,1,1,2,2,1,2,2,1,0,2,0,0,0,0,0,2,1,0,0,0,2,2,1,
+    0,2,0,1,2,0,0,2,2,0,0,1,0,2,0,1,0,2,0,0,2,0,0,1,2,0,0,0,0,0,2,0,
+    0,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,0,1,0,2,0,0,2,0,0,1,0,2,2,0,1,0,
+    19,1,11,2,0,1,2,0,2,2,0,1,2,0,0,0,2,0,0,1,2,2,0,0,0,1,2,0,0,0,2,2,
+    2,0,0,1,2,0,0,0,1,0,2,0,0,0,2,1,2,0,1,0,2,0,0,0,0,0,2,0,0,0,0,0,
+    2,0,2,0,0,0,2,0,0,0,2,0,0,1,0,2,0,1,2,2,3,0,27,1,2,2,0,1,2,0,2,0,
+    2,0,0,0,2,0,2,0,0,1,2,2,0,1,0,2,0,1,0,0,0,0,2,0,2,0,2,0,2,1,2,2,
+    2,0,0,1,0,2,0,1,2,2,2,1,2,2,0,1,0,0,0,0,0,0,2,0,15,0,9,0,2,2,2,1,
+    1,0,2,1,0,2,2,0,2,1,2,2,4,0,2,0,2,0,1,0,0,0,2,0,2,0,2,0,2,1,2,0,
+    2,0,2,0,1,2,4,0,2,1,0,0,2,0,11,0,11,1,0,2,2,0,4,0,2,1,2,2,0,0,2,1,
+    4,0,0,2,0,1,4,2,2,1,0,0,0,2,2,1,1,0,2,0,1,0,0,0,0,0,2,0,11,0,6,0,
+    2,1,0,2,0,0,4,0,2,0,4,1,0,2,4,0,1,1,1,0,0,2,0,1,1,0,0,0,2,0,2,0,
+    7,0,2,0,0,2,2,0,0,1,2,0,6,0,6,0,4,0,1,2,2,1,1,0,2,0,2,2,6,1,6,0,
+    0,0,11,0,5,1,1,2,1,0,2,1,2,0,4,2,1,0,4,1,4,0,9,0,6,0,10,2,8,0,3,0,
+    15,0,1,1,8,0,8,0,12,0,13,0,0,0,6,0,19,0,10,0,2,1,0,2,5,1,39,2,2,0,0,0,
+    0,0,0,0,2,0,0,0,2,0,0,2,0,0,0,0,0,0,0,0,2,1,23,0,7,0,2,2,0,0,0,0,
+    0,0,2,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,0,1,2,0,0,0,2,2,0,0,0,1,2,2,
+    1,1,2,2,0,1,0,2,0,0,2,0,0,0,2,0,0,0,2,1,1,0,2,2,0,0,2,1,0,0,0,0,
+    2,0,1,0,0,0,2,0,0,0,2,1,1,2,2,1,0,2,2,0,0,0,0,0,2,0,0,1,0,0,23,0,
+    7,2,0,1,0,0,0,0,2,0,0,0,2,0,2,1,0,2,0,0,2,0,0,1,0,2,2,0,0,1,2,0,
+    0,0,2,2,0,1,2,0,0,0,0,0,2,1,0,2,0,0,4,0,1,1,2,0,2,0,1,0,2,0,0,0,
+    2,0,0,1,2,0,0,2,2,0,0,0,2,0,0,0,0,0,0,1,31,0,2,2,2,1,2,0,0,2,2,1,
+    0,0,4,0,0,0,0,0,2,0,0,1,2,2,2,1,0,0,0,2,0,1,0,0,0,0,2,0,0,0,4,0,
+    0,0,2,0,2,1,0,2,0,1,0,2,2,1,2,0,0,2,2,1,0,0,1,0,27,2,2,1,4,0,2,0,
+    2,0,0,0,2,0,0,0,0,0,2,0,2,0,2,0,2,0,4,0,0,0,1,1,2,0,2,0,0,2,2,0,
+    4,0,0,1,2,0,0,0,0,2,2,1,2,0,19,0,2,0,1,0,0,0,0,1,2,2,4,0,4,1,2,2,
+    0,1,2,0,2,0,1,0,2,0,4,0,0,0,2,0,2,0,0,0,0,2,0,1,1,0,25,0,4,0,6,0,
+    6,0,6,0,2,0,1,0,4,1,2,2,4,0,2,1,4,2,0,1,0,0,3,2,0,1,0,0,1,0,9,0,
+    5,0,4,0,6,0,0,0,4,2,2,0,0,0,4,1,6,0,4,0,0,0,1,0,0,0,2,1,2,2,4,1,
+    4,2,8,1,9,2,9,1,3,0,0,2,4,0,2,1,4,0,3,2,0,1,10,2,7,0,6,0,10,0,6,1,
+    1,0,11,2,5,1,6,0,0,0,18,0,19,0,2,1,1,2,3,0,8,0,7,0,12,0,37,1,0,2,0,0,
+    2,0,0,0,0,0,0,2,0,1,2,0,0,0,0,0,2,2,3,1,25,2,0,0,0,0,0,1,0,2,2,0,
+    0,1,2,0,0,0,0,0,0,2,0,1,2,2,0,1,2,0,0,2,0,0,0,0,2,1,0,0,2,2,1,1,
+    2,0,0,0,2,2,0,1,2,2,0,0,0,1,0,2,2,1,1,2,2,1,0,0,2,0,0,2,0,1,0,0,
+    0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,27,0,1,0,
+    0,1,0,0,2,0,0,0,0,1,2,2,0,0,0,0,2,1,2,2,0,1,2,2,2,0,1,1,2,2,2,1,
+    0,0,2,0,2,0,0,0,2,0,0,1,1,2,2,0,0,1,0,0,2,2,2,0,1,1,2,0,0,0,2,0,
+    0,1,0,2,0,0,2,0,0,0,2,0,2,0,0,1,0,2,33,0,2,0,4,1,0,0,2,2,2,1,2,0,
+    2,0,0,0,0,1,2,2,2,0,2,0,0,1,0,2,2,0,2,1,1,0,0,0,0,0,0,0,2,0,0,1,
+    2,0,2,2,0,0,2,1,0,2,2,1,0,0,0,2,2,1,2,0,0,2,29,1,2,0,0,0,2,0,2,0,
+    4,0,2,0,0,0,2,0,0,2,0,1,2,0,2,0,2,0,2,0,2,1,2,2,1,0,0,0,2,0,2,1,
+    0,0,4,2,2,1,0,0,2,0,0,0,0,0,19,0,2,0,4,0,0,1,1,2,0,1,2,0,0,0,4,0,
+    2,2,2,1,2,2,2,1,2,2,1,1,4,0,2,2,0,1,0,0,2,0,0,0,2,0,19,0,3,0,0,1,
+    2,2,6,0,6,0,4,1,0,2,0,0,4,1,2,2,4,1,4,2,0,1,2,0,3,0,1,0,0,2,11,0,
+    1,1,0,0,0,0,4,0,0,0,2,0,4,0,2,0,2,0,6,0,4,0,2,0,0,1,1,2,3,1,2,2,
+    8,1,2,2,8,0,0,0,9,0,5,1,3,0,4,2,2,1,2,0,1,2,1,1,12,0,3,0,2,0,8,2,
+    6,1,3,0,9,0,4,0,6,2,0,1,6,0,21,0,2,0,5,1,10,2,4,0,4,1,37,2,0,0,2,0,
+    0,1,2,2,0,0,0,0,0,0,0,0,2,0,1,0,9,0,19,2,0,1,0,0,2,2,0,0,2,1,0,0,
+    2,2,1,0,2,0,0,0,2,1,0,2,0,1,2,2,0,0,0,1,0,0,2,0,0,0,2,2,1,1,2,0,
+    2,0,0,0,0,2,0,0,0,1,2,2,0,0,2,1,1,2,2,1,2,2,0,1,0,0,0,0,2,2,0,1,
+    0,0,0,0,2,0,0,1,0,2,0,0,0,1,0,2,0,0,2,0,0,1,0,0,1,0,27,0,0,0,2,0,
+    0,0,2,0,0,0,0,0,0,0,0,1,2,2,2,0,0,0,0,0,2,0,2,0,0,1,2,2,0,1,0,2,
+    2,1,0,0,0,0,2,0,0,1,2,2,2,0,1,1,2,2,0,1,2,0,1,0,2,0,2,0,0,0,0,1,
+    0,2,0,0,2,2,0,1,2,0,0,0,0,0,4,0,27,1,1,0,1,0,0,2,4,0,0,1,4,0,0,0,
+    0,0,2,0,2,0,2,1,0,2,0,0,2,0,0,1,2,0,0,0,4,0,0,0,0,1,0,2,0,0,0,0,
+    2,0,0,1,4,2,0,0,2,1,0,0,0,2,2,1,0,0,1,2,15,1,9,0,0,0,2,0,0,0,2,0,
+    2,0,2,2,4,1,0,0,2,0,2,2,0,1,0,0,2,0,0,0,2,0,4,0,2,0,0,1,0,0,0,2,
+    2,1,0,0,2,2,2,1,2,0,2,0,23,0,0,1,2,2,4,1,0,2,4,1,1,2,1,1,2,2,2,1,
+    2,0,4,0,2,0,2,0,2,0,0,2,0,1,0,0,2,0,2,0,2,0,2,2,0,1,17,0,2,0,3,0,
+    0,0,1,0,4,1,6,2,4,0,2,1,0,2,2,1,4,2,2,1,4,2,2,1,2,2,0,0,1,1,13,0,
+    2,2,0,0,1,1,0,0,2,0,1,0,0,1,4,2,2,0,0,1,6,2,6,0,2,0,0,1,1,2,0,1,
+    0,2,6,0,2,1,4,2,4,1,7,2,3,1,7,0,2,2,6,1,6,0,1,2,5,0,8,0,3,1,6,0,
+    6,0,2,0,5,0,0,0,0,0,6,0,6,1,3,2,9,0,2,0,1,0,4,0,1,1,35,0,0,0,0,2,
+    0,0,0,0,0,0,2,0,0,0,0,0,0,0,13,2,15,1,0,0,2,2,2,0,1,1,2,0,0,2,2,0,
+    0,1,2,0,0,0,0,2,0,0,2,1,0,2,0,1,0,0,2,2,0,0,2,0,0,0,0,1,2,0,0,0,
+    1,2,2,0,0,0,2,0,2,0,1,1,2,0,0,2,2,1,0,2,1,1,2,2,0,1,0,0,2,0,0,0,
+    0,0,2,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,1,0,2,7,0,23,0,0,0,2,1,0,0,
+    2,0,2,0,0,0,2,0,0,0,2,0,0,1,0,2,0,0,2,1,0,2,0,1,2,2,2,1,0,0,0,0,
+    2,0,0,0,2,0,0,0,2,0,0,0,0,1,2,2,0,1,0,2,0,1,2,0,2,0,1,0,2,0,0,0,
+    0,0,2,0,0,1,0,2,2,0,2,0,0,0,23,0,5,0,2,0,2,0,0,1,1,0,4,0,0,0,2,0,
+    2,0,0,0,4,0,0,0,0,1,2,0,2,0,0,0,2,2,0,0,2,0,0,0,2,1,0,1,1,2,2,0,
+    0,0,2,0,0,1,2,2,0,0,2,0,2,1,0,0,0,2,1,1,25,0,0,2,2,1,2,0,2,0,0,2,
+    0,1,2,0,2,2,2,1,2,0,0,0,2,0,0,0,0,0,4,1,0,2,2,0,2,1,2,2,0,1,0,0,
+    0,2,2,1,2,0,2,0,0,0,2,0,23,0,0,0,2,1,2,2,4,1,2,2,4,1,0,2,1,1,0,0,
+    2,0,0,0,2,0,4,2,0,1,6,0,0,0,2,0,1,2,2,1,2,0,0,0,7,0,5,0,0,0,2,0,
+    1,0,0,1,1,2,2,1,4,0,4,0,2,0,0,0,0,0,4,0,4,0,2,2,4,0,2,1,0,2,9,0,
+    1,1,1,0,2,0,0,0,1,0,2,1,0,2,3,0,2,1,6,2,1,1,4,0,6,0,4,2,3,1,0,2,
+    2,0,0,1,4,2,4,1,2,2,4,1,5,2,0,1,7,0,1,2,2,0,8,1,0,0,7,0,8,0,5,0,
+    6,0,10,0,4,0,9,0,5,1,2,2,6,0,16,0,1,0,3,0,17,0,10,1,0,1,37,0,2,2,0,1,
+    2,2,0,0,0,0,0,0,2,0,0,0,23,2,7,1,2,2,0,1,2,0,1,0,2,0,2,2,0,1,0,0,
+    0,2,0,0,2,0,2,1,0,0,0,2,0,1,2,2,0,1,0,0,2,0,0,0,0,0,0,0,0,0,2,0,
+    2,0,0,0,0,0,0,0,0,0,2,2,0,0,0,1,0,0,2,0,2,0,0,0,0,0,0,0,0,0,0,0,
+    2,0,0,0,0,0,2,0,0,1,0,0,0,2,0,0,2,1,1,2,11,0,19,1,0,0,4,0,0,2,2,0,
+    0,1,0,0,2,0,0,0,0,0,0,0,2,0,2,1,2,2,0,0,0,1,2,2,1,1,0,0,4,2,0,1,
+    0,0,2,0,0,0,0,0,2,0,2,1,0,2,0,1,2,2,0,1,0,2,2,1,1,2,2,1,0,0,2,2,
+    0,0,0,0,0,0,2,3,0,0,0,0,19,0,9,0,2,0,2,0,2,0,0,0,2,0,1,0,2,0,2,0,
+    2,0,2,0,0,0,2,0,2,0,2,0,1,0,4,0,0,1,2,0,1,0,2,0,2,0,0,2,2,1,0,0,
+    1,0,2,0,0,0,2,1,2,0,0,0,2,2,0,0,2,1,27,0,0,2,2,1,0,0,2,2,0,1,2,0,
+    2,2,0,1,0,0,2,2,4,1,2,0,0,0,2,0,2,0,1,0,2,0,0,1,0,2,2,1,4,2,2,1,
+    0,0,1,0,0,0,2,0,2,0,17,0,3,1,4,2,2,0,1,1,2,2,2,1,2,2,4,1,2,0,1,2,
+    1,1,2,2,2,1,0,0,4,0,0,0,4,2,2,1,4,0,1,2,0,1,0,0,17,0,4,0,2,1,0,2,
+    2,1,0,2,1,1,0,2,0,1,2,2,4,1,4,2,2,1,1,2,2,0,4,1,4,0,2,2,4,1,3,0,
+    3,0,1,0,1,0,1,0,4,0,1,0,2,0,0,1,3,2,1,1,8,2,0,1,0,2,6,1,1,2,2,0,
+    1,1,2,2,0,1,6,2,4,1,4,2,4,1,3,2,0,1,5,0,9,0,2,2,10,1,0,0,7,0,6,0,
+    5,0,6,0,10,0,12,0,17,0,5,0,8,0,12,0,8,0,7,0,4,0,13,0,3,1,33,2,0,1,0,2,
+    1,1,2,2,2,0,0,0,5,0,23,0,0,0,0,0,0,0,2,0,0,0,2,0,0,2,0,1,2,2,0,1,
+    0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,
+    0,0,0,2,2,0,2,0,0,0,0,1,0,0,2,0,0,2,0,1,0,0,0,0,2,0,0,0,0,1,2,2,
+    0,0,0,0,2,0,1,0,2,0,0,0,0,0,2,1,0,2,19,1,13,0,2,2,2,1,1,0,2,0,2,0,
+    2,0,0,0,2,0,0,0,2,0,0,0,1,0,2,0,0,1,2,2,0,0,0,1,2,0,2,2,0,1,0,0,
+    2,0,0,0,0,0,2,1,0,2,0,0,4,1,0,2,0,1,0,0,2,0,1,0,2,0,2,0,0,0,0,0,
+    2,0,0,0,2,0,1,0,0,0,21,0,9,0,2,0,0,0,4,0,2,0,2,1,0,0,2,0,1,0,2,0,
+    2,0,2,0,2,0,0,0,2,0,0,0,4,1,0,0,0,0,0,0,2,0,2,0,0,2,2,1,0,0,0,0,
+    4,0,3,0,0,0,2,0,2,0,2,0,0,1,2,2,15,0,11,0,2,1,2,0,2,2,0,0,0,0,0,0,
+    2,1,0,2,2,1,2,0,0,0,2,0,4,0,0,0,0,1,2,2,0,1,0,2,2,1,2,2,0,1,2,2,
+    2,1,2,0,0,0,1,0,2,1,25,2,4,0,4,1,2,2,2,0,0,1,0,2,4,1,2,0,2,2,2,1,
+    2,2,3,1,1,2,4,1,0,2,2,1,2,0,0,2,4,1,2,0,2,0,0,0,19,0,2,0,2,0,4,1,
+    2,2,0,1,2,0,3,0,1,0,0,0,2,0,4,0,2,2,4,1,0,0,0,2,2,1,4,0,4,2,7,1,
+    6,2,0,1,3,2,2,1,1,0,2,0,1,1,2,2,2,1,1,2,7,1,4,2,4,1,0,2,9,1,10,0,
+    6,0,1,0,2,2,0,1,6,2,4,1,2,2,4,1,3,2,0,0,3,1,9,0,1,0,8,0,2,0,3,1,
+    4,2,3,0,6,0,8,0,18,0,17,0,9,0,10,0,12,1,0,2,2,1,7,2,0,1,35,0,0,0,2,0,
+    2,2,1,1,0,2,9,1,17,2,1,0,2,0,0,0,2,0,0,0,0,0,0,2,2,1,0,0,0,0,2,0,
+    0,0,0,0,2,0,0,0,2,2,1,1,2,0,0,0,2,2,0,1,0,0,2,0,0,0,0,0,2,0,0,0,
+    0,0,2,0,0,0,0,0,0,0,0,0,2,0,0,2,2,1,0,0,0,0,0,0,0,0,2,0,0,0,0,0,
+    0,0,2,0,0,0,2,0,0,0,0,0,0,1,0,2,27,1,5,2,2,0,2,1,0,2,2,1,0,0,0,0,
+    2,0,0,0,0,0,2,0,2,1,0,2,2,0,1,0,2,0,0,1,2,0,0,0,2,2,0,1,0,0,2,0,
+    1,0,2,0,2,0,0,0,2,1,0,2,0,0,2,1,0,0,2,2,0,1,0,0,2,0,1,2,2,1,0,0,
+    2,0,0,0,0,1,2,2,19,0,13,0,0,0,0,1,4,0,0,0,2,0,4,2,2,1,2,0,0,0,0,0,
+    0,0,2,0,0,0,4,1,0,0,2,0,0,2,2,1,0,0,2,0,2,0,0,0,0,0,0,0,4,0,0,0,
+    0,0,2,1,2,0,3,2,0,0,2,0,2,0,1,1,25,0,4,0,0,2,0,0,4,0,0,1,4,2,2,1,
+    1,2,2,1,0,2,0,1,2,2,0,1,0,0,4,0,2,0,0,0,2,0,2,1,1,2,0,1,2,0,0,0,
+    2,0,2,0,2,0,0,0,21,0,5,0,4,0,2,0,4,1,4,2,4,0,2,1,1,2,0,0,4,1,4,2,
+    2,1,2,2,0,1,3,2,0,1,0,2,0,1,2,0,0,0,4,0,0,0,2,1,15,2,1,1,2,0,2,2,
+    0,1,4,0,2,2,2,1,0,2,1,1,0,2,1,1,4,0,2,2,4,1,0,0,1,0,4,0,0,0,11,0,
+    8,0,6,0,4,0,1,0,3,1,2,2,2,0,0,1,0,2,2,1,2,0,5,0,3,0,4,0,15,2,6,1,
+    8,2,8,1,2,0,0,0,0,0,2,2,6,1,0,2,6,1,1,0,3,0,2,0,7,0,1,1,6,2,1,0,
+    0,0,4,1,5,2,10,1,18,2,0,1,7,2,13,0,10,0,10,0,3,0,2,0,0,1,33,0,0,0,0,0,
+    0,0,2,2,15,1,15,2,0,0,2,0,0,1,2,2,0,0,0,0,2,0,2,0,0,0,0,0,2,0,1,2,
+    2,1,2,0,1,0,2,2,0,1,2,0,0,2,0,1,0,0,2,0,0,0,0,0,2,0,0,0,0,0,0,0,
+    2,2,0,0,0,0,0,1,2,0,0,0,0,2,0,1,0,0,2,0,0,0,2,0,0,0,0,1,0,2,0,0,
+    2,0,0,1,0,0,0,0,0,0,2,2,1,0,29,1,0,2,2,1,1,0,2,0,0,0,2,2,2,1,0,0,
+    0,0,2,0,2,0,0,1,0,2,2,1,0,0,0,0,0,0,0,0,2,2,2,0,0,1,0,0,0,0,2,0,
+    2,0,0,1,0,2,2,0,0,0,2,1,0,0,0,0,2,2,0,1,0,0,2,2,1,1,2,0,0,2,2,1,
+    0,0,2,0,0,0,19,0,13,0,2,1,0,0,2,2,0,0,2,1,2,0,0,0,4,2,0,1,4,0,0,0,
+    0,0,0,1,2,0,0,2,2,0,2,1,2,0,0,2,2,1,2,0,1,0,2,0,2,0,2,0,1,0,2,0,
+    0,1,2,2,0,0,2,1,0,0,1,0,0,0,29,2,4,0,2,0,4,0,2,0,1,0,4,0,0,1,2,2,
+    2,1,2,2,2,1,0,0,1,0,2,0,2,0,0,0,2,0,2,1,0,2,0,0,4,1,0,0,1,2,2,1,
+    0,0,2,0,0,0,4,0,25,0,0,1,1,2,2,0,2,0,6,1,2,2,4,0,2,1,2,2,1,0,2,1,
+    2,2,4,1,2,2,2,1,1,2,0,1,0,0,2,0,0,0,0,0,2,0,19,0,2,1,6,2,0,0,0,1,
+    4,2,1,0,2,1,2,2,2,1,2,2,1,1,0,2,1,1,0,0,2,0,4,0,4,0,3,0,13,0,0,0,
+    2,0,8,0,6,1,4,2,2,0,3,1,0,2,2,0,2,1,1,0,0,2,4,1,0,2,7,1,13,0,0,2,
+    4,1,8,2,4,1,4,2,0,1,2,0,2,2,8,1,0,2,2,1,2,0,3,1,2,2,5,0,0,0,8,0,
+    3,0,1,0,2,0,5,0,16,0,14,0,7,0,3,1,11,2,14,0,2,0,2,1,3,1,33,0,2,2,0,0,
+    0,0,23,1,7,2,2,0,0,0,2,0,0,0,0,0,2,1,0,2,0,0,0,0,2,0,0,0,0,0,2,0,
+    2,0,1,0,2,0,0,0,0,0,0,0,2,0,2,0,0,0,0,0,2,0,1,0,0,0,2,0,0,0,2,2,
+    1,1,2,0,0,0,2,2,0,0,2,0,0,1,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,2,0,
+    0,1,0,2,2,0,0,0,2,0,9,1,23,2,0,0,2,1,0,2,2,1,1,2,2,1,0,0,0,0,2,0,
+    0,0,2,0,0,1,2,2,0,0,2,0,0,0,2,0,0,0,0,0,0,1,2,0,0,0,2,0,0,0,0,0,
+    2,0,0,0,2,1,0,0,0,0,0,0,2,2,2,0,0,1,2,0,0,0,0,0,2,2,0,1,0,0,0,0,
+    0,0,0,0,17,0,11,0,0,1,2,2,2,0,0,1,0,0,0,2,2,1,2,0,2,0,2,0,0,0,2,0,
+    2,1,0,2,1,0,2,1,2,0,2,2,0,1,2,0,2,2,0,0,4,1,1,0,2,0,0,0,2,0,0,1,
+    2,2,0,0,0,0,2,0,0,0,0,0,23,0,5,1,0,2,2,0,2,0,4,0,4,1,0,2,2,0,0,1,
+    2,2,2,1,0,0,2,2,2,1,0,0,0,0,0,0,0,0,2,0,4,1,0,0,0,2,0,0,2,1,0,0,
+    0,0,2,0,2,0,21,0,1,0,2,0,0,1,0,0,0,2,0,0,4,1,4,2,4,0,2,1,4,2,1,0,
+    0,1,2,2,4,1,2,2,2,1,0,0,0,2,1,1,2,0,0,1,2,2,19,0,4,0,0,1,4,2,2,0,
+    0,1,4,0,0,2,0,1,2,2,2,1,0,2,0,1,1,2,2,1,1,2,2,1,2,2,4,1,17,0,3,0,
+    6,1,2,2,6,0,6,1,4,2,2,0,1,1,1,0,0,2,4,0,2,1,3,2,4,1,4,2,19,1,1,0,
+    1,0,1,0,10,0,4,0,4,2,0,1,4,0,0,0,8,0,4,0,2,0,2,0,3,0,2,0,3,0,1,0,
+    6,0,1,0,0,1,0,2,13,0,20,0,12,0,13,0,3,0,2,1,4,0,2,2,3,1,33,0,0,0,3,0,
+    25,0,0,0,2,0,0,0,2,0,0,0,0,2,2,1,0,2,2,0,0,0,2,1,1,2,2,0,2,0,0,0,
+    0,0,0,0,0,0,0,1,2,2,2,0,0,1,0,2,0,0,2,0,1,0,2,0,0,0,0,1,2,0,1,2,
+    4,0,1,0,2,0,0,0,0,0,0,0,0,0,2,0,2,0,0,0,0,0,0,1,0,2,2,0,0,0,0,1,
+    2,2,0,0,0,1,0,0,11,2,17,0,1,1,2,0,0,2,0,1,0,0,2,0,0,0,2,0,0,0,0,1,
+    2,2,2,1,0,2,2,0,0,0,0,0,2,1,0,0,0,0,2,0,0,0,0,0,2,0,0,0,2,0,0,0,
+    0,0,2,0,0,0,0,0,2,0,0,0,2,1,0,0,0,0,2,0,0,2,2,1,0,0,0,0,0,0,0,0,
+    0,0,15,1,13,2,0,0,2,0,2,0,0,1,0,2,2,1,0,0,0,2,2,1,0,0,2,0,4,0,0,0,
+    2,0,0,0,2,1,0,2,0,1,0,0,2,2,2,1,2,0,2,0,0,2,2,1,0,0,2,0,0,1,2,2,
+    0,0,0,0,2,0,0,0,0,0,7,0,19,0,1,0,2,0,0,0,2,1,2,2,2,0,4,1,2,2,2,0,
+    0,1,2,0,2,0,0,0,2,0,0,0,0,0,2,1,2,0,0,2,0,0,2,0,2,1,2,0,0,0,0,0,
+    2,0,1,0,0,0,25,0,2,0,2,0,4,0,2,0,0,1,1,2,2,0,0,1,4,0,4,2,2,1,2,2,
+    2,0,0,1,0,2,2,1,4,0,2,0,2,0,0,0,1,0,2,0,0,1,21,2,2,0,4,0,2,1,2,2,
+    4,0,0,0,2,0,4,0,0,1,1,2,4,1,0,2,0,1,1,0,0,0,0,0,0,0,2,0,15,1,4,2,
+    3,0,2,1,4,2,4,0,8,1,6,0,2,2,0,0,3,1,0,2,2,0,4,0,1,0,7,1,4,2,3,1,
+    0,2,2,1,7,2,6,1,4,0,4,0,1,0,4,0,0,0,8,0,4,0,0,0,2,0,1,0,0,0,1,0,
+    1,1,2,2,1,0,0,0,5,1,0,2,12,1,6,0,3,0,13,0,12,2,1,1,6,1,31,0,11,0,19,0,
+    2,0,0,2,0,0,2,1,0,2,2,0,0,1,0,2,0,0,2,0,0,0,0,0,2,0,2,0,1,0,2,1,
+    0,2,2,0,0,0,2,0,1,0,0,0,2,0,0,0,2,1,1,2,2,0,2,1,0,0,0,2,0,2,2,1,
+    1,2,2,1,0,0,0,0,0,0,2,0,2,0,0,0,0,0,0,0,0,0,0,0,2,1,0,2,2,1,0,2,
+    1,1,2,0,0,2,15,0,15,1,0,0,4,0,0,2,0,1,0,0,2,0,0,0,0,0,0,1,2,2,0,0,
+    2,0,1,0,2,0,0,0,4,1,0,0,0,2,0,0,2,0,0,1,0,0,0,0,0,0,2,0,2,0,0,0,
+    0,0,2,1,0,0,2,0,0,0,2,0,1,0,2,0,2,2,0,0,2,1,0,2,0,1,2,2,0,1,0,0,
+    15,0,17,0,0,0,2,1,2,2,0,1,2,2,2,1,0,2,2,1,0,0,0,0,0,0,2,0,2,0,2,1,
+    0,2,4,1,0,2,0,1,0,2,2,1,2,0,0,2,2,1,0,0,2,0,2,0,0,0,2,0,0,2,2,1,
+    0,0,2,0,0,0,0,0,2,0,29,0,0,0,2,0,0,0,0,0,2,0,2,1,0,2,2,0,2,1,2,0,
+    2,0,0,0,2,2,2,1,0,0,2,0,2,0,2,0,1,0,2,1,0,0,2,0,2,0,2,0,2,0,0,0,
+    0,0,0,0,23,1,3,0,2,2,2,0,2,0,2,0,4,0,0,1,1,0,2,2,0,0,2,1,4,2,4,1,
+    2,0,2,2,0,1,0,0,2,0,2,2,2,1,2,0,0,0,1,0,23,0,6,1,0,2,0,0,2,0,6,1,
+    0,2,4,0,2,1,1,2,6,0,2,1,0,2,0,1,4,0,0,2,0,1,1,0,0,0,1,0,19,0,4,1,
+    6,2,0,0,3,1,4,0,2,2,6,0,6,1,6,2,2,0,1,0,0,0,1,1,4,2,5,0,5,1,8,2,
+    1,1,0,2,6,1,5,2,0,1,4,2,0,1,0,0,2,0,1,0,6,0,10,2,1,1,4,0,1,0,0,0,
+    0,0,0,0,0,0,3,0,0,0,13,1,12,2,12,0,9,1,0,2,7,1,10,2,2,1,51,1,11,0,2,2,
+    0,0,2,0,0,0,0,2,2,1,0,0,2,2,0,0,2,0,1,0,2,0,0,0,2,1,1,2,2,1,0,2,
+    0,0,2,0,0,0,0,0,2,1,0,2,0,0,2,1,0,2,2,0,0,1,1,2,2,0,0,0,0,0,2,0,
+    0,0,0,0,0,0,2,0,0,0,0,1,0,0,0,0,2,0,0,0,0,0,2,2,0,0,0,1,0,2,2,1,
+    0,2,0,0,21,0,7,0,0,0,2,0,1,0,2,1,0,0,0,0,0,2,2,1,2,0,0,0,0,0,2,0,
+    0,1,2,2,0,0,0,1,0,2,2,0,0,1,2,0,0,0,2,2,0,1,0,0,0,0,0,0,2,0,2,1,
+    0,0,0,2,2,0,0,0,0,0,2,0,0,0,0,0,0,1,2,0,0,2,2,1,2,0,1,0,2,0,13,0,
+    17,0,2,0,0,1,0,2,0,1,2,2,2,1,0,0,2,0,2,0,0,0,0,0,0,0,0,0,0,0,4,0,
+    2,1,0,2,4,1,0,0,2,0,1,2,0,1,2,0,0,2,2,1,2,0,2,0,0,0,0,0,4,0,1,0,
+    2,0,2,0,0,0,2,0,25,0,1,0,2,0,0,0,0,0,2,0,1,0,0,0,4,1,0,0,0,0,4,0,
+    2,2,2,0,0,1,2,0,2,0,2,0,0,0,0,0,2,0,0,0,2,0,0,0,0,0,2,0,2,0,2,0,
+    0,0,2,1,25,0,2,0,3,1,2,0,2,0,0,2,2,0,6,0,0,0,0,1,0,2,0,0,0,1,2,2,
+    6,0,2,1,2,0,2,0,1,0,2,1,0,2,4,0,4,0,2,0,21,0,5,0,4,1,4,0,2,2,1,0,
+    2,1,4,2,2,0,4,1,3,2,4,0,2,1,4,2,0,0,0,1,0,0,2,0,1,0,13,0,3,0,1,0,
+    4,1,4,2,4,0,1,0,2,1,2,2,6,0,2,0,8,0,2,1,1,2,0,0,0,1,9,0,4,2,3,1,
+    2,2,2,1,1,2,6,1,0,0,1,0,4,0,0,0,0,1,2,2,15,0,14,0,14,0,3,0,2,0,0,0,
+    0,0,0,0,2,0,0,1,2,2,2,0,21,1,14,2,10,0,5,1,9,2,10,1,1,3,61,2,0,0,0,0,
+    2,0,0,0,2,0,0,0,0,0,0,2,2,1,0,0,0,0,2,0,0,0,2,2,0,0,2,1,0,2,0,0,
+    0,0,0,0,2,0,0,0,0,0,2,1,0,2,0,0,0,0,0,1,2,2,0,0,0,1,0,0,2,2,0,0,
+    2,0,0,0,0,0,0,0,2,1,0,2,0,0,2,0,1,0,2,0,0,0,0,1,0,2,2,0,0,1,0,2,
+    2,1,27,0,3,0,1,0,2,0,0,0,2,0,2,0,0,0,2,0,0,0,1,0,2,0,0,0,2,1,1,2,
+    2,0,0,0,2,1,2,2,0,0,0,1,2,2,2,1,0,0,1,0,2,0,2,0,0,0,0,0,0,1,2,2,
+    2,0,0,0,0,1,0,0,2,0,0,0,2,0,0,0,0,2,0,0,2,1,0,0,0,2,4,1,11,0,19,0,
+    0,0,0,0,0,0,2,1,0,2,0,1,0,0,4,2,0,1,0,0,4,0,0,0,2,1,0,2,0,1,1,2,
+    2,0,4,1,0,2,2,0,2,0,2,1,1,2,0,1,2,0,2,0,0,0,0,2,2,1,2,0,0,0,2,0,
+    0,0,0,0,2,0,11,0,15,0,2,0,4,0,0,0,2,1,1,2,2,0,0,0,0,0,0,0,4,0,1,0,
+    2,1,2,0,2,0,2,0,2,0,2,0,2,1,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,2,0,
+    2,0,19,0,1,0,0,0,2,0,0,0,1,0,2,1,2,2,0,0,4,0,0,0,0,1,0,2,2,0,2,1,
+    1,0,4,0,4,0,2,0,2,0,1,0,4,1,0,2,0,0,2,0,15,0,2,0,3,0,0,0,4,0,2,0,
+    2,0,0,1,2,2,2,0,4,1,0,0,0,2,2,1,2,0,4,0,0,0,0,2,2,1,15,0,1,0,4,0,
+    3,0,2,1,6,2,2,0,1,0,0,0,4,0,4,0,2,0,2,0,4,1,0,0,1,2,7,0,2,1,2,2,
+    0,1,1,2,0,1,1,0,6,2,2,1,2,0,0,0,0,0,0,0,5,0,5,0,8,0,14,0,1,1,0,2,
+    2,0,0,1,2,2,2,0,0,1,4,0,1,2,9,1,14,0,5,2,6,1,11,0,8,1,61,0,2,0,0,0,
+    0,0,2,0,1,0,4,0,0,2,0,1,0,2,2,0,0,1,2,2,0,0,0,1,0,0,0,2,2,0,0,1,
+    2,0,0,0,0,0,0,0,2,2,0,0,0,1,0,2,2,1,0,2,0,1,2,0,0,2,0,0,0,0,0,0,
+    2,0,0,0,2,0,1,1,0,2,2,0,0,0,0,0,2,0,0,0,0,0,2,0,0,1,0,0,0,2,1,1,
+    27,2,0,0,0,1,0,0,2,0,0,0,2,0,0,0,2,0,0,0,0,1,2,2,1,0,2,0,0,0,2,1,
+    1,2,2,1,0,2,2,1,0,0,2,0,0,0,0,2,2,1,2,0,0,0,0,0,2,0,0,1,1,2,2,0,
+    0,1,0,0,2,2,2,0,0,1,0,0,0,2,2,0,2,1,0,0,0,0,2,2,0,1,9,0,21,0,2,0,
+    2,1,0,2,2,0,1,0,2,1,2,0,0,2,1,1,4,0,0,2,0,1,2,0,0,0,2,0,0,0,2,1,
+    0,0,0,2,2,1,2,2,2,1,0,2,2,1,0,0,1,0,2,0,0,0,2,0,2,0,2,0,0,0,2,0,
+    2,0,0,0,0,0,29,0,4,0,0,0,0,0,4,0,0,0,4,1,0,0,0,0,1,0,2,0,0,0,4,0,
+    0,0,2,0,0,0,2,1,0,0,2,0,0,2,2,0,4,0,0,0,0,1,2,0,1,0,2,0,2,0,0,0,
+    2,0,25,0,4,0,2,0,2,0,0,0,0,0,0,0,0,1,0,2,2,0,2,0,4,0,0,1,0,0,1,0,
+    2,0,0,0,2,0,2,0,4,0,4,0,1,0,0,1,2,0,21,0,2,2,6,0,4,0,1,0,3,1,4,2,
+    4,0,2,0,0,1,2,2,2,0,2,0,4,1,0,0,0,0,2,2,4,0,2,1,0,0,15,0,2,0,1,0,
+    4,0,1,0,3,0,6,0,4,0,1,0,1,0,4,1,4,2,6,0,2,0,2,0,0,1,13,2,4,0,2,1,
+    2,2,0,1,1,0,1,0,1,0,6,0,0,0,4,0,2,0,1,0,11,0,4,1,1,2,8,0,8,0,0,1,
+    1,2,2,0,2,0,6,0,6,0,11,0,16,1,11,2,0,0,10,1,1,0,5,2,4,3,61,0,0,2,2,1,
+    2,2,0,0,2,0,1,0,2,0,2,0,0,0,0,0,2,2,1,1,2,0,0,0,2,2,0,0,0,1,2,2,
+    0,0,0,0,0,0,2,0,0,1,0,0,0,2,2,1,0,2,0,1,2,2,0,0,0,1,0,2,2,0,0,0,
+    0,1,0,2,0,0,2,0,2,0,1,0,2,1,0,0,0,0,0,0,2,0,1,0,2,0,0,2,5,1,25,0,
+    0,0,2,0,0,2,2,0,0,0,2,1,0,0,0,0,2,0,0,0,2,0,0,1,0,0,0,0,0,2,2,0,
+    0,1,2,2,0,1,0,2,0,1,2,2,2,1,0,0,0,0,2,0,2,0,0,0,0,1,0,2,2,0,1,1,
+    0,2,2,1,0,0,2,0,0,2,2,0,0,1,0,0,2,0,0,0,2,2,1,1,5,0,23,0,2,0,0,0,
+    2,0,2,1,0,0,0,0,2,2,0,0,0,1,2,0,1,0,2,0,0,0,2,0,2,0,2,1,0,0,0,2,
+    0,0,2,1,0,2,2,1,0,2,2,1,2,0,2,2,0,1,1,2,2,1,0,0,2,0,0,0,2,0,0,2,
+    2,0,0,0,29,0,2,0,0,1,4,0,2,0,0,0,2,0,2,0,4,0,0,0,2,0,0,1,1,0,0,0,
+    4,0,0,0,2,1,0,2,2,0,1,0,4,0,2,1,0,0,2,0,0,2,2,0,0,1,0,0,0,0,2,0,
+    25,0,1,0,4,0,4,0,2,0,2,0,4,0,0,0,1,0,2,1,1,0,2,0,0,0,4,0,0,0,2,0,
+    0,0,0,0,0,0,2,0,0,0,4,0,2,0,2,0,0,0,23,0,4,0,2,0,4,0,4,0,2,0,3,1,
+    0,2,4,0,4,0,2,1,0,0,2,0,0,2,4,0,0,0,2,1,2,0,0,0,2,0,9,0,1,0,2,0,
+    1,0,2,2,4,1,5,0,2,0,6,0,0,0,5,0,2,1,4,0,6,2,6,0,2,0,1,1,9,2,2,0,
+    2,1,2,0,2,0,1,0,1,0,5,0,4,0,4,0,0,0,6,0,5,0,9,0,4,1,1,2,12,0,8,0,
+    1,0,1,0,2,1,0,0,6,0,4,2,11,0,14,1,15,2,18,0,1,0,4,1,5,1,59,0,2,1,0,2,
+    0,0,0,0,2,0,2,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,0,2,0,1,2,0,0,2,0,1,
+    0,0,2,0,0,0,0,0,0,2,0,0,2,1,0,2,0,1,2,2,1,1,2,0,0,2,2,0,0,1,0,2,
+    0,0,2,0,0,1,0,2,0,0,2,1,0,2,0,0,0,0,0,1,2,0,0,2,0,0,11,1,19,0,2,2,
+    2,0,0,1,0,0,2,0,0,0,0,2,0,1,2,0,0,0,2,0,0,0,0,0,2,0,0,0,0,1,0,2,
+    2,0,1,1,2,2,0,1,2,2,0,1,0,0,2,0,2,0,0,0,0,0,2,0,0,0,2,0,0,1,0,2,
+    0,1,2,2,0,0,0,1,2,0,1,0,4,2,0,0,0,0,0,0,0,1,7,0,23,0,2,0,2,0,2,0,
+    0,0,2,0,2,0,2,0,1,1,0,0,2,0,0,0,2,0,0,0,2,0,0,0,2,0,0,0,2,0,0,1,
+    2,2,1,0,2,1,0,2,2,1,0,0,2,0,0,0,2,0,2,0,1,0,2,0,0,0,0,0,2,0,2,0,
+    0,0,19,0,9,0,2,0,2,0,0,0,4,0,2,0,2,0,0,0,2,1,2,0,2,0,0,2,2,1,1,0,
+    0,0,2,0,2,0,0,0,2,0,2,1,0,0,0,2,2,0,0,1,4,0,0,0,2,2,0,1,0,0,7,0,
+    21,0,2,0,2,0,2,0,4,0,2,0,2,0,2,0,2,0,0,0,2,0,0,0,0,0,0,0,2,1,2,0,
+    2,0,0,0,0,0,2,0,2,0,1,0,4,0,2,0,5,0,13,0,1,0,4,0,2,0,2,0,4,0,4,0,
+    1,1,3,0,4,2,2,0,4,0,2,0,2,1,0,0,4,0,1,0,0,0,4,0,2,0,13,0,6,0,0,0,
+    0,2,1,1,0,0,4,0,1,0,1,1,4,2,6,0,3,0,1,0,4,1,4,2,6,0,1,0,8,1,5,2,
+    1,0,0,0,4,0,2,0,3,1,1,0,5,0,0,0,4,0,0,0,1,0,6,0,9,0,1,1,1,2,12,0,
+    12,1,3,2,3,0,0,0,0,0,12,1,1,0,3,2,12,1,5,0,6,2,0,0,3,3,57,0,0,2,0,0,
+    2,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,2,2,0,1,0,2,0,1,2,0,0,2,
+    2,0,1,0,2,0,2,0,0,1,2,0,1,2,2,1,0,0,0,0,2,2,1,1,2,2,0,0,0,0,2,1,
+    0,2,0,1,0,2,2,1,0,0,0,2,0,1,0,0,2,0,0,2,0,0,2,1,17,0,13,0,0,2,0,1,
+    0,0,2,2,2,1,0,0,0,0,0,0,2,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,0,1,
+    0,2,2,0,0,1,0,0,2,0,1,0,2,2,2,1,0,0,2,0,0,0,0,0,2,0,0,1,0,2,0,1,
+    2,2,1,1,2,0,0,2,0,0,4,0,1,1,2,0,0,0,2,0,9,0,23,0,0,0,2,0,2,1,2,0,
+    2,0,0,2,2,0,2,0,0,1,0,0,0,0,2,2,0,0,2,1,0,0,0,0,0,0,2,0,0,0,2,0,
+    0,1,2,2,0,0,0,1,0,0,2,0,2,2,2,1,0,2,0,1,4,0,1,0,0,2,2,0,0,0,0,1,
+    13,0,17,0,4,0,4,0,0,0,2,0,0,0,2,0,4,1,2,0,1,2,4,0,0,1,2,0,2,2,2,1,
+    1,0,0,1,2,2,2,0,0,1,2,2,0,0,2,1,0,0,0,2,2,1,0,0,2,0,2,0,0,0,27,0,
+    0,0,0,0,2,0,2,0,0,0,4,0,4,0,2,0,2,0,2,0,0,1,2,0,0,0,0,0,2,2,0,0,
+    0,0,2,0,2,0,1,1,2,0,4,0,0,0,0,0,23,0,6,2,2,1,0,0,2,0,4,0,2,0,0,0,
+    4,0,0,0,3,1,2,0,4,0,2,0,2,0,2,0,0,0,4,0,2,0,1,0,11,0,0,0,2,2,4,0,
+    2,1,2,0,1,0,1,0,4,0,4,0,3,1,0,0,6,2,1,0,5,0,4,0,4,0,5,0,8,0,8,1,
+    1,0,1,0,0,0,4,0,2,0,1,0,0,0,3,0,0,2,2,1,9,0,8,0,6,0,5,0,3,0,3,0,
+    10,0,12,1,5,0,1,0,7,2,8,0,8,0,5,1,10,2,5,0,8,1,1,0,3,3,57,2,0,1,2,0,
+    0,0,2,0,0,2,2,0,1,0,2,0,0,0,0,0,2,0,0,2,0,1,2,0,0,0,2,0,1,0,2,0,
+    0,0,2,0,0,0,1,0,2,0,0,0,2,0,1,0,2,2,2,1,1,0,2,0,0,0,2,0,0,2,0,0,
+    0,1,0,2,2,1,0,2,0,1,0,0,0,2,2,1,1,0,2,0,0,0,21,0,7,0,0,2,2,1,0,2,
+    2,1,0,0,0,0,0,0,2,0,2,0,0,0,0,0,0,0,2,0,0,1,2,0,0,0,0,0,0,2,0,0,
+    2,1,0,0,0,0,0,2,0,1,4,0,0,0,0,0,0,0,0,0,2,0,2,1,0,2,0,0,0,1,2,2,
+    0,1,2,2,0,0,0,0,2,1,1,0,2,0,0,0,0,0,9,0,21,0,2,0,0,1,0,0,2,2,0,0,
+    2,0,4,1,0,0,0,0,4,2,2,0,0,0,0,1,0,0,0,1,0,0,2,0,2,0,1,0,2,2,2,0,
+    0,0,0,1,2,0,0,0,0,0,2,2,0,1,0,0,4,0,0,0,0,2,2,0,0,1,1,0,2,0,9,2,
+    23,1,4,0,2,0,2,0,2,0,2,0,2,0,2,1,1,2,4,0,2,1,0,0,2,0,2,0,2,0,0,0,
+    2,0,0,0,1,0,2,0,2,0,2,0,2,1,0,2,0,0,2,1,0,2,2,1,0,0,0,0,9,0,13,0,
+    0,0,2,2,1,1,2,0,4,0,0,0,0,0,4,0,4,0,0,1,4,2,0,0,2,0,0,1,0,0,2,0,
+    2,0,0,0,0,0,2,2,0,1,0,0,2,2,2,0,23,0,0,1,6,0,4,0,1,0,2,0,2,0,6,0,
+    0,0,4,0,0,0,3,0,1,0,2,0,4,0,2,0,2,0,2,0,0,1,4,0,17,2,0,0,4,1,2,0,
+    6,0,0,0,2,0,0,0,1,0,0,0,4,0,0,0,1,1,6,2,2,0,3,1,1,0,11,0,10,0,6,0,
+    8,0,2,0,1,0,0,0,4,0,4,0,1,0,3,0,1,0,0,0,1,0,0,0,4,0,6,0,3,1,3,2,
+    7,0,10,0,10,0,3,0,2,1,11,0,6,0,10,2,7,1,6,0,1,0,0,0,4,3,57,0,2,2,0,0,
+    0,0,2,0,0,1,0,2,2,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,2,0,1,2,2,1,0,0,
+    0,0,0,0,2,0,2,0,0,0,0,2,0,1,2,0,1,0,0,0,2,0,2,2,0,0,0,0,0,1,0,2,
+    0,0,2,1,0,2,0,1,0,2,2,1,0,0,0,2,0,1,0,0,25,0,3,0,0,2,0,1,2,0,2,0,
+    0,0,0,0,0,0,2,0,0,0,0,1,2,2,0,0,0,1,0,0,2,2,0,0,2,0,2,0,0,1,0,0,
+    0,0,0,0,2,2,0,1,2,0,1,0,2,0,0,0,2,0,0,1,2,2,1,0,2,1,2,0,0,2,2,1,
+    0,2,0,1,0,0,0,0,0,2,2,0,0,1,0,0,11,0,21,0,2,0,2,1,2,2,0,0,0,0,4,0,
+    0,0,0,0,2,1,2,0,2,0,0,0,2,0,0,0,2,1,0,2,0,0,0,0,0,0,2,0,2,1,1,0,
+    4,0,0,0,0,2,2,0,0,0,0,1,0,0,2,2,0,1,2,2,0,1,2,0,0,2,2,1,5,0,27,0,
+    2,0,0,0,2,0,2,1,2,2,2,0,0,1,2,2,2,1,0,0,2,2,2,1,2,2,2,1,0,0,4,0,
+    0,0,0,0,2,0,0,1,0,2,0,1,2,2,2,1,2,0,0,0,0,0,0,0,2,0,2,2,27,1,2,0,
+    2,0,0,0,2,2,0,1,0,0,2,0,4,0,0,0,2,1,4,2,2,0,0,0,2,1,2,2,2,0,0,0,
+    0,1,2,0,0,0,0,0,0,2,0,0,0,1,25,0,2,0,6,0,2,0,2,0,4,0,2,0,0,0,2,0,
+    4,0,2,0,2,1,4,0,1,0,3,0,0,0,2,0,4,0,0,0,2,2,0,0,15,1,4,0,0,0,4,0,
+    2,0,6,0,0,0,2,0,0,0,1,0,0,0,4,0,2,0,3,1,4,2,2,0,7,0,13,0,0,0,10,0,
+    10,0,6,0,2,0,0,0,0,0,4,0,4,0,0,0,3,1,9,0,1,0,4,0,4,0,2,0,6,0,3,1,
+    1,0,5,0,10,2,6,1,7,2,8,0,2,0,2,1,9,0,1,0,2,0,4,0,0,1,55,1,2,0,0,0,
+    2,0,1,2,2,0,0,0,2,1,0,2,0,0,2,0,0,0,0,0,0,0,2,0,1,0,2,0,0,0,2,0,
+    0,0,2,0,1,0,0,0,0,2,2,1,2,0,1,2,2,1,0,0,2,0,1,0,2,0,0,2,0,0,2,1,
+    0,0,0,2,0,1,2,2,0,1,1,2,2,1,0,0,3,2,25,0,0,0,0,0,2,1,0,0,0,0,0,0,
+    2,0,2,0,0,0,0,0,2,0,0,0,0,0,2,1,0,2,2,0,0,0,0,1,0,0,2,2,0,0,0,0,
+    2,0,0,0,0,1,2,0,0,0,0,0,0,1,2,2,0,0,2,0,1,1,2,0,0,2,2,0,2,1,1,2,
+    2,1,0,2,0,0,2,1,1,0,2,0,0,2,13,1,19,0,2,0,0,1,2,2,0,0,2,0,2,0,0,1,
+    2,0,0,0,2,2,2,0,2,1,2,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,2,0,
+    1,0,2,0,0,1,0,0,2,0,0,2,2,0,0,1,0,2,2,1,2,2,0,0,2,1,0,2,31,1,1,0,
+    2,0,0,0,2,0,0,0,4,0,0,1,4,2,0,1,2,2,0,1,2,0,2,0,2,0,0,0,2,0,0,0,
+    4,0,2,0,0,1,0,2,0,1,2,2,0,1,2,2,0,1,4,2,0,1,2,2,0,1,21,0,5,2,2,0,
+    4,1,2,0,0,0,0,0,0,0,2,0,0,0,4,1,0,2,4,0,0,1,6,0,0,2,2,0,0,1,0,0,
+    0,2,0,0,4,1,0,0,2,0,0,0,0,0,27,0,0,0,2,0,2,0,4,0,4,0,2,0,2,0,0,1,
+    2,0,4,0,4,2,2,0,2,0,2,1,5,0,0,0,0,0,4,0,4,0,0,0,17,0,0,0,6,0,0,0,
+    2,0,2,0,4,0,6,0,0,0,0,0,0,0,3,0,2,0,4,0,1,1,1,0,11,0,2,0,0,0,1,0,
+    4,0,10,0,8,0,2,0,0,0,0,0,4,0,4,0,0,0,7,0,5,0,0,0,2,0,4,0,4,0,4,0,
+    1,0,5,0,1,1,6,2,10,1,9,2,4,0,6,0,4,0,9,0,3,0,2,0,2,3,53,0,1,0,2,0,
+    0,2,2,1,0,2,2,1,0,2,0,0,0,0,0,0,2,0,0,1,2,2,0,0,2,0,0,0,0,0,0,0,
+    0,0,0,0,2,0,0,0,2,0,1,0,0,0,2,0,0,0,2,0,1,0,2,2,0,0,2,1,0,0,0,0,
+    0,2,2,1,0,0,1,0,2,0,2,0,1,0,9,0,21,0,2,0,0,0,2,0,0,0,2,0,0,0,2,0,
+    0,0,0,0,2,0,0,0,0,1,2,2,0,1,0,2,2,0,0,1,0,0,2,2,0,0,0,1,0,0,2,0,
+    0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,1,0,2,0,0,2,0,2,0,0,1,0,2,2,0,0,1,
+    0,2,2,0,0,1,0,2,2,1,1,0,15,0,15,0,0,0,2,0,0,0,0,0,2,0,2,1,0,0,0,2,
+    2,0,2,1,2,0,0,0,0,2,2,1,4,0,0,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,0,1,
+    2,0,0,0,2,0,2,2,0,0,0,1,0,0,0,2,2,1,0,2,0,1,2,0,2,2,29,1,1,2,2,1,
+    1,0,2,0,2,1,0,2,0,1,4,2,0,1,2,2,2,1,2,2,0,1,0,0,2,0,4,0,0,0,2,0,
+    2,1,2,2,2,0,0,0,2,0,1,1,2,2,0,1,2,2,0,1,2,2,2,1,0,2,27,0,0,1,2,0,
+    2,2,4,1,2,0,2,0,0,0,0,0,1,1,2,2,2,0,0,1,4,2,0,0,4,0,2,1,2,2,2,0,
+    2,1,0,0,1,2,2,0,0,1,2,0,21,0,3,0,2,0,1,0,4,0,0,0,4,0,2,0,4,1,2,2,
+    0,0,0,0,4,0,4,0,2,1,2,2,4,0,1,1,3,0,0,2,2,0,11,1,1,0,2,0,0,0,4,0,
+    0,0,2,0,4,0,0,0,6,0,4,0,1,0,2,0,5,0,2,0,2,1,2,0,17,0,2,0,2,0,0,0,
+    0,0,2,0,6,0,8,0,4,0,1,0,2,0,4,0,6,0,4,0,9,0,7,0,0,0,6,0,0,0,2,0,
+    4,0,2,0,7,0,2,0,6,0,4,1,3,0,3,0,10,0,3,0,5,0,4,0,2,3,53,2,2,0,0,0,
+    0,1,2,0,0,0,0,2,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,
+    2,0,0,0,0,0,2,0,1,0,2,0,0,0,2,1,0,2,0,0,0,0,2,0,0,0,1,0,2,0,0,2,
+    2,1,1,0,2,2,2,1,1,0,0,0,13,0,15,0,2,0,1,0,2,0,0,0,2,0,0,0,2,0,0,0,
+    0,0,0,0,2,0,0,0,0,0,2,0,0,0,2,0,0,1,0,2,0,0,2,0,0,1,0,0,4,0,0,0,
+    1,0,0,0,2,0,2,0,0,0,0,0,0,0,0,0,2,1,0,0,2,0,0,2,2,0,0,1,0,0,2,2,
+    0,1,1,0,2,2,0,1,0,2,17,1,15,0,0,0,4,0,0,1,2,2,0,0,2,1,0,2,2,0,2,1,
+    0,0,0,2,0,1,4,0,0,0,2,0,0,0,2,0,2,0,0,0,2,0,0,0,0,0,0,1,2,0,0,2,
+    2,0,0,0,0,0,0,1,2,0,2,2,0,0,0,0,0,0,0,1,2,2,0,1,23,0,5,0,2,0,2,0,
+    0,0,0,0,1,0,4,0,2,0,0,1,2,2,2,1,2,2,2,1,2,0,0,2,0,1,0,0,4,0,0,0,
+    0,0,2,0,2,0,2,1,2,2,2,0,1,1,0,2,2,1,0,2,2,1,0,2,27,1,4,0,2,2,0,1,
+    1,0,2,0,4,0,2,2,4,1,0,0,2,0,1,0,0,0,2,0,2,0,2,0,2,1,2,2,2,1,2,0,
+    0,2,2,0,2,1,0,0,0,2,0,0,21,1,0,0,0,0,0,0,0,0,2,0,2,0,2,1,2,2,2,0,
+    4,0,0,1,1,0,2,0,6,2,4,1,2,0,2,2,2,0,3,1,1,0,23,2,4,0,8,1,2,0,0,0,
+    2,0,2,0,2,0,4,0,0,0,4,0,4,0,1,1,4,0,3,0,1,2,4,0,13,1,1,0,1,0,4,0,
+    0,0,2,0,2,0,4,0,6,0,6,0,1,0,0,0,4,0,4,0,8,0,7,0,9,0,1,0,8,1,2,0,
+    0,0,2,0,4,0,13,0,8,2,6,1,5,0,2,0,2,0,10,0,3,0,5,0,6,3,53,0,2,0,0,0,
+    2,0,1,2,2,1,0,0,0,0,2,0,0,0,2,0,0,2,0,0,0,1,0,2,2,0,0,1,2,2,1,0,
+    2,0,0,0,0,0,0,0,2,1,0,2,2,0,1,0,2,0,0,0,2,0,1,0,2,0,2,2,1,0,0,1,
+    2,0,0,0,0,0,0,0,2,2,19,1,11,0,0,0,2,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,
+    2,0,0,1,0,2,2,1,0,2,0,1,2,2,0,1,0,2,0,1,2,0,0,0,2,2,2,0,1,1,2,0,
+    2,0,0,0,0,0,1,0,2,0,0,0,2,0,0,0,0,0,2,0,0,0,0,1,0,0,0,0,2,2,0,1,
+    2,2,2,1,0,0,0,0,19,0,13,0,0,0,0,0,0,0,2,0,2,0,0,1,2,2,2,0,0,1,0,2,
+    2,1,2,0,0,2,0,1,2,0,0,0,2,0,2,1,2,2,2,0,0,0,0,0,2,1,0,2,0,0,2,0,
+    1,0,2,0,2,0,0,0,0,0,0,1,2,2,2,1,0,2,0,0,0,1,19,2,13,1,2,0,2,0,2,0,
+    4,0,2,0,0,0,1,1,2,2,2,0,0,1,2,2,2,1,2,0,2,0,2,0,2,0,1,0,0,0,2,0,
+    2,0,2,1,0,2,2,0,0,1,2,0,2,2,0,1,1,2,2,1,2,2,11,1,15,2,0,1,2,0,4,0,
+    4,0,0,2,0,1,2,0,2,0,4,0,2,0,0,0,0,1,1,2,2,0,2,1,0,2,2,1,2,2,2,0,
+    2,1,0,0,2,2,2,0,2,1,9,0,13,2,2,0,0,1,2,0,1,0,1,0,2,1,4,2,2,0,2,0,
+    2,1,4,2,2,0,1,1,0,0,2,2,4,0,2,0,4,1,0,0,1,0,23,0,0,0,4,2,4,1,4,0,
+    2,0,2,0,0,0,2,0,4,0,0,0,4,1,4,2,0,0,2,0,2,1,5,0,15,2,4,1,0,0,1,0,
+    0,0,1,0,6,0,0,0,8,0,4,0,4,0,0,0,0,0,7,0,12,0,8,0,3,1,9,0,3,2,8,0,
+    4,0,2,0,0,0,6,0,19,1,14,2,1,0,3,0,2,0,12,1,2,0,2,0,3,3,51,0,0,0,2,0,
+    1,2,4,1,0,2,0,0,2,0,1,0,2,0,0,0,0,1,0,2,2,0,0,0,0,1,0,2,0,0,2,0,
+    0,0,0,0,2,0,0,0,2,0,0,0,1,0,2,0,0,0,0,0,0,2,2,0,0,0,0,1,2,0,0,0,
+    0,0,2,2,1,1,0,0,23,1,5,2,2,0,0,0,0,0,0,0,2,1,0,2,2,0,0,0,0,0,2,0,
+    0,0,2,0,0,0,2,0,0,1,0,2,0,1,0,0,2,0,2,2,0,0,0,1,0,0,0,0,2,2,0,1,
+    0,0,2,0,0,0,2,0,1,0,2,0,0,0,0,1,2,0,0,0,0,0,0,2,2,0,0,0,0,1,2,2,
+    0,1,0,2,0,1,19,0,11,0,2,0,0,0,2,0,0,0,1,0,2,0,2,0,0,0,2,1,0,2,2,1,
+    0,2,2,1,2,0,0,0,0,0,2,0,0,0,2,2,0,1,2,0,2,0,2,1,0,2,0,0,0,1,2,0,
+    2,0,0,0,0,0,2,2,0,0,2,0,0,1,0,2,0,1,2,0,17,2,15,1,0,0,2,2,2,1,2,0,
+    0,0,2,1,2,2,2,0,1,1,0,0,4,2,0,1,0,0,2,0,2,2,2,1,2,0,4,0,1,1,2,2,
+    0,0,0,0,2,1,2,0,2,2,0,0,2,1,2,2,2,1,1,2,1,1,29,2,2,1,4,2,4,1,0,2,
+    4,1,2,0,0,0,2,0,2,0,0,0,2,0,2,0,2,0,0,0,3,1,0,2,4,1,2,2,0,0,2,1,
+    2,2,4,0,0,1,0,0,2,2,21,1,2,0,0,0,2,2,0,1,2,0,0,1,1,2,1,0,4,0,4,1,
+    2,2,2,0,4,1,2,2,1,0,0,1,2,0,2,0,2,2,6,0,5,1,13,0,3,0,1,1,2,2,6,0,
+    4,0,2,0,2,0,0,0,2,1,2,0,2,2,2,0,4,1,0,0,0,2,4,1,17,0,0,2,4,0,1,0,
+    1,1,0,0,3,0,8,0,1,0,6,0,6,0,4,0,1,0,11,0,4,0,12,1,8,2,5,0,5,0,1,0,
+    6,0,2,0,2,0,1,0,4,1,7,0,14,0,7,0,0,0,4,2,14,0,3,0,3,5,49,2,0,0,0,0,
+    2,0,1,0,2,0,0,0,0,0,2,0,0,0,0,0,2,2,0,1,0,2,2,1,0,2,0,0,0,0,2,0,
+    1,0,2,0,0,0,2,0,1,0,2,1,2,2,1,0,0,1,2,2,2,0,1,0,0,0,2,0,0,0,0,0,
+    0,0,0,1,0,2,25,0,3,0,0,0,2,0,2,0,0,0,0,1,0,2,2,1,0,2,0,0,2,0,0,1,
+    0,2,2,0,2,1,1,0,2,2,0,1,2,0,0,2,0,1,0,0,2,0,0,2,2,1,0,0,0,0,2,2,
+    2,1,1,0,0,0,2,0,2,0,0,1,0,0,0,2,0,0,0,0,2,0,0,1,0,0,2,2,0,0,0,1,
+    2,2,0,1,19,0,11,2,0,1,0,0,2,1,0,2,0,1,2,2,0,1,2,2,0,1,0,2,2,1,0,0,
+    2,0,0,0,0,0,2,0,2,0,0,0,2,0,0,1,2,2,0,0,2,1,0,2,2,0,2,1,0,2,0,0,
+    2,0,0,0,0,0,2,1,2,2,1,0,2,0,0,1,2,2,11,0,19,1,1,0,2,0,0,0,2,0,2,0,
+    2,0,2,0,2,1,0,2,0,0,0,0,0,1,2,0,2,0,0,2,2,1,2,0,2,0,2,0,2,0,0,1,
+    2,2,0,0,2,0,0,0,0,1,2,2,0,0,2,1,2,2,2,1,25,2,3,1,2,2,2,1,0,2,4,1,
+    0,2,2,1,4,0,0,0,0,0,2,0,2,0,2,0,2,0,0,1,2,2,0,1,3,2,2,1,2,0,2,2,
+    2,0,0,1,4,2,2,0,1,1,23,2,2,1,4,0,2,0,2,0,2,0,2,0,1,0,0,0,3,1,0,2,
+    4,1,2,0,4,2,2,0,4,1,0,2,1,0,4,1,2,0,0,0,13,2,4,1,0,0,7,2,2,1,1,0,
+    2,0,6,0,4,0,2,1,0,2,0,0,4,0,2,1,2,2,4,1,2,0,9,2,3,1,0,0,1,0,6,0,
+    0,2,1,1,1,0,5,0,6,0,0,0,6,0,6,0,2,0,11,0,1,1,4,2,12,0,10,0,5,1,3,0,
+    1,0,4,0,4,0,7,0,10,2,5,0,6,1,8,0,11,0,1,0,12,0,0,0,0,3,51,1,2,2,0,0,
+    2,0,0,2,0,1,2,0,0,0,0,0,2,2,0,0,0,1,0,2,0,1,2,2,0,0,0,1,2,0,0,0,
+    0,0,0,0,2,0,1,0,2,2,0,0,0,1,2,2,0,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,
+    0,0,5,0,25,0,0,0,2,0,0,0,0,0,2,0,0,0,2,0,0,0,2,0,1,1,2,2,0,0,2,0,
+    0,1,0,0,0,2,2,0,2,1,0,0,0,2,2,1,0,2,0,1,0,0,2,0,0,0,0,0,2,0,0,0,
+    0,0,2,0,2,0,1,1,0,0,0,2,2,0,2,0,0,1,0,0,0,0,2,2,0,0,0,1,0,0,2,2,
+    1,1,19,0,11,0,2,0,2,0,0,0,2,0,0,0,2,0,0,0,0,0,0,1,2,2,0,1,0,0,2,2,
+    0,1,2,0,2,0,0,0,0,0,2,0,0,0,2,0,0,0,2,0,0,0,2,0,2,1,0,2,2,0,0,0,
+    0,0,2,0,0,0,0,0,0,1,2,2,0,0,2,0,3,1,27,0,2,0,0,0,0,0,0,0,0,0,2,0,
+    2,0,2,0,0,0,2,1,4,0,2,0,1,0,0,0,2,2,0,1,2,0,0,0,2,0,0,0,4,0,2,0,
+    0,1,0,0,0,2,2,0,2,0,0,1,2,2,0,0,0,0,5,0,19,1,2,2,1,1,2,2,2,1,2,0,
+    2,0,2,0,0,2,4,1,2,0,0,0,2,0,2,1,0,2,4,0,2,0,1,0,2,0,3,0,0,0,2,1,
+    2,0,2,2,0,1,2,0,21,2,2,1,2,2,2,1,2,0,2,0,0,0,2,0,4,0,0,1,0,2,1,1,
+    3,2,4,0,0,1,4,0,2,2,4,0,4,1,3,2,2,0,2,1,19,0,6,2,6,1,4,0,7,2,1,1,
+    0,0,0,0,4,1,2,2,4,0,2,1,1,0,4,2,2,1,2,2,4,0,9,1,0,2,0,0,0,0,1,1,
+    4,0,4,2,1,1,3,0,5,0,6,0,0,0,4,0,8,0,11,1,2,2,1,0,4,0,10,1,8,2,7,0,
+    0,0,2,0,2,0,3,1,5,0,14,0,9,2,14,0,2,0,3,1,5,0,12,0,0,3,47,0,1,0,2,0,
+    0,0,2,0,0,2,0,1,0,2,2,0,1,1,2,0,0,2,2,1,0,2,0,1,0,0,2,2,0,0,0,0,
+    2,0,0,0,0,0,0,0,0,1,0,2,0,0,2,1,0,2,0,0,2,0,0,0,0,0,0,0,2,0,0,0,
+    11,0,19,0,2,1,0,2,0,0,2,0,0,0,0,0,2,1,0,2,2,0,0,0,2,0,0,1,0,0,0,2,
+    2,0,0,0,0,1,2,0,0,0,0,2,0,1,0,2,2,1,2,2,0,1,0,0,2,2,0,1,0,0,0,1,
+    2,2,0,0,0,1,2,2,0,0,2,0,1,1,2,0,0,2,0,0,0,0,0,1,2,0,0,2,2,0,0,1,
+    21,0,9,0,2,0,0,0,0,0,2,0,2,0,0,0,0,0,2,1,1,0,2,2,0,1,2,0,2,2,0,1,
+    2,0,1,2,2,1,0,0,2,0,0,0,2,0,0,0,2,0,0,1,2,2,2,0,0,0,2,0,0,0,2,0,
+    0,0,0,0,0,0,2,0,0,0,2,1,0,0,0,0,31,0,2,2,0,0,2,0,2,0,0,1,0,0,2,0,
+    0,0,2,0,2,0,2,0,0,0,2,0,2,0,0,0,1,1,2,0,0,0,2,0,1,0,2,0,2,0,2,0,
+    2,0,2,0,0,1,0,2,2,0,2,0,0,0,0,0,2,1,31,2,4,0,2,1,4,2,3,1,2,0,2,2,
+    2,1,2,0,2,0,0,0,2,0,2,0,0,0,2,0,2,0,4,0,0,1,4,2,0,1,0,2,1,1,1,2,
+    0,0,2,1,2,2,2,1,27,0,4,0,2,0,2,0,4,0,2,2,4,1,2,0,0,0,2,0,0,0,2,0,
+    0,0,3,1,0,2,2,0,2,1,4,0,0,2,6,1,1,0,0,0,23,0,6,0,4,0,6,0,6,0,3,0,
+    3,0,0,1,1,2,4,0,2,1,4,2,0,1,2,0,0,2,4,1,2,0,11,2,6,0,2,1,2,0,0,0,
+    1,0,0,0,2,2,4,1,3,0,7,0,0,0,4,0,4,1,9,2,6,0,2,0,1,1,6,2,8,0,8,0,
+    9,0,0,1,2,0,1,2,1,0,1,1,14,0,3,0,14,0,9,2,5,0,10,1,4,3,49,0,2,1,0,2,
+    0,0,0,0,2,0,0,2,2,1,0,0,2,0,0,2,0,1,0,2,0,1,0,2,2,0,0,1,0,0,0,0,
+    0,0,2,0,0,0,2,2,0,0,0,1,0,0,0,2,2,1,0,2,1,0,2,0,2,0,1,0,0,0,13,0,
+    13,0,1,0,2,0,0,1,2,2,0,1,2,2,0,1,0,2,2,0,0,0,0,0,0,0,2,0,0,0,0,1,
+    2,0,0,0,2,0,1,2,2,0,2,1,0,0,2,0,1,0,2,0,0,0,2,0,1,0,4,0,0,0,0,0,
+    0,0,2,0,0,0,0,0,0,1,0,0,2,2,0,0,0,1,2,0,0,0,0,2,0,0,2,1,0,0,25,0,
+    5,0,0,0,2,0,0,0,2,0,2,0,0,0,2,1,0,2,0,0,2,0,0,1,0,0,0,2,2,1,0,0,
+    0,0,4,0,1,0,2,0,2,0,0,0,0,0,0,0,2,0,2,0,0,0,0,1,2,2,2,0,2,0,0,0,
+    0,0,2,0,2,0,1,0,2,0,1,0,2,0,29,0,0,0,2,1,2,0,0,0,2,0,2,0,0,0,1,0,
+    4,0,1,0,4,0,0,1,2,0,0,0,2,0,0,0,2,0,1,0,0,0,2,0,2,0,0,0,0,0,2,0,
+    0,0,4,0,2,0,0,0,0,0,0,0,2,1,2,2,23,0,3,1,0,2,2,0,2,1,4,0,1,2,0,1,
+    0,0,2,0,4,0,2,0,2,0,0,1,2,2,0,0,4,1,0,2,2,0,2,0,2,0,2,0,2,0,1,0,
+    1,1,0,2,0,1,25,2,2,1,2,2,2,1,4,2,0,1,4,1,0,2,4,0,2,0,2,0,4,1,0,2,
+    0,0,0,0,1,0,1,1,2,2,0,1,4,0,0,0,4,0,21,2,0,1,2,0,4,2,4,1,2,0,6,0,
+    2,0,5,0,0,0,1,1,2,2,4,1,4,2,0,0,2,1,0,2,2,0,15,1,6,0,8,2,2,1,0,2,
+    2,1,1,0,2,0,0,2,2,1,1,0,3,1,5,0,4,2,17,0,10,0,8,1,2,2,1,0,10,0,8,1,
+    4,0,9,2,0,1,11,0,16,0,5,2,0,0,2,0,10,1,4,0,1,0,7,2,6,5,47,2,2,0,0,0,
+    0,0,2,0,1,0,2,0,0,0,0,0,0,0,0,0,2,0,0,0,2,2,0,1,0,0,0,2,0,0,2,0,
+    0,0,0,0,0,0,0,1,2,0,0,2,2,0,0,1,0,2,0,0,2,0,1,1,0,0,2,0,17,0,11,0,
+    1,2,4,0,1,0,2,0,0,1,2,2,0,1,2,2,0,1,0,0,0,0,0,0,2,0,0,0,2,0,0,0,
+    0,2,0,0,0,0,4,1,1,0,2,0,2,2,1,1,2,2,0,1,0,2,0,1,4,0,1,0,2,0,0,0,
+    0,0,2,1,0,2,0,1,2,2,0,0,0,1,0,0,2,2,0,0,0,0,2,1,1,0,0,0,25,0,3,0,
+    0,0,2,0,0,0,2,0,2,0,0,0,0,0,2,0,2,1,0,0,2,2,0,0,0,0,0,1,0,0,2,0,
+    0,0,0,0,2,0,0,0,0,0,2,0,2,0,0,0,2,1,0,2,2,0,2,0,0,0,0,0,2,0,0,0,
+    2,0,0,0,0,0,2,0,1,0,4,1,25,0,5,0,0,0,2,0,0,0,4,0,2,0,0,0,2,0,2,0,
+    1,1,2,0,1,0,2,2,2,0,2,0,0,0,4,0,1,1,2,0,0,0,0,0,0,0,2,0,0,0,0,0,
+    2,0,0,0,2,0,2,0,2,0,0,0,0,0,7,0,19,0,2,0,2,1,0,0,2,0,2,2,4,1,0,0,
+    0,0,0,2,2,1,2,0,0,0,4,0,0,0,2,0,0,0,0,0,2,0,2,0,2,0,4,1,0,2,2,1,
+    2,2,1,1,1,2,27,1,0,2,2,1,6,0,2,0,2,0,2,0,2,0,2,0,2,1,4,2,2,0,0,0,
+    2,1,2,2,0,1,0,2,1,1,1,2,0,1,0,2,4,1,25,0,6,2,0,1,2,0,4,0,6,0,4,0,
+    4,0,2,0,1,1,0,2,1,1,1,2,4,0,2,1,2,2,2,0,0,1,19,2,6,0,4,1,6,2,4,1,
+    2,2,2,0,0,1,2,0,2,0,0,0,1,0,1,0,19,0,11,0,8,1,10,2,6,0,4,0,3,0,10,0,
+    10,0,2,1,9,2,7,0,2,1,10,0,9,0,10,0,3,2,14,1,3,0,7,0,4,3,45,1,1,2,2,0,
+    2,0,1,0,2,0,0,0,0,0,2,0,0,2,0,1,0,2,2,1,0,0,0,2,0,1,0,0,2,0,0,0,
+    0,0,0,0,2,0,0,0,0,2,0,1,0,0,0,2,2,0,0,1,0,0,2,2,0,0,21,0,7,0,0,0,
+    2,1,1,0,2,0,0,2,2,0,0,1,2,2,1,1,2,2,2,0,0,0,2,0,0,0,0,0,0,0,2,0,
+    0,1,0,0,2,0,1,0,2,0,0,0,0,0,2,0,2,0,1,0,2,0,2,0,1,1,2,2,0,1,2,2,
+    0,1,0,2,0,1,2,2,0,1,0,0,2,2,0,1,0,0,0,0,2,0,1,0,2,0,27,0,5,0,0,0,
+    2,0,2,0,2,0,2,1,2,2,0,0,2,0,0,0,0,0,2,0,0,1,0,0,2,0,0,0,0,0,0,0,
+    2,2,0,1,0,0,2,0,0,0,2,0,0,0,2,0,0,0,2,0,0,0,0,0,2,0,2,0,0,0,2,0,
+    0,0,2,0,0,1,0,0,2,0,19,2,13,0,2,0,2,0,2,1,2,0,0,0,0,0,4,0,0,0,0,1,
+    2,2,0,0,2,0,0,0,0,1,2,0,2,0,0,0,2,2,2,1,0,0,1,0,2,0,0,0,2,0,0,0,
+    2,0,0,0,0,0,2,0,0,0,2,0,2,0,33,1,4,0,0,0,2,0,4,2,0,0,2,1,2,0,2,0,
+    2,0,0,0,1,0,2,0,4,0,2,0,2,0,0,0,0,0,2,0,0,0,2,0,2,0,0,0,4,0,2,0,
+    2,1,0,2,25,1,3,0,2,0,0,0,0,2,2,1,6,0,0,0,4,0,0,0,2,2,2,1,4,2,2,1,
+    4,0,0,0,2,0,0,0,0,0,0,1,0,2,2,1,11,2,13,1,2,0,2,0,2,0,0,0,4,0,6,0,
+    4,0,4,0,2,0,1,0,0,0,0,0,3,1,4,2,4,0,0,1,11,2,9,1,2,0,4,0,6,0,8,2,
+    4,1,0,0,4,2,0,1,2,2,2,1,2,2,0,1,15,0,3,1,7,2,2,0,8,0,4,1,6,0,5,2,
+    10,1,10,2,2,0,19,1,6,2,4,0,10,1,9,0,2,0,4,0,4,0,4,0,1,5,45,2,2,0,1,1,
+    0,0,2,0,0,0,2,2,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,2,2,0,1,0,0,0,0,
+    2,0,0,0,0,2,0,0,0,1,2,0,0,2,0,1,0,0,2,2,0,0,0,0,27,0,3,0,2,0,0,0,
+    2,0,0,0,0,0,2,1,0,2,2,0,0,1,2,2,0,0,1,0,2,1,0,0,0,0,2,0,2,0,1,0,
+    2,0,2,0,1,0,2,0,0,0,0,2,2,1,2,0,1,0,2,0,2,1,1,2,2,0,0,0,0,0,2,0,
+    0,0,0,1,2,2,0,1,2,2,0,0,0,1,0,2,0,0,0,0,0,0,2,0,31,0,1,1,2,0,2,0,
+    0,0,0,0,2,0,2,0,0,1,4,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,2,0,0,0,0,0,
+    0,0,0,0,2,0,2,2,0,1,0,0,2,1,0,2,0,0,0,0,2,0,2,0,0,0,0,0,2,0,0,0,
+    2,0,0,1,2,2,0,0,11,0,17,0,2,1,0,0,0,0,2,2,0,1,4,0,0,0,0,0,4,1,2,2,
+    1,0,2,0,0,1,0,0,2,2,0,0,0,1,2,0,2,0,2,0,0,0,2,0,1,0,2,0,0,0,2,0,
+    0,0,0,0,2,0,0,1,0,2,2,0,27,0,1,0,0,0,2,0,2,0,2,1,2,0,2,0,2,0,2,0,
+    0,2,4,1,0,0,0,0,0,0,0,0,4,0,2,0,2,0,0,0,2,0,1,1,2,2,4,0,0,1,2,2,
+    2,0,2,1,23,2,2,0,3,1,2,0,0,0,2,0,0,0,4,0,2,0,2,0,2,0,0,0,2,1,4,2,
+    2,0,2,0,2,0,0,1,2,2,0,0,0,1,0,2,21,1,0,2,2,1,2,0,2,0,0,0,0,0,2,0,
+    4,0,6,0,4,0,4,0,1,0,3,0,4,0,3,0,0,1,4,2,19,1,2,2,1,1,4,2,2,0,2,1,
+    8,2,8,0,0,1,4,2,0,1,6,0,0,0,0,0,7,0,5,2,2,1,5,0,0,0,4,0,1,0,6,1,
+    5,2,10,0,10,1,7,2,5,0,8,1,8,2,1,0,1,1,1,2,10,0,0,1,2,3,45,1,0,0,2,2,
+    0,0,2,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,0,2,0,0,2,0,
+    0,0,0,0,0,1,2,0,0,0,0,0,0,0,2,0,0,2,0,0,3,0,27,1,2,0,2,0,1,0,2,0,
+    0,0,2,0,0,0,0,2,2,1,0,0,0,2,2,1,0,0,2,0,0,2,0,0,2,0,1,1,2,0,2,0,
+    1,0,2,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,2,0,1,0,2,0,0,0,2,1,0,2,0,1,
+    2,2,0,0,0,1,0,2,0,1,2,0,0,2,0,1,0,0,2,0,1,0,29,0,0,0,0,2,2,1,0,0,
+    2,0,0,0,2,0,0,0,2,0,0,0,2,0,2,0,0,0,0,0,2,0,0,0,2,0,0,0,0,0,2,0,
+    0,1,2,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,2,0,
+    0,1,2,2,0,0,3,0,23,1,0,0,0,2,2,1,0,0,0,0,4,2,1,1,4,0,0,0,2,0,0,0,
+    4,0,0,1,0,2,2,0,0,1,0,0,2,2,0,1,2,0,0,2,2,1,2,0,0,0,1,0,0,0,0,0,
+    2,0,2,0,0,0,0,0,2,1,15,0,15,0,4,0,0,0,2,0,0,2,2,0,2,0,2,0,0,0,2,0,
+    4,1,0,0,4,0,0,0,1,0,2,0,0,0,4,0,2,0,2,0,0,0,2,0,0,0,0,0,2,0,2,1,
+    0,2,15,0,1,1,2,0,0,2,1,0,2,1,0,0,2,0,2,2,0,1,2,0,2,0,0,0,0,0,2,0,
+    2,0,4,1,2,2,2,0,0,1,2,2,0,0,0,1,23,2,2,1,2,0,2,2,2,1,4,0,0,0,1,0,
+    4,0,2,0,4,0,4,0,4,0,2,0,3,0,0,1,1,2,1,1,17,2,4,1,4,2,3,0,6,1,4,2,
+    2,0,6,1,6,2,0,1,4,0,0,2,4,1,2,2,5,1,1,0,5,0,4,0,3,0,0,0,4,0,1,0,
+    6,0,3,1,8,2,8,0,11,1,2,2,0,0,10,1,5,2,0,1,4,0,4,2,0,5,43,2,0,0,0,0,
+    2,0,1,0,2,0,0,1,2,2,0,0,0,0,0,0,0,0,2,0,1,0,2,0,0,0,2,0,0,0,0,0,
+    0,0,2,0,0,0,0,0,0,0,0,2,2,1,0,2,0,1,7,0,23,0,2,2,2,0,1,0,2,0,0,0,
+    2,0,0,0,2,0,0,1,0,0,2,2,0,1,0,2,2,0,0,1,0,0,2,0,1,0,2,2,0,0,0,1,
+    2,0,0,0,2,0,0,0,0,2,2,1,0,0,0,0,2,0,1,0,2,0,0,1,2,2,1,0,2,1,0,2,
+    0,1,2,0,0,2,2,1,0,2,0,1,0,0,2,2,0,0,3,1,27,0,1,0,4,0,0,0,0,0,2,0,
+    0,0,2,0,0,0,2,0,0,0,2,0,0,0,2,1,2,0,2,0,0,0,0,0,0,0,0,0,2,0,0,0,
+    2,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,2,0,1,0,2,0,0,0,2,0,0,0,2,0,0,1,
+    2,2,0,0,0,1,31,0,2,2,2,1,2,0,0,2,2,1,0,0,0,0,4,0,0,0,2,1,0,2,2,0,
+    2,1,0,2,2,0,2,1,0,2,0,1,0,0,2,0,0,0,2,0,0,2,2,0,2,1,0,0,0,0,1,0,
+    0,0,0,0,2,0,2,0,3,0,27,0,2,0,0,0,2,0,2,0,4,1,1,0,4,0,0,0,2,0,2,0,
+    0,0,2,0,2,0,2,0,2,0,0,2,0,1,0,0,2,0,4,0,2,0,2,0,0,1,0,2,0,0,2,0,
+    2,1,25,2,2,0,4,0,6,1,0,0,1,0,0,0,0,2,0,1,4,0,0,0,2,0,4,0,0,0,1,0,
+    2,0,2,0,2,1,4,2,2,0,2,1,0,2,7,0,11,1,0,0,0,2,2,1,0,0,2,2,4,1,2,0,
+    1,0,2,0,2,0,4,0,2,0,4,0,2,0,1,0,2,0,0,0,25,0,4,0,6,0,6,1,3,2,2,0,
+    4,1,2,2,4,1,6,0,1,2,2,1,0,2,6,1,3,2,2,1,5,0,5,0,6,0,0,0,2,1,2,2,
+    1,0,2,0,0,0,2,1,10,2,13,0,6,1,0,0,2,0,0,2,4,1,6,0,1,5,43,0,0,0,2,0,
+    0,0,0,2,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,2,0,1,0,2,0,0,0,0,0,0,0,
+    2,0,0,0,0,0,0,0,0,2,2,1,0,0,0,0,11,2,19,0,2,0,2,1,0,0,2,0,0,0,0,0,
+    0,0,2,0,0,0,2,0,0,2,0,1,0,0,0,0,2,0,0,2,2,1,1,0,2,0,2,0,1,0,2,0,
+    0,0,0,0,2,0,2,0,1,0,0,0,2,0,0,0,0,1,2,2,2,0,0,0,0,1,0,2,0,0,2,1,
+    0,0,0,2,2,1,0,2,0,1,2,2,0,1,0,0,3,0,27,2,1,1,4,0,1,0,4,0,0,0,0,0,
+    0,0,2,0,0,0,2,0,0,1,0,0,4,0,0,2,2,0,0,0,2,1,2,0,0,0,2,0,0,0,2,0,
+    0,0,0,0,0,2,0,1,2,0,0,0,0,2,2,1,1,0,4,0,1,0,2,0,0,0,2,0,1,1,2,2,
+    0,0,2,1,31,2,2,0,2,1,2,2,2,1,0,0,2,2,0,1,0,0,0,0,2,0,2,0,0,0,2,1,
+    0,2,4,0,2,1,0,2,0,1,2,2,0,1,0,2,2,0,0,1,2,0,0,0,2,2,2,0,2,0,0,1,
+    1,0,0,0,0,0,0,0,31,0,2,0,2,0,2,0,2,0,0,1,0,0,4,0,1,0,4,0,2,0,0,0,
+    2,0,2,0,0,0,2,0,2,2,2,1,2,0,0,0,0,2,0,1,4,0,2,0,2,0,0,0,0,0,0,0,
+    19,0,5,1,4,0,4,0,2,0,4,0,2,0,1,2,0,1,0,0,1,0,6,2,0,1,2,0,2,0,2,1,
+    1,2,0,0,2,0,2,1,4,2,2,0,2,1,21,0,0,2,0,0,2,1,0,0,4,2,2,1,1,0,6,0,
+    0,0,0,0,2,2,0,1,6,0,2,0,2,0,4,0,1,0,3,0,7,0,5,0,0,0,2,0,4,0,0,1,
+    0,2,4,1,0,0,6,2,8,1,1,2,2,1,1,0,1,0,6,0,4,2,3,1,7,0,4,0,1,0,4,0,
+    0,0,2,0,1,0,3,0,10,0,3,1,7,0,8,2,8,1,3,0,0,2,4,1,2,3,43,0,2,0,0,0,
+    0,0,2,1,0,0,0,2,0,1,0,2,2,1,1,2,2,0,0,0,0,0,2,0,1,0,2,0,2,0,1,0,
+    0,0,2,0,0,0,0,0,2,0,0,0,1,0,13,2,15,1,4,0,0,0,0,2,0,0,0,1,2,0,2,0,
+    0,0,0,0,2,2,0,0,0,1,0,0,2,2,2,0,1,1,2,0,0,2,2,1,0,0,1,0,2,0,0,0,
+    2,0,0,0,0,0,0,0,2,1,0,2,0,0,2,0,0,0,2,1,1,2,2,0,0,0,2,1,0,0,0,2,
+    2,0,0,1,0,2,0,1,2,0,1,0,2,2,5,1,25,0,0,0,2,0,0,0,2,0,1,1,4,2,0,0,
+    2,0,0,0,0,1,0,0,2,2,2,0,0,1,2,0,0,0,2,0,2,2,0,1,2,0,0,0,2,0,0,0,
+    0,0,2,2,0,1,0,0,0,0,0,0,2,0,0,0,2,2,0,1,0,0,2,0,0,0,1,0,2,0,2,0,
+    0,1,29,2,0,0,2,1,0,2,2,1,2,2,2,1,0,0,2,0,2,0,0,0,0,0,0,0,2,0,0,0,
+    2,0,0,1,2,2,2,1,2,2,0,1,2,2,0,1,0,0,2,2,0,1,2,0,0,0,2,0,0,0,2,2,
+    2,1,1,0,0,0,25,0,5,0,2,0,0,1,2,0,2,0,2,2,2,0,0,0,2,1,0,0,0,0,4,0,
+    2,0,0,0,2,2,0,0,4,1,0,0,2,0,0,2,0,1,2,0,0,0,0,0,4,0,2,1,2,0,0,0,
+    29,2,0,0,4,0,2,0,4,0,4,0,2,0,4,1,1,0,0,0,2,0,3,0,4,0,0,0,2,0,4,0,
+    2,1,0,2,1,0,2,0,0,1,2,0,2,2,17,0,2,1,0,0,0,0,0,2,0,1,2,0,6,0,1,2,
+    4,1,2,0,1,0,2,0,2,0,6,0,4,0,2,0,2,0,17,0,2,0,4,0,3,1,3,2,2,1,2,2,
+    0,1,0,0,6,2,1,1,4,2,8,1,2,0,2,2,9,1,6,2,6,1,0,0,3,1,5,2,4,0,0,0,
+    6,1,3,2,4,1,19,2,14,1,12,0,11,2,2,1,4,2,6,0,0,1,0,0,1,5,41,0,0,0,0,0,
+    0,0,2,2,0,0,2,1,1,2,2,1,0,2,0,0,0,1,2,2,0,0,0,0,2,0,1,0,0,0,2,0,
+    0,0,0,0,0,0,2,0,0,0,0,0,17,0,11,0,2,2,1,1,2,0,0,0,2,0,2,2,0,0,0,1,
+    0,0,2,2,0,1,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,2,0,0,0,0,0,
+    0,0,2,0,0,0,0,0,0,0,2,1,0,2,0,0,2,0,1,0,2,1,0,0,0,0,2,2,0,0,0,1,
+    0,0,2,2,0,1,2,0,1,2,2,1,5,0,25,2,2,1,0,0,0,0,0,0,2,0,2,0,1,0,2,0,
+    0,0,2,1,2,2,2,0,0,1,0,0,0,2,2,0,2,1,2,0,0,0,2,2,2,0,0,0,0,0,0,0,
+    2,0,0,1,0,0,2,0,0,0,2,0,1,0,0,0,2,0,0,0,2,0,1,0,2,0,2,1,0,2,1,1,
+    23,2,5,0,0,1,2,2,2,1,2,0,0,0,2,0,4,0,0,0,0,0,2,0,0,1,2,2,0,1,2,2,
+    2,1,0,2,2,1,0,2,2,1,2,2,0,1,2,2,0,1,0,0,2,2,1,0,4,0,0,1,0,0,2,0,
+    0,0,2,0,11,0,19,0,0,0,0,1,2,2,2,0,2,0,2,0,2,1,2,0,0,2,0,0,2,0,0,0,
+    0,0,4,0,0,1,2,0,0,0,2,2,0,0,4,1,2,0,1,0,0,0,2,0,0,0,2,0,4,0,21,0,
+    3,1,0,0,1,0,2,0,2,0,4,0,4,0,2,0,4,0,0,0,1,2,4,1,1,0,0,0,4,0,0,0,
+    2,0,2,1,2,2,1,0,0,0,2,0,7,1,13,0,6,0,2,2,0,0,2,1,0,0,2,0,0,0,2,0,
+    2,0,0,0,6,0,0,0,0,0,2,0,4,0,4,0,2,0,11,0,1,0,0,0,4,0,2,0,3,0,0,1,
+    0,0,1,2,0,1,6,0,0,0,4,0,6,2,0,1,9,0,2,0,8,0,6,0,2,2,5,1,3,0,4,0,
+    0,0,6,0,5,0,1,1,7,2,12,0,6,0,7,0,6,0,6,1,7,0,1,2,4,5,41,0,2,0,0,2,
+    0,0,0,1,0,2,0,0,2,0,0,0,0,0,2,1,0,2,1,0,2,0,0,0,0,0,2,0,0,0,0,0,
+    2,0,1,0,2,0,0,0,0,0,23,0,5,2,0,1,2,0,0,2,2,1,0,0,0,0,0,0,2,0,0,2,
+    2,0,0,1,0,0,2,0,0,0,0,2,2,1,0,0,0,2,0,1,2,0,0,0,0,0,0,0,0,0,2,0,
+    0,0,0,0,2,0,0,0,2,0,0,0,0,1,2,0,0,0,2,2,0,0,0,0,0,0,0,1,2,0,0,0,
+    0,2,0,1,2,0,1,2,2,1,7,2,23,1,2,0,0,0,2,0,2,0,0,0,0,0,0,0,2,0,2,0,
+    0,1,0,2,0,0,0,1,2,2,2,0,0,1,0,0,2,2,0,1,2,0,2,0,0,0,2,0,2,0,0,0,
+    0,0,2,0,0,0,0,0,2,0,1,2,2,1,2,0,1,0,0,0,2,0,0,0,0,0,0,0,2,0,23,0,
+    9,0,2,1,2,0,2,0,2,0,0,2,4,1,0,0,0,0,4,0,0,1,0,2,2,0,0,0,2,0,0,1,
+    0,2,4,1,1,2,2,1,2,2,2,1,2,2,0,1,0,2,0,0,2,1,2,0,1,0,2,2,2,1,0,0,
+    2,0,0,0,25,0,0,0,1,1,2,2,0,0,0,0,0,1,2,0,0,2,2,0,4,1,0,0,2,0,0,0,
+    0,0,0,2,4,0,2,0,0,0,2,1,0,0,0,0,2,0,2,0,0,0,0,0,0,0,2,0,2,0,25,0,
+    4,1,2,0,0,0,3,0,0,0,2,0,4,0,4,2,4,0,2,0,2,1,1,0,0,0,4,0,3,0,4,0,
+    2,0,2,0,2,1,0,0,0,0,1,2,23,0,4,0,2,0,6,1,4,0,0,0,1,0,0,0,0,2,4,1,
+    2,0,2,2,0,1,4,0,0,0,0,0,2,0,4,2,4,1,11,0,4,0,1,0,1,0,4,1,2,0,1,0,
+    2,2,0,1,1,0,1,2,4,1,0,2,2,1,8,0,13,2,2,1,2,0,10,0,6,0,2,0,3,0,5,0,
+    2,0,0,1,6,2,13,0,2,1,4,2,14,1,3,2,0,1,4,0,3,2,5,1,8,5,39,0,1,2,2,1,
+    2,0,1,2,2,1,0,2,0,1,0,2,0,1,2,2,0,0,2,0,1,0,2,1,0,0,0,0,0,0,2,2,
+    1,0,2,0,0,0,0,0,27,1,1,2,0,0,2,0,0,0,2,0,0,2,2,1,0,0,0,0,0,0,2,0,
+    0,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,2,1,0,2,
+    0,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,0,1,0,0,2,0,2,0,0,0,0,0,0,2,
+    2,1,1,0,0,0,2,0,9,0,21,0,0,0,2,0,0,0,2,0,2,0,0,0,0,0,2,0,0,0,0,1,
+    2,2,2,0,0,1,0,2,2,1,0,0,2,2,2,1,1,0,4,2,0,0,0,1,2,0,2,0,0,0,2,0,
+    0,0,0,0,2,0,0,0,0,0,0,0,2,0,1,2,2,1,0,0,0,0,2,0,0,1,0,2,21,1,9,2,
+    0,1,2,0,0,2,2,1,2,2,2,1,0,0,4,0,0,0,0,0,2,0,2,0,0,0,2,1,0,2,0,0,
+    2,1,0,2,2,1,2,2,1,1,2,2,2,1,2,2,2,0,0,1,0,2,0,1,2,0,0,0,2,0,2,0,
+    0,2,19,1,5,0,2,0,2,0,3,0,0,0,2,1,2,2,0,0,2,1,0,0,0,2,4,0,0,0,2,0,
+    2,0,0,1,0,0,0,0,2,0,2,0,2,0,0,0,0,0,2,0,2,0,0,0,0,1,0,0,29,0,2,0,
+    4,2,4,0,4,0,2,0,0,0,1,0,0,0,2,1,2,0,6,0,2,0,2,0,0,0,1,0,4,0,1,0,
+    0,0,2,0,2,0,4,0,0,0,0,1,29,0,4,0,2,0,2,0,4,0,6,2,4,0,1,0,0,1,1,0,
+    2,2,4,1,2,0,0,0,2,2,0,1,0,0,2,0,4,0,13,0,6,0,6,0,1,0,3,0,6,0,2,0,
+    1,1,2,0,0,2,1,1,0,0,2,0,0,0,1,0,9,0,6,0,2,0,2,2,10,1,6,0,0,0,3,0,
+    3,0,2,0,2,1,7,2,2,0,3,0,14,0,6,1,7,2,0,0,10,1,0,0,1,5,39,2,0,1,0,0,
+    0,2,2,1,0,0,0,0,0,2,2,1,0,2,0,0,0,0,0,1,2,0,0,2,0,0,0,0,2,0,1,1,
+    2,0,0,2,3,0,25,0,2,0,0,1,0,2,0,2,2,1,0,0,0,0,2,0,0,0,2,0,0,0,0,0,
+    0,0,2,0,2,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,2,0,1,0,2,0,
+    0,0,2,0,0,0,0,0,0,0,2,0,0,1,0,0,0,0,2,0,0,2,0,0,2,0,0,0,0,0,2,1,
+    1,0,2,0,0,2,9,1,19,2,0,1,0,0,0,0,4,0,0,0,0,0,2,0,2,1,1,2,2,1,0,2,
+    2,0,1,1,4,2,0,1,0,2,0,1,2,0,0,2,2,1,0,0,2,0,2,2,0,1,0,0,2,0,0,0,
+    2,0,0,0,0,0,2,0,0,2,2,1,0,0,0,0,0,0,2,0,1,0,0,0,2,0,17,0,13,0,2,1,
+    2,0,1,2,2,1,0,0,0,0,2,0,2,0,2,0,2,0,2,0,2,0,0,0,0,0,0,0,2,1,2,2,
+    0,0,0,1,2,2,0,1,2,0,0,0,0,2,2,1,2,0,2,2,0,1,2,2,0,1,2,0,1,0,0,0,
+    5,0,19,0,4,0,2,0,2,0,2,0,1,1,0,2,0,0,2,1,0,2,2,0,2,0,0,0,2,0,2,0,
+    0,0,2,0,1,1,2,0,2,0,0,0,0,0,4,0,0,0,0,0,2,0,2,1,0,2,5,0,21,0,1,1,
+    2,0,4,0,2,0,6,0,0,0,2,0,0,0,0,0,0,0,2,0,4,0,4,0,2,0,0,0,1,0,2,0,
+    0,0,0,0,2,0,2,0,4,0,17,0,1,0,5,0,0,0,6,0,2,0,2,1,2,0,2,0,0,0,2,2,
+    1,1,2,0,2,0,2,0,2,0,2,0,0,0,0,0,9,0,7,0,8,1,6,0,6,0,2,0,7,0,4,2,
+    4,0,0,0,0,1,0,0,1,2,0,1,2,0,19,2,2,1,8,0,2,0,4,0,2,0,8,0,6,0,0,0,
+    0,0,1,0,0,0,9,1,2,2,6,1,3,2,12,0,5,1,1,0,10,2,4,0,3,5,39,0,2,0,0,0,
+    0,0,0,0,0,2,2,1,0,0,0,2,0,1,0,0,2,0,0,2,0,0,0,0,0,0,2,0,1,0,2,0,
+    0,0,5,1,23,0,0,2,0,0,2,0,2,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,2,0,
+    0,0,2,0,1,0,2,0,0,0,2,0,0,0,0,0,0,1,2,2,1,0,2,0,2,0,0,1,2,2,1,0,
+    2,1,0,0,0,0,0,0,2,0,0,0,0,2,2,0,0,0,0,0,2,1,0,0,0,0,0,0,2,0,1,0,
+    2,0,2,0,13,0,19,0,0,0,2,0,2,0,2,0,0,0,2,0,0,0,2,0,0,0,2,0,1,0,2,0,
+    0,1,2,2,1,1,2,2,0,1,2,2,0,1,2,0,2,2,0,1,0,0,0,0,2,2,2,1,0,0,2,0,
+    0,0,2,0,0,0,0,2,0,1,2,0,1,0,4,0,0,0,0,0,0,1,0,2,15,0,15,1,2,0,0,2,
+    0,0,2,1,2,0,0,2,2,1,0,0,2,0,0,0,2,0,2,0,0,0,2,1,2,0,2,2,0,0,0,1,
+    0,0,2,2,0,1,0,2,4,0,0,0,2,1,0,2,0,1,2,0,2,0,0,0,0,0,0,0,2,2,2,1,
+    31,0,2,0,2,0,2,1,4,2,2,0,4,0,1,0,1,1,0,2,2,0,2,0,0,0,2,0,0,1,0,0,
+    4,0,0,0,2,2,0,0,0,0,0,1,2,0,0,0,2,0,0,0,0,1,2,2,2,0,27,1,0,0,2,2,
+    0,0,2,0,4,0,2,0,6,0,0,0,0,1,0,0,2,0,1,0,2,0,2,0,4,0,2,0,0,0,1,1,
+    2,2,2,1,0,0,0,0,2,0,21,0,4,0,4,0,1,0,1,0,2,0,2,2,6,0,4,0,2,0,1,1,
+    2,0,1,0,0,2,2,0,2,1,0,0,2,0,0,0,27,0,4,0,6,0,6,0,8,0,4,0,4,0,3,1,
+    0,0,4,2,2,0,0,0,0,1,3,0,0,0,15,0,2,0,1,0,8,0,2,0,2,0,4,0,8,0,6,1,
+    3,2,2,0,3,0,1,0,1,0,1,0,0,1,8,0,8,2,3,0,2,1,6,0,0,5,39,0,2,0,0,2,
+    0,1,2,2,0,1,0,2,0,1,0,0,2,2,0,0,0,0,0,0,0,1,0,0,2,0,0,0,0,2,0,0,
+    9,0,19,0,2,0,0,1,2,2,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,
+    2,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,0,0,2,1,0,2,0,1,0,2,0,1,2,0,
+    0,2,0,0,0,0,2,0,0,0,2,0,0,1,0,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,
+    2,0,17,2,15,1,2,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,2,1,0,2,2,1,0,2,0,1,
+    0,2,2,1,0,0,2,0,0,0,0,0,2,0,0,0,0,0,2,2,0,1,2,0,2,0,0,0,0,0,2,0,
+    2,0,1,0,2,2,0,1,2,0,0,0,2,0,1,0,2,0,0,0,2,0,9,1,21,2,0,0,0,0,2,1,
+    2,0,0,0,0,2,2,1,0,0,0,0,0,0,2,0,2,0,0,0,4,0,2,0,2,0,0,1,0,0,2,2,
+    0,0,0,1,2,2,0,1,0,2,2,1,0,2,0,1,2,2,0,1,2,2,2,1,0,2,0,1,2,0,23,0,
+    3,0,0,0,2,0,4,0,0,0,4,1,2,2,2,1,0,2,1,0,0,0,0,0,2,1,2,0,2,2,0,0,
+    0,0,2,0,2,1,2,0,1,0,2,2,0,1,0,0,0,0,2,1,2,2,0,0,11,1,15,2,2,0,2,0,
+    2,0,2,0,0,0,4,1,2,0,4,0,4,2,0,0,0,1,2,0,1,0,0,0,2,0,4,0,2,0,2,2,
+    0,3,1,2,2,0,0,0,7,0,15,0,6,0,4,0,4,0,1,0,1,0,2,1,2,0,2,0,6,2,2,0,
+    0,0,1,0,2,1,1,0,2,0,4,0,0,0,1,0,19,0,5,0,2,0,6,0,8,0,8,0,4,0,2,0,
+    1,0,1,1,4,0,2,0,1,0,4,2,1,0,23,1,2,0,4,0,2,0,4,0,2,0,2,0,6,0,8,0,
+    4,1,3,2,9,0,1,0,10,1,3,2,4,0,7,0,16,1,0,0,1,2,10,0,2,5,37,0,0,0,0,0,
+    2,0,1,0,2,0,0,0,2,2,0,0,0,1,0,0,0,0,0,0,2,2,0,0,0,0,0,0,2,1,13,0,
+    15,0,0,2,0,0,2,0,1,1,2,2,2,0,0,1,0,2,2,0,0,0,0,0,0,0,2,0,0,0,0,0,
+    2,0,0,0,2,0,1,0,2,0,2,0,1,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,
+    0,0,0,0,2,1,2,0,0,0,1,0,2,2,0,0,2,0,0,1,0,0,0,0,0,0,0,0,2,0,2,0,
+    17,2,13,1,0,0,0,0,2,0,0,0,0,0,2,0,2,0,0,1,2,2,0,0,2,0,0,0,2,1,0,2,
+    0,1,0,0,2,2,0,1,2,2,0,1,0,2,0,1,2,0,0,0,2,0,2,0,1,0,2,2,2,1,0,0,
+    0,0,2,2,2,1,0,0,0,0,0,0,0,0,2,1,0,2,0,0,5,0,23,0,2,1,0,0,0,0,0,0,
+    0,2,4,0,0,1,0,0,0,0,2,0,2,0,0,0,0,1,2,2,2,0,0,0,2,0,2,0,2,0,0,1,
+    0,2,2,0,0,1,2,2,1,1,0,2,2,1,2,2,0,1,2,0,0,0,0,0,4,0,0,0,13,0,17,0,
+    4,0,4,0,1,0,2,0,2,0,0,0,4,0,2,0,2,0,2,0,1,0,2,1,0,2,0,0,0,0,2,0,
+    2,1,0,0,2,2,0,1,4,0,0,0,0,0,0,0,2,0,0,0,0,0,0,1,29,2,2,0,2,0,4,0,
+    0,1,0,0,2,0,0,2,2,1,4,0,4,0,4,0,0,2,0,1,2,0,2,0,0,0,0,0,4,0,2,0,
+    2,0,0,0,3,0,4,0,23,0,1,0,2,0,6,0,6,0,4,0,0,0,1,0,0,0,2,0,2,1,4,0,
+    2,0,2,0,3,0,0,0,0,0,0,0,2,0,2,1,23,0,4,0,3,0,0,0,2,0,8,0,8,2,6,0,
+    2,0,1,0,0,0,4,0,4,0,1,1,0,0,21,0,4,0,0,0,0,0,2,1,2,2,2,0,2,0,6,0,
+    10,0,0,0,15,0,6,0,0,0,8,1,5,0,6,2,2,0,10,0,5,1,2,2,4,5,37,0,0,0,2,0,
+    1,0,2,0,0,2,0,1,0,0,0,0,2,2,0,0,0,1,2,0,1,0,2,0,0,0,0,2,17,0,11,0,
+    0,0,2,1,0,0,0,2,4,0,0,0,0,0,0,0,2,0,0,0,0,1,2,2,0,0,0,0,0,1,2,0,
+    0,0,2,0,0,0,2,2,0,0,0,0,2,0,1,1,2,2,0,1,0,2,0,1,2,2,0,1,2,2,0,0,
+    0,1,2,0,0,2,1,0,2,0,2,1,1,0,0,0,2,0,0,2,0,0,2,1,0,0,0,0,0,0,17,0,
+    13,0,2,0,2,0,0,0,0,0,2,0,2,0,1,0,2,0,2,0,0,0,0,0,2,1,0,0,2,2,0,1,
+    0,0,0,2,2,1,0,2,2,1,2,0,0,0,0,2,0,1,2,0,0,0,0,0,2,0,0,0,2,2,0,0,
+    2,0,0,1,0,0,2,0,0,0,0,0,2,0,0,0,0,1,1,0,27,2,0,0,2,0,2,0,0,0,0,0,
+    2,1,1,0,2,0,2,0,0,0,2,0,0,0,2,0,0,0,2,1,1,0,4,0,0,0,2,2,2,0,0,0,
+    2,1,1,2,2,0,0,1,2,2,2,1,1,2,2,1,2,0,0,2,0,1,2,2,0,1,0,2,27,1,2,0,
+    0,0,0,0,4,1,0,2,2,1,2,2,0,0,4,0,2,0,2,0,2,1,1,2,0,0,0,0,2,1,2,0,
+    0,2,2,1,0,0,0,2,2,1,0,0,2,0,2,0,0,1,2,2,0,0,19,0,5,0,1,0,0,1,0,0,
+    4,2,0,0,2,1,2,0,0,2,2,0,2,1,4,0,4,0,2,2,2,1,0,0,2,0,0,0,0,0,2,0,
+    2,0,2,0,4,0,5,0,25,0,6,0,1,0,2,0,4,0,4,0,6,0,2,0,3,0,2,0,0,0,2,0,
+    4,0,2,0,2,0,0,0,1,0,0,1,2,0,23,0,8,0,1,0,2,0,1,0,1,0,0,0,8,1,6,0,
+    6,0,4,0,1,0,1,0,2,0,4,0,0,0,15,0,5,0,6,0,2,0,1,2,4,1,2,0,2,0,2,0,
+    6,0,10,0,9,0,3,0,4,0,4,0,0,0,0,1,3,2,10,0,0,0,3,1,4,5,35,0,0,0,0,0,
+    2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,0,0,0,0,0,0,0,19,1,7,0,0,0,
+    2,0,1,2,2,0,2,1,1,0,2,2,0,1,2,2,0,0,0,1,2,2,0,0,2,1,0,0,0,2,2,0,
+    0,0,0,0,0,0,0,1,2,2,0,1,0,2,2,0,0,1,0,2,0,1,2,2,0,1,0,2,0,1,2,0,
+    0,2,0,0,2,1,0,0,0,0,0,2,2,1,0,0,0,0,2,0,1,0,2,2,0,1,2,0,21,0,9,2,
+    2,1,0,0,0,0,2,0,0,0,2,0,0,0,2,1,1,2,2,0,2,1,0,0,0,2,2,0,0,1,2,0,
+    0,2,2,1,0,0,0,0,0,0,2,2,0,1,2,0,0,0,1,0,2,0,0,0,2,0,2,0,1,0,2,0,
+    0,0,2,0,2,0,0,0,0,0,2,0,0,0,0,0,2,0,31,0,0,1,2,0,0,0,2,0,2,0,2,0,
+    0,0,0,0,0,0,0,0,4,0,1,0,2,0,0,0,2,0,0,0,2,0,1,0,2,0,2,1,0,0,4,2,
+    0,0,2,1,1,2,2,0,0,1,0,2,2,1,0,0,0,2,2,1,0,0,2,0,0,0,29,0,2,0,2,0,
+    0,0,2,0,0,0,2,0,2,0,2,0,0,0,0,0,4,0,2,0,4,0,0,0,0,0,0,1,0,2,0,0,
+    2,1,0,2,2,1,2,0,0,0,2,0,2,0,0,0,0,0,0,0,2,1,25,2,1,0,4,0,2,0,1,0,
+    1,1,4,0,0,2,0,1,2,0,2,0,0,2,2,1,4,0,4,0,2,2,0,0,2,1,2,0,2,0,2,0,
+    0,2,2,1,0,0,13,0,7,0,3,0,6,0,1,0,0,0,6,0,4,0,4,1,4,0,1,0,0,0,2,0,
+    0,0,4,0,4,0,0,0,1,0,0,2,0,1,23,0,0,0,8,0,2,0,1,0,0,0,1,0,2,0,4,0,
+    8,0,6,0,0,0,0,0,0,0,2,0,5,0,5,0,0,0,3,0,4,0,6,1,0,0,4,0,1,0,0,0,
+    4,2,6,1,1,0,3,0,2,0,2,0,8,0,5,0,0,1,2,0,6,0,5,0,2,5,35,0,0,0,0,0,
+    0,0,0,0,2,0,0,2,0,1,2,0,1,0,2,0,0,0,0,0,2,0,0,0,23,0,5,0,0,0,2,2,
+    0,0,2,1,0,0,0,0,2,2,1,0,2,0,0,0,0,1,2,2,0,0,0,1,2,2,0,0,2,0,1,0,
+    2,0,0,0,2,0,0,0,0,0,0,0,2,1,0,2,0,0,2,1,0,2,0,1,2,2,0,1,0,2,0,0,
+    2,1,0,0,0,2,0,1,0,0,2,0,0,2,2,1,1,0,0,0,4,0,1,0,2,0,23,0,7,0,0,0,
+    0,0,2,0,2,0,0,0,2,1,0,2,0,0,2,0,2,1,0,2,0,0,0,0,0,1,2,0,2,2,0,0,
+    2,1,0,0,0,2,2,1,0,2,0,1,2,2,0,1,0,0,2,0,0,2,0,1,0,0,0,0,2,0,2,0,
+    0,0,2,0,1,0,2,0,2,0,0,0,0,0,2,0,31,0,0,0,2,0,0,0,2,0,2,0,0,1,0,0,
+    2,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,2,0,2,1,
+    2,2,2,0,2,1,1,0,2,2,0,1,0,0,0,2,2,1,0,0,2,2,0,1,21,0,7,0,2,0,0,0,
+    4,1,0,2,2,0,0,0,2,0,2,0,2,0,2,0,0,0,2,0,2,0,2,0,2,1,0,2,0,1,0,0,
+    0,0,2,0,2,0,0,0,2,0,0,0,0,0,2,0,2,0,0,0,27,0,1,0,4,0,2,1,0,2,2,1,
+    2,2,1,0,0,1,2,2,2,0,0,1,2,0,0,2,2,0,4,1,4,0,2,0,0,2,2,1,2,0,0,0,
+    2,0,2,0,2,0,21,0,4,0,0,0,3,0,2,0,0,1,1,0,2,0,4,2,6,0,2,0,0,0,0,0,
+    2,0,2,0,2,1,4,0,4,0,3,0,1,0,19,0,2,0,0,0,2,0,6,0,3,0,0,1,1,0,4,2,
+    2,0,6,1,6,0,4,0,0,0,1,0,17,0,8,0,4,0,3,0,0,0,4,0,4,0,1,0,4,0,0,0,
+    1,0,2,0,1,0,8,0,5,0,6,0,0,0,6,0,0,0,9,0,10,0,2,0,0,5,35,1,0,2,0,0,
+    2,0,0,0,0,0,0,0,2,2,0,1,0,0,0,0,0,0,0,0,0,0,25,0,1,2,0,0,2,0,0,1,
+    0,0,0,0,2,2,0,0,0,0,2,1,0,2,2,1,0,2,0,0,2,1,0,2,0,0,2,1,0,0,2,0,
+    0,0,0,0,0,2,2,0,0,1,0,0,0,2,2,1,0,2,0,0,2,1,0,2,1,1,2,2,2,1,0,0,
+    0,2,0,1,0,0,2,2,0,1,0,0,0,0,0,2,2,1,0,0,0,0,0,0,25,0,5,0,2,2,2,1,
+    2,0,0,0,0,0,2,0,0,0,2,1,0,2,0,0,2,0,0,1,0,0,2,0,2,2,1,0,2,1,0,0,
+    2,0,0,2,2,1,0,0,0,0,0,0,0,0,2,0,0,2,0,1,2,0,0,0,0,0,2,0,0,0,0,0,
+    2,0,0,0,2,0,0,0,2,0,0,0,2,0,27,0,1,1,0,0,0,0,2,0,0,0,0,0,2,2,2,0,
+    0,1,2,0,2,0,0,0,0,0,2,0,0,0,0,0,0,1,0,0,2,0,2,0,0,0,0,2,2,0,0,0,
+    2,1,0,2,2,0,2,0,0,1,0,0,2,2,0,1,0,0,0,2,2,1,15,0,15,0,2,0,0,0,4,0,
+    0,0,4,0,0,0,2,0,0,2,2,1,2,0,2,0,2,0,0,1,0,2,4,1,2,2,2,1,0,2,0,1,
+    0,2,0,1,0,2,2,1,0,0,2,0,2,0,0,0,0,0,3,0,21,0,0,0,0,1,2,2,4,1,2,2,
+    2,0,0,1,2,2,1,1,0,0,0,2,2,1,2,0,0,0,0,2,2,1,6,0,2,0,2,0,1,0,4,0,
+    2,0,0,0,0,0,21,0,4,0,2,0,2,0,1,1,2,2,0,0,0,0,0,0,2,0,6,0,4,1,0,0,
+    1,0,2,0,2,2,2,1,2,0,6,0,13,0,11,0,0,0,2,0,2,0,2,0,6,1,0,2,1,0,1,1,
+    4,0,2,2,8,0,4,0,2,0,0,0,13,0,0,0,2,1,2,2,1,0,1,0,4,0,4,1,0,0,2,2,
+    0,1,0,0,9,0,12,0,3,0,1,0,8,0,4,0,1,0,6,0,0,0,0,0,2,5,35,0,2,0,0,0,
+    0,0,0,0,0,0,2,0,0,0,1,2,2,0,0,1,2,2,1,0,27,0,0,0,0,1,2,0,0,0,0,0,
+    0,0,2,2,0,1,2,0,2,0,0,2,0,1,0,2,2,0,0,1,0,2,0,0,0,1,2,2,0,0,0,0,
+    2,0,0,0,2,1,0,0,0,2,2,0,0,1,1,2,2,1,0,0,0,2,2,1,0,0,0,0,2,2,0,1,
+    0,0,2,2,0,1,0,0,0,2,0,1,2,0,0,0,0,0,2,0,1,0,25,0,3,0,2,0,1,0,0,0,
+    2,0,2,0,2,0,0,0,2,0,0,0,2,1,0,0,0,2,2,0,0,0,0,0,0,1,4,0,1,0,2,2,
+    2,0,0,1,0,0,0,2,2,1,0,0,0,0,0,0,2,1,0,2,0,0,2,0,0,0,0,0,0,0,2,0,
+    0,0,0,0,2,0,2,0,0,0,2,0,23,1,5,0,1,2,4,0,0,0,0,0,2,1,0,0,2,0,0,0,
+    2,2,0,1,2,0,0,0,0,0,0,0,2,1,2,0,0,2,2,0,0,0,0,0,2,0,0,1,1,2,2,0,
+    0,0,2,1,0,0,4,0,0,2,2,0,0,1,0,0,0,2,2,1,9,0,23,0,2,0,2,0,2,0,0,0,
+    4,0,0,0,2,0,2,0,2,0,0,0,2,0,2,0,2,0,2,0,2,0,1,0,2,0,2,0,2,1,2,2,
+    1,1,2,0,0,0,0,0,2,0,0,0,0,0,2,0,2,0,29,0,0,0,4,0,2,0,0,0,0,0,2,0,
+    2,1,4,2,2,1,0,2,0,0,0,1,0,2,0,0,2,1,2,0,0,0,0,0,4,0,2,2,4,1,1,0,
+    2,0,2,2,25,1,6,0,0,0,4,0,2,1,0,2,1,0,2,0,2,1,0,0,0,0,2,0,4,2,4,0,
+    2,1,1,0,0,0,4,0,2,0,2,0,15,0,2,0,3,0,1,0,2,0,2,1,2,2,6,0,1,0,0,0,
+    3,0,6,0,4,0,4,0,6,0,4,0,15,1,0,0,4,2,4,1,1,0,3,0,1,0,4,2,2,0,0,1,
+    2,0,0,0,21,0,14,0,14,0,9,0,2,0,6,0,8,0,2,0,5,1,8,0,1,7,33,2,0,0,0,1,
+    0,2,2,0,0,0,0,0,0,0,2,0,0,0,0,2,5,1,25,0,2,0,2,0,0,0,0,0,0,0,2,0,
+    2,2,0,1,0,0,0,0,0,2,2,1,0,2,0,0,2,1,0,2,0,1,2,0,0,2,0,0,2,1,0,0,
+    0,0,2,0,0,2,0,0,0,1,0,0,2,2,2,1,0,0,0,2,0,1,0,0,2,2,0,1,0,0,0,2,
+    2,1,0,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,1,0,27,0,1,1,2,2,1,0,4,1,0,0,
+    0,2,2,0,0,0,2,0,0,0,0,0,2,0,2,0,0,1,0,0,2,0,2,0,0,0,1,2,4,0,0,1,
+    0,0,2,0,0,0,0,0,0,0,0,0,0,0,2,0,0,2,2,1,1,0,2,2,0,1,0,0,2,0,1,0,
+    2,0,2,0,0,0,0,0,2,1,19,0,9,2,0,0,2,0,0,1,2,0,2,0,0,2,2,1,0,0,0,0,
+    2,0,2,0,0,0,2,0,0,0,0,1,0,2,2,0,0,0,0,0,2,0,0,0,2,0,0,0,2,1,1,0,
+    2,0,2,2,0,0,0,0,4,1,0,0,0,2,2,0,0,1,1,0,29,0,0,0,0,0,0,1,4,2,2,0,
+    0,2,2,1,4,2,2,1,0,0,2,0,0,0,0,0,2,1,2,2,2,1,4,2,0,1,0,0,2,2,0,1,
+    4,0,1,2,0,1,2,0,1,0,2,0,2,0,0,0,15,0,11,0,2,0,2,0,2,0,2,1,2,2,2,1,
+    0,2,2,1,0,2,4,0,0,1,0,2,0,1,0,0,0,0,1,0,2,2,2,1,0,0,4,0,2,2,4,1,
+    1,0,2,0,25,0,2,0,6,0,2,1,2,0,2,0,2,1,1,0,0,2,4,1,0,0,0,1,2,0,4,1,
+    4,0,2,0,1,1,0,0,2,1,2,0,17,0,4,0,2,1,1,0,0,1,0,2,4,0,0,0,6,1,0,0,
+    1,0,3,1,2,0,8,0,4,0,4,1,11,2,2,0,2,0,4,0,4,1,3,0,3,1,2,0,6,0,2,0,
+    3,0,0,0,19,1,1,0,16,0,10,0,7,0,6,0,6,0,3,0,4,2,10,0,0,5,33,0,0,1,2,2,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,21,0,2,0,0,0,0,0,0,0,2,0,0,0,0,2,
+    0,1,2,0,0,0,2,2,0,1,0,2,2,1,0,0,0,2,2,1,0,2,0,1,2,0,0,0,0,2,2,0,
+    0,0,0,0,0,1,0,0,2,2,0,0,0,1,0,0,0,2,2,1,2,0,0,2,0,1,0,2,0,1,2,0,
+    0,0,0,0,2,2,0,1,0,0,0,0,0,0,2,0,1,0,27,0,0,0,0,0,0,0,2,0,1,0,4,0,
+    0,1,0,0,2,0,0,0,0,0,2,0,0,0,0,0,2,2,2,0,0,0,0,0,2,0,2,1,1,0,2,0,
+    0,0,0,0,2,2,2,1,1,0,2,0,0,0,0,0,0,0,0,0,2,0,0,0,0,2,0,1,2,0,2,0,
+    0,0,0,0,0,0,2,1,17,2,13,0,2,0,2,1,2,0,0,2,2,1,0,0,2,0,0,2,0,1,2,0,
+    0,0,0,0,2,0,0,0,4,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,4,0,0,0,2,0,
+    0,0,1,1,2,0,2,0,0,2,2,0,2,1,0,0,0,0,33,0,0,0,2,0,2,0,2,2,0,1,2,0,
+    2,0,2,0,0,0,2,0,2,0,2,0,0,1,2,2,0,0,2,0,2,0,0,1,2,2,2,0,2,1,2,0,
+    0,0,2,0,1,0,0,0,2,0,0,0,0,0,2,0,27,0,2,0,2,0,0,1,2,2,2,0,0,0,2,0,
+    4,1,0,0,2,1,0,1,2,0,2,1,0,0,0,1,0,2,2,1,1,1,2,0,0,0,0,1,2,1,2,2,
+    4,1,25,0,1,0,2,1,4,0,4,0,4,0,4,0,2,0,0,0,1,1,1,2,4,1,2,0,1,0,2,0,
+    2,0,4,1,4,0,0,0,0,2,2,1,19,2,6,1,6,2,2,1,5,2,0,1,0,0,2,1,2,2,4,0,
+    4,1,3,2,3,0,0,1,6,0,4,2,9,0,6,0,2,1,2,0,4,0,6,0,3,0,5,0,2,0,6,0,
+    4,1,0,0,21,0,1,2,4,1,14,0,0,0,1,0,4,0,4,1,4,2,0,0,4,5,33,1,0,2,0,0,
+    0,0,2,0,0,0,0,0,0,0,2,0,9,0,19,0,0,0,0,0,2,0,0,0,2,0,0,0,2,2,0,1,
+    0,0,0,0,2,2,0,1,2,2,0,1,0,2,2,1,0,0,0,2,0,1,2,2,0,0,0,1,2,0,0,0,
+    0,0,0,0,0,2,2,0,0,1,2,0,0,0,0,2,2,1,1,0,0,0,0,0,2,0,2,0,0,2,0,1,
+    0,2,2,1,1,0,2,0,0,0,0,0,2,0,3,1,27,2,0,0,0,1,2,2,0,0,2,0,2,0,1,0,
+    2,0,0,0,2,0,2,0,0,0,0,0,2,0,0,0,0,1,2,0,0,0,2,0,0,0,2,0,0,0,0,0,
+    2,0,0,2,0,1,0,0,4,0,1,0,2,0,1,0,2,0,0,0,2,0,1,0,2,0,2,0,1,0,0,0,
+    2,0,0,0,2,1,17,2,15,0,2,1,2,0,2,2,0,1,2,0,2,2,0,1,2,0,0,0,2,0,2,0,
+    0,0,0,0,0,0,2,0,0,1,2,2,0,0,0,0,0,0,2,1,2,2,0,0,0,0,0,0,2,0,2,0,
+    0,0,2,0,0,0,0,0,0,1,0,0,2,0,2,0,23,0,5,0,0,0,0,0,0,0,2,0,0,0,2,2,
+    2,1,0,0,2,0,2,0,2,0,2,0,2,0,0,0,2,0,0,1,0,2,4,0,2,1,2,0,0,0,0,0,
+    2,2,0,1,4,0,0,0,1,0,2,1,0,0,25,1,1,1,2,1,2,0,2,1,2,1,0,0,2,1,0,0,
+    0,0,2,0,2,0,2,0,2,0,2,1,0,0,2,0,1,1,0,2,2,0,0,0,2,1,0,0,0,2,2,1,
+    2,0,25,0,0,0,2,0,2,1,4,2,2,0,4,0,4,0,2,1,2,0,1,0,1,0,2,0,2,1,0,0,
+    2,0,2,0,4,2,2,0,2,1,21,2,0,1,4,2,6,1,6,2,4,1,3,2,1,1,0,2,2,1,0,1,
+    2,2,4,0,1,1,3,2,0,1,5,2,0,1,6,0,2,2,4,1,4,2,6,1,6,2,5,1,7,0,4,0,
+    4,0,2,0,5,0,3,1,5,2,8,0,10,1,3,0,0,0,4,0,0,1,0,0,2,7,31,2,0,0,0,0,
+    0,0,0,1,0,0,2,0,0,0,15,0,13,2,0,0,2,0,2,0,0,0,0,0,0,0,0,0,2,0,0,0,
+    2,0,0,0,0,0,0,2,0,1,2,2,2,1,0,2,0,1,0,0,2,2,0,1,0,0,0,2,0,0,2,1,
+    0,0,0,2,2,1,0,0,0,0,0,0,2,2,0,1,0,0,2,0,0,2,2,1,1,2,0,1,2,0,0,0,
+    2,0,1,0,2,0,0,0,0,0,2,0,5,0,25,0,0,0,2,0,2,0,0,0,0,0,0,0,2,0,2,0,
+    0,0,0,0,0,0,0,0,4,0,0,1,0,0,2,0,0,0,0,0,2,0,2,0,0,0,0,0,2,0,0,0,
+    0,2,2,1,0,0,2,0,1,0,2,0,0,0,0,0,0,0,2,2,0,1,2,0,0,0,1,0,2,0,0,0,
+    0,0,2,1,19,2,13,0,2,1,2,2,0,0,2,1,2,2,2,1,0,0,2,2,0,1,2,0,0,0,0,0,
+    2,0,0,0,2,0,0,0,2,0,0,0,2,0,0,1,2,0,0,2,0,1,2,0,0,0,0,0,0,0,0,0,
+    4,0,0,0,2,0,0,0,0,0,2,0,0,0,15,0,15,0,2,0,0,0,0,0,2,2,0,1,2,0,0,0,
+    0,0,4,2,0,1,2,0,2,0,0,0,4,0,2,1,0,2,0,0,0,1,2,0,0,0,2,1,2,1,4,1,
+    0,1,2,1,0,0,2,1,2,0,1,0,5,1,23,0,0,0,2,0,4,1,2,2,0,0,4,0,2,1,0,0,
+    2,0,0,0,2,0,2,0,2,0,0,2,2,0,2,0,2,0,0,1,0,0,1,0,0,0,0,0,4,1,1,0,
+    27,2,3,1,8,0,2,0,1,0,4,0,4,0,4,1,4,2,4,0,2,0,4,1,1,0,3,0,2,0,2,0,
+    0,0,2,0,2,0,4,0,2,0,23,0,4,0,2,0,2,0,6,0,6,0,4,1,1,0,1,0,1,0,4,0,
+    1,0,2,1,2,2,0,1,1,2,27,1,8,2,12,0,8,1,0,0,2,0,4,2,6,1,6,0,5,0,7,1,
+    6,2,9,1,6,2,2,1,3,0,1,0,12,2,0,1,3,0,8,0,1,0,1,0,2,5,31,1,0,0,0,0,
+    2,0,1,2,2,0,0,0,17,0,9,0,0,1,0,2,0,0,0,0,2,0,0,0,2,0,0,0,0,0,2,0,
+    0,0,0,0,2,0,0,0,2,0,1,0,0,2,2,1,0,2,2,1,0,0,0,0,0,0,2,0,2,0,1,2,
+    2,0,0,1,0,0,0,0,2,2,0,0,0,1,2,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,2,0,
+    1,0,2,0,0,0,2,0,0,0,5,0,25,0,0,0,2,0,0,1,0,2,2,0,2,0,2,0,1,0,0,1,
+    2,0,2,0,0,0,0,0,0,0,2,2,0,0,2,0,2,0,0,0,2,0,1,0,4,1,0,0,0,0,2,2,
+    1,1,2,0,0,0,0,0,2,0,0,2,2,1,0,0,0,0,0,0,0,0,0,0,2,0,2,0,0,0,0,0,
+    0,1,19,2,13,0,0,1,2,2,0,1,4,0,0,2,2,1,2,2,2,1,0,0,2,0,0,0,2,2,0,1,
+    0,0,2,0,0,0,2,1,1,2,2,0,2,1,0,2,0,0,2,0,0,0,0,0,2,0,0,0,2,0,0,0,
+    0,0,2,0,0,0,2,0,0,0,0,0,7,0,23,1,2,0,2,0,4,2,0,0,1,1,2,0,0,2,0,1,
+    2,0,0,0,4,0,0,0,0,1,2,1,0,0,2,1,4,3,2,1,0,0,1,1,4,1,2,0,2,0,0,2,
+    2,1,2,2,2,1,0,2,2,1,0,0,31,0,2,0,2,0,0,0,0,0,4,0,2,0,0,1,2,2,4,0,
+    0,0,2,0,0,1,2,0,0,0,2,0,2,0,2,0,2,0,0,0,0,1,0,0,0,0,0,2,1,0,0,0,
+    29,1,4,0,0,0,4,0,6,0,1,0,2,0,4,0,4,0,6,0,4,0,2,1,2,0,0,0,1,0,1,0,
+    2,0,2,0,1,0,2,0,4,0,19,0,1,0,4,1,4,2,2,1,6,0,6,2,4,0,1,1,1,0,3,0,
+    6,0,0,0,2,0,0,0,1,0,27,0,0,1,10,0,8,0,6,2,0,1,2,0,4,0,8,0,6,0,7,0,
+    3,1,7,2,4,1,2,2,4,0,3,1,4,0,6,0,0,0,2,2,6,1,3,0,2,7,31,2,0,0,2,0,
+    1,0,2,0,0,0,21,0,5,0,0,0,0,0,2,1,0,0,0,2,0,0,2,0,0,0,2,0,0,0,0,0,
+    0,0,2,0,0,0,2,0,1,2,2,1,2,0,1,0,2,0,0,0,0,0,2,2,0,1,2,0,1,0,2,0,
+    0,0,2,0,0,0,0,2,0,1,2,0,0,0,0,0,0,0,0,2,2,1,0,0,0,0,2,0,1,0,0,0,
+    2,0,2,0,0,0,0,0,7,1,23,2,2,1,0,2,0,1,2,2,2,0,0,0,0,0,0,1,2,0,2,2,
+    1,0,2,0,0,0,2,0,0,1,0,0,2,0,0,0,0,0,2,0,0,0,2,0,0,2,2,0,0,0,0,1,
+    4,0,1,0,2,0,0,0,0,0,2,0,1,0,2,2,2,1,0,0,0,0,0,0,0,0,0,0,0,0,2,0,
+    17,0,13,0,2,1,0,2,0,1,2,2,1,1,2,0,4,0,0,0,0,0,4,0,0,2,2,1,0,1,2,2,
+    0,0,0,0,0,0,2,0,2,0,0,0,0,0,2,0,2,0,1,0,0,0,2,0,0,0,2,0,0,0,2,1,
+    1,0,2,0,2,0,0,0,2,0,1,0,31,0,2,2,4,0,0,0,0,1,4,0,2,0,1,1,0,1,2,1,
+    0,0,0,3,0,0,0,1,2,1,2,2,2,1,0,0,2,0,2,0,4,0,0,0,1,0,2,0,0,0,4,1,
+    2,2,2,1,0,2,2,1,0,2,13,1,9,0,1,0,0,0,2,0,0,0,0,0,4,0,2,0,2,0,0,0,
+    2,1,2,0,2,2,0,0,2,1,2,0,0,0,0,0,2,0,4,1,0,2,2,0,0,0,0,1,0,0,33,0,
+    4,0,2,0,0,0,4,0,2,2,4,1,0,0,0,0,2,1,2,0,4,0,4,2,4,1,4,0,0,0,1,0,
+    0,0,1,0,4,1,1,2,23,0,0,1,8,2,0,0,2,1,4,2,2,0,6,1,6,0,4,0,0,0,0,2,
+    3,1,4,0,0,0,2,0,0,0,25,1,1,2,3,1,10,2,10,1,6,0,0,0,2,0,2,0,8,0,6,0,
+    9,0,15,0,10,0,6,0,3,1,6,2,5,1,10,0,1,0,0,0,6,0,1,0,2,5,31,0,2,0,1,1,
+    2,2,0,0,23,0,3,0,0,0,0,0,0,0,2,0,0,0,2,1,0,2,0,0,2,0,0,0,0,0,0,0,
+    2,0,0,0,0,0,0,0,2,0,2,0,1,0,2,0,0,0,2,2,0,1,0,0,2,2,1,1,2,0,0,0,
+    0,0,0,0,2,2,0,1,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,2,0,1,0,2,0,0,0,
+    2,0,1,0,2,1,9,2,19,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,2,1,0,2,2,0,1,0,
+    2,1,0,0,2,0,0,0,0,2,2,0,2,1,0,0,0,0,2,0,0,0,2,0,0,0,0,0,2,0,0,0,
+    0,0,2,0,0,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,17,1,
+    15,2,2,1,0,2,2,1,0,2,2,1,2,2,2,1,1,2,2,1,2,2,2,1,0,0,0,0,2,0,2,0,
+    0,1,2,2,0,0,0,0,2,0,2,0,0,0,0,0,0,0,2,0,2,0,0,1,2,0,1,0,2,0,1,2,
+    4,0,1,0,0,0,2,1,0,0,31,0,2,1,0,1,2,1,4,1,2,0,0,1,0,1,2,2,2,1,1,2,
+    2,1,0,0,0,1,0,0,2,2,0,1,2,0,2,0,0,0,2,0,0,1,4,0,2,0,1,0,2,2,0,0,
+    2,0,2,0,2,1,2,2,2,1,29,0,0,2,4,1,0,0,0,0,2,0,0,0,0,1,4,2,2,0,2,1,
+    2,2,2,0,0,1,2,0,2,2,0,0,2,0,2,1,0,0,0,2,4,0,0,1,0,0,0,0,1,0,23,0,
+    1,0,2,0,4,0,1,0,4,1,0,0,4,0,0,0,1,0,4,1,2,0,4,0,4,2,2,1,4,0,0,0,
+    1,0,2,0,1,2,4,1,27,0,0,0,4,0,6,0,0,0,0,1,4,0,0,0,6,2,8,0,4,0,0,1,
+    2,0,3,2,4,1,0,2,7,1,9,0,5,1,1,0,1,0,10,0,8,0,4,0,1,0,4,0,4,0,8,0,
+    4,0,27,0,6,0,6,0,8,0,5,1,0,2,4,0,10,0,5,1,2,0,4,0,0,7,29,0,1,0,2,2,
+    0,1,25,0,1,0,0,0,0,0,2,2,2,0,1,0,2,0,0,0,0,1,2,2,0,0,0,0,0,1,2,2,
+    0,0,0,0,2,0,0,0,2,0,1,2,4,1,0,2,0,1,1,0,2,0,0,0,2,0,0,2,0,1,0,0,
+    2,0,0,2,0,1,2,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,2,0,1,0,2,0,0,0,2,0,
+    1,1,2,2,11,0,17,0,0,0,0,1,2,2,0,1,2,2,0,0,2,1,0,0,0,2,2,0,0,1,2,0,
+    0,2,0,0,0,0,0,1,2,0,2,0,1,2,2,0,2,1,0,0,0,0,0,0,0,0,2,0,2,0,0,0,
+    0,0,2,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,0,1,0,2,13,1,15,2,
+    0,1,0,2,0,1,0,2,2,1,0,2,2,1,0,0,2,0,2,0,2,0,0,0,2,0,2,0,0,0,0,0,
+    2,0,0,0,2,1,0,2,0,0,0,0,2,0,2,0,0,0,2,0,0,1,2,2,1,0,4,0,1,0,2,0,
+    1,1,2,1,0,1,0,1,27,1,3,1,2,0,2,0,0,0,2,0,2,0,2,0,4,0,0,1,0,2,2,1,
+    0,0,0,0,2,0,0,0,0,1,0,0,0,0,2,0,0,0,2,0,2,0,2,0,0,0,2,0,2,0,0,0,
+    0,1,0,2,4,0,0,1,25,0,2,2,4,1,0,0,2,0,0,0,0,0,2,0,0,0,1,0,4,0,2,0,
+    2,0,0,1,2,2,2,0,0,0,2,1,2,0,2,0,2,0,0,0,0,0,2,2,2,1,2,0,27,0,2,1,
+    0,0,3,0,0,0,4,0,0,0,4,0,2,0,2,1,2,0,3,2,4,1,2,0,2,0,4,2,2,0,4,0,
+    2,0,3,0,2,1,5,0,19,0,2,0,1,1,4,2,4,0,2,0,2,0,4,0,0,1,4,0,8,0,4,2,
+    0,0,2,1,1,0,2,0,15,0,2,1,3,2,3,0,1,1,1,0,8,2,10,1,2,0,1,0,2,0,6,0,
+    8,0,13,1,11,2,12,1,6,0,1,2,4,1,5,2,10,1,1,0,0,2,12,1,1,7,31,0,2,0,3,2,
+    25,0,2,0,0,0,2,0,0,0,0,1,0,0,2,2,0,0,2,0,0,0,0,1,0,2,2,0,0,0,0,0,
+    2,0,0,0,2,0,0,2,0,1,2,0,1,0,0,0,2,0,2,0,1,0,2,0,0,0,2,0,0,0,0,0,
+    0,2,0,1,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,2,0,1,0,2,0,0,0,2,1,1,2,
+    2,0,11,0,17,0,1,1,2,2,2,0,0,1,2,2,0,0,0,1,0,2,2,0,2,1,0,0,0,2,0,0,
+    2,1,0,0,0,0,4,2,0,1,0,0,2,0,0,0,0,2,0,1,2,0,0,0,2,0,0,0,0,0,2,0,
+    0,0,0,0,0,0,2,0,2,2,1,1,2,0,0,0,0,0,0,0,2,0,0,0,2,0,17,0,17,0,2,0,
+    2,0,0,1,2,2,0,1,2,0,0,0,0,0,0,2,2,1,2,0,0,0,2,0,0,0,2,0,2,0,0,0,
+    2,0,2,0,0,0,2,0,0,0,0,1,0,2,2,0,2,0,0,1,2,2,1,0,2,0,0,3,2,1,0,3,
+    2,0,1,1,2,1,25,2,7,0,2,1,2,0,2,2,0,0,2,0,2,1,2,2,2,0,2,0,2,1,0,0,
+    0,0,2,0,1,0,4,0,1,0,2,0,0,1,0,0,2,0,0,0,2,0,0,0,2,0,2,0,0,0,0,0,
+    2,0,2,1,0,0,9,0,17,2,2,1,2,0,4,0,0,2,2,1,0,2,0,1,2,0,2,0,1,1,2,2,
+    4,0,2,0,0,0,2,0,2,1,2,2,0,1,0,2,2,0,4,1,2,0,0,0,0,0,0,0,23,0,0,0,
+    2,0,2,0,1,0,0,0,1,1,2,0,2,0,4,0,2,0,4,1,3,2,2,0,2,1,2,0,4,0,4,0,
+    2,0,2,0,1,0,29,0,2,0,0,0,4,0,1,1,4,0,4,0,0,0,2,0,4,2,2,0,4,0,6,1,
+    4,2,0,0,0,0,2,1,15,1,2,2,4,1,5,0,5,0,1,0,0,0,6,0,12,0,2,2,0,1,0,0,
+    6,0,3,0,9,0,3,0,8,0,10,1,5,2,6,1,2,0,8,0,3,0,6,2,4,5,27,0,9,0,19,1,
+    2,0,1,0,2,0,0,2,2,0,0,0,0,0,0,1,2,2,0,0,2,0,0,0,0,1,0,2,2,0,0,1,
+    0,2,2,0,1,0,2,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,
+    0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,0,0,1,0,2,0,
+    13,0,17,1,2,2,2,0,0,1,0,2,2,0,0,0,0,1,2,2,2,0,1,1,2,2,0,0,0,1,2,0,
+    0,2,0,0,2,1,0,0,2,2,0,1,0,0,2,0,2,0,0,0,0,0,0,0,0,0,2,0,0,0,2,0,
+    0,0,0,0,2,0,2,0,1,0,2,0,0,2,0,1,0,0,2,0,0,0,0,0,13,0,17,1,2,2,0,1,
+    0,0,2,2,2,1,0,0,0,2,0,1,2,0,2,0,0,0,1,2,2,1,2,0,2,0,2,0,2,0,0,0,
+    2,0,0,0,2,0,0,0,0,0,2,0,2,0,1,0,2,1,0,0,0,3,2,1,2,3,1,0,0,0,2,0,
+    0,1,2,2,19,0,13,0,0,1,2,2,0,2,2,1,4,0,0,0,0,0,2,1,2,0,4,0,2,0,2,0,
+    2,0,0,0,0,0,0,0,2,1,0,0,2,2,0,1,0,0,0,0,0,0,2,0,2,0,0,0,2,1,2,0,
+    0,2,1,0,2,0,31,0,2,1,4,0,4,2,2,0,4,1,2,2,0,1,0,0,0,2,2,1,2,2,0,1,
+    1,0,4,0,4,0,0,1,0,2,2,1,2,2,0,1,0,0,2,2,0,1,2,0,4,0,19,0,3,0,0,0,
+    0,0,2,0,0,1,0,0,2,0,1,0,0,1,0,2,6,1,2,2,2,1,1,0,2,2,4,0,0,0,2,0,
+    4,0,2,0,2,1,25,0,1,0,2,0,0,0,2,0,3,0,4,0,4,0,2,0,2,1,4,0,0,2,4,0,
+    6,1,4,0,0,0,0,1,21,2,8,0,4,0,4,0,3,0,7,0,1,1,0,0,6,2,10,1,2,0,0,0,
+    0,0,7,2,12,1,15,0,4,0,10,0,6,1,1,2,3,0,10,0,0,0,1,1,8,7,41,0,15,0,0,0,
+    0,2,2,0,0,0,0,1,2,0,0,0,2,2,0,0,0,1,0,0,0,2,2,0,0,0,0,1,2,2,0,0,
+    0,1,0,2,2,0,0,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,0,0,2,0,0,1,0,2,0,0,
+    0,0,2,0,0,0,2,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,1,2,2,0,0,15,1,
+    13,2,0,0,0,1,2,0,0,2,2,1,0,2,2,1,0,2,2,0,1,1,2,2,0,1,0,0,2,2,0,1,
+    2,0,2,0,0,2,0,1,0,0,0,2,2,1,0,0,0,0,2,0,0,0,2,0,0,0,0,0,2,0,0,0,
+    2,0,0,0,2,0,1,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,11,1,19,2,2,0,0,1,0,2,
+    2,0,2,1,1,2,4,0,1,1,2,0,0,2,0,1,2,0,2,0,0,0,0,0,2,0,0,0,2,0,4,0,
+    1,0,2,0,2,0,0,0,2,1,0,0,0,3,2,3,0,0,2,1,0,0,0,0,0,0,2,0,0,0,0,0,
+    0,0,9,0,19,0,0,0,0,0,2,2,2,1,2,0,0,0,2,0,2,0,2,0,0,0,2,0,2,0,4,1,
+    0,0,2,0,2,0,1,1,2,2,0,1,0,0,2,2,0,1,0,0,0,0,0,0,0,0,2,0,0,0,2,0,
+    2,1,0,0,31,0,0,0,2,0,0,2,4,1,4,0,4,2,2,1,4,0,2,0,0,0,1,0,0,0,4,0,
+    0,0,0,0,2,1,2,2,2,1,0,2,2,1,2,2,0,0,0,1,2,2,2,1,0,2,21,1,4,0,2,0,
+    1,0,1,1,4,2,0,1,0,2,2,1,0,0,0,0,1,0,2,0,4,0,4,0,1,0,0,0,4,0,2,0,
+    2,1,2,0,1,2,15,0,3,1,1,0,2,0,0,0,6,0,3,0,2,0,2,0,0,0,2,0,6,1,0,0,
+    2,0,6,0,6,0,1,0,19,0,0,0,6,0,6,0,2,1,3,0,7,0,2,2,0,1,4,0,8,0,4,0,
+    0,2,17,1,12,0,4,0,9,0,6,0,10,0,1,1,4,2,2,0,4,1,3,0,2,7,57,0,2,2,0,0,
+    0,1,2,0,0,0,0,2,0,0,2,0,1,1,2,2,0,0,2,0,0,1,0,2,2,0,0,0,0,1,2,2,
+    0,0,2,1,0,2,0,1,0,2,0,1,0,2,0,1,2,2,0,1,2,2,0,0,0,0,0,0,0,0,2,0,
+    0,1,0,0,2,0,1,2,2,0,0,0,0,0,2,0,0,0,0,1,0,2,0,0,2,0,0,1,15,2,13,0,
+    0,1,2,0,0,2,0,0,2,1,0,2,2,1,0,2,2,1,1,0,2,2,2,1,1,2,2,1,2,0,0,2,
+    0,1,2,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,0,2,2,1,0,0,2,0,1,0,2,0,0,0,
+    0,0,2,0,0,0,2,0,0,0,0,0,2,1,0,2,0,0,2,1,9,2,21,0,0,1,0,2,0,0,2,1,
+    0,0,0,2,4,1,1,0,2,0,2,2,0,1,0,0,0,0,2,0,0,0,2,0,0,1,2,2,2,0,0,0,
+    2,0,2,1,0,1,2,3,0,1,2,1,0,2,0,0,0,1,0,2,2,0,2,1,0,0,0,0,2,0,0,0,
+    3,0,27,1,2,2,2,0,0,2,0,1,2,0,0,0,2,0,2,0,2,0,0,1,2,0,0,0,2,0,2,0,
+    2,0,2,0,2,1,0,2,0,1,2,2,0,1,1,0,2,0,2,0,0,0,0,0,0,0,0,0,2,0,0,0,
+    0,0,13,0,15,0,2,0,2,0,2,1,0,2,2,0,4,1,2,0,4,2,2,0,2,1,2,2,1,1,0,0,
+    4,0,0,0,1,0,2,1,4,2,0,0,0,0,2,0,2,1,0,0,2,0,0,0,13,0,9,0,2,0,4,0,
+    6,0,2,0,3,1,0,2,2,1,0,0,0,0,4,0,1,0,0,0,2,2,0,1,4,0,0,0,0,0,4,1,
+    0,2,4,0,19,1,6,0,2,2,1,1,3,0,4,0,1,0,6,0,3,0,0,0,4,0,1,0,0,0,6,0,
+    2,1,2,0,4,0,7,2,7,1,2,0,0,0,6,0,4,0,4,0,3,0,7,1,0,0,2,0,4,0,2,2,
+    13,1,1,0,10,0,12,0,5,0,0,0,4,0,8,0,3,1,0,2,10,0,0,0,0,5,55,0,0,1,0,0,
+    2,0,1,2,2,0,2,1,0,0,0,2,2,0,0,1,0,0,0,2,2,0,0,1,0,0,2,2,0,0,0,1,
+    0,2,0,0,0,0,2,0,2,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,1,2,2,0,0,0,0,
+    2,0,1,0,0,0,2,1,0,0,0,0,2,0,0,2,0,0,0,0,2,1,0,2,0,0,17,0,11,1,0,2,
+    2,0,0,0,2,1,0,2,0,0,2,1,0,2,0,1,2,2,2,0,0,1,1,2,2,1,2,2,1,1,2,0,
+    2,2,0,1,2,0,0,2,0,1,0,0,2,0,0,0,2,0,0,0,0,0,2,0,1,0,2,0,0,0,0,0,
+    2,0,0,0,2,0,0,0,0,0,2,0,0,0,2,0,0,0,9,0,21,1,0,2,0,0,2,1,0,0,0,2,
+    2,0,0,1,0,0,2,0,2,2,0,1,0,0,2,0,0,0,0,0,2,0,0,0,2,0,2,0,1,3,2,3,
+    2,0,2,1,0,0,2,0,2,0,0,0,0,1,2,2,0,0,0,1,0,0,2,0,0,0,2,0,0,0,0,0,
+    29,0,0,2,0,1,2,0,4,0,0,0,0,0,0,0,2,0,0,1,2,0,2,2,0,0,2,1,0,0,0,0,
+    4,0,0,1,2,2,4,1,0,2,1,1,2,0,2,0,1,2,0,0,2,0,0,1,2,0,0,0,0,0,0,0,
+    3,0,25,0,4,0,0,0,0,0,2,0,2,1,2,0,0,2,4,0,2,1,4,0,2,2,2,1,2,0,3,0,
+    0,1,2,0,2,2,0,0,0,0,4,1,2,2,0,1,2,0,0,2,0,1,2,0,27,0,2,0,4,0,2,0,
+    4,0,4,0,4,0,1,1,1,0,2,0,0,0,1,0,4,0,2,0,1,0,2,0,2,0,0,0,0,1,0,2,
+    4,0,2,1,21,2,6,0,8,1,4,2,1,0,5,1,4,0,3,0,6,0,0,0,3,0,4,1,1,0,0,0,
+    4,2,2,0,4,1,15,0,6,2,0,1,2,0,0,0,6,2,4,1,6,0,9,0,3,0,1,0,4,0,6,1,
+    23,0,10,0,0,0,14,0,8,0,11,0,6,0,6,0,0,0,3,0,8,1,0,0,0,7,55,0,0,0,2,0,
+    0,2,2,1,0,0,0,0,0,2,0,1,0,0,2,2,2,0,1,1,0,0,2,2,0,0,0,1,2,2,0,0,
+    2,1,0,2,0,0,0,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,
+    1,0,2,0,0,0,2,0,1,0,2,0,0,0,0,1,0,2,2,0,1,0,2,1,17,0,11,2,0,0,2,1,
+    0,0,0,0,2,2,0,1,2,0,0,2,0,1,2,2,0,1,0,0,2,0,0,0,2,2,1,1,4,2,0,1,
+    0,0,0,0,0,0,2,0,2,0,0,0,0,0,0,0,0,0,2,0,2,0,0,0,2,0,0,0,1,0,2,0,
+    0,0,2,0,1,0,2,0,2,0,0,0,0,0,0,0,3,0,25,0,0,0,2,1,2,2,0,0,0,0,0,1,
+    0,0,2,0,0,0,2,2,1,1,2,0,0,0,2,0,0,0,0,0,2,0,0,3,2,1,0,5,2,2,2,2,
+    2,1,0,0,2,0,0,0,0,0,2,0,2,0,0,1,0,0,2,0,0,0,0,0,2,0,0,2,2,1,27,0,
+    3,0,2,0,2,2,2,0,0,1,2,0,0,0,0,0,0,1,2,2,0,0,2,1,2,0,0,0,2,0,2,0,
+    1,0,4,0,0,1,2,2,2,1,2,0,1,2,0,0,2,1,2,0,1,0,2,0,0,0,0,0,0,0,2,1,
+    33,0,0,0,2,0,4,0,2,0,0,2,2,0,2,0,2,1,2,0,2,2,2,0,4,1,2,0,2,0,2,0,
+    3,0,0,0,2,0,2,0,0,0,0,0,2,1,2,0,0,0,2,0,2,0,19,2,9,1,2,0,4,0,2,0,
+    2,1,4,0,4,0,4,0,0,0,1,0,2,2,0,1,0,2,0,1,2,0,1,0,2,0,2,0,2,0,1,0,
+    0,1,7,2,13,0,8,0,6,0,6,0,4,1,0,2,3,0,2,1,1,0,4,0,2,0,3,0,2,0,1,0,
+    2,1,4,0,0,2,21,1,8,0,6,0,0,0,2,0,4,0,6,0,2,0,6,0,7,0,3,0,1,0,6,0,
+    13,0,0,0,4,0,2,0,12,0,0,0,3,1,4,0,8,2,4,1,5,0,6,0,1,7,55,0,2,0,0,2,
+    0,1,0,0,2,2,0,0,0,1,2,0,2,2,1,1,0,0,2,2,2,0,1,1,2,2,2,0,1,1,2,0,
+    0,2,0,0,2,1,0,2,0,1,0,2,2,1,1,2,0,1,2,2,0,0,0,1,2,2,0,0,0,0,0,0,
+    2,0,0,0,2,0,1,0,2,0,0,0,0,0,0,0,2,1,0,0,0,2,19,0,11,0,2,1,2,0,0,2,
+    0,0,2,0,0,1,2,0,0,2,2,1,2,2,0,1,0,2,0,1,0,2,2,1,0,0,2,0,1,0,2,2,
+    0,1,0,2,2,1,0,0,2,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,
+    2,0,1,0,2,0,0,0,0,0,2,0,0,0,1,1,29,0,2,2,0,0,2,0,0,1,2,0,2,0,0,0,
+    0,0,0,0,0,2,0,1,4,0,1,0,2,0,0,0,2,1,2,5,0,1,2,0,1,0,2,2,2,0,0,1,
+    0,0,2,0,2,0,0,0,2,0,0,0,2,0,2,0,2,0,0,0,0,0,0,0,0,0,2,1,21,0,7,0,
+    2,2,0,1,0,0,0,0,2,2,0,1,2,0,4,1,1,2,0,0,2,1,2,2,0,1,2,0,0,0,0,0,
+    4,1,0,2,0,0,2,1,0,0,2,2,2,0,0,1,0,2,0,1,2,0,0,2,2,1,0,0,0,0,27,0,
+    3,0,0,0,0,0,4,0,2,0,2,1,0,0,2,0,2,2,2,0,2,1,0,0,2,0,4,0,2,0,2,0,
+    4,0,1,0,1,0,0,0,2,1,0,0,0,0,4,2,2,0,2,1,1,2,25,1,0,0,0,0,2,0,4,0,
+    2,0,0,0,4,0,4,0,4,0,2,0,1,1,0,2,1,1,2,2,2,1,2,0,1,0,2,0,2,0,4,0,
+    1,0,33,0,6,0,4,1,6,2,6,0,8,0,6,0,1,1,1,2,0,0,1,1,4,0,2,0,0,0,0,1,
+    3,2,0,1,4,0,23,0,6,0,6,2,6,0,0,1,2,0,4,2,6,0,6,1,4,0,3,0,5,0,1,0,
+    17,0,2,1,6,0,1,0,10,0,10,0,9,2,6,0,6,1,2,0,1,2,4,1,4,7,53,0,0,2,2,1,
+    0,0,2,2,1,1,2,0,0,0,0,2,0,1,2,0,0,2,2,1,1,0,2,2,2,1,1,0,2,2,0,0,
+    0,1,2,2,0,0,0,0,2,0,1,0,0,0,2,0,2,0,1,0,2,1,2,2,1,0,0,0,2,0,0,0,
+    0,0,2,0,1,1,2,0,0,0,0,0,0,0,2,2,0,0,0,0,19,1,9,0,2,2,0,0,0,0,2,1,
+    0,0,2,0,0,2,0,0,2,1,0,2,0,1,0,2,2,1,2,2,0,1,0,2,0,1,0,2,2,1,0,0,
+    2,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,1,2,2,
+    0,0,0,0,0,0,2,0,0,0,0,0,0,0,29,0,2,0,0,1,0,0,2,0,0,0,0,2,2,0,0,0,
+    0,0,2,0,0,1,0,0,0,0,4,1,0,3,2,1,0,1,0,0,2,0,1,0,4,0,0,0,0,0,0,0,
+    2,0,0,1,2,0,2,0,2,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,2,0,13,0,15,0,0,2,
+    2,1,2,2,2,0,0,1,0,0,0,0,2,0,0,0,2,0,0,1,0,0,0,0,2,0,2,0,0,0,2,0,
+    0,0,0,1,4,0,0,2,2,0,2,0,0,1,2,2,0,1,0,2,2,1,0,0,1,0,4,0,11,0,19,0,
+    1,0,4,0,2,0,3,0,2,0,4,0,2,0,0,0,0,1,2,0,2,0,2,0,2,0,0,0,4,0,4,0,
+    2,0,2,2,0,1,1,0,0,0,2,0,0,0,1,1,4,0,2,2,19,1,7,0,2,0,2,0,1,1,4,0,
+    2,0,4,0,0,0,4,0,4,0,2,2,2,0,2,1,0,2,1,1,0,0,4,2,2,1,1,0,0,0,0,0,
+    4,0,23,0,5,1,2,2,4,0,6,1,6,2,6,1,6,2,0,0,0,1,0,0,1,0,2,0,0,0,2,0,
+    0,1,3,2,25,1,2,2,4,0,8,0,6,1,4,2,2,0,0,0,6,1,6,2,4,0,0,1,0,0,5,0,
+    17,1,2,2,0,0,8,0,1,0,8,1,4,0,3,0,6,0,4,0,2,0,2,2,2,7,51,2,0,1,0,0,
+    0,0,0,0,2,0,0,0,2,2,0,1,0,0,0,2,2,1,1,0,2,2,2,1,1,0,2,2,0,1,0,0,
+    2,2,0,1,0,2,0,1,0,2,2,1,0,2,2,1,1,2,2,1,0,2,0,0,0,1,2,0,0,0,0,0,
+    2,0,1,0,2,2,0,0,0,0,0,0,2,0,0,1,0,0,23,2,5,0,2,0,0,1,0,0,2,0,0,0,
+    2,2,0,0,0,1,2,0,0,2,0,1,2,2,0,1,0,0,2,0,0,0,2,0,0,0,2,0,0,0,0,0,
+    0,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,0,0,0,1,2,2,0,0,0,0,4,1,0,2,0,0,
+    1,0,4,0,0,0,0,0,0,1,0,0,31,2,2,0,0,0,2,0,2,0,0,0,2,0,0,1,0,0,2,0,
+    2,0,1,0,2,0,0,3,2,3,0,1,2,2,1,1,2,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,
+    2,1,0,2,0,0,2,0,0,0,2,0,0,0,2,0,0,1,2,0,0,0,2,0,5,0,23,0,0,2,2,1,
+    2,2,0,1,2,0,2,0,0,0,2,0,1,0,2,0,2,1,0,0,0,2,1,1,2,0,2,0,2,1,0,0,
+    0,0,2,2,2,0,0,1,2,2,0,1,2,2,2,1,2,0,0,0,0,0,0,0,2,0,1,0,29,0,4,0,
+    2,0,1,0,0,0,2,0,0,0,0,0,2,0,0,0,2,0,0,0,2,0,4,1,0,0,4,0,0,0,2,2,
+    2,0,2,1,4,0,0,1,1,0,0,0,2,2,2,0,1,0,0,1,25,0,2,0,2,0,2,0,2,0,3,0,
+    2,0,4,0,4,0,0,0,2,0,4,1,4,2,2,0,2,1,0,2,0,0,1,1,2,2,4,1,0,2,0,1,
+    29,2,4,1,4,0,5,0,2,0,4,0,4,0,6,0,6,0,6,1,0,0,0,2,2,1,1,0,2,1,0,2,
+    0,0,4,1,31,2,0,0,4,1,4,0,6,2,8,0,2,1,4,0,0,2,4,0,4,1,8,2,3,1,1,0,
+    23,0,10,0,0,0,2,0,4,0,4,0,8,0,7,0,2,0,4,1,0,0,4,0,4,7,53,0,2,0,0,0,
+    2,2,0,1,0,0,0,2,2,1,0,0,0,2,2,1,0,0,2,2,0,1,1,2,2,0,0,1,0,2,2,0,
+    0,1,0,2,0,1,2,2,0,1,0,2,2,1,1,2,2,1,0,2,2,0,1,1,2,2,0,0,0,0,2,0,
+    1,0,2,0,0,0,0,0,2,1,0,2,0,0,0,0,23,0,5,1,0,0,0,0,2,0,2,2,0,0,2,0,
+    0,1,0,0,2,0,0,2,0,1,2,0,0,0,2,0,0,2,0,1,2,2,0,1,0,0,0,0,0,0,2,0,
+    0,0,2,0,0,0,2,0,1,0,2,0,0,0,0,0,2,0,2,0,0,0,0,0,0,1,0,2,2,0,0,1,
+    2,2,1,0,2,0,0,0,2,0,31,0,0,1,0,0,2,0,0,0,2,0,0,0,2,0,0,0,2,0,2,0,
+    0,1,0,3,0,3,2,0,0,0,0,2,2,1,2,0,0,0,0,0,0,0,2,2,0,1,0,0,2,0,2,0,
+    1,0,2,0,0,0,2,0,0,0,2,1,2,0,0,0,0,2,2,0,2,0,0,1,29,0,0,2,0,1,2,2,
+    2,1,2,2,0,1,0,0,2,0,2,0,2,1,1,2,2,0,2,0,0,1,2,0,1,0,0,0,2,0,2,0,
+    0,0,0,1,0,2,2,0,2,1,2,2,2,1,0,2,2,0,0,1,0,2,2,1,0,2,29,1,1,0,2,2,
+    4,0,0,1,0,0,2,0,0,0,0,0,2,0,2,1,0,0,2,0,1,0,2,2,4,0,1,0,4,0,0,1,
+    4,0,2,0,2,1,2,2,2,0,1,0,0,1,0,0,2,0,31,0,0,0,4,0,4,0,2,0,2,0,2,1,
+    0,0,1,0,2,2,4,0,2,0,4,0,2,0,2,0,4,0,0,1,2,2,1,0,0,1,0,2,2,1,2,0,
+    25,0,0,0,2,2,4,1,3,1,2,2,4,1,2,2,6,1,6,2,4,0,2,1,1,0,4,0,0,2,0,1,
+    2,0,1,0,19,0,3,0,1,0,4,0,4,0,6,0,6,0,2,0,2,0,2,1,6,2,0,1,6,2,13,1,
+    1,2,3,1,8,0,3,0,4,1,0,2,10,0,0,0,5,1,4,2,2,0,2,0,2,7,49,0,0,0,0,0,
+    0,0,0,0,2,2,0,1,0,0,0,2,2,1,0,0,0,2,0,1,0,0,2,0,0,0,0,2,2,1,0,0,
+    0,2,0,1,2,2,0,1,0,2,2,1,0,2,0,1,0,2,2,0,0,1,0,2,0,0,2,0,0,0,0,1,
+    0,0,0,0,2,0,0,0,0,2,0,1,0,0,25,0,3,0,2,2,0,0,2,0,0,0,0,1,2,0,0,0,
+    0,0,2,0,0,0,0,0,2,0,0,2,0,1,2,0,0,0,0,0,2,0,0,0,2,2,0,1,2,0,0,0,
+    0,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,1,0,2,0,0,2,1,2,2,0,0,0,0,0,0,
+    0,1,2,2,1,0,2,0,31,0,0,0,2,0,2,0,0,0,2,0,2,0,0,0,0,0,2,1,0,1,0,3,
+    2,1,2,0,2,0,0,0,0,0,0,1,0,0,2,0,0,0,2,0,0,0,0,0,2,0,2,0,0,0,1,1,
+    2,2,0,0,2,0,0,0,2,1,0,2,0,0,2,1,2,0,0,0,0,0,25,2,1,0,2,0,2,0,0,1,
+    0,2,2,1,2,0,2,2,2,1,0,0,0,0,2,1,0,0,0,0,4,0,0,0,0,0,1,0,0,0,0,0,
+    4,0,0,0,0,1,0,2,2,0,2,1,0,2,2,1,0,0,4,2,0,1,0,2,13,1,13,2,2,1,1,0,
+    0,0,4,0,2,0,0,0,0,0,2,1,1,0,0,2,4,0,0,1,2,0,1,0,2,0,4,0,0,0,2,0,
+    0,0,2,1,2,2,4,0,2,0,2,0,1,0,0,0,7,0,19,0,1,0,2,1,4,0,2,0,2,1,4,2,
+    0,0,2,0,0,0,0,0,4,0,0,0,4,1,2,2,2,0,4,0,1,1,4,2,0,0,1,1,2,0,13,2,
+    11,1,2,0,0,0,4,0,4,0,5,0,2,0,4,0,4,0,4,1,4,0,4,0,2,0,0,2,2,1,2,0,
+    0,0,3,2,15,1,2,0,3,2,0,1,2,0,4,0,6,0,4,0,2,1,0,2,2,0,8,0,0,1,7,2,
+    0,1,5,2,0,1,6,0,5,2,8,1,4,0,8,1,5,2,0,0,6,1,0,0,0,7,51,0,2,0,0,2,
+    2,1,0,0,0,0,2,0,1,2,2,1,0,0,0,2,0,1,2,0,0,2,2,1,0,2,0,1,0,0,0,2,
+    2,0,0,0,0,0,0,0,2,1,0,2,0,1,0,2,2,1,0,0,1,2,4,1,0,0,1,0,2,0,0,2,
+    2,0,0,0,1,0,2,1,0,0,2,2,27,0,3,0,2,0,0,1,2,0,0,0,0,0,2,0,0,0,0,0,
+    2,0,0,2,0,0,2,1,0,2,2,1,0,0,0,2,2,1,0,0,0,0,2,0,0,0,2,0,0,0,0,0,
+    2,0,0,0,0,0,0,1,2,2,0,1,0,2,2,0,1,0,2,0,0,1,0,2,0,0,0,0,2,0,0,0,
+    2,0,1,1,4,0,33,0,0,0,2,0,2,0,0,0,2,0,2,0,0,0,2,0,0,3,2,1,0,3,2,0,
+    0,0,2,0,0,0,0,0,0,0,2,0,0,0,1,0,4,0,0,2,2,1,0,0,0,0,0,0,0,0,2,0,
+    0,0,2,0,0,1,0,0,2,2,2,1,2,0,0,2,0,0,0,1,19,0,9,2,4,0,0,1,2,2,0,0,
+    0,1,2,0,2,0,2,0,0,0,2,0,2,0,2,0,0,0,0,1,0,0,2,0,2,0,0,0,0,1,0,0,
+    0,2,2,0,2,0,0,0,1,0,2,0,2,1,2,2,0,0,0,1,2,2,2,1,31,2,2,1,0,2,2,1,
+    0,0,0,2,2,1,2,0,2,0,1,0,2,0,2,1,1,0,2,2,2,0,2,0,1,1,2,0,2,0,2,0,
+    2,0,2,0,0,0,2,0,2,0,2,0,4,0,1,0,27,1,1,0,2,0,0,0,1,0,6,0,4,2,2,0,
+    4,0,0,0,0,1,0,0,0,0,2,0,2,0,2,0,4,0,2,0,2,0,0,1,2,2,2,0,1,0,27,1,
+    6,0,2,2,0,1,1,0,4,0,2,0,3,0,2,1,2,0,4,2,6,0,4,0,4,0,0,1,0,0,2,0,
+    2,2,17,1,2,2,1,1,4,0,3,0,0,0,1,1,6,2,6,0,2,0,4,0,0,1,2,0,6,2,11,1,
+    0,2,2,1,5,2,6,1,4,0,1,0,1,0,12,0,1,0,2,0,6,0,5,1,2,7,47,0,1,0,2,0,
+    0,0,0,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,2,2,1,1,0,2,0,2,0,0,2,0,1,
+    1,0,2,2,0,1,2,0,0,2,0,1,0,2,2,1,0,2,0,0,2,1,1,2,2,0,0,0,0,0,0,1,
+    0,0,2,0,0,0,0,2,0,0,29,1,0,0,2,0,0,0,2,0,0,0,0,0,2,0,0,0,2,0,0,2,
+    0,0,0,1,2,0,0,0,2,0,0,0,2,0,0,0,0,0,2,2,0,1,0,0,2,0,0,0,0,0,2,0,
+    1,0,2,0,0,0,0,0,0,0,2,0,0,0,0,1,2,2,0,0,0,0,2,0,0,0,0,0,0,0,2,0,
+    0,0,2,0,33,0,0,0,2,0,0,0,2,0,2,0,2,0,0,1,0,3,2,3,2,1,0,0,2,2,0,0,
+    0,1,0,0,2,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,2,2,0,1,0,0,2,0,0,0,2,0,
+    0,0,0,1,0,2,2,0,0,1,0,2,2,0,0,1,2,0,13,2,15,0,2,1,0,2,2,0,2,1,2,0,
+    2,0,0,0,0,0,2,1,2,0,0,0,2,0,0,0,2,0,2,2,1,1,2,0,2,0,2,1,0,2,0,2,
+    0,1,0,0,0,0,2,1,2,0,1,2,2,0,0,1,2,0,2,2,2,1,29,2,2,1,0,2,2,1,2,2,
+    0,1,0,0,2,0,0,0,2,0,2,0,0,0,0,0,0,0,0,0,2,1,0,0,2,2,1,0,2,1,2,0,
+    2,0,2,2,2,0,2,1,0,0,2,0,0,0,3,1,21,2,2,1,0,0,2,2,0,1,1,0,4,0,4,0,
+    2,0,2,0,2,0,2,0,0,0,0,0,2,0,0,0,0,0,4,0,4,0,4,0,1,1,0,0,2,0,27,2,
+    0,0,4,1,4,0,0,0,3,0,6,0,2,0,3,0,2,0,2,1,2,0,6,0,4,0,4,0,0,2,0,0,
+    2,1,19,2,6,1,2,2,0,1,0,2,0,1,2,0,5,0,4,0,8,0,0,1,4,2,0,0,6,1,13,2,
+    6,1,1,0,2,0,3,0,6,0,3,0,6,0,2,0,12,0,5,0,2,0,2,0,0,7,49,0,2,0,0,0,
+    0,0,2,2,0,1,0,0,0,0,2,0,0,2,0,1,2,0,0,0,0,0,0,2,0,1,0,0,0,0,2,0,
+    2,0,0,0,0,0,0,2,0,1,0,2,0,1,2,2,0,1,0,0,0,2,2,1,1,0,2,0,0,0,2,2,
+    0,0,1,0,2,1,0,0,29,0,2,0,0,0,2,2,1,0,2,0,0,0,2,0,0,0,2,0,1,0,4,1,
+    0,0,2,0,0,0,0,2,0,1,0,0,0,2,2,1,2,0,0,0,0,0,2,0,0,0,0,0,2,0,1,0,
+    2,0,0,1,2,2,0,0,0,0,0,0,2,0,0,0,0,0,0,1,2,2,1,0,2,0,0,0,0,0,2,0,
+    0,0,31,0,0,0,2,0,0,0,2,1,0,0,2,0,0,5,2,1,4,0,0,1,2,2,0,0,0,1,2,0,
+    2,2,0,0,0,1,0,0,2,0,0,0,2,0,0,0,0,2,0,1,0,0,2,0,0,0,0,0,2,0,1,0,
+    2,0,0,0,2,0,0,1,0,2,2,1,0,0,2,0,9,0,21,0,2,2,0,0,2,1,2,0,2,0,2,0,
+    2,0,0,0,2,0,0,0,2,0,2,0,0,0,2,1,0,0,0,0,2,0,0,0,0,0,2,2,4,0,0,1,
+    0,0,0,0,2,0,0,0,0,0,0,1,0,0,0,2,2,0,2,1,13,2,13,1,2,2,2,1,0,2,0,1,
+    4,2,0,1,0,2,0,1,4,0,2,0,0,1,0,2,2,0,0,1,1,2,2,0,2,1,0,0,0,2,0,1,
+    2,0,2,0,2,0,0,0,2,0,2,0,2,1,29,2,4,1,0,2,0,1,0,0,4,2,0,1,1,0,2,0,
+    4,0,4,0,2,0,2,0,0,0,2,0,0,2,4,1,0,0,0,0,4,0,2,0,2,0,2,0,25,0,2,1,
+    1,0,3,0,4,0,4,0,2,0,3,1,4,0,2,0,1,0,0,0,4,2,2,0,4,0,4,0,4,1,2,2,
+    0,0,19,0,4,0,4,1,2,2,0,1,1,0,2,2,4,1,3,1,0,2,6,0,0,1,4,2,0,0,9,1,
+    4,2,4,0,0,1,0,2,1,1,6,2,1,1,0,2,10,1,0,1,1,2,6,0,1,7,47,0,0,0,0,0,
+    2,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,2,0,1,2,0,2,0,0,0,0,2,0,1,0,0,
+    0,2,2,1,0,2,0,1,2,2,0,1,0,2,0,1,0,2,0,1,2,0,0,2,2,0,0,0,0,1,1,0,
+    2,0,2,0,1,2,29,0,2,0,0,0,2,0,1,1,4,0,1,0,2,0,0,0,2,0,0,0,2,0,1,0,
+    2,0,0,0,0,2,2,1,0,0,0,0,2,0,0,0,0,0,2,0,2,0,0,0,0,0,2,0,1,0,4,0,
+    0,0,0,0,1,1,2,2,0,1,0,2,2,1,0,2,2,1,0,2,0,0,0,0,0,0,2,0,0,0,0,0,
+    31,0,2,1,2,0,0,0,0,0,0,0,2,3,0,5,2,2,2,1,0,0,2,2,0,1,4,0,2,2,0,1,
+    0,0,0,0,2,2,0,1,0,0,0,0,0,0,2,2,0,1,0,0,0,0,0,0,2,0,0,0,0,1,2,2,
+    0,1,2,2,0,1,0,2,2,1,0,2,0,1,5,2,25,0,4,0,2,1,2,0,0,2,2,0,0,0,4,0,
+    0,1,2,0,0,0,0,0,0,0,2,1,4,0,0,2,0,1,4,0,0,0,0,0,2,0,0,0,0,0,2,0,
+    0,0,2,0,1,0,2,0,2,0,0,0,0,0,0,1,0,2,1,0,27,1,4,2,2,1,2,2,2,1,2,2,
+    1,1,4,0,0,0,2,0,1,0,2,0,4,0,2,0,0,0,0,0,2,0,1,1,0,2,4,1,1,0,2,2,
+    1,1,0,0,2,0,2,0,4,0,0,0,11,0,13,1,4,2,2,1,0,2,0,1,0,0,2,2,0,0,0,0,
+    0,0,4,0,4,0,2,0,2,0,0,0,2,1,0,0,4,0,2,0,1,0,0,0,4,0,2,0,21,0,0,0,
+    2,0,2,0,3,0,4,0,4,0,0,1,1,0,0,0,0,0,0,0,2,1,2,0,4,0,4,2,4,0,2,0,
+    3,0,17,1,2,2,6,0,2,1,2,0,0,2,3,1,4,0,4,0,0,1,1,0,4,2,0,1,2,2,17,0,
+    12,1,2,2,2,0,2,1,0,2,2,1,1,0,2,0,6,0,6,0,5,0,8,0,4,7,47,0,2,0,0,0,
+    0,0,0,0,2,0,1,2,2,1,0,0,2,0,0,0,0,0,2,0,1,2,2,1,0,0,0,0,2,0,0,2,
+    0,1,0,2,2,1,0,2,1,1,2,0,0,0,0,2,2,1,0,2,0,1,0,0,0,0,2,0,0,2,2,0,
+    1,1,1,0,27,0,2,0,0,0,2,0,0,0,2,0,1,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,
+    0,0,2,0,2,0,1,0,2,0,0,0,0,0,2,0,2,0,0,0,0,0,0,0,2,1,0,2,2,0,1,1,
+    2,2,1,0,4,0,1,0,2,0,0,0,0,0,2,0,1,0,2,0,0,0,2,0,1,0,2,1,0,0,31,0,
+    2,0,0,2,0,0,2,1,2,5,0,1,2,1,0,2,2,0,0,0,2,0,2,1,2,2,0,1,0,0,0,2,
+    2,1,2,0,0,0,0,0,2,0,2,0,0,2,1,1,0,0,2,0,0,0,0,0,2,0,0,0,0,0,2,0,
+    0,0,0,1,0,2,2,1,0,2,0,1,5,2,25,0,2,0,2,0,2,0,2,0,2,1,0,0,2,0,0,0,
+    2,0,2,0,2,0,0,0,2,1,0,2,0,1,2,0,2,0,0,0,2,0,0,0,0,0,2,0,0,0,2,0,
+    2,0,0,0,0,0,0,0,0,0,2,0,2,0,0,0,0,1,33,2,4,0,0,1,4,2,2,1,2,2,0,1,
+    4,0,0,2,2,1,0,0,0,0,0,0,2,2,2,1,2,0,0,0,0,1,4,2,1,1,1,2,4,1,0,0,
+    2,2,0,1,0,0,2,0,0,0,2,1,27,2,4,0,0,1,2,2,4,1,0,2,0,0,0,0,4,0,1,1,
+    0,0,0,0,2,0,4,0,4,0,2,0,0,0,2,0,0,0,2,0,2,0,0,0,2,0,1,0,17,1,4,0,
+    0,0,0,0,2,0,3,0,2,0,4,2,2,1,0,0,0,0,2,0,3,0,0,0,2,2,6,1,4,0,4,0,
+    19,0,1,0,2,1,2,0,4,2,2,0,2,1,2,0,3,0,2,0,4,0,2,0,1,0,2,0,7,1,15,2,
+    10,0,12,1,4,0,1,2,2,1,2,0,4,2,1,1,3,2,12,0,2,1,0,2,6,7,45,0,0,0,0,0,
+    0,0,2,0,0,0,0,0,0,0,0,2,2,1,0,0,0,0,0,0,2,0,0,0,0,2,2,1,0,0,0,0,
+    0,2,0,1,0,0,2,0,0,0,0,2,2,1,0,0,0,0,0,0,0,2,2,0,0,1,1,0,2,0,0,0,
+    1,2,27,1,2,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,2,0,0,0,0,0,2,0,2,0,0,0,
+    0,0,0,2,0,1,2,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,
+    0,1,2,2,1,0,2,0,0,0,2,1,1,2,0,1,4,2,1,0,2,0,1,1,2,0,0,2,31,0,0,0,
+    2,0,0,3,4,3,0,1,0,0,2,0,0,0,2,0,0,1,2,2,0,1,0,2,2,1,2,2,0,1,2,0,
+    2,2,0,1,0,0,2,2,0,1,0,2,0,1,2,0,0,0,0,0,0,0,2,0,0,0,0,0,2,0,1,1,
+    2,2,2,0,0,1,0,2,0,1,1,0,29,0,1,2,4,0,2,0,2,0,2,1,2,0,2,0,2,0,0,0,
+    0,0,2,0,0,0,4,1,0,2,0,1,0,2,2,1,2,0,0,0,2,2,2,1,0,0,0,0,0,0,0,0,
+    2,0,0,0,2,1,2,2,0,0,2,0,0,0,2,0,19,0,9,1,3,2,4,0,0,1,2,2,4,1,4,0,
+    1,2,2,1,0,0,2,0,2,0,2,0,1,0,0,0,4,1,2,2,2,0,1,1,2,2,2,1,1,2,0,0,
+    2,1,0,2,2,1,0,0,2,0,19,0,7,1,2,2,4,0,2,0,2,0,4,0,0,0,0,0,1,1,4,2,
+    0,0,1,0,0,0,2,0,4,0,2,0,2,0,0,1,0,0,2,0,2,0,4,0,0,0,25,1,4,2,4,0,
+    4,0,0,0,2,1,2,0,3,0,4,0,2,0,2,0,0,0,1,0,2,0,0,0,0,0,0,0,4,2,4,1,
+    17,0,4,0,3,0,0,0,6,1,6,0,0,0,1,0,0,0,1,0,4,0,2,0,4,0,0,0,27,0,2,1,
+    0,2,14,0,6,0,2,1,4,2,2,0,0,1,4,2,1,1,4,0,6,2,1,1,4,7,45,1,0,2,2,1,
+    0,2,0,0,0,0,2,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+    2,0,0,0,0,2,0,1,2,2,0,1,0,2,0,1,0,2,2,1,0,0,1,0,2,2,2,0,0,1,5,0,
+    25,0,2,2,0,0,2,0,2,0,0,0,0,0,0,1,0,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,
+    2,0,0,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,0,1,0,2,2,0,0,0,2,1,0,2,0,0,
+    0,0,0,1,2,2,0,1,2,2,1,0,2,1,2,2,1,0,2,1,1,0,2,2,2,0,33,0,2,0,0,3,
+    0,3,2,1,0,0,2,1,2,2,0,1,0,2,2,1,2,2,0,1,2,2,0,1,0,2,2,1,2,2,2,1,
+    1,0,4,0,0,0,2,0,0,2,0,1,0,0,0,0,2,0,0,0,2,0,0,0,1,0,2,1,2,2,0,0,
+    0,1,0,2,0,0,0,1,0,0,31,2,2,0,2,1,1,0,2,0,2,0,2,2,2,0,2,1,0,0,2,0,
+    2,0,0,0,2,1,0,2,2,1,0,0,2,0,0,0,0,0,4,0,0,0,0,2,2,0,0,1,2,0,0,0,
+    0,0,2,0,2,2,0,3,0,0,0,0,0,2,3,0,21,0,0,0,2,1,1,2,2,0,2,1,0,2,2,0,
+    4,1,2,0,0,0,2,2,0,1,2,0,0,0,0,0,0,0,2,0,2,0,2,0,0,0,0,0,2,0,0,1,
+    1,0,4,0,0,0,0,0,0,0,27,0,2,0,2,0,4,0,4,0,2,0,0,0,4,0,0,1,0,2,0,0,
+    2,0,2,0,1,0,1,1,0,0,4,0,2,0,4,2,0,1,0,0,2,0,2,0,2,1,27,2,4,0,4,0,
+    2,0,4,1,0,2,2,0,4,1,3,0,2,2,4,1,2,0,0,0,0,2,0,0,0,1,0,0,0,0,4,0,
+    19,0,8,0,6,0,1,0,3,0,2,0,8,0,4,0,3,1,1,0,3,0,8,2,2,1,4,0,21,0,5,0,
+    4,0,0,0,12,0,4,0,4,0,2,0,6,0,1,1,4,0,3,2,8,1,0,0,0,7,45,0,0,0,2,0,
+    0,0,0,1,0,2,2,0,0,0,2,0,1,0,2,0,0,0,0,0,2,0,0,0,1,0,2,0,0,2,2,0,
+    0,1,0,2,2,1,1,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,5,2,21,1,
+    0,0,2,0,0,0,0,0,0,0,2,0,0,0,2,2,0,0,0,1,2,0,0,0,0,0,2,0,0,0,0,0,
+    0,0,2,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,2,0,1,0,2,1,2,2,
+    0,0,2,0,0,0,0,0,0,1,0,2,0,0,0,0,2,1,0,2,2,0,0,0,33,0,2,3,0,3,0,1,
+    2,0,0,0,2,0,0,0,2,0,2,0,0,1,0,2,0,1,2,2,0,1,4,0,0,0,0,0,2,0,0,0,
+    4,0,1,2,2,1,0,0,2,0,0,0,2,0,0,0,0,0,0,2,0,1,0,0,2,0,0,0,0,0,2,0,
+    0,0,0,1,2,0,0,2,33,0,0,0,2,0,2,0,2,0,1,0,2,1,0,0,2,0,2,0,4,0,0,1,
+    2,2,2,1,0,2,2,1,0,0,2,0,0,0,0,0,2,2,1,1,2,0,4,0,0,0,2,0,0,0,0,0,
+    0,0,2,0,0,1,2,2,0,0,0,0,2,0,29,0,2,0,4,0,0,0,1,1,0,2,2,0,2,1,2,0,
+    2,0,0,0,4,2,0,1,2,0,1,0,4,0,0,0,0,0,0,1,2,2,2,0,0,1,2,2,0,1,2,2,
+    0,0,1,1,0,0,2,0,33,0,4,0,4,0,2,0,4,0,2,0,2,2,4,1,2,0,2,2,2,1,1,0,
+    0,0,2,0,2,1,0,2,1,0,0,1,2,0,2,0,4,2,0,1,1,0,2,0,21,0,1,0,2,0,4,0,
+    4,1,4,2,2,0,0,1,2,2,4,1,3,0,2,2,4,0,2,0,0,1,0,0,0,0,0,2,0,1,27,0,
+    2,0,8,0,8,0,4,0,2,0,1,0,0,1,6,0,2,2,1,0,1,0,1,1,6,0,2,0,13,0,2,0,
+    5,1,0,2,8,0,14,0,1,0,4,0,2,0,2,0,0,0,3,1,4,2,2,0,2,9,43,2,0,0,0,0,
+    0,0,2,0,0,0,0,1,2,2,1,1,2,2,0,0,0,0,2,0,0,0,1,0,4,0,1,0,2,0,0,0,
+    0,0,0,0,0,0,2,2,0,1,0,0,0,0,2,2,0,1,1,2,2,0,2,1,0,0,5,0,23,0,0,0,
+    2,0,1,0,2,0,0,0,2,0,0,0,0,0,2,0,2,0,0,2,0,1,0,0,2,0,0,0,2,0,0,0,
+    0,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,2,1,1,2,0,0,4,0,0,0,1,1,
+    2,2,0,0,0,1,2,2,0,0,2,1,0,2,0,1,0,2,0,0,0,0,31,3,2,3,0,1,0,0,2,0,
+    0,0,2,0,0,0,2,0,0,1,2,2,2,0,0,1,2,2,0,1,2,0,1,2,2,1,2,2,0,1,2,0,
+    0,0,2,0,2,0,0,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,0,1,2,0,
+    0,0,0,2,0,0,29,1,1,2,0,0,2,0,0,0,2,1,0,0,1,2,4,1,2,0,2,0,0,0,2,0,
+    2,1,0,2,2,1,2,0,0,0,2,2,0,1,2,0,0,0,2,2,0,0,0,1,2,0,2,0,0,0,2,0,
+    0,0,0,0,0,0,0,0,4,0,0,0,25,0,7,0,4,0,2,0,4,0,2,0,0,1,1,0,2,0,0,0,
+    2,0,2,2,2,1,2,0,0,0,2,0,0,0,4,0,0,0,0,0,0,0,2,0,4,0,0,0,0,0,0,1,
+    2,0,0,0,0,0,17,0,13,0,1,0,4,0,4,0,0,2,6,1,4,0,2,0,0,0,4,0,0,0,4,0,
+    1,0,0,1,2,2,2,0,0,1,1,2,0,1,0,0,2,0,2,0,4,0,1,0,29,0,6,0,4,0,0,0,
+    6,0,4,0,2,1,4,2,1,1,0,2,4,0,1,0,2,0,2,0,2,0,0,0,0,0,1,1,2,0,21,0,
+    7,0,8,0,6,0,8,0,0,1,4,0,0,2,0,1,8,0,2,0,1,0,3,0,0,2,4,0,21,0,12,0,
+    0,0,1,1,2,2,8,0,4,1,0,0,4,0,6,0,3,0,8,0,3,1,0,0,0,7,43,0,2,1,1,2,
+    2,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,2,0,1,0,2,0,2,0,1,0,2,0,0,0,0,0,
+    0,0,2,0,0,0,0,0,0,0,2,2,1,1,2,0,0,0,2,0,1,0,0,2,5,1,23,0,2,0,2,2,
+    0,1,2,0,0,0,2,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,2,0,
+    2,0,0,0,0,0,2,0,1,0,2,0,0,1,0,2,2,0,0,0,0,0,2,1,2,0,1,2,2,0,2,0,
+    0,1,0,2,0,0,0,1,0,2,0,0,2,0,0,0,0,0,0,1,29,5,0,0,0,1,0,0,2,0,2,0,
+    0,0,2,0,0,1,0,2,2,0,2,1,0,0,2,2,0,1,0,0,0,2,2,1,2,0,0,0,2,0,0,2,
+    2,1,0,0,0,2,2,0,0,0,2,0,2,1,0,2,0,0,2,1,0,0,1,0,2,0,0,0,0,0,0,0,
+    2,0,0,1,27,2,3,0,2,0,2,0,1,1,2,0,0,2,2,1,2,0,1,0,0,0,2,0,2,1,2,2,
+    2,0,2,1,0,0,0,0,4,2,0,1,2,0,0,2,2,0,0,1,0,0,2,0,0,0,0,2,2,1,0,0,
+    2,0,0,1,2,2,0,0,0,0,13,0,15,1,2,0,1,2,4,0,2,0,4,0,2,0,0,0,1,0,2,0,
+    2,0,0,1,2,0,2,0,2,2,0,0,2,1,0,0,2,0,2,0,0,0,0,0,0,0,2,1,2,0,2,0,
+    1,0,2,0,0,0,31,2,1,1,4,0,1,2,2,1,6,0,0,0,4,0,4,2,4,1,2,0,2,0,0,0,
+    4,0,1,0,0,0,0,1,4,2,0,1,1,2,0,1,0,0,2,0,2,0,21,0,9,0,4,0,4,0,4,1,
+    0,2,4,1,6,2,4,1,2,2,0,0,2,0,2,0,1,0,2,0,2,0,2,1,0,0,0,0,3,0,27,0,
+    8,0,3,0,6,0,6,0,8,0,0,0,4,1,0,2,2,0,6,0,2,0,1,0,3,1,17,0,1,0,4,0,
+    12,0,1,2,3,1,6,0,10,0,3,0,4,0,2,0,6,0,1,0,0,0,6,0,1,7,41,0,1,0,2,0,
+    0,1,0,2,2,0,0,0,0,0,0,0,2,0,0,0,0,0,2,0,1,0,0,0,2,0,0,0,0,0,0,0,
+    2,2,0,1,0,0,0,0,2,0,1,0,2,0,0,0,0,0,0,0,2,0,7,0,21,0,2,0,0,0,0,0,
+    2,0,0,0,0,0,0,0,0,0,2,0,2,0,0,0,0,0,2,1,0,2,0,0,0,0,2,0,0,0,0,0,
+    0,0,2,0,0,0,0,0,4,0,1,0,2,0,0,1,0,2,2,0,0,0,2,0,1,0,2,1,0,0,0,2,
+    2,0,0,1,2,0,0,2,0,1,0,2,0,1,0,0,0,5,29,1,1,0,4,0,0,0,2,2,0,1,2,0,
+    0,0,0,0,0,0,2,1,2,0,1,2,2,0,2,1,0,0,0,2,2,1,0,0,2,2,0,1,2,0,0,0,
+    0,0,4,0,0,0,0,0,2,0,0,0,0,2,0,1,2,0,0,0,2,0,2,0,1,0,2,0,0,0,0,1,
+    0,2,21,0,7,0,0,0,2,0,0,1,2,2,1,1,0,0,2,0,2,0,2,0,0,0,0,0,2,0,0,1,
+    0,0,2,2,4,0,0,0,0,1,4,0,0,2,2,1,0,0,0,2,2,1,1,0,2,0,2,0,0,0,2,0,
+    0,0,2,2,1,1,2,0,5,0,25,0,2,0,2,0,2,1,1,0,2,0,2,0,4,0,4,0,0,0,1,0,
+    0,0,4,0,0,2,2,0,2,1,4,0,1,0,2,0,1,0,4,0,0,0,0,0,2,0,0,0,2,0,2,0,
+    2,0,0,0,25,0,1,1,0,0,3,2,2,1,0,2,1,1,4,2,2,1,4,0,4,2,4,1,4,2,2,1,
+    0,0,2,0,1,1,2,2,1,1,4,2,2,1,0,2,1,1,2,2,0,1,27,0,2,2,3,1,2,0,6,0,
+    4,0,0,0,4,0,4,0,6,0,2,0,0,0,0,0,2,0,0,1,2,0,2,2,0,0,2,1,27,0,3,0,
+    2,0,6,0,1,0,4,1,8,2,6,0,0,0,4,0,2,0,4,0,4,0,0,0,1,0,29,0,6,0,2,0,
+    6,0,10,1,1,0,9,0,12,0,10,0,7,0,4,0,8,0,1,2,6,0,0,0,2,7,43,1,2,2,0,0,
+    2,0,0,0,0,1,0,2,0,0,2,0,1,0,2,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,2,0,
+    0,0,0,0,0,2,2,1,1,0,2,0,0,0,0,0,2,0,0,0,7,0,21,0,0,2,2,1,0,0,0,0,
+    0,0,2,0,2,0,0,0,2,0,1,0,0,0,2,0,0,0,2,0,0,0,2,0,0,0,0,0,2,0,0,0,
+    0,0,0,1,2,0,2,2,1,0,2,0,0,0,2,0,0,1,0,0,0,2,0,0,2,0,0,0,0,0,2,1,
+    0,2,2,0,0,0,0,1,0,2,2,1,1,3,2,3,31,2,0,1,2,2,1,1,2,0,2,0,2,0,0,0,
+    0,1,2,2,2,0,0,0,0,0,2,1,0,0,0,0,0,2,2,1,0,0,2,0,0,0,0,0,2,0,2,0,
+    0,2,0,1,2,0,2,0,0,0,0,0,2,0,2,0,0,0,0,0,0,1,0,0,2,0,0,0,2,0,1,2,
+    17,1,13,2,2,0,2,0,0,0,2,0,0,1,2,2,0,1,0,2,0,1,0,0,2,1,0,2,0,0,4,0,
+    0,0,2,1,0,0,2,0,2,0,0,2,2,1,0,2,2,1,2,0,0,0,0,2,2,1,0,0,2,0,0,0,
+    0,0,0,0,2,2,0,1,31,0,1,0,2,0,4,0,0,0,4,0,1,0,4,0,0,0,2,0,4,0,4,0,
+    1,0,0,0,2,1,2,0,0,0,2,0,2,0,0,0,2,0,1,0,2,1,2,0,1,0,2,0,2,0,0,0,
+    2,0,1,0,23,0,0,0,0,2,2,1,1,0,0,0,0,0,0,0,4,2,2,1,2,0,4,0,2,0,4,0,
+    2,0,2,0,2,0,1,0,2,0,0,1,2,2,0,1,2,2,1,1,19,2,7,1,4,0,2,0,3,0,0,0,
+    4,1,4,2,2,0,2,0,4,0,6,0,2,0,0,0,2,1,2,2,0,0,0,0,4,1,0,2,21,0,1,1,
+    5,0,4,0,4,0,2,0,4,0,6,0,4,2,2,0,2,0,2,0,6,1,4,0,1,0,25,0,1,0,6,0,
+    4,0,4,0,2,0,2,0,5,0,12,0,2,0,0,0,2,0,4,1,0,0,2,0,4,9,39,2,0,0,0,1,
+    1,2,2,0,0,0,2,0,0,1,0,2,0,0,0,0,0,0,2,0,1,0,2,0,0,0,2,0,0,0,0,0,
+    0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,2,9,1,19,0,2,0,0,0,0,0,2,0,0,0,
+    2,0,1,0,2,0,0,0,0,0,2,0,2,0,0,0,0,1,0,2,2,0,0,0,0,0,0,0,2,0,0,0,
+    2,0,0,0,0,0,0,1,2,2,0,0,2,0,1,0,2,0,0,0,2,1,0,0,0,0,0,0,2,2,0,0,
+    0,1,0,0,0,2,2,0,0,5,0,3,2,0,31,2,2,1,1,0,2,0,2,0,2,0,0,0,0,0,0,0,
+    2,0,0,1,0,0,2,0,0,0,0,0,2,2,0,0,2,1,2,0,1,0,2,2,0,1,2,0,0,2,2,1,
+    2,0,0,2,0,1,0,0,2,0,2,0,0,0,0,0,2,0,2,1,0,2,0,0,0,0,0,0,0,0,13,0,
+    17,0,2,0,2,1,0,2,2,1,0,2,2,0,0,1,0,0,0,0,2,0,2,0,0,0,0,1,0,0,0,0,
+    2,0,2,0,2,0,2,2,0,0,0,1,2,2,2,1,0,2,2,1,0,0,2,0,1,0,0,0,2,2,2,1,
+    2,0,0,0,0,0,27,2,3,1,2,0,0,0,0,0,4,0,0,0,4,0,1,0,2,1,4,0,2,0,2,0,
+    2,0,0,0,0,0,0,0,4,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,4,0,0,0,1,0,2,0,
+    2,0,29,0,2,0,2,0,4,1,0,2,0,0,0,1,0,2,0,1,1,0,2,0,4,0,2,0,4,0,2,0,
+    4,0,2,0,2,0,2,1,1,2,0,0,0,1,2,2,2,1,0,2,31,1,0,0,4,0,2,0,6,0,1,0,
+    0,0,4,0,0,0,0,0,4,0,4,0,4,0,4,0,0,0,0,0,2,0,2,1,2,2,2,0,25,1,4,2,
+    1,0,7,1,8,0,4,2,0,1,6,0,6,0,2,0,2,0,2,0,2,2,6,1,4,0,15,0,5,0,0,0,
+    0,0,2,0,6,1,0,0,3,0,2,0,10,0,1,0,2,0,6,0,1,0,4,0,4,7,41,0,0,1,2,2,
+    0,0,0,1,2,2,1,0,2,0,0,0,2,1,0,2,0,1,0,2,2,1,0,2,0,1,1,2,2,0,0,0,
+    0,0,2,0,0,0,0,0,2,0,0,0,1,0,0,0,7,0,17,0,0,0,0,0,2,0,1,0,2,0,2,0,
+    1,2,4,1,1,0,2,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,2,0,
+    0,0,0,0,2,0,0,0,0,1,2,0,1,0,2,2,0,0,2,0,0,0,0,0,0,0,2,0,0,1,0,2,
+    2,0,0,0,2,5,1,3,2,0,0,0,27,2,1,1,1,0,4,2,1,1,2,0,0,0,2,1,2,2,0,0,
+    0,0,2,0,0,0,0,0,0,0,2,0,0,1,2,0,0,0,0,0,4,0,1,0,0,0,2,0,0,0,0,0,
+    2,0,0,0,2,2,2,1,0,0,2,0,0,0,2,0,0,0,0,0,2,0,2,0,0,0,0,1,9,0,21,2,
+    2,0,0,0,0,0,2,1,0,2,2,1,0,0,2,0,2,2,0,1,1,0,0,0,2,0,2,0,0,0,0,0,
+    0,1,2,0,0,2,2,1,2,2,2,0,0,1,0,2,2,1,0,0,4,2,0,1,2,2,0,1,1,0,0,0,
+    2,0,2,0,13,0,15,0,0,2,2,1,0,0,0,0,0,0,2,0,2,1,2,0,2,2,0,0,2,0,2,0,
+    4,0,2,0,0,1,0,0,0,0,0,0,2,0,2,0,2,0,2,0,0,0,0,0,0,0,2,1,2,0,1,0,
+    13,0,13,0,2,2,4,0,0,0,2,1,2,2,0,0,0,1,0,2,0,1,0,2,0,1,2,2,2,1,4,0,
+    4,1,4,2,2,0,2,0,0,1,0,2,0,0,0,1,2,2,17,1,9,0,0,2,0,1,2,0,2,0,4,0,
+    1,2,2,1,6,0,4,2,1,0,2,0,4,1,4,0,2,2,0,1,2,0,0,0,0,0,17,1,0,2,0,0,
+    4,1,0,2,11,1,6,0,6,2,2,0,4,0,6,1,2,0,2,0,1,0,6,2,6,1,9,0,5,0,5,0,
+    6,0,0,0,4,0,4,0,2,0,5,0,8,0,2,0,0,0,2,0,0,0,4,0,2,7,39,1,0,2,0,0,
+    2,0,0,0,1,0,2,1,0,2,0,0,0,0,2,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,2,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,2,0,7,0,19,0,1,0,2,0,0,0,0,0,4,0,0,0,1,0,
+    4,1,1,2,2,0,0,0,2,0,1,0,2,0,2,1,1,2,2,0,0,0,2,0,0,0,2,0,1,0,2,0,
+    0,0,2,0,0,0,0,0,2,0,1,0,2,0,2,1,1,0,0,0,2,0,0,0,2,2,0,0,2,0,0,1,
+    1,0,2,5,0,0,2,1,0,0,25,2,3,1,0,0,2,0,0,0,2,0,0,0,0,0,0,0,0,1,2,0,
+    2,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,0,2,2,1,0,0,0,0,2,0,0,2,
+    0,1,2,0,2,0,0,0,2,0,0,0,2,0,0,0,2,1,0,2,0,0,0,0,2,1,1,2,29,0,2,0,
+    0,0,0,0,2,0,0,0,0,1,2,0,2,2,0,0,2,1,2,0,0,0,1,0,0,1,2,0,0,0,0,0,
+    2,2,1,0,2,1,2,2,0,1,2,0,2,2,2,1,0,0,2,2,0,1,2,0,0,0,0,0,2,0,2,2,
+    1,0,3,1,25,0,2,0,2,0,2,0,0,0,0,0,0,1,0,0,2,2,2,0,2,0,0,0,2,0,2,1,
+    2,0,2,0,2,2,0,0,0,0,2,0,2,0,0,1,2,0,2,0,0,0,2,1,1,0,0,2,2,0,2,0,
+    33,0,2,0,4,1,2,2,2,0,2,0,2,1,2,2,0,0,0,1,0,2,1,1,2,0,0,0,2,0,2,0,
+    4,0,2,0,4,0,2,0,4,0,0,0,0,0,0,0,1,1,23,2,0,0,4,1,1,0,0,2,2,1,2,2,
+    4,1,1,2,0,0,6,1,4,0,1,0,2,2,4,1,2,0,4,0,1,0,2,0,0,0,21,0,4,0,4,1,
+    1,2,2,1,0,2,7,1,4,0,2,0,6,0,4,2,4,0,0,1,6,0,1,0,4,2,5,0,2,1,5,0,
+    5,0,10,0,2,0,2,0,2,0,1,0,2,0,6,0,0,1,0,0,4,0,0,0,0,9,39,2,2,0,0,0,
+    0,1,0,2,2,0,0,0,0,0,0,1,0,2,0,0,2,0,0,0,0,0,0,0,0,0,2,0,0,0,1,0,
+    2,0,0,0,0,0,0,0,2,0,0,0,7,0,19,0,1,0,4,0,1,0,2,0,2,1,1,2,0,0,4,0,
+    1,0,2,0,0,0,2,0,0,0,2,0,1,1,0,2,4,0,1,0,2,0,0,1,2,0,1,0,2,2,0,0,
+    2,0,0,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,1,0,2,0,0,1,2,0,1,0,2,3,
+    2,3,0,0,0,0,0,2,25,0,5,1,2,0,2,0,0,2,0,1,2,0,0,0,2,0,0,0,2,0,0,0,
+    0,0,0,0,0,1,2,0,2,0,0,0,0,0,0,0,2,0,2,2,0,1,0,0,2,0,0,2,0,1,2,0,
+    0,0,0,0,0,0,2,2,2,1,0,0,2,0,2,0,1,0,2,0,2,0,0,1,0,2,31,0,4,2,0,1,
+    0,0,2,1,1,0,2,2,0,0,0,0,2,1,0,0,0,0,2,0,2,1,2,0,1,2,0,0,2,1,0,0,
+    0,0,2,2,0,0,0,1,2,0,0,2,0,1,2,0,2,2,0,1,2,0,0,2,2,1,2,2,0,0,0,1,
+    4,0,35,2,2,1,4,0,2,0,0,0,2,0,0,0,2,0,0,0,1,0,2,0,0,0,2,1,0,0,2,2,
+    2,0,2,1,2,0,2,0,2,0,0,0,0,0,4,0,0,0,0,0,2,0,0,0,4,0,0,0,1,0,27,0,
+    0,0,0,0,2,0,2,0,4,0,2,0,2,0,0,0,2,0,0,0,2,1,0,0,1,2,0,1,2,0,0,0,
+    0,0,4,0,4,0,2,0,4,0,2,1,2,2,0,0,9,0,17,1,4,2,0,0,2,0,0,1,1,2,2,1,
+    2,2,2,1,0,0,1,2,6,0,6,1,1,0,2,0,4,0,4,0,2,0,0,0,2,0,27,0,2,0,4,0,
+    6,1,0,2,2,1,3,2,5,0,4,0,2,0,6,1,4,0,6,2,0,0,2,0,25,0,14,1,12,2,1,1,
+    3,0,3,0,6,2,2,1,2,0,6,0,7,0,8,0,0,0,2,0,8,0,3,0,1,7,39,0,0,1,0,0,
+    2,2,0,0,0,1,0,2,2,0,0,0,0,0,0,1,0,2,0,1,2,2,2,1,1,2,0,1,2,2,0,0,
+    0,0,2,0,0,1,0,2,0,0,7,0,19,0,0,0,2,0,0,0,2,0,0,0,1,0,2,0,2,0,1,1,
+    2,2,2,0,0,0,0,0,0,0,2,1,0,2,2,0,1,0,2,0,0,1,2,2,1,0,2,0,2,1,0,0,
+    0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,2,0,1,0,2,0,0,2,2,0,1,1,2,5,0,1,
+    0,0,0,0,0,0,21,0,5,0,2,0,0,0,0,0,2,0,2,0,0,0,0,0,0,0,0,0,0,1,2,0,
+    2,0,0,0,0,2,0,0,0,0,2,0,0,0,2,0,0,0,0,1,2,0,2,0,0,0,0,0,0,0,0,0,
+    2,0,2,0,2,0,0,0,0,0,2,0,0,0,0,1,2,2,2,0,1,1,2,2,27,0,0,0,0,1,2,2,
+    0,0,0,0,2,0,1,1,2,0,0,0,1,0,4,0,0,0,0,1,2,2,2,0,2,1,1,0,0,2,2,0,
+    0,0,0,1,0,2,0,0,2,0,0,1,2,0,0,2,2,1,0,0,0,2,4,1,0,2,2,1,2,0,0,2,
+    31,1,0,0,2,2,2,1,0,0,2,0,2,0,2,0,0,0,2,0,0,0,0,1,2,0,0,2,2,0,1,1,
+    2,0,2,2,2,0,2,0,2,1,2,0,0,0,0,0,2,0,2,0,2,1,0,2,0,0,2,0,7,0,21,0,
+    0,0,2,0,1,0,4,0,2,0,4,0,2,0,2,1,2,2,2,0,1,0,2,0,0,1,0,0,1,0,2,0,
+    0,0,0,0,4,0,4,0,2,0,4,2,2,1,2,0,27,0,2,0,0,1,2,0,2,2,4,0,0,1,3,2,
+    0,0,2,0,2,0,1,0,0,1,4,2,6,1,0,2,2,1,4,2,4,1,0,0,15,0,5,0,0,0,2,0,
+    4,0,4,0,2,0,0,0,3,0,3,1,2,0,2,2,6,0,4,0,4,1,2,0,19,0,0,2,10,1,12,2,
+    5,1,1,0,1,0,6,2,2,1,2,0,2,0,0,0,2,0,2,0,4,0,1,0,2,7,37,1,0,2,0,0,
+    0,0,0,1,2,2,0,0,0,1,0,2,2,1,0,2,0,0,2,0,1,0,0,0,2,0,0,0,0,0,2,0,
+    0,1,1,2,2,0,0,0,9,0,17,0,0,0,0,0,2,1,0,2,0,0,2,0,2,0,0,0,0,0,0,0,
+    2,0,1,0,2,0,0,0,2,1,0,2,2,0,1,0,2,1,0,0,2,2,1,0,2,0,2,0,0,0,1,0,
+    2,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,2,1,1,5,2,1,0,0,0,0,
+    2,0,0,0,21,0,9,0,2,0,2,0,0,0,2,2,2,1,0,0,0,1,0,0,2,0,0,0,2,2,1,0,
+    0,1,2,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,2,0,0,0,2,0,0,0,0,0,
+    0,2,2,1,0,0,2,0,0,0,0,0,2,0,0,0,2,0,0,1,2,2,19,0,7,0,0,0,0,0,2,1,
+    0,0,0,2,2,1,2,0,0,0,0,0,0,0,0,0,2,1,0,2,0,0,0,1,2,2,2,0,0,0,2,0,
+    0,0,0,0,0,1,0,0,0,0,2,0,0,2,2,1,0,0,2,2,0,1,0,2,2,1,2,2,0,1,19,0,
+    9,2,2,1,0,0,0,0,4,0,2,0,0,0,2,1,2,2,0,0,2,0,0,0,1,0,2,1,2,0,2,2,
+    1,1,2,0,2,0,2,0,2,2,2,1,0,0,2,0,0,0,2,0,0,0,2,0,2,0,0,0,29,0,2,0,
+    2,0,0,0,0,0,1,1,2,2,2,0,2,0,4,0,2,1,2,0,2,0,0,0,0,0,0,0,0,0,0,0,
+    2,0,2,0,1,0,2,0,4,0,2,0,2,0,2,0,21,0,1,0,2,0,0,0,4,0,0,0,4,0,2,0,
+    1,1,0,2,0,0,4,1,3,2,0,1,4,0,4,0,2,0,0,0,4,0,6,2,21,1,1,0,6,0,1,0,
+    2,0,2,0,4,2,4,1,0,0,5,0,3,0,2,0,2,0,6,1,4,2,2,0,19,0,1,1,8,2,8,1,
+    8,2,7,1,0,0,2,0,8,2,0,1,6,0,5,0,6,0,1,0,2,0,6,0,1,9,37,2,0,0,2,1,
+    1,0,2,2,0,0,0,1,0,2,2,0,0,0,0,0,0,1,0,2,2,1,0,2,0,1,0,2,0,1,0,2,
+    2,0,0,0,0,0,5,1,21,2,0,0,2,0,0,0,0,0,0,0,2,0,0,1,0,2,2,0,0,1,2,2,
+    0,0,2,0,0,0,0,1,0,2,0,0,2,0,0,1,0,2,2,0,1,0,4,0,0,0,0,0,0,0,2,0,
+    0,0,0,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,1,0,1,0,5,2,0,0,0,0,0,2,0,
+    1,0,19,0,7,0,2,0,0,0,0,0,2,0,2,1,0,0,0,0,0,2,2,0,0,0,2,0,1,1,2,0,
+    2,2,1,0,2,1,1,0,4,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,2,2,1,0,2,2,1,
+    0,0,0,0,0,0,2,0,0,0,2,0,0,1,2,2,0,1,2,2,15,0,13,0,0,0,2,0,2,0,0,0,
+    2,0,2,1,1,2,0,0,2,0,0,1,2,0,1,0,0,0,2,0,0,1,2,2,0,0,2,1,2,0,1,2,
+    2,0,0,0,2,0,0,0,1,0,2,0,2,1,0,0,0,2,0,1,2,2,2,1,2,2,0,1,11,2,19,1,
+    2,0,0,0,2,0,2,0,2,0,2,0,4,0,0,2,0,1,2,0,0,1,2,2,0,1,0,2,0,0,2,1,
+    2,2,0,0,0,0,2,1,2,0,0,0,4,0,0,2,0,1,0,0,4,2,2,1,0,0,19,0,9,0,2,0,
+    0,0,2,0,4,0,0,0,1,0,0,0,4,0,2,0,2,0,2,0,2,0,2,0,0,0,2,0,0,0,0,0,
+    0,0,0,1,2,0,0,0,0,0,2,0,4,0,27,0,4,0,6,0,1,0,4,0,1,0,4,0,0,2,4,1,
+    2,2,3,1,4,1,0,2,2,1,0,0,1,2,2,1,4,2,0,1,2,2,4,1,21,0,4,0,1,0,8,0,
+    0,2,4,1,0,0,0,0,4,0,0,0,1,0,3,0,0,1,2,2,6,0,4,0,25,1,8,2,3,1,10,2,
+    8,1,0,2,0,0,2,1,2,0,0,2,4,1,4,0,2,2,0,0,1,1,8,0,2,7,37,0,2,1,0,2,
+    0,0,0,0,0,1,2,2,0,0,0,1,0,2,0,1,2,2,0,1,0,2,0,0,0,0,2,0,0,0,0,0,
+    0,0,0,0,5,0,21,0,2,0,0,1,0,2,0,1,2,2,0,0,0,0,2,0,0,0,0,0,0,0,2,0,
+    0,0,0,0,2,1,0,2,2,0,0,0,0,1,2,2,0,0,0,0,2,1,1,0,2,0,0,0,0,0,2,0,
+    0,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,2,0,0,3,0,3,0,0,0,0,0,0,2,0,1,0,
+    17,0,11,0,2,0,0,0,2,0,2,0,0,0,0,0,2,0,0,0,2,0,2,0,0,1,0,0,2,2,0,1,
+    1,0,2,0,2,2,0,1,1,0,2,0,2,0,1,0,4,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,
+    0,0,2,0,0,0,0,1,2,2,0,0,0,0,2,0,2,0,11,0,17,0,0,0,2,0,2,0,2,0,0,0,
+    0,0,0,1,2,0,0,0,0,0,2,0,0,0,0,1,2,2,0,1,0,2,0,0,2,1,0,2,2,0,0,1,
+    0,0,2,0,0,0,2,0,0,0,1,0,0,2,2,0,2,1,2,2,0,1,0,2,0,1,7,2,25,1,4,2,
+    2,1,2,2,2,1,0,2,2,1,2,0,0,0,4,0,2,0,0,0,2,0,1,0,4,0,0,0,1,1,2,2,
+    0,0,2,1,2,0,0,2,0,1,4,2,0,1,2,0,2,0,0,0,0,0,2,2,2,0,29,1,2,0,0,2,
+    2,0,2,0,0,0,4,0,0,1,1,0,0,0,4,0,2,0,2,1,2,0,2,0,2,0,1,0,2,0,0,0,
+    0,0,0,0,0,0,2,2,2,0,2,1,1,0,27,0,6,0,4,0,4,0,0,0,4,0,1,0,4,0,2,0,
+    4,0,4,0,7,0,2,0,2,0,0,0,0,1,2,2,0,1,4,2,0,1,17,0,5,0,8,2,4,1,1,2,
+    6,1,0,2,4,1,4,2,0,1,2,2,1,1,0,0,1,0,1,0,2,0,19,1,2,2,0,1,6,2,2,1,
+    8,2,10,0,5,1,2,2,0,0,8,1,3,2,8,0,0,1,6,0,3,2,4,1,4,9,35,0,0,2,0,0,
+    0,1,0,0,0,2,0,0,2,1,0,2,0,1,2,2,1,0,0,0,2,0,0,1,2,2,1,0,2,0,0,0,
+    0,0,3,1,23,2,0,0,2,0,0,0,0,0,2,0,0,0,2,0,0,1,0,2,2,0,0,1,0,2,0,0,
+    2,0,0,1,0,2,2,0,0,0,0,1,0,2,0,0,2,0,0,1,0,2,2,0,0,0,0,0,2,0,0,0,
+    0,0,2,0,0,0,0,0,2,0,0,0,0,0,0,3,0,5,2,0,0,0,0,0,0,0,2,1,0,2,19,0,
+    11,0,4,0,1,0,2,0,2,0,0,0,2,0,2,0,1,0,2,0,2,1,0,0,0,2,0,1,0,0,2,2,
+    0,1,2,0,1,0,2,2,2,1,0,0,0,0,2,0,1,0,2,0,0,0,0,2,2,1,0,0,2,0,0,0,
+    2,0,1,0,2,0,0,0,0,0,2,1,2,2,0,1,7,2,21,0,0,0,2,0,2,0,0,0,2,0,2,1,
+    2,0,0,2,0,0,0,1,2,0,0,0,0,0,2,0,1,0,2,0,2,0,0,1,0,2,2,0,0,0,2,0,
+    0,0,0,0,2,0,0,0,2,0,0,0,0,1,0,0,0,2,2,1,2,2,0,1,3,2,31,1,2,0,0,0,
+    4,0,2,0,2,0,2,0,0,0,0,2,4,1,0,0,2,0,4,0,0,0,2,1,0,2,0,1,2,2,1,0,
+    2,1,0,2,0,1,2,0,2,0,0,0,4,0,0,0,2,2,2,1,0,0,0,0,31,0,6,2,2,0,2,1,
+    2,0,1,0,2,0,0,0,6,0,2,0,1,0,3,1,4,0,0,2,2,0,2,0,2,0,4,1,0,0,0,2,
+    0,0,0,0,2,0,0,1,0,0,2,0,29,0,4,0,0,0,2,0,6,0,4,2,1,1,4,2,0,1,2,0,
+    2,0,4,0,6,0,5,1,1,2,2,0,2,0,1,1,2,2,2,1,2,0,29,0,4,2,6,1,4,2,4,1,
+    0,2,4,1,2,2,6,1,2,0,2,0,2,0,3,0,1,0,0,0,1,0,29,0,8,1,4,2,4,1,1,2,
+    10,0,12,1,2,2,5,0,6,1,2,2,4,1,1,0,2,2,6,1,1,0,0,2,6,7,35,0,0,1,0,0,
+    2,2,0,0,0,1,0,0,0,2,0,1,2,2,1,0,2,1,0,2,0,1,0,2,0,1,2,0,0,2,0,1,
+    3,2,23,0,0,1,2,2,0,1,2,2,0,1,0,2,0,0,2,1,0,2,0,0,2,1,0,2,2,0,0,0,
+    0,1,0,2,2,0,0,0,0,1,2,2,0,0,2,1,1,0,2,2,0,0,0,0,2,0,0,0,0,0,0,0,
+    2,0,0,1,0,0,2,0,1,0,2,0,0,5,2,1,0,0,0,0,2,0,0,0,0,0,0,0,21,1,7,2,
+    0,0,0,2,4,0,0,1,0,0,2,0,0,0,0,0,2,0,2,1,0,2,0,0,2,1,0,2,2,1,1,0,
+    2,2,0,1,2,0,0,0,0,2,0,1,0,0,0,0,2,0,0,0,0,0,2,0,0,0,2,2,0,1,2,0,
+    0,0,0,0,0,0,2,0,2,0,0,0,0,1,5,2,25,0,0,0,4,0,0,0,2,0,2,1,0,0,2,2,
+    0,0,2,1,2,0,2,0,1,0,0,0,2,0,0,0,2,1,0,2,0,0,2,0,0,0,0,0,0,0,2,0,
+    2,0,0,0,0,1,0,0,2,0,2,2,0,0,1,0,2,0,0,0,0,1,0,2,33,1,2,0,0,2,4,1,
+    0,2,2,1,0,0,2,0,2,0,2,0,0,0,4,0,0,0,2,1,2,2,2,0,0,0,2,0,0,0,0,1,
+    0,2,0,1,2,2,2,1,0,2,0,1,0,2,4,1,2,0,0,2,2,0,15,0,13,0,2,0,4,1,4,0,
+    0,0,2,0,0,0,0,0,0,0,4,0,2,1,0,2,1,0,2,0,2,1,0,0,2,0,2,2,2,0,0,1,
+    0,0,0,0,0,0,2,0,0,0,11,0,19,0,6,0,6,0,2,2,2,0,0,1,4,2,0,1,4,0,1,2,
+    2,1,2,0,4,0,6,0,1,1,1,0,0,2,0,0,1,1,2,0,3,2,19,0,0,1,2,2,8,1,6,2,
+    2,1,2,2,4,1,0,2,6,0,4,1,0,2,0,1,1,2,1,1,0,1,35,2,6,0,8,0,2,0,8,0,
+    1,0,8,0,10,0,3,1,1,2,6,0,6,0,3,0,8,0,0,0,4,0,3,0,4,9,35,0,0,2,0,0,
+    2,0,0,1,0,2,2,0,1,1,2,2,1,0,2,1,0,2,2,1,1,2,2,1,0,2,0,0,0,0,0,0,
+    25,1,0,2,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,0,1,
+    0,2,2,0,0,0,0,1,0,2,2,0,0,1,0,2,2,0,0,0,2,0,0,1,0,0,2,0,0,0,0,0,
+    0,0,0,2,2,0,0,0,2,1,0,7,0,0,1,0,2,0,0,0,0,0,0,0,2,0,19,0,9,0,0,0,
+    2,0,0,0,0,0,2,0,2,0,0,0,2,0,0,0,2,1,0,2,0,1,2,0,0,2,2,1,1,2,2,1,
+    0,0,0,2,2,1,2,0,0,0,0,0,0,0,2,0,0,0,0,0,2,2,0,1,0,0,0,0,0,0,2,0,
+    0,0,2,0,0,0,0,0,0,1,0,2,1,0,27,0,2,0,2,0,0,0,2,1,0,0,2,2,2,0,0,1,
+    4,0,0,0,0,0,0,0,2,0,0,0,0,1,2,2,2,0,0,0,0,1,0,2,0,0,0,0,2,0,0,1,
+    2,0,0,0,0,2,2,0,0,0,0,1,2,2,2,0,1,1,0,2,0,0,33,1,0,2,2,0,2,1,0,2,
+    2,1,2,0,4,2,0,1,0,0,2,0,0,0,2,0,2,0,0,0,4,0,2,0,2,0,0,0,2,0,0,0,
+    0,1,0,2,0,1,0,2,2,1,2,2,2,1,0,2,0,0,4,1,0,0,29,0,2,0,0,0,4,2,2,0,
+    4,0,2,1,0,0,2,0,1,0,0,0,2,0,4,0,1,0,2,1,0,2,2,0,2,0,0,0,2,0,2,0,
+    0,0,2,0,1,0,0,1,2,0,33,0,0,0,2,2,6,0,4,1,4,0,4,2,2,1,2,0,3,2,6,1,
+    1,0,2,0,2,0,2,0,6,0,1,0,1,0,0,0,2,0,1,0,29,1,2,2,6,0,2,1,2,2,6,1,
+    4,2,2,1,2,2,4,1,2,2,6,0,2,1,2,2,0,1,3,0,21,0,5,0,3,0,4,0,6,0,4,0,
+    4,0,0,0,12,0,8,0,7,0,2,1,2,2,8,0,3,1,2,2,8,0,0,1,0,7,35,0,2,1,0,0,
+    0,0,0,2,2,0,1,1,2,2,1,0,2,1,2,2,0,1,1,2,2,0,0,0,0,0,2,0,1,1,27,2,
+    0,0,2,0,2,0,1,1,2,2,0,1,2,2,0,0,2,1,0,2,0,0,2,1,0,2,0,1,0,0,2,2,
+    0,0,0,0,0,1,2,2,0,0,0,1,2,2,0,0,0,1,0,0,2,0,0,2,0,0,0,0,2,0,0,0,
+    0,0,0,0,2,1,0,3,0,5,0,2,2,0,0,0,2,0,0,0,0,0,0,0,19,0,9,0,0,0,0,0,
+    2,0,2,0,0,1,2,2,0,0,0,0,2,1,2,0,0,2,0,1,2,2,0,1,0,0,2,0,0,0,0,0,
+    2,0,2,0,1,0,2,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,2,0,1,0,
+    2,0,2,0,0,0,0,0,0,0,1,1,29,2,2,0,0,0,2,0,0,1,2,2,4,0,0,0,2,1,0,2,
+    0,1,4,2,0,1,2,0,0,0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,0,1,0,2,
+    0,0,2,0,2,0,1,0,2,0,2,0,0,0,0,0,2,0,0,1,29,2,3,0,0,1,0,0,2,2,2,1,
+    0,0,2,2,0,1,4,0,2,2,0,1,2,0,1,0,4,0,2,0,0,0,2,0,2,0,2,0,0,1,2,2,
+    0,0,2,1,0,2,1,1,0,2,2,1,0,2,2,1,2,0,0,2,29,0,4,0,0,0,2,0,0,1,2,0,
+    4,0,2,2,4,1,0,0,0,0,0,1,0,2,2,0,4,1,1,2,0,0,2,0,0,0,2,0,0,0,2,1,
+    4,0,1,0,2,0,1,2,23,0,7,0,4,0,0,1,0,0,8,2,4,0,4,1,2,2,2,0,2,1,3,0,
+    4,0,1,0,2,0,2,0,4,0,4,0,0,1,0,2,0,0,1,0,35,0,6,1,2,2,6,0,2,0,2,0,
+    8,0,2,0,2,1,2,2,2,1,4,2,6,0,2,1,0,0,0,2,25,0,0,1,0,0,1,0,0,2,0,1,
+    6,0,0,0,8,0,12,2,4,1,5,0,4,0,2,0,0,0,2,0,6,1,2,2,1,
+};
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <stdexcept>
+#include <algorithm>
+#include <glm.hpp>
+
+// keyframed camera animation for offline renders. the file is plain text, one keyframe per line:
+//   time  position.x position.y position.z  pitch yaw  fov
+// with time in seconds and angles in degrees like Camera. blank lines and lines starting with # are skipped.
+// positions and angles are interpolated with uniform Catmull-Rom splines through the keyframes
+class CameraPath {
+public:
+    struct Keyframe {
+        float time;
+        glm::vec3 position;
+        float pitch, yaw;
+        float fov;
+    };
+
+    CameraPath() = default;
+
+    explicit CameraPath(std::vector<Keyframe> keyframes) : mKeyframes(std::move(keyframes)) {
+        if (mKeyframes.empty()) {
+            throw std::runtime_error("Camera path has no keyframes");
+        }
+        std::stable_sort(mKeyframes.begin(), mKeyframes.end(),
+                         [](const Keyframe &a, const Keyframe &b) { return a.time < b.time; });
+    }
+
+    const std::vector<Keyframe> &keyframes() const { return mKeyframes; }
+
+    float startTime() const { return mKeyframes.front().time; }
+
+    float duration() const { return mKeyframes.back().time - mKeyframes.front().time; }
+
+    Keyframe sample(float time) const {
+        time = glm::clamp(time, mKeyframes.front().time, mKeyframes.back().time);
+        size_t next = std::upper_bound(mKeyframes.begin(), mKeyframes.end(), time,
+                                       [](float t, const Keyframe &key) { return t < key.time; }) -
+                      mKeyframes.begin();
+        if (next == 0 || next >= mKeyframes.size()) {
+            Keyframe key = next == 0 ? mKeyframes.front() : mKeyframes.back();
+            key.time = time;
+            return key;
+        }
+
+        // the end keyframes are repeated as outer control points
+        const Keyframe &k0 = mKeyframes[next >= 2 ? next - 2 : 0];
+        const Keyframe &k1 = mKeyframes[next - 1];
+        const Keyframe &k2 = mKeyframes[next];
+        const Keyframe &k3 = mKeyframes[std::min(next + 1, mKeyframes.size() - 1)];
+        float span = k2.time - k1.time;
+        float t = span > 0.0f ? (time - k1.time) / span : 1.0f;
+
+        Keyframe key;
+        key.time = time;
+        key.position = catmullRom(k0.position, k1.position, k2.position, k3.position, t);
+        key.pitch = catmullRom(k0.pitch, k1.pitch, k2.pitch, k3.pitch, t);
+        key.yaw = catmullRom(k0.yaw, k1.yaw, k2.yaw, k3.yaw, t);
+        key.fov = catmullRom(k0.fov, k1.fov, k2.fov, k3.fov, t);
+        return key;
+    }
+
+    static CameraPath fromFile(const std::string &filename) {
+        std::ifstream file(filename);
+        if (!file) {
+            throw std::runtime_error("Failed to open camera path file: " + filename);
+        }
+
+        std::vector<Keyframe> keyframes;
+        std::string line;
+        for (int lineNumber = 1; std::getline(file, line); ++lineNumber) {
+            size_t first = line.find_first_not_of(" \t\r");
+            if (first == std::string::npos || line[first] == '#') {
+                continue;
+            }
+            std::istringstream stream(line);
+            Keyframe key;
+            if (!(stream >> key.time >> key.position.x >> key.position.y >> key.position.z >> key.pitch >> key.yaw >>
+                  key.fov)) {
+                throw std::runtime_error("Bad keyframe at " + filename + ":" + std::to_string(lineNumber));
+            }
+            keyframes.push_back(key);
+        }
+        return CameraPath(std::move(keyframes));
+    }
+
+private:
+    template <typename T>
+    static T catmullRom(const T &p0, const T &p1, const T &p2, const T &p3, float t) {
+        float t2 = t * t, t3 = t2 * t;
+        return 0.5f * ((2.0f * p1) + (p2 - p0) * t + (2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3) * t2 +
+                       (3.0f * p1 - p0 - 3.0f * p2 + p3) * t3);
+    }
+
+    std::vector<Keyframe> mKeyframes;
+};
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// per frame bump allocator over a range of persistently mapped memory, recording threads allocate from it at the same
+// time without locks. offsets are multiples of Alignment, the placement constant buffer views and root cbvs need.
+// beginFrame() starts over once the gpu is done with the previous use of the range and keeps the high-water mark
+class ConstantAllocator {
+public:
+    static const uint64_t Invalid = UINT64_MAX;
+    static const uint64_t Alignment = 256;
+
+    ConstantAllocator() = default;
+
+    explicit ConstantAllocator(uint64_t capacity) : mCapacity(capacity) {}
+
+    // copies are only valid while no thread allocates from either side
+    ConstantAllocator(const ConstantAllocator &other) { *this = other; }
+
+    ConstantAllocator &operator=(const ConstantAllocator &other) {
+        mCapacity = other.mCapacity;
+        mHead.store(other.mHead.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        mFailed.store(other.mFailed.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        mLastFrame = other.mLastFrame;
+        mHighWater = other.mHighWater;
+        return *this;
+    }
+
+    // offset of size bytes, Invalid when the frame's range is exhausted
+    uint64_t allocate(uint64_t size) {
+        const uint64_t aligned = (size + Alignment - 1) & ~(Alignment - 1);
+        const uint64_t offset = mHead.fetch_add(aligned, std::memory_order_relaxed);
+        if (offset + aligned > mCapacity) {
+            mFailed.fetch_add(1, std::memory_order_relaxed);
+            return Invalid;
+        }
+        return offset;
+    }
+
+    // not thread safe, called between frames
+    void beginFrame() {
+        mLastFrame = requested();
+        mHighWater = mHighWater > mLastFrame ? mHighWater : mLastFrame;
+        mHead.store(0, std::memory_order_relaxed);
+        mFailed.store(0, std::memory_order_relaxed);
+    }
+
+    uint64_t capacity() const { return mCapacity; }
+
+    // bytes asked for this frame, failed allocations included, so it can exceed the capacity
+    uint64_t requested() const { return mHead.load(std::memory_order_relaxed); }
+
+    uint64_t used() const { return requested() < mCapacity ? requested() : mCapacity; }
+
+    uint32_t failed() const { return mFailed.load(std::memory_order_relaxed); }
+
+    uint64_t lastFrame() const { return mLastFrame; }
+
+    // the most any finished frame requested, the capacity it would have needed
+    uint64_t highWater() const { return mHighWater; }
+
+private:
+    uint64_t mCapacity = 0;
+    std::atomic<uint64_t> mHead{0};
+    std::atomic<uint32_t> mFailed{0};
+    uint64_t mLastFrame = 0;
+    uint64_t mHighWater = 0;
+};
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+// marks functions that use AVX2 and FMA intrinsics in files built for the baseline isa, they may only run after
+// CpuFeatures::get().avx2 is checked. msvc accepts the intrinsics anywhere, gcc and clang need the target attribute
+#if defined(__GNUC__) || defined(__clang__)
+#define TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+#define TARGET_AVX2
+#endif
+
+// instruction set extensions usable on this machine, for runtime dispatch between simd paths
+struct CpuFeatures {
+    // AVX2 and FMA with ymm state saved by the os
+    bool avx2 = false;
+
+    static const CpuFeatures &get() {
+        static const CpuFeatures features = detect();
+        return features;
+    }
+
+private:
+    static CpuFeatures detect() {
+        CpuFeatures features;
+        uint32_t regs[4];
+        cpuid(0, 0, regs);
+        if (regs[0] < 7) {
+            return features;
+        }
+
+        cpuid(1, 0, regs);
+        const bool fma = (regs[2] & (1u << 12)) != 0;
+        const bool osxsave = (regs[2] & (1u << 27)) != 0;
+        const bool avx = (regs[2] & (1u << 28)) != 0;
+        if (!fma || !osxsave || !avx || (xgetbv0() & 0x6) != 0x6) {
+            return features;
+        }
+        cpuid(7, 0, regs);
+        features.avx2 = (regs[1] & (1u << 5)) != 0;
+        return features;
+    }
+
+    static void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t (&regs)[4]) {
+#if defined(_MSC_VER)
+        int values[4];
+        __cpuidex(values, static_cast<int>(leaf), static_cast<int>(subleaf));
+        for (int i = 0; i < 4; ++i) {
+            regs[i] = static_cast<uint32_t>(values[i]);
+        }
+#else
+        __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+    }
+
+    static uint64_t xgetbv0() {
+#if defined(_MSC_VER)
+        return _xgetbv(0);
+#else
+        uint32_t eax, edx;
+        __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+        return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+    }
+};
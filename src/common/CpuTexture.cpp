@@ -0,0 +1,281 @@
+#include <immintrin.h>
+
+#include "src/common/CpuTexture.h"
+#include "src/common/CpuFeatures.h"
+
+namespace {
+    struct Texel8 {
+        __m256 r, g, b, a;
+    };
+
+    // where the texels of a texture live, see CpuTexture::texelIndex
+    struct Layout8 {
+        TexelFormat format;
+        const uint8_t *data;
+        const uint32_t *levelOffset;
+        const uint32_t *levelTilesX;
+        const uint32_t *levelFaceStride;
+    };
+
+    TARGET_AVX2 inline __m256i gatherTable(const uint32_t *table, __m256i level) {
+        return _mm256_i32gather_epi32(reinterpret_cast<const int *>(table), level, 4);
+    }
+
+    // binary16 to float with integer ops, so F16C is not required: the magnitude is moved into float position and
+    // rebiased by 2^112, which also turns half subnormals into normal floats. inf and nan get the full exponent
+    TARGET_AVX2 inline __m256 halfToFloat8(__m256i h) {
+        __m256i sign = _mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(0x8000)), 16);
+        __m256i magnitude = _mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(0x7fff)), 13);
+        __m256 rebias = _mm256_castsi256_ps(_mm256_set1_epi32(0x77800000));
+        __m256i value = _mm256_castps_si256(_mm256_mul_ps(_mm256_castsi256_ps(magnitude), rebias));
+        __m256i infNan = _mm256_cmpgt_epi32(magnitude, _mm256_set1_epi32(0x0f7fffff));
+        value = _mm256_or_si256(value, _mm256_and_si256(infNan, _mm256_set1_epi32(0x7f800000)));
+        return _mm256_castsi256_ps(_mm256_or_si256(value, sign));
+    }
+
+    TARGET_AVX2 inline __m256 unorm8(__m256i bytes) {
+        return _mm256_mul_ps(_mm256_cvtepi32_ps(bytes), _mm256_set1_ps(1.0f / 255.0f));
+    }
+
+    TARGET_AVX2 Texel8 fetch8(const Layout8 &layout, __m256i index) {
+        const __m256i byteMask = _mm256_set1_epi32(0xff);
+        const int *words = reinterpret_cast<const int *>(layout.data);
+        switch (layout.format) {
+        case TexelFormat::R8: {
+            // reads 4 bytes per texel, the texture keeps 4 bytes of padding after the last one
+            __m256i value = _mm256_and_si256(_mm256_i32gather_epi32(words, index, 1), byteMask);
+            return {unorm8(value), _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_set1_ps(1.0f)};
+        }
+        case TexelFormat::RGBA8:
+        case TexelFormat::RGBA8_SRGB: {
+            __m256i value = _mm256_i32gather_epi32(words, index, 4);
+            __m256i r = _mm256_and_si256(value, byteMask);
+            __m256i g = _mm256_and_si256(_mm256_srli_epi32(value, 8), byteMask);
+            __m256i b = _mm256_and_si256(_mm256_srli_epi32(value, 16), byteMask);
+            __m256 a = unorm8(_mm256_srli_epi32(value, 24));
+            if (layout.format == TexelFormat::RGBA8) {
+                return {unorm8(r), unorm8(g), unorm8(b), a};
+            }
+            const float *decode = CpuTexture::srgbTable();
+            return {_mm256_i32gather_ps(decode, r, 4), _mm256_i32gather_ps(decode, g, 4),
+                    _mm256_i32gather_ps(decode, b, 4), a};
+        }
+        case TexelFormat::RGBA16F: {
+            const __m256i halfMask = _mm256_set1_epi32(0xffff);
+            __m256i word = _mm256_slli_epi32(index, 1);
+            __m256i rg = _mm256_i32gather_epi32(words, word, 4);
+            __m256i ba = _mm256_i32gather_epi32(words, _mm256_add_epi32(word, _mm256_set1_epi32(1)), 4);
+            return {halfToFloat8(_mm256_and_si256(rg, halfMask)), halfToFloat8(_mm256_srli_epi32(rg, 16)),
+                    halfToFloat8(_mm256_and_si256(ba, halfMask)), halfToFloat8(_mm256_srli_epi32(ba, 16))};
+        }
+        default: {
+            const float *floats = reinterpret_cast<const float *>(layout.data);
+            __m256i word = _mm256_slli_epi32(index, 2);
+            const __m256i one = _mm256_set1_epi32(1);
+            __m256i word1 = _mm256_add_epi32(word, one);
+            __m256i word2 = _mm256_add_epi32(word1, one);
+            __m256i word3 = _mm256_add_epi32(word2, one);
+            return {_mm256_i32gather_ps(floats, word, 4), _mm256_i32gather_ps(floats, word1, 4),
+                    _mm256_i32gather_ps(floats, word2, 4), _mm256_i32gather_ps(floats, word3, 4)};
+        }
+        }
+    }
+
+    // a + (b - a) * t
+    TARGET_AVX2 inline Texel8 lerp8(const Texel8 &a, const Texel8 &b, __m256 t) {
+        return {_mm256_fmadd_ps(_mm256_sub_ps(b.r, a.r), t, a.r), _mm256_fmadd_ps(_mm256_sub_ps(b.g, a.g), t, a.g),
+                _mm256_fmadd_ps(_mm256_sub_ps(b.b, a.b), t, a.b), _mm256_fmadd_ps(_mm256_sub_ps(b.a, a.a), t, a.a)};
+    }
+
+    // offset of tile row y from the start of a face, plus the row inside the tile
+    TARGET_AVX2 inline __m256i tiledRow8(__m256i y, __m256i tilesX) {
+        const __m256i tileMask = _mm256_set1_epi32(CpuTexture::TileSize - 1);
+        __m256i tileRow = _mm256_mullo_epi32(_mm256_srli_epi32(y, CpuTexture::TileShift), tilesX);
+        __m256i inTile = _mm256_slli_epi32(_mm256_and_si256(y, tileMask), CpuTexture::TileShift);
+        return _mm256_add_epi32(_mm256_slli_epi32(tileRow, 2 * CpuTexture::TileShift), inTile);
+    }
+
+    TARGET_AVX2 inline __m256i tiledColumn8(__m256i x) {
+        const __m256i tileMask = _mm256_set1_epi32(CpuTexture::TileSize - 1);
+        __m256i tileColumn = _mm256_slli_epi32(_mm256_srli_epi32(x, CpuTexture::TileShift), 2 * CpuTexture::TileShift);
+        return _mm256_add_epi32(tileColumn, _mm256_and_si256(x, tileMask));
+    }
+
+    // bilinear footprint between stored coordinates (x0, y0) and (x1, y1), per lane level and face
+    TARGET_AVX2 Texel8 bilinear8(const Layout8 &layout, __m256i level, __m256i face, __m256i x0, __m256i x1,
+                                 __m256i y0, __m256i y1, __m256 fx, __m256 fy) {
+        __m256i base = _mm256_add_epi32(gatherTable(layout.levelOffset, level),
+                                        _mm256_mullo_epi32(face, gatherTable(layout.levelFaceStride, level)));
+        __m256i tilesX = gatherTable(layout.levelTilesX, level);
+        __m256i row0 = _mm256_add_epi32(base, tiledRow8(y0, tilesX));
+        __m256i row1 = _mm256_add_epi32(base, tiledRow8(y1, tilesX));
+        __m256i column0 = tiledColumn8(x0), column1 = tiledColumn8(x1);
+
+        Texel8 top = lerp8(fetch8(layout, _mm256_add_epi32(row0, column0)),
+                           fetch8(layout, _mm256_add_epi32(row0, column1)), fx);
+        Texel8 bottom = lerp8(fetch8(layout, _mm256_add_epi32(row1, column0)),
+                              fetch8(layout, _mm256_add_epi32(row1, column1)), fx);
+        return lerp8(top, bottom, fy);
+    }
+
+    // max(size >> level, 1) per lane
+    TARGET_AVX2 inline __m256 levelSize8(uint32_t size, __m256i level) {
+        __m256i levelSize = _mm256_srlv_epi32(_mm256_set1_epi32(static_cast<int>(size)), level);
+        return _mm256_cvtepi32_ps(_mm256_max_epi32(levelSize, _mm256_set1_epi32(1)));
+    }
+
+    // texel coordinate into [0, size - 1], wrapping or clamping like CpuTexture::resolve. the final clamp also
+    // catches nan and inf so gathers never leave the texture
+    TARGET_AVX2 inline __m256i resolve8(__m256 coord, __m256 size, AddressMode address) {
+        if (address == AddressMode::Wrap) {
+            coord = _mm256_sub_ps(coord, _mm256_mul_ps(size, _mm256_floor_ps(_mm256_div_ps(coord, size))));
+        }
+        coord = _mm256_min_ps(_mm256_max_ps(coord, _mm256_setzero_ps()), _mm256_sub_ps(size, _mm256_set1_ps(1.0f)));
+        return _mm256_cvttps_epi32(coord);
+    }
+
+    // lod into the two levels to blend, see CpuTexture::selectLevels
+    TARGET_AVX2 inline void selectLevels8(const float *lods, uint32_t levels, MipFilter filter, __m256i &level0,
+                                          __m256i &level1, __m256 &frac) {
+        __m256 lod = _mm256_max_ps(_mm256_loadu_ps(lods), _mm256_setzero_ps());
+        lod = _mm256_min_ps(lod, _mm256_set1_ps(float(levels - 1)));
+        if (filter == MipFilter::Point) {
+            lod = _mm256_floor_ps(_mm256_add_ps(lod, _mm256_set1_ps(0.5f)));
+        }
+        __m256 base = _mm256_floor_ps(lod);
+        frac = _mm256_sub_ps(lod, base);
+        level0 = _mm256_cvttps_epi32(base);
+        level1 = _mm256_min_epi32(_mm256_add_epi32(level0, _mm256_set1_epi32(1)), _mm256_set1_epi32(levels - 1));
+    }
+
+    // CpuTexture::sampleLevel per lane
+    TARGET_AVX2 Texel8 sampleLevel8(const Layout8 &layout, __m256i level, __m256 u, __m256 v, __m256 width,
+                                    __m256 height, AddressMode address) {
+        const __m256 half = _mm256_set1_ps(0.5f), one = _mm256_set1_ps(1.0f);
+        __m256 x = _mm256_sub_ps(_mm256_mul_ps(u, width), half);
+        __m256 y = _mm256_sub_ps(_mm256_mul_ps(v, height), half);
+        __m256 x0 = _mm256_floor_ps(x), y0 = _mm256_floor_ps(y);
+        __m256i xa = resolve8(x0, width, address), xb = resolve8(_mm256_add_ps(x0, one), width, address);
+        __m256i ya = resolve8(y0, height, address), yb = resolve8(_mm256_add_ps(y0, one), height, address);
+        return bilinear8(layout, level, _mm256_setzero_si256(), xa, xb, ya, yb, _mm256_sub_ps(x, x0),
+                         _mm256_sub_ps(y, y0));
+    }
+
+    // CpuTexture::sampleCubeLevel per lane after face selection
+    TARGET_AVX2 Texel8 sampleCubeLevel8(const Layout8 &layout, __m256i level, __m256i face, __m256 s, __m256 t,
+                                        __m256 size) {
+        const __m256 half = _mm256_set1_ps(0.5f), zero = _mm256_setzero_ps();
+        const __m256i one = _mm256_set1_epi32(1);
+        // stored coordinates, the border texel sits at -1 and size
+        __m256 x = _mm256_add_ps(_mm256_mul_ps(s, size), half);
+        __m256 y = _mm256_add_ps(_mm256_mul_ps(t, size), half);
+        __m256 x0 = _mm256_floor_ps(x), y0 = _mm256_floor_ps(y);
+        __m256i xi = _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(x0, zero), size));
+        __m256i yi = _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(y0, zero), size));
+        return bilinear8(layout, level, face, xi, _mm256_add_epi32(xi, one), yi, _mm256_add_epi32(yi, one),
+                         _mm256_sub_ps(x, x0), _mm256_sub_ps(y, y0));
+    }
+
+    TARGET_AVX2 inline bool anyPositive(__m256 v) {
+        return _mm256_movemask_ps(_mm256_cmp_ps(v, _mm256_setzero_ps(), _CMP_GT_OQ)) != 0;
+    }
+
+    TARGET_AVX2 inline void store8(const Texel8 &texel, SampleBatch &out) {
+        _mm256_storeu_ps(out.r, texel.r);
+        _mm256_storeu_ps(out.g, texel.g);
+        _mm256_storeu_ps(out.b, texel.b);
+        _mm256_storeu_ps(out.a, texel.a);
+    }
+}
+
+void CpuTexture::sample8(const float *u, const float *v, const float *lod, const CpuSampler &sampler,
+                         SampleBatch &out) const {
+    if (CpuFeatures::get().avx2) {
+        sample8AVX2(u, v, lod, sampler, out);
+        return;
+    }
+    for (uint32_t lane = 0; lane < SampleBatch::Width; ++lane) {
+        glm::vec4 color = sample({u[lane], v[lane]}, lod[lane], sampler);
+        out.r[lane] = color.r;
+        out.g[lane] = color.g;
+        out.b[lane] = color.b;
+        out.a[lane] = color.a;
+    }
+}
+
+void CpuTexture::sampleCube8(const float *x, const float *y, const float *z, const float *lod,
+                             const CpuSampler &sampler, SampleBatch &out) const {
+    if (CpuFeatures::get().avx2) {
+        sampleCube8AVX2(x, y, z, lod, sampler, out);
+        return;
+    }
+    for (uint32_t lane = 0; lane < SampleBatch::Width; ++lane) {
+        glm::vec4 color = sampleCube({x[lane], y[lane], z[lane]}, lod[lane], sampler);
+        out.r[lane] = color.r;
+        out.g[lane] = color.g;
+        out.b[lane] = color.b;
+        out.a[lane] = color.a;
+    }
+}
+
+TARGET_AVX2 void CpuTexture::sample8AVX2(const float *u, const float *v, const float *lod, const CpuSampler &sampler,
+                                         SampleBatch &out) const {
+    const Layout8 layout{mFormat, mData.data(), mLevelOffset.data(), mLevelTilesX.data(), mLevelFaceStride.data()};
+    const __m256 uu = _mm256_loadu_ps(u), vv = _mm256_loadu_ps(v);
+
+    __m256i level0, level1;
+    __m256 frac;
+    selectLevels8(lod, levels(), sampler.mipFilter, level0, level1, frac);
+    Texel8 color = sampleLevel8(layout, level0, uu, vv, levelSize8(mWidth, level0), levelSize8(mHeight, level0),
+                                sampler.address);
+    if (anyPositive(frac)) {
+        Texel8 next = sampleLevel8(layout, level1, uu, vv, levelSize8(mWidth, level1), levelSize8(mHeight, level1),
+                                   sampler.address);
+        color = lerp8(color, next, frac);
+    }
+    store8(color, out);
+}
+
+TARGET_AVX2 void CpuTexture::sampleCube8AVX2(const float *x, const float *y, const float *z, const float *lod,
+                                             const CpuSampler &sampler, SampleBatch &out) const {
+    const Layout8 layout{mFormat, mData.data(), mLevelOffset.data(), mLevelTilesX.data(), mLevelFaceStride.data()};
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    const __m256 dx = _mm256_loadu_ps(x), dy = _mm256_loadu_ps(y), dz = _mm256_loadu_ps(z);
+
+    // CubeMap::faceCoords with blends instead of branches
+    __m256 ax = _mm256_andnot_ps(signMask, dx);
+    __m256 ay = _mm256_andnot_ps(signMask, dy);
+    __m256 az = _mm256_andnot_ps(signMask, dz);
+    __m256 isX = _mm256_and_ps(_mm256_cmp_ps(ax, ay, _CMP_GE_OQ), _mm256_cmp_ps(ax, az, _CMP_GE_OQ));
+    __m256 isY = _mm256_andnot_ps(isX, _mm256_cmp_ps(ay, az, _CMP_GE_OQ));
+    __m256 posX = _mm256_cmp_ps(dx, zero, _CMP_GT_OQ);
+    __m256 posY = _mm256_cmp_ps(dy, zero, _CMP_GT_OQ);
+    __m256 posZ = _mm256_cmp_ps(dz, zero, _CMP_GT_OQ);
+
+    __m256 ma = _mm256_blendv_ps(_mm256_blendv_ps(az, ay, isY), ax, isX);
+    __m256 faceZ = _mm256_blendv_ps(_mm256_set1_ps(5.0f), _mm256_set1_ps(4.0f), posZ);
+    __m256 faceY = _mm256_blendv_ps(_mm256_set1_ps(3.0f), _mm256_set1_ps(2.0f), posY);
+    __m256 faceX = _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_set1_ps(0.0f), posX);
+    __m256i face = _mm256_cvttps_epi32(_mm256_blendv_ps(_mm256_blendv_ps(faceZ, faceY, isY), faceX, isX));
+
+    __m256 negX = _mm256_xor_ps(dx, signMask), negZ = _mm256_xor_ps(dz, signMask);
+    __m256 uZ = _mm256_blendv_ps(negX, dx, posZ);
+    __m256 uX = _mm256_blendv_ps(dz, negZ, posX);
+    __m256 faceU = _mm256_blendv_ps(_mm256_blendv_ps(uZ, dx, isY), uX, isX);
+    __m256 vY = _mm256_blendv_ps(dz, negZ, posY);
+    __m256 faceV = _mm256_blendv_ps(dy, vY, isY);
+
+    __m256 s = _mm256_add_ps(_mm256_mul_ps(_mm256_div_ps(faceU, ma), half), half);
+    __m256 t = _mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_add_ps(_mm256_mul_ps(_mm256_div_ps(faceV, ma), half), half));
+
+    __m256i level0, level1;
+    __m256 frac;
+    selectLevels8(lod, levels(), sampler.mipFilter, level0, level1, frac);
+    Texel8 color = sampleCubeLevel8(layout, level0, face, s, t, levelSize8(mWidth, level0));
+    if (anyPositive(frac)) {
+        color = lerp8(color, sampleCubeLevel8(layout, level1, face, s, t, levelSize8(mWidth, level1)), frac);
+    }
+    store8(color, out);
+}
@@ -0,0 +1,374 @@
+#pragma once
+
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <glm.hpp>
+
+#include "src/common/Half.h"
+#include "src/common/Image.h"
+#include "src/common/CubeMap.h"
+
+// texel formats of the textures DxRenderer creates, decoded to linear rgba float on fetch
+enum class TexelFormat { R8, RGBA8, RGBA8_SRGB, RGBA16F, RGBA32F };
+
+enum class AddressMode { Wrap, Clamp };
+
+enum class MipFilter { Point, Linear };
+
+struct CpuSampler {
+    AddressMode address = AddressMode::Wrap;
+    MipFilter mipFilter = MipFilter::Linear;
+};
+
+// results of eight lookups in SoA layout
+struct SampleBatch {
+    static const uint32_t Width = 8;
+
+    float r[Width], g[Width], b[Width], a[Width];
+
+    glm::vec4 get(uint32_t lane) const { return {r[lane], g[lane], b[lane], a[lane]}; }
+};
+
+// 2D texture or cube map with a mip chain, sampled on the cpu the way the shaders sample on the gpu: bilinear or
+// trilinear filtering, wrap or clamp addressing for 2D and seamless lookups for cubes. texels are stored in 4x4 tiles
+// so a bilinear footprint touches one cache line or two. every cube face keeps a one texel border copied from its
+// neighbours, which makes filtering across face edges seamless without any special cases in the lookup.
+// sample8() and sampleCube8() do eight lookups per call with AVX2 gathers when the cpu has them
+class CpuTexture {
+public:
+    static const uint32_t TileShift = 2;
+    static const uint32_t TileSize = 1u << TileShift;
+
+    CpuTexture() : mFormat(TexelFormat::RGBA8), mWidth(0), mHeight(0), mFaces(1), mBorder(0) {}
+
+    TexelFormat format() const { return mFormat; }
+
+    uint32_t width(uint32_t level = 0) const { return std::max(mWidth >> level, 1u); }
+
+    uint32_t height(uint32_t level = 0) const { return std::max(mHeight >> level, 1u); }
+
+    uint32_t levels() const { return static_cast<uint32_t>(mLevelOffset.size()); }
+
+    bool isCube() const { return mFaces == 6; }
+
+    size_t byteSize() const { return mData.size(); }
+
+    static uint32_t bytesPerTexel(TexelFormat format) {
+        switch (format) {
+        case TexelFormat::R8: return 1;
+        case TexelFormat::RGBA8:
+        case TexelFormat::RGBA8_SRGB: return 4;
+        case TexelFormat::RGBA16F: return 8;
+        default: return 16;
+        }
+    }
+
+    static const char *formatName(TexelFormat format) {
+        switch (format) {
+        case TexelFormat::R8: return "R8";
+        case TexelFormat::RGBA8: return "RGBA8";
+        case TexelFormat::RGBA8_SRGB: return "RGBA8_SRGB";
+        case TexelFormat::RGBA16F: return "RGBA16F";
+        default: return "RGBA32F";
+        }
+    }
+
+    // texel at stored coordinates, which include the border of cube faces
+    glm::vec4 fetch(uint32_t level, uint32_t face, uint32_t x, uint32_t y) const {
+        const size_t index = texelIndex(level, face, x, y);
+        const uint8_t *texel = mData.data() + index * bytesPerTexel(mFormat);
+        switch (mFormat) {
+        case TexelFormat::R8:
+            return {texel[0] / 255.0f, 0.0f, 0.0f, 1.0f};
+        case TexelFormat::RGBA8:
+            return glm::vec4{texel[0], texel[1], texel[2], texel[3]} / 255.0f;
+        case TexelFormat::RGBA8_SRGB: {
+            const float *decode = srgbTable();
+            return {decode[texel[0]], decode[texel[1]], decode[texel[2]], texel[3] / 255.0f};
+        }
+        case TexelFormat::RGBA16F: {
+            uint16_t halfs[4];
+            std::memcpy(halfs, texel, sizeof(halfs));
+            return {halfToFloat(halfs[0]), halfToFloat(halfs[1]), halfToFloat(halfs[2]), halfToFloat(halfs[3])};
+        }
+        default: {
+            glm::vec4 value;
+            std::memcpy(&value, texel, sizeof(value));
+            return value;
+        }
+        }
+    }
+
+    // bilinear lookup in one level of a 2D texture
+    glm::vec4 sampleLevel(const glm::vec2 &uv, uint32_t level, AddressMode address = AddressMode::Wrap) const {
+        const int w = static_cast<int>(width(level)), h = static_cast<int>(height(level));
+        float x = uv.x * w - 0.5f;
+        float y = uv.y * h - 0.5f;
+        float x0 = std::floor(x), y0 = std::floor(y);
+        float fx = x - x0, fy = y - y0;
+
+        int xi = static_cast<int>(x0), yi = static_cast<int>(y0);
+        uint32_t xa = resolve(xi, w, address), xb = resolve(xi + 1, w, address);
+        uint32_t ya = resolve(yi, h, address), yb = resolve(yi + 1, h, address);
+        return bilinear(level, 0, xa, xb, ya, yb, fx, fy);
+    }
+
+    // lod is log2 of the texel footprint at level 0, like SampleLevel
+    glm::vec4 sample(const glm::vec2 &uv, float lod, const CpuSampler &sampler = CpuSampler{}) const {
+        uint32_t level0, level1;
+        float frac;
+        selectLevels(lod, sampler.mipFilter, level0, level1, frac);
+        glm::vec4 color = sampleLevel(uv, level0, sampler.address);
+        if (frac > 0.0f) {
+            color = glm::mix(color, sampleLevel(uv, level1, sampler.address), frac);
+        }
+        return color;
+    }
+
+    glm::vec4 sampleCubeLevel(const glm::vec3 &dir, uint32_t level) const {
+        uint32_t face;
+        float s, t;
+        CubeMap::faceCoords(dir, face, s, t);
+
+        // stored coordinates, the border texel sits at -1 and size
+        const int size = static_cast<int>(width(level));
+        float x = s * size + 0.5f;
+        float y = t * size + 0.5f;
+        float x0 = std::floor(x), y0 = std::floor(y);
+        float fx = x - x0, fy = y - y0;
+
+        int xi = glm::clamp(static_cast<int>(x0), 0, size), yi = glm::clamp(static_cast<int>(y0), 0, size);
+        return bilinear(level, face, xi, xi + 1, yi, yi + 1, fx, fy);
+    }
+
+    glm::vec4 sampleCube(const glm::vec3 &dir, float lod, const CpuSampler &sampler = CpuSampler{}) const {
+        uint32_t level0, level1;
+        float frac;
+        selectLevels(lod, sampler.mipFilter, level0, level1, frac);
+        glm::vec4 color = sampleCubeLevel(dir, level0);
+        if (frac > 0.0f) {
+            color = glm::mix(color, sampleCubeLevel(dir, level1), frac);
+        }
+        return color;
+    }
+
+    // eight 2D lookups, every lane is sampled and non finite coordinates are clamped into the texture
+    void sample8(const float *u, const float *v, const float *lod, const CpuSampler &sampler, SampleBatch &out) const;
+
+    // eight cube lookups, directions need not be normalized
+    void sampleCube8(const float *x, const float *y, const float *z, const float *lod, const CpuSampler &sampler,
+                     SampleBatch &out) const;
+
+    // lod of a pixel whose uv changes by dx and dy to its right and lower neighbours
+    float computeLod(const glm::vec2 &dx, const glm::vec2 &dy) const {
+        glm::vec2 size{mWidth, mHeight};
+        float footprint = std::max(glm::dot(dx * size, dx * size), glm::dot(dy * size, dy * size));
+        return footprint > 0.0f ? 0.5f * std::log2(footprint) : 0.0f;
+    }
+
+    // texels are linear rgba, encoded into the format. levels = 0 builds the full chain with a 2x2 box filter
+    static CpuTexture fromTexels(uint32_t width, uint32_t height, const glm::vec4 *texels, TexelFormat format,
+                                 uint32_t levels = 0) {
+        CpuTexture texture;
+        texture.allocate(width, height, 1, 0, format, levels);
+
+        std::vector<glm::vec4> level(texels, texels + static_cast<size_t>(width) * height);
+        for (uint32_t index = 0;; ++index) {
+            const uint32_t w = texture.width(index), h = texture.height(index);
+            for (uint32_t y = 0; y < h; ++y) {
+                for (uint32_t x = 0; x < w; ++x) {
+                    texture.store(index, 0, x, y, level[static_cast<size_t>(y) * w + x]);
+                }
+            }
+            if (index + 1 == texture.levels()) {
+                break;
+            }
+            level = downsample(level, w, h);
+        }
+        return texture;
+    }
+
+    // 8 bit images are read as unorm, or srgb for RGBA8_SRGB, hdr images as float
+    static CpuTexture fromImage(const Image &image, TexelFormat format, uint32_t levels = 0) {
+        const uint32_t width = static_cast<uint32_t>(image.width()), height = static_cast<uint32_t>(image.height());
+        const uint32_t channels = static_cast<uint32_t>(image.channels());
+        std::vector<glm::vec4> texels(static_cast<size_t>(width) * height, glm::vec4{0.0f, 0.0f, 0.0f, 1.0f});
+        for (size_t i = 0; i < texels.size(); ++i) {
+            for (uint32_t c = 0; c < std::min(channels, 4u); ++c) {
+                if (image.isHDR()) {
+                    texels[i][c] = image.pixels<float>()[i * channels + c];
+                } else {
+                    uint8_t value = image.pixels<uint8_t>()[i * channels + c];
+                    texels[i][c] = format == TexelFormat::RGBA8_SRGB && c < 3 ? srgbTable()[value] : value / 255.0f;
+                }
+            }
+        }
+        return fromTexels(width, height, texels.data(), format, levels);
+    }
+
+    // keeps the levels of the cube map and adds the borders
+    static CpuTexture fromCubeMap(const CubeMap &cube, TexelFormat format) {
+        CpuTexture texture;
+        texture.allocate(cube.size(), cube.size(), 6, 1, format, cube.levels());
+        for (uint32_t level = 0; level < texture.levels(); ++level) {
+            const int size = static_cast<int>(cube.size(level));
+            for (uint32_t face = 0; face < 6; ++face) {
+                for (int y = -1; y <= size; ++y) {
+                    for (int x = -1; x <= size; ++x) {
+                        glm::vec4 value;
+                        if (x >= 0 && y >= 0 && x < size && y < size) {
+                            value = cube.texel(level, face, x, y);
+                        } else {
+                            // the texel the extrapolated direction lands on in the neighbouring face
+                            glm::vec3 dir = CubeMap::direction(face, (x + 0.5f) / size, (y + 0.5f) / size);
+                            uint32_t neighbour;
+                            float s, t;
+                            CubeMap::faceCoords(dir, neighbour, s, t);
+                            int nx = glm::clamp(static_cast<int>(s * size), 0, size - 1);
+                            int ny = glm::clamp(static_cast<int>(t * size), 0, size - 1);
+                            value = cube.texel(level, neighbour, nx, ny);
+                        }
+                        texture.store(level, face, x + 1, y + 1, value);
+                    }
+                }
+            }
+        }
+        return texture;
+    }
+
+    static const float *srgbTable() {
+        static const std::vector<float> table = [] {
+            std::vector<float> values(256);
+            for (uint32_t i = 0; i < 256; ++i) {
+                float c = i / 255.0f;
+                values[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+            }
+            return values;
+        }();
+        return table.data();
+    }
+
+private:
+    void allocate(uint32_t width, uint32_t height, uint32_t faces, uint32_t border, TexelFormat format,
+                  uint32_t levels) {
+        mFormat = format;
+        mWidth = width;
+        mHeight = height;
+        mFaces = faces;
+        mBorder = border;
+
+        uint32_t maxLevels = 1;
+        while ((std::max(width, height) >> maxLevels) > 0) {
+            ++maxLevels;
+        }
+        levels = levels > 0 ? std::min(levels, maxLevels) : maxLevels;
+
+        uint32_t offset = 0;
+        for (uint32_t level = 0; level < levels; ++level) {
+            uint32_t tilesX = (this->width(level) + 2 * border + TileSize - 1) / TileSize;
+            uint32_t tilesY = (this->height(level) + 2 * border + TileSize - 1) / TileSize;
+            mLevelOffset.push_back(offset);
+            mLevelTilesX.push_back(tilesX);
+            mLevelFaceStride.push_back(tilesX * tilesY * TileSize * TileSize);
+            offset += faces * mLevelFaceStride.back();
+        }
+        // R8 gathers read 4 bytes from the last texel
+        mData.assign(static_cast<size_t>(offset) * bytesPerTexel(format) + 4, 0);
+    }
+
+    uint32_t texelIndex(uint32_t level, uint32_t face, uint32_t x, uint32_t y) const {
+        uint32_t tile = (y >> TileShift) * mLevelTilesX[level] + (x >> TileShift);
+        uint32_t inTile = ((y & (TileSize - 1)) << TileShift) | (x & (TileSize - 1));
+        return mLevelOffset[level] + face * mLevelFaceStride[level] + tile * TileSize * TileSize + inTile;
+    }
+
+    void store(uint32_t level, uint32_t face, uint32_t x, uint32_t y, const glm::vec4 &value) {
+        const size_t index = texelIndex(level, face, x, y);
+        uint8_t *texel = mData.data() + index * bytesPerTexel(mFormat);
+        auto unorm = [](float v) { return static_cast<uint8_t>(glm::clamp(v, 0.0f, 1.0f) * 255.0f + 0.5f); };
+        switch (mFormat) {
+        case TexelFormat::R8:
+            texel[0] = unorm(value.r);
+            break;
+        case TexelFormat::RGBA8:
+        case TexelFormat::RGBA8_SRGB:
+            for (int c = 0; c < 4; ++c) {
+                float v = value[c];
+                if (mFormat == TexelFormat::RGBA8_SRGB && c < 3) {
+                    v = v <= 0.0031308f ? v * 12.92f : 1.055f * std::pow(v, 1.0f / 2.4f) - 0.055f;
+                }
+                texel[c] = unorm(v);
+            }
+            break;
+        case TexelFormat::RGBA16F: {
+            uint16_t halfs[4];
+            for (int c = 0; c < 4; ++c) {
+                halfs[c] = floatToHalf(value[c]);
+            }
+            std::memcpy(texel, halfs, sizeof(halfs));
+            break;
+        }
+        default:
+            std::memcpy(texel, &value, sizeof(value));
+            break;
+        }
+    }
+
+    static uint32_t resolve(int coord, int size, AddressMode address) {
+        if (address == AddressMode::Clamp) {
+            return static_cast<uint32_t>(glm::clamp(coord, 0, size - 1));
+        }
+        return static_cast<uint32_t>(((coord % size) + size) % size);
+    }
+
+    glm::vec4 bilinear(uint32_t level, uint32_t face, uint32_t xa, uint32_t xb, uint32_t ya, uint32_t yb, float fx,
+                       float fy) const {
+        glm::vec4 top = glm::mix(fetch(level, face, xa, ya), fetch(level, face, xb, ya), fx);
+        glm::vec4 bottom = glm::mix(fetch(level, face, xa, yb), fetch(level, face, xb, yb), fx);
+        return glm::mix(top, bottom, fy);
+    }
+
+    void selectLevels(float lod, MipFilter filter, uint32_t &level0, uint32_t &level1, float &frac) const {
+        const float maxLod = float(levels() - 1);
+        lod = std::isnan(lod) ? 0.0f : glm::clamp(lod, 0.0f, maxLod);
+        if (filter == MipFilter::Point) {
+            lod = std::floor(lod + 0.5f);
+        }
+        float base = std::floor(lod);
+        level0 = static_cast<uint32_t>(base);
+        level1 = std::min(level0 + 1, levels() - 1);
+        frac = lod - base;
+    }
+
+    static std::vector<glm::vec4> downsample(const std::vector<glm::vec4> &src, uint32_t srcW, uint32_t srcH) {
+        const uint32_t w = std::max(srcW / 2, 1u), h = std::max(srcH / 2, 1u);
+        std::vector<glm::vec4> dst(static_cast<size_t>(w) * h);
+        for (uint32_t y = 0; y < h; ++y) {
+            for (uint32_t x = 0; x < w; ++x) {
+                uint32_t sx = std::min(2 * x, srcW - 1), sx1 = std::min(2 * x + 1, srcW - 1);
+                uint32_t sy = std::min(2 * y, srcH - 1), sy1 = std::min(2 * y + 1, srcH - 1);
+                dst[static_cast<size_t>(y) * w + x] = 0.25f * (src[sy * srcW + sx] + src[sy * srcW + sx1] +
+                                                               src[sy1 * srcW + sx] + src[sy1 * srcW + sx1]);
+            }
+        }
+        return dst;
+    }
+
+    void sample8AVX2(const float *u, const float *v, const float *lod, const CpuSampler &sampler,
+                     SampleBatch &out) const;
+
+    void sampleCube8AVX2(const float *x, const float *y, const float *z, const float *lod, const CpuSampler &sampler,
+                         SampleBatch &out) const;
+
+    TexelFormat mFormat;
+    uint32_t mWidth, mHeight;
+    uint32_t mFaces, mBorder;
+    // per level, in texels from the start of mData
+    std::vector<uint32_t> mLevelOffset;
+    std::vector<uint32_t> mLevelTilesX;
+    std::vector<uint32_t> mLevelFaceStride;
+    std::vector<uint8_t> mData;
+};
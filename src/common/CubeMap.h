@@ -0,0 +1,199 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <glm.hpp>
+
+#include "src/common/Image.h"
+#include "src/common/Parallel.h"
+#include "src/common/Sampling.h"
+
+// bilinear lookup in an rgba float equirectangular image, same mapping as equirect2cube.hlsl
+inline glm::vec4 sampleEquirect(const Image &image, const glm::vec3 &dir) {
+    const float *pixels = image.pixels<float>();
+    const int width = image.width();
+    const int height = image.height();
+
+    float u = std::atan2(dir.z, dir.x) / TwoPI;
+    float v = std::acos(glm::clamp(dir.y, -1.0f, 1.0f)) / PI;
+
+    float x = (u - std::floor(u)) * width - 0.5f;
+    float y = v * height - 0.5f;
+    int x0 = static_cast<int>(std::floor(x));
+    int y0 = static_cast<int>(std::floor(y));
+    float fx = x - x0;
+    float fy = y - y0;
+
+    auto fetch = [&](int px, int py) {
+        px = ((px % width) + width) % width;
+        py = glm::clamp(py, 0, height - 1);
+        const float *p = pixels + (static_cast<size_t>(py) * width + px) * 4;
+        return glm::vec4{p[0], p[1], p[2], p[3]};
+    };
+    glm::vec4 top = glm::mix(fetch(x0, y0), fetch(x0 + 1, y0), fx);
+    glm::vec4 bottom = glm::mix(fetch(x0, y0 + 1), fetch(x0 + 1, y0 + 1), fx);
+    return glm::mix(top, bottom, fy);
+}
+
+// rgba float cube map with a full mip chain, face order and orientation match GetSamplingVector in the shaders
+class CubeMap {
+public:
+    CubeMap() : mSize(0), mLevels(0) {}
+
+    CubeMap(uint32_t size, uint32_t levels = 0) : mSize(size) {
+        uint32_t maxLevels = 1;
+        while (size >> maxLevels) {
+            ++maxLevels;
+        }
+        mLevels = (levels > 0) ? std::min(levels, maxLevels) : maxLevels;
+        mData.resize(mLevels);
+        for (uint32_t level = 0; level < mLevels; ++level) {
+            uint32_t levelSize = this->size(level);
+            mData[level].resize(6 * static_cast<size_t>(levelSize) * levelSize);
+        }
+    }
+
+    uint32_t size(uint32_t level = 0) const { return std::max(1u, mSize >> level); }
+
+    uint32_t levels() const { return mLevels; }
+
+    glm::vec4 *face(uint32_t level, uint32_t face) {
+        return mData[level].data() + static_cast<size_t>(face) * size(level) * size(level);
+    }
+
+    const glm::vec4 *face(uint32_t level, uint32_t face) const {
+        return mData[level].data() + static_cast<size_t>(face) * size(level) * size(level);
+    }
+
+    glm::vec4 texel(uint32_t level, uint32_t face, uint32_t x, uint32_t y) const {
+        return this->face(level, face)[y * size(level) + x];
+    }
+
+    size_t byteSize(size_t bytesPerTexel = 8) const {
+        size_t texels = 0;
+        for (const std::vector<glm::vec4> &level : mData) {
+            texels += level.size();
+        }
+        return texels * bytesPerTexel;
+    }
+
+    // direction through (s, t) in [0, 1]^2 of a face, t grows downwards
+    static glm::vec3 direction(uint32_t face, float s, float t) {
+        float u = s * 2.0f - 1.0f;
+        float v = (1.0f - t) * 2.0f - 1.0f;
+
+        glm::vec3 dir;
+        switch (face) {
+        case 0: dir = { 1.0f,  v,   -u   }; break; // +X
+        case 1: dir = {-1.0f,  v,    u   }; break; // -X
+        case 2: dir = { u,     1.0f, -v  }; break; // +Y
+        case 3: dir = { u,    -1.0f,  v  }; break; // -Y
+        case 4: dir = { u,     v,    1.0f}; break; // +Z
+        default: dir = {-u,    v,   -1.0f}; break; // -Z
+        }
+        return glm::normalize(dir);
+    }
+
+    // inverse of direction()
+    static void faceCoords(const glm::vec3 &dir, uint32_t &face, float &s, float &t) {
+        glm::vec3 a = glm::abs(dir);
+        float u, v, ma;
+        if (a.x >= a.y && a.x >= a.z) {
+            ma = a.x;
+            face = dir.x > 0.0f ? 0 : 1;
+            u = dir.x > 0.0f ? -dir.z : dir.z;
+            v = dir.y;
+        } else if (a.y >= a.z) {
+            ma = a.y;
+            face = dir.y > 0.0f ? 2 : 3;
+            u = dir.x;
+            v = dir.y > 0.0f ? -dir.z : dir.z;
+        } else {
+            ma = a.z;
+            face = dir.z > 0.0f ? 4 : 5;
+            u = dir.z > 0.0f ? dir.x : -dir.x;
+            v = dir.y;
+        }
+        s = (u / ma) * 0.5f + 0.5f;
+        t = 1.0f - ((v / ma) * 0.5f + 0.5f);
+    }
+
+    glm::vec4 sampleLevel(const glm::vec3 &dir, uint32_t level) const {
+        uint32_t faceIndex;
+        float s, t;
+        faceCoords(dir, faceIndex, s, t);
+
+        const int levelSize = static_cast<int>(size(level));
+        const glm::vec4 *texels = face(level, faceIndex);
+
+        float x = s * levelSize - 0.5f;
+        float y = t * levelSize - 0.5f;
+        int x0 = static_cast<int>(std::floor(x));
+        int y0 = static_cast<int>(std::floor(y));
+        float fx = x - x0;
+        float fy = y - y0;
+
+        auto fetch = [&](int px, int py) {
+            px = glm::clamp(px, 0, levelSize - 1);
+            py = glm::clamp(py, 0, levelSize - 1);
+            return texels[py * levelSize + px];
+        };
+        glm::vec4 top = glm::mix(fetch(x0, y0), fetch(x0 + 1, y0), fx);
+        glm::vec4 bottom = glm::mix(fetch(x0, y0 + 1), fetch(x0 + 1, y0 + 1), fx);
+        return glm::mix(top, bottom, fy);
+    }
+
+    glm::vec4 sample(const glm::vec3 &dir, float lod = 0.0f) const {
+        lod = glm::clamp(lod, 0.0f, float(mLevels - 1));
+        uint32_t level = static_cast<uint32_t>(lod);
+        float frac = lod - level;
+        glm::vec4 color = sampleLevel(dir, level);
+        if (frac > 0.0f && level + 1 < mLevels) {
+            color = glm::mix(color, sampleLevel(dir, level + 1), frac);
+        }
+        return color;
+    }
+
+    // 2x2 box filter per face, same as downsample_array.hlsl
+    void generateMipmaps() {
+        for (uint32_t level = 1; level < mLevels; ++level) {
+            const uint32_t dstSize = size(level);
+            const uint32_t srcSize = size(level - 1);
+            parallelFor(0, 6 * dstSize, [&](uint32_t row) {
+                uint32_t faceIndex = row / dstSize;
+                uint32_t y = row % dstSize;
+                const glm::vec4 *src = face(level - 1, faceIndex);
+                glm::vec4 *dst = face(level, faceIndex) + y * dstSize;
+                for (uint32_t x = 0; x < dstSize; ++x) {
+                    uint32_t sx = std::min(2 * x, srcSize - 1), sx1 = std::min(2 * x + 1, srcSize - 1);
+                    uint32_t sy = std::min(2 * y, srcSize - 1), sy1 = std::min(2 * y + 1, srcSize - 1);
+                    dst[x] = 0.25f * (src[sy * srcSize + sx] + src[sy * srcSize + sx1] +
+                                      src[sy1 * srcSize + sx] + src[sy1 * srcSize + sx1]);
+                }
+            });
+        }
+    }
+
+    static CubeMap fromEquirect(const Image &image, uint32_t size, uint32_t levels = 0) {
+        if (!image.isHDR() || image.channels() != 4) {
+            throw std::runtime_error("CubeMap::fromEquirect expects an rgba float image");
+        }
+        CubeMap cube(size, levels);
+        parallelFor(0, 6 * size, [&](uint32_t row) {
+            uint32_t faceIndex = row / size;
+            uint32_t y = row % size;
+            glm::vec4 *dst = cube.face(0, faceIndex) + y * size;
+            for (uint32_t x = 0; x < size; ++x) {
+                glm::vec3 dir = direction(faceIndex, (x + 0.5f) / size, (y + 0.5f) / size);
+                dst[x] = sampleEquirect(image, dir);
+            }
+        });
+        cube.generateMipmaps();
+        return cube;
+    }
+
+private:
+    uint32_t mSize, mLevels;
+    std::vector<std::vector<glm::vec4>> mData;
+};
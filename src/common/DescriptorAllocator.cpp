@@ -0,0 +1,121 @@
+#include <stdexcept>
+
+#include "src/common/DescriptorAllocator.h"
+
+DescriptorAllocator::DescriptorAllocator(uint32_t persistentCapacity, uint32_t transientCapacity) {
+    reset(persistentCapacity, transientCapacity);
+}
+
+void DescriptorAllocator::reset(uint32_t persistentCapacity, uint32_t transientCapacity) {
+    if (uint64_t(persistentCapacity) + transientCapacity >= Invalid) {
+        throw std::runtime_error("Descriptor allocator capacity too large");
+    }
+    mPersistentCapacity = persistentCapacity;
+    mTransientCapacity = transientCapacity;
+    mPersistentUsed = 0;
+    mFreeByFirst.clear();
+    mFreeBySize.clear();
+    if (persistentCapacity > 0) {
+        insertFree(0, persistentCapacity);
+    }
+    mRingHead = 0;
+    mRingUsed = 0;
+    mFrameUsed = 0;
+    mFrames.clear();
+}
+
+uint32_t DescriptorAllocator::allocate(uint32_t count) {
+    // smallest range that fits, the lowest one of equal size
+    auto best = mFreeBySize.lower_bound({count, 0});
+    if (count == 0 || best == mFreeBySize.end()) {
+        return Invalid;
+    }
+    const uint32_t first = best->second;
+    const uint32_t size = best->first;
+    eraseFree(mFreeByFirst.find(first));
+    if (size > count) {
+        insertFree(first + count, size - count);
+    }
+    mPersistentUsed += count;
+    return first;
+}
+
+void DescriptorAllocator::free(uint32_t first, uint32_t count) {
+    if (count == 0 || uint64_t(first) + count > mPersistentCapacity || count > mPersistentUsed) {
+        throw std::runtime_error("Descriptor range was not allocated");
+    }
+    auto next = mFreeByFirst.lower_bound(first);
+    if (next != mFreeByFirst.end() && next->first < first + count) {
+        throw std::runtime_error("Descriptor range freed twice");
+    }
+    uint32_t last = first + count;
+    if (next != mFreeByFirst.end() && next->first == last) {
+        last += next->second;
+        eraseFree(next);
+    }
+    auto previous = mFreeByFirst.lower_bound(first);
+    if (previous != mFreeByFirst.begin()) {
+        --previous;
+        if (previous->first + previous->second > first) {
+            throw std::runtime_error("Descriptor range freed twice");
+        }
+        if (previous->first + previous->second == first) {
+            first = previous->first;
+            eraseFree(previous);
+        }
+    }
+    insertFree(first, last - first);
+    mPersistentUsed -= count;
+}
+
+uint32_t DescriptorAllocator::allocateTransient(uint32_t count) {
+    if (count == 0 || count > mTransientCapacity) {
+        return Invalid;
+    }
+    // ranges never wrap, the end of the ring is skipped instead
+    uint32_t skipped = 0;
+    if (mRingHead + count > mTransientCapacity) {
+        skipped = mTransientCapacity - mRingHead;
+    }
+    if (mRingUsed + skipped + count > mTransientCapacity) {
+        return Invalid;
+    }
+    const uint32_t first = skipped > 0 ? 0 : mRingHead;
+    mRingHead = (first + count) % mTransientCapacity;
+    mRingUsed += skipped + count;
+    mFrameUsed += skipped + count;
+    return mPersistentCapacity + first;
+}
+
+void DescriptorAllocator::finishFrame(uint64_t fence) {
+    if (mFrameUsed > 0) {
+        mFrames.push_back({fence, mFrameUsed});
+        mFrameUsed = 0;
+    }
+}
+
+void DescriptorAllocator::retire(uint64_t completedFence) {
+    while (!mFrames.empty() && mFrames.front().fence <= completedFence) {
+        mRingUsed -= mFrames.front().size;
+        mFrames.pop_front();
+    }
+}
+
+DescriptorAllocator::Stats DescriptorAllocator::stats() const {
+    Stats stats;
+    stats.persistentUsed = mPersistentUsed;
+    stats.persistentFreeRanges = static_cast<uint32_t>(mFreeByFirst.size());
+    stats.largestFreeRange = mFreeBySize.empty() ? 0 : mFreeBySize.rbegin()->first;
+    stats.transientUsed = mRingUsed;
+    return stats;
+}
+
+void DescriptorAllocator::insertFree(uint32_t first, uint32_t count) {
+    mFreeByFirst[first] = count;
+    mFreeBySize.insert({count, first});
+}
+
+void DescriptorAllocator::eraseFree(std::map<uint32_t, uint32_t>::iterator range) {
+    mFreeBySize.erase({range->second, range->first});
+    mFreeByFirst.erase(range);
+}
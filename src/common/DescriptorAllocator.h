@@ -0,0 +1,74 @@
+#pragma once
+
+#include <map>
+#include <set>
+#include <deque>
+#include <cstdint>
+
+// index allocator for one descriptor heap, the backend turns indices into handles. the front of the heap is a free
+// list of persistent ranges for long lived views, best fit by size and coalesced with its neighbours on free. the back
+// is a ring of transient ranges, every range stays in use until the gpu passes the fence of the frame that allocated it
+class DescriptorAllocator {
+public:
+    static const uint32_t Invalid = UINT32_MAX;
+
+    struct Stats {
+        uint32_t persistentUsed = 0;
+        uint32_t persistentFreeRanges = 0;
+        uint32_t largestFreeRange = 0;
+        // includes the unused end of the ring skipped when a range would wrap
+        uint32_t transientUsed = 0;
+    };
+
+    DescriptorAllocator() = default;
+
+    DescriptorAllocator(uint32_t persistentCapacity, uint32_t transientCapacity);
+
+    // persistent indices are [0, persistentCapacity), transient ones follow
+    void reset(uint32_t persistentCapacity, uint32_t transientCapacity);
+
+    // first index of count contiguous descriptors, Invalid when no free range is large enough
+    uint32_t allocate(uint32_t count = 1);
+
+    // count has to match the allocation
+    void free(uint32_t first, uint32_t count = 1);
+
+    // first index of count contiguous descriptors that live until the current frame retires, Invalid when the ring
+    // is full
+    uint32_t allocateTransient(uint32_t count);
+
+    // the transient ranges allocated since the last call belong to the frame signaled with this fence value
+    void finishFrame(uint64_t fence);
+
+    // releases the transient ranges of every frame whose fence the gpu completed
+    void retire(uint64_t completedFence);
+
+    uint32_t persistentCapacity() const { return mPersistentCapacity; }
+
+    uint32_t transientCapacity() const { return mTransientCapacity; }
+
+    Stats stats() const;
+
+private:
+    void insertFree(uint32_t first, uint32_t count);
+
+    void eraseFree(std::map<uint32_t, uint32_t>::iterator range);
+
+    uint32_t mPersistentCapacity = 0;
+    uint32_t mTransientCapacity = 0;
+    uint32_t mPersistentUsed = 0;
+
+    // free ranges as first index to size, and as size and first index ordered for best fit
+    std::map<uint32_t, uint32_t> mFreeByFirst;
+    std::set<std::pair<uint32_t, uint32_t>> mFreeBySize;
+
+    struct Frame {
+        uint64_t fence;
+        uint32_t size;
+    };
+    // ring offsets relative to mPersistentCapacity
+    uint32_t mRingHead = 0;
+    uint32_t mRingUsed = 0;
+    uint32_t mFrameUsed = 0;
+    std::deque<Frame> mFrames;
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cassert>
+#include <algorithm>
+
+#include "src/common/RadixSort.h"
+
+// draw packets ordered by 64-bit sort keys, so submission walks passes in order and changes pipeline, material and
+// mesh as rarely as possible. keys are laid out from the most significant bit
+//   opaque:      pass 4 | pipeline 10 | material 14 | mesh 12 | depth 24, front to back within equal state
+//   transparent: pass 4 | inverted depth 24 | pipeline 10 | material 14 | mesh 12, back to front
+class DrawQueue {
+public:
+    static const uint32_t PassBits = 4;
+    static const uint32_t PipelineBits = 10;
+    static const uint32_t MaterialBits = 14;
+    static const uint32_t MeshBits = 12;
+    static const uint32_t DepthBits = 24;
+
+    // depth is the view depth over the far plane, clamped to [0, 1]
+    static uint64_t opaqueKey(uint32_t pass, uint32_t pipeline, uint32_t material, uint32_t mesh, float depth) {
+        return field(pass, PassBits, 60) | field(pipeline, PipelineBits, 50) | field(material, MaterialBits, 36) |
+               field(mesh, MeshBits, 24) | quantizeDepth(depth);
+    }
+
+    static uint64_t transparentKey(uint32_t pass, uint32_t pipeline, uint32_t material, uint32_t mesh, float depth) {
+        return field(pass, PassBits, 60) | uint64_t((1u << DepthBits) - 1 - quantizeDepth(depth)) << 36 |
+               field(pipeline, PipelineBits, 26) | field(material, MaterialBits, 12) | field(mesh, MeshBits, 0);
+    }
+
+    void clear() {
+        mKeys.clear();
+        mPackets.clear();
+    }
+
+    // packet indexes the caller's own packet storage
+    void push(uint64_t key, uint32_t packet) {
+        mKeys.push_back(key);
+        mPackets.push_back(packet);
+    }
+
+    // stable, packets with equal keys keep the order they were pushed in
+    void sort() { mSorter.sort(mKeys, mPackets); }
+
+    // in key order after sort()
+    const std::vector<uint32_t> &packets() const { return mPackets; }
+
+    const std::vector<uint64_t> &keys() const { return mKeys; }
+
+private:
+    static uint64_t field(uint32_t value, uint32_t bits, uint32_t shift) {
+        assert(value < (1u << bits));
+        return uint64_t(value & ((1u << bits) - 1)) << shift;
+    }
+
+    static uint32_t quantizeDepth(float depth) {
+        return static_cast<uint32_t>(std::min(std::max(depth, 0.0f), 1.0f) * ((1u << DepthBits) - 1));
+    }
+
+    std::vector<uint64_t> mKeys;
+    std::vector<uint32_t> mPackets;
+    RadixSort mSorter;
+};
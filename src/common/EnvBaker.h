@@ -0,0 +1,263 @@
+#pragma once
+
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <glm.hpp>
+
+#include "src/common/CubeMap.h"
+#include "src/common/Sampling.h"
+#include "src/common/Parallel.h"
+
+// cpu versions of prefilter.hlsl and irradiance.hlsl. with adaptive sampling every texel starts with a few samples
+// from a nested sobol sequence and doubles them until the estimated relative error is below the target, instead of
+// always spending the fixed shader sample count. fewer samples read from blurrier mips (filtered importance sampling)
+class EnvBaker {
+public:
+    // must match NumSamples in irradiance.hlsl
+    static const uint32_t IrradianceNumSamples = 64 * 1024;
+
+    struct Settings {
+        bool adaptive = true;
+        // relative error of the luminance estimate at which a texel counts as converged
+        float targetError = 0.01f;
+        // samples of the first stage, a texel can stop after the second one
+        uint32_t minSamples = 16;
+    };
+
+    struct Stats {
+        uint64_t samples = 0;
+        // what the fixed sample count of the shader would have spent on the same texels
+        uint64_t fixedSamples = 0;
+        uint64_t texels = 0;
+        // texels that hit the sample cap before reaching the target error
+        uint64_t unconverged = 0;
+        float maxError = 0.0f;
+
+        void add(const Stats &other) {
+            samples += other.samples;
+            fixedSamples += other.fixedSamples;
+            texels += other.texels;
+            unconverged += other.unconverged;
+            maxError = std::max(maxError, other.maxError);
+        }
+
+        float savings() const { return fixedSamples > 0 ? 1.0f - float(samples) / float(fixedSamples) : 0.0f; }
+    };
+
+    // specular prefilter with the same roughness per level as setup(), level 0 is a copy of the source.
+    // levelStats (optional) receives one entry per level
+    static CubeMap prefilter(const CubeMap &env, const Settings &settings, Stats *stats = nullptr,
+                             std::vector<Stats> *levelStats = nullptr, uint32_t numSamples = PrefilterNumSamples) {
+        CubeMap result(env.size(), env.levels());
+        const float halfLog2Wt = 0.5f * std::log2(texelSolidAngle(env));
+        // the fixed scheme reads the table the renderer uploads, adaptive stages need the nested points
+        const GGXSampleTable samples(result.levels(), numSamples, settings.adaptive);
+
+        if (levelStats) {
+            levelStats->assign(result.levels(), Stats{});
+        }
+        for (uint32_t level = 0; level < result.levels(); ++level) {
+            const uint32_t size = result.size(level);
+            Stats levelTotal;
+
+            if (level == 0) {
+                for (uint32_t faceIndex = 0; faceIndex < 6; ++faceIndex) {
+                    std::copy(env.face(0, faceIndex), env.face(0, faceIndex) + size * size, result.face(0, faceIndex));
+                }
+            } else {
+                const glm::vec4 *levelSamples = samples.level(level);
+                auto sampleFunc = [&](const glm::mat3 &basis, uint32_t i, uint32_t count) {
+                    const glm::vec3 &N = basis[2];
+                    const glm::vec4 &sample = levelSamples[i];
+                    glm::vec3 H = basis * glm::vec3{sample};
+                    glm::vec3 L = glm::normalize(2.0f * glm::dot(N, H) * H - N);
+
+                    float NdotL = std::max(glm::dot(N, L), 0.0f);
+                    if (NdotL <= 0.0f) {
+                        return Weighted{glm::vec3{0.0f}, 0.0f};
+                    }
+                    // stages with fewer samples cover more solid angle each and read blurrier mips
+                    float mipLevel = sample.w - halfLog2Wt + 1.0f;
+                    if (count < numSamples) {
+                        mipLevel += 0.5f * std::log2(float(numSamples) / count);
+                    }
+                    return Weighted{glm::vec3{env.sample(L, std::max(mipLevel, 0.0f))} * NdotL, NdotL};
+                };
+                levelTotal = bakeLevel(result, level, settings, numSamples, sampleFunc);
+            }
+
+            if (levelStats) {
+                (*levelStats)[level] = levelTotal;
+            }
+            if (stats) {
+                stats->add(levelTotal);
+            }
+        }
+        return result;
+    }
+
+    // diffuse irradiance. the fixed scheme is irradiance.hlsl, uniform hemisphere samples of the top env level.
+    // adaptive stages sample the cosine lobe instead, which has much less variance, and read the mip that matches
+    // their sample density
+    static CubeMap irradiance(const CubeMap &env, uint32_t size, const Settings &settings, Stats *stats = nullptr,
+                              uint32_t numSamples = IrradianceNumSamples) {
+        CubeMap result(size, 1);
+        const float halfLog2Wt = 0.5f * std::log2(texelSolidAngle(env));
+        auto sampleFunc = [&](const glm::mat3 &basis, uint32_t i, uint32_t count) {
+            if (!settings.adaptive) {
+                Sample2D uv = hammersley(i, numSamples);
+                float p = std::sqrt(std::max(0.0f, 1.0f - uv.x * uv.x));
+                glm::vec3 L = basis * glm::vec3{std::cos(TwoPI * uv.y) * p, std::sin(TwoPI * uv.y) * p, uv.x};
+
+                float NdotL = std::max(0.0f, glm::dot(basis[2], L));
+                return Weighted{2.0f * glm::vec3{env.sampleLevel(L, 0)} * NdotL, 1.0f};
+            }
+
+            // pdf NdotL / PI cancels the cosine, each sample covers PI / (count * NdotL)
+            Sample2D uv = sobol(i);
+            float NdotL = std::sqrt(1.0f - uv.x);
+            float p = std::sqrt(uv.x);
+            glm::vec3 L = basis * glm::vec3{std::cos(TwoPI * uv.y) * p, std::sin(TwoPI * uv.y) * p, NdotL};
+
+            float mipLevel = std::max(0.5f * std::log2(PI / (count * std::max(NdotL, 1e-4f))) - halfLog2Wt, 0.0f);
+            return Weighted{glm::vec3{env.sample(L, mipLevel)}, 1.0f};
+        };
+        Stats total = bakeLevel(result, 0, settings, numSamples, sampleFunc);
+        if (stats) {
+            stats->add(total);
+        }
+        return result;
+    }
+
+    // rms difference of the colors of one level over the rms of the reference, how far an adaptive bake is from
+    // the fixed one
+    static float relativeRmse(const CubeMap &baked, const CubeMap &reference, uint32_t level) {
+        double sumDifference = 0.0, sumReference = 0.0;
+        const uint32_t size = reference.size(level);
+        for (uint32_t faceIndex = 0; faceIndex < 6; ++faceIndex) {
+            for (uint32_t i = 0; i < size * size; ++i) {
+                const glm::vec3 a{baked.face(level, faceIndex)[i]}, b{reference.face(level, faceIndex)[i]};
+                sumDifference += glm::dot(a - b, a - b);
+                sumReference += glm::dot(b, b);
+            }
+        }
+        return sumReference > 0.0 ? static_cast<float>(std::sqrt(sumDifference / sumReference)) : 0.0f;
+    }
+
+private:
+    // one sample of a ratio estimator sum(value) / sum(weight)
+    struct Weighted {
+        glm::vec3 value;
+        float weight;
+    };
+
+    static float texelSolidAngle(const CubeMap &env) { return 4.0f * PI / (6.0f * env.size() * env.size()); }
+
+    static float luminance(const glm::vec3 &color) { return glm::dot(color, glm::vec3{0.2126f, 0.7152f, 0.0722f}); }
+
+    template <typename SampleFunc>
+    static Stats bakeLevel(CubeMap &result, uint32_t level, const Settings &settings, uint32_t numSamples,
+                           const SampleFunc &sampleFunc) {
+        const uint32_t size = result.size(level);
+        std::vector<Stats> rowStats(6 * size);
+
+        parallelFor(0, 6 * size, [&](uint32_t row) {
+            uint32_t faceIndex = row / size;
+            uint32_t y = row % size;
+            glm::vec4 *dst = result.face(level, faceIndex) + y * size;
+            Stats &stats = rowStats[row];
+
+            for (uint32_t x = 0; x < size; ++x) {
+                // same texel-corner direction as GetSamplingVector in the shaders
+                glm::mat3 basis = tangentBasis(CubeMap::direction(faceIndex, float(x) / size, float(y) / size));
+
+                glm::vec3 estimate{0.0f};
+                float previous = -1.0f;
+                float error = 0.0f;
+                uint32_t count = numSamples;
+                if (settings.adaptive) {
+                    count = std::min(std::max(settings.minSamples, 2u), numSamples);
+                }
+
+                // every stage is a fresh estimate with twice the samples of the last one, since the mip level
+                // each sample reads from depends on how many samples share the lobe
+                for (;; count = std::min(count * 2, numSamples)) {
+                    glm::vec3 color{0.0f};
+                    float weight = 0.0f;
+                    // running sums for the delta-method variance of the luminance ratio estimate
+                    double sumY = 0.0, sumW = 0.0, sumYY = 0.0, sumWW = 0.0, sumYW = 0.0;
+                    for (uint32_t i = 0; i < count; ++i) {
+                        // the fixed scheme uses the shader's hammersley set, adaptive stages need nested points,
+                        // sampleFunc picks the point of sample i
+                        Weighted s = sampleFunc(basis, i, count);
+                        color += s.value;
+                        weight += s.weight;
+
+                        double lum = luminance(s.value);
+                        sumY += lum;
+                        sumW += s.weight;
+                        sumYY += lum * lum;
+                        sumWW += double(s.weight) * s.weight;
+                        sumYW += lum * s.weight;
+                    }
+                    estimate = weight > 0.0f ? color / weight : glm::vec3{0.0f};
+                    stats.samples += count;
+
+                    // the variance misses features no sample has hit yet and the bias of reading blurrier mips,
+                    // the change from the previous stage catches most of both
+                    float current = luminance(estimate);
+                    error = relativeError(sumY, sumW, sumYY, sumWW, sumYW, count);
+                    if (previous >= 0.0f) {
+                        error = std::max(error, relativeChange(previous, current));
+                    } else if (count < numSamples) {
+                        error = INFINITY;
+                    }
+                    if (count == numSamples || error <= settings.targetError) {
+                        break;
+                    }
+                    previous = current;
+                }
+
+                dst[x] = glm::vec4{estimate, 1.0f};
+
+                stats.fixedSamples += numSamples;
+                stats.texels += 1;
+                if (error > settings.targetError) {
+                    stats.unconverged += 1;
+                }
+                if (std::isfinite(error)) {
+                    stats.maxError = std::max(stats.maxError, error);
+                }
+            }
+        });
+
+        Stats total;
+        for (const Stats &stats : rowStats) {
+            total.add(stats);
+        }
+        return total;
+    }
+
+    static float relativeChange(float previous, float current) {
+        float scale = std::max(previous, current);
+        return scale > 1e-8f ? std::abs(current - previous) / scale : 0.0f;
+    }
+
+    // standard error of sumY / sumW relative to its value. this is the plain monte carlo estimate, the low
+    // discrepancy samples converge faster so it overestimates the real error
+    static float relativeError(double sumY, double sumW, double sumYY, double sumWW, double sumYW, uint32_t n) {
+        if (n < 2 || sumW <= 0.0) {
+            return n < 2 ? INFINITY : 0.0f;
+        }
+        double ratio = sumY / sumW;
+        if (ratio <= 1e-8) {
+            return 0.0f;
+        }
+        double residualSq = std::max(sumYY - 2.0 * ratio * sumYW + ratio * ratio * sumWW, 0.0);
+        double meanW = sumW / n;
+        double stdError = std::sqrt(residualSq / (double(n) * (n - 1))) / meanW;
+        return static_cast<float>(stdError / ratio);
+    }
+};
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// single producer, single consumer triple buffer. the producer fills back() and publishes it, the consumer takes the
+// newest published slot and reads it through front() until it takes the next one. neither side ever waits for the
+// other, a snapshot published over one the consumer didn't take yet replaces it. slots are reused, so containers in
+// T keep their capacity and a steady stream of snapshots doesn't allocate
+template <typename T>
+class FrameMailbox {
+public:
+    struct Stats {
+        uint64_t published = 0;
+        uint64_t consumed = 0;
+        // replaced by a newer snapshot before the consumer took them
+        uint64_t dropped = 0;
+        // publish to take in the callers' time unit, mean and max over the taken snapshots
+        double latency = 0.0;
+        double maxLatency = 0.0;
+    };
+
+    FrameMailbox() = default;
+    FrameMailbox(const FrameMailbox &) = delete;
+    FrameMailbox &operator=(const FrameMailbox &) = delete;
+
+    // producer side, the slot to fill. it holds the snapshot published two publishes ago or the consumer returned
+    T &back() { return mSlots[mBack].value; }
+
+    // hands back() to the consumer, returns the sequence number of the snapshot, counting from 1
+    uint64_t publish(double time) {
+        Slot &slot = mSlots[mBack];
+        slot.sequence = mPublished.load(std::memory_order_relaxed) + 1;
+        slot.time = time;
+        // release the slot's contents, acquire the slot the consumer released
+        const uint32_t previous = mMiddle.exchange(mBack | Fresh, std::memory_order_acq_rel);
+        mBack = previous & ~Fresh;
+        if (previous & Fresh) {
+            mDropped.store(mDropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+        mPublished.store(slot.sequence, std::memory_order_relaxed);
+        return slot.sequence;
+    }
+
+    // consumer side, takes the newest snapshot. false when nothing was published since the last take, front() then
+    // keeps the snapshot it had
+    bool consume(double time) {
+        if (!(mMiddle.load(std::memory_order_relaxed) & Fresh)) {
+            return false;
+        }
+        mFront = mMiddle.exchange(mFront, std::memory_order_acq_rel) & ~Fresh;
+        const double latency = time - mSlots[mFront].time;
+        mLatency += latency;
+        mMaxLatency = latency > mMaxLatency ? latency : mMaxLatency;
+        mConsumed.store(mConsumed.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // default constructed until the first take
+    const T &front() const { return mSlots[mFront].value; }
+
+    // 0 until the first take
+    uint64_t frontSequence() const { return mSlots[mFront].sequence; }
+
+    // the latencies are the consumer's, call it on the consumer thread or once both sides stopped
+    Stats stats() const {
+        Stats stats;
+        stats.published = mPublished.load(std::memory_order_relaxed);
+        stats.consumed = mConsumed.load(std::memory_order_relaxed);
+        stats.dropped = mDropped.load(std::memory_order_relaxed);
+        stats.latency = stats.consumed > 0 ? mLatency / stats.consumed : 0.0;
+        stats.maxLatency = mMaxLatency;
+        return stats;
+    }
+
+private:
+    static const uint32_t Fresh = 4;
+
+    struct Slot {
+        T value{};
+        uint64_t sequence = 0;
+        double time = 0.0;
+    };
+
+    Slot mSlots[3];
+
+    // the producer's and the consumer's members sit on cache lines of their own, the sides don't slow each other
+    alignas(64) uint32_t mBack = 0;
+    std::atomic<uint64_t> mPublished{0};
+    std::atomic<uint64_t> mDropped{0};
+
+    // index of the slot in between, with Fresh while the consumer hasn't taken it
+    alignas(64) std::atomic<uint32_t> mMiddle{1};
+
+    alignas(64) uint32_t mFront = 2;
+    std::atomic<uint64_t> mConsumed{0};
+    double mLatency = 0.0;
+    double mMaxLatency = 0.0;
+};
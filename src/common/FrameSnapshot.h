@@ -0,0 +1,14 @@
+#pragma once
+
+#include <vector>
+#include <glm.hpp>
+
+#include "src/common/Camera.h"
+
+// what the main thread hands the renderer for a frame. the renderer draws from its own copy, input keeps moving the
+// camera and the instances while a frame is recorded
+struct FrameSnapshot {
+    Camera camera;
+    // world matrices of the instances in the order they were added, empty keeps the ones the renderer has
+    std::vector<glm::mat4> transforms;
+};
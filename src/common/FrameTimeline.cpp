@@ -0,0 +1,106 @@
+#include <cmath>
+#include <algorithm>
+
+#include "src/common/FrameTimeline.h"
+
+FrameTimeline::FrameTimeline(uint32_t framesInFlight, uint32_t history)
+    : mFramesInFlight(std::min(std::max(framesInFlight, 1u), uint32_t(MaxFramesInFlight))),
+      mFrames(std::max(history, 2 * uint32_t(MaxFramesInFlight))) {}
+
+uint64_t FrameTimeline::waitFence() const {
+    if (mNext < mFramesInFlight) {
+        return 0;
+    }
+    return mFrames[(mNext - mFramesInFlight) % mFrames.size()].fence;
+}
+
+void FrameTimeline::beginFrame(double waitStart, double time) {
+    Frame &frame = slot(mNext);
+    frame = Frame();
+    frame.number = mNext;
+    frame.wait = time - waitStart;
+    frame.begin = time;
+}
+
+void FrameTimeline::submit(uint64_t fence, double time) {
+    Frame &frame = slot(mNext);
+    frame.fence = fence;
+    frame.submit = time;
+    frame.inFlight = static_cast<uint32_t>(mNext - mPending + 1);
+    mNext++;
+}
+
+void FrameTimeline::present(uint64_t fence, double time) {
+    const uint64_t first = mNext > mFrames.size() ? mNext - mFrames.size() : 0;
+    for (uint64_t number = mNext; number > first; --number) {
+        if (slot(number - 1).fence == fence) {
+            slot(number - 1).present = time;
+            return;
+        }
+    }
+}
+
+void FrameTimeline::complete(uint64_t completedFence, double time) {
+    while (mPending < mNext && slot(mPending).fence <= completedFence) {
+        slot(mPending).complete = time;
+        mPending++;
+    }
+}
+
+const FrameTimeline::Frame *FrameTimeline::frame(uint64_t number) const {
+    if (number >= mNext || mNext - number > mFrames.size()) {
+        return nullptr;
+    }
+    return &mFrames[number % mFrames.size()];
+}
+
+FrameTimeline::Stats FrameTimeline::stats() const {
+    Stats stats;
+    std::vector<double> intervals;
+    const uint64_t first = mNext > mFrames.size() ? mNext - mFrames.size() : 0;
+    for (uint64_t number = first; number < mNext; ++number) {
+        const Frame &frame = mFrames[number % mFrames.size()];
+        if (number > first) {
+            const Frame &previous = mFrames[(number - 1) % mFrames.size()];
+            if (frame.present >= 0.0 && previous.present >= 0.0) {
+                intervals.push_back(frame.present - previous.present);
+            }
+        }
+        if (frame.complete < 0.0) {
+            continue;
+        }
+        stats.frames++;
+        stats.cpuTime += frame.submit - frame.begin;
+        stats.waitTime += frame.wait;
+        stats.gpuLatency += frame.complete - frame.submit;
+        stats.frameLatency += frame.complete - frame.begin;
+        stats.framesInFlight += frame.inFlight;
+    }
+    if (stats.frames > 0) {
+        stats.cpuTime /= stats.frames;
+        stats.waitTime /= stats.frames;
+        stats.gpuLatency /= stats.frames;
+        stats.frameLatency /= stats.frames;
+        stats.framesInFlight /= stats.frames;
+    }
+    if (intervals.empty()) {
+        return stats;
+    }
+
+    for (double interval : intervals) {
+        stats.interval += interval;
+    }
+    stats.interval /= intervals.size();
+    for (double interval : intervals) {
+        stats.intervalDeviation += (interval - stats.interval) * (interval - stats.interval);
+    }
+    stats.intervalDeviation = std::sqrt(stats.intervalDeviation / intervals.size());
+
+    std::sort(intervals.begin(), intervals.end());
+    const double median = intervals[intervals.size() / 2];
+    stats.intervalP99 = intervals[std::min(intervals.size() - 1, intervals.size() * 99 / 100)];
+    for (double interval : intervals) {
+        stats.stutters += interval > 1.5 * median ? 1 : 0;
+    }
+    return stats;
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+// cpu and gpu timeline of the frames in flight. the cpu records up to framesInFlight frames ahead of the gpu, frame n
+// reuses the resources of frame n - framesInFlight and waits for its fence first. every frame keeps when the cpu
+// began it, how long it waited, when it was submitted, presented and completed on the gpu. stats() derives the
+// pacing of the last frames. times are milliseconds on any clock, completion times are when the backend observed
+// the fence passing
+class FrameTimeline {
+public:
+    static const uint32_t MaxFramesInFlight = 4;
+
+    struct Frame {
+        uint64_t number = 0;
+        uint64_t fence = 0;
+        double wait = 0.0;
+        double begin = -1.0;
+        double submit = -1.0;
+        double present = -1.0;
+        double complete = -1.0;
+        // frames submitted and not completed when this one was submitted, itself included
+        uint32_t inFlight = 0;
+    };
+
+    // means unless noted, over the frames of the history that completed
+    struct Stats {
+        uint32_t frames = 0;
+        // begin to submit
+        double cpuTime = 0.0;
+        double waitTime = 0.0;
+        // submit to complete
+        double gpuLatency = 0.0;
+        // begin to complete, the age of a frame's input when the gpu is done with it
+        double frameLatency = 0.0;
+        // present to present
+        double interval = 0.0;
+        double intervalDeviation = 0.0;
+        double intervalP99 = 0.0;
+        // intervals longer than one and a half times the median
+        uint32_t stutters = 0;
+        double framesInFlight = 0.0;
+    };
+
+    // framesInFlight is clamped to 1 to MaxFramesInFlight, the history to at least twice that
+    explicit FrameTimeline(uint32_t framesInFlight = 2, uint32_t history = 256);
+
+    uint32_t framesInFlight() const { return mFramesInFlight; }
+
+    // number of the next frame, counting from 0
+    uint64_t frameNumber() const { return mNext; }
+
+    // the slot of the next frame's resources
+    uint32_t frameIndex() const { return static_cast<uint32_t>(mNext % mFramesInFlight); }
+
+    // fence of the frame that used the next frame's slot, 0 when there is nothing to wait for
+    uint64_t waitFence() const;
+
+    // the cpu starts the next frame at time after waiting since waitStart
+    void beginFrame(double waitStart, double time);
+
+    void submit(uint64_t fence, double time);
+
+    // the frame submitted with the fence was presented, at the call or when it reached the display if that is known
+    void present(uint64_t fence, double time);
+
+    // every submitted frame with a fence up to completedFence is done
+    void complete(uint64_t completedFence, double time);
+
+    // nullptr once the frame fell out of the history
+    const Frame *frame(uint64_t number) const;
+
+    Stats stats() const;
+
+private:
+    Frame &slot(uint64_t number) { return mFrames[number % mFrames.size()]; }
+
+    uint32_t mFramesInFlight;
+    std::vector<Frame> mFrames;
+    uint64_t mNext = 0;
+    // oldest submitted frame the gpu may still be working on
+    uint64_t mPending = 0;
+};
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+// IEEE binary16 conversion with round to nearest even, bit compatible with DXGI_FORMAT_*_FLOAT 16 bit channels
+inline uint16_t floatToHalf(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+    uint32_t absBits = bits & 0x7fffffffu;
+
+    if (absBits >= 0x7f800000u) { // inf or nan
+        return sign | 0x7c00u | (absBits > 0x7f800000u ? 0x200u : 0u);
+    }
+    if (absBits >= 0x477ff000u) { // rounds past 65504
+        return sign | 0x7c00u;
+    }
+
+    uint32_t exponent = absBits >> 23;
+    if (exponent < 113) { // half subnormal or zero
+        if (absBits < 0x33000000u) {
+            return sign;
+        }
+        uint32_t mantissa = (absBits & 0x7fffffu) | 0x800000u;
+        uint32_t shift = 126 - exponent;
+        uint32_t half = mantissa >> shift;
+        uint32_t remainder = mantissa & ((1u << shift) - 1);
+        uint32_t midpoint = 1u << (shift - 1);
+        if (remainder > midpoint || (remainder == midpoint && (half & 1u))) {
+            ++half;
+        }
+        return sign | static_cast<uint16_t>(half);
+    }
+
+    uint32_t half = ((exponent - 112) << 10) | ((absBits & 0x7fffffu) >> 13);
+    uint32_t remainder = absBits & 0x1fffu;
+    if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u))) {
+        ++half;
+    }
+    return sign | static_cast<uint16_t>(half);
+}
+
+inline float halfToFloat(uint16_t value) {
+    uint32_t sign = static_cast<uint32_t>(value & 0x8000u) << 16;
+    uint32_t exponent = (value >> 10) & 0x1fu;
+    uint32_t mantissa = value & 0x3ffu;
+
+    uint32_t bits;
+    if (exponent == 0x1fu) {
+        bits = sign | 0x7f800000u | (mantissa << 13);
+    } else if (exponent != 0) {
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    } else if (mantissa != 0) {
+        exponent = 113;
+        while (!(mantissa & 0x400u)) {
+            mantissa <<= 1;
+            --exponent;
+        }
+        bits = sign | (exponent << 23) | ((mantissa & 0x3ffu) << 13);
+    } else {
+        bits = sign;
+    }
+
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
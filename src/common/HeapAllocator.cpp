@@ -0,0 +1,419 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "src/common/HeapAllocator.h"
+
+namespace {
+    uint32_t highestBit(uint64_t value) {
+        uint32_t bit = 0;
+        for (uint32_t shift = 32; shift > 0; shift /= 2) {
+            if (value >> shift) {
+                value >>= shift;
+                bit += shift;
+            }
+        }
+        return bit;
+    }
+
+    // value must not be 0
+    uint32_t lowestBit(uint64_t value) {
+        uint32_t bit = 0;
+        for (uint32_t shift = 32; shift > 0; shift /= 2) {
+            if ((value & ((uint64_t(1) << shift) - 1)) == 0) {
+                value >>= shift;
+                bit += shift;
+            }
+        }
+        return bit;
+    }
+}
+
+TlsfAllocator::TlsfAllocator(uint64_t size, uint64_t granularity) {
+    reset(size, granularity);
+}
+
+void TlsfAllocator::reset(uint64_t size, uint64_t granularity) {
+    mGranularity = granularity;
+    mSize = size / granularity;
+    mUsed = 0;
+    mFreeBlocks = 0;
+    mBlocks.clear();
+    mUnusedBlocks.clear();
+    mFirstLevelMap = 0;
+    std::fill(std::begin(mSecondLevelMaps), std::end(mSecondLevelMaps), 0);
+    mBins.assign(FirstLevels * Subdivisions, static_cast<uint32_t>(NoBlock));
+    mAllocated.clear();
+    if (mSize > 0) {
+        insertFree(newBlock(0, mSize));
+    }
+}
+
+uint64_t TlsfAllocator::allocate(uint64_t size, uint64_t alignment) {
+    if (size == 0) {
+        return Invalid;
+    }
+    const uint64_t granules = (size + mGranularity - 1) / mGranularity;
+    // alignments below the granularity hold for every offset
+    const uint64_t granuleAlignment = std::max<uint64_t>(alignment / mGranularity, 1);
+    uint32_t block = findFree(granules, granuleAlignment);
+    if (block == NoBlock) {
+        return Invalid;
+    }
+    removeFree(block);
+
+    // the padding in front goes back to the free lists as a block of its own
+    const uint64_t aligned = (mBlocks[block].offset + granuleAlignment - 1) & ~(granuleAlignment - 1);
+    if (aligned > mBlocks[block].offset) {
+        const uint32_t front = block;
+        splitFree(front, aligned - mBlocks[front].offset);
+        block = mBlocks[front].nextPhysical;
+        removeFree(block);
+        insertFree(front);
+    }
+    if (mBlocks[block].size > granules) {
+        splitFree(block, granules);
+    }
+    mBlocks[block].free = false;
+    mAllocated[mBlocks[block].offset] = block;
+    mUsed += granules;
+    return mBlocks[block].offset * mGranularity;
+}
+
+void TlsfAllocator::free(uint64_t offset) {
+    auto it = offset % mGranularity == 0 ? mAllocated.find(offset / mGranularity) : mAllocated.end();
+    if (it == mAllocated.end()) {
+        throw std::runtime_error("Heap offset was not allocated");
+    }
+    uint32_t block = it->second;
+    mAllocated.erase(it);
+    mUsed -= mBlocks[block].size;
+    mBlocks[block].free = true;
+
+    // merge with free neighbours
+    const uint32_t previous = mBlocks[block].previousPhysical;
+    if (previous != NoBlock && mBlocks[previous].free) {
+        removeFree(previous);
+        mBlocks[previous].size += mBlocks[block].size;
+        mBlocks[previous].nextPhysical = mBlocks[block].nextPhysical;
+        if (mBlocks[block].nextPhysical != NoBlock) {
+            mBlocks[mBlocks[block].nextPhysical].previousPhysical = previous;
+        }
+        releaseBlock(block);
+        block = previous;
+    }
+    const uint32_t next = mBlocks[block].nextPhysical;
+    if (next != NoBlock && mBlocks[next].free) {
+        removeFree(next);
+        mBlocks[block].size += mBlocks[next].size;
+        mBlocks[block].nextPhysical = mBlocks[next].nextPhysical;
+        if (mBlocks[next].nextPhysical != NoBlock) {
+            mBlocks[mBlocks[next].nextPhysical].previousPhysical = block;
+        }
+        releaseBlock(next);
+    }
+    insertFree(block);
+}
+
+uint64_t TlsfAllocator::largestFreeBlock() const {
+    if (mFirstLevelMap == 0) {
+        return 0;
+    }
+    const uint32_t firstLevel = highestBit(mFirstLevelMap);
+    const uint32_t secondLevel = highestBit(mSecondLevelMaps[firstLevel]);
+    uint64_t largest = 0;
+    for (uint32_t block = mBins[firstLevel * Subdivisions + secondLevel]; block != NoBlock;
+         block = mBlocks[block].nextFree) {
+        largest = std::max(largest, mBlocks[block].size);
+    }
+    return largest * mGranularity;
+}
+
+void TlsfAllocator::mapping(uint64_t size, uint32_t &firstLevel, uint32_t &secondLevel) {
+    if (size < Subdivisions) {
+        firstLevel = 0;
+        secondLevel = static_cast<uint32_t>(size);
+    } else {
+        const uint32_t bit = highestBit(size);
+        firstLevel = bit - SubdivisionBits + 1;
+        secondLevel = static_cast<uint32_t>(size >> (bit - SubdivisionBits)) - Subdivisions;
+    }
+}
+
+uint32_t TlsfAllocator::findFree(uint64_t size, uint64_t alignment) const {
+    // every block of a bin at or above the request rounded up to the next bin fits, whatever its alignment
+    uint64_t request = size + alignment - 1;
+    if (request > mSize) {
+        request = mSize;
+    }
+    if (request >= Subdivisions) {
+        request += (uint64_t(1) << (highestBit(request) - SubdivisionBits)) - 1;
+    }
+    uint32_t lastFirstLevel, lastSecondLevel;
+    mapping(request, lastFirstLevel, lastSecondLevel);
+
+    if (lastFirstLevel < FirstLevels) {
+        uint32_t firstLevel = lastFirstLevel;
+        uint32_t secondLevelMap = mSecondLevelMaps[firstLevel] & (~0u << lastSecondLevel);
+        if (secondLevelMap == 0) {
+            // firstLevel + 1 stays below 64, FirstLevels leaves room for it
+            const uint64_t firstLevelMap = mFirstLevelMap & (~uint64_t(0) << (firstLevel + 1));
+            if (firstLevelMap != 0) {
+                firstLevel = lowestBit(firstLevelMap);
+                secondLevelMap = mSecondLevelMaps[firstLevel];
+            }
+        }
+        if (secondLevelMap != 0) {
+            const uint32_t block = mBins[firstLevel * Subdivisions + lowestBit(secondLevelMap)];
+            if (mBlocks[block].size >= size + alignment - 1) {
+                return block;
+            }
+        }
+    }
+
+    // the bins below may still hold blocks that fit, like a heap sized for exactly one aligned allocation
+    uint32_t firstLevel, secondLevel;
+    mapping(size, firstLevel, secondLevel);
+    for (; firstLevel < lastFirstLevel || (firstLevel == lastFirstLevel && secondLevel <= lastSecondLevel);
+         secondLevel = (secondLevel + 1) % Subdivisions, firstLevel += secondLevel == 0 ? 1 : 0) {
+        for (uint32_t block = mBins[firstLevel * Subdivisions + secondLevel]; block != NoBlock;
+             block = mBlocks[block].nextFree) {
+            const uint64_t aligned = (mBlocks[block].offset + alignment - 1) & ~(alignment - 1);
+            if (aligned + size <= mBlocks[block].offset + mBlocks[block].size) {
+                return block;
+            }
+        }
+    }
+    return NoBlock;
+}
+
+uint32_t TlsfAllocator::newBlock(uint64_t offset, uint64_t size) {
+    uint32_t block;
+    if (!mUnusedBlocks.empty()) {
+        block = mUnusedBlocks.back();
+        mUnusedBlocks.pop_back();
+    } else {
+        block = static_cast<uint32_t>(mBlocks.size());
+        mBlocks.emplace_back();
+    }
+    mBlocks[block] = {offset, size, NoBlock, NoBlock, NoBlock, NoBlock, true};
+    return block;
+}
+
+void TlsfAllocator::releaseBlock(uint32_t block) {
+    mUnusedBlocks.push_back(block);
+}
+
+void TlsfAllocator::insertFree(uint32_t block) {
+    uint32_t firstLevel, secondLevel;
+    mapping(mBlocks[block].size, firstLevel, secondLevel);
+    uint32_t &head = mBins[firstLevel * Subdivisions + secondLevel];
+    mBlocks[block].free = true;
+    mBlocks[block].previousFree = NoBlock;
+    mBlocks[block].nextFree = head;
+    if (head != NoBlock) {
+        mBlocks[head].previousFree = block;
+    }
+    head = block;
+    mFirstLevelMap |= uint64_t(1) << firstLevel;
+    mSecondLevelMaps[firstLevel] |= 1u << secondLevel;
+    ++mFreeBlocks;
+}
+
+void TlsfAllocator::removeFree(uint32_t block) {
+    uint32_t firstLevel, secondLevel;
+    mapping(mBlocks[block].size, firstLevel, secondLevel);
+    uint32_t &head = mBins[firstLevel * Subdivisions + secondLevel];
+    const Block &removed = mBlocks[block];
+    if (removed.previousFree != NoBlock) {
+        mBlocks[removed.previousFree].nextFree = removed.nextFree;
+    }
+    if (removed.nextFree != NoBlock) {
+        mBlocks[removed.nextFree].previousFree = removed.previousFree;
+    }
+    if (head == block) {
+        head = removed.nextFree;
+        if (head == NoBlock) {
+            mSecondLevelMaps[firstLevel] &= ~(1u << secondLevel);
+            if (mSecondLevelMaps[firstLevel] == 0) {
+                mFirstLevelMap &= ~(uint64_t(1) << firstLevel);
+            }
+        }
+    }
+    --mFreeBlocks;
+}
+
+void TlsfAllocator::splitFree(uint32_t block, uint64_t size) {
+    const uint32_t rest = newBlock(mBlocks[block].offset + size, mBlocks[block].size - size);
+    mBlocks[block].size = size;
+    mBlocks[rest].previousPhysical = block;
+    mBlocks[rest].nextPhysical = mBlocks[block].nextPhysical;
+    if (mBlocks[block].nextPhysical != NoBlock) {
+        mBlocks[mBlocks[block].nextPhysical].previousPhysical = rest;
+    }
+    mBlocks[block].nextPhysical = rest;
+    insertFree(rest);
+}
+
+uint32_t HeapAllocator::addHeap(Category category, uint64_t size) {
+    uint32_t heap = 0;
+    while (heap < mHeaps.size() && mHeaps[heap].size > 0) {
+        ++heap;
+    }
+    if (heap == mHeaps.size()) {
+        mHeaps.emplace_back();
+    }
+    mHeaps[heap].category = category;
+    mHeaps[heap].size = size;
+    mHeaps[heap].allocations = 0;
+    mHeaps[heap].allocator.reset(size, mGranularity);
+    return heap;
+}
+
+void HeapAllocator::releaseHeap(uint32_t heap) {
+    if (mHeaps[heap].allocations > 0) {
+        throw std::runtime_error("Heap still holds allocations");
+    }
+    mHeaps[heap].size = 0;
+    mHeaps[heap].allocator.reset(0, mGranularity);
+}
+
+uint32_t HeapAllocator::allocate(Category category, uint64_t size, uint64_t alignment) {
+    for (uint32_t heap = 0; heap < mHeaps.size(); ++heap) {
+        if (mHeaps[heap].category != category || mHeaps[heap].size == 0) {
+            continue;
+        }
+        const uint64_t offset = mHeaps[heap].allocator.allocate(size, alignment);
+        if (offset == TlsfAllocator::Invalid) {
+            continue;
+        }
+        uint32_t allocation;
+        if (!mFreeAllocations.empty()) {
+            allocation = mFreeAllocations.back();
+            mFreeAllocations.pop_back();
+        } else {
+            allocation = static_cast<uint32_t>(mAllocations.size());
+            mAllocations.emplace_back();
+        }
+        mAllocations[allocation] = {category, heap, offset, size, alignment};
+        ++mHeaps[heap].allocations;
+        return allocation;
+    }
+    return Invalid;
+}
+
+void HeapAllocator::free(uint32_t allocation) {
+    if (allocation >= mAllocations.size() || mAllocations[allocation].heap == Invalid) {
+        throw std::runtime_error("Heap allocation freed twice");
+    }
+    Allocation &freed = mAllocations[allocation];
+    mHeaps[freed.heap].allocator.free(freed.offset);
+    --mHeaps[freed.heap].allocations;
+    freed.heap = Invalid;
+    mFreeAllocations.push_back(allocation);
+}
+
+HeapAllocator::Plan HeapAllocator::planDefragment(Category category, uint64_t maxBytes) const {
+    // least used heaps first, moves are simulated on copies of the allocators
+    std::vector<uint32_t> order;
+    for (uint32_t heap = 0; heap < mHeaps.size(); ++heap) {
+        if (mHeaps[heap].category == category && mHeaps[heap].size > 0) {
+            order.push_back(heap);
+        }
+    }
+    std::stable_sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) {
+        return mHeaps[a].allocator.used() < mHeaps[b].allocator.used();
+    });
+    std::vector<std::vector<uint32_t>> contents(mHeaps.size());
+    for (uint32_t allocation = 0; allocation < mAllocations.size(); ++allocation) {
+        if (mAllocations[allocation].heap != Invalid && mAllocations[allocation].category == category) {
+            contents[mAllocations[allocation].heap].push_back(allocation);
+        }
+    }
+
+    Plan plan;
+    std::vector<Heap> heaps = mHeaps;
+    // heaps that took moved allocations stay, so nothing moves twice
+    std::vector<bool> targets(mHeaps.size(), false);
+    for (size_t source = 0; source < order.size(); ++source) {
+        std::vector<uint32_t> &moving = contents[order[source]];
+        if (moving.empty() || targets[order[source]]) {
+            continue;
+        }
+        if (plan.movedBytes + heaps[order[source]].allocator.used() > maxBytes) {
+            break;
+        }
+        std::sort(moving.begin(), moving.end(), [this](uint32_t a, uint32_t b) {
+            return mAllocations[a].size > mAllocations[b].size;
+        });
+
+        // into the fullest heaps first
+        std::vector<Heap> attempt = heaps;
+        std::vector<Move> moves;
+        uint64_t movedBytes = 0;
+        for (uint32_t allocation : moving) {
+            const Allocation &moved = mAllocations[allocation];
+            for (size_t target = order.size() - 1; target > source; --target) {
+                const uint64_t offset = attempt[order[target]].allocator.allocate(moved.size, moved.alignment);
+                if (offset != TlsfAllocator::Invalid) {
+                    attempt[order[source]].allocator.free(moved.offset);
+                    moves.push_back({allocation, order[source], moved.offset, order[target], offset});
+                    movedBytes += moved.size;
+                    break;
+                }
+            }
+            if (moves.empty() || moves.back().allocation != allocation) {
+                break;
+            }
+        }
+        if (moves.size() == moving.size()) {
+            heaps = std::move(attempt);
+            plan.moves.insert(plan.moves.end(), moves.begin(), moves.end());
+            plan.movedBytes += movedBytes;
+            plan.emptiedHeaps.push_back(order[source]);
+            for (const Move &move : moves) {
+                targets[move.toHeap] = true;
+            }
+        }
+    }
+    return plan;
+}
+
+void HeapAllocator::applyMove(const Move &move) {
+    Allocation &moved = mAllocations[move.allocation];
+    if (moved.heap != move.fromHeap || moved.offset != move.fromOffset) {
+        throw std::runtime_error("Defragment plan is stale");
+    }
+    const uint64_t offset = mHeaps[move.toHeap].allocator.allocate(moved.size, moved.alignment);
+    if (offset != move.toOffset) {
+        if (offset != TlsfAllocator::Invalid) {
+            mHeaps[move.toHeap].allocator.free(offset);
+        }
+        throw std::runtime_error("Defragment plan is stale");
+    }
+    mHeaps[move.fromHeap].allocator.free(move.fromOffset);
+    --mHeaps[move.fromHeap].allocations;
+    ++mHeaps[move.toHeap].allocations;
+    moved.heap = move.toHeap;
+    moved.offset = offset;
+}
+
+HeapAllocator::Stats HeapAllocator::stats(Category category) const {
+    Stats stats;
+    for (const Heap &heap : mHeaps) {
+        if (heap.category != category || heap.size == 0) {
+            continue;
+        }
+        ++stats.heaps;
+        stats.allocations += heap.allocations;
+        stats.heapBytes += heap.allocator.size();
+        stats.allocatedBytes += heap.allocator.used();
+        stats.largestFreeBlock = std::max(stats.largestFreeBlock, heap.allocator.largestFreeBlock());
+        stats.freeBlocks += heap.allocator.freeBlocks();
+    }
+    for (const Allocation &allocation : mAllocations) {
+        if (allocation.heap != Invalid && allocation.category == category) {
+            stats.requestedBytes += allocation.size;
+        }
+    }
+    return stats;
+}
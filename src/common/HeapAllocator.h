@@ -0,0 +1,178 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+
+// two level segregated fit over the bytes of one heap, allocate and free take constant time. sizes are rounded up to
+// the granularity, free blocks are binned by the highest set bit of their size and SubdivisionBits more below it
+class TlsfAllocator {
+public:
+    static const uint64_t Invalid = UINT64_MAX;
+
+    TlsfAllocator() = default;
+
+    TlsfAllocator(uint64_t size, uint64_t granularity);
+
+    void reset(uint64_t size, uint64_t granularity);
+
+    // offset of size bytes aligned to alignment, a power of two. Invalid when no free block fits
+    uint64_t allocate(uint64_t size, uint64_t alignment);
+
+    // throws when offset is not the start of an allocation
+    void free(uint64_t offset);
+
+    uint64_t size() const { return mSize * mGranularity; }
+
+    // allocated bytes, rounded up to the granularity
+    uint64_t used() const { return mUsed * mGranularity; }
+
+    uint64_t largestFreeBlock() const;
+
+    uint32_t freeBlocks() const { return mFreeBlocks; }
+
+private:
+    static const uint32_t SubdivisionBits = 4;
+    static const uint32_t Subdivisions = 1 << SubdivisionBits;
+    static const uint32_t FirstLevels = 64 - SubdivisionBits + 1;
+    static const uint32_t NoBlock = UINT32_MAX;
+
+    // offsets and sizes in granules, physical neighbours are adjacent in the heap
+    struct Block {
+        uint64_t offset;
+        uint64_t size;
+        uint32_t previousPhysical;
+        uint32_t nextPhysical;
+        uint32_t previousFree;
+        uint32_t nextFree;
+        bool free;
+    };
+
+    static void mapping(uint64_t size, uint32_t &firstLevel, uint32_t &secondLevel);
+
+    // a free block at least size granules large once aligned, NoBlock when there is none
+    uint32_t findFree(uint64_t size, uint64_t alignment) const;
+
+    uint32_t newBlock(uint64_t offset, uint64_t size);
+
+    void releaseBlock(uint32_t block);
+
+    void insertFree(uint32_t block);
+
+    void removeFree(uint32_t block);
+
+    // splits the end of block behind size granules off into a free block
+    void splitFree(uint32_t block, uint64_t size);
+
+    uint64_t mGranularity = 1;
+    uint64_t mSize = 0;
+    uint64_t mUsed = 0;
+    uint32_t mFreeBlocks = 0;
+
+    std::vector<Block> mBlocks;
+    std::vector<uint32_t> mUnusedBlocks;
+    // first level bit per non-empty row of bins, second level bit per non-empty bin
+    uint64_t mFirstLevelMap = 0;
+    uint32_t mSecondLevelMaps[FirstLevels] = {};
+    std::vector<uint32_t> mBins;
+    // allocated blocks by offset
+    std::unordered_map<uint64_t, uint32_t> mAllocated;
+};
+
+// placed resource memory suballocated from large heaps. buffers, textures and render targets get heaps of their own,
+// tier 1 hardware can't mix them in one heap. allocate() reports when no heap has room and the backend adds one, so
+// heap indices match the backend's heap objects. planDefragment() proposes moves that empty the least used heaps
+class HeapAllocator {
+public:
+    static const uint32_t Invalid = UINT32_MAX;
+
+    enum Category : uint32_t {
+        Buffers,
+        Textures,
+        RenderTargets,
+        NumCategories,
+    };
+
+    struct Allocation {
+        Category category;
+        uint32_t heap = Invalid;
+        uint64_t offset;
+        uint64_t size;
+        uint64_t alignment;
+    };
+
+    // heaps of size 0 were released, addHeap() reuses their index
+    struct Heap {
+        Category category;
+        uint64_t size;
+        uint32_t allocations;
+        TlsfAllocator allocator;
+    };
+
+    struct Move {
+        uint32_t allocation;
+        uint32_t fromHeap;
+        uint64_t fromOffset;
+        uint32_t toHeap;
+        uint64_t toOffset;
+    };
+
+    struct Plan {
+        std::vector<Move> moves;
+        uint64_t movedBytes = 0;
+        // empty once every move is applied
+        std::vector<uint32_t> emptiedHeaps;
+    };
+
+    struct Stats {
+        uint32_t heaps = 0;
+        uint32_t allocations = 0;
+        uint64_t heapBytes = 0;
+        uint64_t requestedBytes = 0;
+        // requested bytes rounded up to the granularity
+        uint64_t allocatedBytes = 0;
+        uint64_t largestFreeBlock = 0;
+        uint32_t freeBlocks = 0;
+
+        uint64_t freeBytes() const { return heapBytes - allocatedBytes; }
+
+        uint64_t wastedBytes() const { return allocatedBytes - requestedBytes; }
+
+        // 0 when all free memory is one block, close to 1 when it is scattered over many small ones
+        float fragmentation() const {
+            return freeBytes() > 0 ? 1.0f - float(largestFreeBlock) / float(freeBytes()) : 0.0f;
+        }
+    };
+
+    explicit HeapAllocator(uint64_t granularity = 4096) : mGranularity(granularity) {}
+
+    uint32_t addHeap(Category category, uint64_t size);
+
+    // throws when the heap still holds allocations
+    void releaseHeap(uint32_t heap);
+
+    // Invalid when no heap of the category has room, add one and try again
+    uint32_t allocate(Category category, uint64_t size, uint64_t alignment);
+
+    void free(uint32_t allocation);
+
+    const Allocation &allocation(uint32_t allocation) const { return mAllocations[allocation]; }
+
+    const std::vector<Heap> &heaps() const { return mHeaps; }
+
+    // moves allocations out of the least used heaps of the category into the free space of fuller ones, a heap is
+    // only planned when all of its allocations fit elsewhere. stops before maxBytes of copies
+    Plan planDefragment(Category category, uint64_t maxBytes) const;
+
+    // the moves of a plan have to be applied in order with nothing allocated or freed in between. the backend copies
+    // the resource to its new place, throws when the plan is stale
+    void applyMove(const Move &move);
+
+    Stats stats(Category category) const;
+
+private:
+    uint64_t mGranularity;
+    std::vector<Heap> mHeaps;
+    std::vector<Allocation> mAllocations;
+    std::vector<uint32_t> mFreeAllocations;
+};
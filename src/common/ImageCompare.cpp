@@ -0,0 +1,373 @@
+#include <cmath>
+#include <algorithm>
+#include <emmintrin.h>
+#include <glm.hpp>
+
+#include "src/common/ImageCompare.h"
+
+namespace {
+    // one channel of an image
+    struct Plane {
+        uint32_t width, height;
+        std::vector<float> data;
+
+        Plane(uint32_t width, uint32_t height) : width(width), height(height), data(size_t(width) * height) {}
+    };
+
+    // dst = src convolved along rows with an odd sized kernel, edges are clamped
+    void convolveRows(const Plane &src, Plane &dst, const std::vector<float> &kernel) {
+        const int radius = static_cast<int>(kernel.size() / 2);
+        const int width = static_cast<int>(src.width);
+        std::vector<float> padded(width + 2 * radius);
+        for (uint32_t y = 0; y < src.height; ++y) {
+            const float *in = &src.data[size_t(y) * width];
+            for (int i = 0; i < static_cast<int>(padded.size()); ++i) {
+                padded[i] = in[std::min(std::max(i - radius, 0), width - 1)];
+            }
+            float *out = &dst.data[size_t(y) * width];
+            int x = 0;
+            for (; x + 4 <= width; x += 4) {
+                __m128 sum = _mm_setzero_ps();
+                for (size_t k = 0; k < kernel.size(); ++k) {
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(kernel[k]), _mm_loadu_ps(&padded[x + k])));
+                }
+                _mm_storeu_ps(out + x, sum);
+            }
+            for (; x < width; ++x) {
+                float sum = 0.0f;
+                for (size_t k = 0; k < kernel.size(); ++k) {
+                    sum += kernel[k] * padded[x + k];
+                }
+                out[x] = sum;
+            }
+        }
+    }
+
+    // dst = src convolved along columns, four columns per step
+    void convolveColumns(const Plane &src, Plane &dst, const std::vector<float> &kernel) {
+        const int radius = static_cast<int>(kernel.size() / 2);
+        const int width = static_cast<int>(src.width), height = static_cast<int>(src.height);
+        std::vector<const float *> rows(kernel.size());
+        for (int y = 0; y < height; ++y) {
+            for (size_t k = 0; k < kernel.size(); ++k) {
+                int row = std::min(std::max(y + static_cast<int>(k) - radius, 0), height - 1);
+                rows[k] = &src.data[size_t(row) * width];
+            }
+            float *out = &dst.data[size_t(y) * width];
+            int x = 0;
+            for (; x + 4 <= width; x += 4) {
+                __m128 sum = _mm_setzero_ps();
+                for (size_t k = 0; k < kernel.size(); ++k) {
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(kernel[k]), _mm_loadu_ps(rows[k] + x)));
+                }
+                _mm_storeu_ps(out + x, sum);
+            }
+            for (; x < width; ++x) {
+                float sum = 0.0f;
+                for (size_t k = 0; k < kernel.size(); ++k) {
+                    sum += kernel[k] * rows[k][x];
+                }
+                out[x] = sum;
+            }
+        }
+    }
+
+    Plane convolve(const Plane &src, const std::vector<float> &rowKernel, const std::vector<float> &columnKernel) {
+        Plane temp(src.width, src.height), dst(src.width, src.height);
+        convolveRows(src, temp, rowKernel);
+        convolveColumns(temp, dst, columnKernel);
+        return dst;
+    }
+
+    // f(x) sampled at x = -radius..radius and scaled to sum to one
+    template <typename F>
+    std::vector<float> makeKernel(int radius, F f) {
+        std::vector<float> kernel(2 * radius + 1);
+        float sum = 0.0f;
+        for (int i = -radius; i <= radius; ++i) {
+            kernel[i + radius] = f(float(i));
+            sum += kernel[i + radius];
+        }
+        for (float &value : kernel) {
+            value /= sum;
+        }
+        return kernel;
+    }
+
+    // derivative kernels are scaled so their positive weights sum to one and the negative ones to minus one
+    void normalizeSigned(std::vector<float> &kernel) {
+        float mean = 0.0f;
+        for (float value : kernel) {
+            mean += value / kernel.size();
+        }
+        float positive = 0.0f;
+        for (float &value : kernel) {
+            value -= mean;
+            positive += std::max(value, 0.0f);
+        }
+        for (float &value : kernel) {
+            value /= positive;
+        }
+    }
+
+    float srgbToLinear(float c) { return c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f); }
+
+    // D65 sRGB primaries, the reference white is rgbToXyz(1, 1, 1)
+    glm::vec3 rgbToXyz(const glm::vec3 &c) {
+        return {0.4124564f * c.r + 0.3575761f * c.g + 0.1804375f * c.b,
+                0.2126729f * c.r + 0.7151522f * c.g + 0.0721750f * c.b,
+                0.0193339f * c.r + 0.1191920f * c.g + 0.9503041f * c.b};
+    }
+
+    glm::vec3 xyzToRgb(const glm::vec3 &c) {
+        return {3.2404542f * c.x - 1.5371385f * c.y - 0.4985314f * c.z,
+                -0.9692660f * c.x + 1.8760108f * c.y + 0.0415560f * c.z,
+                0.0556434f * c.x - 0.2040259f * c.y + 1.0572252f * c.z};
+    }
+
+    const glm::vec3 White{0.9504559f, 1.0f, 1.0890577f};
+
+    // linearized CIELAB, the opponent space FLIP filters in
+    glm::vec3 xyzToYcxcz(const glm::vec3 &c) {
+        glm::vec3 n = c / White;
+        return {116.0f * n.y - 16.0f, 500.0f * (n.x - n.y), 200.0f * (n.y - n.z)};
+    }
+
+    glm::vec3 ycxczToXyz(const glm::vec3 &c) {
+        float y = (c.x + 16.0f) / 116.0f;
+        return glm::vec3{c.y / 500.0f + y, y, y - c.z / 200.0f} * White;
+    }
+
+    // CIELAB with the Hunt effect applied to the chroma
+    glm::vec3 xyzToHuntLab(const glm::vec3 &c) {
+        auto f = [](float t) {
+            const float delta = 6.0f / 29.0f;
+            return t > delta * delta * delta ? std::cbrt(t) : t / (3.0f * delta * delta) + 4.0f / 29.0f;
+        };
+        glm::vec3 n = c / White;
+        float L = 116.0f * f(n.y) - 16.0f;
+        float a = 500.0f * (f(n.x) - f(n.y));
+        float b = 200.0f * (f(n.y) - f(n.z));
+        return {L, 0.01f * L * a, 0.01f * L * b};
+    }
+
+    float hyab(const glm::vec3 &a, const glm::vec3 &b) {
+        return std::abs(a.x - b.x) + std::sqrt((a.y - b.y) * (a.y - b.y) + (a.z - b.z) * (a.z - b.z));
+    }
+
+    // a1 * sqrt(pi / b1) * exp(-pi^2 x^2 / b1) + a2 * ..., x in degrees, per YCxCz channel
+    struct Csf {
+        float a1, b1, a2, b2;
+    };
+    const Csf ChannelCsf[3] = {{1.0f, 0.0047f, 0.0f, 1e-5f}, {1.0f, 0.0053f, 0.0f, 1e-5f},
+                               {34.1f, 0.04f, 13.5f, 0.025f}};
+
+    // the 2D csf is a sum of separable gaussians, each is applied on its own and weighted by its share of the
+    // kernel sum
+    Plane filterCsf(const Plane &src, const Csf &csf, float pixelsPerDegree, int radius) {
+        const float pi = 3.14159265f;
+        Plane dst(src.width, src.height);
+        float totalWeight = 0.0f;
+        std::vector<std::pair<float, std::vector<float>>> terms;
+        for (int term = 0; term < 2; ++term) {
+            float a = term == 0 ? csf.a1 : csf.a2, b = term == 0 ? csf.b1 : csf.b2;
+            if (a == 0.0f) {
+                continue;
+            }
+            float sum = 0.0f;
+            std::vector<float> kernel = makeKernel(radius, [&](float x) {
+                float degrees = x / pixelsPerDegree;
+                float value = std::exp(-pi * pi * degrees * degrees / b);
+                sum += value;
+                return value;
+            });
+            float weight = a * std::sqrt(pi / b) * sum * sum;
+            terms.emplace_back(weight, std::move(kernel));
+            totalWeight += weight;
+        }
+        for (const auto &term : terms) {
+            Plane filtered = convolve(src, term.second, term.second);
+            for (size_t i = 0; i < dst.data.size(); ++i) {
+                dst.data[i] += term.first / totalWeight * filtered.data[i];
+            }
+        }
+        return dst;
+    }
+
+    // magnitude of the gradient and of the second derivative of the luminance
+    void features(const Plane &luminance, const std::vector<float> &gauss, const std::vector<float> &edge,
+                  const std::vector<float> &point, Plane &edges, Plane &points) {
+        Plane ex = convolve(luminance, edge, gauss), ey = convolve(luminance, gauss, edge);
+        Plane px = convolve(luminance, point, gauss), py = convolve(luminance, gauss, point);
+        for (size_t i = 0; i < luminance.data.size(); ++i) {
+            edges.data[i] = std::sqrt(ex.data[i] * ex.data[i] + ey.data[i] * ey.data[i]);
+            points.data[i] = std::sqrt(px.data[i] * px.data[i] + py.data[i] * py.data[i]);
+        }
+    }
+
+    // sum of squared rgb differences in 8 bit units, four pixels per step
+    uint64_t sumSquaredDifference(const uint32_t *a, const uint32_t *b, size_t count) {
+        const __m128i rgbMask = _mm_set1_epi32(0x00ffffff);
+        const __m128i zero = _mm_setzero_si128();
+        uint64_t total = 0;
+        size_t i = 0;
+        while (i + 4 <= count) {
+            // 32 bit lanes hold at most 2 * 255^2 per step, flushed long before they overflow
+            __m128i sum = _mm_setzero_si128();
+            size_t end = std::min(count & ~size_t(3), i + 4 * 4096);
+            for (; i < end; i += 4) {
+                __m128i va = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i)), rgbMask);
+                __m128i vb = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i)), rgbMask);
+                __m128i lo = _mm_sub_epi16(_mm_unpacklo_epi8(va, zero), _mm_unpacklo_epi8(vb, zero));
+                __m128i hi = _mm_sub_epi16(_mm_unpackhi_epi8(va, zero), _mm_unpackhi_epi8(vb, zero));
+                sum = _mm_add_epi32(sum, _mm_add_epi32(_mm_madd_epi16(lo, lo), _mm_madd_epi16(hi, hi)));
+            }
+            alignas(16) uint32_t lanes[4];
+            _mm_store_si128(reinterpret_cast<__m128i *>(lanes), sum);
+            total += uint64_t(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+        }
+        for (; i < count; ++i) {
+            for (int c = 0; c < 3; ++c) {
+                int d = int((a[i] >> (8 * c)) & 0xff) - int((b[i] >> (8 * c)) & 0xff);
+                total += uint64_t(d * d);
+            }
+        }
+        return total;
+    }
+
+    float meanSsim(const Plane &x, const Plane &y) {
+        const float c1 = 0.01f * 0.01f, c2 = 0.03f * 0.03f;
+        std::vector<float> gauss = makeKernel(5, [](float t) { return std::exp(-t * t / (2.0f * 1.5f * 1.5f)); });
+
+        Plane xx(x.width, x.height), yy(x.width, x.height), xy(x.width, x.height);
+        for (size_t i = 0; i < x.data.size(); ++i) {
+            xx.data[i] = x.data[i] * x.data[i];
+            yy.data[i] = y.data[i] * y.data[i];
+            xy.data[i] = x.data[i] * y.data[i];
+        }
+        Plane muX = convolve(x, gauss, gauss), muY = convolve(y, gauss, gauss);
+        Plane sigmaXX = convolve(xx, gauss, gauss), sigmaYY = convolve(yy, gauss, gauss);
+        Plane sigmaXY = convolve(xy, gauss, gauss);
+
+        double total = 0.0;
+        for (size_t i = 0; i < x.data.size(); ++i) {
+            float mx = muX.data[i], my = muY.data[i];
+            float vx = sigmaXX.data[i] - mx * mx, vy = sigmaYY.data[i] - my * my, cxy = sigmaXY.data[i] - mx * my;
+            total += ((2.0f * mx * my + c1) * (2.0f * cxy + c2)) / ((mx * mx + my * my + c1) * (vx + vy + c2));
+        }
+        return static_cast<float>(total / x.data.size());
+    }
+}
+
+ImageMetrics ImageCompare::compare(const uint32_t *reference, const uint32_t *test, uint32_t width, uint32_t height,
+                                   std::vector<float> *flipMap, float pixelsPerDegree) {
+    const size_t count = size_t(width) * height;
+    ImageMetrics metrics;
+
+    double mse = double(sumSquaredDifference(reference, test, count)) / (3.0 * count * 255.0 * 255.0);
+    metrics.rmse = static_cast<float>(std::sqrt(mse));
+    metrics.psnr = mse > 0.0 ? static_cast<float>(10.0 * std::log10(1.0 / mse)) : INFINITY;
+
+    // srgb decode, luma for SSIM and YCxCz for FLIP
+    float decode[256];
+    for (int i = 0; i < 256; ++i) {
+        decode[i] = srgbToLinear(i / 255.0f);
+    }
+    const uint32_t *images[2] = {reference, test};
+    std::vector<Plane> luma(2, Plane(width, height));
+    std::vector<Plane> ycxcz(6, Plane(width, height));
+    for (int image = 0; image < 2; ++image) {
+        for (size_t i = 0; i < count; ++i) {
+            uint32_t pixel = images[image][i];
+            uint32_t r = pixel & 0xff, g = (pixel >> 8) & 0xff, b = (pixel >> 16) & 0xff;
+            luma[image].data[i] = (0.299f * r + 0.587f * g + 0.114f * b) / 255.0f;
+            glm::vec3 opponent = xyzToYcxcz(rgbToXyz({decode[r], decode[g], decode[b]}));
+            for (int c = 0; c < 3; ++c) {
+                ycxcz[image * 3 + c].data[i] = opponent[c];
+            }
+        }
+    }
+    metrics.ssim = meanSsim(luma[0], luma[1]);
+
+    // color: csf filtering, back to rgb inside the gamut, HyAB distance of the Hunt adjusted Lab colors
+    const int csfRadius = static_cast<int>(std::ceil(3.0f * std::sqrt(0.04f / (2.0f * 3.14159265f * 3.14159265f)) *
+                                                     pixelsPerDegree));
+    std::vector<Plane> filtered;
+    for (int plane = 0; plane < 6; ++plane) {
+        filtered.push_back(filterCsf(ycxcz[plane], ChannelCsf[plane % 3], pixelsPerDegree, csfRadius));
+    }
+
+    // features: gaussian derivatives of the luminance over 0.082 degrees
+    const float sigma = 0.5f * 0.082f * pixelsPerDegree;
+    const int featureRadius = static_cast<int>(std::ceil(3.0f * sigma));
+    auto gaussian = [&](float x) { return std::exp(-x * x / (2.0f * sigma * sigma)); };
+    std::vector<float> gauss = makeKernel(featureRadius, gaussian);
+    std::vector<float> edge = makeKernel(featureRadius, [&](float x) { return -x * gaussian(x); });
+    std::vector<float> point = makeKernel(featureRadius, [&](float x) {
+        return (x * x / (sigma * sigma) - 1.0f) * gaussian(x);
+    });
+    normalizeSigned(edge);
+    normalizeSigned(point);
+
+    std::vector<Plane> edges(2, Plane(width, height)), points(2, Plane(width, height));
+    for (int image = 0; image < 2; ++image) {
+        Plane luminance(width, height);
+        for (size_t i = 0; i < count; ++i) {
+            luminance.data[i] = (ycxcz[image * 3].data[i] + 16.0f) / 116.0f;
+        }
+        features(luminance, gauss, edge, point, edges[image], points[image]);
+    }
+
+    const float qc = 0.7f, pc = 0.4f, pt = 0.95f;
+    const float maxColor = std::pow(hyab(xyzToHuntLab(rgbToXyz({0.0f, 1.0f, 0.0f})),
+                                         xyzToHuntLab(rgbToXyz({0.0f, 0.0f, 1.0f}))), qc);
+    if (flipMap) {
+        flipMap->resize(count);
+    }
+    double flipSum = 0.0;
+    float flipMax = 0.0f;
+    for (size_t i = 0; i < count; ++i) {
+        glm::vec3 lab[2];
+        for (int image = 0; image < 2; ++image) {
+            glm::vec3 opponent{filtered[image * 3].data[i], filtered[image * 3 + 1].data[i],
+                               filtered[image * 3 + 2].data[i]};
+            glm::vec3 rgb = glm::clamp(xyzToRgb(ycxczToXyz(opponent)), 0.0f, 1.0f);
+            lab[image] = xyzToHuntLab(rgbToXyz(rgb));
+        }
+        float colorDistance = std::pow(hyab(lab[0], lab[1]), qc);
+        float colorError = colorDistance < pc * maxColor
+                               ? colorDistance * pt / (pc * maxColor)
+                               : pt + (colorDistance - pc * maxColor) / (maxColor - pc * maxColor) * (1.0f - pt);
+        colorError = std::min(colorError, 1.0f);
+
+        float edgeDifference = std::abs(edges[0].data[i] - edges[1].data[i]);
+        float pointDifference = std::abs(points[0].data[i] - points[1].data[i]);
+        float featureError = std::sqrt(std::min(std::max(edgeDifference, pointDifference) / std::sqrt(2.0f), 1.0f));
+
+        float error = std::pow(colorError, 1.0f - featureError);
+        flipSum += error;
+        flipMax = std::max(flipMax, error);
+        if (flipMap) {
+            (*flipMap)[i] = error;
+        }
+    }
+    metrics.flipMean = static_cast<float>(flipSum / count);
+    metrics.flipMax = flipMax;
+    return metrics;
+}
+
+std::vector<uint32_t> ImageCompare::heatmap(const std::vector<float> &errors) {
+    static const glm::vec3 ramp[] = {{0.0f, 0.0f, 4.0f},      {81.0f, 18.0f, 124.0f}, {183.0f, 55.0f, 121.0f},
+                                     {252.0f, 137.0f, 97.0f}, {252.0f, 253.0f, 191.0f}};
+    const int stops = sizeof(ramp) / sizeof(ramp[0]);
+
+    std::vector<uint32_t> pixels(errors.size());
+    for (size_t i = 0; i < errors.size(); ++i) {
+        float t = std::min(std::max(errors[i], 0.0f), 1.0f) * (stops - 1);
+        int index = std::min(static_cast<int>(t), stops - 2);
+        glm::vec3 color = glm::mix(ramp[index], ramp[index + 1], t - index);
+        pixels[i] = 0xff000000u | (uint32_t(color.b + 0.5f) << 16) | (uint32_t(color.g + 0.5f) << 8) |
+                    uint32_t(color.r + 0.5f);
+    }
+    return pixels;
+}
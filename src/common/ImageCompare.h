@@ -0,0 +1,31 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+// difference metrics between a reference and a test image, both rgba8 srgb with one uint32 per pixel in
+// DXGI_FORMAT_R8G8B8A8_UNORM byte order. alpha is ignored
+struct ImageMetrics {
+    // on srgb encoded rgb in [0, 1]
+    float rmse;
+    float psnr;
+    // mean SSIM of the luma, 11x11 gaussian windows with sigma 1.5
+    float ssim;
+    // mean and largest per pixel FLIP-style error in [0, 1]
+    float flipMean;
+    float flipMax;
+};
+
+// image comparison for golden image tests. the FLIP-style error follows LDR-FLIP (Andersson et al. 2020): both
+// images are filtered with the contrast sensitivity of the eye at the given pixels per degree, compared with the HyAB
+// color distance, and the error is raised where edges or points differ. it is a close approximation, not a
+// bit-exact port of the reference implementation. the filters run on SSE2, which every x64 cpu has
+class ImageCompare {
+public:
+    // 67 pixels per degree is a 0.7 m viewing distance from a 24" 4k monitor, the FLIP default
+    static ImageMetrics compare(const uint32_t *reference, const uint32_t *test, uint32_t width, uint32_t height,
+                                std::vector<float> *flipMap = nullptr, float pixelsPerDegree = 67.0f);
+
+    // per pixel errors in [0, 1] as rgba8 through a magma-like color ramp, black is no error
+    static std::vector<uint32_t> heatmap(const std::vector<float> &errors);
+};
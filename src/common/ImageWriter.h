@@ -0,0 +1,201 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <stdexcept>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <glm.hpp>
+
+#include "src/common/Half.h"
+
+// minimal image file writers for offline renders, no third party dependencies. png is rgba8 in stored (uncompressed)
+// deflate blocks, exr is a single part scanline file with half float rgb and no compression
+class ImageWriter {
+public:
+    // pixels are one uint32 per pixel in DXGI_FORMAT_R8G8B8A8_UNORM byte order, rows top to bottom
+    static void writePNG(const std::string &filename, uint32_t width, uint32_t height, const uint32_t *pixels) {
+        // every row starts with filter type 0
+        const size_t rowBytes = static_cast<size_t>(width) * 4 + 1;
+        std::vector<uint8_t> raw(rowBytes * height);
+        for (uint32_t y = 0; y < height; ++y) {
+            raw[y * rowBytes] = 0;
+            std::memcpy(&raw[y * rowBytes + 1], pixels + static_cast<size_t>(y) * width, rowBytes - 1);
+        }
+
+        // zlib stream of stored blocks
+        std::vector<uint8_t> zlib = {0x78, 0x01};
+        size_t offset = 0;
+        do {
+            size_t length = std::min<size_t>(raw.size() - offset, 65535);
+            zlib.push_back(offset + length == raw.size() ? 1 : 0);
+            zlib.push_back(static_cast<uint8_t>(length));
+            zlib.push_back(static_cast<uint8_t>(length >> 8));
+            zlib.push_back(static_cast<uint8_t>(~length));
+            zlib.push_back(static_cast<uint8_t>(~length >> 8));
+            zlib.insert(zlib.end(), raw.begin() + offset, raw.begin() + offset + length);
+            offset += length;
+        } while (offset < raw.size());
+        putBE32(zlib, adler32(raw.data(), raw.size()));
+
+        std::vector<uint8_t> header;
+        putBE32(header, width);
+        putBE32(header, height);
+        // 8 bits per channel, rgba, deflate, adaptive filtering, no interlace
+        header.insert(header.end(), {8, 6, 0, 0, 0});
+
+        std::vector<uint8_t> file = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+        putChunk(file, "IHDR", header);
+        putChunk(file, "IDAT", zlib);
+        putChunk(file, "IEND", {});
+        save(filename, file);
+    }
+
+    // linear hdr color, rows top to bottom
+    static void writeEXR(const std::string &filename, uint32_t width, uint32_t height, const glm::vec3 *pixels) {
+        std::vector<uint8_t> file;
+        putLE32(file, 20000630); // magic number
+        putLE32(file, 2);        // version 2, single part scanline
+
+        // channels are sorted by name, each is half (1) with sampling 1 x 1
+        std::vector<uint8_t> channels;
+        for (const char *name : {"B", "G", "R"}) {
+            putString(channels, name);
+            putLE32(channels, 1);
+            channels.insert(channels.end(), {0, 0, 0, 0});
+            putLE32(channels, 1);
+            putLE32(channels, 1);
+        }
+        channels.push_back(0);
+        putAttribute(file, "channels", "chlist", channels);
+
+        putAttribute(file, "compression", "compression", {0});
+
+        std::vector<uint8_t> window;
+        putLE32(window, 0);
+        putLE32(window, 0);
+        putLE32(window, width - 1);
+        putLE32(window, height - 1);
+        putAttribute(file, "dataWindow", "box2i", window);
+        putAttribute(file, "displayWindow", "box2i", window);
+
+        putAttribute(file, "lineOrder", "lineOrder", {0});
+        std::vector<uint8_t> one, center;
+        putFloat(one, 1.0f);
+        putFloat(center, 0.0f);
+        putFloat(center, 0.0f);
+        putAttribute(file, "pixelAspectRatio", "float", one);
+        putAttribute(file, "screenWindowCenter", "v2f", center);
+        putAttribute(file, "screenWindowWidth", "float", one);
+        file.push_back(0);
+
+        // offset table, then every scanline as y, byte count and the B, G and R rows
+        const uint32_t lineBytes = width * 3 * sizeof(uint16_t);
+        uint64_t offset = file.size() + static_cast<uint64_t>(height) * sizeof(uint64_t);
+        for (uint32_t y = 0; y < height; ++y) {
+            putLE64(file, offset);
+            offset += 8 + lineBytes;
+        }
+        for (uint32_t y = 0; y < height; ++y) {
+            putLE32(file, y);
+            putLE32(file, lineBytes);
+            const glm::vec3 *row = pixels + static_cast<size_t>(y) * width;
+            for (int c = 2; c >= 0; --c) {
+                for (uint32_t x = 0; x < width; ++x) {
+                    uint16_t half = floatToHalf(row[x][c]);
+                    file.push_back(static_cast<uint8_t>(half));
+                    file.push_back(static_cast<uint8_t>(half >> 8));
+                }
+            }
+        }
+        save(filename, file);
+    }
+
+private:
+    static void save(const std::string &filename, const std::vector<uint8_t> &bytes) {
+        std::ofstream file(filename, std::ios::binary);
+        file.write(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+        if (!file) {
+            throw std::runtime_error("Failed to write image file: " + filename);
+        }
+    }
+
+    static void putBE32(std::vector<uint8_t> &out, uint32_t value) {
+        for (int shift = 24; shift >= 0; shift -= 8) {
+            out.push_back(static_cast<uint8_t>(value >> shift));
+        }
+    }
+
+    static void putLE32(std::vector<uint8_t> &out, uint32_t value) {
+        for (int shift = 0; shift < 32; shift += 8) {
+            out.push_back(static_cast<uint8_t>(value >> shift));
+        }
+    }
+
+    static void putLE64(std::vector<uint8_t> &out, uint64_t value) {
+        putLE32(out, static_cast<uint32_t>(value));
+        putLE32(out, static_cast<uint32_t>(value >> 32));
+    }
+
+    static void putFloat(std::vector<uint8_t> &out, float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        putLE32(out, bits);
+    }
+
+    static void putString(std::vector<uint8_t> &out, const char *text) {
+        out.insert(out.end(), text, text + std::strlen(text) + 1);
+    }
+
+    static void putAttribute(std::vector<uint8_t> &out, const char *name, const char *type,
+                             const std::vector<uint8_t> &value) {
+        putString(out, name);
+        putString(out, type);
+        putLE32(out, static_cast<uint32_t>(value.size()));
+        out.insert(out.end(), value.begin(), value.end());
+    }
+
+    static void putChunk(std::vector<uint8_t> &out, const char *type, const std::vector<uint8_t> &data) {
+        putBE32(out, static_cast<uint32_t>(data.size()));
+        size_t start = out.size();
+        out.insert(out.end(), type, type + 4);
+        out.insert(out.end(), data.begin(), data.end());
+        putBE32(out, crc32(&out[start], out.size() - start));
+    }
+
+    static uint32_t crc32(const uint8_t *data, size_t size) {
+        static const std::vector<uint32_t> table = [] {
+            std::vector<uint32_t> values(256);
+            for (uint32_t i = 0; i < 256; ++i) {
+                uint32_t c = i;
+                for (int k = 0; k < 8; ++k) {
+                    c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+                }
+                values[i] = c;
+            }
+            return values;
+        }();
+        uint32_t crc = 0xffffffffu;
+        for (size_t i = 0; i < size; ++i) {
+            crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+        }
+        return crc ^ 0xffffffffu;
+    }
+
+    static uint32_t adler32(const uint8_t *data, size_t size) {
+        // 5552 bytes is the longest run before the sums can overflow
+        uint32_t a = 1, b = 0;
+        for (size_t start = 0; start < size; start += 5552) {
+            size_t end = std::min<size_t>(start + 5552, size);
+            for (size_t i = start; i < end; ++i) {
+                a += data[i];
+                b += a;
+            }
+            a %= 65521;
+            b %= 65521;
+        }
+        return (b << 16) | a;
+    }
+};
@@ -0,0 +1,32 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "src/common/InstanceBatcher.h"
+
+void InstanceBatcher::build(const uint32_t *meshes, const uint32_t *materials, const uint8_t *visible,
+                            uint32_t numInstances) {
+    // mesh | material | instance, sorting the keys groups the instances and keeps their order within a group
+    mKeys.clear();
+    for (uint32_t i = 0; i < numInstances; ++i) {
+        if (visible && !visible[i]) {
+            continue;
+        }
+        if (meshes[i] > MaxId || materials[i] > MaxId) {
+            throw std::runtime_error("Instance mesh or material id out of range");
+        }
+        mKeys.push_back(uint64_t(meshes[i]) << 48 | uint64_t(materials[i]) << 32 | i);
+    }
+    std::sort(mKeys.begin(), mKeys.end());
+
+    mBatches.clear();
+    mInstances.resize(mKeys.size());
+    for (uint32_t i = 0; i < mKeys.size(); ++i) {
+        const uint32_t mesh = static_cast<uint32_t>(mKeys[i] >> 48);
+        const uint32_t material = static_cast<uint32_t>(mKeys[i] >> 32) & MaxId;
+        if (mBatches.empty() || mBatches.back().mesh != mesh || mBatches.back().material != material) {
+            mBatches.push_back({mesh, material, i, 0});
+        }
+        ++mBatches.back().numInstances;
+        mInstances[i] = static_cast<uint32_t>(mKeys[i]);
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+// compacts the instances that survived culling and groups them by mesh and material, so every group is drawn with
+// one instanced draw call. groups come out sorted by mesh first to keep vertex buffer switches down, instances keep
+// their scene order within a group
+class InstanceBatcher {
+public:
+    // mesh and material ids must stay below 65536
+    static const uint32_t MaxId = 0xffff;
+
+    struct Batch {
+        uint32_t mesh;
+        uint32_t material;
+        // range of instances()
+        uint32_t firstInstance;
+        uint32_t numInstances;
+    };
+
+    // ids per instance, visible may be null to draw everything
+    void build(const uint32_t *meshes, const uint32_t *materials, const uint8_t *visible, uint32_t numInstances);
+
+    const std::vector<Batch> &batches() const { return mBatches; }
+
+    // scene instance indices in draw order
+    const std::vector<uint32_t> &instances() const { return mInstances; }
+
+private:
+    std::vector<uint64_t> mKeys;
+    std::vector<Batch> mBatches;
+    std::vector<uint32_t> mInstances;
+};
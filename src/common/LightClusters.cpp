@@ -0,0 +1,280 @@
+#include <chrono>
+#include <emmintrin.h>
+
+#include "src/common/LightClusters.h"
+#include "src/common/Parallel.h"
+
+namespace {
+    const uint32_t LightBits = 24;
+    const uint32_t MaxLights = 1u << LightBits;
+
+    uint32_t tileOf(float ndc, uint32_t tiles) {
+        float tile = std::floor((ndc * 0.5f + 0.5f) * tiles);
+        return static_cast<uint32_t>(std::min(std::max(tile, 0.0f), float(tiles - 1)));
+    }
+
+    // squared distance from a point to a box along one axis, four boxes at a time
+    struct TileRect {
+        uint32_t firstX, lastX, firstY, lastY;
+    };
+
+    // tiles covered by the box around a view space sphere clipped to a depth span in front of the camera. the box
+    // projects to the rectangle of its corners, returns false if that is off screen
+    bool tileRect(const glm::vec3 &center, float range, float nearDepth, float farDepth, float tanX, float tanY,
+                  TileRect &rect) {
+        float minX = INFINITY, maxX = -INFINITY, minY = INFINITY, maxY = -INFINITY;
+        for (float depth : {nearDepth, farDepth}) {
+            for (float sign : {-1.0f, 1.0f}) {
+                minX = std::min(minX, (center.x + sign * range) / (depth * tanX));
+                maxX = std::max(maxX, (center.x + sign * range) / (depth * tanX));
+                minY = std::min(minY, (center.y + sign * range) / (depth * tanY));
+                maxY = std::max(maxY, (center.y + sign * range) / (depth * tanY));
+            }
+        }
+        if (maxX < -1.0f || minX > 1.0f || maxY < -1.0f || minY > 1.0f) {
+            return false;
+        }
+        rect.firstX = tileOf(minX, LightClusters::TilesX);
+        rect.lastX = tileOf(maxX, LightClusters::TilesX);
+        // rows count from the top
+        rect.firstY = LightClusters::TilesY - 1 - tileOf(maxY, LightClusters::TilesY);
+        rect.lastY = LightClusters::TilesY - 1 - tileOf(minY, LightClusters::TilesY);
+        return true;
+    }
+
+    __m128 axisDistance(__m128 center, const float *boxMin, const float *boxMax) {
+        __m128 d = _mm_max_ps(_mm_sub_ps(_mm_load_ps(boxMin), center), _mm_sub_ps(center, _mm_load_ps(boxMax)));
+        d = _mm_max_ps(d, _mm_setzero_ps());
+        return _mm_mul_ps(d, d);
+    }
+}
+
+void LightClusters::build(const glm::mat4 &view, float fovY, float aspect, float zNear, float zFar,
+                          const ClusterLight *lights, uint32_t numLights) {
+    auto start = std::chrono::steady_clock::now();
+    updateGrid(fovY, aspect, zNear, zFar);
+    numLights = std::min(numLights, MaxLights);
+
+    // view space lights and the slices their bounding spheres reach
+    mViewLights.resize(numLights);
+    parallelForRange(0, numLights, [&](uint32_t first, uint32_t last) {
+        for (uint32_t i = first; i < last; ++i) {
+            ViewLight &viewLight = mViewLights[i];
+            viewLight.light = lights[i];
+            viewLight.light.position = glm::vec3(view * glm::vec4(lights[i].position, 1.0f));
+            viewLight.light.direction = glm::mat3(view) * lights[i].direction;
+
+            const glm::vec3 &center = viewLight.light.position;
+            const float range = lights[i].range;
+            const float nearDepth = -center.z - range, farDepth = -center.z + range;
+            if (farDepth < mNear || nearDepth > mFar || !(range > 0.0f)) {
+                viewLight.firstSlice = 1;
+                viewLight.lastSlice = 0;
+                continue;
+            }
+            auto slice = [&](float depth) {
+                float s = std::floor(std::log(std::min(std::max(depth, mNear), mFar)) * mSliceScale + mSliceBias);
+                return static_cast<uint32_t>(std::min(std::max(s, 0.0f), float(Slices - 1)));
+            };
+            viewLight.firstSlice = slice(nearDepth);
+            viewLight.lastSlice = slice(farDepth);
+
+            // drop lights entirely off screen, the tiles are narrowed down per slice
+            TileRect rect;
+            if (nearDepth > mNear && !tileRect(center, range, nearDepth, farDepth, mTanX, mTanY, rect)) {
+                viewLight.firstSlice = 1;
+                viewLight.lastSlice = 0;
+            }
+        }
+    }, 256);
+
+    // bin the lights by slice so every slice only walks the lights reaching it
+    mSliceLights.resize(Slices);
+    for (std::vector<uint32_t> &sliceLights : mSliceLights) {
+        sliceLights.clear();
+    }
+    for (uint32_t i = 0; i < numLights; ++i) {
+        for (uint32_t slice = mViewLights[i].firstSlice; slice <= mViewLights[i].lastSlice; ++slice) {
+            mSliceLights[slice].push_back(i);
+        }
+    }
+
+    mPairs.resize(Slices);
+    mSliceIndices.resize(Slices);
+    mSliceCounts.resize(Slices);
+    parallelFor(0, Slices, [&](uint32_t slice) { assignSlice(slice); });
+
+    // pack the slices one after another
+    std::vector<uint32_t> sliceOffsets(Slices + 1, 0);
+    for (uint32_t slice = 0; slice < Slices; ++slice) {
+        sliceOffsets[slice + 1] = sliceOffsets[slice] + static_cast<uint32_t>(mSliceIndices[slice].size());
+    }
+    mIndices.resize(sliceOffsets[Slices]);
+    mRanges.resize(NumClusters);
+    parallelFor(0, Slices, [&](uint32_t slice) {
+        std::copy(mSliceIndices[slice].begin(), mSliceIndices[slice].end(), mIndices.begin() + sliceOffsets[slice]);
+        uint32_t offset = sliceOffsets[slice];
+        for (uint32_t local = 0; local < TilesPerSlice; ++local) {
+            uint32_t count = mSliceCounts[slice][local];
+            mRanges[slice * TilesPerSlice + local] = {offset, count};
+            offset += count;
+        }
+    });
+
+    mStats = Stats{};
+    mStats.lights = numLights;
+    mStats.indices = mIndices.size();
+    for (const glm::uvec2 &range : mRanges) {
+        mStats.maxLightsPerCluster = std::max(mStats.maxLightsPerCluster, range.y);
+        mStats.emptyClusters += range.y == 0 ? 1 : 0;
+    }
+    mStats.buildTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void LightClusters::assignSlice(uint32_t slice) {
+    const SliceBounds &bounds = mBounds[slice];
+    std::vector<uint32_t> &pairs = mPairs[slice];
+    pairs.clear();
+
+    for (uint32_t i : mSliceLights[slice]) {
+        const ClusterLight &light = mViewLights[i].light;
+        TileRect rect;
+        const float nearDepth = std::max(-light.position.z - light.range, mSliceDepths[slice]);
+        const float farDepth = std::min(-light.position.z + light.range, mSliceDepths[slice + 1]);
+        if (!tileRect(light.position, light.range, nearDepth, farDepth, mTanX, mTanY, rect)) {
+            continue;
+        }
+        const __m128 cx = _mm_set1_ps(light.position.x), cy = _mm_set1_ps(light.position.y);
+        const __m128 cz = _mm_set1_ps(light.position.z), range = _mm_set1_ps(light.range);
+        const __m128 rangeSq = _mm_mul_ps(range, range);
+        const bool spot = light.isSpot();
+        const __m128 ax = _mm_set1_ps(light.direction.x), ay = _mm_set1_ps(light.direction.y);
+        const __m128 az = _mm_set1_ps(light.direction.z);
+        const __m128 cosAngle = _mm_set1_ps(light.cosOuter);
+        const __m128 sinAngle = _mm_set1_ps(std::sqrt(std::max(1.0f - light.cosOuter * light.cosOuter, 0.0f)));
+
+        for (uint32_t y = rect.firstY; y <= rect.lastY; ++y) {
+            for (uint32_t x = rect.firstX & ~3u; x <= rect.lastX; x += 4) {
+                const uint32_t local = y * TilesX + x;
+                __m128 distSq = _mm_add_ps(
+                    _mm_add_ps(axisDistance(cx, bounds.minX + local, bounds.maxX + local),
+                               axisDistance(cy, bounds.minY + local, bounds.maxY + local)),
+                    axisDistance(cz, bounds.minZ + local, bounds.maxZ + local));
+                __m128 hit = _mm_cmple_ps(distSq, rangeSq);
+
+                if (spot) {
+                    // cone against the bounding sphere of the cluster (Wronski, "Cull that cone!")
+                    __m128 vx = _mm_sub_ps(_mm_load_ps(bounds.centerX + local), cx);
+                    __m128 vy = _mm_sub_ps(_mm_load_ps(bounds.centerY + local), cy);
+                    __m128 vz = _mm_sub_ps(_mm_load_ps(bounds.centerZ + local), cz);
+                    __m128 radius = _mm_load_ps(bounds.radius + local);
+                    __m128 lengthSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)),
+                                                 _mm_mul_ps(vz, vz));
+                    __m128 along = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, ax), _mm_mul_ps(vy, ay)), _mm_mul_ps(vz, az));
+                    __m128 across = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(lengthSq, _mm_mul_ps(along, along)),
+                                                           _mm_setzero_ps()));
+                    __m128 closest = _mm_sub_ps(_mm_mul_ps(cosAngle, across), _mm_mul_ps(along, sinAngle));
+                    __m128 outside = _mm_or_ps(_mm_cmpgt_ps(closest, radius),
+                                               _mm_or_ps(_mm_cmpgt_ps(along, _mm_add_ps(radius, range)),
+                                                         _mm_cmplt_ps(along, _mm_sub_ps(_mm_setzero_ps(), radius))));
+                    hit = _mm_andnot_ps(outside, hit);
+                }
+
+                int mask = _mm_movemask_ps(hit);
+                for (uint32_t lane = 0; lane < 4; ++lane) {
+                    if ((mask & (1 << lane)) && x + lane >= rect.firstX && x + lane <= rect.lastX) {
+                        pairs.push_back(((local + lane) << LightBits) | i);
+                    }
+                }
+            }
+        }
+    }
+
+    // counting sort by cluster, lights stay in ascending order within a cluster
+    std::vector<uint32_t> &counts = mSliceCounts[slice];
+    counts.assign(TilesPerSlice, 0);
+    for (uint32_t pair : pairs) {
+        ++counts[pair >> LightBits];
+    }
+    uint32_t offsets[TilesPerSlice];
+    uint32_t offset = 0;
+    for (uint32_t local = 0; local < TilesPerSlice; ++local) {
+        offsets[local] = offset;
+        offset += counts[local];
+    }
+    std::vector<uint32_t> &indices = mSliceIndices[slice];
+    indices.resize(pairs.size());
+    for (uint32_t pair : pairs) {
+        indices[offsets[pair >> LightBits]++] = pair & (MaxLights - 1);
+    }
+}
+
+void LightClusters::updateGrid(float fovY, float aspect, float zNear, float zFar) {
+    if (fovY == mFovY && aspect == mAspect && zNear == mNear && zFar == mFar && !mBounds.empty()) {
+        return;
+    }
+    mFovY = fovY;
+    mAspect = aspect;
+    mNear = zNear;
+    mFar = zFar;
+    mSliceScale = Slices / std::log(zFar / zNear);
+    mSliceBias = -std::log(zNear) * mSliceScale;
+    mTanY = std::tan(0.5f * fovY);
+    mTanX = mTanY * aspect;
+    for (uint32_t slice = 0; slice <= Slices; ++slice) {
+        mSliceDepths[slice] = zNear * std::pow(zFar / zNear, float(slice) / Slices);
+    }
+
+    mBounds.resize(Slices);
+    for (uint32_t slice = 0; slice < Slices; ++slice) {
+        const float depth0 = mSliceDepths[slice], depth1 = mSliceDepths[slice + 1];
+        SliceBounds &bounds = mBounds[slice];
+        for (uint32_t y = 0; y < TilesY; ++y) {
+            for (uint32_t x = 0; x < TilesX; ++x) {
+                const uint32_t local = y * TilesX + x;
+                const float ndcX0 = -1.0f + 2.0f * x / TilesX, ndcX1 = -1.0f + 2.0f * (x + 1) / TilesX;
+                const float ndcY0 = 1.0f - 2.0f * (y + 1) / TilesY, ndcY1 = 1.0f - 2.0f * y / TilesY;
+                bounds.minX[local] = std::min(ndcX0 * depth0, ndcX0 * depth1) * mTanX;
+                bounds.maxX[local] = std::max(ndcX1 * depth0, ndcX1 * depth1) * mTanX;
+                bounds.minY[local] = std::min(ndcY0 * depth0, ndcY0 * depth1) * mTanY;
+                bounds.maxY[local] = std::max(ndcY1 * depth0, ndcY1 * depth1) * mTanY;
+                bounds.minZ[local] = -depth1;
+                bounds.maxZ[local] = -depth0;
+
+                glm::vec3 boundsMin{bounds.minX[local], bounds.minY[local], bounds.minZ[local]};
+                glm::vec3 boundsMax{bounds.maxX[local], bounds.maxY[local], bounds.maxZ[local]};
+                glm::vec3 center = 0.5f * (boundsMin + boundsMax);
+                bounds.centerX[local] = center.x;
+                bounds.centerY[local] = center.y;
+                bounds.centerZ[local] = center.z;
+                bounds.radius[local] = glm::length(boundsMax - center);
+            }
+        }
+    }
+}
+
+void LightClusters::clusterBounds(uint32_t cluster, glm::vec3 &boundsMin, glm::vec3 &boundsMax) const {
+    const SliceBounds &bounds = mBounds[cluster / TilesPerSlice];
+    const uint32_t local = cluster % TilesPerSlice;
+    boundsMin = {bounds.minX[local], bounds.minY[local], bounds.minZ[local]};
+    boundsMax = {bounds.maxX[local], bounds.maxY[local], bounds.maxZ[local]};
+}
+
+bool LightClusters::intersects(const ClusterLight &viewLight, const glm::vec3 &boundsMin,
+                               const glm::vec3 &boundsMax) {
+    glm::vec3 d = glm::max(glm::max(boundsMin - viewLight.position, viewLight.position - boundsMax), 0.0f);
+    if (glm::dot(d, d) > viewLight.range * viewLight.range) {
+        return false;
+    }
+    if (!viewLight.isSpot()) {
+        return true;
+    }
+    glm::vec3 center = 0.5f * (boundsMin + boundsMax);
+    float radius = glm::length(boundsMax - center);
+    glm::vec3 v = center - viewLight.position;
+    float along = glm::dot(v, viewLight.direction);
+    float across = std::sqrt(std::max(glm::dot(v, v) - along * along, 0.0f));
+    float sinAngle = std::sqrt(std::max(1.0f - viewLight.cosOuter * viewLight.cosOuter, 0.0f));
+    float closest = viewLight.cosOuter * across - along * sinAngle;
+    return !(closest > radius || along > radius + viewLight.range || along < -radius);
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <glm.hpp>
+
+// point or spot light for clustered shading, laid out like the Light struct of pbr.hlsl. radiance falls off with the
+// inverse square of the distance, windowed to reach zero at range. point lights have cosOuter below -1
+struct ClusterLight {
+    glm::vec3 position;
+    float range;
+    glm::vec3 radiance;
+    float cosInner;
+    glm::vec3 direction;
+    float cosOuter;
+
+    static ClusterLight point(const glm::vec3 &position, const glm::vec3 &radiance, float range) {
+        return {position, range, radiance, -1.0f, glm::vec3{0.0f, 0.0f, -1.0f}, -2.0f};
+    }
+
+    // cone angles in degrees from the axis, below 90
+    static ClusterLight spot(const glm::vec3 &position, const glm::vec3 &direction, const glm::vec3 &radiance,
+                             float range, float innerAngle, float outerAngle) {
+        return {position, range, radiance, std::cos(glm::radians(std::min(innerAngle, outerAngle))),
+                glm::normalize(direction), std::cos(glm::radians(outerAngle))};
+    }
+
+    bool isSpot() const { return cosOuter >= -1.0f; }
+};
+
+// clustered forward light assignment. the view frustum is split into TilesX x TilesY screen tiles and Slices depth
+// slices spaced exponentially between the near and far plane, and every cluster gets a compact list of the lights
+// whose sphere or cone touches its view space bounds. slices are assigned in parallel, each light is tested against
+// four clusters of a tile row at a time with SSE
+class LightClusters {
+public:
+    static const uint32_t TilesX = 16;
+    static const uint32_t TilesY = 9;
+    static const uint32_t Slices = 24;
+    static const uint32_t NumClusters = TilesX * TilesY * Slices;
+
+    struct Stats {
+        uint32_t lights = 0;
+        uint64_t indices = 0;
+        uint32_t maxLightsPerCluster = 0;
+        uint32_t emptyClusters = 0;
+        // milliseconds
+        double buildTime = 0.0;
+    };
+
+    // the frustum of glm::perspective(fovY, aspect, zNear, zFar) with fovY in radians
+    void build(const glm::mat4 &view, float fovY, float aspect, float zNear, float zFar, const ClusterLight *lights,
+               uint32_t numLights);
+
+    // tile rows go from the top of the screen down
+    static uint32_t clusterIndex(uint32_t x, uint32_t y, uint32_t slice) { return (slice * TilesY + y) * TilesX + x; }
+
+    // offset into lightIndices() and light count per cluster
+    const std::vector<glm::uvec2> &clusterRanges() const { return mRanges; }
+
+    const std::vector<uint32_t> &lightIndices() const { return mIndices; }
+
+    // slice = log(view depth) * sliceScale + sliceBias
+    float sliceScale() const { return mSliceScale; }
+
+    float sliceBias() const { return mSliceBias; }
+
+    const Stats &stats() const { return mStats; }
+
+    // view space bounds of a cluster, the camera looks down -z
+    void clusterBounds(uint32_t cluster, glm::vec3 &boundsMin, glm::vec3 &boundsMax) const;
+
+    // scalar test of a light in view space against view space bounds, the reference for the SSE path
+    static bool intersects(const ClusterLight &viewLight, const glm::vec3 &boundsMin, const glm::vec3 &boundsMax);
+
+private:
+    static const uint32_t TilesPerSlice = TilesX * TilesY;
+
+    // a light in view space with the slices it can touch
+    struct ViewLight {
+        ClusterLight light;
+        uint32_t firstSlice, lastSlice;
+    };
+
+    // bounds of the clusters of one slice in structure of arrays layout, index y * TilesX + x
+    struct SliceBounds {
+        alignas(16) float minX[TilesPerSlice], minY[TilesPerSlice], minZ[TilesPerSlice];
+        alignas(16) float maxX[TilesPerSlice], maxY[TilesPerSlice], maxZ[TilesPerSlice];
+        // bounding spheres for the cone test
+        alignas(16) float centerX[TilesPerSlice], centerY[TilesPerSlice], centerZ[TilesPerSlice];
+        alignas(16) float radius[TilesPerSlice];
+    };
+
+    void updateGrid(float fovY, float aspect, float zNear, float zFar);
+
+    void assignSlice(uint32_t slice);
+
+    float mFovY = 0.0f, mAspect = 0.0f, mNear = 0.0f, mFar = 0.0f;
+    float mSliceScale = 0.0f, mSliceBias = 0.0f;
+    float mTanX = 0.0f, mTanY = 0.0f;
+    float mSliceDepths[Slices + 1] = {};
+    std::vector<SliceBounds> mBounds;
+
+    std::vector<ViewLight> mViewLights;
+    std::vector<std::vector<uint32_t>> mSliceLights;
+    // per slice (local cluster << 24 | light) pairs, then the sorted light lists
+    std::vector<std::vector<uint32_t>> mPairs;
+    std::vector<std::vector<uint32_t>> mSliceIndices;
+    std::vector<std::vector<uint32_t>> mSliceCounts;
+
+    std::vector<glm::uvec2> mRanges;
+    std::vector<uint32_t> mIndices;
+    Stats mStats;
+};
@@ -1,4 +1,7 @@
+#pragma once
+
 #include <memory>
+#include <stdexcept>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
 #include <assimp/Importer.hpp>
@@ -0,0 +1,372 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <emmintrin.h>
+
+#include "src/common/OcclusionCuller.h"
+#include "src/common/Parallel.h"
+
+namespace {
+    const uint32_t FullMask = 0xffffffffu;
+
+    // tile rows rasterized by one job, every job walks all triangles so bands should not get too thin
+    const uint32_t BandTiles = 4;
+
+    // sutherland-hodgman against the near plane z >= -w
+    uint32_t clipNear(const glm::vec4 *in, uint32_t count, glm::vec4 *out) {
+        uint32_t numOut = 0;
+        for (uint32_t i = 0; i < count; ++i) {
+            const glm::vec4 &a = in[i];
+            const glm::vec4 &b = in[(i + 1) % count];
+            float da = a.z + a.w, db = b.z + b.w;
+            if (da >= 0.0f) {
+                out[numOut++] = a;
+            }
+            if ((da >= 0.0f) != (db >= 0.0f)) {
+                out[numOut++] = glm::mix(a, b, da / (da - db));
+            }
+        }
+        return numOut;
+    }
+
+    // bits of the frustum planes a clip space point is outside of
+    uint32_t outcode(const glm::vec4 &p) {
+        return (p.x < -p.w ? 1u : 0u) | (p.x > p.w ? 2u : 0u) | (p.y < -p.w ? 4u : 0u) | (p.y > p.w ? 8u : 0u) |
+               (p.z < -p.w ? 16u : 0u) | (p.z > p.w ? 32u : 0u);
+    }
+
+    double millisecondsSince(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+OcclusionCuller::OcclusionCuller(uint32_t width, uint32_t height) {
+    mTilesX = (std::max(width, 1u) + TileWidth - 1) / TileWidth;
+    mTilesY = (std::max(height, 1u) + TileHeight - 1) / TileHeight;
+    mWidth = mTilesX * TileWidth;
+    mHeight = mTilesY * TileHeight;
+    mTileZ.resize(mTilesX * mTilesY);
+    mLayerZ.resize(mTilesX * mTilesY);
+    mLayerMask.resize(mTilesX * mTilesY);
+    clear();
+}
+
+int32_t OcclusionCuller::addOccluder(const glm::vec3 *positions, size_t numPositions, const uint32_t *indices,
+                                     size_t numIndices) {
+    OccluderMesh mesh;
+    mesh.positions.assign(positions, positions + numPositions);
+    mesh.indices.assign(indices, indices + numIndices - numIndices % 3);
+    mOccluders.push_back(std::move(mesh));
+    return static_cast<int32_t>(mOccluders.size() - 1);
+}
+
+void OcclusionCuller::clear() {
+    std::fill(mTileZ.begin(), mTileZ.end(), 1.0f);
+    std::fill(mLayerZ.begin(), mLayerZ.end(), 0.0f);
+    std::fill(mLayerMask.begin(), mLayerMask.end(), 0u);
+}
+
+void OcclusionCuller::cull(const glm::mat4 &viewProj, const std::vector<Instance> &instances,
+                           std::vector<uint8_t> &visible) {
+    const uint32_t numInstances = static_cast<uint32_t>(instances.size());
+    mStats = Stats{};
+    mStats.instances = numInstances;
+    if (mPrevious.size() != numInstances) {
+        mPrevious.assign(numInstances, 1);
+    }
+    mResults.resize(numInstances);
+
+    auto test = [&](bool retest) {
+        auto start = std::chrono::steady_clock::now();
+        parallelForRange(0, numInstances, [&](uint32_t first, uint32_t last) {
+            for (uint32_t i = first; i < last; ++i) {
+                if (!retest || mResults[i] == Result::Occluded) {
+                    const Instance &instance = instances[i];
+                    mResults[i] = testBounds(viewProj * instance.world, instance.boundsMin, instance.boundsMax);
+                }
+            }
+        }, 256);
+        mStats.testTime += millisecondsSince(start);
+    };
+    auto draw = [&](const std::vector<uint32_t> &list) {
+        auto start = std::chrono::steady_clock::now();
+        drawOccluders(viewProj, instances, list);
+        mStats.rasterizeTime += millisecondsSince(start);
+    };
+
+    // first pass with the occluders that were visible last frame
+    clear();
+    std::vector<uint32_t> list;
+    for (uint32_t i = 0; i < numInstances; ++i) {
+        if (instances[i].occluder >= 0 && mPrevious[i]) {
+            list.push_back(i);
+        }
+    }
+    draw(list);
+    test(false);
+    mStats.occludedFirstPass = static_cast<uint32_t>(std::count(mResults.begin(), mResults.end(), Result::Occluded));
+
+    // second pass with the ones that came into view, only what the first pass culled can change
+    list.clear();
+    for (uint32_t i = 0; i < numInstances; ++i) {
+        if (instances[i].occluder >= 0 && !mPrevious[i] && mResults[i] == Result::Visible) {
+            list.push_back(i);
+        }
+    }
+    if (!list.empty() && mStats.occludedFirstPass > 0) {
+        draw(list);
+        test(true);
+    }
+
+    visible.resize(numInstances);
+    for (uint32_t i = 0; i < numInstances; ++i) {
+        visible[i] = mResults[i] == Result::Visible ? 1 : 0;
+        mStats.frustumCulled += mResults[i] == Result::OutsideFrustum ? 1 : 0;
+        mStats.occluded += mResults[i] == Result::Occluded ? 1 : 0;
+    }
+    mPrevious = visible;
+}
+
+void OcclusionCuller::drawOccluders(const glm::mat4 &viewProj, const std::vector<Instance> &instances,
+                                    const std::vector<uint32_t> &list) {
+    const uint32_t count = static_cast<uint32_t>(list.size());
+    if (mTriangles.size() < count) {
+        mTriangles.resize(count);
+    }
+    parallelFor(0, count, [&](uint32_t i) {
+        const Instance &instance = instances[list[i]];
+        setupTriangles(viewProj * instance.world, static_cast<uint32_t>(instance.occluder), mTriangles[i]);
+    });
+
+    // bands of tile rows are independent, triangles keep their order within a band
+    const uint32_t numBands = (mTilesY + BandTiles - 1) / BandTiles;
+    parallelFor(0, numBands, [&](uint32_t band) {
+        const uint32_t firstTileY = band * BandTiles;
+        const uint32_t lastTileY = std::min(firstTileY + BandTiles, mTilesY);
+        const int32_t firstY = static_cast<int32_t>(firstTileY * TileHeight);
+        const int32_t lastY = static_cast<int32_t>(lastTileY * TileHeight) - 1;
+        for (uint32_t i = 0; i < count; ++i) {
+            for (const Triangle &tri : mTriangles[i]) {
+                if (tri.maxY >= firstY && tri.minY <= lastY) {
+                    rasterizeTriangle(tri, firstTileY, lastTileY);
+                }
+            }
+        }
+    });
+
+    mStats.occludersDrawn += count;
+    for (uint32_t i = 0; i < count; ++i) {
+        mStats.occluderTriangles += mTriangles[i].size();
+    }
+}
+
+void OcclusionCuller::setupTriangles(const glm::mat4 &worldViewProj, uint32_t occluder,
+                                     std::vector<Triangle> &triangles) const {
+    const OccluderMesh &mesh = mOccluders.at(occluder);
+    triangles.clear();
+
+    thread_local std::vector<glm::vec4> clip;
+    clip.resize(mesh.positions.size());
+    for (size_t i = 0; i < mesh.positions.size(); ++i) {
+        clip[i] = worldViewProj * glm::vec4(mesh.positions[i], 1.0f);
+    }
+
+    const float halfWidth = 0.5f * mWidth, halfHeight = 0.5f * mHeight;
+    for (size_t i = 0; i + 2 < mesh.indices.size(); i += 3) {
+        glm::vec4 polygon[4] = {clip[mesh.indices[i]], clip[mesh.indices[i + 1]], clip[mesh.indices[i + 2]]};
+        if (outcode(polygon[0]) & outcode(polygon[1]) & outcode(polygon[2])) {
+            continue;
+        }
+        uint32_t numVertices = 3;
+        if ((outcode(polygon[0]) | outcode(polygon[1]) | outcode(polygon[2])) & 16u) {
+            glm::vec4 clipped[4];
+            numVertices = clipNear(polygon, 3, clipped);
+            std::copy(clipped, clipped + numVertices, polygon);
+        }
+
+        // screen space with y down and depth in [0, 1]
+        glm::vec3 screen[4];
+        for (uint32_t v = 0; v < numVertices; ++v) {
+            float invW = 1.0f / polygon[v].w;
+            screen[v] = {(polygon[v].x * invW + 1.0f) * halfWidth, (1.0f - polygon[v].y * invW) * halfHeight,
+                         0.5f * polygon[v].z * invW + 0.5f};
+        }
+
+        for (uint32_t v = 2; v < numVertices; ++v) {
+            // counter clockwise with y up is clockwise on screen, swapping the last two vertices makes the
+            // area positive and the edge functions positive inside
+            const glm::vec3 &p0 = screen[0], &p1 = screen[v], &p2 = screen[v - 1];
+            float area = (p1.x - p0.x) * (p2.y - p0.y) - (p2.x - p0.x) * (p1.y - p0.y);
+            if (!(area > 0.0f)) {
+                continue;
+            }
+
+            Triangle tri;
+            const glm::vec3 *vertices[3] = {&p0, &p1, &p2};
+            for (int e = 0; e < 3; ++e) {
+                const glm::vec3 &a = *vertices[e], &b = *vertices[(e + 1) % 3];
+                tri.a[e] = a.y - b.y;
+                tri.b[e] = b.x - a.x;
+                tri.c[e] = -(tri.a[e] * a.x + tri.b[e] * a.y);
+            }
+            tri.za = ((p1.z - p0.z) * (p2.y - p0.y) - (p2.z - p0.z) * (p1.y - p0.y)) / area;
+            tri.zb = ((p1.x - p0.x) * (p2.z - p0.z) - (p2.x - p0.x) * (p1.z - p0.z)) / area;
+            tri.zc = p0.z - tri.za * p0.x - tri.zb * p0.y;
+            tri.maxZ = std::min(std::max(std::max(p0.z, p1.z), p2.z), 1.0f);
+
+            // pixels whose center can be inside, clamped before the conversion so huge guard band coordinates
+            // cannot overflow
+            auto pixel = [](float value, float limit) {
+                return static_cast<int32_t>(std::floor(std::min(std::max(value, -1.0f), limit)));
+            };
+            tri.minX = std::max(pixel(std::min(std::min(p0.x, p1.x), p2.x), float(mWidth)), 0);
+            tri.maxX = std::min(pixel(std::max(std::max(p0.x, p1.x), p2.x), float(mWidth)), int32_t(mWidth) - 1);
+            tri.minY = std::max(pixel(std::min(std::min(p0.y, p1.y), p2.y), float(mHeight)), 0);
+            tri.maxY = std::min(pixel(std::max(std::max(p0.y, p1.y), p2.y), float(mHeight)), int32_t(mHeight) - 1);
+            if (tri.minX <= tri.maxX && tri.minY <= tri.maxY) {
+                triangles.push_back(tri);
+            }
+        }
+    }
+}
+
+void OcclusionCuller::rasterizeTriangle(const Triangle &tri, uint32_t firstTileY, uint32_t lastTileY) {
+    const uint32_t tileX0 = tri.minX / TileWidth, tileX1 = tri.maxX / TileWidth;
+    const uint32_t tileY0 = std::max(tri.minY / TileHeight, firstTileY);
+    const uint32_t tileY1 = std::min(tri.maxY / TileHeight + 1, lastTileY);
+    const __m128 offsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    const __m128 zero = _mm_setzero_ps();
+
+    for (uint32_t tileY = tileY0; tileY < tileY1; ++tileY) {
+        const float y = float(tileY * TileHeight);
+        for (uint32_t tileX = tileX0; tileX <= tileX1; ++tileX) {
+            const float x = float(tileX * TileWidth);
+
+            // coverage of the 8x4 pixel centers, left and right half of a row per vector
+            __m128 left[3], right[3], stepY[3];
+            for (int e = 0; e < 3; ++e) {
+                __m128 rowStart = _mm_set1_ps(tri.a[e] * x + tri.b[e] * (y + 0.5f) + tri.c[e]);
+                left[e] = _mm_add_ps(rowStart, _mm_mul_ps(_mm_set1_ps(tri.a[e]), offsets));
+                right[e] = _mm_add_ps(left[e], _mm_set1_ps(4.0f * tri.a[e]));
+                stepY[e] = _mm_set1_ps(tri.b[e]);
+            }
+            uint32_t coverage = 0;
+            for (uint32_t row = 0; row < TileHeight; ++row) {
+                __m128 inLeft = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(left[0], zero), _mm_cmpge_ps(left[1], zero)),
+                                           _mm_cmpge_ps(left[2], zero));
+                __m128 inRight = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(right[0], zero), _mm_cmpge_ps(right[1], zero)),
+                                            _mm_cmpge_ps(right[2], zero));
+                uint32_t bits = static_cast<uint32_t>(_mm_movemask_ps(inLeft) | (_mm_movemask_ps(inRight) << 4));
+                coverage |= bits << (row * TileWidth);
+                for (int e = 0; e < 3; ++e) {
+                    left[e] = _mm_add_ps(left[e], stepY[e]);
+                    right[e] = _mm_add_ps(right[e], stepY[e]);
+                }
+            }
+            if (coverage == 0) {
+                continue;
+            }
+
+            // farthest depth of the plane over the part of the tile inside the triangle bounds
+            float x0 = std::max(x, float(tri.minX)), x1 = std::min(x + TileWidth, float(tri.maxX + 1));
+            float y0 = std::max(y, float(tri.minY)), y1 = std::min(y + TileHeight, float(tri.maxY + 1));
+            float z = tri.za * (tri.za > 0.0f ? x1 : x0) + tri.zb * (tri.zb > 0.0f ? y1 : y0) + tri.zc;
+            mergeTile(tileY * mTilesX + tileX, coverage, std::min(z, tri.maxZ));
+        }
+    }
+}
+
+void OcclusionCuller::mergeTile(uint32_t tile, uint32_t coverage, float z) {
+    float &tileZ = mTileZ[tile], &layerZ = mLayerZ[tile];
+    uint32_t &mask = mLayerMask[tile];
+    if (z >= tileZ) {
+        return;
+    }
+    if (coverage == FullMask) {
+        tileZ = z;
+        if (layerZ >= z) {
+            layerZ = 0.0f;
+            mask = 0;
+        }
+        return;
+    }
+
+    // a triangle much nearer than the working layer starts a new one instead of inheriting its far depth
+    if (mask != 0 && layerZ - z > tileZ - layerZ) {
+        layerZ = 0.0f;
+        mask = 0;
+    }
+    layerZ = std::max(layerZ, z);
+    mask |= coverage;
+    if (mask == FullMask) {
+        tileZ = layerZ;
+        layerZ = 0.0f;
+        mask = 0;
+    }
+}
+
+OcclusionCuller::Result OcclusionCuller::testBounds(const glm::mat4 &worldViewProj, const glm::vec3 &boundsMin,
+                                                    const glm::vec3 &boundsMax) const {
+    // corners as the min corner plus the transformed box edges
+    const glm::vec3 extent = boundsMax - boundsMin;
+    const glm::vec4 base = worldViewProj * glm::vec4(boundsMin, 1.0f);
+    const glm::vec4 edges[3] = {worldViewProj[0] * extent.x, worldViewProj[1] * extent.y, worldViewProj[2] * extent.z};
+    glm::vec4 corners[8];
+    uint32_t outside = 63u, anyOutside = 0;
+    for (uint32_t i = 0; i < 8; ++i) {
+        corners[i] = base;
+        for (uint32_t axis = 0; axis < 3; ++axis) {
+            if (i & (1u << axis)) {
+                corners[i] += edges[axis];
+            }
+        }
+        uint32_t code = outcode(corners[i]);
+        outside &= code;
+        anyOutside |= code;
+    }
+    if (outside != 0) {
+        return Result::OutsideFrustum;
+    }
+    // bounds through the near plane are too close to test
+    if (anyOutside & 16u) {
+        return Result::Visible;
+    }
+
+    float minX = INFINITY, minY = INFINITY, maxX = -INFINITY, maxY = -INFINITY, nearZ = INFINITY;
+    for (const glm::vec4 &corner : corners) {
+        float invW = 1.0f / corner.w;
+        float x = (corner.x * invW + 1.0f) * 0.5f * mWidth, y = (1.0f - corner.y * invW) * 0.5f * mHeight;
+        minX = std::min(minX, x);
+        maxX = std::max(maxX, x);
+        minY = std::min(minY, y);
+        maxY = std::max(maxY, y);
+        nearZ = std::min(nearZ, 0.5f * corner.z * invW + 0.5f);
+    }
+    const int32_t x0 = std::max(static_cast<int32_t>(std::floor(std::max(minX, -1.0f))), 0);
+    const int32_t x1 = std::min(static_cast<int32_t>(std::floor(std::min(maxX, float(mWidth)))), int32_t(mWidth) - 1);
+    const int32_t y0 = std::max(static_cast<int32_t>(std::floor(std::max(minY, -1.0f))), 0);
+    const int32_t y1 =
+        std::min(static_cast<int32_t>(std::floor(std::min(maxY, float(mHeight)))), int32_t(mHeight) - 1);
+    if (x0 > x1 || y0 > y1) {
+        return Result::OutsideFrustum;
+    }
+
+    const uint32_t tileX0 = x0 / TileWidth, tileX1 = x1 / TileWidth + 1;
+    const uint32_t tileY0 = y0 / TileHeight, tileY1 = y1 / TileHeight + 1;
+    const __m128 z = _mm_set1_ps(nearZ);
+    for (uint32_t tileY = tileY0; tileY < tileY1; ++tileY) {
+        const float *row = &mTileZ[tileY * mTilesX];
+        uint32_t tileX = tileX0;
+        for (; tileX + 4 <= tileX1; tileX += 4) {
+            if (_mm_movemask_ps(_mm_cmplt_ps(z, _mm_loadu_ps(row + tileX)))) {
+                return Result::Visible;
+            }
+        }
+        for (; tileX < tileX1; ++tileX) {
+            if (nearZ < row[tileX]) {
+                return Result::Visible;
+            }
+        }
+    }
+    return Result::Occluded;
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <glm.hpp>
+
+// masked software occlusion culling (Andersson et al. 2015) on a coarse cpu depth buffer. occluder meshes are
+// rasterized into 8x4 pixel tiles that keep a conservative far depth, plus a working layer of partial coverage (one
+// mask bit per pixel) with its own far depth that replaces the tile depth once the mask is full. instance bounds are
+// then tested against the tile depths, four tiles per SSE compare. everything is in clip space with the gl depth range
+// of glm::perspective, front faces of occluders are counter clockwise like the dx12 pipelines
+class OcclusionCuller {
+public:
+    static const uint32_t TileWidth = 8;
+    static const uint32_t TileHeight = 4;
+
+    struct Instance {
+        glm::mat4 world = glm::mat4(1.0f);
+        // object space bounds
+        glm::vec3 boundsMin, boundsMax;
+        // occluder mesh drawn for this instance, -1 if it only gets tested
+        int32_t occluder = -1;
+    };
+
+    struct Stats {
+        uint32_t instances = 0;
+        uint32_t frustumCulled = 0;
+        uint32_t occluded = 0;
+        // occluded by the first pass buffer already
+        uint32_t occludedFirstPass = 0;
+        uint32_t occludersDrawn = 0;
+        uint64_t occluderTriangles = 0;
+        // milliseconds
+        double rasterizeTime = 0.0;
+        double testTime = 0.0;
+
+        float culledPercent() const {
+            return instances > 0 ? 100.0f * (frustumCulled + occluded) / instances : 0.0f;
+        }
+    };
+
+    // 320x180 covers 16:9 views, the size is rounded up to whole tiles
+    explicit OcclusionCuller(uint32_t width = 320, uint32_t height = 180);
+
+    uint32_t width() const { return mWidth; }
+
+    uint32_t height() const { return mHeight; }
+
+    // the mesh is copied, returns the index for Instance::occluder. simplified meshes make better occluders
+    int32_t addOccluder(const glm::vec3 *positions, size_t numPositions, const uint32_t *indices, size_t numIndices);
+
+    // visible[i] is set to 1 for instances that may be visible. the first pass rasterizes the occluders of
+    // instances visible in the previous call and tests everything against that buffer, a second pass adds the
+    // occluders that became visible and retests what the first pass culled. instances should keep their order
+    // between frames so the previous visibility lines up, a changed count resets it
+    void cull(const glm::mat4 &viewProj, const std::vector<Instance> &instances, std::vector<uint8_t> &visible);
+
+    const Stats &stats() const { return mStats; }
+
+    // low level access for callers with their own passes
+    void clear();
+    void drawOccluders(const glm::mat4 &viewProj, const std::vector<Instance> &instances,
+                       const std::vector<uint32_t> &list);
+
+    enum class Result { Visible, Occluded, OutsideFrustum };
+    Result testBounds(const glm::mat4 &worldViewProj, const glm::vec3 &boundsMin, const glm::vec3 &boundsMax) const;
+
+    // conservative far depth of a tile in [0, 1]
+    float tileDepth(uint32_t tileX, uint32_t tileY) const { return mTileZ[tileY * mTilesX + tileX]; }
+
+private:
+    struct Triangle {
+        // edge functions in pixel units, e(x, y) = a * x + b * y + c is >= 0 inside
+        float a[3], b[3], c[3];
+        // depth plane in pixel units and the farthest vertex depth
+        float za, zb, zc;
+        float maxZ;
+        int32_t minX, minY, maxX, maxY;
+    };
+
+    void setupTriangles(const glm::mat4 &worldViewProj, uint32_t occluder, std::vector<Triangle> &triangles) const;
+
+    void rasterizeTriangle(const Triangle &tri, uint32_t firstTileY, uint32_t lastTileY);
+
+    void mergeTile(uint32_t tile, uint32_t coverage, float z);
+
+    uint32_t mWidth, mHeight;
+    uint32_t mTilesX, mTilesY;
+
+    struct OccluderMesh {
+        std::vector<glm::vec3> positions;
+        std::vector<uint32_t> indices;
+    };
+    std::vector<OccluderMesh> mOccluders;
+
+    // per tile: far depth of the whole tile, far depth and coverage of the working layer
+    std::vector<float> mTileZ;
+    std::vector<float> mLayerZ;
+    std::vector<uint32_t> mLayerMask;
+
+    std::vector<std::vector<Triangle>> mTriangles;
+    std::vector<Result> mResults;
+    std::vector<uint8_t> mPrevious;
+    Stats mStats;
+};
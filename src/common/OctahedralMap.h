@@ -0,0 +1,263 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <glm.hpp>
+
+#include "src/common/Image.h"
+#include "src/common/CubeMap.h"
+#include "src/common/Parallel.h"
+
+// single 2D texture parameterization of the sphere (y up), every mip level keeps its own border of
+// mirrored texels so bilinear taps never cross the octahedral seams. sizes are powers of two and every level is half
+// the one above, the chain a gpu texture of the same size has. the interior of a level is its size less the border
+class OctahedralMap {
+public:
+    struct ErrorStats {
+        float rmse;
+        float maxError;
+        float relativeRmse;
+    };
+
+    OctahedralMap() : mSize(0), mLevels(0), mBorder(0) {}
+
+    OctahedralMap(uint32_t size, uint32_t levels = 0, uint32_t border = 1) : mSize(size), mBorder(border) {
+        if (size == 0 || (size & (size - 1)) != 0) {
+            throw std::runtime_error("OctahedralMap size must be a power of two");
+        }
+        const uint32_t available = maxLevels(size, border);
+        mLevels = (levels > 0) ? std::min(levels, available) : available;
+        if (mLevels == 0) {
+            throw std::runtime_error("OctahedralMap size is too small for its border");
+        }
+        mData.resize(mLevels);
+        for (uint32_t level = 0; level < mLevels; ++level) {
+            mData[level].resize(static_cast<size_t>(this->size(level)) * this->size(level));
+        }
+    }
+
+    // the size whose interior comes closest to the detail of a cube face of faceSize, a power of two for one. it has
+    // 2/3 of the texels of the cube
+    static uint32_t sizeForCubeFace(uint32_t faceSize) { return 2 * faceSize; }
+
+    // levels down to the smallest one that has an interior texel pair left inside its border
+    static uint32_t maxLevels(uint32_t size, uint32_t border = 1) {
+        uint32_t levels = 0;
+        while ((size >> levels) >= 2 * border + 2) {
+            ++levels;
+        }
+        return levels;
+    }
+
+    uint32_t size(uint32_t level = 0) const { return mSize >> level; }
+
+    uint32_t interiorSize(uint32_t level = 0) const { return size(level) - 2 * mBorder; }
+
+    uint32_t levels() const { return mLevels; }
+
+    uint32_t border() const { return mBorder; }
+
+    glm::vec4 *level(uint32_t level) { return mData[level].data(); }
+
+    const glm::vec4 *level(uint32_t level) const { return mData[level].data(); }
+
+    size_t byteSize(size_t bytesPerTexel = 8) const {
+        size_t texels = 0;
+        for (const std::vector<glm::vec4> &level : mData) {
+            texels += level.size();
+        }
+        return texels * bytesPerTexel;
+    }
+
+    static glm::vec2 encode(const glm::vec3 &dir) {
+        glm::vec3 n = dir / (std::abs(dir.x) + std::abs(dir.y) + std::abs(dir.z));
+        glm::vec2 p{n.x, n.z};
+        if (n.y < 0.0f) {
+            p = (1.0f - glm::abs(glm::vec2{p.y, p.x})) * signNotZero(p);
+        }
+        return p * 0.5f + 0.5f;
+    }
+
+    static glm::vec3 decode(const glm::vec2 &uv) {
+        glm::vec2 p = uv * 2.0f - 1.0f;
+        glm::vec3 n{p.x, 1.0f - std::abs(p.x) - std::abs(p.y), p.y};
+        if (n.y < 0.0f) {
+            glm::vec2 xz = (1.0f - glm::abs(glm::vec2{n.z, n.x})) * signNotZero(glm::vec2{n.x, n.z});
+            n.x = xz.x;
+            n.z = xz.y;
+        }
+        return glm::normalize(n);
+    }
+
+    // mirrors uv outside [0, 1]^2 back across the edge it crossed, neighbours across a seam stay neighbours
+    static glm::vec2 fold(glm::vec2 uv) {
+        if (uv.x < 0.0f) uv = {-uv.x, 1.0f - uv.y};
+        if (uv.x > 1.0f) uv = {2.0f - uv.x, 1.0f - uv.y};
+        if (uv.y < 0.0f) uv = {1.0f - uv.x, -uv.y};
+        if (uv.y > 1.0f) uv = {1.0f - uv.x, 2.0f - uv.y};
+        return uv;
+    }
+
+    glm::vec4 sampleUV(const glm::vec2 &uv, uint32_t level) const {
+        const int levelSize = static_cast<int>(size(level));
+        const glm::vec4 *texels = mData[level].data();
+
+        float x = mBorder + uv.x * interiorSize(level) - 0.5f;
+        float y = mBorder + uv.y * interiorSize(level) - 0.5f;
+        int x0 = static_cast<int>(std::floor(x));
+        int y0 = static_cast<int>(std::floor(y));
+        float fx = x - x0;
+        float fy = y - y0;
+
+        auto fetch = [&](int px, int py) {
+            px = glm::clamp(px, 0, levelSize - 1);
+            py = glm::clamp(py, 0, levelSize - 1);
+            return texels[py * levelSize + px];
+        };
+        glm::vec4 top = glm::mix(fetch(x0, y0), fetch(x0 + 1, y0), fx);
+        glm::vec4 bottom = glm::mix(fetch(x0, y0 + 1), fetch(x0 + 1, y0 + 1), fx);
+        return glm::mix(top, bottom, fy);
+    }
+
+    glm::vec4 sample(const glm::vec3 &dir, float lod = 0.0f) const {
+        glm::vec2 uv = encode(dir);
+        lod = glm::clamp(lod, 0.0f, float(mLevels - 1));
+        uint32_t level = static_cast<uint32_t>(lod);
+        float frac = lod - level;
+        glm::vec4 color = sampleUV(uv, level);
+        if (frac > 0.0f && level + 1 < mLevels) {
+            color = glm::mix(color, sampleUV(uv, level + 1), frac);
+        }
+        return color;
+    }
+
+    // copies mirrored interior texels into the border ring of a level
+    void fillBorders(uint32_t level) {
+        const int n = static_cast<int>(interiorSize(level));
+        const int b = static_cast<int>(mBorder);
+        const int levelSize = static_cast<int>(size(level));
+        glm::vec4 *texels = mData[level].data();
+
+        for (int y = 0; y < levelSize; ++y) {
+            for (int x = 0; x < levelSize; ++x) {
+                int ix = x - b, iy = y - b;
+                if (ix >= 0 && ix < n && iy >= 0 && iy < n) {
+                    continue;
+                }
+                if (ix < 0) { ix = -1 - ix; iy = n - 1 - iy; }
+                if (ix >= n) { ix = 2 * n - 1 - ix; iy = n - 1 - iy; }
+                if (iy < 0) { iy = -1 - iy; ix = n - 1 - ix; }
+                if (iy >= n) { iy = 2 * n - 1 - iy; ix = n - 1 - ix; }
+                ix = glm::clamp(ix, 0, n - 1);
+                iy = glm::clamp(iy, 0, n - 1);
+                texels[y * levelSize + x] = texels[(iy + b) * levelSize + (ix + b)];
+            }
+        }
+    }
+
+    // each texel averages four bilinear taps of the previous level, taps that leave the interior are folded
+    void generateMipmaps() {
+        for (uint32_t level = 1; level < mLevels; ++level) {
+            const uint32_t n = interiorSize(level);
+            const uint32_t levelSize = size(level);
+            const float offset = 0.25f / n;
+            glm::vec4 *texels = mData[level].data();
+
+            parallelFor(0, n, [&](uint32_t y) {
+                for (uint32_t x = 0; x < n; ++x) {
+                    glm::vec2 uv{(x + 0.5f) / n, (y + 0.5f) / n};
+                    glm::vec4 color = sampleUV(fold(uv + glm::vec2{-offset, -offset}), level - 1) +
+                                      sampleUV(fold(uv + glm::vec2{ offset, -offset}), level - 1) +
+                                      sampleUV(fold(uv + glm::vec2{-offset,  offset}), level - 1) +
+                                      sampleUV(fold(uv + glm::vec2{ offset,  offset}), level - 1);
+                    texels[(y + mBorder) * levelSize + (x + mBorder)] = 0.25f * color;
+                }
+            });
+            fillBorders(level);
+        }
+    }
+
+    // interior texels of a level from source(dir), then its border
+    template <typename Source>
+    void fillLevel(uint32_t level, Source &&source) {
+        const uint32_t n = interiorSize(level);
+        const uint32_t levelSize = size(level);
+        glm::vec4 *texels = mData[level].data();
+
+        parallelFor(0, n, [&](uint32_t y) {
+            for (uint32_t x = 0; x < n; ++x) {
+                glm::vec3 dir = decode({(x + 0.5f) / n, (y + 0.5f) / n});
+                texels[(y + mBorder) * levelSize + (x + mBorder)] = source(dir);
+            }
+        });
+        fillBorders(level);
+    }
+
+    template <typename Source>
+    static OctahedralMap fromSource(uint32_t size, uint32_t levels, Source &&source) {
+        OctahedralMap map(size, levels);
+        map.fillLevel(0, source);
+        map.generateMipmaps();
+        return map;
+    }
+
+    static OctahedralMap fromEquirect(const Image &image, uint32_t size, uint32_t levels = 0) {
+        if (!image.isHDR() || image.channels() != 4) {
+            throw std::runtime_error("OctahedralMap::fromEquirect expects an rgba float image");
+        }
+        return fromSource(size, levels, [&](const glm::vec3 &dir) { return sampleEquirect(image, dir); });
+    }
+
+    static OctahedralMap fromCube(const CubeMap &cube, uint32_t size, uint32_t levels = 0) {
+        return fromSource(size, levels, [&](const glm::vec3 &dir) { return cube.sampleLevel(dir, 0); });
+    }
+
+    // every level sampled from the same level of the cube, keeps a prefiltered chain. cube2octahedral.hlsl does the
+    // same on the gpu
+    static OctahedralMap fromCubeLevels(const CubeMap &cube, uint32_t size, uint32_t levels = 0) {
+        OctahedralMap map(size, std::min(levels > 0 ? levels : cube.levels(), cube.levels()));
+        for (uint32_t level = 0; level < map.levels(); ++level) {
+            map.fillLevel(level, [&](const glm::vec3 &dir) { return cube.sampleLevel(dir, level); });
+        }
+        return map;
+    }
+
+    // rgb error of this map against the cube path over a fibonacci sphere of directions
+    static ErrorStats compare(
+        const OctahedralMap &octahedral, const CubeMap &cube, float lod = 0.0f, uint32_t numDirections = 1 << 16
+    ) {
+        const float goldenAngle = PI * (3.0f - std::sqrt(5.0f));
+        double sumSq = 0.0, refSq = 0.0;
+        float maxError = 0.0f;
+
+        for (uint32_t i = 0; i < numDirections; ++i) {
+            float y = 1.0f - 2.0f * (i + 0.5f) / numDirections;
+            float r = std::sqrt(std::max(0.0f, 1.0f - y * y));
+            float phi = goldenAngle * i;
+            glm::vec3 dir{r * std::cos(phi), y, r * std::sin(phi)};
+
+            glm::vec3 expected = cube.sample(dir, lod);
+            glm::vec3 actual = octahedral.sample(dir, lod);
+            glm::vec3 diff = actual - expected;
+
+            sumSq += glm::dot(diff, diff) / 3.0;
+            refSq += glm::dot(expected, expected) / 3.0;
+            maxError = std::max(maxError, glm::max(std::abs(diff.x), glm::max(std::abs(diff.y), std::abs(diff.z))));
+        }
+
+        ErrorStats stats;
+        stats.rmse = static_cast<float>(std::sqrt(sumSq / numDirections));
+        stats.maxError = maxError;
+        stats.relativeRmse = refSq > 0.0 ? static_cast<float>(std::sqrt(sumSq / refSq)) : 0.0f;
+        return stats;
+    }
+
+private:
+    static glm::vec2 signNotZero(const glm::vec2 &v) {
+        return {v.x >= 0.0f ? 1.0f : -1.0f, v.y >= 0.0f ? 1.0f : -1.0f};
+    }
+
+    uint32_t mSize, mLevels, mBorder;
+    std::vector<std::vector<glm::vec4>> mData;
+};
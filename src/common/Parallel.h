@@ -0,0 +1,154 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// persistent worker pool shared by the cpu bakers and renderers
+class ThreadPool {
+public:
+    static ThreadPool &instance() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    uint32_t numThreads() const { return static_cast<uint32_t>(mWorkers.size()) + 1; }
+
+    // calls func(first, last) for chunks of [begin, end), the calling thread takes part in the work. when func throws,
+    // the chunks not started yet are skipped and the first exception is rethrown here once every thread is done
+    void run(uint32_t begin, uint32_t end, uint32_t grain, const std::function<void(uint32_t, uint32_t)> &func) {
+        if (begin >= end) {
+            return;
+        }
+        grain = grain > 0 ? grain : 1;
+        if (mWorkers.empty() || tInJob || end - begin <= grain) {
+            func(begin, end);
+            return;
+        }
+
+        std::lock_guard<std::mutex> jobLock(mJobMutex);
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mFunc = &func;
+            mEnd = end;
+            mGrain = grain;
+            mNext = begin;
+            mActive = static_cast<uint32_t>(mWorkers.size());
+            ++mGeneration;
+        }
+        mWakeup.notify_all();
+
+        tInJob = true;
+        work();
+        tInJob = false;
+
+        std::unique_lock<std::mutex> lock(mMutex);
+        mDone.wait(lock, [this] { return mActive == 0; });
+        mFunc = nullptr;
+        if (mError) {
+            std::exception_ptr error = mError;
+            mError = nullptr;
+            lock.unlock();
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    ThreadPool() {
+        uint32_t count = std::thread::hardware_concurrency();
+        for (uint32_t i = 1; i < count; ++i) {
+            mWorkers.emplace_back([this] { loop(); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mExit = true;
+        }
+        mWakeup.notify_all();
+        for (std::thread &worker : mWorkers) {
+            worker.join();
+        }
+    }
+
+    void loop() {
+        tInJob = true;
+        uint64_t generation = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mWakeup.wait(lock, [&] { return mExit || mGeneration != generation; });
+                if (mExit) {
+                    return;
+                }
+                generation = mGeneration;
+            }
+            work();
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                --mActive;
+            }
+            mDone.notify_one();
+        }
+    }
+
+    void work() {
+        while (true) {
+            uint32_t first = mNext.fetch_add(mGrain);
+            if (first >= mEnd) {
+                return;
+            }
+            uint32_t last = first + mGrain < mEnd ? first + mGrain : mEnd;
+            try {
+                (*mFunc)(first, last);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mMutex);
+                if (!mError) {
+                    mError = std::current_exception();
+                }
+                mNext.store(mEnd);
+            }
+        }
+    }
+
+    std::vector<std::thread> mWorkers;
+    std::mutex mJobMutex;
+    std::mutex mMutex;
+    std::condition_variable mWakeup;
+    std::condition_variable mDone;
+
+    const std::function<void(uint32_t, uint32_t)> *mFunc = nullptr;
+    std::atomic<uint32_t> mNext{0};
+    uint32_t mEnd = 0;
+    uint32_t mGrain = 1;
+    uint32_t mActive = 0;
+    uint64_t mGeneration = 0;
+    // first exception of the running job
+    std::exception_ptr mError;
+    bool mExit = false;
+
+    // set on the workers and on a caller while it works on a job, nested calls from func then run inline
+    static inline thread_local bool tInJob = false;
+};
+
+// calls func(i) for every i in [begin, end) across the pool
+template <typename Func>
+void parallelFor(uint32_t begin, uint32_t end, Func &&func, uint32_t grain = 1) {
+    ThreadPool::instance().run(begin, end, grain, [&func](uint32_t first, uint32_t last) {
+        for (uint32_t i = first; i < last; ++i) {
+            func(i);
+        }
+    });
+}
+
+// calls func(first, last) on contiguous ranges of [begin, end)
+template <typename Func>
+void parallelForRange(uint32_t begin, uint32_t end, Func &&func, uint32_t grain = 1) {
+    ThreadPool::instance().run(begin, end, grain, [&func](uint32_t first, uint32_t last) { func(first, last); });
+}
@@ -0,0 +1,206 @@
+#include <immintrin.h>
+
+#include "src/common/PbrShading.h"
+#include "src/common/CpuFeatures.h"
+
+const float PbrShading::Fdielectric = 0.04f;
+
+namespace {
+    struct Vec3x8 {
+        __m256 x, y, z;
+    };
+
+    TARGET_AVX2 inline Vec3x8 load3(const float *x, const float *y, const float *z) {
+        return {_mm256_loadu_ps(x), _mm256_loadu_ps(y), _mm256_loadu_ps(z)};
+    }
+
+    TARGET_AVX2 inline Vec3x8 splat3(const glm::vec3 &v) {
+        return {_mm256_set1_ps(v.x), _mm256_set1_ps(v.y), _mm256_set1_ps(v.z)};
+    }
+
+    TARGET_AVX2 inline Vec3x8 add(const Vec3x8 &a, const Vec3x8 &b) {
+        return {_mm256_add_ps(a.x, b.x), _mm256_add_ps(a.y, b.y), _mm256_add_ps(a.z, b.z)};
+    }
+
+    TARGET_AVX2 inline Vec3x8 sub(const Vec3x8 &a, const Vec3x8 &b) {
+        return {_mm256_sub_ps(a.x, b.x), _mm256_sub_ps(a.y, b.y), _mm256_sub_ps(a.z, b.z)};
+    }
+
+    TARGET_AVX2 inline Vec3x8 mul(const Vec3x8 &a, const Vec3x8 &b) {
+        return {_mm256_mul_ps(a.x, b.x), _mm256_mul_ps(a.y, b.y), _mm256_mul_ps(a.z, b.z)};
+    }
+
+    TARGET_AVX2 inline Vec3x8 mul(const Vec3x8 &a, __m256 s) {
+        return {_mm256_mul_ps(a.x, s), _mm256_mul_ps(a.y, s), _mm256_mul_ps(a.z, s)};
+    }
+
+    // a * b + c
+    TARGET_AVX2 inline Vec3x8 madd(const Vec3x8 &a, const Vec3x8 &b, const Vec3x8 &c) {
+        return {_mm256_fmadd_ps(a.x, b.x, c.x), _mm256_fmadd_ps(a.y, b.y, c.y), _mm256_fmadd_ps(a.z, b.z, c.z)};
+    }
+
+    TARGET_AVX2 inline __m256 dot(const Vec3x8 &a, const Vec3x8 &b) {
+        return _mm256_fmadd_ps(a.x, b.x, _mm256_fmadd_ps(a.y, b.y, _mm256_mul_ps(a.z, b.z)));
+    }
+
+    // full precision sqrt and divide, rsqrt would drift from the scalar reference by ~1e-4
+    TARGET_AVX2 inline Vec3x8 normalize(const Vec3x8 &v) {
+        __m256 invLength = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(dot(v, v)));
+        return mul(v, invLength);
+    }
+
+    TARGET_AVX2 inline __m256 saturate(__m256 v) {
+        return _mm256_min_ps(_mm256_max_ps(v, _mm256_setzero_ps()), _mm256_set1_ps(1.0f));
+    }
+
+    // F0 + (1 - F0) * (1 - cosTheta)^5
+    TARGET_AVX2 inline Vec3x8 fresnelSchlick8(__m256 cosTheta, const Vec3x8 &F0) {
+        const __m256 one = _mm256_set1_ps(1.0f);
+        __m256 x = saturate(_mm256_sub_ps(one, cosTheta));
+        __m256 x2 = _mm256_mul_ps(x, x);
+        __m256 x5 = _mm256_mul_ps(_mm256_mul_ps(x2, x2), x);
+        return {_mm256_fmadd_ps(_mm256_sub_ps(one, F0.x), x5, F0.x),
+                _mm256_fmadd_ps(_mm256_sub_ps(one, F0.y), x5, F0.y),
+                _mm256_fmadd_ps(_mm256_sub_ps(one, F0.z), x5, F0.z)};
+    }
+
+    TARGET_AVX2 inline __m256 geometrySchlickGGX8(__m256 NdotV, __m256 k) {
+        __m256 denom = _mm256_fmadd_ps(NdotV, _mm256_sub_ps(_mm256_set1_ps(1.0f), k), k);
+        return _mm256_div_ps(NdotV, denom);
+    }
+}
+
+PbrShading::Isa PbrShading::bestIsa() {
+    return CpuFeatures::get().avx2 ? Isa::AVX2 : Isa::Scalar;
+}
+
+void PbrShading::shade(const PbrBatch &batch, uint32_t count, const PbrScene &scene, PbrBatchResult &result, Isa isa) {
+    count = std::min(count, PbrBatch::Width);
+    if (isa == Isa::AVX2 && CpuFeatures::get().avx2) {
+        shadeAVX2(batch, count, scene, result);
+        return;
+    }
+    for (uint32_t lane = 0; lane < count; ++lane) {
+        glm::vec3 color = shadeScalar(batch.get(lane), scene);
+        result.r[lane] = color.r;
+        result.g[lane] = color.g;
+        result.b[lane] = color.b;
+    }
+}
+
+TARGET_AVX2 void PbrShading::shadeAVX2(const PbrBatch &batch, uint32_t count, const PbrScene &scene,
+                                       PbrBatchResult &result) {
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+
+    const Vec3x8 P = load3(batch.positionX, batch.positionY, batch.positionZ);
+    const Vec3x8 N = load3(batch.normalX, batch.normalY, batch.normalZ);
+    const Vec3x8 albedo = load3(batch.albedoR, batch.albedoG, batch.albedoB);
+    const __m256 metalness = _mm256_loadu_ps(batch.metalness);
+    const __m256 roughness = _mm256_loadu_ps(batch.roughness);
+    const __m256 dielectric = _mm256_set1_ps(Fdielectric);
+
+    const Vec3x8 V = normalize(sub(splat3(scene.cameraPos), P));
+    const __m256 NdotVRaw = dot(N, V);
+    const __m256 NdotV = _mm256_max_ps(NdotVRaw, zero);
+    // reflect(-V, N) = 2 * dot(N, V) * N - V
+    const Vec3x8 R = sub(mul(N, _mm256_add_ps(NdotVRaw, NdotVRaw)), V);
+
+    // mix(Fdielectric, albedo, metalness)
+    const Vec3x8 F0 = {_mm256_fmadd_ps(_mm256_sub_ps(albedo.x, dielectric), metalness, dielectric),
+                       _mm256_fmadd_ps(_mm256_sub_ps(albedo.y, dielectric), metalness, dielectric),
+                       _mm256_fmadd_ps(_mm256_sub_ps(albedo.z, dielectric), metalness, dielectric)};
+    const __m256 diffuseWeight = _mm256_sub_ps(one, metalness);
+
+    const __m256 a = _mm256_mul_ps(roughness, roughness);
+    const __m256 a2 = _mm256_mul_ps(a, a);
+    const __m256 r1 = _mm256_add_ps(roughness, one);
+    const __m256 k = _mm256_mul_ps(_mm256_mul_ps(r1, r1), _mm256_set1_ps(1.0f / 8.0f));
+    const __m256 geometryV = geometrySchlickGGX8(NdotV, k);
+
+    Vec3x8 Lo = {zero, zero, zero};
+    for (uint32_t i = 0; i < scene.numLights; ++i) {
+        const ClusterLight &light = scene.lights[i];
+        const Vec3x8 toLight = sub(splat3(light.position), P);
+        const __m256 distanceSq = dot(toLight, toLight);
+        const __m256 invDistance = _mm256_div_ps(one, _mm256_sqrt_ps(_mm256_max_ps(distanceSq, _mm256_set1_ps(1e-8f))));
+        const Vec3x8 L = mul(toLight, invDistance);
+        const Vec3x8 H = normalize(add(V, L));
+
+        // lightAttenuation
+        __m256 ratio = _mm256_div_ps(distanceSq, _mm256_set1_ps(light.range * light.range));
+        __m256 window = saturate(_mm256_fnmadd_ps(ratio, ratio, one));
+        __m256 attenuation = _mm256_div_ps(_mm256_mul_ps(window, window),
+                                           _mm256_max_ps(distanceSq, _mm256_set1_ps(1e-4f)));
+        __m256 cosAxis = _mm256_sub_ps(zero, dot(L, splat3(light.direction)));
+        __m256 spot = saturate(_mm256_div_ps(_mm256_sub_ps(cosAxis, _mm256_set1_ps(light.cosOuter)),
+                                             _mm256_set1_ps(std::max(light.cosInner - light.cosOuter, 1e-4f))));
+        attenuation = _mm256_mul_ps(attenuation, _mm256_mul_ps(spot, spot));
+
+        __m256 NdotH = _mm256_max_ps(dot(N, H), zero);
+        __m256 NdotL = _mm256_max_ps(dot(N, L), zero);
+        __m256 HdotV = _mm256_max_ps(dot(H, V), zero);
+
+        // DistributionGGX
+        __m256 denom = _mm256_fmadd_ps(_mm256_mul_ps(NdotH, NdotH), _mm256_sub_ps(a2, one), one);
+        __m256 D = _mm256_div_ps(a2, _mm256_mul_ps(_mm256_set1_ps(PI), _mm256_mul_ps(denom, denom)));
+        __m256 G = _mm256_mul_ps(geometryV, geometrySchlickGGX8(NdotL, k));
+        Vec3x8 F = fresnelSchlick8(HdotV, F0);
+
+        __m256 specularDenom = _mm256_fmadd_ps(_mm256_mul_ps(_mm256_set1_ps(4.0f), NdotV), NdotL,
+                                               _mm256_set1_ps(0.0001f));
+        __m256 specularScale = _mm256_div_ps(_mm256_mul_ps(D, G), specularDenom);
+        Vec3x8 specular = mul(F, specularScale);
+        Vec3x8 kD = mul(sub(splat3(glm::vec3{1.0f}), F), diffuseWeight);
+
+        Vec3x8 radiance = mul(splat3(light.radiance), _mm256_mul_ps(attenuation, NdotL));
+        Lo = madd(madd(mul(kD, albedo), splat3(glm::vec3{1.0f / PI}), specular), radiance, Lo);
+    }
+
+    const Vec3x8 F = fresnelSchlick8(NdotV, F0);
+    const Vec3x8 kD = mul(sub(splat3(glm::vec3{1.0f}), F), diffuseWeight);
+
+    // environment reads go through the eight lane CpuTexture lookups
+    alignas(32) float nx[8], ny[8], nz[8], rx[8], ry[8], rz[8], nv[8], rough[8], lod[8];
+    _mm256_store_ps(nx, N.x);
+    _mm256_store_ps(ny, N.y);
+    _mm256_store_ps(nz, N.z);
+    _mm256_store_ps(rx, R.x);
+    _mm256_store_ps(ry, R.y);
+    _mm256_store_ps(rz, R.z);
+    _mm256_store_ps(nv, NdotV);
+    _mm256_store_ps(rough, roughness);
+    _mm256_store_ps(lod, zero);
+
+    SampleBatch irr = {}, pref = {}, brdf = {};
+    if (scene.irradiance) {
+        scene.irradiance->sampleCube8(nx, ny, nz, lod, CpuSampler{}, irr);
+    }
+    if (scene.brdfLut) {
+        scene.brdfLut->sample8(nv, rough, lod, brdfSampler(), brdf);
+    } else {
+        for (uint32_t lane = 0; lane < count; ++lane) {
+            glm::vec2 approx = BrdfLut::approximate(nv[lane], rough[lane]);
+            brdf.r[lane] = approx.x;
+            brdf.g[lane] = approx.y;
+        }
+    }
+    if (scene.prefilter) {
+        _mm256_store_ps(lod, _mm256_mul_ps(roughness, _mm256_set1_ps(float(scene.prefilter->levels()) - 1.0f)));
+        scene.prefilter->sampleCube8(rx, ry, rz, lod, CpuSampler{}, pref);
+    }
+
+    const Vec3x8 irradiance = {_mm256_loadu_ps(irr.r), _mm256_loadu_ps(irr.g), _mm256_loadu_ps(irr.b)};
+    const Vec3x8 prefiltered = {_mm256_loadu_ps(pref.r), _mm256_loadu_ps(pref.g), _mm256_loadu_ps(pref.b)};
+    const __m256 scale = _mm256_loadu_ps(brdf.r);
+    const __m256 bias = _mm256_loadu_ps(brdf.g);
+
+    // kD * irradiance * albedo + prefilteredColor * (F * brdf.x + brdf.y) + Lo
+    Vec3x8 specularWeight = {_mm256_fmadd_ps(F.x, scale, bias), _mm256_fmadd_ps(F.y, scale, bias),
+                             _mm256_fmadd_ps(F.z, scale, bias)};
+    Vec3x8 color = madd(mul(kD, irradiance), albedo, madd(prefiltered, specularWeight, Lo));
+
+    _mm256_storeu_ps(result.r, color.x);
+    _mm256_storeu_ps(result.g, color.y);
+    _mm256_storeu_ps(result.b, color.z);
+}
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <glm.hpp>
+
+#include "src/common/BrdfLut.h"
+#include "src/common/CpuTexture.h"
+#include "src/common/Sampling.h"
+#include "src/common/LightClusters.h"
+
+// the Cook-Torrance model of pbr.hlsl on the cpu: point and spot lights plus split-sum image based ambient.
+// shadeScalar() is the reference for a single pixel, shade() runs eight pixels per call on AVX2 when the cpu has it
+
+// everything main_ps reads from constant buffers and environment textures. every light shades every pixel, there are
+// no clusters on the cpu
+struct PbrScene {
+    const ClusterLight *lights = nullptr;
+    uint32_t numLights = 0;
+    glm::vec3 cameraPos{0.0f};
+
+    const CpuTexture *irradiance = nullptr;
+    const CpuTexture *prefilter = nullptr;
+    // sampled with clamp addressing, null selects EnvBRDFApprox like BRDF_APPROX
+    const CpuTexture *brdfLut = nullptr;
+};
+
+// material inputs after texture sampling, N is the normalized normal mapped normal
+struct PbrSurface {
+    glm::vec3 position;
+    glm::vec3 N;
+    glm::vec3 albedo;
+    float metalness;
+    float roughness;
+};
+
+// eight surfaces in SoA layout
+struct PbrBatch {
+    static const uint32_t Width = 8;
+
+    float positionX[Width], positionY[Width], positionZ[Width];
+    float normalX[Width], normalY[Width], normalZ[Width];
+    float albedoR[Width], albedoG[Width], albedoB[Width];
+    float metalness[Width];
+    float roughness[Width];
+
+    void set(uint32_t lane, const PbrSurface &surface) {
+        positionX[lane] = surface.position.x;
+        positionY[lane] = surface.position.y;
+        positionZ[lane] = surface.position.z;
+        normalX[lane] = surface.N.x;
+        normalY[lane] = surface.N.y;
+        normalZ[lane] = surface.N.z;
+        albedoR[lane] = surface.albedo.r;
+        albedoG[lane] = surface.albedo.g;
+        albedoB[lane] = surface.albedo.b;
+        metalness[lane] = surface.metalness;
+        roughness[lane] = surface.roughness;
+    }
+
+    PbrSurface get(uint32_t lane) const {
+        return {{positionX[lane], positionY[lane], positionZ[lane]}, {normalX[lane], normalY[lane], normalZ[lane]},
+                {albedoR[lane], albedoG[lane], albedoB[lane]}, metalness[lane], roughness[lane]};
+    }
+};
+
+struct PbrBatchResult {
+    float r[PbrBatch::Width], g[PbrBatch::Width], b[PbrBatch::Width];
+
+    glm::vec3 get(uint32_t lane) const { return {r[lane], g[lane], b[lane]}; }
+};
+
+class PbrShading {
+public:
+    enum class Isa { Scalar, AVX2 };
+
+    static const float Fdielectric;
+
+    static Isa bestIsa();
+
+    static const char *isaName(Isa isa) { return isa == Isa::AVX2 ? "avx2" : "scalar"; }
+
+    static float distributionGGX(const glm::vec3 &N, const glm::vec3 &H, float roughness) {
+        float a = roughness * roughness;
+        float a2 = a * a;
+        float NdotH = std::max(glm::dot(N, H), 0.0f);
+        float denom = NdotH * NdotH * (a2 - 1.0f) + 1.0f;
+        return a2 / (PI * denom * denom);
+    }
+
+    static float geometrySchlickGGX(float NdotV, float roughness) {
+        float r = roughness + 1.0f;
+        float k = (r * r) / 8.0f;
+        return NdotV / (NdotV * (1.0f - k) + k);
+    }
+
+    static float geometrySmith(const glm::vec3 &N, const glm::vec3 &V, const glm::vec3 &L, float roughness) {
+        float NdotV = std::max(glm::dot(N, V), 0.0f);
+        float NdotL = std::max(glm::dot(N, L), 0.0f);
+        return geometrySchlickGGX(NdotV, roughness) * geometrySchlickGGX(NdotL, roughness);
+    }
+
+    static glm::vec3 fresnelSchlick(float cosTheta, const glm::vec3 &F0) {
+        float x = glm::clamp(1.0f - cosTheta, 0.0f, 1.0f);
+        float x2 = x * x;
+        return F0 + (1.0f - F0) * (x2 * x2 * x);
+    }
+
+    // windowed inverse square falloff times the spot factor of main_ps, L is the normalized direction to the light
+    static float lightAttenuation(const ClusterLight &light, float distanceSq, const glm::vec3 &L) {
+        float ratio = distanceSq / (light.range * light.range);
+        float window = glm::clamp(1.0f - ratio * ratio, 0.0f, 1.0f);
+        float attenuation = window * window / std::max(distanceSq, 1e-4f);
+        float spot = glm::clamp((glm::dot(-L, light.direction) - light.cosOuter) /
+                                std::max(light.cosInner - light.cosOuter, 1e-4f), 0.0f, 1.0f);
+        return attenuation * spot * spot;
+    }
+
+    static glm::vec3 shadeScalar(const PbrSurface &surface, const PbrScene &scene) {
+        const glm::vec3 &N = surface.N;
+        const glm::vec3 &albedo = surface.albedo;
+        glm::vec3 V = glm::normalize(scene.cameraPos - surface.position);
+        glm::vec3 R = glm::reflect(-V, N);
+        float NdotV = std::max(glm::dot(N, V), 0.0f);
+
+        glm::vec3 F0 = glm::mix(glm::vec3{Fdielectric}, albedo, surface.metalness);
+
+        glm::vec3 Lo{0.0f};
+        for (uint32_t i = 0; i < scene.numLights; ++i) {
+            const ClusterLight &light = scene.lights[i];
+            glm::vec3 toLight = light.position - surface.position;
+            float distanceSq = glm::dot(toLight, toLight);
+            glm::vec3 L = toLight * (1.0f / std::sqrt(std::max(distanceSq, 1e-8f)));
+            glm::vec3 H = glm::normalize(V + L);
+            glm::vec3 radiance = light.radiance * lightAttenuation(light, distanceSq, L);
+
+            float D = distributionGGX(N, H, surface.roughness);
+            float G = geometrySmith(N, V, L, surface.roughness);
+            glm::vec3 F = fresnelSchlick(std::max(glm::dot(H, V), 0.0f), F0);
+
+            float NdotL = std::max(glm::dot(N, L), 0.0f);
+            glm::vec3 specular = D * G * F / (4.0f * NdotV * NdotL + 0.0001f);
+            glm::vec3 kD = (1.0f - F) * (1.0f - surface.metalness);
+            Lo += (kD * albedo / PI + specular) * radiance * NdotL;
+        }
+
+        glm::vec3 F = fresnelSchlick(NdotV, F0);
+        glm::vec3 kD = (1.0f - F) * (1.0f - surface.metalness);
+        glm::vec3 irradiance, prefilteredColor;
+        glm::vec2 brdf;
+        sampleEnvironment(scene, N, R, NdotV, surface.roughness, irradiance, prefilteredColor, brdf);
+
+        glm::vec3 specular = prefilteredColor * (F * brdf.x + brdf.y);
+        return kD * irradiance * albedo + specular + Lo;
+    }
+
+    // shades the first count (at most 8) surfaces of a batch, lanes past count are left undefined
+    static void shade(const PbrBatch &batch, uint32_t count, const PbrScene &scene, PbrBatchResult &result,
+                      Isa isa = bestIsa());
+
+    // the texture reads of main_ps, shadeAVX2 does the same reads eight lanes at a time
+    static void sampleEnvironment(const PbrScene &scene, const glm::vec3 &N, const glm::vec3 &R, float NdotV,
+                                  float roughness, glm::vec3 &irradiance, glm::vec3 &prefilteredColor,
+                                  glm::vec2 &brdf) {
+        irradiance = scene.irradiance ? glm::vec3{scene.irradiance->sampleCube(N, 0.0f)} : glm::vec3{0.0f};
+        prefilteredColor = glm::vec3{0.0f};
+        if (scene.prefilter) {
+            // PrefilterLod of pbr.hlsl, level l holds roughness l / (levels - 1)
+            const float lod = roughness * (float(scene.prefilter->levels()) - 1.0f);
+            prefilteredColor = glm::vec3{scene.prefilter->sampleCube(R, lod)};
+        }
+        brdf = BrdfLut::approximate(NdotV, roughness);
+        if (scene.brdfLut) {
+            brdf = glm::vec2{scene.brdfLut->sample({NdotV, roughness}, 0.0f, brdfSampler())};
+        }
+    }
+
+    static CpuSampler brdfSampler() { return {AddressMode::Clamp}; }
+
+private:
+    static void shadeAVX2(const PbrBatch &batch, uint32_t count, const PbrScene &scene, PbrBatchResult &result);
+};
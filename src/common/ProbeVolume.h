@@ -0,0 +1,245 @@
+#pragma once
+
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <glm.hpp>
+
+#include "src/common/CubeMap.h"
+#include "src/common/Sampling.h"
+#include "src/common/Parallel.h"
+#include "src/common/SphericalHarmonics.h"
+
+// regular grid of SH irradiance probes over an axis aligned box. the baker projects the environment seen from every
+// probe into SH, with rays blocked by a voxelized copy of the scene geometry. coefficients are stored as SoA planes:
+// plane k holds packed vector k of every probe in x, y, z order, the planes upload as one buffer of float4s
+class ProbeVolume {
+public:
+    static const uint32_t NumPlanes = SHL2::NumPackedVectors;
+
+    struct Settings {
+        uint32_t numDirections = 256;
+        // occlusion voxels per probe cell along each axis
+        uint32_t voxelsPerCell = 4;
+        // radiance of blocked rays, a crude stand-in for the light bounced by the occluder
+        glm::vec3 occludedRadiance{0.0f};
+    };
+
+    ProbeVolume() : mResolution(0), mVoxelResolution(0) {}
+
+    ProbeVolume(const glm::vec3 &boundsMin, const glm::vec3 &boundsMax, const glm::uvec3 &resolution)
+        : ProbeVolume(boundsMin, boundsMax, resolution, Settings{}) {}
+
+    ProbeVolume(const glm::vec3 &boundsMin, const glm::vec3 &boundsMax, const glm::uvec3 &resolution,
+                const Settings &settings)
+        : mBoundsMin(boundsMin), mBoundsMax(boundsMax), mResolution(glm::max(resolution, glm::uvec3{2})),
+          mSettings(settings) {
+        mVoxelResolution = (mResolution - 1u) * std::max(settings.voxelsPerCell, 1u);
+        mVoxelSize = (mBoundsMax - mBoundsMin) / glm::vec3{mVoxelResolution};
+        mOccupancy.assign(static_cast<size_t>(mVoxelResolution.x) * mVoxelResolution.y * mVoxelResolution.z, 0);
+        mPlanes.assign(NumPlanes * numProbes(), glm::vec4{0.0f});
+        mValid.assign(numProbes(), 1);
+    }
+
+    glm::uvec3 resolution() const { return mResolution; }
+
+    uint32_t numProbes() const { return mResolution.x * mResolution.y * mResolution.z; }
+
+    uint32_t probeIndex(uint32_t x, uint32_t y, uint32_t z) const {
+        return (z * mResolution.y + y) * mResolution.x + x;
+    }
+
+    glm::vec3 probePosition(uint32_t x, uint32_t y, uint32_t z) const {
+        return mBoundsMin + (mBoundsMax - mBoundsMin) * glm::vec3{x, y, z} / glm::vec3{mResolution - 1u};
+    }
+
+    // probes inside geometry see nothing useful and are skipped by sample()
+    bool isValid(uint32_t index) const { return mValid[index] != 0; }
+
+    const glm::vec4 *plane(uint32_t k) const { return mPlanes.data() + static_cast<size_t>(k) * numProbes(); }
+
+    const glm::vec4 *data() const { return mPlanes.data(); }
+
+    size_t byteSize() const { return mPlanes.size() * sizeof(glm::vec4); }
+
+    size_t planeByteSize() const { return static_cast<size_t>(numProbes()) * sizeof(glm::vec4); }
+
+    // marks the voxels touched by an indexed triangle list, positions are transformed by transform first
+    void addOccluder(const glm::vec3 *positions, const uint32_t *indices, size_t numIndices,
+                     const glm::mat4 &transform = glm::mat4{1.0f}) {
+        const float step = 0.5f * std::min(mVoxelSize.x, std::min(mVoxelSize.y, mVoxelSize.z));
+        for (size_t i = 0; i + 2 < numIndices; i += 3) {
+            glm::vec3 v0 = glm::vec3{transform * glm::vec4{positions[indices[i + 0]], 1.0f}};
+            glm::vec3 v1 = glm::vec3{transform * glm::vec4{positions[indices[i + 1]], 1.0f}};
+            glm::vec3 v2 = glm::vec3{transform * glm::vec4{positions[indices[i + 2]], 1.0f}};
+
+            // dense barycentric walk, half a voxel apart so no voxel the triangle crosses is skipped
+            float longest = std::max(glm::length(v1 - v0), std::max(glm::length(v2 - v1), glm::length(v0 - v2)));
+            uint32_t n = std::max(1u, static_cast<uint32_t>(std::ceil(longest / step)));
+            for (uint32_t a = 0; a <= n; ++a) {
+                for (uint32_t b = 0; a + b <= n; ++b) {
+                    glm::vec3 p = v0 + (v1 - v0) * (float(a) / n) + (v2 - v0) * (float(b) / n);
+                    glm::ivec3 voxel;
+                    if (voxelAt(p, voxel)) {
+                        mOccupancy[voxelIndex(voxel)] = 1;
+                    }
+                }
+            }
+        }
+    }
+
+    void bake(const CubeMap &env) {
+        const uint32_t numDirections = std::max(mSettings.numDirections, 1u);
+        const float weight = 4.0f * PI / numDirections;
+        // filtered lookup, each ray stands for weight steradians of the environment
+        const float texelSolidAngle = 4.0f * PI / (6.0f * env.size() * env.size());
+        const float lod = std::max(0.5f * std::log2(weight / texelSolidAngle), 0.0f);
+
+        std::vector<glm::vec3> directions(numDirections);
+        std::vector<glm::vec3> radiance(numDirections);
+        for (uint32_t i = 0; i < numDirections; ++i) {
+            Sample2D uv = sobol(i);
+            float z = 1.0f - 2.0f * uv.x;
+            float r = std::sqrt(std::max(0.0f, 1.0f - z * z));
+            directions[i] = {r * std::cos(TwoPI * uv.y), r * std::sin(TwoPI * uv.y), z};
+            radiance[i] = glm::vec3{env.sample(directions[i], lod)};
+        }
+
+        const float maxDistance = glm::length(mBoundsMax - mBoundsMin);
+        parallelFor(0, mResolution.y * mResolution.z, [&](uint32_t row) {
+            uint32_t y = row % mResolution.y;
+            uint32_t z = row / mResolution.y;
+            for (uint32_t x = 0; x < mResolution.x; ++x) {
+                uint32_t index = probeIndex(x, y, z);
+                glm::vec3 origin = probePosition(x, y, z);
+
+                glm::ivec3 voxel;
+                mValid[index] = !(voxelAt(origin, voxel) && mOccupancy[voxelIndex(voxel)]);
+
+                SHL2 sh;
+                for (uint32_t i = 0; i < numDirections; ++i) {
+                    bool blocked = occluded(origin, directions[i], maxDistance);
+                    sh.addSample(directions[i], blocked ? mSettings.occludedRadiance : radiance[i], weight);
+                }
+
+                glm::vec4 packed[NumPlanes];
+                sh.pack(packed);
+                for (uint32_t k = 0; k < NumPlanes; ++k) {
+                    mPlanes[static_cast<size_t>(k) * numProbes() + index] = packed[k];
+                }
+            }
+        });
+    }
+
+    // the 8 probes around a position with their trilinear weights. invalid probes get weight 0 and the rest are
+    // renormalized, when all 8 are invalid they keep their plain trilinear weights
+    struct Lookup {
+        uint32_t indices[8];
+        float weights[8];
+    };
+
+    Lookup lookup(const glm::vec3 &position) const {
+        glm::vec3 grid = (position - mBoundsMin) / (mBoundsMax - mBoundsMin) * glm::vec3{mResolution - 1u};
+        grid = glm::clamp(grid, glm::vec3{0.0f}, glm::vec3{mResolution - 1u});
+        glm::uvec3 base = glm::min(glm::uvec3{grid}, mResolution - 2u);
+        glm::vec3 f = grid - glm::vec3{base};
+
+        Lookup result;
+        float validWeight = 0.0f;
+        for (uint32_t corner = 0; corner < 8; ++corner) {
+            glm::uvec3 offset{corner & 1u, (corner >> 1) & 1u, (corner >> 2) & 1u};
+            glm::vec3 w3 = glm::mix(1.0f - f, f, glm::vec3{offset});
+            result.indices[corner] = probeIndex(base.x + offset.x, base.y + offset.y, base.z + offset.z);
+            result.weights[corner] = w3.x * w3.y * w3.z;
+            validWeight += isValid(result.indices[corner]) ? result.weights[corner] : 0.0f;
+        }
+        if (validWeight > 1e-6f) {
+            for (uint32_t corner = 0; corner < 8; ++corner) {
+                result.weights[corner] = isValid(result.indices[corner]) ? result.weights[corner] / validWeight : 0.0f;
+            }
+        }
+        return result;
+    }
+
+    // blend of the probes lookup() picks, what pbr.hlsl does with the uploaded planes
+    SHL2 sample(const glm::vec3 &position) const {
+        const Lookup probes = lookup(position);
+        glm::vec4 packed[NumPlanes] = {};
+        for (uint32_t corner = 0; corner < 8; ++corner) {
+            for (uint32_t k = 0; k < NumPlanes; ++k) {
+                packed[k] += plane(k)[probes.indices[corner]] * probes.weights[corner];
+            }
+        }
+        return SHL2::unpack(packed);
+    }
+
+    glm::vec3 irradiance(const glm::vec3 &position, const glm::vec3 &normal) const {
+        return sample(position).irradiance(normal);
+    }
+
+private:
+    bool voxelAt(const glm::vec3 &p, glm::ivec3 &voxel) const {
+        voxel = glm::ivec3{glm::floor((p - mBoundsMin) / mVoxelSize)};
+        voxel = glm::clamp(voxel, glm::ivec3{0}, glm::ivec3{mVoxelResolution} - 1);
+        glm::vec3 local = (p - mBoundsMin) / (mBoundsMax - mBoundsMin);
+        return glm::all(glm::greaterThanEqual(local, glm::vec3{0.0f})) &&
+               glm::all(glm::lessThanEqual(local, glm::vec3{1.0f}));
+    }
+
+    size_t voxelIndex(const glm::ivec3 &voxel) const {
+        return (static_cast<size_t>(voxel.z) * mVoxelResolution.y + voxel.y) * mVoxelResolution.x + voxel.x;
+    }
+
+    // 3D DDA (Amanatides and Woo) through the occupancy grid, the voxel holding the origin is skipped so probes
+    // that sit right on a surface still see the half space in front of it. rays that leave the box see the sky
+    bool occluded(const glm::vec3 &origin, const glm::vec3 &dir, float maxDistance) const {
+        glm::ivec3 voxel;
+        if (!voxelAt(origin, voxel)) {
+            return false;
+        }
+        glm::ivec3 stepDir;
+        glm::vec3 tMax, tDelta;
+        for (int axis = 0; axis < 3; ++axis) {
+            if (dir[axis] > 0.0f) {
+                stepDir[axis] = 1;
+                float boundary = mBoundsMin[axis] + (voxel[axis] + 1) * mVoxelSize[axis];
+                tMax[axis] = (boundary - origin[axis]) / dir[axis];
+                tDelta[axis] = mVoxelSize[axis] / dir[axis];
+            } else if (dir[axis] < 0.0f) {
+                stepDir[axis] = -1;
+                float boundary = mBoundsMin[axis] + voxel[axis] * mVoxelSize[axis];
+                tMax[axis] = (boundary - origin[axis]) / dir[axis];
+                tDelta[axis] = -mVoxelSize[axis] / dir[axis];
+            } else {
+                stepDir[axis] = 0;
+                tMax[axis] = INFINITY;
+                tDelta[axis] = INFINITY;
+            }
+        }
+
+        const glm::ivec3 voxelResolution{mVoxelResolution};
+        while (true) {
+            int axis = tMax.x < tMax.y ? (tMax.x < tMax.z ? 0 : 2) : (tMax.y < tMax.z ? 1 : 2);
+            if (tMax[axis] > maxDistance) {
+                return false;
+            }
+            voxel[axis] += stepDir[axis];
+            if (voxel[axis] < 0 || voxel[axis] >= voxelResolution[axis]) {
+                return false;
+            }
+            tMax[axis] += tDelta[axis];
+            if (mOccupancy[voxelIndex(voxel)]) {
+                return true;
+            }
+        }
+    }
+
+    glm::vec3 mBoundsMin, mBoundsMax;
+    glm::uvec3 mResolution, mVoxelResolution;
+    glm::vec3 mVoxelSize;
+    Settings mSettings;
+    std::vector<uint8_t> mOccupancy;
+    std::vector<uint8_t> mValid;
+    std::vector<glm::vec4> mPlanes;
+};
@@ -0,0 +1,80 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "src/common/RadixSort.h"
+#include "src/common/Parallel.h"
+
+void RadixSort::sort(std::vector<uint64_t> &keys, std::vector<uint32_t> &values) {
+    if (keys.size() != values.size()) {
+        throw std::runtime_error("Radix sort keys and values differ in size");
+    }
+    if (keys.size() > UINT32_MAX) {
+        throw std::runtime_error("Radix sort input too large");
+    }
+    const uint32_t count = static_cast<uint32_t>(keys.size());
+    const uint32_t numChunks = (count + ChunkSize - 1) / ChunkSize;
+    mKeys.resize(count);
+    mValues.resize(count);
+    mCounts.resize(size_t(numChunks) * Buckets);
+    mPasses = 0;
+
+    // bytes that are equal in all keys leave the order as it is
+    std::vector<uint64_t> chunkDiffering(numChunks, 0);
+    parallelFor(0, numChunks, [&](uint32_t chunk) {
+        const uint32_t last = std::min(count, (chunk + 1) * ChunkSize);
+        for (uint32_t i = chunk * ChunkSize; i < last; ++i) {
+            chunkDiffering[chunk] |= keys[i] ^ keys[0];
+        }
+    });
+    uint64_t differing = 0;
+    for (uint64_t chunk : chunkDiffering) {
+        differing |= chunk;
+    }
+
+    for (uint32_t shift = 0; shift < 64; shift += 8) {
+        if (((differing >> shift) & 0xff) == 0) {
+            continue;
+        }
+
+        // raw pointers, the stores below could alias anything captured by reference
+        const uint64_t *srcKeys = keys.data();
+        const uint32_t *srcValues = values.data();
+        uint64_t *dstKeys = mKeys.data();
+        uint32_t *dstValues = mValues.data();
+        uint32_t *chunkCounts = mCounts.data();
+
+        parallelFor(0, numChunks, [=](uint32_t chunk) {
+            uint32_t *counts = chunkCounts + size_t(chunk) * Buckets;
+            std::fill(counts, counts + Buckets, 0);
+            const uint32_t last = std::min(count, (chunk + 1) * ChunkSize);
+            for (uint32_t i = chunk * ChunkSize; i < last; ++i) {
+                ++counts[(srcKeys[i] >> shift) & 0xff];
+            }
+        });
+
+        // bucket major, chunk minor offsets keep equal keys in their order
+        uint32_t offset = 0;
+        for (uint32_t bucket = 0; bucket < Buckets; ++bucket) {
+            for (uint32_t chunk = 0; chunk < numChunks; ++chunk) {
+                uint32_t &slot = chunkCounts[size_t(chunk) * Buckets + bucket];
+                const uint32_t bucketCount = slot;
+                slot = offset;
+                offset += bucketCount;
+            }
+        }
+
+        parallelFor(0, numChunks, [=](uint32_t chunk) {
+            uint32_t *offsets = chunkCounts + size_t(chunk) * Buckets;
+            const uint32_t last = std::min(count, (chunk + 1) * ChunkSize);
+            for (uint32_t i = chunk * ChunkSize; i < last; ++i) {
+                const uint64_t key = srcKeys[i];
+                const uint32_t target = offsets[(key >> shift) & 0xff]++;
+                dstKeys[target] = key;
+                dstValues[target] = srcValues[i];
+            }
+        });
+        keys.swap(mKeys);
+        values.swap(mValues);
+        ++mPasses;
+    }
+}
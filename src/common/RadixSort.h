@@ -0,0 +1,25 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+// stable least significant digit radix sort of 64-bit keys with a 32-bit payload, one byte per pass. the input is
+// split into fixed chunks that count and scatter in parallel, passes where every key has the same byte are skipped
+class RadixSort {
+public:
+    // sorts keys ascending and moves values along, both have to be the same size
+    void sort(std::vector<uint64_t> &keys, std::vector<uint32_t> &values);
+
+    // passes that moved data in the last sort, at most 8
+    uint32_t passes() const { return mPasses; }
+
+private:
+    static const uint32_t ChunkSize = 1 << 16;
+    static const uint32_t Buckets = 256;
+
+    std::vector<uint64_t> mKeys;
+    std::vector<uint32_t> mValues;
+    // per chunk bucket counts, turned into write offsets
+    std::vector<uint32_t> mCounts;
+    uint32_t mPasses = 0;
+};
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+#include <unordered_map>
+
+// 32-bit reference into a Registry, 20 bits of slot index and 12 bits of generation. the generation changes every
+// time a slot is reused, so handles to removed entries stop resolving instead of aliasing whatever came next. the tag
+// keeps handles of different registries apart, a default constructed handle is invalid
+template <typename Tag>
+class Handle {
+public:
+    static const uint32_t IndexBits = 20;
+    static const uint32_t GenerationBits = 32 - IndexBits;
+
+    Handle() = default;
+
+    Handle(uint32_t index, uint32_t generation) : mValue(generation << IndexBits | index) {}
+
+    uint32_t index() const { return mValue & ((1u << IndexBits) - 1); }
+
+    uint32_t generation() const { return mValue >> IndexBits; }
+
+    uint32_t value() const { return mValue; }
+
+    explicit operator bool() const { return mValue != 0; }
+
+    bool operator==(const Handle &other) const { return mValue == other.mValue; }
+
+    bool operator!=(const Handle &other) const { return mValue != other.mValue; }
+
+private:
+    uint32_t mValue = 0;
+};
+
+using TextureHandle = Handle<struct TextureTag>;
+using MeshHandle = Handle<struct MeshTag>;
+using PipelineHandle = Handle<struct PipelineTag>;
+
+// named entries in dense slots, resolved by handle. names are only meant for setup, find() once and keep the handle,
+// get() is an index and a generation compare. removed slots are reused with the next generation
+template <typename T, typename HandleType>
+class Registry {
+public:
+    // throws when the name is taken
+    HandleType add(const std::string &name, T value) {
+        if (mIndices.count(name) != 0) {
+            throw std::runtime_error("Registry already holds " + name);
+        }
+        uint32_t index;
+        if (!mFree.empty()) {
+            index = mFree.back();
+            mFree.pop_back();
+            mValues[index] = std::move(value);
+            mNames[index] = name;
+        } else {
+            if (mValues.size() >= (1u << HandleType::IndexBits)) {
+                throw std::runtime_error("Registry out of slots");
+            }
+            index = static_cast<uint32_t>(mValues.size());
+            mValues.push_back(std::move(value));
+            mNames.push_back(name);
+            mGenerations.push_back(1);
+        }
+        mIndices[name] = index;
+        ++mSize;
+        return HandleType(index, mGenerations[index]);
+    }
+
+    // the slot gets a new generation, so the handle and its copies stop resolving
+    void remove(HandleType handle) {
+        const uint32_t index = slot(handle);
+        mIndices.erase(mNames[index]);
+        mNames[index].clear();
+        mValues[index] = T();
+        // generation 0 never resolves, it keeps the zero handle invalid
+        mGenerations[index] = mGenerations[index] % ((1u << HandleType::GenerationBits) - 1) + 1;
+        mFree.push_back(index);
+        --mSize;
+    }
+
+    // invalid handle when there is no entry of that name
+    HandleType find(const std::string &name) const {
+        auto it = mIndices.find(name);
+        return it == mIndices.end() ? HandleType() : HandleType(it->second, mGenerations[it->second]);
+    }
+
+    bool valid(HandleType handle) const {
+        return handle.index() < mGenerations.size() && mGenerations[handle.index()] == handle.generation();
+    }
+
+    // throws on invalid and removed handles
+    T &get(HandleType handle) { return mValues[slot(handle)]; }
+
+    const T &get(HandleType handle) const { return mValues[slot(handle)]; }
+
+    T &operator[](HandleType handle) { return get(handle); }
+
+    const T &operator[](HandleType handle) const { return get(handle); }
+
+    const std::string &name(HandleType handle) const { return mNames[slot(handle)]; }
+
+    // live entries
+    uint32_t size() const { return mSize; }
+
+    // calls func(value) for every live entry, in no particular order
+    template <typename Func>
+    void forEach(Func &&func) {
+        for (const auto &entry : mIndices) {
+            func(mValues[entry.second]);
+        }
+    }
+
+private:
+    uint32_t slot(HandleType handle) const {
+        if (!valid(handle)) {
+            throw std::runtime_error("Registry handle is stale or invalid");
+        }
+        return handle.index();
+    }
+
+    std::vector<T> mValues;
+    std::vector<std::string> mNames;
+    std::vector<uint32_t> mGenerations;
+    std::vector<uint32_t> mFree;
+    std::unordered_map<std::string, uint32_t> mIndices;
+    uint32_t mSize = 0;
+};
@@ -0,0 +1,293 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "src/common/RenderGraph.h"
+
+uint32_t RenderGraph::createTexture(const std::string &name, const TextureDesc &desc) {
+    Resource resource;
+    resource.name = name;
+    resource.desc = desc;
+    mResources.push_back(resource);
+    return static_cast<uint32_t>(mResources.size() - 1);
+}
+
+uint32_t RenderGraph::importTexture(const std::string &name, uint32_t initialState, uint32_t finalState) {
+    Resource resource;
+    resource.name = name;
+    resource.imported = true;
+    resource.initialState = initialState;
+    resource.finalState = finalState;
+    mResources.push_back(resource);
+    return static_cast<uint32_t>(mResources.size() - 1);
+}
+
+uint32_t RenderGraph::addPass(const std::string &name, std::function<void()> execute) {
+    Pass pass;
+    pass.name = name;
+    pass.execute = std::move(execute);
+    mPasses.push_back(std::move(pass));
+    return static_cast<uint32_t>(mPasses.size() - 1);
+}
+
+void RenderGraph::read(uint32_t pass, uint32_t resource, uint32_t state) {
+    if (pass >= mPasses.size() || resource >= mResources.size()) {
+        throw std::runtime_error("Render graph read of an unknown pass or resource");
+    }
+    if ((state & ~ReadStates) != 0) {
+        throw std::runtime_error("Render graph read in a write state");
+    }
+    mPasses[pass].accesses.push_back({resource, state, false});
+}
+
+void RenderGraph::write(uint32_t pass, uint32_t resource, uint32_t state) {
+    if (pass >= mPasses.size() || resource >= mResources.size()) {
+        throw std::runtime_error("Render graph write of an unknown pass or resource");
+    }
+    if (state == Common || (state & (state - 1)) != 0) {
+        throw std::runtime_error("Render graph write needs exactly one state");
+    }
+    mPasses[pass].accesses.push_back({resource, state, true});
+}
+
+void RenderGraph::compile(const Device &device) {
+    mStats = Stats();
+    mStats.passes = static_cast<uint32_t>(mPasses.size());
+    mFinalBarriers.clear();
+    for (Pass &pass : mPasses) {
+        pass.culled = false;
+        pass.aliasing.clear();
+        pass.discards.clear();
+        pass.barriers.clear();
+    }
+
+    cullPasses();
+
+    for (Resource &resource : mResources) {
+        resource.firstPass = NoResource;
+        resource.lastPass = 0;
+    }
+    for (uint32_t i = 0; i < mPasses.size(); ++i) {
+        if (mPasses[i].culled) {
+            continue;
+        }
+        for (const Access &access : mPasses[i].accesses) {
+            Resource &resource = mResources[access.resource];
+            resource.firstPass = std::min(resource.firstPass, i);
+            resource.lastPass = std::max(resource.lastPass, i);
+        }
+    }
+
+    allocateTransients(device);
+    placeBarriers();
+
+    for (const Pass &pass : mPasses) {
+        mStats.culled += pass.culled ? 1 : 0;
+        mStats.barriers += static_cast<uint32_t>(pass.aliasing.size() + pass.barriers.size());
+        mStats.batches += (pass.aliasing.empty() ? 0 : 1) + (pass.barriers.empty() ? 0 : 1);
+    }
+    mStats.barriers += static_cast<uint32_t>(mFinalBarriers.size());
+    mStats.batches += mFinalBarriers.empty() ? 0 : 1;
+}
+
+void RenderGraph::cullPasses() {
+    // walking backwards, a pass survives when it writes an imported texture or anything a later survivor touches
+    std::vector<uint8_t> needed(mResources.size(), 0);
+    for (uint32_t i = static_cast<uint32_t>(mPasses.size()); i-- > 0;) {
+        Pass &pass = mPasses[i];
+        bool alive = false;
+        for (const Access &access : pass.accesses) {
+            alive |= access.write && (mResources[access.resource].imported || needed[access.resource]);
+        }
+        pass.culled = !alive;
+        if (alive) {
+            // writes count too, a render target write keeps what earlier passes drew
+            for (const Access &access : pass.accesses) {
+                needed[access.resource] = 1;
+            }
+        }
+    }
+}
+
+void RenderGraph::allocateTransients(const Device &device) {
+    mHeap = Allocation();
+    std::vector<uint32_t> transients;
+    for (uint32_t i = 0; i < mResources.size(); ++i) {
+        Resource &resource = mResources[i];
+        resource.offset = 0;
+        resource.size = 0;
+        resource.aliased = false;
+        if (!resource.imported && resource.firstPass != NoResource) {
+            const Allocation allocation = device.allocation(resource.desc);
+            resource.size = allocation.size;
+            mHeap.alignment = std::max(mHeap.alignment, allocation.alignment);
+            mStats.transientSize += allocation.size;
+            transients.push_back(i);
+        }
+    }
+
+    // largest first, each one goes to the lowest offset that no transient alive at the same time covers
+    std::sort(transients.begin(), transients.end(), [&](uint32_t a, uint32_t b) {
+        return mResources[a].size != mResources[b].size ? mResources[a].size > mResources[b].size : a < b;
+    });
+    auto overlapsInTime = [&](const Resource &a, const Resource &b) {
+        return a.firstPass <= b.lastPass && b.firstPass <= a.lastPass;
+    };
+    auto overlapsInMemory = [&](const Resource &a, const Resource &b) {
+        return a.offset < b.offset + b.size && b.offset < a.offset + a.size;
+    };
+
+    std::vector<uint32_t> placed;
+    for (uint32_t index : transients) {
+        Resource &resource = mResources[index];
+        const uint64_t alignment = std::max<uint64_t>(device.allocation(resource.desc).alignment, 1);
+
+        std::vector<const Resource *> live;
+        for (uint32_t other : placed) {
+            if (overlapsInTime(resource, mResources[other])) {
+                live.push_back(&mResources[other]);
+            }
+        }
+        std::sort(live.begin(), live.end(), [](const Resource *a, const Resource *b) { return a->offset < b->offset; });
+
+        uint64_t offset = 0;
+        for (const Resource *other : live) {
+            if (offset + resource.size <= other->offset) {
+                break;
+            }
+            offset = std::max(offset, (other->offset + other->size + alignment - 1) / alignment * alignment);
+        }
+        resource.offset = offset;
+        mHeap.size = std::max(mHeap.size, offset + resource.size);
+        placed.push_back(index);
+    }
+    mStats.heapSize = mHeap.size;
+    mStats.savedSize = mStats.transientSize - mHeap.size;
+
+    for (uint32_t a : placed) {
+        for (uint32_t b : placed) {
+            if (a != b && overlapsInMemory(mResources[a], mResources[b])) {
+                mResources[a].aliased = true;
+            }
+        }
+    }
+}
+
+void RenderGraph::placeBarriers() {
+    struct Use {
+        uint32_t pass;
+        uint32_t state;
+        bool write;
+    };
+
+    for (uint32_t index = 0; index < mResources.size(); ++index) {
+        Resource &resource = mResources[index];
+        if (resource.firstPass == NoResource) {
+            continue;
+        }
+
+        // one state per pass, then runs of reads merge into a single combined read state
+        std::vector<Use> uses;
+        for (uint32_t i = resource.firstPass; i <= resource.lastPass; ++i) {
+            const Pass &pass = mPasses[i];
+            if (pass.culled) {
+                continue;
+            }
+            uint32_t readState = Common, writeState = Common;
+            for (const Access &access : pass.accesses) {
+                if (access.resource == index) {
+                    (access.write ? writeState : readState) |= access.state;
+                }
+            }
+            if ((writeState & (writeState - 1)) != 0) {
+                throw std::runtime_error("Render graph pass " + pass.name + " writes " + resource.name +
+                                         " in more than one state");
+            }
+            if (writeState != Common) {
+                uses.push_back({i, writeState, true});
+            } else if (readState != Common) {
+                if (!uses.empty() && !uses.back().write) {
+                    uses.back().state |= readState;
+                } else {
+                    uses.push_back({i, readState, false});
+                }
+            }
+        }
+        if (uses.empty()) {
+            continue;
+        }
+
+        uint32_t state = resource.initialState;
+        if (!resource.imported) {
+            resource.initialState = uses.back().state;
+            state = resource.initialState;
+        }
+        if (resource.aliased) {
+            // the memory held another texture, the contents are undefined until a discard in a writable state
+            Pass &first = mPasses[uses.front().pass];
+            Barrier aliasing;
+            aliasing.type = Barrier::Aliasing;
+            aliasing.resource = index;
+            for (uint32_t other = 0; other < mResources.size(); ++other) {
+                const Resource &candidate = mResources[other];
+                if (other == index || !candidate.aliased || candidate.lastPass >= resource.firstPass ||
+                    candidate.offset >= resource.offset + resource.size ||
+                    resource.offset >= candidate.offset + candidate.size) {
+                    continue;
+                }
+                if (aliasing.previous == NoResource || candidate.lastPass > mResources[aliasing.previous].lastPass) {
+                    aliasing.previous = other;
+                }
+            }
+            first.aliasing.push_back(aliasing);
+
+            const uint32_t writable = resource.desc.depthStencil ? DepthWrite : RenderTarget;
+            if (state != writable) {
+                first.aliasing.push_back({Barrier::Transition, index, state, writable, NoResource});
+                state = writable;
+            }
+            first.discards.push_back(index);
+        }
+
+        for (const Use &use : uses) {
+            if (use.state != state) {
+                mPasses[use.pass].barriers.push_back({Barrier::Transition, index, state, use.state, NoResource});
+                state = use.state;
+            }
+        }
+        if (resource.imported && state != resource.finalState) {
+            mFinalBarriers.push_back({Barrier::Transition, index, state, resource.finalState, NoResource});
+        }
+    }
+}
+
+void RenderGraph::execute(const std::function<void(const std::vector<Barrier> &)> &recordBarriers,
+                          const std::function<void(uint32_t)> &discard) const {
+    for (const Pass &pass : mPasses) {
+        if (pass.culled) {
+            continue;
+        }
+        if (!pass.aliasing.empty()) {
+            recordBarriers(pass.aliasing);
+        }
+        for (uint32_t resource : pass.discards) {
+            discard(resource);
+        }
+        if (!pass.barriers.empty()) {
+            recordBarriers(pass.barriers);
+        }
+        if (pass.execute) {
+            pass.execute();
+        }
+    }
+    if (!mFinalBarriers.empty()) {
+        recordBarriers(mFinalBarriers);
+    }
+}
+
+void RenderGraph::clear() {
+    mResources.clear();
+    mPasses.clear();
+    mFinalBarriers.clear();
+    mHeap = Allocation();
+    mStats = Stats();
+}
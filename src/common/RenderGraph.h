@@ -0,0 +1,158 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <functional>
+
+// frame graph of passes that declare the textures they read and write. compile() culls passes whose results nothing
+// consumes, batches the transitions the surviving passes need in front of each pass, and packs transient textures
+// with disjoint lifetimes into the same range of a shared heap. the graph never touches a graphics api, the
+// backend sizes textures through Device and turns the compiled barriers into its own calls
+class RenderGraph {
+public:
+    static const uint32_t NoResource = UINT32_MAX;
+
+    // bit flags, read only states can be combined into one
+    enum State : uint32_t {
+        Common = 0,
+        RenderTarget = 1 << 0,
+        DepthWrite = 1 << 1,
+        DepthRead = 1 << 2,
+        ShaderResource = 1 << 3,
+        ResolveSource = 1 << 4,
+        ResolveDest = 1 << 5,
+        CopySource = 1 << 6,
+        CopyDest = 1 << 7,
+        Present = 1 << 8,
+        ReadStates = DepthRead | ShaderResource | ResolveSource | CopySource | Present
+    };
+
+    // format is the backend's own format value, the graph only hands it back
+    struct TextureDesc {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint32_t samples = 1;
+        uint32_t format = 0;
+        bool depthStencil = false;
+    };
+
+    struct Allocation {
+        uint64_t size = 0;
+        uint64_t alignment = 0;
+    };
+
+    class Device {
+    public:
+        virtual ~Device() = default;
+
+        virtual Allocation allocation(const TextureDesc &desc) const = 0;
+    };
+
+    struct Barrier {
+        enum Type : uint32_t { Transition, Aliasing };
+
+        Type type = Transition;
+        uint32_t resource = NoResource;
+        // transitions only
+        uint32_t before = Common;
+        uint32_t after = Common;
+        // aliasing only, the texture that used the memory last in this frame or NoResource
+        uint32_t previous = NoResource;
+    };
+
+    struct Resource {
+        std::string name;
+        TextureDesc desc;
+        bool imported = false;
+        // imported textures arrive and have to leave in these states, transients are created in initialState and are
+        // back in it at the end of every frame
+        uint32_t initialState = Common;
+        uint32_t finalState = Common;
+
+        // set by compile(), offset and size for transients only
+        uint32_t firstPass = NoResource;
+        uint32_t lastPass = 0;
+        uint64_t offset = 0;
+        uint64_t size = 0;
+        // shares heap memory with another transient
+        bool aliased = false;
+    };
+
+    struct Access {
+        uint32_t resource;
+        uint32_t state;
+        bool write;
+    };
+
+    struct Pass {
+        std::string name;
+        std::vector<Access> accesses;
+        std::function<void()> execute;
+
+        // set by compile()
+        bool culled = false;
+        // aliasing barriers and transitions to initialization states, recorded before discards
+        std::vector<Barrier> aliasing;
+        // aliased transients whose contents are undefined and get discarded before the pass
+        std::vector<uint32_t> discards;
+        // recorded right before the pass runs
+        std::vector<Barrier> barriers;
+    };
+
+    struct Stats {
+        uint32_t passes = 0;
+        uint32_t culled = 0;
+        uint32_t barriers = 0;
+        // ResourceBarrier calls, one per non empty barrier list
+        uint32_t batches = 0;
+        // bytes the transients would take as dedicated resources
+        uint64_t transientSize = 0;
+        uint64_t heapSize = 0;
+        uint64_t savedSize = 0;
+    };
+
+    uint32_t createTexture(const std::string &name, const TextureDesc &desc);
+
+    // textures that live outside the graph, like swap chain buffers. writing one keeps the pass alive
+    uint32_t importTexture(const std::string &name, uint32_t initialState, uint32_t finalState);
+
+    uint32_t addPass(const std::string &name, std::function<void()> execute);
+
+    void read(uint32_t pass, uint32_t resource, uint32_t state);
+
+    void write(uint32_t pass, uint32_t resource, uint32_t state);
+
+    void compile(const Device &device);
+
+    // runs the live passes in order, barriers and discards are recorded through the callbacks before each pass
+    void execute(const std::function<void(const std::vector<Barrier> &)> &recordBarriers,
+                 const std::function<void(uint32_t)> &discard) const;
+
+    void clear();
+
+    const std::vector<Resource> &resources() const { return mResources; }
+
+    const std::vector<Pass> &passes() const { return mPasses; }
+
+    // heap that holds every transient, with the largest alignment any of them asked for
+    const Allocation &heap() const { return mHeap; }
+
+    // transitions of imported textures into their final states, recorded after the last pass
+    const std::vector<Barrier> &finalBarriers() const { return mFinalBarriers; }
+
+    const Stats &stats() const { return mStats; }
+
+private:
+    void cullPasses();
+
+    void placeBarriers();
+
+    void allocateTransients(const Device &device);
+
+    std::vector<Resource> mResources;
+    std::vector<Pass> mPasses;
+    std::vector<Barrier> mFinalBarriers;
+    Allocation mHeap;
+    Stats mStats;
+};
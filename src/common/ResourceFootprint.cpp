@@ -0,0 +1,142 @@
+#include <stdexcept>
+#include <algorithm>
+
+#include "src/common/ResourceFootprint.h"
+
+namespace {
+    const ResourceFootprint::FormatInfo Formats[] = {
+        {"R8", 1, 1, 1},
+        {"RGBA8", 1, 1, 4},
+        {"RGBA8_SRGB", 1, 1, 4},
+        {"RG16F", 1, 1, 4},
+        {"RGBA16F", 1, 1, 8},
+        {"RGBA32F", 1, 1, 16},
+        {"R32U", 1, 1, 4},
+        {"D24S8", 1, 1, 4},
+        {"D32F", 1, 1, 4},
+        {"BC1", 4, 4, 8},
+        {"BC3", 4, 4, 16},
+        {"BC4", 4, 4, 8},
+        {"BC5", 4, 4, 16},
+        {"BC6H", 4, 4, 16},
+        {"BC7", 4, 4, 16},
+    };
+
+    const uint64_t TileSize = 64 << 10;
+
+    uint64_t alignUp(uint64_t value, uint64_t alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    uint32_t mipSize(uint32_t size, uint32_t level) {
+        return std::max(size >> level, 1u);
+    }
+
+    uint32_t blocks(uint32_t texels, uint32_t blockSize) {
+        return (texels + blockSize - 1) / blockSize;
+    }
+}
+
+const ResourceFootprint::FormatInfo &ResourceFootprint::formatInfo(ResourceFormat format) {
+    return Formats[static_cast<uint32_t>(format)];
+}
+
+ResourceFormat ResourceFootprint::formatFromName(const std::string &name) {
+    for (uint32_t i = 0; i < sizeof(Formats) / sizeof(Formats[0]); ++i) {
+        if (name == Formats[i].name) {
+            return static_cast<ResourceFormat>(i);
+        }
+    }
+    throw std::runtime_error("Unknown resource format: " + name);
+}
+
+uint32_t ResourceFootprint::mipLevels(const TextureDesc &desc) {
+    uint32_t levels = 1;
+    while ((std::max(desc.width, desc.height) >> levels) > 0) {
+        ++levels;
+    }
+    return desc.mipLevels > 0 ? std::min(desc.mipLevels, levels) : levels;
+}
+
+uint64_t ResourceFootprint::copyableFootprints(
+    const TextureDesc &desc, uint32_t firstSubresource, uint32_t numSubresources, uint64_t baseOffset,
+    std::vector<Subresource> *layouts
+) {
+    const FormatInfo &info = formatInfo(desc.format);
+    const uint32_t levels = mipLevels(desc);
+    if (uint64_t(firstSubresource) + numSubresources > uint64_t(levels) * desc.arraySize) {
+        throw std::runtime_error("Subresource out of range");
+    }
+    if (layouts) {
+        layouts->clear();
+    }
+
+    uint64_t offset = baseOffset;
+    uint64_t end = baseOffset;
+    for (uint32_t subresource = firstSubresource; subresource < firstSubresource + numSubresources; ++subresource) {
+        const uint32_t level = subresource % levels;
+        Subresource layout;
+        layout.offset = alignUp(offset, PlacementAlignment);
+        // block compressed mips are padded to whole blocks
+        layout.width = blocks(mipSize(desc.width, level), info.blockWidth) * info.blockWidth;
+        layout.height = blocks(mipSize(desc.height, level), info.blockHeight) * info.blockHeight;
+        layout.numRows = layout.height / info.blockHeight;
+        layout.rowSize = uint64_t(layout.width / info.blockWidth) * info.bytesPerBlock;
+        layout.rowPitch = static_cast<uint32_t>(alignUp(layout.rowSize, RowPitchAlignment));
+        end = layout.offset + uint64_t(layout.rowPitch) * (layout.numRows - 1) + layout.rowSize;
+        offset = layout.offset + uint64_t(layout.rowPitch) * layout.numRows;
+        if (layouts) {
+            layouts->push_back(layout);
+        }
+    }
+    return end - baseOffset;
+}
+
+uint64_t ResourceFootprint::uploadSize(const TextureDesc &desc) {
+    return copyableFootprints(desc, 0, mipLevels(desc) * desc.arraySize);
+}
+
+ResourceFootprint::Allocation ResourceFootprint::allocation(const TextureDesc &desc) {
+    const FormatInfo &info = formatInfo(desc.format);
+    const uint32_t levels = mipLevels(desc);
+    const uint32_t samples = std::max(desc.samples, 1u);
+
+    // the most detailed mip of a small texture fits in a tile, the whole texture is packed into 4 KB pages
+    const uint64_t mip0 = uint64_t(blocks(desc.width, info.blockWidth)) * blocks(desc.height, info.blockHeight) *
+                          info.bytesPerBlock;
+    if (!desc.renderTarget && samples == 1 && mip0 <= TileSize) {
+        uint64_t size = 0;
+        for (uint32_t level = 0; level < levels; ++level) {
+            size += uint64_t(blocks(mipSize(desc.width, level), info.blockWidth)) *
+                    blocks(mipSize(desc.height, level), info.blockHeight) * info.bytesPerBlock;
+        }
+        return {alignUp(size * desc.arraySize, SmallAlignment), SmallAlignment};
+    }
+
+    // standard swizzle tiles are 64 KB of blocks, as square as a power of two allows. samples shrink the tile
+    const uint64_t tileBlocks = TileSize / (uint64_t(info.bytesPerBlock) * samples);
+    uint32_t shift = 0;
+    while ((uint64_t(1) << shift) < tileBlocks) {
+        ++shift;
+    }
+    const uint32_t tileWidth = 1u << ((shift + 1) / 2);
+    const uint32_t tileHeight = static_cast<uint32_t>(tileBlocks / tileWidth);
+
+    uint64_t tiles = 0;
+    uint64_t tailBytes = 0;
+    for (uint32_t level = 0; level < levels; ++level) {
+        const uint32_t width = blocks(mipSize(desc.width, level), info.blockWidth);
+        const uint32_t height = blocks(mipSize(desc.height, level), info.blockHeight);
+        if (tailBytes > 0 || width < tileWidth || height < tileHeight) {
+            tailBytes += uint64_t(width) * height * info.bytesPerBlock * samples;
+            continue;
+        }
+        tiles += uint64_t(blocks(width, tileWidth)) * blocks(height, tileHeight);
+    }
+    tiles += alignUp(tailBytes, TileSize) / TileSize;
+    return {tiles * desc.arraySize * TileSize, samples > 1 ? MsaaAlignment : DefaultAlignment};
+}
+
+ResourceFootprint::Allocation ResourceFootprint::bufferAllocation(uint64_t size) {
+    return {alignUp(std::max(size, uint64_t(1)), DefaultAlignment), DefaultAlignment};
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// formats of the resources DxRenderer creates and the block compressed ones assets may use later
+enum class ResourceFormat { R8, RGBA8, RGBA8_SRGB, RG16F, RGBA16F, RGBA32F, R32U, D24S8, D32F, BC1, BC3, BC4, BC5,
+                            BC6H, BC7 };
+
+// byte sizes of textures and buffers computed without a device. copyableFootprints() lays out subresources the way
+// GetCopyableFootprints does for upload and readback buffers. allocation() estimates GetResourceAllocationInfo from
+// the standard swizzle: every mip is rounded up to 64 KB tiles, the mips smaller than a tile share one tail per
+// array slice, and small textures take 4 KB pages instead. drivers may lay textures out tighter, never looser
+class ResourceFootprint {
+public:
+    static const uint64_t RowPitchAlignment = 256;
+    static const uint64_t PlacementAlignment = 512;
+    static const uint64_t SmallAlignment = 4 << 10;
+    static const uint64_t DefaultAlignment = 64 << 10;
+    static const uint64_t MsaaAlignment = 4 << 20;
+
+    struct FormatInfo {
+        const char *name;
+        // texels per block, 1x1 for uncompressed formats
+        uint32_t blockWidth;
+        uint32_t blockHeight;
+        uint32_t bytesPerBlock;
+    };
+
+    struct TextureDesc {
+        uint32_t width = 1;
+        uint32_t height = 1;
+        uint32_t arraySize = 1;
+        // 0 is the full chain
+        uint32_t mipLevels = 1;
+        uint32_t samples = 1;
+        ResourceFormat format = ResourceFormat::RGBA8;
+        // render targets and depth buffers never get the small alignment
+        bool renderTarget = false;
+    };
+
+    struct Subresource {
+        uint64_t offset;
+        uint32_t width;
+        uint32_t height;
+        uint32_t rowPitch;
+        // rows of blocks, a quarter of the height for block compressed formats
+        uint32_t numRows;
+        uint64_t rowSize;
+    };
+
+    struct Allocation {
+        uint64_t size = 0;
+        uint64_t alignment = 0;
+    };
+
+    static const FormatInfo &formatInfo(ResourceFormat format);
+
+    // by the names formatInfo() reports, throws for unknown names
+    static ResourceFormat formatFromName(const std::string &name);
+
+    static uint32_t mipLevels(const TextureDesc &desc);
+
+    // subresources are numbered mip first, then array slice, like D3D12CalcSubresource. returns the bytes the
+    // subresources span from baseOffset on and fills layouts when it is given
+    static uint64_t copyableFootprints(
+        const TextureDesc &desc, uint32_t firstSubresource, uint32_t numSubresources, uint64_t baseOffset = 0,
+        std::vector<Subresource> *layouts = nullptr
+    );
+
+    // the upload buffer bytes of every subresource
+    static uint64_t uploadSize(const TextureDesc &desc);
+
+    static Allocation allocation(const TextureDesc &desc);
+
+    static Allocation bufferAllocation(uint64_t size);
+};
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <array>
+#include <algorithm>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <glm.hpp>
+
+#include "src/common/Parallel.h"
+
+static const float PI = 3.1415926f;
+static const float TwoPI = 2.0f * PI;
+
+// must match NumSamples in prefilter.hlsl
+static const uint32_t PrefilterNumSamples = 1024;
+
+struct Sample2D {
+    float x, y;
+};
+
+// same bit reversal as RadicalInverse_VdC in sampling.hlsli
+constexpr float radicalInverse(uint32_t bits) {
+    bits = (bits << 16u) | (bits >> 16u);
+    bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+    bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+    bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+    bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+    return float(bits) * 2.3283064365386963e-10f; // / 0x100000000
+}
+
+constexpr Sample2D hammersley(uint32_t i, uint32_t numSamples) {
+    return {float(i) / float(numSamples), radicalInverse(i)};
+}
+
+// second dimension of the sobol sequence. (radicalInverse(i), sobol2(i)) is a (0, 2)-sequence: unlike a hammersley
+// set, every power of two prefix of it is itself well stratified, so progressive estimators can stop at any of them
+constexpr float sobol2(uint32_t i) {
+    uint32_t bits = 0;
+    for (uint32_t v = 1u << 31; i; i >>= 1, v ^= v >> 1) {
+        if (i & 1u) {
+            bits ^= v;
+        }
+    }
+    return float(bits) * 2.3283064365386963e-10f; // / 0x100000000
+}
+
+constexpr Sample2D sobol(uint32_t i) {
+    return {radicalInverse(i), sobol2(i)};
+}
+
+template <uint32_t N>
+constexpr std::array<Sample2D, N> makeHammersleyTable() {
+    std::array<Sample2D, N> table{};
+    for (uint32_t i = 0; i < N; ++i) {
+        table[i] = hammersley(i, N);
+    }
+    return table;
+}
+
+// generated at compile time, the shaders produce the same bits for a power of two sample count
+template <uint32_t N>
+constexpr std::array<Sample2D, N> HammersleyTable = makeHammersleyTable<N>();
+
+// against values worked out by hand: the bit reversal of i < 1024 is i's digits mirrored below the binary point
+static_assert(radicalInverse(1) == 0.5f && radicalInverse(2) == 0.25f && radicalInverse(3) == 0.75f);
+static_assert(HammersleyTable<PrefilterNumSamples>[1].x == 1.0f / 1024.0f);
+static_assert(HammersleyTable<PrefilterNumSamples>[6].y == 0.375f);
+static_assert(HammersleyTable<PrefilterNumSamples>[768].y == 3.0f / 1024.0f);
+static_assert(HammersleyTable<PrefilterNumSamples>[1023].x == 1023.0f / 1024.0f &&
+              HammersleyTable<PrefilterNumSamples>[1023].y == 1023.0f / 1024.0f);
+static_assert(sobol2(1) == 0.5f && sobol2(2) == 0.75f && sobol2(3) == 0.25f && sobol2(4) == 0.625f);
+
+// half vector around +z, same as ImportanceSampleGGX in sampling.hlsli
+inline glm::vec3 importanceSampleGGX(Sample2D uv, float roughness) {
+    float alpha = roughness * roughness;
+
+    float cosTheta = std::sqrt((1.0f - uv.y) / (1.0f + (alpha * alpha - 1.0f) * uv.y));
+    float sinTheta = std::sqrt(1.0f - cosTheta * cosTheta);
+    float phi = TwoPI * uv.x;
+
+    return {sinTheta * std::cos(phi), sinTheta * std::sin(phi), cosTheta};
+}
+
+inline float ndfGGX(float NdotH, float roughness) {
+    float alpha = roughness * roughness;
+    float alphaSq = alpha * alpha;
+
+    float denom = (NdotH * NdotH) * (alphaSq - 1.0f) + 1.0f;
+    return alphaSq / (PI * denom * denom);
+}
+
+// columns T, B, N, so basis * v equals mul(v, GetTBN(N)) in sampling.hlsli
+inline glm::mat3 tangentBasis(const glm::vec3 &N) {
+    glm::vec3 up = std::abs(N.z) < 0.999f ? glm::vec3{0.0f, 0.0f, 1.0f} : glm::vec3{1.0f, 0.0f, 0.0f};
+    glm::vec3 T = glm::normalize(glm::cross(up, N));
+    glm::vec3 B = glm::normalize(glm::cross(N, T));
+    return glm::mat3{T, B, N};
+}
+
+// tangent space GGX half vectors per roughness level, shared by the gpu and cpu prefilter bakers.
+// xyz is H, w is 0.5 * log2 of the solid angle the sample covers (1 / (numSamples * pdf)),
+// so the source mip is max(w - 0.5 * log2(texelSolidAngle) + 1, 0). nested tables take the sobol points instead of
+// the hammersley set, a prefix of count samples then covers numSamples / count times the solid angle per sample
+class GGXSampleTable {
+public:
+    GGXSampleTable() : mNumSamples(0), mLevels(0) {}
+
+    GGXSampleTable(uint32_t levels, uint32_t numSamples = PrefilterNumSamples, bool nested = false)
+        : mNumSamples(numSamples), mLevels(levels) {
+        mSamples.resize(static_cast<size_t>(levels) * numSamples);
+
+        std::vector<Sample2D> points(numSamples);
+        if (nested) {
+            for (uint32_t i = 0; i < numSamples; ++i) {
+                points[i] = sobol(i);
+            }
+        } else if (numSamples == PrefilterNumSamples) {
+            std::copy(HammersleyTable<PrefilterNumSamples>.begin(), HammersleyTable<PrefilterNumSamples>.end(),
+                      points.begin());
+        } else {
+            for (uint32_t i = 0; i < numSamples; ++i) {
+                points[i] = hammersley(i, numSamples);
+            }
+        }
+
+        parallelFor(0, levels, [&](uint32_t level) {
+            float r = roughness(level);
+            glm::vec4 *dst = mSamples.data() + static_cast<size_t>(level) * numSamples;
+            for (uint32_t i = 0; i < numSamples; ++i) {
+                glm::vec3 H = importanceSampleGGX(points[i], r);
+                float pdf = ndfGGX(H.z, r) * 0.25f;
+                // roughness 0 (level 0) is a plain copy of the source and has no finite pdf
+                dst[i] = glm::vec4{H, pdf > 0.0f ? 0.5f * std::log2(1.0f / (numSamples * pdf)) : 0.0f};
+            }
+        });
+    }
+
+    // roughness of a prefilter mip level, same spacing as setup()
+    float roughness(uint32_t level) const { return level / std::max(float(mLevels - 1), 1.0f); }
+
+    uint32_t numSamples() const { return mNumSamples; }
+
+    uint32_t levels() const { return mLevels; }
+
+    const glm::vec4 *level(uint32_t level) const { return mSamples.data() + static_cast<size_t>(level) * mNumSamples; }
+
+    const glm::vec4 *data() const { return mSamples.data(); }
+
+    size_t byteSize() const { return mSamples.size() * sizeof(glm::vec4); }
+
+    size_t levelByteSize() const { return static_cast<size_t>(mNumSamples) * sizeof(glm::vec4); }
+
+    // byte offset of a level in the buffer write() fills, the renderer binds it as ggxSamples of prefilter.hlsl
+    size_t levelOffset(uint32_t level) const { return static_cast<size_t>(level) * levelByteSize(); }
+
+    // the bytes the gpu bakers read, byteSize() of them
+    void write(void *dst) const { std::memcpy(dst, mSamples.data(), byteSize()); }
+
+private:
+    uint32_t mNumSamples, mLevels;
+    std::vector<glm::vec4> mSamples;
+};
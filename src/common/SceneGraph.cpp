@@ -0,0 +1,265 @@
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <emmintrin.h>
+
+#include "src/common/SceneGraph.h"
+#include "src/common/Parallel.h"
+
+namespace {
+    template <typename T>
+    void permute(std::vector<T> &values, const std::vector<uint32_t> &order) {
+        // padding past the ordered slots is kept as it is
+        std::vector<T> sorted(values);
+        for (uint32_t slot = 0; slot < order.size(); ++slot) {
+            sorted[slot] = values[order[slot]];
+        }
+        values.swap(sorted);
+    }
+
+    void append(std::vector<float> &values, uint32_t slot, float value, uint32_t padding) {
+        values.resize(slot + 1 + padding, 0.0f);
+        values[slot] = value;
+    }
+
+    // parent * column, parent given by its columns
+    __m128 transformColumn(const __m128 parent[4], __m128 column) {
+        __m128 result = _mm_mul_ps(parent[0], _mm_shuffle_ps(column, column, _MM_SHUFFLE(0, 0, 0, 0)));
+        result = _mm_add_ps(result, _mm_mul_ps(parent[1], _mm_shuffle_ps(column, column, _MM_SHUFFLE(1, 1, 1, 1))));
+        result = _mm_add_ps(result, _mm_mul_ps(parent[2], _mm_shuffle_ps(column, column, _MM_SHUFFLE(2, 2, 2, 2))));
+        return _mm_add_ps(result, _mm_mul_ps(parent[3], _mm_shuffle_ps(column, column, _MM_SHUFFLE(3, 3, 3, 3))));
+    }
+}
+
+uint32_t SceneGraph::addNode(uint32_t parent, const glm::vec3 &translation, const glm::quat &rotation,
+                             const glm::vec3 &scale) {
+    const uint32_t node = size();
+    if (parent != NoParent && parent >= node) {
+        throw std::runtime_error("Scene graph parent has to be added before its children");
+    }
+
+    // new nodes go to the end of the storage and get sorted into their level by the next update
+    const uint32_t slot = node;
+    mParent.push_back(parent);
+    mSlot.push_back(slot);
+    mNode.push_back(node);
+    mParentSlot.push_back(parent != NoParent ? mSlot[parent] : UINT32_MAX);
+    mDepth.push_back(parent == NoParent ? 0 : mDepth[mSlot[parent]] + 1);
+    append(mTranslationX, slot, translation.x, Padding);
+    append(mTranslationY, slot, translation.y, Padding);
+    append(mTranslationZ, slot, translation.z, Padding);
+    append(mRotationX, slot, 0.0f, Padding);
+    append(mRotationY, slot, 0.0f, Padding);
+    append(mRotationZ, slot, 0.0f, Padding);
+    append(mRotationW, slot, 1.0f, Padding);
+    append(mScaleX, slot, scale.x, Padding);
+    append(mScaleY, slot, scale.y, Padding);
+    append(mScaleZ, slot, scale.z, Padding);
+    mDirty.push_back(0);
+    mUpdated.push_back(0);
+    mWorld.push_back(glm::mat4(1.0f));
+    mSorted = false;
+
+    setRotation(node, rotation);
+    markDirty(slot);
+    return node;
+}
+
+void SceneGraph::setTranslation(uint32_t node, const glm::vec3 &translation) {
+    const uint32_t slot = mSlot[node];
+    mTranslationX[slot] = translation.x;
+    mTranslationY[slot] = translation.y;
+    mTranslationZ[slot] = translation.z;
+    markDirty(slot);
+}
+
+void SceneGraph::setRotation(uint32_t node, const glm::quat &rotation) {
+    const uint32_t slot = mSlot[node];
+    const glm::quat normalized = glm::normalize(rotation);
+    mRotationX[slot] = normalized.x;
+    mRotationY[slot] = normalized.y;
+    mRotationZ[slot] = normalized.z;
+    mRotationW[slot] = normalized.w;
+    markDirty(slot);
+}
+
+void SceneGraph::setScale(uint32_t node, const glm::vec3 &scale) {
+    const uint32_t slot = mSlot[node];
+    mScaleX[slot] = scale.x;
+    mScaleY[slot] = scale.y;
+    mScaleZ[slot] = scale.z;
+    markDirty(slot);
+}
+
+glm::vec3 SceneGraph::translation(uint32_t node) const {
+    const uint32_t slot = mSlot[node];
+    return {mTranslationX[slot], mTranslationY[slot], mTranslationZ[slot]};
+}
+
+glm::quat SceneGraph::rotation(uint32_t node) const {
+    const uint32_t slot = mSlot[node];
+    return {mRotationW[slot], mRotationX[slot], mRotationY[slot], mRotationZ[slot]};
+}
+
+glm::vec3 SceneGraph::scale(uint32_t node) const {
+    const uint32_t slot = mSlot[node];
+    return {mScaleX[slot], mScaleY[slot], mScaleZ[slot]};
+}
+
+void SceneGraph::markDirty(uint32_t slot) {
+    mDirty[slot] = 1;
+    mFirstDirtyDepth = std::min(mFirstDirtyDepth, mDepth[slot]);
+    mLastDirtyDepth = std::max(mLastDirtyDepth, mDepth[slot]);
+}
+
+void SceneGraph::sortByDepth() {
+    const uint32_t count = size();
+    uint32_t maxDepth = 0;
+    for (uint32_t depth : mDepth) {
+        maxDepth = std::max(maxDepth, depth);
+    }
+
+    // stable counting sort, order[new slot] = old slot
+    mLevels.assign(count > 0 ? maxDepth + 2 : 1, 0);
+    for (uint32_t depth : mDepth) {
+        ++mLevels[depth + 1];
+    }
+    for (uint32_t depth = 1; depth < mLevels.size(); ++depth) {
+        mLevels[depth] += mLevels[depth - 1];
+    }
+    std::vector<uint32_t> next(mLevels.begin(), mLevels.end() - 1);
+    std::vector<uint32_t> order(count);
+    for (uint32_t slot = 0; slot < count; ++slot) {
+        order[next[mDepth[slot]]++] = slot;
+    }
+
+    // siblings next to each other and in the order of their parents, so the parent flags and matrices a level reads
+    // are close together
+    std::vector<uint32_t> newSlot(count);
+    for (uint32_t depth = 0; depth + 1 < mLevels.size(); ++depth) {
+        if (depth > 0) {
+            std::stable_sort(order.begin() + mLevels[depth], order.begin() + mLevels[depth + 1],
+                             [&](uint32_t a, uint32_t b) { return newSlot[mParentSlot[a]] < newSlot[mParentSlot[b]]; });
+        }
+        for (uint32_t slot = mLevels[depth]; slot < mLevels[depth + 1]; ++slot) {
+            newSlot[order[slot]] = slot;
+        }
+    }
+
+    permute(mNode, order);
+    permute(mDepth, order);
+    for (std::vector<float> *values : {&mTranslationX, &mTranslationY, &mTranslationZ, &mRotationX, &mRotationY,
+                                       &mRotationZ, &mRotationW, &mScaleX, &mScaleY, &mScaleZ}) {
+        permute(*values, order);
+    }
+    permute(mDirty, order);
+    permute(mUpdated, order);
+    permute(mWorld, order);
+
+    for (uint32_t slot = 0; slot < count; ++slot) {
+        mSlot[mNode[slot]] = slot;
+    }
+    for (uint32_t slot = 0; slot < count; ++slot) {
+        const uint32_t parent = mParent[mNode[slot]];
+        mParentSlot[slot] = parent != NoParent ? mSlot[parent] : UINT32_MAX;
+    }
+    mSorted = true;
+}
+
+void SceneGraph::update() {
+    auto start = std::chrono::steady_clock::now();
+    if (!mSorted) {
+        sortByDepth();
+    }
+
+    mStats.nodes = size();
+    mStats.levels = static_cast<uint32_t>(mLevels.size()) - 1;
+    mStats.updated = 0;
+    if (mFirstDirtyDepth != UINT32_MAX) {
+        // levels run one after another, the nodes of a level in parallel
+        for (uint32_t depth = mFirstDirtyDepth; depth < mStats.levels; ++depth) {
+            std::atomic<uint32_t> updated{0};
+            parallelForRange(mLevels[depth], mLevels[depth + 1], [&](uint32_t first, uint32_t last) {
+                updated += updateRange(first, last);
+            }, 1024);
+            mStats.updated += updated;
+            // nothing below changes once a level is clean and no dirty nodes are left deeper down
+            if (updated == 0 && depth >= mLastDirtyDepth) {
+                break;
+            }
+        }
+
+        const uint32_t first = mLevels[mFirstDirtyDepth];
+        std::fill(mDirty.begin() + first, mDirty.end(), 0);
+        std::fill(mUpdated.begin() + first, mUpdated.end(), 0);
+        mFirstDirtyDepth = UINT32_MAX;
+        mLastDirtyDepth = 0;
+    }
+    mStats.updateTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+uint32_t SceneGraph::updateRange(uint32_t first, uint32_t last) {
+    const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f), two = _mm_set1_ps(2.0f);
+    uint32_t updated = 0;
+    for (uint32_t slot = first; slot < last; slot += 4) {
+        // a node changes when it is dirty itself or its parent changed in this update
+        const uint32_t lanes = std::min(last - slot, 4u);
+        uint32_t mask = 0;
+        for (uint32_t lane = 0; lane < lanes; ++lane) {
+            const uint32_t parentSlot = mParentSlot[slot + lane];
+            const bool changed = mDirty[slot + lane] || (parentSlot != NoParent && mUpdated[parentSlot]);
+            mUpdated[slot + lane] = changed;
+            mask |= uint32_t(changed) << lane;
+        }
+        if (mask == 0) {
+            continue;
+        }
+
+        // local matrices of four nodes, rotation columns from the unit quaternions scaled per axis
+        const __m128 x = _mm_loadu_ps(&mRotationX[slot]), y = _mm_loadu_ps(&mRotationY[slot]);
+        const __m128 z = _mm_loadu_ps(&mRotationZ[slot]), w = _mm_loadu_ps(&mRotationW[slot]);
+        const __m128 x2 = _mm_mul_ps(x, two), y2 = _mm_mul_ps(y, two), z2 = _mm_mul_ps(z, two);
+        const __m128 xx = _mm_mul_ps(x, x2), yy = _mm_mul_ps(y, y2), zz = _mm_mul_ps(z, z2);
+        const __m128 xy = _mm_mul_ps(x, y2), xz = _mm_mul_ps(x, z2), yz = _mm_mul_ps(y, z2);
+        const __m128 wx = _mm_mul_ps(w, x2), wy = _mm_mul_ps(w, y2), wz = _mm_mul_ps(w, z2);
+        const __m128 sx = _mm_loadu_ps(&mScaleX[slot]), sy = _mm_loadu_ps(&mScaleY[slot]);
+        const __m128 sz = _mm_loadu_ps(&mScaleZ[slot]);
+
+        __m128 columns[4][4] = {
+            {_mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(yy, zz)), sx), _mm_mul_ps(_mm_add_ps(xy, wz), sx),
+             _mm_mul_ps(_mm_sub_ps(xz, wy), sx), zero},
+            {_mm_mul_ps(_mm_sub_ps(xy, wz), sy), _mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(xx, zz)), sy),
+             _mm_mul_ps(_mm_add_ps(yz, wx), sy), zero},
+            {_mm_mul_ps(_mm_add_ps(xz, wy), sz), _mm_mul_ps(_mm_sub_ps(yz, wx), sz),
+             _mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(xx, yy)), sz), zero},
+            {_mm_loadu_ps(&mTranslationX[slot]), _mm_loadu_ps(&mTranslationY[slot]),
+             _mm_loadu_ps(&mTranslationZ[slot]), one},
+        };
+        // columns[c][lane] becomes column c of the lane's matrix
+        for (__m128 *column : columns) {
+            _MM_TRANSPOSE4_PS(column[0], column[1], column[2], column[3]);
+        }
+
+        for (uint32_t lane = 0; lane < lanes; ++lane) {
+            if (!(mask & (1u << lane))) {
+                continue;
+            }
+            float *world = &mWorld[slot + lane][0][0];
+            const uint32_t parentSlot = mParentSlot[slot + lane];
+            if (parentSlot == NoParent) {
+                for (uint32_t c = 0; c < 4; ++c) {
+                    _mm_storeu_ps(world + 4 * c, columns[c][lane]);
+                }
+            } else {
+                const float *parentWorld = &mWorld[parentSlot][0][0];
+                const __m128 parent[4] = {_mm_loadu_ps(parentWorld), _mm_loadu_ps(parentWorld + 4),
+                                          _mm_loadu_ps(parentWorld + 8), _mm_loadu_ps(parentWorld + 12)};
+                for (uint32_t c = 0; c < 4; ++c) {
+                    _mm_storeu_ps(world + 4 * c, transformColumn(parent, columns[c][lane]));
+                }
+            }
+            ++updated;
+        }
+    }
+    return updated;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <glm.hpp>
+#include <gtc/quaternion.hpp>
+
+// transform hierarchy with local translation, rotation and scale in structure of arrays layout. nodes are kept sorted
+// by depth, so parents always come before their children and every level is one contiguous range that updates in
+// parallel. update() only recomputes the world matrices of dirty nodes and their descendants, local matrices are
+// built four nodes at a time with SSE. node ids stay the same when the storage gets reordered
+class SceneGraph {
+public:
+    static const uint32_t NoParent = UINT32_MAX;
+
+    struct Stats {
+        uint32_t nodes = 0;
+        uint32_t levels = 0;
+        // world matrices recomputed by the last update
+        uint32_t updated = 0;
+        // milliseconds
+        double updateTime = 0.0;
+    };
+
+    // the parent has to exist already, returns the node id
+    uint32_t addNode(uint32_t parent, const glm::vec3 &translation = glm::vec3(0.0f),
+                     const glm::quat &rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f),
+                     const glm::vec3 &scale = glm::vec3(1.0f));
+
+    void setTranslation(uint32_t node, const glm::vec3 &translation);
+
+    // normalized on the way in
+    void setRotation(uint32_t node, const glm::quat &rotation);
+
+    void setScale(uint32_t node, const glm::vec3 &scale);
+
+    glm::vec3 translation(uint32_t node) const;
+
+    glm::quat rotation(uint32_t node) const;
+
+    glm::vec3 scale(uint32_t node) const;
+
+    uint32_t parent(uint32_t node) const { return mParent[node]; }
+
+    uint32_t size() const { return static_cast<uint32_t>(mParent.size()); }
+
+    // valid after update()
+    const glm::mat4 &world(uint32_t node) const { return mWorld[mSlot[node]]; }
+
+    void update();
+
+    const Stats &stats() const { return mStats; }
+
+private:
+    // the sse loads read up to three slots past the last node
+    static const uint32_t Padding = 3;
+
+    void markDirty(uint32_t slot);
+
+    void sortByDepth();
+
+    // returns the number of world matrices recomputed
+    uint32_t updateRange(uint32_t first, uint32_t last);
+
+    // per node id
+    std::vector<uint32_t> mParent;
+    std::vector<uint32_t> mSlot;
+
+    // per storage slot
+    std::vector<uint32_t> mNode;
+    std::vector<uint32_t> mParentSlot;
+    std::vector<uint32_t> mDepth;
+    std::vector<float> mTranslationX, mTranslationY, mTranslationZ;
+    std::vector<float> mRotationX, mRotationY, mRotationZ, mRotationW;
+    std::vector<float> mScaleX, mScaleY, mScaleZ;
+    std::vector<uint8_t> mDirty;
+    // set for the nodes recomputed by the running update
+    std::vector<uint8_t> mUpdated;
+    std::vector<glm::mat4> mWorld;
+
+    // first slot of every depth, plus the end
+    std::vector<uint32_t> mLevels{0};
+    bool mSorted = true;
+    // depth range holding dirty nodes
+    uint32_t mFirstDirtyDepth = UINT32_MAX;
+    uint32_t mLastDirtyDepth = 0;
+    Stats mStats;
+};
@@ -0,0 +1,180 @@
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <filesystem>
+
+#include "src/common/ShaderCache.h"
+
+namespace {
+    bool readFile(const std::string &filename, std::string &text) {
+        std::ifstream file(filename, std::ios::binary);
+        if (!file) {
+            return false;
+        }
+        std::ostringstream stream;
+        stream << file.rdbuf();
+        text = stream.str();
+        return true;
+    }
+
+    // names of the #include lines outside of comments, conditional includes count too
+    std::vector<std::string> includes(const std::string &source) {
+        std::vector<std::string> names;
+        bool comment = false;
+        std::istringstream stream(source);
+        std::string line;
+        while (std::getline(stream, line)) {
+            // drop the comments of the line, block comments may span lines
+            std::string code;
+            for (size_t i = 0; i < line.size(); ++i) {
+                if (comment) {
+                    if (line.compare(i, 2, "*/") == 0) {
+                        comment = false;
+                        ++i;
+                    }
+                } else if (line.compare(i, 2, "/*") == 0) {
+                    comment = true;
+                    ++i;
+                } else if (line.compare(i, 2, "//") == 0) {
+                    break;
+                } else {
+                    code += line[i];
+                }
+            }
+
+            size_t hash = code.find_first_not_of(" \t");
+            if (hash == std::string::npos || code[hash] != '#') {
+                continue;
+            }
+            size_t directive = code.find_first_not_of(" \t", hash + 1);
+            if (directive == std::string::npos || code.compare(directive, 7, "include") != 0) {
+                continue;
+            }
+            size_t open = code.find_first_of("\"<", directive + 7);
+            if (open == std::string::npos) {
+                continue;
+            }
+            size_t close = code.find(code[open] == '"' ? '"' : '>', open + 1);
+            if (close != std::string::npos) {
+                names.push_back(code.substr(open + 1, close - open - 1));
+            }
+        }
+        return names;
+    }
+
+    // path and text of the file and everything it includes, missing includes keep an empty text
+    void scan(const std::string &filename, std::vector<std::pair<std::string, std::string>> &files, bool &found) {
+        for (const auto &file : files) {
+            if (file.first == filename) {
+                return;
+            }
+        }
+        std::string text;
+        found = readFile(filename, text);
+        files.push_back({filename, text});
+        if (!found) {
+            return;
+        }
+        const std::filesystem::path directory = std::filesystem::path(filename).parent_path();
+        for (const std::string &name : includes(text)) {
+            bool includeFound;
+            scan((directory / name).lexically_normal().generic_string(), files, includeFound);
+        }
+    }
+
+    std::vector<std::pair<std::string, std::string>> sourceFiles(const std::string &filename) {
+        std::vector<std::pair<std::string, std::string>> files;
+        bool found;
+        scan(std::filesystem::path(filename).lexically_normal().generic_string(), files, found);
+        if (!found) {
+            throw std::runtime_error("Failed to read shader source: " + filename);
+        }
+        return files;
+    }
+}
+
+std::vector<std::string> ShaderCache::dependencies(const std::string &filename) {
+    std::vector<std::string> names;
+    for (const auto &file : sourceFiles(filename)) {
+        names.push_back(file.first);
+    }
+    return names;
+}
+
+uint64_t ShaderCache::shaderKey(
+    const std::string &filename, const std::string &entryPoint, const std::string &profile,
+    const std::vector<std::pair<std::string, std::string>> &defines, uint32_t flags
+) {
+    Hasher hasher;
+    hasher.add(uint64_t(Version));
+    for (const auto &file : sourceFiles(filename)) {
+        hasher.add(file.first);
+        hasher.add(file.second);
+    }
+    hasher.add(entryPoint);
+    hasher.add(profile);
+    for (const auto &define : defines) {
+        hasher.add(define.first);
+        hasher.add(define.second);
+    }
+    hasher.add(uint64_t(flags));
+    return hasher.value();
+}
+
+std::string ShaderCache::keyName(uint64_t key) {
+    char name[17];
+    std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(key));
+    return name;
+}
+
+const std::vector<uint8_t> *ShaderCache::find(uint64_t key) {
+    auto entry = mEntries.find(key);
+    if (entry != mEntries.end()) {
+        mStats.memoryHits++;
+        return &entry->second;
+    }
+    std::vector<uint8_t> data;
+    if (load(keyName(key) + ".bin", data) && !data.empty()) {
+        mStats.diskHits++;
+        return &(mEntries[key] = std::move(data));
+    }
+    mStats.misses++;
+    return nullptr;
+}
+
+void ShaderCache::store(uint64_t key, std::vector<uint8_t> data) {
+    save(keyName(key) + ".bin", data);
+    mEntries[key] = std::move(data);
+    mStats.stores++;
+}
+
+bool ShaderCache::load(const std::string &name, std::vector<uint8_t> &data) const {
+    std::string text;
+    if (mDirectory.empty() || !readFile(path(name), text)) {
+        return false;
+    }
+    data.assign(text.begin(), text.end());
+    return true;
+}
+
+void ShaderCache::save(const std::string &name, const std::vector<uint8_t> &data) const {
+    if (mDirectory.empty()) {
+        return;
+    }
+    // written next to the entry and renamed over it, a crash never leaves half an entry behind
+    std::filesystem::create_directories(mDirectory);
+    const std::string temporary = path(name) + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size()));
+        if (!file) {
+            throw std::runtime_error("Failed to write shader cache entry: " + temporary);
+        }
+    }
+    std::filesystem::rename(temporary, path(name));
+}
+
+std::string ShaderCache::path(const std::string &name) const {
+    return (std::filesystem::path(mDirectory) / name).string();
+}
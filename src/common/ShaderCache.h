@@ -0,0 +1,82 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <unordered_map>
+
+// content addressed cache of compiled shaders. a key hashes the source of a shader and of every file it includes,
+// the entry point, profile, defines and compile flags, so any change to them misses. blobs are kept in memory and,
+// when the cache has a directory, in one file per key that later launches read. named entries hold data that is not
+// content addressed, like a serialized pipeline library
+class ShaderCache {
+public:
+    // part of every key, bump it when the compiler or the blob layout changes
+    static const uint32_t Version = 1;
+
+    // 64 bit FNV-1a
+    class Hasher {
+    public:
+        void add(const void *data, size_t size) {
+            const uint8_t *bytes = static_cast<const uint8_t *>(data);
+            for (size_t i = 0; i < size; ++i) {
+                mHash = (mHash ^ bytes[i]) * 1099511628211ull;
+            }
+        }
+
+        // length prefixed, "ab" + "c" and "a" + "bc" hash differently
+        void add(const std::string &text) {
+            add(uint64_t(text.size()));
+            add(text.data(), text.size());
+        }
+
+        void add(uint64_t value) { add(&value, sizeof(value)); }
+
+        uint64_t value() const { return mHash; }
+
+    private:
+        uint64_t mHash = 14695981039346656037ull;
+    };
+
+    struct Stats {
+        uint32_t memoryHits = 0;
+        uint32_t diskHits = 0;
+        uint32_t misses = 0;
+        uint32_t stores = 0;
+    };
+
+    // an empty directory keeps the cache in memory only
+    explicit ShaderCache(std::string directory = "") : mDirectory(std::move(directory)) {}
+
+    // the source file followed by every file it includes, each once in the order they are first included. includes
+    // resolve relative to the including file like D3D_COMPILE_STANDARD_FILE_INCLUDE, includes that don't exist are
+    // left to the compiler to report. throws when the source file can't be read
+    static std::vector<std::string> dependencies(const std::string &filename);
+
+    static uint64_t shaderKey(
+        const std::string &filename, const std::string &entryPoint, const std::string &profile,
+        const std::vector<std::pair<std::string, std::string>> &defines, uint32_t flags
+    );
+
+    static std::string keyName(uint64_t key);
+
+    // memory first, then disk. nullptr on a miss, valid until the next store()
+    const std::vector<uint8_t> *find(uint64_t key);
+
+    void store(uint64_t key, std::vector<uint8_t> data);
+
+    // false when there is no entry of the name
+    bool load(const std::string &name, std::vector<uint8_t> &data) const;
+
+    void save(const std::string &name, const std::vector<uint8_t> &data) const;
+
+    const Stats &stats() const { return mStats; }
+
+private:
+    std::string path(const std::string &name) const;
+
+    std::string mDirectory;
+    std::unordered_map<uint64_t, std::vector<uint8_t>> mEntries;
+    Stats mStats;
+};
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <glm.hpp>
+
+// real spherical harmonics up to band 2 (9 coefficients) of rgb radiance
+struct SHL2 {
+    static const uint32_t NumCoefficients = 9;
+    // coefficients packed as 9 rgb triples into float4s, the layout of probeSH in sh.hlsli
+    static const uint32_t NumPackedVectors = 7;
+
+    glm::vec3 coefficients[NumCoefficients] = {};
+
+    static void basis(const glm::vec3 &dir, float (&y)[NumCoefficients]) {
+        y[0] = 0.282095f;
+        y[1] = 0.488603f * dir.y;
+        y[2] = 0.488603f * dir.z;
+        y[3] = 0.488603f * dir.x;
+        y[4] = 1.092548f * dir.x * dir.y;
+        y[5] = 1.092548f * dir.y * dir.z;
+        y[6] = 0.315392f * (3.0f * dir.z * dir.z - 1.0f);
+        y[7] = 1.092548f * dir.x * dir.z;
+        y[8] = 0.546274f * (dir.x * dir.x - dir.y * dir.y);
+    }
+
+    // adds radiance arriving from dir, weight is the solid angle the sample stands for
+    void addSample(const glm::vec3 &dir, const glm::vec3 &radiance, float weight) {
+        float y[NumCoefficients];
+        basis(dir, y);
+        for (uint32_t i = 0; i < NumCoefficients; ++i) {
+            coefficients[i] += radiance * (y[i] * weight);
+        }
+    }
+
+    // cosine convolved radiance over PI (Ramamoorthi and Hanrahan), the quantity irradiance.hlsl stores
+    glm::vec3 irradiance(const glm::vec3 &normal) const {
+        const float bands[NumCoefficients] = {1.0f, 2.0f / 3.0f, 2.0f / 3.0f, 2.0f / 3.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.25f};
+        float y[NumCoefficients];
+        basis(normal, y);
+        glm::vec3 result{0.0f};
+        for (uint32_t i = 0; i < NumCoefficients; ++i) {
+            result += coefficients[i] * (bands[i] * y[i]);
+        }
+        return glm::max(result, glm::vec3{0.0f});
+    }
+
+    void pack(glm::vec4 (&packed)[NumPackedVectors]) const {
+        packed[NumPackedVectors - 1].w = 0.0f;
+        for (uint32_t i = 0; i < 3 * NumCoefficients; ++i) {
+            packed[i / 4][i % 4] = coefficients[i / 3][i % 3];
+        }
+    }
+
+    static SHL2 unpack(const glm::vec4 (&packed)[NumPackedVectors]) {
+        SHL2 sh;
+        for (uint32_t i = 0; i < 3 * NumCoefficients; ++i) {
+            sh.coefficients[i / 3][i % 3] = packed[i / 4][i % 4];
+        }
+        return sh;
+    }
+};
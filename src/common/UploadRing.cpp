@@ -0,0 +1,50 @@
+#include "src/common/UploadRing.h"
+
+UploadRing::UploadRing(uint64_t capacity) {
+    reset(capacity);
+}
+
+void UploadRing::reset(uint64_t capacity) {
+    mCapacity = capacity;
+    mHead = 0;
+    mUsed = 0;
+    mBatchUsed = 0;
+    mBatches.clear();
+}
+
+uint64_t UploadRing::allocate(uint64_t size, uint64_t alignment) {
+    if (size == 0 || size > mCapacity) {
+        return Invalid;
+    }
+    uint64_t first = (mHead + alignment - 1) & ~(alignment - 1);
+    // allocations never wrap, the end of the buffer is skipped instead
+    if (first + size > mCapacity) {
+        first = 0;
+    }
+    const uint64_t consumed = (first >= mHead ? first - mHead : mCapacity - mHead) + size;
+    if (mUsed + consumed > mCapacity) {
+        return Invalid;
+    }
+    mHead = (first + size) % mCapacity;
+    mUsed += consumed;
+    mBatchUsed += consumed;
+    return first;
+}
+
+void UploadRing::finishBatch(uint64_t fence) {
+    if (mBatchUsed > 0) {
+        mBatches.push_back({fence, mBatchUsed});
+        mBatchUsed = 0;
+    }
+}
+
+void UploadRing::retire(uint64_t completedFence) {
+    while (!mBatches.empty() && mBatches.front().fence <= completedFence) {
+        mUsed -= mBatches.front().size;
+        mBatches.pop_front();
+    }
+    // an idle ring starts over at the front, the next large upload will not have to skip the end
+    if (mUsed == 0) {
+        mHead = 0;
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <deque>
+#include <cstdint>
+
+// byte offsets into one persistently mapped upload buffer, handed out linearly and wrapping around. allocations are
+// grouped into batches that end with a fence value, a batch's bytes come back once the gpu completed its fence
+class UploadRing {
+public:
+    static const uint64_t Invalid = UINT64_MAX;
+
+    UploadRing() = default;
+
+    explicit UploadRing(uint64_t capacity);
+
+    void reset(uint64_t capacity);
+
+    // offset of size bytes aligned to alignment, a power of two. Invalid when the bytes only fit once older batches
+    // retired, or never fit
+    uint64_t allocate(uint64_t size, uint64_t alignment);
+
+    // the allocations since the last call belong to the work signaled with this fence value
+    void finishBatch(uint64_t fence);
+
+    void retire(uint64_t completedFence);
+
+    // fence to wait for before the oldest batch retires, 0 when no batch is in flight
+    uint64_t oldestFence() const { return mBatches.empty() ? 0 : mBatches.front().fence; }
+
+    uint64_t capacity() const { return mCapacity; }
+
+    // includes alignment padding and the skipped end of the buffer
+    uint64_t used() const { return mUsed; }
+
+private:
+    struct Batch {
+        uint64_t fence;
+        uint64_t size;
+    };
+
+    uint64_t mCapacity = 0;
+    uint64_t mHead = 0;
+    uint64_t mUsed = 0;
+    uint64_t mBatchUsed = 0;
+    std::deque<Batch> mBatches;
+};
@@ -0,0 +1,111 @@
+#include <algorithm>
+
+#include "src/common/VramBudget.h"
+#include "src/common/HeapAllocator.h"
+#include "src/common/LightClusters.h"
+
+namespace {
+    // mirror the per frame buffers of DxRenderer
+    const uint64_t FrameConstantsSize = 4 << 20;
+    const uint64_t MaxLights = 16384;
+    const uint64_t MaxLightIndices = 1 << 20;
+}
+
+const char *VramBudget::categoryName(Category category) {
+    static const char *names[NumCategories] = {"buffers", "textures", "render targets", "upload"};
+    return names[category];
+}
+
+void VramBudget::addTexture(const std::string &name, const ResourceFootprint::TextureDesc &desc, bool uploaded) {
+    mResources.push_back({
+        name, desc.renderTarget ? RenderTargets : Textures, ResourceFootprint::allocation(desc), true,
+        uploaded ? ResourceFootprint::uploadSize(desc) : 0
+    });
+}
+
+void VramBudget::addBuffer(const std::string &name, uint64_t size) {
+    mResources.push_back({name, Buffers, ResourceFootprint::bufferAllocation(size), true, size});
+}
+
+void VramBudget::addUploadBuffer(const std::string &name, uint64_t size) {
+    mResources.push_back({name, Upload, ResourceFootprint::bufferAllocation(size), false, 0});
+}
+
+void VramBudget::addMesh(const std::string &name, uint64_t numVertices, uint64_t numIndices) {
+    addBuffer(name + " vertices", numVertices * VertexSize);
+    addBuffer(name + " indices", numIndices * sizeof(uint32_t));
+}
+
+void VramBudget::addFrameResources(uint32_t width, uint32_t height, uint32_t samples, uint32_t numFrames) {
+    ResourceFootprint::TextureDesc target;
+    target.width = width;
+    target.height = height;
+    target.renderTarget = true;
+
+    for (uint32_t i = 0; i < numFrames; ++i) {
+        const std::string frame = " " + std::to_string(i);
+        ResourceFootprint::TextureDesc swapChain = target;
+        swapChain.format = ResourceFormat::RGBA8;
+        mResources.push_back({
+            "swap chain" + frame, RenderTargets, ResourceFootprint::allocation(swapChain), false, 0
+        });
+        ResourceFootprint::TextureDesc depth = target;
+        depth.format = ResourceFormat::D24S8;
+        addTexture("depth stencil" + frame, depth, false);
+
+        // render graph transients, counted without aliasing
+        ResourceFootprint::TextureDesc color = target;
+        color.format = ResourceFormat::RGBA16F;
+        color.samples = samples;
+        addTexture("graph color" + frame, color, false);
+        depth.samples = samples;
+        addTexture("graph depth" + frame, depth, false);
+        if (samples > 1) {
+            color.samples = 1;
+            addTexture("graph resolve" + frame, color, false);
+        }
+
+        addUploadBuffer("constants" + frame, FrameConstantsSize);
+        addUploadBuffer("lights" + frame, sizeof(ClusterLight) * MaxLights);
+        addUploadBuffer("cluster ranges" + frame, sizeof(uint32_t) * 2 * LightClusters::NumClusters);
+        addUploadBuffer("light indices" + frame, sizeof(uint32_t) * MaxLightIndices);
+    }
+    addUploadBuffer("upload ring", UploadRingSize);
+}
+
+VramBudget::Report VramBudget::report() const {
+    static const HeapAllocator::Category heapCategories[] = {
+        HeapAllocator::Buffers, HeapAllocator::Textures, HeapAllocator::RenderTargets
+    };
+
+    // resources are placed in the order they are added, like the backend creates them
+    HeapAllocator heaps(ResourceFootprint::SmallAlignment);
+    Report report;
+    for (const Resource &resource : mResources) {
+        CategoryReport &category = report.categories[resource.category];
+        category.resources++;
+        category.resourceBytes += resource.allocation.size;
+        report.uploadBytes += resource.uploadBytes;
+        report.largestUpload = std::max(report.largestUpload, resource.uploadBytes);
+        if (!resource.placed || resource.category == Upload) {
+            category.committedBytes += resource.allocation.size;
+            continue;
+        }
+
+        const HeapAllocator::Category heapCategory = heapCategories[resource.category];
+        const uint64_t size = resource.allocation.size, alignment = resource.allocation.alignment;
+        if (heaps.allocate(heapCategory, size, alignment) == HeapAllocator::Invalid) {
+            // larger resources get a heap of their own
+            const uint64_t heapSize =
+                std::max(uint64_t(HeapSize), (size + HeapAlignment - 1) / HeapAlignment * HeapAlignment);
+            heaps.addHeap(heapCategory, heapSize);
+            heaps.allocate(heapCategory, size, alignment);
+            category.heaps++;
+            category.committedBytes += heapSize;
+        }
+    }
+    for (const CategoryReport &category : report.categories) {
+        report.totalBytes += category.committedBytes;
+    }
+    return report;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "src/common/ResourceFootprint.h"
+
+// gpu memory a scene needs at a resolution, planned without a device. default heap resources are placed into heaps
+// per category the way DxRenderer places them, upload buffers and the swap chain are committed resources of their
+// own. sizes come from ResourceFootprint, so the totals are an upper bound on what a driver reports
+class VramBudget {
+public:
+    enum Category : uint32_t {
+        Buffers,
+        Textures,
+        RenderTargets,
+        Upload,
+        NumCategories,
+    };
+
+    // mirror DxRenderer
+    static const uint64_t HeapSize = 64 << 20;
+    static const uint64_t HeapAlignment = 4 << 20;
+    static const uint64_t UploadRingSize = 64 << 20;
+    static const uint32_t VertexSize = 56;
+
+    struct Resource {
+        std::string name;
+        Category category;
+        ResourceFootprint::Allocation allocation;
+        // placed into a heap of the category or a committed resource
+        bool placed;
+        // staging bytes of its initial contents, 0 for resources the gpu fills
+        uint64_t uploadBytes;
+    };
+
+    struct CategoryReport {
+        uint32_t resources = 0;
+        uint32_t heaps = 0;
+        // allocation sizes of the resources
+        uint64_t resourceBytes = 0;
+        // heaps and committed resources, what the category takes from the budget
+        uint64_t committedBytes = 0;
+    };
+
+    struct Report {
+        CategoryReport categories[NumCategories];
+        uint64_t totalBytes = 0;
+        uint64_t uploadBytes = 0;
+        // uploads larger than the ring get a committed staging buffer for the time of their copy
+        uint64_t largestUpload = 0;
+    };
+
+    static const char *categoryName(Category category);
+
+    void addTexture(const std::string &name, const ResourceFootprint::TextureDesc &desc, bool uploaded = true);
+
+    // default heap buffer, uploaded once
+    void addBuffer(const std::string &name, uint64_t size);
+
+    void addUploadBuffer(const std::string &name, uint64_t size);
+
+    // vertex and index buffer of 32 bit indices
+    void addMesh(const std::string &name, uint64_t numVertices, uint64_t numIndices);
+
+    // swap chain, depth buffers, render graph targets and per frame upload buffers of DxRenderer::init
+    void addFrameResources(uint32_t width, uint32_t height, uint32_t samples, uint32_t numFrames);
+
+    const std::vector<Resource> &resources() const { return mResources; }
+
+    Report report() const;
+
+private:
+    std::vector<Resource> mResources;
+};
@@ -0,0 +1,52 @@
+#include <iostream>
+#include <vector>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+
+#include "src/tests/Tests.h"
+#include "src/common/BrdfLut.h"
+
+// integrates numRows rows of the table spread over the roughness range and compares them with the table embedded
+// in BrdfLutData.h, so a change to the integrator or its sample count shows up until the header is regenerated with
+// `Luma --bake-brdf-lut`. compilers may round the last bit of a sum differently, a half apart counts as the same.
+// also checks that the embedded bytes are what encode() makes of the decoded table
+int benchBrdfLut(uint32_t numRows) {
+    const std::vector<uint16_t> embedded = BrdfLut::embeddedHalf();
+    const uint32_t size = BrdfLutDataSize;
+    numRows = std::min(numRows, size);
+    uint32_t errors = size != BrdfLut::DefaultSize ? 1 : 0;
+
+    uint32_t texels = 0, exact = 0, drifted = 0;
+    std::vector<uint32_t> rows(numRows);
+    for (uint32_t i = 0; i < numRows; ++i) {
+        rows[i] = numRows > 1 ? i * (size - 1) / (numRows - 1) : 0;
+    }
+    std::vector<uint32_t> rowExact(numRows), rowDrifted(numRows);
+    parallelFor(0, numRows, [&](uint32_t i) {
+        const uint32_t y = rows[i];
+        for (uint32_t x = 0; x < size; ++x) {
+            glm::vec2 texel = BrdfLut::integrate(float(x) / size, float(y) / size);
+            const uint16_t baked[2] = {floatToHalf(texel.x), floatToHalf(texel.y)};
+            for (uint32_t c = 0; c < 2; ++c) {
+                int difference = std::abs(int(baked[c]) - int(embedded[(static_cast<size_t>(y) * size + x) * 2 + c]));
+                rowExact[i] += difference == 0 ? 1 : 0;
+                rowDrifted[i] += difference > 1 ? 1 : 0;
+            }
+        }
+    });
+    for (uint32_t i = 0; i < numRows; ++i) {
+        texels += size;
+        exact += rowExact[i];
+        drifted += rowDrifted[i];
+    }
+    errors += drifted > 0 ? 1 : 0;
+
+    const std::vector<uint8_t> encoded = BrdfLut::encode(embedded, size);
+    errors += encoded.size() != sizeof(BrdfLutData) || std::memcmp(encoded.data(), BrdfLutData, encoded.size()) != 0;
+
+    std::cout << numRows << " of " << size << " rows baked again, " << exact << " of " << 2 * texels
+              << " channels identical to the embedded table, " << drifted << " more than a half apart" << std::endl;
+    std::cout << errors << " errors" << std::endl;
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,73 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <cstddef>
+#include <algorithm>
+#include <thread>
+
+#include "src/tests/Tests.h"
+#include "src/common/ConstantAllocator.h"
+#include "src/common/Parallel.h"
+
+// draws of random constant sizes allocate from one frame's range on all threads at the same time and fill their
+// constants with their index. checks the offsets are aligned, in range and that no draw overwrote another. the last
+// frame gets a range half the size it needs and drops the draws that don't fit
+int benchConstantAllocator(uint32_t numDraws) {
+    const uint32_t numFrames = 8;
+    std::vector<uint32_t> sizes(numDraws);
+    std::mt19937 rng(1);
+    for (uint32_t &size : sizes) {
+        // a transform or a batch of up to 8 instance transforms
+        size = 128 * (1 + rng() % 8);
+    }
+    const uint64_t capacity = uint64_t(numDraws) * 1024;
+    std::vector<uint32_t> memory(capacity / sizeof(uint32_t));
+    std::vector<uint64_t> offsets(numDraws);
+    ConstantAllocator allocator(capacity);
+    uint32_t errors = 0;
+    uint64_t highWater = 0;
+    double time = 0.0;
+
+    for (uint32_t frame = 0; frame < numFrames; ++frame) {
+        const bool oversubscribed = frame == numFrames - 1;
+        if (oversubscribed) {
+            allocator.beginFrame();
+            highWater = allocator.highWater();
+            allocator = ConstantAllocator(highWater / 2);
+        }
+        allocator.beginFrame();
+        auto start = std::chrono::steady_clock::now();
+        parallelFor(0, numDraws, [&](uint32_t draw) {
+            offsets[draw] = allocator.allocate(sizes[draw]);
+            if (offsets[draw] != ConstantAllocator::Invalid) {
+                std::fill_n(&memory[offsets[draw] / sizeof(uint32_t)], sizes[draw] / sizeof(uint32_t), draw);
+            }
+        }, 256);
+        time += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        uint32_t dropped = 0;
+        for (uint32_t draw = 0; draw < numDraws; ++draw) {
+            if (offsets[draw] == ConstantAllocator::Invalid) {
+                ++dropped;
+                continue;
+            }
+            errors += offsets[draw] % ConstantAllocator::Alignment != 0 ||
+                      offsets[draw] + sizes[draw] > allocator.capacity() ? 1 : 0;
+            const uint32_t *constants = &memory[offsets[draw] / sizeof(uint32_t)];
+            errors += std::count(constants, constants + sizes[draw] / sizeof(uint32_t), draw) !=
+                      std::ptrdiff_t(sizes[draw] / sizeof(uint32_t)) ? 1 : 0;
+        }
+        errors += dropped != allocator.failed() || (dropped > 0) != oversubscribed ? 1 : 0;
+        if (oversubscribed) {
+            std::cout << "a " << (allocator.capacity() >> 10) << " KB frame dropped " << dropped << " of " << numDraws
+                      << " draws, " << (allocator.requested() >> 10) << " KB requested" << std::endl;
+        }
+    }
+
+    std::cout << numDraws << " draws per frame on " << std::thread::hardware_concurrency() << " threads, "
+              << time * 1e6 / (double(numDraws) * numFrames) << " ns per draw, high-water "
+              << (highWater >> 10) << " KB" << std::endl;
+    std::cout << errors << " errors" << std::endl;
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,76 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+#include "src/tests/Tests.h"
+#include "src/common/CpuTexture.h"
+#include "src/common/CpuFeatures.h"
+
+// samples random 2D textures and cube maps of every format on one thread, scalar lookups against sample8 and
+// sampleCube8, and reports samples per second and the largest difference between the two
+int benchTextureSampling(uint32_t numSamples) {
+    const uint32_t size = 1024, cubeSize = 256;
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+    auto randomTexel = [&] { return glm::vec4{uniform(rng), uniform(rng), uniform(rng), uniform(rng)}; };
+
+    std::vector<glm::vec4> texels(static_cast<size_t>(size) * size);
+    std::generate(texels.begin(), texels.end(), randomTexel);
+    CubeMap cubeMap(cubeSize);
+    for (uint32_t faceIndex = 0; faceIndex < 6; ++faceIndex) {
+        std::generate(cubeMap.face(0, faceIndex), cubeMap.face(0, faceIndex) + cubeSize * cubeSize, randomTexel);
+    }
+    cubeMap.generateMipmaps();
+
+    // uv over a few repeats of the texture, directions anywhere and lods across the whole chain
+    const uint32_t numBatches = (numSamples + SampleBatch::Width - 1) / SampleBatch::Width;
+    const size_t count = static_cast<size_t>(numBatches) * SampleBatch::Width;
+    std::vector<float> x(count), y(count), z(count), lod(count);
+    for (size_t i = 0; i < count; ++i) {
+        x[i] = 8.0f * uniform(rng) - 4.0f;
+        y[i] = 8.0f * uniform(rng) - 4.0f;
+        z[i] = 8.0f * uniform(rng) - 4.0f;
+        lod[i] = 12.0f * uniform(rng) - 1.0f;
+    }
+
+    const char *simdName = CpuFeatures::get().avx2 ? "avx2" : "scalar fallback";
+    std::vector<glm::vec4> reference(count);
+    std::vector<SampleBatch> batches(numBatches);
+    for (TexelFormat format : {TexelFormat::R8, TexelFormat::RGBA8, TexelFormat::RGBA8_SRGB, TexelFormat::RGBA16F,
+                               TexelFormat::RGBA32F}) {
+        for (bool cube : {false, true}) {
+            CpuTexture texture = cube ? CpuTexture::fromCubeMap(cubeMap, format)
+                                      : CpuTexture::fromTexels(size, size, texels.data(), format);
+
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < count; ++i) {
+                reference[i] = cube ? texture.sampleCube({x[i], y[i], z[i]}, lod[i])
+                                    : texture.sample({x[i], y[i]}, lod[i]);
+            }
+            std::chrono::duration<double> scalarTime = std::chrono::steady_clock::now() - start;
+
+            start = std::chrono::steady_clock::now();
+            for (uint32_t i = 0; i < numBatches; ++i) {
+                const size_t first = static_cast<size_t>(i) * SampleBatch::Width;
+                if (cube) {
+                    texture.sampleCube8(&x[first], &y[first], &z[first], &lod[first], CpuSampler{}, batches[i]);
+                } else {
+                    texture.sample8(&x[first], &y[first], &lod[first], CpuSampler{}, batches[i]);
+                }
+            }
+            std::chrono::duration<double> simdTime = std::chrono::steady_clock::now() - start;
+
+            float maxError = 0.0f;
+            for (size_t i = 0; i < count; ++i) {
+                glm::vec4 error = glm::abs(batches[i / SampleBatch::Width].get(i % SampleBatch::Width) - reference[i]);
+                maxError = std::max(maxError, std::max(std::max(error.r, error.g), std::max(error.b, error.a)));
+            }
+            std::cout << CpuTexture::formatName(format) << (cube ? " cube" : " 2d") << ": scalar "
+                      << count / scalarTime.count() / 1e6 << " Msamples/s, " << simdName << " "
+                      << count / simdTime.count() / 1e6 << " Msamples/s, max difference " << maxError << std::endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,109 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <cstdint>
+#include <algorithm>
+#include <stdexcept>
+
+#include "src/tests/Tests.h"
+#include "src/common/DescriptorAllocator.h"
+
+// random persistent allocations and frees checked against a map of owned descriptors, then frames of transient tables
+// with three frames in flight, checked for overlap with the frames the gpu may still read
+int benchDescriptorAllocator(uint32_t numOperations) {
+    std::mt19937 rng(1);
+    const uint32_t persistentCapacity = 1 << 16, transientCapacity = 1 << 12;
+    DescriptorAllocator allocator(persistentCapacity, transientCapacity);
+    uint32_t errors = 0;
+
+    struct Range {
+        uint32_t first, count;
+    };
+    std::vector<Range> live;
+    std::vector<uint8_t> owned(persistentCapacity, 0);
+    uint32_t failed = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < numOperations; ++i) {
+        // hovers around half the capacity, with fragmentation from the random order of frees
+        if (live.empty() || (live.size() < 8192 && rng() % 2 == 0)) {
+            const uint32_t count = 1 + rng() % 8;
+            const uint32_t first = allocator.allocate(count);
+            if (first == DescriptorAllocator::Invalid) {
+                ++failed;
+                continue;
+            }
+            for (uint32_t index = first; index < first + count; ++index) {
+                errors += index >= persistentCapacity || owned[index] ? 1 : 0;
+                owned[std::min(index, persistentCapacity - 1)] = 1;
+            }
+            live.push_back({first, count});
+        } else {
+            const uint32_t victim = rng() % live.size();
+            const Range range = live[victim];
+            live[victim] = live.back();
+            live.pop_back();
+            std::fill(owned.begin() + range.first, owned.begin() + range.first + range.count, 0);
+            allocator.free(range.first, range.count);
+        }
+    }
+    const double persistentTime =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    const DescriptorAllocator::Stats churned = allocator.stats();
+
+    // double frees throw, and everything coalesces back into one range
+    uint32_t throws = 0;
+    if (!live.empty()) {
+        allocator.free(live.back().first, live.back().count);
+        try {
+            allocator.free(live.back().first, live.back().count);
+        } catch (const std::runtime_error &) {
+            ++throws;
+        }
+        live.pop_back();
+    }
+    for (const Range &range : live) {
+        allocator.free(range.first, range.count);
+    }
+    const DescriptorAllocator::Stats drained = allocator.stats();
+    errors += drained.persistentUsed != 0 || drained.persistentFreeRanges != 1 ||
+              drained.largestFreeRange != persistentCapacity || throws != 1 ? 1 : 0;
+
+    // transient tables, a frame's ranges may be reused once the fence two frames later completed
+    const uint32_t framesInFlight = 3;
+    const uint32_t numFrames = std::max(numOperations / 64, 1u);
+    std::vector<uint32_t> frameOf(transientCapacity, UINT32_MAX);
+    uint32_t transientFailed = 0;
+    start = std::chrono::steady_clock::now();
+    for (uint32_t frame = 0; frame < numFrames; ++frame) {
+        if (frame >= framesInFlight) {
+            allocator.retire(frame - framesInFlight + 1);
+        }
+        for (uint32_t table = 0; table < 64; ++table) {
+            const uint32_t count = 1 + rng() % 16;
+            const uint32_t first = allocator.allocateTransient(count);
+            if (first == DescriptorAllocator::Invalid) {
+                ++transientFailed;
+                continue;
+            }
+            for (uint32_t index = first - persistentCapacity; index < first - persistentCapacity + count; ++index) {
+                const uint32_t owner = frameOf[index];
+                errors += owner != UINT32_MAX && owner != frame && owner + framesInFlight > frame ? 1 : 0;
+                frameOf[index] = frame;
+            }
+        }
+        allocator.finishFrame(frame + 1);
+    }
+    const double transientTime =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    allocator.retire(numFrames);
+    errors += allocator.stats().transientUsed != 0 ? 1 : 0;
+
+    std::cout << "persistent: " << numOperations << " operations, " << persistentTime * 1e6 / numOperations
+              << " ns each, " << failed << " failed allocations, " << churned.persistentUsed << " in use in "
+              << churned.persistentFreeRanges << " free ranges at the end" << std::endl;
+    std::cout << "transient: " << numFrames << " frames of 64 tables, " << transientTime * 1e6 / (numFrames * 64)
+              << " ns per table, " << transientFailed << " failed allocations" << std::endl;
+    std::cout << errors << " errors" << std::endl;
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,81 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+#include "src/tests/Tests.h"
+#include "src/common/DrawQueue.h"
+#include "src/common/Parallel.h"
+
+// a frame worth of random draw packets, a quarter of them transparent, sorted with the radix sort and with
+// std::stable_sort for reference. also counts the state changes a submission in both orders would make
+int benchDrawSort(uint32_t numPackets) {
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+    struct Packet {
+        uint32_t pipeline, material, mesh;
+    };
+    std::vector<Packet> packets(numPackets);
+    DrawQueue queue;
+    for (uint32_t i = 0; i < numPackets; ++i) {
+        packets[i] = {static_cast<uint32_t>(uniform(rng) * 16) % 16, static_cast<uint32_t>(uniform(rng) * 2000) % 2000,
+                      static_cast<uint32_t>(uniform(rng) * 1000) % 1000};
+        const bool transparent = i % 4 == 0;
+        const float depth = uniform(rng);
+        queue.push(transparent ? DrawQueue::transparentKey(2, packets[i].pipeline, packets[i].material,
+                                                           packets[i].mesh, depth)
+                               : DrawQueue::opaqueKey(1, packets[i].pipeline, packets[i].material, packets[i].mesh,
+                                                      depth), i);
+    }
+    const std::vector<uint64_t> keys = queue.keys();
+
+    auto stateChanges = [&](const std::vector<uint32_t> &order) {
+        uint64_t changes = 0;
+        const Packet *last = nullptr;
+        for (uint32_t index : order) {
+            const Packet &packet = packets[index];
+            changes += !last || packet.pipeline != last->pipeline ? 1 : 0;
+            changes += !last || packet.material != last->material ? 1 : 0;
+            changes += !last || packet.mesh != last->mesh ? 1 : 0;
+            last = &packet;
+        }
+        return changes;
+    };
+    std::vector<uint32_t> submitted(numPackets);
+    for (uint32_t i = 0; i < numPackets; ++i) {
+        submitted[i] = i;
+    }
+    const uint64_t unsortedChanges = stateChanges(submitted);
+
+    const uint32_t numRuns = 10;
+    RadixSort sorter;
+    std::vector<uint64_t> sortedKeys;
+    std::vector<uint32_t> order;
+    double radixTime = 0.0, stdTime = 0.0;
+    for (uint32_t run = 0; run < numRuns; ++run) {
+        sortedKeys = keys;
+        order = submitted;
+        auto start = std::chrono::steady_clock::now();
+        sorter.sort(sortedKeys, order);
+        radixTime += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    std::vector<uint32_t> reference;
+    for (uint32_t run = 0; run < numRuns; ++run) {
+        reference = submitted;
+        auto start = std::chrono::steady_clock::now();
+        std::stable_sort(reference.begin(), reference.end(), [&](uint32_t a, uint32_t b) { return keys[a] < keys[b]; });
+        stdTime += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    std::cout << numPackets << " keys, " << ThreadPool::instance().numThreads() << " threads" << std::endl;
+    std::cout << "radix sort: " << radixTime / numRuns << " ms average, " << sorter.passes() << " passes"
+              << std::endl;
+    std::cout << "std::stable_sort: " << stdTime / numRuns << " ms average" << std::endl;
+    std::cout << "state changes: " << unsortedChanges << " unsorted, " << stateChanges(order) << " sorted"
+              << std::endl;
+    const bool matches = order == reference;
+    std::cout << (matches ? "order matches the reference" : "order differs from the reference") << std::endl;
+    return matches ? 0 : 1;
+}
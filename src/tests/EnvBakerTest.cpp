@@ -0,0 +1,75 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+
+#include "src/tests/Tests.h"
+#include "src/common/EnvBaker.h"
+
+namespace {
+    // error of every adaptive level against the fixed bake, and the share of the fixed samples a whole map has to
+    // save. the smallest levels have too few texels to save much on their own
+    const float MaxPrefilterError = 0.02f;
+    const float MaxIrradianceError = 0.02f;
+    const float MinSavings = 0.5f;
+
+    const uint32_t IrradianceSize = 8;
+
+    double milliseconds(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+// bakes a faceSize sky with a bright spot with the adaptive and the fixed scheme, and checks that every prefilter
+// level and the irradiance map stay within a relative rmse of the fixed bake, and that each map saves at least half
+// the samples
+int benchEnvBaker(uint32_t faceSize) {
+    uint32_t errors = 0;
+    CubeMap env(faceSize);
+    for (uint32_t faceIndex = 0; faceIndex < 6; ++faceIndex) {
+        for (uint32_t y = 0; y < faceSize; ++y) {
+            for (uint32_t x = 0; x < faceSize; ++x) {
+                glm::vec3 dir = glm::normalize(CubeMap::direction(faceIndex, (x + 0.5f) / faceSize,
+                                                                  (y + 0.5f) / faceSize));
+                float spot = 4.0f * std::pow(std::max(dir.x, 0.0f), 64.0f);
+                env.face(0, faceIndex)[y * faceSize + x] = glm::vec4{0.5f + 0.5f * dir.y + spot, 0.3f, 0.2f, 1.0f};
+            }
+        }
+    }
+    env.generateMipmaps();
+
+    EnvBaker::Settings fixedSettings, adaptiveSettings;
+    fixedSettings.adaptive = false;
+    auto start = std::chrono::steady_clock::now();
+    const CubeMap fixedPrefilter = EnvBaker::prefilter(env, fixedSettings);
+    const CubeMap fixedIrradiance = EnvBaker::irradiance(env, IrradianceSize, fixedSettings);
+    const double fixedTime = milliseconds(start);
+
+    start = std::chrono::steady_clock::now();
+    std::vector<EnvBaker::Stats> levelStats;
+    EnvBaker::Stats prefilterStats, irradianceStats;
+    const CubeMap prefilter = EnvBaker::prefilter(env, adaptiveSettings, &prefilterStats, &levelStats);
+    const CubeMap irradiance = EnvBaker::irradiance(env, IrradianceSize, adaptiveSettings, &irradianceStats);
+    const double adaptiveTime = milliseconds(start);
+
+    for (uint32_t level = 1; level < prefilter.levels(); ++level) {
+        const float error = EnvBaker::relativeRmse(prefilter, fixedPrefilter, level);
+        const EnvBaker::Stats &stats = levelStats[level];
+        errors += error > MaxPrefilterError ? 1 : 0;
+        std::cout << "prefilter level " << level << ": " << stats.samples << " of " << stats.fixedSamples
+                  << " samples (" << stats.savings() * 100.0f << "% saved), rmse " << error * 100.0f << "%"
+                  << std::endl;
+    }
+    errors += prefilterStats.savings() < MinSavings ? 1 : 0;
+    std::cout << "prefilter: " << prefilterStats.samples << " of " << prefilterStats.fixedSamples << " samples ("
+              << prefilterStats.savings() * 100.0f << "% saved)" << std::endl;
+    const float irradianceError = EnvBaker::relativeRmse(irradiance, fixedIrradiance, 0);
+    errors += irradianceError > MaxIrradianceError || irradianceStats.savings() < MinSavings ? 1 : 0;
+    std::cout << "irradiance: " << irradianceStats.samples << " of " << irradianceStats.fixedSamples << " samples ("
+              << irradianceStats.savings() * 100.0f << "% saved), rmse " << irradianceError * 100.0f << "%"
+              << std::endl;
+    std::cout << "fixed " << fixedTime << " ms, adaptive " << adaptiveTime << " ms" << std::endl;
+    std::cout << errors << " errors" << std::endl;
+    return errors == 0 ? 0 : 1;
+}
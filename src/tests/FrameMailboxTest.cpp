@@ -0,0 +1,119 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+
+#include "src/tests/Tests.h"
+#include "src/common/FrameMailbox.h"
+#include "src/common/FrameSnapshot.h"
+
+// runs a simulated input loop and renderer for numFrames frames, first on one thread, then with the renderer on a
+// thread of its own fed through a FrameMailbox of FrameSnapshots. frames take a few milliseconds and every tenth
+// stalls like a driver would. checks every snapshot the renderer takes carries the transforms and camera published
+// with it, whole and newer than the last, and that with the render thread input keeps its rate through the stalls
+// and overlaps the frames
+int benchRenderThread(uint32_t numFrames) {
+    // enough transforms that a torn copy shows
+    const uint32_t NumTransforms = 512;
+    const std::chrono::microseconds InputPeriod(1000), FrameTime(4000), StallTime(25000);
+    const uint32_t StallInterval = 10;
+
+    const auto start = std::chrono::steady_clock::now();
+    auto milliseconds = [&]() {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+    uint32_t errors = 0;
+    double sequentialInputRate = 0.0;
+
+    for (bool threaded : {false, true}) {
+        FrameMailbox<FrameSnapshot> mailbox;
+        std::atomic<bool> running{true};
+        // publishes so far, the renderer reads it to tell whether input ran during a frame
+        std::atomic<uint64_t> inputTicks{0};
+        double maxInputGap = 0.0;
+        uint32_t overlapped = 0, torn = 0, reordered = 0;
+        uint64_t lastSequence = 0;
+
+        uint64_t published = 0;
+        auto input = [&]() {
+            // every transform moves its instance and the camera to the sequence number the snapshot gets
+            glm::mat4 transform{1.0f};
+            transform[3] = glm::vec4{float(++published), 0.0f, 0.0f, 1.0f};
+            mailbox.back().transforms.assign(NumTransforms, transform);
+            mailbox.back().camera.position = glm::vec3{float(published)};
+            mailbox.publish(milliseconds());
+            inputTicks.store(inputTicks.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        };
+        auto render = [&](uint32_t frame) {
+            if (mailbox.consume(milliseconds())) {
+                const FrameSnapshot &snapshot = mailbox.front();
+                const uint64_t sequence = mailbox.frontSequence();
+                const float expected = float(sequence);
+                const bool whole = snapshot.transforms.size() == NumTransforms &&
+                                   snapshot.camera.position.x == expected &&
+                                   std::all_of(snapshot.transforms.begin(), snapshot.transforms.end(),
+                                               [&](const glm::mat4 &transform) { return transform[3].x == expected; });
+                torn += whole ? 0 : 1;
+                reordered += sequence > lastSequence ? 0 : 1;
+                lastSequence = sequence;
+            }
+            const uint64_t ticks = inputTicks.load(std::memory_order_relaxed);
+            std::this_thread::sleep_for(frame % StallInterval == StallInterval - 1 ? StallTime : FrameTime);
+            overlapped += inputTicks.load(std::memory_order_relaxed) > ticks ? 1 : 0;
+        };
+
+        const double begin = milliseconds();
+        std::thread renderThread;
+        if (threaded) {
+            renderThread = std::thread([&]() {
+                for (uint32_t frame = 0; frame < numFrames; ++frame) {
+                    render(frame);
+                }
+                running = false;
+            });
+        }
+        double lastInput = begin;
+        auto nextTick = std::chrono::steady_clock::now();
+        for (uint32_t frame = 0; threaded ? running.load() : frame < numFrames; ++frame) {
+            input();
+            const double now = milliseconds();
+            maxInputGap = std::max(maxInputGap, now - lastInput);
+            lastInput = now;
+            if (threaded) {
+                nextTick = std::max(nextTick + InputPeriod, std::chrono::steady_clock::now());
+                std::this_thread::sleep_until(nextTick);
+            } else {
+                render(frame);
+            }
+        }
+        if (renderThread.joinable()) {
+            renderThread.join();
+        }
+        const double elapsed = milliseconds() - begin;
+
+        const FrameMailbox<FrameSnapshot>::Stats stats = mailbox.stats();
+        const double inputRate = stats.published * 1000.0 / elapsed;
+        errors += torn + reordered;
+        if (threaded) {
+            // input neither waits for a stall nor drops to the frame rate, and it runs while frames render
+            const double stallTime = std::chrono::duration<double, std::milli>(StallTime).count();
+            errors += maxInputGap < 0.5 * stallTime ? 0 : 1;
+            errors += inputRate > 2.0 * sequentialInputRate ? 0 : 1;
+            errors += overlapped >= numFrames * 9 / 10 ? 0 : 1;
+        } else {
+            sequentialInputRate = inputRate;
+        }
+
+        std::cout << (threaded ? "render thread" : "one thread") << ": " << numFrames << " frames in " << elapsed
+                  << " ms, " << numFrames * 1000.0 / elapsed << " frames/s, " << inputRate
+                  << " inputs/s, max input gap " << maxInputGap << " ms, " << overlapped << " frames overlapped input"
+                  << std::endl;
+        std::cout << "  " << stats.published << " published, " << stats.consumed << " consumed, " << stats.dropped
+                  << " dropped, latency " << stats.latency << " ms, max " << stats.maxLatency << " ms, " << torn
+                  << " torn, " << reordered << " out of order" << std::endl;
+    }
+    std::cout << errors << " errors" << std::endl;
+    return errors == 0 ? 0 : 1;
+}
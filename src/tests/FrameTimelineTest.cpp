@@ -0,0 +1,89 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <algorithm>
+
+#include "src/tests/Tests.h"
+#include "src/common/FrameTimeline.h"
+
+// frames on a simulated gpu clock for every number of frames in flight, gpu bound and cpu bound with a slow cpu frame
+// now and then. the gpu works through submitted frames in order and flips each one when it is done, the cpu waits for
+// the fence of the frame whose slot it reuses. checks the frames in flight never exceed the limit and the present
+// interval follows the slower side. gpu bound, more than one frame in flight hides the slow cpu frames. cpu bound,
+// the gpu drains every frame before the next one is submitted, so each slow frame stutters and a deeper queue
+// changes nothing over two frames in flight
+int benchFrameTimeline(uint32_t numFrames) {
+    struct Scenario {
+        const char *name;
+        double cpuTime, gpuTime;
+    };
+    const Scenario scenarios[] = {{"gpu bound", 4.0, 10.0}, {"cpu bound", 10.0, 4.0}};
+    // enough frames for a few slow ones in every case
+    numFrames = std::max(numFrames, 100u);
+    const uint32_t slowFrames = numFrames / 37;
+    uint32_t errors = 0;
+
+    for (const Scenario &scenario : scenarios) {
+        uint32_t shallowStutters = 0;
+        FrameTimeline::Stats doubleBuffered;
+        for (uint32_t latency = 1; latency <= FrameTimeline::MaxFramesInFlight; ++latency) {
+            FrameTimeline timeline(latency, numFrames);
+            std::mt19937 rng(1);
+            std::uniform_real_distribution<double> jitter(0.9, 1.1);
+            std::vector<double> gpuEnd;
+            double now = 0.0, gpuFree = 0.0;
+            uint64_t completed = 0;
+            auto observe = [&](double time) {
+                while (completed < gpuEnd.size() && gpuEnd[completed] <= time) {
+                    ++completed;
+                    // the flip happens when the gpu finishes the frame
+                    timeline.complete(completed, gpuEnd[completed - 1]);
+                    timeline.present(completed, gpuEnd[completed - 1]);
+                }
+            };
+
+            for (uint32_t frame = 0; frame < numFrames; ++frame) {
+                const double waitStart = now;
+                const uint64_t fence = timeline.waitFence();
+                if (fence > 0) {
+                    now = std::max(now, gpuEnd[fence - 1]);
+                }
+                observe(now);
+                timeline.beginFrame(waitStart, now);
+
+                now += scenario.cpuTime * jitter(rng) * (frame % 37 == 36 ? 3.0 : 1.0);
+                gpuFree = std::max(gpuFree, now) + scenario.gpuTime * jitter(rng);
+                gpuEnd.push_back(gpuFree);
+                timeline.submit(frame + 1, now);
+                errors += timeline.frame(frame)->inFlight > latency ? 1 : 0;
+            }
+            observe(gpuFree);
+
+            const FrameTimeline::Stats stats = timeline.stats();
+            // a single frame in flight serializes the cpu and the gpu
+            const double expected = latency == 1 ? scenario.cpuTime + scenario.gpuTime
+                                                 : std::max(scenario.cpuTime, scenario.gpuTime);
+            errors += stats.frames != numFrames || stats.interval < 0.95 * expected ||
+                      stats.interval > 1.25 * expected ? 1 : 0;
+            if (latency == 1) {
+                shallowStutters = stats.stutters;
+            } else if (latency == 2) {
+                doubleBuffered = stats;
+            }
+            if (scenario.gpuTime > scenario.cpuTime) {
+                errors += latency > 1 && stats.stutters >= shallowStutters ? 1 : 0;
+            } else {
+                errors += stats.stutters != slowFrames ? 1 : 0;
+                errors += latency > 1 && (stats.waitTime != 0.0 || stats.interval != doubleBuffered.interval ||
+                                          stats.frameLatency != doubleBuffered.frameLatency) ? 1 : 0;
+            }
+
+            std::cout << scenario.name << ", " << latency << " in flight: interval " << stats.interval
+                      << " ms, deviation " << stats.intervalDeviation << ", p99 " << stats.intervalP99 << ", "
+                      << stats.stutters << " stutters, latency " << stats.frameLatency << " ms, wait " << stats.waitTime
+                      << " ms, " << stats.framesInFlight << " frames in flight" << std::endl;
+        }
+    }
+    std::cout << errors << " errors" << std::endl;
+    return errors == 0 ? 0 : 1;
+}
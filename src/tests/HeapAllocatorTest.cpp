@@ -0,0 +1,149 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <cstdint>
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+
+#include "src/tests/Tests.h"
+#include "src/common/HeapAllocator.h"
+
+namespace {
+    void printHeapStats(const char *name, const HeapAllocator::Stats &stats) {
+        std::cout << "  " << name << ": " << stats.allocations << " allocations in " << stats.heaps << " heaps, "
+                  << (stats.allocatedBytes >> 20) << " of " << (stats.heapBytes >> 20) << " MB used, "
+                  << (stats.wastedBytes() >> 10) << " KB wasted, " << stats.freeBlocks << " free blocks, largest "
+                  << (stats.largestFreeBlock >> 20) << " MB, fragmentation " << stats.fragmentation() << std::endl;
+    }
+}
+
+// random allocations and frees of buffer, texture and render target sizes over 64 MB heaps, checked against a map of
+// the live ranges of every heap. half of them are freed again, then the defragment plans are applied and checked
+int benchHeapAllocator(uint32_t numOperations) {
+    std::mt19937 rng(1);
+    const uint64_t heapSize = 64 << 20, granularity = 4096;
+    const char *names[] = {"buffers", "textures", "render targets"};
+    HeapAllocator allocator(granularity);
+    uint32_t errors = 0;
+
+    // live ranges of every heap as offset to end, and the allocations that own them
+    std::vector<std::map<uint64_t, uint64_t>> ranges;
+    std::vector<uint32_t> live;
+    auto insertRange = [&](uint32_t allocation) {
+        const HeapAllocator::Allocation &placed = allocator.allocation(allocation);
+        ranges.resize(allocator.heaps().size());
+        std::map<uint64_t, uint64_t> &heap = ranges[placed.heap];
+        auto next = heap.lower_bound(placed.offset);
+        errors += next != heap.end() && next->first < placed.offset + placed.size ? 1 : 0;
+        errors += next != heap.begin() && std::prev(next)->second > placed.offset ? 1 : 0;
+        errors += placed.offset % placed.alignment != 0 ? 1 : 0;
+        errors += placed.offset + placed.size > allocator.heaps()[placed.heap].size ? 1 : 0;
+        heap[placed.offset] = placed.offset + placed.size;
+    };
+
+    double time = 0.0;
+    uint32_t heapsAdded = 0;
+    for (uint32_t i = 0; i < numOperations; ++i) {
+        if (live.empty() || (live.size() < 256 && rng() % 2 == 0)) {
+            const HeapAllocator::Category category = static_cast<HeapAllocator::Category>(rng() % 3);
+            uint64_t size, alignment = 64 << 10;
+            if (category == HeapAllocator::Buffers) {
+                size = (1 + rng() % 128) << 16;
+            } else if (category == HeapAllocator::Textures) {
+                // small textures with the 4 KB placement alignment
+                size = rng() % 4 == 0 ? (1 + rng() % 16) << 12 : (1 + rng() % 256) << 16;
+                alignment = size < (64 << 10) ? 4 << 10 : alignment;
+            } else {
+                // msaa targets, now and then one that needs a heap of its own
+                size = rng() % 64 == 0 ? (80 << 20) : (64 + rng() % 448) << 16;
+                alignment = 4 << 20;
+            }
+            auto start = std::chrono::steady_clock::now();
+            uint32_t allocation = allocator.allocate(category, size, alignment);
+            if (allocation == HeapAllocator::Invalid) {
+                allocator.addHeap(category, std::max(heapSize, (size + granularity - 1) / granularity * granularity));
+                allocation = allocator.allocate(category, size, alignment);
+                ++heapsAdded;
+            }
+            time += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            if (allocation == HeapAllocator::Invalid) {
+                ++errors;
+                continue;
+            }
+            insertRange(allocation);
+            live.push_back(allocation);
+        } else {
+            const uint32_t victim = rng() % live.size();
+            const uint32_t allocation = live[victim];
+            live[victim] = live.back();
+            live.pop_back();
+            ranges[allocator.allocation(allocation).heap].erase(allocator.allocation(allocation).offset);
+            auto start = std::chrono::steady_clock::now();
+            allocator.free(allocation);
+            time += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+    }
+
+    // every other allocation goes away, which leaves holes everywhere
+    std::vector<uint32_t> kept;
+    for (size_t i = 0; i < live.size(); ++i) {
+        if (i % 2 == 0) {
+            kept.push_back(live[i]);
+            continue;
+        }
+        ranges[allocator.allocation(live[i]).heap].erase(allocator.allocation(live[i]).offset);
+        allocator.free(live[i]);
+    }
+    live.swap(kept);
+    std::cout << numOperations << " operations, " << time * 1e6 / numOperations << " ns each, " << heapsAdded
+              << " heaps added" << std::endl;
+    std::cout << "fragmented:" << std::endl;
+    for (uint32_t category = 0; category < HeapAllocator::NumCategories; ++category) {
+        printHeapStats(names[category], allocator.stats(static_cast<HeapAllocator::Category>(category)));
+    }
+
+    // planned moves applied in order, the emptied heaps released
+    std::cout << "defragmented:" << std::endl;
+    for (uint32_t category = 0; category < HeapAllocator::NumCategories; ++category) {
+        const HeapAllocator::Plan plan =
+            allocator.planDefragment(static_cast<HeapAllocator::Category>(category), UINT64_MAX);
+        for (const HeapAllocator::Move &move : plan.moves) {
+            ranges[move.fromHeap].erase(move.fromOffset);
+            allocator.applyMove(move);
+            insertRange(move.allocation);
+        }
+        for (uint32_t heap : plan.emptiedHeaps) {
+            errors += allocator.heaps()[heap].allocations != 0 || !ranges[heap].empty() ? 1 : 0;
+            allocator.releaseHeap(heap);
+        }
+        printHeapStats(names[category], allocator.stats(static_cast<HeapAllocator::Category>(category)));
+        std::cout << "    " << plan.moves.size() << " moves, " << (plan.movedBytes >> 20) << " MB copied, "
+                  << plan.emptiedHeaps.size() << " heaps released" << std::endl;
+    }
+
+    // double frees throw, and every heap coalesces back into one free block
+    uint32_t throws = 0;
+    if (!live.empty()) {
+        allocator.free(live.back());
+        try {
+            allocator.free(live.back());
+        } catch (const std::runtime_error &) {
+            ++throws;
+        }
+        live.pop_back();
+    }
+    for (uint32_t allocation : live) {
+        allocator.free(allocation);
+    }
+    for (const HeapAllocator::Heap &heap : allocator.heaps()) {
+        errors += heap.size > 0 && (heap.allocations != 0 || heap.allocator.used() != 0 ||
+                                    heap.allocator.largestFreeBlock() != heap.size) ? 1 : 0;
+    }
+    errors += throws != 1 ? 1 : 0;
+
+    std::cout << errors << " errors" << std::endl;
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,173 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <algorithm>
+
+#include "src/tests/Tests.h"
+#include "src/common/ImageCompare.h"
+
+namespace {
+    uint32_t pack(int r, int g, int b) {
+        auto channel = [](int c) { return uint32_t(std::min(std::max(c, 0), 255)); };
+        return 0xff000000u | (channel(b) << 16) | (channel(g) << 8) | channel(r);
+    }
+
+    int channel(uint32_t pixel, int c) { return int((pixel >> (8 * c)) & 0xff); }
+
+    // gradients, stripes and a disc, every channel within [20, 235] so an offset of 20 never clips
+    std::vector<uint32_t> makeImage(uint32_t width, uint32_t height) {
+        std::vector<uint32_t> pixels(size_t(width) * height);
+        for (uint32_t y = 0; y < height; ++y) {
+            for (uint32_t x = 0; x < width; ++x) {
+                float u = float(x) / width, v = float(y) / height;
+                bool disc = (u - 0.6f) * (u - 0.6f) + (v - 0.4f) * (v - 0.4f) < 0.04f;
+                int r = 20 + int(215.0f * u);
+                int g = 20 + int(107.5f * (1.0f + std::sin(40.0f * u + 10.0f * v)));
+                int b = disc ? 235 : 20 + int(215.0f * v);
+                pixels[size_t(y) * width + x] = pack(r, g, b);
+            }
+        }
+        return pixels;
+    }
+
+    // the scalar versions of the sse loops: sum of squared differences and the separable SSIM filter with clamped
+    // edges, rows first, in the same order of operations
+    double scalarRmse(const std::vector<uint32_t> &a, const std::vector<uint32_t> &b) {
+        uint64_t total = 0;
+        for (size_t i = 0; i < a.size(); ++i) {
+            for (int c = 0; c < 3; ++c) {
+                int d = channel(a[i], c) - channel(b[i], c);
+                total += uint64_t(d * d);
+            }
+        }
+        return std::sqrt(double(total) / (3.0 * a.size() * 255.0 * 255.0));
+    }
+
+    std::vector<float> blur(const std::vector<float> &plane, uint32_t width, uint32_t height,
+                            const std::vector<float> &kernel) {
+        const int radius = static_cast<int>(kernel.size() / 2), w = int(width), h = int(height);
+        std::vector<float> rows(plane.size()), result(plane.size());
+        for (int y = 0; y < h; ++y) {
+            for (int x = 0; x < w; ++x) {
+                float sum = 0.0f;
+                for (int k = 0; k < int(kernel.size()); ++k) {
+                    sum += kernel[k] * plane[size_t(y) * w + std::min(std::max(x + k - radius, 0), w - 1)];
+                }
+                rows[size_t(y) * w + x] = sum;
+            }
+        }
+        for (int y = 0; y < h; ++y) {
+            for (int x = 0; x < w; ++x) {
+                float sum = 0.0f;
+                for (int k = 0; k < int(kernel.size()); ++k) {
+                    sum += kernel[k] * rows[size_t(std::min(std::max(y + k - radius, 0), h - 1)) * w + x];
+                }
+                result[size_t(y) * w + x] = sum;
+            }
+        }
+        return result;
+    }
+
+    float scalarSsim(const std::vector<uint32_t> &a, const std::vector<uint32_t> &b, uint32_t width,
+                     uint32_t height) {
+        std::vector<float> kernel(11);
+        float kernelSum = 0.0f;
+        for (int i = -5; i <= 5; ++i) {
+            kernel[i + 5] = std::exp(-float(i) * float(i) / (2.0f * 1.5f * 1.5f));
+            kernelSum += kernel[i + 5];
+        }
+        for (float &value : kernel) {
+            value /= kernelSum;
+        }
+
+        const size_t count = a.size();
+        std::vector<float> x(count), y(count), xx(count), yy(count), xy(count);
+        for (size_t i = 0; i < count; ++i) {
+            x[i] = (0.299f * channel(a[i], 0) + 0.587f * channel(a[i], 1) + 0.114f * channel(a[i], 2)) / 255.0f;
+            y[i] = (0.299f * channel(b[i], 0) + 0.587f * channel(b[i], 1) + 0.114f * channel(b[i], 2)) / 255.0f;
+            xx[i] = x[i] * x[i];
+            yy[i] = y[i] * y[i];
+            xy[i] = x[i] * y[i];
+        }
+        const std::vector<float> muX = blur(x, width, height, kernel), muY = blur(y, width, height, kernel);
+        const std::vector<float> sigmaXX = blur(xx, width, height, kernel), sigmaYY = blur(yy, width, height, kernel);
+        const std::vector<float> sigmaXY = blur(xy, width, height, kernel);
+
+        const float c1 = 0.01f * 0.01f, c2 = 0.03f * 0.03f;
+        double total = 0.0;
+        for (size_t i = 0; i < count; ++i) {
+            float mx = muX[i], my = muY[i];
+            float vx = sigmaXX[i] - mx * mx, vy = sigmaYY[i] - my * my, cxy = sigmaXY[i] - mx * my;
+            total += ((2.0f * mx * my + c1) * (2.0f * cxy + c2)) / ((mx * mx + my * my + c1) * (vx + vy + c2));
+        }
+        return static_cast<float>(total / count);
+    }
+}
+
+// compares a size wide procedural image with itself, with a constant offset and with growing noise: identical images
+// give an infinite PSNR, SSIM 1 and no FLIP error, the offset gives its RMSE exactly, and FLIP grows with the noise.
+// the RMSE and SSIM of the noisy images are checked against scalar versions of the sse loops at the size and at a
+// width that leaves a remainder of 3 pixels per row
+int benchImageCompare(uint32_t size) {
+    uint32_t errors = 0;
+    const uint32_t width = size, height = size * 3 / 4;
+    const std::vector<uint32_t> reference = makeImage(width, height);
+
+    const auto start = std::chrono::steady_clock::now();
+    const ImageMetrics same = ImageCompare::compare(reference.data(), reference.data(), width, height);
+    const double compareTime =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    errors += !std::isinf(same.psnr) || same.rmse != 0.0f || std::abs(same.ssim - 1.0f) > 1e-6f ? 1 : 0;
+    errors += same.flipMean != 0.0f || same.flipMax != 0.0f ? 1 : 0;
+
+    const int offset = 20;
+    std::vector<uint32_t> shifted(reference.size());
+    for (size_t i = 0; i < reference.size(); ++i) {
+        shifted[i] = pack(channel(reference[i], 0) + offset, channel(reference[i], 1) + offset,
+                          channel(reference[i], 2) + offset);
+    }
+    const ImageMetrics offsetMetrics = ImageCompare::compare(reference.data(), shifted.data(), width, height);
+    const float offsetError = std::abs(offsetMetrics.rmse - offset / 255.0f);
+    errors += offsetError > 1e-6f || std::abs(offsetMetrics.psnr - 20.0f * std::log10(255.0f / offset)) > 1e-3f ? 1 : 0;
+
+    // the same noise pattern at growing amplitudes
+    std::mt19937 rng(1);
+    std::normal_distribution<float> normal(0.0f, 1.0f);
+    std::vector<float> noise(reference.size() * 3);
+    for (float &value : noise) {
+        value = normal(rng);
+    }
+    float lastFlip = 0.0f, maxSsimError = 0.0f, maxRmseError = 0.0f;
+    for (float sigma : {2.0f, 8.0f, 32.0f}) {
+        for (uint32_t testWidth : {width, width + 3}) {
+            const std::vector<uint32_t> image = makeImage(testWidth, height);
+            std::vector<uint32_t> noisy(image.size());
+            for (size_t i = 0; i < image.size(); ++i) {
+                int c[3];
+                for (int k = 0; k < 3; ++k) {
+                    c[k] = channel(image[i], k) + int(std::lround(sigma * noise[(i * 3 + k) % noise.size()]));
+                }
+                noisy[i] = pack(c[0], c[1], c[2]);
+            }
+            const ImageMetrics metrics = ImageCompare::compare(image.data(), noisy.data(), testWidth, height);
+            maxRmseError = std::max(maxRmseError, float(std::abs(metrics.rmse - scalarRmse(image, noisy))));
+            maxSsimError = std::max(maxSsimError,
+                                    std::abs(metrics.ssim - scalarSsim(image, noisy, testWidth, height)));
+            if (testWidth == width) {
+                errors += metrics.flipMean > lastFlip ? 0 : 1;
+                lastFlip = metrics.flipMean;
+                std::cout << "noise " << sigma << ": psnr " << metrics.psnr << " dB, ssim " << metrics.ssim
+                          << ", flip mean " << metrics.flipMean << ", max " << metrics.flipMax << std::endl;
+            }
+        }
+    }
+    errors += maxRmseError > 1e-7f || maxSsimError > 1e-5f ? 1 : 0;
+
+    std::cout << width << "x" << height << " compared in " << compareTime << " ms, offset of " << offset
+              << " rmse error " << offsetError << ", sse against scalar: rmse " << maxRmseError << ", ssim "
+              << maxSsimError << std::endl;
+    std::cout << errors << " errors" << std::endl;
+    return errors == 0 ? 0 : 1;
+}
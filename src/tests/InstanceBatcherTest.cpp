@@ -0,0 +1,94 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <stdexcept>
+
+#include "src/tests/Tests.h"
+#include "src/common/InstanceBatcher.h"
+
+namespace {
+    const uint32_t NumMeshes = 16;
+    const uint32_t NumMaterials = 8;
+
+    // every visible instance drawn once in a batch of its mesh and material, batches sorted by mesh and material
+    // with one batch per pair, instances in scene order within a batch
+    uint32_t checkBatches(const InstanceBatcher &batcher, const std::vector<uint32_t> &meshes,
+                          const std::vector<uint32_t> &materials, const uint8_t *visible) {
+        uint32_t errors = 0;
+        const std::vector<uint32_t> &instances = batcher.instances();
+        std::vector<uint32_t> drawn(meshes.size(), 0);
+        uint32_t next = 0;
+        const InstanceBatcher::Batch *previous = nullptr;
+        for (const InstanceBatcher::Batch &batch : batcher.batches()) {
+            errors += batch.firstInstance != next || batch.numInstances == 0 ? 1 : 0;
+            if (previous) {
+                const bool ordered = previous->mesh < batch.mesh ||
+                                     (previous->mesh == batch.mesh && previous->material < batch.material);
+                errors += ordered ? 0 : 1;
+            }
+            for (uint32_t i = batch.firstInstance; i < batch.firstInstance + batch.numInstances; ++i) {
+                const uint32_t instance = instances[i];
+                errors += meshes[instance] != batch.mesh || materials[instance] != batch.material ? 1 : 0;
+                errors += i > batch.firstInstance && instances[i - 1] >= instance ? 1 : 0;
+                drawn[instance]++;
+            }
+            next = batch.firstInstance + batch.numInstances;
+            previous = &batch;
+        }
+        errors += next != instances.size() ? 1 : 0;
+        for (size_t instance = 0; instance < meshes.size(); ++instance) {
+            errors += drawn[instance] != (!visible || visible[instance] ? 1u : 0u) ? 1 : 0;
+        }
+        return errors;
+    }
+
+    bool throws(InstanceBatcher &batcher, uint32_t mesh, uint32_t material, uint8_t visible) {
+        try {
+            batcher.build(&mesh, &material, &visible, 1);
+        } catch (std::runtime_error &) {
+            return true;
+        }
+        return false;
+    }
+}
+
+// batches numInstances instances of random meshes and materials with about a third of them culled, then everything,
+// and checks the batches and their order. ids above MaxId have to throw unless the instance is culled
+int benchInstanceBatcher(uint32_t numInstances) {
+    uint32_t errors = 0;
+    std::mt19937 rng(1);
+    std::vector<uint32_t> meshes(numInstances), materials(numInstances);
+    std::vector<uint8_t> visible(numInstances);
+    uint32_t numVisible = 0;
+    for (uint32_t i = 0; i < numInstances; ++i) {
+        meshes[i] = rng() % NumMeshes;
+        materials[i] = rng() % NumMaterials;
+        visible[i] = rng() % 3 != 0;
+        numVisible += visible[i];
+    }
+
+    InstanceBatcher batcher;
+    const auto start = std::chrono::steady_clock::now();
+    batcher.build(meshes.data(), materials.data(), visible.data(), numInstances);
+    const double buildTime =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    errors += checkBatches(batcher, meshes, materials, visible.data());
+    errors += batcher.instances().size() != numVisible ? 1 : 0;
+    const size_t visibleBatches = batcher.batches().size();
+
+    batcher.build(meshes.data(), materials.data(), nullptr, numInstances);
+    errors += checkBatches(batcher, meshes, materials, nullptr);
+    errors += batcher.instances().size() != numInstances ? 1 : 0;
+
+    errors += throws(batcher, InstanceBatcher::MaxId + 1, 0, 1) ? 0 : 1;
+    errors += throws(batcher, 0, InstanceBatcher::MaxId + 1, 1) ? 0 : 1;
+    errors += throws(batcher, InstanceBatcher::MaxId + 1, 0, 0) ? 1 : 0;
+    errors += throws(batcher, InstanceBatcher::MaxId, InstanceBatcher::MaxId, 1) ? 1 : 0;
+    errors += batcher.batches().size() != 1 || batcher.batches()[0].mesh != InstanceBatcher::MaxId ? 1 : 0;
+
+    std::cout << numVisible << " of " << numInstances << " instances visible in " << visibleBatches
+              << " batches, built in " << buildTime << " ms" << std::endl;
+    std::cout << errors << " errors" << std::endl;
+    return errors == 0 ? 0 : 1;
+}
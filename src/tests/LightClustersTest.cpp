@@ -0,0 +1,93 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <glm.hpp>
+#include <gtc/matrix_transform.hpp>
+
+#include "src/tests/Tests.h"
+#include "src/common/LightClusters.h"
+#include "src/common/Parallel.h"
+
+// random point and spot lights in front of the camera, the cluster lists are checked against a brute force test of
+// every light with every cluster. lists may only hold lights that touch the cluster bounds, and must hold every light
+// whose sphere reaches into the frustum cell of the cluster
+int benchLightClusters(uint32_t numLights) {
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+    std::vector<ClusterLight> lights;
+    for (uint32_t i = 0; i < numLights; ++i) {
+        glm::vec3 position{400.0f * uniform(rng) - 200.0f, 60.0f * uniform(rng) - 20.0f,
+                           10.0f - 400.0f * uniform(rng)};
+        glm::vec3 radiance{100.0f * uniform(rng), 100.0f * uniform(rng), 100.0f * uniform(rng)};
+        float range = 5.0f + 20.0f * uniform(rng);
+        if (i % 2 == 0) {
+            lights.push_back(ClusterLight::point(position, radiance, range));
+        } else {
+            glm::vec3 direction{uniform(rng) - 0.5f, uniform(rng) - 0.5f, uniform(rng) - 0.5f};
+            float outer = 10.0f + 50.0f * uniform(rng);
+            lights.push_back(ClusterLight::spot(position, direction + glm::vec3(0.0f, 0.0f, 1e-3f), radiance, range,
+                                                0.5f * outer, outer));
+        }
+    }
+
+    const float fovY = glm::radians(60.0f), aspect = 16.0f / 9.0f, zNear = 0.1f, zFar = 1000.0f;
+    const glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 5.0f, 0.0f), glm::vec3(0.0f, 5.0f, -1.0f), glm::vec3(0, 1, 0));
+    LightClusters clusters;
+    const uint32_t numBuilds = 20;
+    double buildTime = 0.0;
+    for (uint32_t i = 0; i < numBuilds; ++i) {
+        clusters.build(view, fovY, aspect, zNear, zFar, lights.data(), numLights);
+        buildTime += clusters.stats().buildTime;
+    }
+
+    const float tanY = std::tan(0.5f * fovY), tanX = tanY * aspect;
+    const std::vector<glm::uvec2> &ranges = clusters.clusterRanges();
+    const std::vector<uint32_t> &indices = clusters.lightIndices();
+    std::vector<uint8_t> listed(numLights);
+    uint64_t outsideBounds = 0, missed = 0;
+    for (uint32_t cluster = 0; cluster < LightClusters::NumClusters; ++cluster) {
+        glm::vec3 boundsMin, boundsMax;
+        clusters.clusterBounds(cluster, boundsMin, boundsMax);
+        const uint32_t x = cluster % LightClusters::TilesX;
+        const uint32_t y = cluster / LightClusters::TilesX % LightClusters::TilesY;
+        const float x0 = (-1.0f + 2.0f * x / LightClusters::TilesX) * tanX;
+        const float x1 = (-1.0f + 2.0f * (x + 1) / LightClusters::TilesX) * tanX;
+        const float y0 = (1.0f - 2.0f * (y + 1) / LightClusters::TilesY) * tanY;
+        const float y1 = (1.0f - 2.0f * y / LightClusters::TilesY) * tanY;
+        // inward side planes of the cell through the eye
+        const glm::vec3 planes[4] = {glm::normalize(glm::vec3(1.0f, 0.0f, x0)),
+                                     glm::normalize(glm::vec3(-1.0f, 0.0f, -x1)),
+                                     glm::normalize(glm::vec3(0.0f, 1.0f, y0)),
+                                     glm::normalize(glm::vec3(0.0f, -1.0f, -y1))};
+
+        std::fill(listed.begin(), listed.end(), 0);
+        for (uint32_t i = ranges[cluster].x; i < ranges[cluster].x + ranges[cluster].y; ++i) {
+            listed[indices[i]] = 1;
+        }
+        for (uint32_t i = 0; i < numLights; ++i) {
+            ClusterLight viewLight = lights[i];
+            viewLight.position = glm::vec3(view * glm::vec4(lights[i].position, 1.0f));
+            viewLight.direction = glm::mat3(view) * lights[i].direction;
+            const bool touches = LightClusters::intersects(viewLight, boundsMin, boundsMax);
+            bool inCell = touches;
+            for (const glm::vec3 &plane : planes) {
+                inCell = inCell && glm::dot(plane, viewLight.position) >= -viewLight.range;
+            }
+            outsideBounds += listed[i] && !touches ? 1 : 0;
+            missed += !listed[i] && inCell ? 1 : 0;
+        }
+    }
+
+    const LightClusters::Stats &stats = clusters.stats();
+    std::cout << numLights << " lights, " << LightClusters::TilesX << "x" << LightClusters::TilesY << "x"
+              << LightClusters::Slices << " clusters, " << ThreadPool::instance().numThreads() << " threads"
+              << std::endl;
+    std::cout << "build " << buildTime / numBuilds << " ms average, " << stats.indices << " indices ("
+              << double(stats.indices) / LightClusters::NumClusters << " per cluster, max "
+              << stats.maxLightsPerCluster << ", " << stats.emptyClusters << " empty clusters)" << std::endl;
+    std::cout << outsideBounds << " listed lights outside the cluster bounds, " << missed
+              << " lights reaching into a cluster missing from its list" << std::endl;
+    return outsideBounds == 0 && missed == 0 ? 0 : 1;
+}
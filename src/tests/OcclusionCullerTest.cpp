@@ -0,0 +1,147 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <glm.hpp>
+#include <gtc/matrix_transform.hpp>
+
+#include "src/tests/Tests.h"
+#include "src/common/OcclusionCuller.h"
+#include "src/common/Parallel.h"
+#include "src/backend/soft/Rasterizer.h"
+
+// walks down a street of a procedural city with the occlusion culler, once with the two pass culling and once drawing
+// every occluder, and checks the culled instances against the visibility buffer of the full resolution rasterizer
+int benchOcclusionCulling(uint32_t numProps) {
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+
+    // unit cube around the origin, counter clockwise seen from outside
+    std::vector<glm::vec3> cubePositions;
+    std::vector<uint32_t> cubeIndices;
+    for (int axis = 0; axis < 3; ++axis) {
+        for (float sign : {-1.0f, 1.0f}) {
+            glm::vec3 normal(0.0f), u(0.0f), v(0.0f);
+            normal[axis] = sign;
+            u[(axis + 1) % 3] = sign;
+            v[(axis + 2) % 3] = 1.0f;
+            const uint32_t base = static_cast<uint32_t>(cubePositions.size());
+            for (glm::vec2 corner : {glm::vec2{-1.0f, -1.0f}, {1.0f, -1.0f}, {1.0f, 1.0f}, {-1.0f, 1.0f}}) {
+                cubePositions.push_back(0.5f * (normal + corner.x * u + corner.y * v));
+            }
+            cubeIndices.insert(cubeIndices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+        }
+    }
+
+    // blocks of buildings 40 apart with streets between them, props anywhere at street level
+    OcclusionCuller culler;
+    const int32_t cube = culler.addOccluder(cubePositions.data(), cubePositions.size(), cubeIndices.data(),
+                                            cubeIndices.size());
+    std::vector<OcclusionCuller::Instance> instances;
+    const int blocks = 24;
+    for (int i = 0; i < blocks * blocks; ++i) {
+        glm::vec3 size{20.0f + 10.0f * uniform(rng), 10.0f + 70.0f * uniform(rng), 20.0f + 10.0f * uniform(rng)};
+        glm::vec3 center{40.0f * (i % blocks), 0.5f * size.y, 40.0f * (i / blocks)};
+        instances.push_back({glm::scale(glm::translate(glm::mat4(1.0f), center), size), glm::vec3(-0.5f),
+                             glm::vec3(0.5f), cube});
+    }
+    const uint32_t numOccluders = static_cast<uint32_t>(instances.size());
+    for (uint32_t i = 0; i < numProps; ++i) {
+        float size = 1.0f + 3.0f * uniform(rng);
+        glm::vec3 center{40.0f * blocks * uniform(rng) - 20.0f, 0.5f * size, 40.0f * blocks * uniform(rng) - 20.0f};
+        instances.push_back({glm::scale(glm::translate(glm::mat4(1.0f), center), glm::vec3(size)), glm::vec3(-0.5f),
+                             glm::vec3(0.5f), -1});
+    }
+
+    const uint32_t numFrames = 120;
+    const glm::mat4 proj = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 2000.0f);
+    auto viewProjAt = [&](uint32_t frame) {
+        float t = float(frame) / numFrames;
+        glm::vec3 eye{40.0f * 10 + 20.0f, 2.0f, 40.0f * blocks * t - 20.0f};
+        float yaw = 0.6f * std::sin(6.2831853f * t);
+        return proj * glm::lookAt(eye, eye + glm::vec3{std::sin(yaw), 0.0f, std::cos(yaw)}, glm::vec3{0, 1, 0});
+    };
+
+    // reference visibility from the cubes of every instance
+    Rasterizer rasterizer;
+    rasterizer.resize(1280, 720);
+    std::vector<glm::vec4> clip(instances.size() * cubePositions.size());
+    std::vector<uint32_t> indices;
+    for (uint32_t i = 0; i < instances.size(); ++i) {
+        for (uint32_t index : cubeIndices) {
+            indices.push_back(static_cast<uint32_t>(i * cubePositions.size()) + index);
+        }
+    }
+
+    std::vector<uint8_t> visible, seen(instances.size());
+    double rasterizeTime = 0.0, testTime = 0.0, allOccludersTime = 0.0;
+    uint64_t occludersDrawn = 0, frustumCulled = 0, occluded = 0, occludedFirstPass = 0;
+    uint32_t falseCulls = 0, seenTotal = 0;
+    for (uint32_t frame = 0; frame < numFrames; ++frame) {
+        const glm::mat4 viewProj = viewProjAt(frame);
+        culler.cull(viewProj, instances, visible);
+        const OcclusionCuller::Stats &stats = culler.stats();
+        rasterizeTime += stats.rasterizeTime;
+        testTime += stats.testTime;
+        occludersDrawn += stats.occludersDrawn;
+        frustumCulled += stats.frustumCulled;
+        occluded += stats.occluded;
+        occludedFirstPass += stats.occludedFirstPass;
+
+        for (uint32_t i = 0; i < instances.size(); ++i) {
+            for (uint32_t v = 0; v < cubePositions.size(); ++v) {
+                clip[i * cubePositions.size() + v] = viewProj * instances[i].world * glm::vec4(cubePositions[v], 1.0f);
+            }
+        }
+        rasterizer.draw(clip.data(), indices.data(), indices.size());
+        std::fill(seen.begin(), seen.end(), 0);
+        for (uint32_t y = 0; y < rasterizer.height(); ++y) {
+            for (uint32_t x = 0; x < rasterizer.width(); ++x) {
+                uint32_t triangle = rasterizer.triangleAt(x, y);
+                if (triangle != Rasterizer::NoTriangle) {
+                    seen[rasterizer.primitive(triangle) / (cubeIndices.size() / 3)] = 1;
+                }
+            }
+        }
+        for (uint32_t i = 0; i < instances.size(); ++i) {
+            seenTotal += seen[i];
+            falseCulls += seen[i] && !visible[i] ? 1 : 0;
+        }
+    }
+
+    std::vector<uint32_t> all(numOccluders);
+    for (uint32_t i = 0; i < numOccluders; ++i) {
+        all[i] = i;
+    }
+    for (uint32_t frame = 0; frame < numFrames; ++frame) {
+        const glm::mat4 viewProj = viewProjAt(frame);
+        auto start = std::chrono::steady_clock::now();
+        culler.clear();
+        culler.drawOccluders(viewProj, instances, all);
+        parallelForRange(0, static_cast<uint32_t>(instances.size()), [&](uint32_t first, uint32_t last) {
+            for (uint32_t i = first; i < last; ++i) {
+                visible[i] = culler.testBounds(viewProj * instances[i].world, instances[i].boundsMin,
+                                               instances[i].boundsMax) == OcclusionCuller::Result::Visible;
+            }
+        }, 256);
+        allOccludersTime += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    const double total = double(numFrames) * instances.size();
+    std::cout << culler.width() << "x" << culler.height() << " depth, " << instances.size() << " instances ("
+              << numOccluders << " occluders), " << numFrames << " frames, " << ThreadPool::instance().numThreads()
+              << " threads" << std::endl;
+    std::cout << "two pass: " << (rasterizeTime + testTime) / numFrames << " ms average (rasterize "
+              << rasterizeTime / numFrames << " ms, test " << testTime / numFrames << " ms), "
+              << double(occludersDrawn) / numFrames << " occluders drawn, culled "
+              << 100.0 * (frustumCulled + occluded) / total << "% (frustum "
+              << 100.0 * frustumCulled / total << "%, occluded " << 100.0 * occluded / total << "%, by the first pass "
+              << 100.0 * occludedFirstPass / total << "%)" << std::endl;
+    std::cout << "all occluders: " << allOccludersTime / numFrames << " ms average" << std::endl;
+    std::cout << falseCulls << " of " << seenTotal
+              << " instances visible in the full resolution rasterizer were culled, summed over all frames"
+              << std::endl;
+    return 0;
+}
@@ -0,0 +1,119 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+#include "src/tests/Tests.h"
+#include "src/common/OctahedralMap.h"
+
+namespace {
+    // sky over ground with bands around the horizon, and with the sun a small feature twenty times as bright
+    glm::vec4 environment(const glm::vec3 &dir, bool sun) {
+        const glm::vec3 sunDir = glm::normalize(glm::vec3{0.4f, 0.6f, -0.7f});
+        const float sky = glm::smoothstep(-0.05f, 0.05f, dir.y);
+        glm::vec3 color = glm::mix(glm::vec3{0.3f, 0.25f, 0.2f}, glm::vec3{0.4f, 0.6f, 1.0f}, sky);
+        color += glm::vec3{0.5f} * (0.5f + 0.5f * std::sin(24.0f * std::atan2(dir.z, dir.x))) *
+                 std::exp(-16.0f * dir.y * dir.y);
+        if (sun) {
+            color += glm::vec3{20.0f, 18.0f, 15.0f} * std::pow(std::max(glm::dot(dir, sunDir), 0.0f), 256.0f);
+        }
+        return glm::vec4{color, 1.0f};
+    }
+
+    // relative rms of a converted level against the cube level, by the cube's face size at that level. the bands
+    // are lost as the faces shrink, the last level puts the sphere into a 2x2 interior against 24 texels of the cube
+    // and only serves the roughest lobes
+    double maxLevelError(uint32_t cubeSize) {
+        return cubeSize >= 32 ? 0.025 : cubeSize >= 16 ? 0.06 : cubeSize >= 8 ? 0.12 : cubeSize >= 4 ? 0.16 : 0.45;
+    }
+
+    // rms rgb error of level 0 lookups against the analytic environment, relative to its rms
+    template <typename Map>
+    double sourceError(const Map &map, bool sun, uint32_t numDirections) {
+        const float goldenAngle = PI * (3.0f - std::sqrt(5.0f));
+        double sumSq = 0.0, refSq = 0.0;
+        for (uint32_t i = 0; i < numDirections; ++i) {
+            float y = 1.0f - 2.0f * (i + 0.5f) / numDirections;
+            float r = std::sqrt(std::max(0.0f, 1.0f - y * y));
+            glm::vec3 dir{r * std::cos(goldenAngle * i), y, r * std::sin(goldenAngle * i)};
+
+            glm::vec3 expected = environment(dir, sun);
+            glm::vec3 diff = glm::vec3(map.sample(dir)) - expected;
+            sumSq += glm::dot(diff, diff);
+            refSq += glm::dot(expected, expected);
+        }
+        return std::sqrt(sumSq / refSq);
+    }
+}
+
+// bakes a cube map of faceSize and an octahedral map of sizeForCubeFace(faceSize) from an analytic environment,
+// converts the cube the way the renderer does and reports the errors against the environment, the error of the
+// converted chain against the cube per level and the bytes of either chain. checks that the levels halve, that the
+// octahedral map takes 2/3 of the bytes and, for the smooth source, that it is no worse than the cube when baked and
+// within twice the cube's error when converted from it. the converted chain has to cover every cube level above 1x1
+// with each level within maxLevelError() of the cube
+int benchOctahedralMap(uint32_t faceSize) {
+    uint32_t errors = 0;
+    const uint32_t size = OctahedralMap::sizeForCubeFace(faceSize);
+    const uint32_t numDirections = 1 << 16;
+
+    for (bool sun : {false, true}) {
+        auto source = [sun](const glm::vec3 &dir) { return environment(dir, sun); };
+        CubeMap cube(faceSize);
+        for (uint32_t faceIndex = 0; faceIndex < 6; ++faceIndex) {
+            glm::vec4 *texels = cube.face(0, faceIndex);
+            for (uint32_t y = 0; y < faceSize; ++y) {
+                for (uint32_t x = 0; x < faceSize; ++x) {
+                    texels[y * faceSize + x] =
+                        source(CubeMap::direction(faceIndex, (x + 0.5f) / faceSize, (y + 0.5f) / faceSize));
+                }
+            }
+        }
+        cube.generateMipmaps();
+        const OctahedralMap baked = OctahedralMap::fromSource(size, 1, source);
+        const OctahedralMap converted = OctahedralMap::fromCubeLevels(cube, size);
+
+        const double cubeError = sourceError(cube, sun, numDirections);
+        const double bakedError = sourceError(baked, sun, numDirections);
+        const double convertedError = sourceError(converted, sun, numDirections);
+        std::cout << (sun ? "with the sun" : "smooth") << ", against the environment: cube " << faceSize << " "
+                  << cubeError * 100.0 << "%, octahedral " << size << " baked " << bakedError * 100.0
+                  << "%, converted from the cube " << convertedError * 100.0 << "% rms" << std::endl;
+        errors += !sun && (bakedError > cubeError || convertedError > 2.0 * cubeError) ? 1 : 0;
+
+        // the last levels have few interior texels left, the chains only agree where there is little detail
+        if (!sun) {
+            errors += converted.levels() + 1 != cube.levels() ? 1 : 0;
+            for (uint32_t level = 0; level < converted.levels(); ++level) {
+                OctahedralMap::ErrorStats stats =
+                    OctahedralMap::compare(converted, cube, float(level), numDirections);
+                errors += stats.relativeRmse > maxLevelError(cube.size(level)) ? 1 : 0;
+                std::cout << "level " << level << " (" << converted.interiorSize(level) << " against "
+                          << cube.size(level) << "): " << stats.relativeRmse * 100.0 << "% rms, max "
+                          << stats.maxError << std::endl;
+            }
+        }
+    }
+
+    // every level is half the one above, with the border inside it, down to a 2x2 interior
+    const OctahedralMap map(size);
+    for (uint32_t level = 0; level < map.levels(); ++level) {
+        errors += map.size(level) != size >> level || map.interiorSize(level) != map.size(level) - 2 ? 1 : 0;
+    }
+    errors += map.interiorSize(map.levels() - 1) != 2 ? 1 : 0;
+    try {
+        OctahedralMap(size + 2);
+        ++errors;
+    } catch (const std::runtime_error &) {
+    }
+
+    // the half float chains the renderer allocates, the cube's down to 1x1
+    const size_t cubeBytes = CubeMap(faceSize).byteSize(), octahedralBytes = map.byteSize();
+    std::cout << "cube " << cubeBytes / 1024 << " KB, octahedral " << octahedralBytes / 1024 << " KB ("
+              << 100.0 * octahedralBytes / cubeBytes << "%)" << std::endl;
+    errors += octahedralBytes * 3 > cubeBytes * 2 ? 1 : 0;
+
+    std::cout << errors << " errors" << std::endl;
+    return errors == 0 ? 0 : 1;
+}
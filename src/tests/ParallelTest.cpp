@@ -0,0 +1,71 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <stdexcept>
+
+#include "src/tests/Tests.h"
+#include "src/common/Parallel.h"
+
+// parallelFor over numItems items, flat and nested, then jobs that throw on the calling thread and on the workers.
+// checks every item runs exactly once, that the exception reaches the caller, that no chunk runs after the call
+// returned and that the pool takes the next job afterwards
+int benchParallel(uint32_t numItems) {
+    uint32_t errors = 0;
+    const uint32_t numThreads = ThreadPool::instance().numThreads();
+
+    std::vector<std::atomic<uint32_t>> counts(numItems);
+    auto start = std::chrono::steady_clock::now();
+    parallelFor(0, numItems, [&](uint32_t i) { counts[i].fetch_add(1, std::memory_order_relaxed); }, 64);
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    for (const std::atomic<uint32_t> &count : counts) {
+        errors += count.load() == 1 ? 0 : 1;
+    }
+
+    // the inner loops run on the thread of the outer item. outer items sleep so that the calling thread takes some
+    const uint32_t outer = 64;
+    std::vector<std::atomic<uint32_t>> nested(outer * outer);
+    parallelFor(0, outer, [&](uint32_t i) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        parallelFor(0, outer, [&](uint32_t j) { nested[i * outer + j].fetch_add(1, std::memory_order_relaxed); });
+    });
+    for (const std::atomic<uint32_t> &count : nested) {
+        errors += count.load() == 1 ? 0 : 1;
+    }
+
+    // throws on the calling thread, then on every worker. items sleep so that every thread gets chunks
+    const std::thread::id caller = std::this_thread::get_id();
+    for (bool onCaller : {true, false}) {
+        if (!onCaller && numThreads == 1) {
+            continue;
+        }
+        std::atomic<uint32_t> calls{0};
+        bool caught = false;
+        try {
+            parallelFor(0, 1024, [&](uint32_t) {
+                calls.fetch_add(1);
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+                if ((std::this_thread::get_id() == caller) == onCaller) {
+                    throw std::runtime_error("item failed");
+                }
+            });
+        } catch (std::runtime_error &) {
+            caught = true;
+        }
+        const uint32_t callsAtReturn = calls.load();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        errors += caught ? 0 : 1;
+        errors += calls.load() == callsAtReturn ? 0 : 1;
+        std::cout << "throwing on the " << (onCaller ? "calling thread" : "workers") << ": " << callsAtReturn
+                  << " of 1024 items ran, " << (caught ? "rethrown" : "NOT rethrown") << std::endl;
+    }
+
+    std::atomic<uint32_t> after{0};
+    parallelFor(0, numItems, [&](uint32_t) { after.fetch_add(1, std::memory_order_relaxed); }, 64);
+    errors += after.load() == numItems ? 0 : 1;
+
+    std::cout << numItems << " items on " << numThreads << " threads in " << elapsed.count() << " ms" << std::endl;
+    std::cout << errors << " errors" << std::endl;
+    return errors == 0 ? 0 : 1;
+}
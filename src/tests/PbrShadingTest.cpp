@@ -0,0 +1,144 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+#include "src/tests/Tests.h"
+#include "src/common/PbrShading.h"
+#include "src/common/EnvBaker.h"
+#include "src/common/BrdfLut.h"
+#include "src/common/CpuTexture.h"
+
+namespace {
+    // a white dielectric facing the light at distance along the light's axis, lit by nothing else
+    float directLight(const ClusterLight &light, float distance, float offAxisDegrees = 0.0f) {
+        const float angle = glm::radians(offAxisDegrees);
+        const glm::vec3 axis = light.isSpot() ? light.direction : glm::vec3{0.0f, 0.0f, -1.0f};
+        const glm::vec3 side = glm::normalize(glm::cross(axis, glm::vec3{0.0f, 1.0f, 0.0f}));
+        const glm::vec3 toSurface = std::cos(angle) * axis + std::sin(angle) * side;
+        PbrScene scene;
+        scene.lights = &light;
+        scene.numLights = 1;
+        PbrSurface surface;
+        surface.position = light.position + distance * toSurface;
+        surface.N = -toSurface;
+        surface.albedo = glm::vec3{1.0f};
+        surface.metalness = 0.0f;
+        surface.roughness = 1.0f;
+        scene.cameraPos = surface.position + surface.N;
+        return PbrShading::shadeScalar(surface, scene).g;
+    }
+}
+
+// checks the falloff and spot cone of PbrShading against the formulas of pbr.hlsl: inverse square well inside the
+// range, zero past it, a spot inside its inner cone equal to a point light and dark outside the outer one. then shades
+// random surfaces on one thread with every isa the cpu supports under DxRenderer's light and a spot, and reports
+// pixels per second and the largest difference from PbrShading::shadeScalar
+int benchPbrShading(uint32_t numPixels) {
+    uint32_t errors = 0;
+    const ClusterLight point = ClusterLight::point(glm::vec3{0.0f}, glm::vec3{1000.0f}, 100.0f);
+    const float near = directLight(point, 2.0f), far = directLight(point, 4.0f);
+    // the window is 1 - (d / range)^4 squared, under 1e-5 away from 1 at these distances
+    const float falloffError = std::abs(near / far - 4.0f) / 4.0f;
+    errors += falloffError > 1e-4f ? 1 : 0;
+    const float pastRange = directLight(point, 100.5f);
+    errors += pastRange != 0.0f || directLight(point, 99.0f) <= 0.0f ? 1 : 0;
+
+    const ClusterLight spot = ClusterLight::spot(glm::vec3{0.0f}, glm::vec3{0.0f, -1.0f, 1.0f}, glm::vec3{1000.0f},
+                                                 100.0f, 20.0f, 30.0f);
+    const float inner = directLight(spot, 3.0f, 10.0f), outside = directLight(spot, 3.0f, 35.0f);
+    // between the cones the squared linear ramp of the cosine
+    const float ramp = (std::cos(glm::radians(25.0f)) - spot.cosOuter) / (spot.cosInner - spot.cosOuter);
+    const float edge = directLight(spot, 3.0f, 25.0f);
+    const float spotError = std::abs(inner - directLight(point, 3.0f)) / inner;
+    errors += spotError > 1e-5f || outside != 0.0f || std::abs(edge / inner - ramp * ramp) > 1e-3f ? 1 : 0;
+    std::cout << "falloff: inverse square error " << falloffError << ", past the range " << pastRange
+              << "; spot: inner cone error " << spotError << ", edge " << edge / inner << ", outside " << outside
+              << std::endl;
+
+    // procedural sky with a small sun, so the benchmark needs no assets
+    CubeMap env(64);
+    const glm::vec3 sunDir = glm::normalize(glm::vec3{1.0f, 1.0f, 0.0f});
+    for (uint32_t faceIndex = 0; faceIndex < 6; ++faceIndex) {
+        for (uint32_t y = 0; y < env.size(); ++y) {
+            for (uint32_t x = 0; x < env.size(); ++x) {
+                float s = (x + 0.5f) / env.size(), t = (y + 0.5f) / env.size();
+                glm::vec3 dir = glm::normalize(CubeMap::direction(faceIndex, s, t));
+                glm::vec3 color = glm::mix(glm::vec3{0.2f, 0.15f, 0.1f}, glm::vec3{0.4f, 0.6f, 1.0f},
+                                           dir.y * 0.5f + 0.5f);
+                if (glm::dot(dir, sunDir) > 0.98f) {
+                    color = glm::vec3{20.0f};
+                }
+                env.face(0, faceIndex)[y * env.size() + x] = glm::vec4{color, 1.0f};
+            }
+        }
+    }
+    env.generateMipmaps();
+    EnvBaker::Settings settings;
+    CpuTexture prefilter = CpuTexture::fromCubeMap(EnvBaker::prefilter(env, settings), TexelFormat::RGBA16F);
+    CpuTexture irradiance = CpuTexture::fromCubeMap(EnvBaker::irradiance(env, 32, settings), TexelFormat::RGBA16F);
+    CpuTexture brdfLut = BrdfLut::embedded().toTexture();
+
+    // the light of DxRenderer::setup() and a spot whose cone covers part of the surfaces
+    const ClusterLight lights[] = {
+        ClusterLight::point(glm::normalize(glm::vec3(5.0f)) * 500.0f, glm::vec3(250000.0f), 2000.0f),
+        ClusterLight::spot(glm::vec3{0.0f, 40.0f, 0.0f}, glm::vec3{0.0f, -1.0f, 0.0f}, glm::vec3{5000.0f}, 80.0f,
+                           15.0f, 30.0f),
+    };
+    PbrScene scene;
+    scene.lights = lights;
+    scene.numLights = 2;
+    scene.cameraPos = glm::vec3{-100.0f, 20.0f, 100.0f};
+    scene.irradiance = &irradiance;
+    scene.prefilter = &prefilter;
+    scene.brdfLut = &brdfLut;
+
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+    const uint32_t numBatches = (numPixels + PbrBatch::Width - 1) / PbrBatch::Width;
+    std::vector<PbrBatch> batches(numBatches);
+    for (uint32_t i = 0; i < numBatches * PbrBatch::Width; ++i) {
+        PbrSurface surface;
+        surface.position = 60.0f * glm::vec3{uniform(rng), uniform(rng), uniform(rng)} - 30.0f;
+        surface.N = glm::normalize(2.0f * glm::vec3{uniform(rng), uniform(rng), uniform(rng)} - 1.0f);
+        surface.albedo = glm::vec3{uniform(rng), uniform(rng), uniform(rng)};
+        surface.metalness = uniform(rng);
+        surface.roughness = 0.05f + 0.95f * uniform(rng);
+        batches[i / PbrBatch::Width].set(i % PbrBatch::Width, surface);
+    }
+
+    std::vector<PbrBatchResult> results(numBatches);
+    std::vector<glm::vec3> reference(numBatches * PbrBatch::Width);
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < reference.size(); ++i) {
+        reference[i] = PbrShading::shadeScalar(batches[i / PbrBatch::Width].get(i % PbrBatch::Width), scene);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "reference: " << reference.size() / elapsed.count() / 1e6 << " Mpixels/s" << std::endl;
+
+    for (PbrShading::Isa isa : {PbrShading::Isa::Scalar, PbrShading::Isa::AVX2}) {
+        if (isa == PbrShading::Isa::AVX2 && PbrShading::bestIsa() != PbrShading::Isa::AVX2) {
+            std::cout << "avx2: not supported by this cpu" << std::endl;
+            continue;
+        }
+        start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < numBatches; ++i) {
+            PbrShading::shade(batches[i], PbrBatch::Width, scene, results[i], isa);
+        }
+        elapsed = std::chrono::steady_clock::now() - start;
+
+        // relative to the color, absolute below 1
+        float maxError = 0.0f;
+        for (uint32_t i = 0; i < reference.size(); ++i) {
+            glm::vec3 color = results[i / PbrBatch::Width].get(i % PbrBatch::Width);
+            glm::vec3 error = glm::abs(color - reference[i]) / glm::max(glm::abs(reference[i]), glm::vec3{1.0f});
+            maxError = std::max(maxError, std::max(error.r, std::max(error.g, error.b)));
+        }
+        errors += maxError > 2e-3f ? 1 : 0;
+        std::cout << PbrShading::isaName(isa) << ": " << reference.size() / elapsed.count() / 1e6
+                  << " Mpixels/s, max error " << maxError << std::endl;
+    }
+    std::cout << errors << " errors" << std::endl;
+    return errors == 0 ? 0 : 1;
+}
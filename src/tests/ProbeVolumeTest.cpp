@@ -0,0 +1,147 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+
+#include "src/tests/Tests.h"
+#include "src/common/ProbeVolume.h"
+
+namespace {
+    const glm::vec3 BoundsMin{-1.0f}, BoundsMax{1.0f};
+    const glm::uvec3 Resolution{5};
+    const glm::vec3 Radiance{0.5f, 1.0f, 2.0f};
+
+    const glm::vec3 Normals[] = {{1.0f, 0.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f},
+                                 {0.0f, -1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, -1.0f}};
+
+    float relativeDifference(const glm::vec3 &a, const glm::vec3 &b) {
+        return glm::length(a - b) / std::max(glm::length(b), 1e-6f);
+    }
+
+    float maxDifference(const SHL2 &a, const SHL2 &b) {
+        float difference = 0.0f;
+        for (uint32_t i = 0; i < SHL2::NumCoefficients; ++i) {
+            glm::vec3 d = glm::abs(a.coefficients[i] - b.coefficients[i]);
+            difference = std::max(difference, std::max(d.x, std::max(d.y, d.z)));
+        }
+        return difference;
+    }
+
+    SHL2 probeSH(const ProbeVolume &volume, uint32_t index) {
+        glm::vec4 packed[ProbeVolume::NumPlanes];
+        for (uint32_t k = 0; k < ProbeVolume::NumPlanes; ++k) {
+            packed[k] = volume.plane(k)[index];
+        }
+        return SHL2::unpack(packed);
+    }
+
+    // two triangles over the whole box at height y
+    void addFloor(ProbeVolume &volume, float y) {
+        const glm::vec3 positions[] = {{-2.0f, y, -2.0f}, {2.0f, y, -2.0f}, {2.0f, y, 2.0f}, {-2.0f, y, 2.0f}};
+        const uint32_t indices[] = {0, 1, 2, 0, 2, 3};
+        volume.addOccluder(positions, indices, 6);
+    }
+}
+
+// bakes a 5x5x5 volume over a constant environment with numDirections rays per probe, at least 256: open, under a
+// floor that cuts it in two and with a triangle through one probe. checks the open probes against the constant and
+// against SHL2 projected directly, that the floor blocks the half space behind it, that sample() returns the probes
+// at their positions and blends them linearly in between, and that lookup() skips the probe inside geometry
+int benchProbeVolume(uint32_t numDirections) {
+    uint32_t errors = 0;
+    CubeMap env(16);
+    for (uint32_t level = 0; level < env.levels(); ++level) {
+        for (uint32_t faceIndex = 0; faceIndex < 6; ++faceIndex) {
+            std::fill(env.face(level, faceIndex), env.face(level, faceIndex) + env.size(level) * env.size(level),
+                      glm::vec4{Radiance, 1.0f});
+        }
+    }
+    ProbeVolume::Settings settings;
+    settings.numDirections = numDirections;
+
+    // the cosine convolution of a constant is the constant, band 0 is the whole projection
+    ProbeVolume open(BoundsMin, BoundsMax, Resolution, settings);
+    const auto start = std::chrono::steady_clock::now();
+    open.bake(env);
+    const double bakeTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    SHL2 direct;
+    const uint32_t numReference = 1 << 14;
+    const float goldenAngle = PI * (3.0f - std::sqrt(5.0f));
+    for (uint32_t i = 0; i < numReference; ++i) {
+        float y = 1.0f - 2.0f * (i + 0.5f) / numReference;
+        float r = std::sqrt(std::max(0.0f, 1.0f - y * y));
+        direct.addSample({r * std::cos(goldenAngle * i), y, r * std::sin(goldenAngle * i)}, Radiance,
+                         4.0f * PI / numReference);
+    }
+    float openError = 0.0f, directError = 0.0f;
+    for (uint32_t index = 0; index < open.numProbes(); ++index) {
+        errors += open.isValid(index) ? 0 : 1;
+        const SHL2 sh = probeSH(open, index);
+        for (const glm::vec3 &normal : Normals) {
+            const glm::vec3 irradiance = sh.irradiance(normal);
+            openError = std::max(openError, relativeDifference(irradiance, Radiance));
+            directError = std::max(directError, relativeDifference(irradiance, direct.irradiance(normal)));
+        }
+    }
+    errors += openError > 0.02f || directError > 0.02f ? 1 : 0;
+
+    // the probes right below and above the floor lose the sky behind it and keep the other half. rays that leave the
+    // box see the sky, so only the middle column is close enough to the floor for it to cover nearly all of them
+    ProbeVolume floor(BoundsMin, BoundsMax, Resolution, settings);
+    addFloor(floor, 0.3f);
+    floor.bake(env);
+    float blocked = 0.0f, unblocked = INFINITY;
+    for (uint32_t y : {2u, 3u}) {
+        const glm::vec3 toFloor{0.0f, y == 2 ? 1.0f : -1.0f, 0.0f};
+        const SHL2 sh = probeSH(floor, floor.probeIndex(2, y, 2));
+        blocked = std::max(blocked, sh.irradiance(toFloor).y / Radiance.y);
+        unblocked = std::min(unblocked, sh.irradiance(-toFloor).y / Radiance.y);
+    }
+    errors += blocked > 0.15f || unblocked < 0.85f ? 1 : 0;
+
+    // exact at the probes, halfway between two of them their average
+    float probeError = 0.0f;
+    for (uint32_t index : {floor.probeIndex(0, 0, 0), floor.probeIndex(2, 2, 2), floor.probeIndex(4, 3, 1)}) {
+        const uint32_t x = index % Resolution.x, y = index / Resolution.x % Resolution.y;
+        const uint32_t z = index / (Resolution.x * Resolution.y);
+        const SHL2 sampled = floor.sample(floor.probePosition(x, y, z));
+        probeError = std::max(probeError, maxDifference(sampled, probeSH(floor, index)));
+    }
+    SHL2 average;
+    const SHL2 below = probeSH(floor, floor.probeIndex(2, 2, 2)), above = probeSH(floor, floor.probeIndex(2, 3, 2));
+    for (uint32_t i = 0; i < SHL2::NumCoefficients; ++i) {
+        average.coefficients[i] = 0.5f * (below.coefficients[i] + above.coefficients[i]);
+    }
+    const glm::vec3 halfway = 0.5f * (floor.probePosition(2, 2, 2) + floor.probePosition(2, 3, 2));
+    probeError = std::max(probeError, maxDifference(floor.sample(halfway), average));
+    errors += probeError > 1e-5f ? 1 : 0;
+
+    // a triangle through probe (1, 1, 1) puts it inside geometry, its neighbours share its weight
+    ProbeVolume inside(BoundsMin, BoundsMax, Resolution, settings);
+    const glm::vec3 p = inside.probePosition(1, 1, 1);
+    const glm::vec3 triangle[] = {p + glm::vec3{-0.05f, 0.0f, -0.05f}, p + glm::vec3{0.05f, 0.0f, -0.05f},
+                                  p + glm::vec3{0.0f, 0.0f, 0.05f}};
+    const uint32_t triangleIndices[] = {0, 1, 2};
+    inside.addOccluder(triangle, triangleIndices, 3);
+    inside.bake(env);
+    const uint32_t insideIndex = inside.probeIndex(1, 1, 1);
+    errors += inside.isValid(insideIndex) ? 1 : 0;
+    const ProbeVolume::Lookup probes = inside.lookup(0.5f * (p + inside.probePosition(2, 2, 2)));
+    float totalWeight = 0.0f;
+    for (uint32_t corner = 0; corner < 8; ++corner) {
+        totalWeight += probes.weights[corner];
+        const float expected = probes.indices[corner] == insideIndex ? 0.0f : 1.0f / 7.0f;
+        errors += std::abs(probes.weights[corner] - expected) > 1e-6f ? 1 : 0;
+    }
+    errors += std::abs(totalWeight - 1.0f) > 1e-5f ? 1 : 0;
+
+    std::cout << open.numProbes() << " probes of " << numDirections << " rays baked in " << bakeTime
+              << " ms, constant environment error " << openError * 100.0f << "%, against SHL2 " << directError * 100.0f
+              << "%" << std::endl;
+    std::cout << "next to the floor: " << blocked * 100.0f << "% facing it, " << unblocked * 100.0f
+              << "% facing away, interpolation error " << probeError << std::endl;
+    std::cout << errors << " errors" << std::endl;
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,96 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <unordered_map>
+#include <stdexcept>
+
+#include "src/tests/Tests.h"
+#include "src/common/Registry.h"
+
+// looks up a frame worth of named entries the way draw() did with string keyed maps and through registry handles,
+// then checks stale handles, slot reuse, duplicate names and the visit over the live entries
+int benchRegistry(uint32_t numLookups) {
+    struct Entry {
+        uint64_t resource;
+        uint32_t descriptor;
+    };
+    const char *names[] = {"skybox", "pbr", "tonemap", "envTexture", "irradiance", "prefilter", "brdf", "albedo",
+                           "normal", "metalness", "roughness", "model"};
+    const uint32_t numNames = sizeof(names) / sizeof(names[0]);
+
+    std::unordered_map<std::string, Entry> map;
+    Registry<Entry, TextureHandle> registry;
+    std::vector<TextureHandle> handles;
+    for (uint32_t i = 0; i < numNames; ++i) {
+        map[names[i]] = {uint64_t(i) * 4096, i};
+        handles.push_back(registry.add(names[i], {uint64_t(i) * 4096, i}));
+    }
+
+    // the map lookups hash a string built from a literal, like mTextures["albedo"]
+    uint64_t mapSum = 0, registrySum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < numLookups; ++i) {
+        const Entry &entry = map[names[i % numNames]];
+        mapSum += entry.resource + entry.descriptor;
+    }
+    const double mapTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < numLookups; ++i) {
+        const Entry &entry = registry[handles[i % numNames]];
+        registrySum += entry.resource + entry.descriptor;
+    }
+    const double registryTime =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    uint32_t errors = mapSum != registrySum ? 1 : 0;
+    for (uint32_t i = 0; i < numNames; ++i) {
+        errors += registry.find(names[i]) != handles[i] || registry.name(handles[i]) != names[i] ? 1 : 0;
+    }
+    errors += registry.find("missing") ? 1 : 0;
+
+    // a removed entry's handle must not resolve to the entry that reuses its slot
+    registry.remove(handles[3]);
+    const TextureHandle reused = registry.add("reused", {1, 1});
+    errors += reused.index() != handles[3].index() || registry.valid(handles[3]) || !registry.valid(reused) ? 1 : 0;
+    errors += registry.find(names[3]) || registry.size() != numNames ? 1 : 0;
+    uint32_t throws = 0;
+    try {
+        registry.get(handles[3]);
+    } catch (const std::runtime_error &) {
+        ++throws;
+    }
+    try {
+        registry.add("reused", {2, 2});
+    } catch (const std::runtime_error &) {
+        ++throws;
+    }
+    try {
+        registry.get(TextureHandle());
+    } catch (const std::runtime_error &) {
+        ++throws;
+    }
+    errors += throws != 3 ? 1 : 0;
+
+    // every live entry once, the removed one skipped
+    uint32_t visited = 0;
+    uint64_t visitedSum = 0;
+    registry.forEach([&](const Entry &entry) {
+        ++visited;
+        visitedSum += entry.resource;
+    });
+    uint64_t liveSum = 1;
+    for (uint32_t i = 0; i < numNames; ++i) {
+        liveSum += i == 3 ? 0 : registry[handles[i]].resource;
+    }
+    errors += visited != numNames || visitedSum != liveSum ? 1 : 0;
+
+    std::cout << numLookups << " lookups of " << numNames << " names" << std::endl;
+    std::cout << "std::unordered_map<std::string>: " << mapTime << " ms, "
+              << mapTime * 1e6 / numLookups << " ns per lookup" << std::endl;
+    std::cout << "registry handles: " << registryTime << " ms, " << registryTime * 1e6 / numLookups
+              << " ns per lookup" << std::endl;
+    std::cout << errors << " errors" << std::endl;
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,193 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+
+#include "src/tests/Tests.h"
+#include "src/common/RenderGraph.h"
+
+namespace {
+    // sizes textures like a d3d12 device would, 64KB placement and 4MB for msaa
+    class MockGraphDevice : public RenderGraph::Device {
+    public:
+        static const uint32_t Rgba16f = 10;
+        static const uint32_t Rgba8 = 28;
+        static const uint32_t D24s8 = 45;
+
+        RenderGraph::Allocation allocation(const RenderGraph::TextureDesc &desc) const override {
+            const uint64_t alignment = desc.samples > 1 ? 4 << 20 : 64 << 10;
+            const uint64_t bytes = uint64_t(desc.width) * desc.height * desc.samples * (desc.format == Rgba16f ? 8 : 4);
+            return {(bytes + alignment - 1) / alignment * alignment, alignment};
+        }
+    };
+
+    // replays the compiled barriers of a graph and counts every access that finds its texture in the wrong state, every
+    // transient that ends the frame in another state than it started in and every pair of transients that share memory
+    // while both are alive
+    uint32_t checkRenderGraph(const RenderGraph &graph) {
+        const std::vector<RenderGraph::Resource> &resources = graph.resources();
+        std::vector<uint32_t> states(resources.size());
+        for (uint32_t i = 0; i < resources.size(); ++i) {
+            states[i] = resources[i].initialState;
+        }
+        uint32_t errors = 0;
+        auto record = [&](const std::vector<RenderGraph::Barrier> &barriers) {
+            for (const RenderGraph::Barrier &barrier : barriers) {
+                if (barrier.type == RenderGraph::Barrier::Transition) {
+                    errors += states[barrier.resource] != barrier.before ? 1 : 0;
+                    states[barrier.resource] = barrier.after;
+                }
+            }
+        };
+        for (const RenderGraph::Pass &pass : graph.passes()) {
+            if (pass.culled) {
+                continue;
+            }
+            record(pass.aliasing);
+            for (uint32_t resource : pass.discards) {
+                const uint32_t state = states[resource];
+                errors += state != RenderGraph::RenderTarget && state != RenderGraph::DepthWrite ? 1 : 0;
+            }
+            record(pass.barriers);
+            for (const RenderGraph::Access &access : pass.accesses) {
+                const uint32_t state = states[access.resource];
+                errors += (access.write ? state != access.state : (state & access.state) != access.state) ? 1 : 0;
+            }
+        }
+        record(graph.finalBarriers());
+
+        for (uint32_t a = 0; a < resources.size(); ++a) {
+            const uint32_t finalState = resources[a].imported ? resources[a].finalState : resources[a].initialState;
+            errors += states[a] != finalState ? 1 : 0;
+            for (uint32_t b = a + 1; b < resources.size(); ++b) {
+                const RenderGraph::Resource &ra = resources[a], &rb = resources[b];
+                if (ra.imported || rb.imported || ra.size == 0 || rb.size == 0) {
+                    continue;
+                }
+                const bool time = ra.firstPass <= rb.lastPass && rb.firstPass <= ra.lastPass;
+                const bool memory = ra.offset < rb.offset + rb.size && rb.offset < ra.offset + ra.size;
+                errors += time && memory ? 1 : 0;
+            }
+        }
+        return errors;
+    }
+}
+
+// compiles the frame of the dx12 backend against a mock device and prints what it decided, then times the compile of
+// a long chain of post processing passes. both graphs are replayed with checkRenderGraph
+int benchRenderGraph(uint32_t numPasses) {
+    MockGraphDevice device;
+    RenderGraph graph;
+    RenderGraph::TextureDesc colorDesc{1920, 1080, 4, MockGraphDevice::Rgba16f, false};
+    RenderGraph::TextureDesc depthDesc{1920, 1080, 4, MockGraphDevice::D24s8, true};
+    RenderGraph::TextureDesc resolveDesc{1920, 1080, 1, MockGraphDevice::Rgba16f, false};
+    const uint32_t color = graph.createTexture("color", colorDesc);
+    const uint32_t depth = graph.createTexture("depth", depthDesc);
+    const uint32_t resolve = graph.createTexture("resolve", resolveDesc);
+    const uint32_t luminance = graph.createTexture("luminance", resolveDesc);
+    const uint32_t backBuffer = graph.importTexture("back buffer", RenderGraph::Present, RenderGraph::Present);
+
+    const uint32_t scene = graph.addPass("scene", nullptr);
+    graph.write(scene, color, RenderGraph::RenderTarget);
+    graph.write(scene, depth, RenderGraph::DepthWrite);
+    const uint32_t resolvePass = graph.addPass("resolve", nullptr);
+    graph.read(resolvePass, color, RenderGraph::ResolveSource);
+    graph.write(resolvePass, resolve, RenderGraph::ResolveDest);
+    // nothing reads it, gets culled
+    const uint32_t luminancePass = graph.addPass("luminance", nullptr);
+    graph.read(luminancePass, resolve, RenderGraph::ShaderResource);
+    graph.write(luminancePass, luminance, RenderGraph::RenderTarget);
+    const uint32_t tonemap = graph.addPass("tonemap", nullptr);
+    graph.read(tonemap, resolve, RenderGraph::ShaderResource);
+    graph.write(tonemap, backBuffer, RenderGraph::RenderTarget);
+    graph.compile(device);
+
+    auto stateName = [](uint32_t state) {
+        const char *names[] = {"render target", "depth write", "depth read", "shader resource", "resolve source",
+                               "resolve dest", "copy source", "copy dest", "present"};
+        std::string name;
+        for (uint32_t bit = 0; bit < 9; ++bit) {
+            if (state & (1u << bit)) {
+                name += (name.empty() ? "" : " | ") + std::string(names[bit]);
+            }
+        }
+        return name.empty() ? std::string("common") : name;
+    };
+    auto printBarriers = [&](const std::vector<RenderGraph::Barrier> &barriers) {
+        for (const RenderGraph::Barrier &barrier : barriers) {
+            const std::string &name = graph.resources()[barrier.resource].name;
+            if (barrier.type == RenderGraph::Barrier::Aliasing) {
+                const uint32_t previous = barrier.previous;
+                std::cout << "    alias " << name << " after "
+                          << (previous == RenderGraph::NoResource ? "any" : graph.resources()[previous].name)
+                          << std::endl;
+            } else {
+                std::cout << "    " << name << ": " << stateName(barrier.before) << " -> " << stateName(barrier.after)
+                          << std::endl;
+            }
+        }
+    };
+    for (const RenderGraph::Pass &pass : graph.passes()) {
+        std::cout << pass.name << (pass.culled ? " (culled)" : "") << std::endl;
+        printBarriers(pass.aliasing);
+        for (uint32_t resource : pass.discards) {
+            std::cout << "    discard " << graph.resources()[resource].name << std::endl;
+        }
+        printBarriers(pass.barriers);
+    }
+    std::cout << "end of frame" << std::endl;
+    printBarriers(graph.finalBarriers());
+    for (const RenderGraph::Resource &resource : graph.resources()) {
+        if (resource.size > 0) {
+            std::cout << resource.name << ": " << resource.size / 1024 << " KB at " << resource.offset / 1024
+                      << " KB" << (resource.aliased ? ", aliased" : "") << std::endl;
+        }
+    }
+    const RenderGraph::Stats frameStats = graph.stats();
+    std::cout << frameStats.culled << " of " << frameStats.passes << " passes culled, " << frameStats.barriers
+              << " barriers in " << frameStats.batches << " batches" << std::endl;
+    std::cout << "transients " << frameStats.transientSize / 1024 << " KB, heap " << frameStats.heapSize / 1024
+              << " KB, aliasing saves " << frameStats.savedSize / 1024 << " KB" << std::endl;
+    uint32_t errors = checkRenderGraph(graph);
+    const bool expected = frameStats.culled == 1 && graph.passes()[luminancePass].culled &&
+                          graph.resources()[resolve].aliased &&
+                          frameStats.savedSize == device.allocation(resolveDesc).size;
+
+    // post processing chain ping ponging through full resolution targets, every fourth pass also writes a debug view
+    // nobody reads
+    RenderGraph chain;
+    const uint32_t numRuns = 100;
+    double compileTime = 0.0;
+    for (uint32_t run = 0; run < numRuns; ++run) {
+        chain.clear();
+        uint32_t input = chain.createTexture("scene", resolveDesc);
+        const uint32_t output = chain.importTexture("back buffer", RenderGraph::Present, RenderGraph::Present);
+        const uint32_t first = chain.addPass("scene", nullptr);
+        chain.write(first, input, RenderGraph::RenderTarget);
+        for (uint32_t i = 0; i < numPasses; ++i) {
+            const uint32_t pass = chain.addPass("post " + std::to_string(i), nullptr);
+            chain.read(pass, input, RenderGraph::ShaderResource);
+            if (i + 1 == numPasses) {
+                chain.write(pass, output, RenderGraph::RenderTarget);
+            } else {
+                input = chain.createTexture("post " + std::to_string(i), resolveDesc);
+                chain.write(pass, input, RenderGraph::RenderTarget);
+            }
+            if (i % 4 == 3) {
+                chain.write(pass, chain.createTexture("debug " + std::to_string(i), resolveDesc),
+                            RenderGraph::CopyDest);
+            }
+        }
+        auto start = std::chrono::steady_clock::now();
+        chain.compile(device);
+        compileTime += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+    const RenderGraph::Stats chainStats = chain.stats();
+    std::cout << "chain of " << chainStats.passes << " passes: " << compileTime / numRuns << " ms compile, "
+              << chainStats.barriers << " barriers in " << chainStats.batches << " batches, heap "
+              << chainStats.heapSize / 1024 << " KB of " << chainStats.transientSize / 1024 << " KB" << std::endl;
+    errors += checkRenderGraph(chain);
+
+    std::cout << errors << " errors" << (expected ? "" : ", frame compiled differently than expected") << std::endl;
+    return errors == 0 && expected ? 0 : 1;
+}
@@ -0,0 +1,148 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <string>
+#include <algorithm>
+
+#include "src/tests/Tests.h"
+#include "src/common/ResourceFootprint.h"
+#include "src/common/VramBudget.h"
+
+namespace {
+    using Subresource = ResourceFootprint::Subresource;
+
+    bool sameLayout(const Subresource &layout, uint64_t offset, uint32_t width, uint32_t height, uint32_t rowPitch,
+                    uint32_t numRows, uint64_t rowSize) {
+        return layout.offset == offset && layout.width == width && layout.height == height &&
+               layout.rowPitch == rowPitch && layout.numRows == numRows && layout.rowSize == rowSize;
+    }
+
+    ResourceFootprint::TextureDesc texture(uint32_t width, uint32_t height, ResourceFormat format,
+                                           uint32_t mipLevels = 1, uint32_t arraySize = 1) {
+        ResourceFootprint::TextureDesc desc;
+        desc.width = width;
+        desc.height = height;
+        desc.format = format;
+        desc.mipLevels = mipLevels;
+        desc.arraySize = arraySize;
+        return desc;
+    }
+}
+
+// checks ResourceFootprint against what GetCopyableFootprints and GetResourceAllocationInfo report for the same
+// resources: row pitch padding, block compressed mips smaller than a block, the subresource order of a cube, the
+// alignments of msaa targets and small textures. then plans a budget of numTextures textures next to the frame
+// resources and checks that the report adds up
+int benchResourceFootprint(uint32_t numTextures) {
+    uint32_t errors = 0;
+    std::vector<Subresource> layouts;
+
+    // a 1200 wide rgba8 row is 4800 bytes, pitched to 4864. the last row is not padded
+    ResourceFootprint::TextureDesc target = texture(1200, 900, ResourceFormat::RGBA8);
+    target.renderTarget = true;
+    uint64_t bytes = ResourceFootprint::copyableFootprints(target, 0, 1, 0, &layouts);
+    errors += bytes != 4864ull * 899 + 4800 || !sameLayout(layouts[0], 0, 1200, 900, 4864, 900, 4800) ? 1 : 0;
+    const uint32_t targetPitch = layouts[0].rowPitch;
+
+    // 2x2 and 1x1 mips of block compressed formats still take a whole 4x4 block, every mip starts 512 aligned
+    for (ResourceFormat format : {ResourceFormat::BC1, ResourceFormat::BC7}) {
+        const uint32_t blockBytes = format == ResourceFormat::BC1 ? 8 : 16;
+        bytes = ResourceFootprint::copyableFootprints(texture(16, 16, format, 0), 0, 5, 0, &layouts);
+        errors += layouts.size() != 5 ? 1 : 0;
+        errors += !sameLayout(layouts[0], 0, 16, 16, 256, 4, 4 * blockBytes) ? 1 : 0;
+        errors += !sameLayout(layouts[1], 1024, 8, 8, 256, 2, 2 * blockBytes) ? 1 : 0;
+        errors += !sameLayout(layouts[2], 1536, 4, 4, 256, 1, blockBytes) ? 1 : 0;
+        errors += !sameLayout(layouts[3], 2048, 4, 4, 256, 1, blockBytes) ? 1 : 0;
+        errors += !sameLayout(layouts[4], 2560, 4, 4, 256, 1, blockBytes) ? 1 : 0;
+        errors += bytes != 2560 + blockBytes ? 1 : 0;
+    }
+
+    // cube faces are array slices, subresource mip + slice * mipLevels. slice 1 starts behind all 7 mips of slice 0
+    const ResourceFootprint::TextureDesc cube = texture(64, 64, ResourceFormat::RGBA16F, 0, 6);
+    const uint64_t cubeBytes = ResourceFootprint::copyableFootprints(cube, 0, 6 * 7, 0, &layouts);
+    const uint64_t mipOffsets[] = {0, 32768, 40960, 45056, 47104, 48128, 48640};
+    for (uint32_t slice = 0; slice < 6; ++slice) {
+        for (uint32_t mip = 0; mip < 7; ++mip) {
+            const Subresource &layout = layouts[mip + slice * 7];
+            const uint32_t size = 64 >> mip;
+            errors += layout.offset != slice * 49152ull + mipOffsets[mip] || layout.width != size ||
+                      layout.height != size ? 1 : 0;
+        }
+    }
+    errors += cubeBytes != 5 * 49152ull + 48640 + 8 ? 1 : 0;
+    // a range of subresources is laid out from its own base
+    errors += ResourceFootprint::copyableFootprints(cube, 7, 7, 0) != 48648 ? 1 : 0;
+
+    // msaa targets align to 4 MB, a 1024x1024 rgba8 texture is 64 tiles of 128x128 texels
+    ResourceFootprint::TextureDesc msaa = target;
+    msaa.format = ResourceFormat::RGBA16F;
+    msaa.samples = 4;
+    const ResourceFootprint::Allocation msaaAllocation = ResourceFootprint::allocation(msaa);
+    errors += msaaAllocation.alignment != 4 << 20 || msaaAllocation.size % (64 << 10) != 0 ||
+              msaaAllocation.size < 1200ull * 900 * 8 * 4 ? 1 : 0;
+    const ResourceFootprint::Allocation large =
+        ResourceFootprint::allocation(texture(1024, 1024, ResourceFormat::RGBA8));
+    errors += large.size != 4 << 20 || large.alignment != 64 << 10 ? 1 : 0;
+
+    // a full 64x64 rgba8 chain is 21844 bytes in 4 KB pages, as a render target it takes a 64 KB tile
+    ResourceFootprint::TextureDesc small = texture(64, 64, ResourceFormat::RGBA8, 0);
+    const ResourceFootprint::Allocation smallAllocation = ResourceFootprint::allocation(small);
+    errors += smallAllocation.size != 24576 || smallAllocation.alignment != 4 << 10 ? 1 : 0;
+    small.renderTarget = true;
+    const ResourceFootprint::Allocation smallTarget = ResourceFootprint::allocation(small);
+    errors += smallTarget.size != 64 << 10 || smallTarget.alignment != 64 << 10 ? 1 : 0;
+
+    // the frame resources of DxRenderer, a mesh and a mix of texture sizes and formats
+    VramBudget budget;
+    budget.addFrameResources(1200, 900, 4, 2);
+    budget.addMesh("model", 1 << 16, 3 << 16);
+    const ResourceFormat formats[] = {ResourceFormat::RGBA8_SRGB, ResourceFormat::BC1, ResourceFormat::BC7,
+                                      ResourceFormat::R8};
+    for (uint32_t i = 0; i < numTextures; ++i) {
+        const uint32_t size = 16u << (i % 8);
+        budget.addTexture("texture " + std::to_string(i), texture(size, size, formats[i % 4], 0));
+    }
+    const auto start = std::chrono::steady_clock::now();
+    const VramBudget::Report report = budget.report();
+    const double reportTime =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    uint64_t totalBytes = 0, uploadBytes = 0, largestUpload = 0;
+    uint32_t resources = 0;
+    for (uint32_t category = 0; category < VramBudget::NumCategories; ++category) {
+        const VramBudget::CategoryReport &categoryReport = report.categories[category];
+        uint64_t resourceBytes = 0;
+        uint32_t categoryResources = 0;
+        for (const VramBudget::Resource &resource : budget.resources()) {
+            if (resource.category == category) {
+                resourceBytes += resource.allocation.size;
+                categoryResources++;
+            }
+        }
+        errors += categoryReport.resourceBytes != resourceBytes ? 1 : 0;
+        errors += categoryReport.resources != categoryResources ? 1 : 0;
+        // heaps hold at least what is placed in them
+        errors += categoryReport.committedBytes < categoryReport.resourceBytes ? 1 : 0;
+        totalBytes += categoryReport.committedBytes;
+        resources += categoryReport.resources;
+    }
+    for (const VramBudget::Resource &resource : budget.resources()) {
+        uploadBytes += resource.uploadBytes;
+        largestUpload = std::max(largestUpload, resource.uploadBytes);
+    }
+    errors += report.totalBytes != totalBytes || resources != budget.resources().size() ? 1 : 0;
+    errors += report.uploadBytes != uploadBytes || report.largestUpload != largestUpload ? 1 : 0;
+
+    std::cout << "1200 wide rgba8 pitch " << targetPitch << ", cube of " << layouts.size() << " subresources "
+              << cubeBytes << " bytes, 4x msaa target " << msaaAllocation.size / 1024 << " KB at "
+              << msaaAllocation.alignment / 1024 << " KB alignment, 64x64 chain " << smallAllocation.size << " bytes"
+              << std::endl;
+    std::cout << "budget of " << resources << " resources: " << report.totalBytes / (1 << 20) << " MB in";
+    for (uint32_t category = 0; category < VramBudget::NumCategories; ++category) {
+        std::cout << (category > 0 ? "," : "") << " " << VramBudget::categoryName(VramBudget::Category(category))
+                  << " " << report.categories[category].committedBytes / (1 << 20) << " MB";
+    }
+    std::cout << ", reported in " << reportTime << " ms" << std::endl;
+    std::cout << errors << " errors" << std::endl;
+    return errors == 0 ? 0 : 1;
+}
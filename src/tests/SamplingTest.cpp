@@ -0,0 +1,131 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cstring>
+#include <algorithm>
+
+#include "src/tests/Tests.h"
+#include "src/common/Sampling.h"
+#include "src/common/EnvBaker.h"
+#include "src/common/UploadRing.h"
+
+namespace {
+    // the fixed prefilter the way EnvBaker and prefilter.hlsl did it before the table, GGX half vector, pdf and mip
+    // of every sample worked out per texel
+    CubeMap prefilterPerTexel(const CubeMap &env) {
+        CubeMap result(env.size(), env.levels());
+        const float halfLog2Wt = 0.5f * std::log2(4.0f * PI / (6.0f * env.size() * env.size()));
+        for (uint32_t level = 1; level < result.levels(); ++level) {
+            const uint32_t size = result.size(level);
+            const float roughness = level / std::max(float(result.levels() - 1), 1.0f);
+            parallelFor(0, 6 * size, [&](uint32_t row) {
+                uint32_t faceIndex = row / size, y = row % size;
+                for (uint32_t x = 0; x < size; ++x) {
+                    glm::mat3 basis = tangentBasis(CubeMap::direction(faceIndex, float(x) / size, float(y) / size));
+                    const glm::vec3 &N = basis[2];
+                    glm::vec3 color{0.0f};
+                    float weight = 0.0f;
+                    for (uint32_t i = 0; i < PrefilterNumSamples; ++i) {
+                        glm::vec3 localH = importanceSampleGGX(hammersley(i, PrefilterNumSamples), roughness);
+                        glm::vec3 H = basis * localH;
+                        glm::vec3 L = glm::normalize(2.0f * glm::dot(N, H) * H - N);
+                        float NdotL = std::max(glm::dot(N, L), 0.0f);
+                        if (NdotL > 0.0f) {
+                            float pdf = ndfGGX(localH.z, roughness) * 0.25f;
+                            float mipLevel = 0.5f * std::log2(1.0f / (PrefilterNumSamples * pdf)) - halfLog2Wt + 1.0f;
+                            color += glm::vec3{env.sample(L, std::max(mipLevel, 0.0f))} * NdotL;
+                            weight += NdotL;
+                        }
+                    }
+                    result.face(level, faceIndex)[y * size + x] = glm::vec4{color / weight, 1.0f};
+                }
+            });
+        }
+        return result;
+    }
+
+    double milliseconds(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+// checks that the compile time hammersley points and the GGX table built from them are bit for bit what the per
+// sample math produces, and that the bytes the renderer binds to t1 of prefilter.hlsl for every level are the cpu
+// table's. then bakes a faceSize environment with the fixed scheme from the table and per texel, and reports the
+// speedup and the largest difference
+int benchSampling(uint32_t faceSize) {
+    uint32_t errors = 0;
+
+    for (uint32_t i = 0; i < PrefilterNumSamples; ++i) {
+        Sample2D point = hammersley(i, PrefilterNumSamples);
+        errors += std::memcmp(&HammersleyTable<PrefilterNumSamples>[i], &point, sizeof(point)) != 0 ? 1 : 0;
+    }
+
+    // the renderer's table, one level per mip of the 1024 prefilter texture
+    const uint32_t levels = 11;
+    const GGXSampleTable table(levels);
+    for (uint32_t level = 1; level < levels; ++level) {
+        const float roughness = table.roughness(level);
+        for (uint32_t i = 0; i < table.numSamples(); ++i) {
+            glm::vec3 H = importanceSampleGGX(hammersley(i, PrefilterNumSamples), roughness);
+            const float pdf = ndfGGX(H.z, roughness) * 0.25f;
+            glm::vec4 expected{H, 0.5f * std::log2(1.0f / (PrefilterNumSamples * pdf))};
+            errors += std::memcmp(&table.level(level)[i], &expected, sizeof(expected)) != 0 ? 1 : 0;
+        }
+    }
+
+    // written into the upload ring behind a texture upload at the placement alignment of setup(), each level at the
+    // offset bound as the root srv
+    const uint64_t constantBufferAlignment = 256;
+    UploadRing ring(4 << 20);
+    std::vector<uint8_t> uploadBuffer(ring.capacity());
+    ring.allocate(12345, 512);
+    const uint64_t offset = ring.allocate(table.byteSize(), constantBufferAlignment);
+    errors += offset == UploadRing::Invalid || offset % constantBufferAlignment != 0 ? 1 : 0;
+    table.write(uploadBuffer.data() + offset);
+    for (uint32_t level = 0; level < levels; ++level) {
+        const uint8_t *bound = uploadBuffer.data() + offset + table.levelOffset(level);
+        errors += std::memcmp(bound, table.level(level), table.levelByteSize()) != 0 ? 1 : 0;
+    }
+
+    // sky over ground with a bright spot
+    CubeMap env(faceSize);
+    for (uint32_t faceIndex = 0; faceIndex < 6; ++faceIndex) {
+        for (uint32_t y = 0; y < faceSize; ++y) {
+            for (uint32_t x = 0; x < faceSize; ++x) {
+                glm::vec3 dir = glm::normalize(CubeMap::direction(faceIndex, (x + 0.5f) / faceSize,
+                                                                  (y + 0.5f) / faceSize));
+                float spot = 4.0f * std::pow(std::max(dir.x, 0.0f), 64.0f);
+                env.face(0, faceIndex)[y * faceSize + x] = glm::vec4{0.5f + 0.5f * dir.y + spot, 0.3f, 0.2f, 1.0f};
+            }
+        }
+    }
+    env.generateMipmaps();
+
+    EnvBaker::Settings settings;
+    settings.adaptive = false;
+    auto start = std::chrono::steady_clock::now();
+    const CubeMap reference = prefilterPerTexel(env);
+    const double perTexelTime = milliseconds(start);
+    start = std::chrono::steady_clock::now();
+    const CubeMap baked = EnvBaker::prefilter(env, settings);
+    const double tableTime = milliseconds(start);
+
+    float maxDifference = 0.0f;
+    for (uint32_t level = 1; level < baked.levels(); ++level) {
+        for (uint32_t faceIndex = 0; faceIndex < 6; ++faceIndex) {
+            for (uint32_t i = 0; i < baked.size(level) * baked.size(level); ++i) {
+                glm::vec4 a = baked.face(level, faceIndex)[i], b = reference.face(level, faceIndex)[i];
+                float difference = glm::length(glm::vec3{a - b}) / std::max(glm::length(glm::vec3{b}), 1e-6f);
+                maxDifference = std::max(maxDifference, difference);
+            }
+        }
+    }
+    errors += maxDifference > 1e-3f ? 1 : 0;
+
+    std::cout << "fixed prefilter of a " << faceSize << " cube: per texel " << perTexelTime << " ms, from the table "
+              << tableTime << " ms (" << perTexelTime / tableTime << "x), max relative difference " << maxDifference
+              << std::endl;
+    std::cout << errors << " errors" << std::endl;
+    return errors == 0 ? 0 : 1;
+}
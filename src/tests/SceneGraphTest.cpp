@@ -0,0 +1,83 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <glm.hpp>
+#include <gtc/matrix_transform.hpp>
+
+#include "src/tests/Tests.h"
+#include "src/common/SceneGraph.h"
+#include "src/common/Parallel.h"
+
+// random forest of transform hierarchies, updated with every node dirty, with a few animated nodes and with nothing to
+// do. the world matrices are checked against a scalar glm evaluation of every node
+int benchSceneGraph(uint32_t numNodes) {
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+    auto randomRotation = [&] {
+        return glm::angleAxis(6.2831853f * uniform(rng), glm::normalize(glm::vec3(uniform(rng), uniform(rng),
+                                                                                  uniform(rng)) - 0.5f + 1e-3f));
+    };
+
+    // one root per thousand nodes, every node gets a random earlier node of its own tree as parent
+    SceneGraph scene;
+    std::vector<uint32_t> roots;
+    for (uint32_t i = 0; i < numNodes; ++i) {
+        uint32_t parent = SceneGraph::NoParent;
+        if (i % 1000 != 0) {
+            const uint32_t root = roots.back();
+            parent = root + std::min(static_cast<uint32_t>(uniform(rng) * (i - root)), i - root - 1);
+        } else {
+            roots.push_back(i);
+        }
+        scene.addNode(parent, glm::vec3(uniform(rng), uniform(rng), uniform(rng)) * 2.0f - 1.0f, randomRotation(),
+                      glm::vec3(0.9f + 0.2f * uniform(rng)));
+    }
+    scene.update();
+
+    const uint32_t numRuns = 50;
+    auto run = [&](uint32_t numDirty, bool everything) {
+        double time = 0.0;
+        uint64_t updated = 0;
+        for (uint32_t run = 0; run < numRuns; ++run) {
+            if (everything) {
+                for (uint32_t root : roots) {
+                    scene.setRotation(root, randomRotation());
+                }
+            }
+            for (uint32_t i = 0; i < numDirty; ++i) {
+                const uint32_t node = std::min(static_cast<uint32_t>(uniform(rng) * numNodes), numNodes - 1);
+                scene.setTranslation(node, scene.translation(node) + 0.01f);
+            }
+            scene.update();
+            time += scene.stats().updateTime;
+            updated += scene.stats().updated;
+        }
+        std::cout << time / numRuns << " ms average, " << double(updated) / numRuns << " nodes updated" << std::endl;
+    };
+
+    const SceneGraph::Stats &stats = scene.stats();
+    std::cout << stats.nodes << " nodes in " << roots.size() << " trees, " << stats.levels << " levels, "
+              << ThreadPool::instance().numThreads() << " threads" << std::endl;
+    std::cout << "all dirty: ";
+    run(0, true);
+    std::cout << "1% of the nodes dirty: ";
+    run(numNodes / 100, false);
+    std::cout << "nothing dirty: ";
+    run(0, false);
+
+    float maxError = 0.0f;
+    std::vector<glm::mat4> reference(numNodes);
+    for (uint32_t i = 0; i < numNodes; ++i) {
+        glm::mat4 local = glm::translate(glm::mat4(1.0f), scene.translation(i)) * glm::mat4_cast(scene.rotation(i)) *
+                          glm::scale(glm::mat4(1.0f), scene.scale(i));
+        reference[i] = scene.parent(i) == SceneGraph::NoParent ? local : reference[scene.parent(i)] * local;
+        for (int c = 0; c < 4; ++c) {
+            glm::vec4 difference = glm::abs(reference[i][c] - scene.world(i)[c]);
+            maxError = std::max(maxError, std::max(std::max(difference.x, difference.y),
+                                                   std::max(difference.z, difference.w)));
+        }
+    }
+    std::cout << "max difference to the scalar reference " << maxError << std::endl;
+    return maxError < 1e-3f ? 0 : 1;
+}
@@ -0,0 +1,86 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <fstream>
+#include <filesystem>
+
+#include "src/tests/Tests.h"
+#include "src/common/ShaderCache.h"
+
+// keys of the backend's shaders and a scratch tree of includes. checks that keys follow every input, that the
+// include scan skips commented includes and resolves relative paths, and that a second cache reads the first one's
+// blobs from disk. times the key of every shader and the memory lookups
+int benchShaderCache(uint32_t numLookups) {
+    const std::filesystem::path scratch = std::filesystem::temp_directory_path() / "luma_shader_cache_bench";
+    std::filesystem::remove_all(scratch);
+    std::filesystem::create_directories(scratch / "include");
+    auto write = [&](const std::string &name, const std::string &text) {
+        std::ofstream((scratch / name).string(), std::ios::binary) << text;
+    };
+    write("main.hlsl", "#include \"include/b.hlsli\"\n// #include \"missing.hlsli\"\n"
+                       "/* #include \"missing.hlsli\"\n*/\nfloat4 main() : SV_Target { return b(); }\n");
+    write("include/b.hlsli", "  #  include \"../c.hlsli\"\nfloat4 b() { return c(); }\n");
+    write("c.hlsli", "float4 c() { return 1.0; }\n");
+    const std::string main = (scratch / "main.hlsl").string();
+    uint32_t errors = 0;
+
+    const std::vector<std::string> dependencies = ShaderCache::dependencies(main);
+    errors += dependencies.size() != 3 || dependencies[1].find("include/b.hlsli") == std::string::npos ||
+              dependencies[2].find("c.hlsli") == std::string::npos ? 1 : 0;
+    const uint64_t key = ShaderCache::shaderKey(main, "main", "ps_5_0", {}, 0);
+    errors += key != ShaderCache::shaderKey(main, "main", "ps_5_0", {}, 0) ? 1 : 0;
+    errors += key == ShaderCache::shaderKey(main, "other", "ps_5_0", {}, 0) ? 1 : 0;
+    errors += key == ShaderCache::shaderKey(main, "main", "ps_5_1", {}, 0) ? 1 : 0;
+    errors += key == ShaderCache::shaderKey(main, "main", "ps_5_0", {{"SAMPLES", "4"}}, 0) ? 1 : 0;
+    errors += key == ShaderCache::shaderKey(main, "main", "ps_5_0", {}, 1) ? 1 : 0;
+    write("c.hlsli", "float4 c() { return 0.5; }\n");
+    const uint64_t changedKey = ShaderCache::shaderKey(main, "main", "ps_5_0", {}, 0);
+    errors += changedKey == key ? 1 : 0;
+
+    const std::vector<uint8_t> blob = {'D', 'X', 'B', 'C', 1, 2, 3};
+    {
+        ShaderCache cache((scratch / "cache").string());
+        errors += cache.find(key) != nullptr ? 1 : 0;
+        cache.store(key, blob);
+        cache.save("pipelines.bin", {4, 5, 6});
+    }
+    ShaderCache cache((scratch / "cache").string());
+    const std::vector<uint8_t> *found = cache.find(key);
+    errors += !found || *found != blob || cache.find(changedKey) != nullptr ? 1 : 0;
+    std::vector<uint8_t> library;
+    errors += !cache.load("pipelines.bin", library) || library.size() != 3 || cache.load("none.bin", library) ? 1 : 0;
+    errors += cache.stats().diskHits != 1 || cache.stats().misses != 1 ? 1 : 0;
+
+    // the keys dxrenderer computes on every launch
+    std::vector<std::string> shaders;
+    for (const auto &entry : std::filesystem::directory_iterator("src/backend/dx12/shaders")) {
+        if (entry.path().extension() == ".hlsl") {
+            shaders.push_back(entry.path().generic_string());
+        }
+    }
+    auto start = std::chrono::steady_clock::now();
+    std::vector<uint64_t> keys;
+    for (const std::string &shader : shaders) {
+        keys.push_back(ShaderCache::shaderKey(shader, "main", "cs_5_0", {}, 0));
+    }
+    const double keyTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::sort(keys.begin(), keys.end());
+    errors += std::unique(keys.begin(), keys.end()) != keys.end() ? 1 : 0;
+
+    start = std::chrono::steady_clock::now();
+    uint32_t hits = 0;
+    for (uint32_t i = 0; i < numLookups; ++i) {
+        hits += cache.find(key) != nullptr ? 1 : 0;
+    }
+    const double lookupTime =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    errors += hits != numLookups ? 1 : 0;
+    std::filesystem::remove_all(scratch);
+
+    std::cout << shaders.size() << " shaders keyed in " << keyTime << " ms, "
+              << lookupTime * 1e6 / numLookups << " ns per memory hit" << std::endl;
+    std::cout << errors << " errors" << std::endl;
+    return errors == 0 ? 0 : 1;
+}
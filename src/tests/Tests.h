@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+
+// checks and benchmarks of src/common run by LumaTests. each prints what it measured and returns 0 when every
+// check passed, the argument scales the work
+int benchRenderGraph(uint32_t numPasses);
+int benchDescriptorAllocator(uint32_t numOperations);
+int benchUploadRing(uint32_t numUploads);
+int benchHeapAllocator(uint32_t numOperations);
+int benchShaderCache(uint32_t numLookups);
+int benchFrameTimeline(uint32_t numFrames);
+int benchPbrShading(uint32_t numPixels);
+int benchTextureSampling(uint32_t numSamples);
+int benchOcclusionCulling(uint32_t numProps);
+int benchLightClusters(uint32_t numLights);
+int benchSceneGraph(uint32_t numNodes);
+int benchDrawSort(uint32_t numPackets);
+int benchRegistry(uint32_t numLookups);
+int benchConstantAllocator(uint32_t numDraws);
+int benchRenderThread(uint32_t numFrames);
+int benchParallel(uint32_t numItems);
+int benchOctahedralMap(uint32_t faceSize);
+int benchSampling(uint32_t faceSize);
+int benchEnvBaker(uint32_t faceSize);
+int benchBrdfLut(uint32_t numRows);
+int benchProbeVolume(uint32_t numDirections);
+int benchResourceFootprint(uint32_t numTextures);
+int benchImageCompare(uint32_t size);
+int benchInstanceBatcher(uint32_t numInstances);
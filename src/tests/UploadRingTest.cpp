@@ -0,0 +1,75 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+#include "src/tests/Tests.h"
+#include "src/common/UploadRing.h"
+
+// setup uploads of mesh and texture sizes through the ring, submitted in batches the gpu completes two batches late.
+// live ranges are checked for overlap with every batch the gpu may still copy from, and the round trips compared
+// against waiting for every upload on its own
+int benchUploadRing(uint32_t numUploads) {
+    std::mt19937 rng(1);
+    const uint64_t capacity = 64 << 20, alignment = 512;
+    UploadRing ring(capacity);
+    uint32_t errors = 0;
+
+    struct Range {
+        uint64_t offset, size, fence;
+    };
+    std::vector<Range> live;
+    uint64_t fence = 0, completedFence = 0, bytes = 0;
+    uint32_t roundTrips = 0, batches = 0;
+    auto retire = [&](uint64_t completed) {
+        completedFence = std::max(completedFence, completed);
+        ring.retire(completedFence);
+        live.erase(std::remove_if(live.begin(), live.end(), [&](const Range &range) {
+            return range.fence != 0 && range.fence <= completedFence;
+        }), live.end());
+    };
+    auto flush = [&]() {
+        ring.finishBatch(++fence);
+        for (Range &range : live) {
+            range.fence = range.fence == 0 ? fence : range.fence;
+        }
+        ++batches;
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < numUploads; ++i) {
+        // three meshes or small textures for every large texture
+        const uint64_t size = i % 4 == 3 ? (256 << 10) + rng() % (16 << 20) : (4 << 10) + rng() % (1 << 20);
+        uint64_t offset = ring.allocate(size, alignment);
+        while (offset == UploadRing::Invalid) {
+            flush();
+            retire(ring.oldestFence());
+            ++roundTrips;
+            offset = ring.allocate(size, alignment);
+        }
+        errors += offset % alignment != 0 || offset + size > capacity ? 1 : 0;
+        for (const Range &range : live) {
+            errors += offset < range.offset + range.size && range.offset < offset + size ? 1 : 0;
+        }
+        live.push_back({offset, size, 0});
+        bytes += size;
+
+        // a compute pass every few uploads submits the batch without waiting, the gpu trails two batches behind
+        if (i % 8 == 7) {
+            flush();
+            retire(fence >= 2 ? fence - 2 : 0);
+        }
+    }
+    flush();
+    const double time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    retire(fence);
+    errors += ring.used() != 0 || !live.empty() ? 1 : 0;
+
+    std::cout << numUploads << " uploads, " << bytes / double(1 << 20) << " MB through a " << (capacity >> 20)
+              << " MB ring in " << batches << " batches, " << time * 1e6 / numUploads << " ns per upload" << std::endl;
+    std::cout << "round trips: " << numUploads << " waiting for every upload, " << roundTrips
+              << " waiting only when the ring is full" << std::endl;
+    std::cout << errors << " errors" << std::endl;
+    return errors == 0 ? 0 : 1;
+}